@@ -62,6 +62,9 @@ public:
 	uint32_t cv1Value = 0;
 	//@}
 
+	/// Latest averaged CV1 value at 16 bit resolution, keeps the bits that the boxcar average truncates. Use with ExpoConverter::convert16 for 1v/oct.
+	uint32_t cv1ValueHiRes = 0;
+
 
 	/// Update the average for each ADC with the latest value.
 	/// Should be easier to roll your own filter...
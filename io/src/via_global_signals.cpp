@@ -15,6 +15,7 @@ void ViaControls::update(void) {
 
 	/// Write the averaged controls to the output variables.
 	cv1Value = cv1Sum >> 3;
+	cv1ValueHiRes = cv1Sum << 1;
 	knob1Value = knob1Sum >> 6;
 	knob2Value = knob2Sum >> 6;
 	knob3Value = knob3Sum >> 6;
@@ -37,6 +38,7 @@ void ViaControls::updateSlow(void) {
 
 	/// Write the averaged controls to the output variables.
 	cv1Value = cv1Sum >> 8;
+	cv1ValueHiRes = cv1Sum >> 4;
 	knob1Value = knob1Sum >> 8;
 	knob2Value = knob2Sum >> 8;
 	knob3Value = knob3Sum >> 8;
@@ -85,6 +87,7 @@ void ViaControls::updateExtra(void) {
 
 	/// Write the averaged controls to the output variables.
 	cv1Value = cv1Sum >> 3;
+	cv1ValueHiRes = cv1Sum << 1;
 	knob1Value = knob1Sum >> 6;
 	knob2Value = knob2Sum >> 6;
 	knob3Value = knob3Sum >> 6;
@@ -133,6 +136,7 @@ void ViaControls::updateExtraNoCV1(void) {
 
 	/// Write the averaged controls to the output variables.
 	cv1Value = cv1Average;
+	cv1ValueHiRes = cv1Average << 4;
 	knob1Value = knob1Sum >> 6;
 	knob2Value = knob2Sum >> 6;
 	knob3Value = knob3Sum >> 6;
@@ -178,6 +182,7 @@ void ViaControls::updateSlowExtra(void) {
 
 	/// Write the averaged controls to the output variables.
 	cv1Value = cv1Sum >> 10;
+	cv1ValueHiRes = cv1Sum >> 6;
 	knob1Value = knob1Sum >> 10;
 	knob2Value = knob2Sum >> 10;
 	knob3Value = knob3Sum >> 10;
@@ -207,12 +212,14 @@ void ViaControls::updateNoAverage(void) {
 	}
 
 	cv1Value = ((4095 << 2) - cv1Average) >> 2;
+	cv1ValueHiRes = ((4095 << 2) - cv1Average) << 2;
 	knob1Value = knob1Average >> 2;
 	knob2Value = knob2Average >> 2;
 	knob3Value = knob3Average >> 2;
 #endif
 #ifdef BUILD_VIRTUAL
 	cv1Value = cv1;
+	cv1ValueHiRes = cv1 << 4;
 	knob1Value = knob1;
 	knob2Value = knob2;
 	knob3Value = knob3;
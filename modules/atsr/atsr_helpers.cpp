@@ -7,10 +7,10 @@
 
 #include <atsr.hpp>
 
-constexpr int32_t ViaAtsr::expoSlope[4097];
-constexpr int32_t ViaAtsr::logSlope[4097];
-constexpr int32_t ViaAtsr::linSlope[4097];
-constexpr int32_t ViaAtsr::sigmoidSlope[4097];
+constexpr ViaAtsr::SlopeTable ViaAtsr::expoSlope;
+constexpr ViaAtsr::SlopeTable ViaAtsr::logSlope;
+constexpr ViaAtsr::SlopeTable ViaAtsr::linSlope;
+constexpr ViaAtsr::SlopeTable ViaAtsr::sigmoidSlope;
 
 void ViaAtsr::render(int32_t writePosition) {
 
@@ -10,13 +10,13 @@
 void ViaAtsr::handleButton1ModeChange(int32_t mode) {
 
 	if (mode == 0) {
-		aSlope = (int32_t *) expoSlope;
+		aSlope = (int32_t *) expoSlope.data;
 	} else if (mode == 1) {
-		aSlope = (int32_t *) linSlope;
+		aSlope = (int32_t *) linSlope.data;
 	} else if (mode ==  2) {
-		aSlope = (int32_t *) sigmoidSlope;
+		aSlope = (int32_t *) sigmoidSlope.data;
 	} else if (mode ==  3) {
-		aSlope = (int32_t *) logSlope;
+		aSlope = (int32_t *) logSlope.data;
 	}
 
 
@@ -25,13 +25,13 @@ void ViaAtsr::handleButton1ModeChange(int32_t mode) {
 void ViaAtsr::handleButton2ModeChange(int32_t mode) {
 
 	if (mode == 0) {
-		dSlope = (int32_t *) expoSlope;
+		dSlope = (int32_t *) expoSlope.data;
 	} else if (mode == 1) {
-		dSlope = (int32_t *) linSlope;
+		dSlope = (int32_t *) linSlope.data;
 	} else if (mode ==  2) {
-		dSlope = (int32_t *) sigmoidSlope;
+		dSlope = (int32_t *) sigmoidSlope.data;
 	} else if (mode ==  3) {
-		dSlope = (int32_t *) logSlope;
+		dSlope = (int32_t *) logSlope.data;
 	}
 
 
@@ -66,13 +66,13 @@ void ViaAtsr::handleButton5ModeChange(int32_t mode) {
 void ViaAtsr::handleButton6ModeChange(int32_t mode) {
 
 	if (mode == 0) {
-		rSlope = (int32_t *) expoSlope;
+		rSlope = (int32_t *) expoSlope.data;
 	} else if (mode == 1) {
-		rSlope = (int32_t *) linSlope;
+		rSlope = (int32_t *) linSlope.data;
 	} else if (mode ==  2) {
-		rSlope = (int32_t *) sigmoidSlope;
+		rSlope = (int32_t *) sigmoidSlope.data;
 	} else if (mode ==  3) {
-		rSlope = (int32_t *) logSlope;
+		rSlope = (int32_t *) logSlope.data;
 	}
 
 
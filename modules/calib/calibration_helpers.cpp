@@ -7,7 +7,7 @@
 
 #include "calib.hpp"
 
-constexpr int32_t Sine::big_sine[4097];
+constexpr SineTable Sine::big_sine;
 
 /// Pass in the position in the output buffer that needs to be filled.
 void ViaCalib::renderFixedOutputs(int32_t writePosition) {
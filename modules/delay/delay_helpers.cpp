@@ -8,7 +8,7 @@
 #include "delay.hpp"
 
 /// defined for linkage
-constexpr uint32_t RevExpoConverter::expoTable[];
+constexpr ExpoTable RevExpoConverter::expoTable;
 
 /// Iterate over the relevant section of the dac output buffers like in renderFixedOutputs().
 void ViaDelay::render(int32_t writePosition) {
@@ -185,6 +185,7 @@ void DualEuclidean::processMainRisingEdge(void) {
 
 #ifdef BUILD_VIRTUAL
 	periodCount = virtualTimer1Count;
+	periodDivisor.set(periodCount);
 	virtualTimer1Count = 0;
 	if (!clockOn || virtualTimer2Count > 16) {
 		virtualTimer3Enable = 0;
@@ -199,6 +200,7 @@ void DualEuclidean::processMainRisingEdge(void) {
 #endif
 #ifdef BUILD_F373
 	periodCount = TIM5->CNT;
+	periodDivisor.set(periodCount);
 	TIM5->CNT = 0;
 	if (!clockOn || TIM2->CNT > (periodCount >> 8)) {
 
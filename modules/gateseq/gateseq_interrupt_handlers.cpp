@@ -49,14 +49,14 @@ void ViaGateseq::mainRisingEdgeCallback() {
 
 #ifdef BUILD_F373
 	if (softGateBOn) {
-		gateController.attackTimeB = ((1 << 20) * 1439 / sequencer.periodCount) << 12;
+		gateController.attackTimeB = sequencer.periodDivisor.divide((1 << 20) * 1439) << 12;
 	} else {
 		gateController.attackTimeB = (1 << 27);
 	}
 #endif
 #ifdef BUILD_VIRTUAL
 	if (softGateBOn) {
-		gateController.attackTimeB = ((1 << 22) / sequencer.periodCount) << 12;
+		gateController.attackTimeB = sequencer.periodDivisor.divide(1 << 22) << 12;
 	} else {
 		gateController.attackTimeB = (1 << 27);
 	}
@@ -114,14 +114,14 @@ void ViaGateseq::auxTimer1InterruptCallback() {
 
 #ifdef BUILD_F373
 	if (softGateAOn) {
-		gateController.attackTimeA = ((1 << 20) * 1439 / sequencer.periodCount) << 12;
+		gateController.attackTimeA = sequencer.periodDivisor.divide((1 << 20) * 1439) << 12;
 	} else {
 		gateController.attackTimeA = (1 << 27);
 	}
 #endif
 #ifdef BUILD_VIRTUAL
 	if (softGateAOn) {
-		gateController.attackTimeA = ((1 << 22) / sequencer.periodCount) << 12;
+		gateController.attackTimeA = sequencer.periodDivisor.divide(1 << 22) << 12;
 	} else {
 		gateController.attackTimeA = (1 << 27);
 	}
@@ -18,6 +18,40 @@
 /// Callback to link to the C code in the STM32 Touch Sense Library.
 void atsrTouchLink (void *);
 
+/// Define ATSR_COMPACT_SLOPES to interpolate the stage curves from 257 entry tables instead of 4097.
+#ifdef ATSR_COMPACT_SLOPES
+#define ATSR_SLOPE_BITS 8
+#else
+#define ATSR_SLOPE_BITS 12
+#endif
+#define ATSR_SLOPE_LENGTH ((1 << ATSR_SLOPE_BITS) + 1)
+
+/// Stage curve generators, 16 bit values rising from 0 to 65535 over the table.
+
+struct ExpoSlopeGenerator {
+	static constexpr double value(int32_t index, int32_t length) {
+		return 65535.0 * (constexpr_exp(4.0 * index / (length - 1)) - 1) / (constexpr_exp(4.0) - 1);
+	}
+};
+
+struct LogSlopeGenerator {
+	static constexpr double value(int32_t index, int32_t length) {
+		return 65535.0 * (constexpr_log(1 + 63.0 * index / (length - 1)) / constexpr_log(64.0));
+	}
+};
+
+struct LinSlopeGenerator {
+	static constexpr double value(int32_t index, int32_t length) {
+		return 65535.0 * index / (length - 1);
+	}
+};
+
+struct SigmoidSlopeGenerator {
+	static constexpr double value(int32_t index, int32_t length) {
+		return 32767.5 * (constexpr_tanh(4.0 * index / (length - 1) - 2.0) / constexpr_tanh(2.0) + 1);
+	}
+};
+
 /// Calibration/template module class.
 
 /** A simple self calibration tool that doubles as an introductory template.*/
@@ -158,18 +192,20 @@ public:
 
 #define MAX_PHASE 0xFFFFFFF
 
-	static constexpr int32_t expoSlope[4097] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 13, 14, 15, 16, 18, 19, 20, 21, 22, 24, 25, 26, 27, 28, 30, 31, 32, 33, 35, 36, 37, 38, 40, 41, 42, 43, 44, 46, 47, 48, 49, 51, 52, 53, 54, 56, 57, 58, 59, 61, 62, 63, 64, 66, 67, 68, 69, 71, 72, 73, 75, 76, 77, 78, 80, 81, 82, 83, 85, 86, 87, 89, 90, 91, 92, 94, 95, 96, 98, 99, 100, 101, 103, 104, 105, 107, 108, 109, 111, 112, 113, 114, 116, 117, 118, 120, 121, 122, 124, 125, 126, 128, 129, 130, 132, 133, 134, 136, 137, 138, 139, 141, 142, 143, 145, 146, 147, 149, 150, 152, 153, 154, 156, 157, 158, 160, 161, 162, 164, 165, 166, 168, 169, 170, 172, 173, 175, 176, 177, 179, 180, 181, 183, 184, 185, 187, 188, 190, 191, 192, 194, 195, 197, 198, 199, 201, 202, 203, 205, 206, 208, 209, 210, 212, 213, 215, 216, 217, 219, 220, 222, 223, 225, 226, 227, 229, 230, 232, 233, 234, 236, 237, 239, 240, 242, 243, 244, 246, 247, 249, 250, 252, 253, 255, 256, 257, 259, 260, 262, 263, 265, 266, 268, 269, 271, 272, 273, 275, 276, 278, 279, 281, 282, 284, 285, 287, 288, 290, 291, 293, 294, 296, 297, 298, 300, 301, 303, 304, 306, 307, 309, 310, 312, 313, 315, 316, 318, 319, 321, 322, 324, 325, 327, 328, 330, 332, 333, 335, 336, 338, 339, 341, 342, 344, 345, 347, 348, 350, 351, 353, 354, 356, 358, 359, 361, 362, 364, 365, 367, 368, 370, 372, 373, 375, 376, 378, 379, 381, 382, 384, 386, 387, 389, 390, 392, 393, 395, 397, 398, 400, 401, 403, 405, 406, 408, 409, 411, 413, 414, 416, 417, 419, 421, 422, 424, 425, 427, 429, 430, 432, 433, 435, 437, 438, 440, 442, 443, 445, 446, 448, 450, 451, 453, 455, 456, 458, 460, 461, 463, 464, 466, 468, 469, 471, 473, 474, 476, 478, 479, 481, 483, 484, 486, 488, 489, 491, 493, 494, 496, 498, 499, 501, 503, 504, 506, 508, 510, 511, 513, 515, 516, 518, 520, 521, 523, 525, 527, 528, 530, 532, 533, 535, 537, 539, 540, 542, 544, 545, 547, 549, 551, 552, 554, 556, 558, 559, 561, 563, 565, 566, 568, 570, 572, 573, 575, 577, 579, 580, 582, 584, 586, 587, 589, 591, 593, 594, 596, 598, 600, 602, 603, 605, 607, 609, 611, 612, 614, 616, 618, 619, 621, 623, 625, 627, 628, 630, 632, 634, 636, 638, 639, 641, 643, 645, 647, 648, 650, 652, 654, 656, 658, 659, 661, 663, 665, 667, 669, 671, 672, 674, 676, 678, 680, 682, 684, 685, 687, 689, 691, 693, 695, 697, 699, 700, 702, 704, 706, 708, 710, 712, 714, 715, 717, 719, 721, 723, 725, 727, 729, 731, 733, 734, 736, 738, 740, 742, 744, 746, 748, 750, 752, 754, 756, 758, 760, 761, 763, 765, 767, 769, 771, 773, 775, 777, 779, 781, 783, 785, 787, 789, 791, 793, 795, 797, 799, 801, 803, 805, 807, 809, 810, 812, 814, 816, 818, 820, 822, 824, 826, 828, 830, 832, 834, 836, 838, 841, 843, 845, 847, 849, 851, 853, 855, 857, 859, 861, 863, 865, 867, 869, 871, 873, 875, 877, 879, 881, 883, 885, 887, 889, 892, 894, 896, 898, 900, 902, 904, 906, 908, 910, 912, 914, 916, 919, 921, 923, 925, 927, 929, 931, 933, 935, 937, 940, 942, 944, 946, 948, 950, 952, 954, 957, 959, 961, 963, 965, 967, 969, 971, 974, 976, 978, 980, 982, 984, 987, 989, 991, 993, 995, 997, 999, 1002, 1004, 1006, 1008, 1010, 1013, 1015, 1017, 1019, 1021, 1024, 1026, 1028, 1030, 1032, 1034, 1037, 1039, 1041, 1043, 1046, 1048, 1050, 1052, 1054, 1057, 1059, 1061, 1063, 1066, 1068, 1070, 1072, 1075, 1077, 1079, 1081, 1084, 1086, 1088, 1090, 1093, 1095, 1097, 1099, 1102, 1104, 1106, 1108, 1111, 1113, 1115, 1118, 1120, 1122, 1124, 1127, 1129, 1131, 1134, 1136, 1138, 1141, 1143, 1145, 1147, 1150, 1152, 1154, 1157, 1159, 1161, 1164, 1166, 1168, 1171, 1173, 1175, 1178, 1180, 1182, 1185, 1187, 1190, 1192, 1194, 1197, 1199, 1201, 1204, 1206, 1208, 1211, 1213, 1216, 1218, 1220, 1223, 1225, 1228, 1230, 1232, 1235, 1237, 1240, 1242, 1244, 1247, 1249, 1252, 1254, 1256, 1259, 1261, 1264, 1266, 1269, 1271, 1273, 1276, 1278, 1281, 1283, 1286, 1288, 1291, 1293, 1295, 1298, 1300, 1303, 1305, 1308, 1310, 1313, 1315, 1318, 1320, 1323, 1325, 1328, 1330, 1333, 1335, 1338, 1340, 1343, 1345, 1348, 1350, 1353, 1355, 1358, 1360, 1363, 1365, 1368, 1370, 1373, 1375, 1378, 1380, 1383, 1386, 1388, 1391, 1393, 1396, 1398, 1401, 1403, 1406, 1409, 1411, 1414, 1416, 1419, 1421, 1424, 1427, 1429, 1432, 1434, 1437, 1440, 1442, 1445, 1447, 1450, 1453, 1455, 1458, 1461, 1463, 1466, 1468, 1471, 1474, 1476, 1479, 1482, 1484, 1487, 1489, 1492, 1495, 1497, 1500, 1503, 1505, 1508, 1511, 1513, 1516, 1519, 1521, 1524, 1527, 1530, 1532, 1535, 1538, 1540, 1543, 1546, 1548, 1551, 1554, 1557, 1559, 1562, 1565, 1567, 1570, 1573, 1576, 1578, 1581, 1584, 1587, 1589, 1592, 1595, 1598, 1600, 1603, 1606, 1609, 1611, 1614, 1617, 1620, 1622, 1625, 1628, 1631, 1634, 1636, 1639, 1642, 1645, 1648, 1650, 1653, 1656, 1659, 1662, 1664, 1667, 1670, 1673, 1676, 1679, 1681, 1684, 1687, 1690, 1693, 1696, 1698, 1701, 1704, 1707, 1710, 1713, 1716, 1719, 1721, 1724, 1727, 1730, 1733, 1736, 1739, 1742, 1744, 1747, 1750, 1753, 1756, 1759, 1762, 1765, 1768, 1771, 1774, 1777, 1779, 1782, 1785, 1788, 1791, 1794, 1797, 1800, 1803, 1806, 1809, 1812, 1815, 1818, 1821, 1824, 1827, 1830, 1833, 1836, 1839, 1842, 1845, 1848, 1851, 1854, 1857, 1860, 1863, 1866, 1869, 1872, 1875, 1878, 1881, 1884, 1887, 1890, 1893, 1896, 1899, 1902, 1905, 1908, 1911, 1914, 1917, 1921, 1924, 1927, 1930, 1933, 1936, 1939, 1942, 1945, 1948, 1951, 1954, 1958, 1961, 1964, 1967, 1970, 1973, 1976, 1979, 1983, 1986, 1989, 1992, 1995, 1998, 2001, 2004, 2008, 2011, 2014, 2017, 2020, 2023, 2027, 2030, 2033, 2036, 2039, 2043, 2046, 2049, 2052, 2055, 2059, 2062, 2065, 2068, 2071, 2075, 2078, 2081, 2084, 2088, 2091, 2094, 2097, 2100, 2104, 2107, 2110, 2113, 2117, 2120, 2123, 2127, 2130, 2133, 2136, 2140, 2143, 2146, 2150, 2153, 2156, 2159, 2163, 2166, 2169, 2173, 2176, 2179, 2183, 2186, 2189, 2193, 2196, 2199, 2203, 2206, 2209, 2213, 2216, 2219, 2223, 2226, 2229, 2233, 2236, 2240, 2243, 2246, 2250, 2253, 2257, 2260, 2263, 2267, 2270, 2274, 2277, 2280, 2284, 2287, 2291, 2294, 2298, 2301, 2304, 2308, 2311, 2315, 2318, 2322, 2325, 2329, 2332, 2336, 2339, 2343, 2346, 2350, 2353, 2357, 2360, 2364, 2367, 2371, 2374, 2378, 2381, 2385, 2388, 2392, 2395, 2399, 2402, 2406, 2409, 2413, 2416, 2420, 2424, 2427, 2431, 2434, 2438, 2441, 2445, 2449, 2452, 2456, 2459, 2463, 2467, 2470, 2474, 2477, 2481, 2485, 2488, 2492, 2495, 2499, 2503, 2506, 2510, 2514, 2517, 2521, 2525, 2528, 2532, 2536, 2539, 2543, 2547, 2550, 2554, 2558, 2561, 2565, 2569, 2573, 2576, 2580, 2584, 2587, 2591, 2595, 2599, 2602, 2606, 2610, 2614, 2617, 2621, 2625, 2629, 2632, 2636, 2640, 2644, 2647, 2651, 2655, 2659, 2663, 2666, 2670, 2674, 2678, 2682, 2685, 2689, 2693, 2697, 2701, 2705, 2708, 2712, 2716, 2720, 2724, 2728, 2731, 2735, 2739, 2743, 2747, 2751, 2755, 2759, 2762, 2766, 2770, 2774, 2778, 2782, 2786, 2790, 2794, 2798, 2802, 2806, 2809, 2813, 2817, 2821, 2825, 2829, 2833, 2837, 2841, 2845, 2849, 2853, 2857, 2861, 2865, 2869, 2873, 2877, 2881, 2885, 2889, 2893, 2897, 2901, 2905, 2909, 2913, 2917, 2921, 2925, 2929, 2933, 2937, 2942, 2946, 2950, 2954, 2958, 2962, 2966, 2970, 2974, 2978, 2982, 2987, 2991, 2995, 2999, 3003, 3007, 3011, 3015, 3020, 3024, 3028, 3032, 3036, 3040, 3044, 3049, 3053, 3057, 3061, 3065, 3070, 3074, 3078, 3082, 3086, 3091, 3095, 3099, 3103, 3107, 3112, 3116, 3120, 3124, 3129, 3133, 3137, 3141, 3146, 3150, 3154, 3158, 3163, 3167, 3171, 3176, 3180, 3184, 3189, 3193, 3197, 3201, 3206, 3210, 3214, 3219, 3223, 3227, 3232, 3236, 3241, 3245, 3249, 3254, 3258, 3262, 3267, 3271, 3276, 3280, 3284, 3289, 3293, 3298, 3302, 3306, 3311, 3315, 3320, 3324, 3329, 3333, 3337, 3342, 3346, 3351, 3355, 3360, 3364, 3369, 3373, 3378, 3382, 3387, 3391, 3396, 3400, 3405, 3409, 3414, 3418, 3423, 3427, 3432, 3437, 3441, 3446, 3450, 3455, 3459, 3464, 3468, 3473, 3478, 3482, 3487, 3491, 3496, 3501, 3505, 3510, 3515, 3519, 3524, 3528, 3533, 3538, 3542, 3547, 3552, 3556, 3561, 3566, 3570, 3575, 3580, 3584, 3589, 3594, 3599, 3603, 3608, 3613, 3617, 3622, 3627, 3632, 3636, 3641, 3646, 3651, 3655, 3660, 3665, 3670, 3674, 3679, 3684, 3689, 3694, 3698, 3703, 3708, 3713, 3718, 3723, 3727, 3732, 3737, 3742, 3747, 3752, 3756, 3761, 3766, 3771, 3776, 3781, 3786, 3791, 3796, 3800, 3805, 3810, 3815, 3820, 3825, 3830, 3835, 3840, 3845, 3850, 3855, 3860, 3865, 3870, 3875, 3880, 3885, 3890, 3895, 3900, 3905, 3910, 3915, 3920, 3925, 3930, 3935, 3940, 3945, 3950, 3955, 3960, 3965, 3970, 3975, 3980, 3985, 3990, 3995, 4001, 4006, 4011, 4016, 4021, 4026, 4031, 4036, 4042, 4047, 4052, 4057, 4062, 4067, 4072, 4078, 4083, 4088, 4093, 4098, 4104, 4109, 4114, 4119, 4124, 4130, 4135, 4140, 4145, 4151, 4156, 4161, 4166, 4172, 4177, 4182, 4187, 4193, 4198, 4203, 4209, 4214, 4219, 4225, 4230, 4235, 4241, 4246, 4251, 4257, 4262, 4267, 4273, 4278, 4283, 4289, 4294, 4300, 4305, 4310, 4316, 4321, 4327, 4332, 4337, 4343, 4348, 4354, 4359, 4365, 4370, 4376, 4381, 4387, 4392, 4398, 4403, 4409, 4414, 4420, 4425, 4431, 4436, 4442, 4447, 4453, 4458, 4464, 4469, 4475, 4480, 4486, 4492, 4497, 4503, 4508, 4514, 4520, 4525, 4531, 4536, 4542, 4548, 4553, 4559, 4565, 4570, 4576, 4582, 4587, 4593, 4599, 4604, 4610, 4616, 4621, 4627, 4633, 4639, 4644, 4650, 4656, 4662, 4667, 4673, 4679, 4685, 4690, 4696, 4702, 4708, 4713, 4719, 4725, 4731, 4737, 4743, 4748, 4754, 4760, 4766, 4772, 4778, 4783, 4789, 4795, 4801, 4807, 4813, 4819, 4825, 4831, 4836, 4842, 4848, 4854, 4860, 4866, 4872, 4878, 4884, 4890, 4896, 4902, 4908, 4914, 4920, 4926, 4932, 4938, 4944, 4950, 4956, 4962, 4968, 4974, 4980, 4986, 4992, 4998, 5004, 5011, 5017, 5023, 5029, 5035, 5041, 5047, 5053, 5059, 5066, 5072, 5078, 5084, 5090, 5096, 5103, 5109, 5115, 5121, 5127, 5133, 5140, 5146, 5152, 5158, 5165, 5171, 5177, 5183, 5190, 5196, 5202, 5208, 5215, 5221, 5227, 5234, 5240, 5246, 5253, 5259, 5265, 5272, 5278, 5284, 5291, 5297, 5303, 5310, 5316, 5322, 5329, 5335, 5342, 5348, 5355, 5361, 5367, 5374, 5380, 5387, 5393, 5400, 5406, 5413, 5419, 5426, 5432, 5439, 5445, 5452, 5458, 5465, 5471, 5478, 5484, 5491, 5497, 5504, 5510, 5517, 5524, 5530, 5537, 5543, 5550, 5557, 5563, 5570, 5577, 5583, 5590, 5597, 5603, 5610, 5617, 5623, 5630, 5637, 5643, 5650, 5657, 5663, 5670, 5677, 5684, 5690, 5697, 5704, 5711, 5717, 5724, 5731, 5738, 5745, 5751, 5758, 5765, 5772, 5779, 5786, 5792, 5799, 5806, 5813, 5820, 5827, 5834, 5841, 5847, 5854, 5861, 5868, 5875, 5882, 5889, 5896, 5903, 5910, 5917, 5924, 5931, 5938, 5945, 5952, 5959, 5966, 5973, 5980, 5987, 5994, 6001, 6008, 6015, 6022, 6029, 6036, 6043, 6051, 6058, 6065, 6072, 6079, 6086, 6093, 6100, 6108, 6115, 6122, 6129, 6136, 6143, 6151, 6158, 6165, 6172, 6180, 6187, 6194, 6201, 6209, 6216, 6223, 6230, 6238, 6245, 6252, 6259, 6267, 6274, 6281, 6289, 6296, 6303, 6311, 6318, 6326, 6333, 6340, 6348, 6355, 6362, 6370, 6377, 6385, 6392, 6400, 6407, 6415, 6422, 6429, 6437, 6444, 6452, 6459, 6467, 6474, 6482, 6489, 6497, 6505, 6512, 6520, 6527, 6535, 6542, 6550, 6558, 6565, 6573, 6580, 6588, 6596, 6603, 6611, 6619, 6626, 6634, 6642, 6649, 6657, 6665, 6672, 6680, 6688, 6696, 6703, 6711, 6719, 6727, 6734, 6742, 6750, 6758, 6765, 6773, 6781, 6789, 6797, 6805, 6812, 6820, 6828, 6836, 6844, 6852, 6860, 6868, 6875, 6883, 6891, 6899, 6907, 6915, 6923, 6931, 6939, 6947, 6955, 6963, 6971, 6979, 6987, 6995, 7003, 7011, 7019, 7027, 7035, 7043, 7051, 7059, 7067, 7076, 7084, 7092, 7100, 7108, 7116, 7124, 7132, 7141, 7149, 7157, 7165, 7173, 7182, 7190, 7198, 7206, 7214, 7223, 7231, 7239, 7248, 7256, 7264, 7272, 7281, 7289, 7297, 7306, 7314, 7322, 7331, 7339, 7347, 7356, 7364, 7373, 7381, 7389, 7398, 7406, 7415, 7423, 7431, 7440, 7448, 7457, 7465, 7474, 7482, 7491, 7499, 7508, 7516, 7525, 7533, 7542, 7551, 7559, 7568, 7576, 7585, 7594, 7602, 7611, 7619, 7628, 7637, 7645, 7654, 7663, 7671, 7680, 7689, 7697, 7706, 7715, 7724, 7732, 7741, 7750, 7759, 7767, 7776, 7785, 7794, 7803, 7811, 7820, 7829, 7838, 7847, 7856, 7865, 7873, 7882, 7891, 7900, 7909, 7918, 7927, 7936, 7945, 7954, 7963, 7972, 7981, 7990, 7999, 8008, 8017, 8026, 8035, 8044, 8053, 8062, 8071, 8080, 8089, 8098, 8107, 8116, 8126, 8135, 8144, 8153, 8162, 8171, 8181, 8190, 8199, 8208, 8217, 8227, 8236, 8245, 8254, 8264, 8273, 8282, 8291, 8301, 8310, 8319, 8329, 8338, 8347, 8357, 8366, 8375, 8385, 8394, 8404, 8413, 8422, 8432, 8441, 8451, 8460, 8470, 8479, 8489, 8498, 8508, 8517, 8527, 8536, 8546, 8555, 8565, 8574, 8584, 8593, 8603, 8613, 8622, 8632, 8641, 8651, 8661, 8670, 8680, 8690, 8699, 8709, 8719, 8729, 8738, 8748, 8758, 8768, 8777, 8787, 8797, 8807, 8816, 8826, 8836, 8846, 8856, 8866, 8875, 8885, 8895, 8905, 8915, 8925, 8935, 8945, 8955, 8965, 8975, 8984, 8994, 9004, 9014, 9024, 9034, 9044, 9054, 9065, 9075, 9085, 9095, 9105, 9115, 9125, 9135, 9145, 9155, 9165, 9176, 9186, 9196, 9206, 9216, 9227, 9237, 9247, 9257, 9267, 9278, 9288, 9298, 9308, 9319, 9329, 9339, 9350, 9360, 9370, 9381, 9391, 9401, 9412, 9422, 9433, 9443, 9453, 9464, 9474, 9485, 9495, 9506, 9516, 9527, 9537, 9548, 9558, 9569, 9579, 9590, 9600, 9611, 9622, 9632, 9643, 9653, 9664, 9675, 9685, 9696, 9707, 9717, 9728, 9739, 9749, 9760, 9771, 9782, 9792, 9803, 9814, 9825, 9835, 9846, 9857, 9868, 9879, 9890, 9900, 9911, 9922, 9933, 9944, 9955, 9966, 9977, 9988, 9999, 10010, 10021, 10032, 10043, 10054, 10065, 10076, 10087, 10098, 10109, 10120, 10131, 10142, 10153, 10164, 10175, 10187, 10198, 10209, 10220, 10231, 10242, 10254, 10265, 10276, 10287, 10299, 10310, 10321, 10332, 10344, 10355, 10366, 10378, 10389, 10400, 10412, 10423, 10434, 10446, 10457, 10469, 10480, 10491, 10503, 10514, 10526, 10537, 10549, 10560, 10572, 10583, 10595, 10606, 10618, 10629, 10641, 10653, 10664, 10676, 10687, 10699, 10711, 10722, 10734, 10746, 10757, 10769, 10781, 10793, 10804, 10816, 10828, 10840, 10851, 10863, 10875, 10887, 10899, 10911, 10922, 10934, 10946, 10958, 10970, 10982, 10994, 11006, 11018, 11030, 11042, 11054, 11066, 11078, 11090, 11102, 11114, 11126, 11138, 11150, 11162, 11174, 11186, 11198, 11210, 11223, 11235, 11247, 11259, 11271, 11283, 11296, 11308, 11320, 11332, 11345, 11357, 11369, 11382, 11394, 11406, 11419, 11431, 11443, 11456, 11468, 11480, 11493, 11505, 11518, 11530, 11543, 11555, 11568, 11580, 11593, 11605, 11618, 11630, 11643, 11655, 11668, 11681, 11693, 11706, 11718, 11731, 11744, 11756, 11769, 11782, 11794, 11807, 11820, 11833, 11845, 11858, 11871, 11884, 11897, 11909, 11922, 11935, 11948, 11961, 11974, 11987, 11999, 12012, 12025, 12038, 12051, 12064, 12077, 12090, 12103, 12116, 12129, 12142, 12155, 12168, 12181, 12195, 12208, 12221, 12234, 12247, 12260, 12273, 12287, 12300, 12313, 12326, 12339, 12353, 12366, 12379, 12393, 12406, 12419, 12432, 12446, 12459, 12473, 12486, 12499, 12513, 12526, 12540, 12553, 12566, 12580, 12593, 12607, 12620, 12634, 12648, 12661, 12675, 12688, 12702, 12715, 12729, 12743, 12756, 12770, 12784, 12797, 12811, 12825, 12838, 12852, 12866, 12880, 12893, 12907, 12921, 12935, 12949, 12963, 12976, 12990, 13004, 13018, 13032, 13046, 13060, 13074, 13088, 13102, 13116, 13130, 13144, 13158, 13172, 13186, 13200, 13214, 13228, 13242, 13257, 13271, 13285, 13299, 13313, 13327, 13342, 13356, 13370, 13384, 13399, 13413, 13427, 13442, 13456, 13470, 13485, 13499, 13513, 13528, 13542, 13557, 13571, 13585, 13600, 13614, 13629, 13643, 13658, 13672, 13687, 13702, 13716, 13731, 13745, 13760, 13775, 13789, 13804, 13819, 13833, 13848, 13863, 13877, 13892, 13907, 13922, 13937, 13951, 13966, 13981, 13996, 14011, 14026, 14041, 14056, 14070, 14085, 14100, 14115, 14130, 14145, 14160, 14175, 14190, 14205, 14221, 14236, 14251, 14266, 14281, 14296, 14311, 14326, 14342, 14357, 14372, 14387, 14403, 14418, 14433, 14448, 14464, 14479, 14494, 14510, 14525, 14540, 14556, 14571, 14587, 14602, 14618, 14633, 14649, 14664, 14680, 14695, 14711, 14726, 14742, 14757, 14773, 14789, 14804, 14820, 14836, 14851, 14867, 14883, 14899, 14914, 14930, 14946, 14962, 14977, 14993, 15009, 15025, 15041, 15057, 15073, 15089, 15105, 15121, 15136, 15152, 15168, 15184, 15201, 15217, 15233, 15249, 15265, 15281, 15297, 15313, 15329, 15345, 15362, 15378, 15394, 15410, 15427, 15443, 15459, 15475, 15492, 15508, 15524, 15541, 15557, 15574, 15590, 15606, 15623, 15639, 15656, 15672, 15689, 15705, 15722, 15738, 15755, 15772, 15788, 15805, 15821, 15838, 15855, 15871, 15888, 15905, 15922, 15938, 15955, 15972, 15989, 16006, 16022, 16039, 16056, 16073, 16090, 16107, 16124, 16141, 16158, 16175, 16192, 16209, 16226, 16243, 16260, 16277, 16294, 16311, 16328, 16345, 16362, 16380, 16397, 16414, 16431, 16449, 16466, 16483, 16500, 16518, 16535, 16552, 16570, 16587, 16605, 16622, 16639, 16657, 16674, 16692, 16709, 16727, 16744, 16762, 16780, 16797, 16815, 16832, 16850, 16868, 16885, 16903, 16921, 16938, 16956, 16974, 16992, 17010, 17027, 17045, 17063, 17081, 17099, 17117, 17135, 17153, 17170, 17188, 17206, 17224, 17242, 17261, 17279, 17297, 17315, 17333, 17351, 17369, 17387, 17405, 17424, 17442, 17460, 17478, 17497, 17515, 17533, 17552, 17570, 17588, 17607, 17625, 17643, 17662, 17680, 17699, 17717, 17736, 17754, 17773, 17791, 17810, 17829, 17847, 17866, 17885, 17903, 17922, 17941, 17959, 17978, 17997, 18016, 18034, 18053, 18072, 18091, 18110, 18129, 18148, 18166, 18185, 18204, 18223, 18242, 18261, 18280, 18299, 18319, 18338, 18357, 18376, 18395, 18414, 18433, 18453, 18472, 18491, 18510, 18530, 18549, 18568, 18588, 18607, 18626, 18646, 18665, 18685, 18704, 18723, 18743, 18762, 18782, 18802, 18821, 18841, 18860, 18880, 18900, 18919, 18939, 18959, 18978, 18998, 19018, 19038, 19057, 19077, 19097, 19117, 19137, 19157, 19177, 19196, 19216, 19236, 19256, 19276, 19296, 19316, 19337, 19357, 19377, 19397, 19417, 19437, 19457, 19478, 19498, 19518, 19538, 19559, 19579, 19599, 19620, 19640, 19660, 19681, 19701, 19722, 19742, 19763, 19783, 19804, 19824, 19845, 19865, 19886, 19906, 19927, 19948, 19968, 19989, 20010, 20031, 20051, 20072, 20093, 20114, 20135, 20156, 20176, 20197, 20218, 20239, 20260, 20281, 20302, 20323, 20344, 20365, 20386, 20408, 20429, 20450, 20471, 20492, 20513, 20535, 20556, 20577, 20599, 20620, 20641, 20663, 20684, 20705, 20727, 20748, 20770, 20791, 20813, 20834, 20856, 20877, 20899, 20921, 20942, 20964, 20985, 21007, 21029, 21051, 21072, 21094, 21116, 21138, 21160, 21182, 21203, 21225, 21247, 21269, 21291, 21313, 21335, 21357, 21379, 21401, 21424, 21446, 21468, 21490, 21512, 21534, 21557, 21579, 21601, 21623, 21646, 21668, 21690, 21713, 21735, 21758, 21780, 21803, 21825, 21848, 21870, 21893, 21915, 21938, 21961, 21983, 22006, 22029, 22051, 22074, 22097, 22120, 22142, 22165, 22188, 22211, 22234, 22257, 22280, 22303, 22326, 22349, 22372, 22395, 22418, 22441, 22464, 22487, 22510, 22534, 22557, 22580, 22603, 22627, 22650, 22673, 22696, 22720, 22743, 22767, 22790, 22814, 22837, 22861, 22884, 22908, 22931, 22955, 22978, 23002, 23026, 23049, 23073, 23097, 23121, 23144, 23168, 23192, 23216, 23240, 23264, 23288, 23312, 23336, 23360, 23384, 23408, 23432, 23456, 23480, 23504, 23528, 23552, 23577, 23601, 23625, 23649, 23674, 23698, 23722, 23747, 23771, 23796, 23820, 23844, 23869, 23893, 23918, 23943, 23967, 23992, 24016, 24041, 24066, 24090, 24115, 24140, 24165, 24190, 24214, 24239, 24264, 24289, 24314, 24339, 24364, 24389, 24414, 24439, 24464, 24489, 24514, 24539, 24564, 24590, 24615, 24640, 24665, 24691, 24716, 24741, 24767, 24792, 24818, 24843, 24868, 24894, 24919, 24945, 24971, 24996, 25022, 25047, 25073, 25099, 25125, 25150, 25176, 25202, 25228, 25253, 25279, 25305, 25331, 25357, 25383, 25409, 25435, 25461, 25487, 25513, 25539, 25566, 25592, 25618, 25644, 25670, 25697, 25723, 25749, 25776, 25802, 25828, 25855, 25881, 25908, 25934, 25961, 25987, 26014, 26041, 26067, 26094, 26121, 26147, 26174, 26201, 26228, 26254, 26281, 26308, 26335, 26362, 26389, 26416, 26443, 26470, 26497, 26524, 26551, 26578, 26606, 26633, 26660, 26687, 26714, 26742, 26769, 26796, 26824, 26851, 26879, 26906, 26934, 26961, 26989, 27016, 27044, 27071, 27099, 27127, 27154, 27182, 27210, 27238, 27265, 27293, 27321, 27349, 27377, 27405, 27433, 27461, 27489, 27517, 27545, 27573, 27601, 27629, 27658, 27686, 27714, 27742, 27771, 27799, 27827, 27856, 27884, 27913, 27941, 27970, 27998, 28027, 28055, 28084, 28112, 28141, 28170, 28199, 28227, 28256, 28285, 28314, 28343, 28371, 28400, 28429, 28458, 28487, 28516, 28545, 28574, 28604, 28633, 28662, 28691, 28720, 28750, 28779, 28808, 28837, 28867, 28896, 28926, 28955, 28985, 29014, 29044, 29073, 29103, 29132, 29162, 29192, 29222, 29251, 29281, 29311, 29341, 29371, 29400, 29430, 29460, 29490, 29520, 29550, 29580, 29611, 29641, 29671, 29701, 29731, 29761, 29792, 29822, 29852, 29883, 29913, 29944, 29974, 30004, 30035, 30065, 30096, 30127, 30157, 30188, 30219, 30249, 30280, 30311, 30342, 30373, 30403, 30434, 30465, 30496, 30527, 30558, 30589, 30620, 30651, 30683, 30714, 30745, 30776, 30807, 30839, 30870, 30901, 30933, 30964, 30996, 31027, 31059, 31090, 31122, 31153, 31185, 31217, 31248, 31280, 31312, 31344, 31376, 31407, 31439, 31471, 31503, 31535, 31567, 31599, 31631, 31663, 31695, 31728, 31760, 31792, 31824, 31857, 31889, 31921, 31954, 31986, 32018, 32051, 32083, 32116, 32149, 32181, 32214, 32246, 32279, 32312, 32345, 32377, 32410, 32443, 32476, 32509, 32542, 32575, 32608, 32641, 32674, 32707, 32740, 32774, 32807, 32840, 32873, 32907, 32940, 32973, 33007, 33040, 33074, 33107, 33141, 33174, 33208, 33242, 33275, 33309, 33343, 33376, 33410, 33444, 33478, 33512, 33546, 33580, 33614, 33648, 33682, 33716, 33750, 33784, 33818, 33853, 33887, 33921, 33956, 33990, 34024, 34059, 34093, 34128, 34162, 34197, 34232, 34266, 34301, 34336, 34370, 34405, 34440, 34475, 34510, 34545, 34579, 34614, 34649, 34685, 34720, 34755, 34790, 34825, 34860, 34896, 34931, 34966, 35002, 35037, 35072, 35108, 35143, 35179, 35214, 35250, 35286, 35321, 35357, 35393, 35429, 35464, 35500, 35536, 35572, 35608, 35644, 35680, 35716, 35752, 35788, 35824, 35861, 35897, 35933, 35969, 36006, 36042, 36078, 36115, 36151, 36188, 36224, 36261, 36298, 36334, 36371, 36408, 36445, 36481, 36518, 36555, 36592, 36629, 36666, 36703, 36740, 36777, 36814, 36851, 36889, 36926, 36963, 37000, 37038, 37075, 37113, 37150, 37187, 37225, 37263, 37300, 37338, 37375, 37413, 37451, 37489, 37527, 37564, 37602, 37640, 37678, 37716, 37754, 37792, 37830, 37869, 37907, 37945, 37983, 38022, 38060, 38098, 38137, 38175, 38214, 38252, 38291, 38329, 38368, 38407, 38445, 38484, 38523, 38562, 38601, 38640, 38679, 38718, 38757, 38796, 38835, 38874, 38913, 38952, 38992, 39031, 39070, 39110, 39149, 39188, 39228, 39267, 39307, 39347, 39386, 39426, 39466, 39505, 39545, 39585, 39625, 39665, 39705, 39745, 39785, 39825, 39865, 39905, 39945, 39985, 40026, 40066, 40106, 40147, 40187, 40228, 40268, 40309, 40349, 40390, 40430, 40471, 40512, 40553, 40594, 40634, 40675, 40716, 40757, 40798, 40839, 40880, 40921, 40963, 41004, 41045, 41086, 41128, 41169, 41211, 41252, 41294, 41335, 41377, 41418, 41460, 41502, 41543, 41585, 41627, 41669, 41711, 41753, 41795, 41837, 41879, 41921, 41963, 42005, 42048, 42090, 42132, 42174, 42217, 42259, 42302, 42344, 42387, 42429, 42472, 42515, 42558, 42600, 42643, 42686, 42729, 42772, 42815, 42858, 42901, 42944, 42987, 43030, 43074, 43117, 43160, 43204, 43247, 43290, 43334, 43377, 43421, 43465, 43508, 43552, 43596, 43640, 43683, 43727, 43771, 43815, 43859, 43903, 43947, 43991, 44036, 44080, 44124, 44168, 44213, 44257, 44302, 44346, 44391, 44435, 44480, 44524, 44569, 44614, 44659, 44703, 44748, 44793, 44838, 44883, 44928, 44973, 45019, 45064, 45109, 45154, 45199, 45245, 45290, 45336, 45381, 45427, 45472, 45518, 45564, 45609, 45655, 45701, 45747, 45793, 45839, 45885, 45931, 45977, 46023, 46069, 46115, 46161, 46208, 46254, 46300, 46347, 46393, 46440, 46486, 46533, 46580, 46626, 46673, 46720, 46767, 46814, 46861, 46908, 46955, 47002, 47049, 47096, 47143, 47190, 47238, 47285, 47332, 47380, 47427, 47475, 47522, 47570, 47618, 47665, 47713, 47761, 47809, 47857, 47905, 47953, 48001, 48049, 48097, 48145, 48193, 48242, 48290, 48338, 48387, 48435, 48484, 48532, 48581, 48630, 48678, 48727, 48776, 48825, 48874, 48923, 48972, 49021, 49070, 49119, 49168, 49217, 49267, 49316, 49365, 49415, 49464, 49514, 49563, 49613, 49663, 49712, 49762, 49812, 49862, 49912, 49962, 50012, 50062, 50112, 50162, 50212, 50262, 50313, 50363, 50414, 50464, 50515, 50565, 50616, 50666, 50717, 50768, 50819, 50869, 50920, 50971, 51022, 51073, 51124, 51176, 51227, 51278, 51329, 51381, 51432, 51483, 51535, 51586, 51638, 51690, 51741, 51793, 51845, 51897, 51949, 52001, 52053, 52105, 52157, 52209, 52261, 52313, 52366, 52418, 52471, 52523, 52575, 52628, 52681, 52733, 52786, 52839, 52892, 52945, 52997, 53050, 53103, 53157, 53210, 53263, 53316, 53369, 53423, 53476, 53530, 53583, 53637, 53690, 53744, 53798, 53851, 53905, 53959, 54013, 54067, 54121, 54175, 54229, 54283, 54337, 54392, 54446, 54501, 54555, 54609, 54664, 54719, 54773, 54828, 54883, 54938, 54992, 55047, 55102, 55157, 55212, 55268, 55323, 55378, 55433, 55489, 55544, 55600, 55655, 55711, 55766, 55822, 55878, 55933, 55989, 56045, 56101, 56157, 56213, 56269, 56326, 56382, 56438, 56494, 56551, 56607, 56664, 56720, 56777, 56834, 56890, 56947, 57004, 57061, 57118, 57175, 57232, 57289, 57346, 57403, 57461, 57518, 57575, 57633, 57690, 57748, 57805, 57863, 57921, 57979, 58036, 58094, 58152, 58210, 58268, 58327, 58385, 58443, 58501, 58560, 58618, 58676, 58735, 58794, 58852, 58911, 58970, 59028, 59087, 59146, 59205, 59264, 59323, 59383, 59442, 59501, 59560, 59620, 59679, 59739, 59798, 59858, 59918, 59977, 60037, 60097, 60157, 60217, 60277, 60337, 60397, 60457, 60518, 60578, 60638, 60699, 60759, 60820, 60880, 60941, 61002, 61063, 61123, 61184, 61245, 61306, 61367, 61429, 61490, 61551, 61612, 61674, 61735, 61797, 61858, 61920, 61982, 62043, 62105, 62167, 62229, 62291, 62353, 62415, 62477, 62540, 62602, 62664, 62727, 62789, 62852, 62914, 62977, 63040, 63103, 63165, 63228, 63291, 63354, 63417, 63481, 63544, 63607, 63670, 63734, 63797, 63861, 63924, 63988, 64052, 64116, 64179, 64243, 64307, 64371, 64435, 64500, 64564, 64628, 64692, 64757, 64821, 64886, 64950, 65015, 65080, 65144, 65209, 65274, 65339, 65404, 65469, 65535,};
-	static constexpr int32_t logSlope[4097] = {0, 240, 477, 710, 940, 1167, 1390, 1611, 1828, 2042, 2254, 2463, 2669, 2872, 3073, 3271, 3466, 3660, 3851, 4039, 4226, 4410, 4592, 4772, 4950, 5126, 5300, 5473, 5643, 5811, 5978, 6143, 6306, 6468, 6628, 6786, 6943, 7098, 7252, 7404, 7555, 7704, 7852, 7999, 8144, 8288, 8431, 8572, 8712, 8851, 8988, 9125, 9260, 9394, 9527, 9659, 9790, 9919, 10048, 10176, 10302, 10428, 10552, 10676, 10798, 10920, 11041, 11161, 11280, 11398, 11515, 11631, 11746, 11861, 11975, 12088, 12200, 12311, 12422, 12532, 12641, 12749, 12856, 12963, 13069, 13175, 13279, 13383, 13487, 13589, 13691, 13793, 13893, 13993, 14093, 14192, 14290, 14387, 14484, 14581, 14677, 14772, 14866, 14960, 15054, 15147, 15239, 15331, 15423, 15513, 15604, 15693, 15783, 15871, 15960, 16047, 16135, 16222, 16308, 16394, 16479, 16564, 16649, 16733, 16816, 16899, 16982, 17064, 17146, 17228, 17309, 17389, 17469, 17549, 17629, 17708, 17786, 17864, 17942, 18020, 18097, 18173, 18250, 18326, 18401, 18476, 18551, 18626, 18700, 18774, 18847, 18920, 18993, 19065, 19138, 19209, 19281, 19352, 19423, 19493, 19563, 19633, 19703, 19772, 19841, 19910, 19978, 20046, 20114, 20181, 20249, 20316, 20382, 20449, 20515, 20580, 20646, 20711, 20776, 20841, 20905, 20969, 21033, 21097, 21160, 21224, 21287, 21349, 21412, 21474, 21536, 21597, 21659, 21720, 21781, 21842, 21902, 21962, 22022, 22082, 22142, 22201, 22260, 22319, 22378, 22436, 22495, 22553, 22610, 22668, 22725, 22783, 22840, 22896, 22953, 23009, 23066, 23121, 23177, 23233, 23288, 23343, 23398, 23453, 23508, 23562, 23617, 23671, 23724, 23778, 23832, 23885, 23938, 23991, 24044, 24096, 24149, 24201, 24253, 24305, 24357, 24408, 24460, 24511, 24562, 24613, 24664, 24714, 24765, 24815, 24865, 24915, 24965, 25015, 25064, 25113, 25163, 25212, 25260, 25309, 25358, 25406, 25454, 25502, 25550, 25598, 25646, 25693, 25741, 25788, 25835, 25882, 25929, 25976, 26022, 26069, 26115, 26161, 26207, 26253, 26299, 26344, 26390, 26435, 26480, 26525, 26570, 26615, 26660, 26704, 26749, 26793, 26837, 26882, 26925, 26969, 27013, 27057, 27100, 27143, 27187, 27230, 27273, 27316, 27358, 27401, 27444, 27486, 27528, 27570, 27613, 27655, 27696, 27738, 27780, 27821, 27863, 27904, 27945, 27986, 28027, 28068, 28109, 28150, 28190, 28231, 28271, 28311, 28351, 28391, 28431, 28471, 28511, 28551, 28590, 28629, 28669, 28708, 28747, 28786, 28825, 28864, 28903, 28942, 28980, 29019, 29057, 29095, 29133, 29172, 29210, 29247, 29285, 29323, 29361, 29398, 29436, 29473, 29510, 29548, 29585, 29622, 29659, 29696, 29732, 29769, 29806, 29842, 29879, 29915, 29951, 29987, 30024, 30060, 30095, 30131, 30167, 30203, 30238, 30274, 30309, 30345, 30380, 30415, 30450, 30485, 30520, 30555, 30590, 30625, 30660, 30694, 30729, 30763, 30797, 30832, 30866, 30900, 30934, 30968, 31002, 31036, 31070, 31103, 31137, 31171, 31204, 31238, 31271, 31304, 31337, 31371, 31404, 31437, 31470, 31502, 31535, 31568, 31601, 31633, 31666, 31698, 31731, 31763, 31795, 31827, 31859, 31891, 31923, 31955, 31987, 32019, 32051, 32082, 32114, 32146, 32177, 32209, 32240, 32271, 32302, 32334, 32365, 32396, 32427, 32458, 32489, 32519, 32550, 32581, 32611, 32642, 32672, 32703, 32733, 32764, 32794, 32824, 32854, 32884, 32914, 32944, 32974, 33004, 33034, 33064, 33093, 33123, 33153, 33182, 33212, 33241, 33271, 33300, 33329, 33358, 33387, 33417, 33446, 33475, 33504, 33532, 33561, 33590, 33619, 33647, 33676, 33705, 33733, 33762, 33790, 33818, 33847, 33875, 33903, 33931, 33959, 33988, 34016, 34044, 34071, 34099, 34127, 34155, 34183, 34210, 34238, 34265, 34293, 34320, 34348, 34375, 34403, 34430, 34457, 34484, 34511, 34539, 34566, 34593, 34620, 34646, 34673, 34700, 34727, 34754, 34780, 34807, 34834, 34860, 34887, 34913, 34940, 34966, 34992, 35019, 35045, 35071, 35097, 35123, 35149, 35175, 35201, 35227, 35253, 35279, 35305, 35331, 35356, 35382, 35408, 35433, 35459, 35484, 35510, 35535, 35561, 35586, 35611, 35637, 35662, 35687, 35712, 35737, 35762, 35787, 35812, 35837, 35862, 35887, 35912, 35937, 35961, 35986, 36011, 36035, 36060, 36085, 36109, 36134, 36158, 36183, 36207, 36231, 36256, 36280, 36304, 36328, 36352, 36376, 36401, 36425, 36449, 36473, 36496, 36520, 36544, 36568, 36592, 36616, 36639, 36663, 36687, 36710, 36734, 36757, 36781, 36804, 36828, 36851, 36874, 36898, 36921, 36944, 36968, 36991, 37014, 37037, 37060, 37083, 37106, 37129, 37152, 37175, 37198, 37221, 37244, 37266, 37289, 37312, 37335, 37357, 37380, 37402, 37425, 37448, 37470, 37493, 37515, 37537, 37560, 37582, 37604, 37627, 37649, 37671, 37693, 37715, 37738, 37760, 37782, 37804, 37826, 37848, 37870, 37891, 37913, 37935, 37957, 37979, 38001, 38022, 38044, 38066, 38087, 38109, 38130, 38152, 38173, 38195, 38216, 38238, 38259, 38281, 38302, 38323, 38344, 38366, 38387, 38408, 38429, 38450, 38472, 38493, 38514, 38535, 38556, 38577, 38598, 38619, 38639, 38660, 38681, 38702, 38723, 38743, 38764, 38785, 38805, 38826, 38847, 38867, 38888, 38908, 38929, 38949, 38970, 38990, 39011, 39031, 39051, 39072, 39092, 39112, 39133, 39153, 39173, 39193, 39213, 39233, 39253, 39273, 39294, 39314, 39334, 39353, 39373, 39393, 39413, 39433, 39453, 39473, 39492, 39512, 39532, 39552, 39571, 39591, 39611, 39630, 39650, 39669, 39689, 39708, 39728, 39747, 39767, 39786, 39806, 39825, 39844, 39864, 39883, 39902, 39922, 39941, 39960, 39979, 39998, 40017, 40037, 40056, 40075, 40094, 40113, 40132, 40151, 40170, 40189, 40208, 40226, 40245, 40264, 40283, 40302, 40320, 40339, 40358, 40377, 40395, 40414, 40433, 40451, 40470, 40488, 40507, 40525, 40544, 40562, 40581, 40599, 40618, 40636, 40655, 40673, 40691, 40710, 40728, 40746, 40764, 40783, 40801, 40819, 40837, 40855, 40873, 40892, 40910, 40928, 40946, 40964, 40982, 41000, 41018, 41036, 41054, 41071, 41089, 41107, 41125, 41143, 41161, 41178, 41196, 41214, 41232, 41249, 41267, 41285, 41302, 41320, 41337, 41355, 41373, 41390, 41408, 41425, 41443, 41460, 41478, 41495, 41512, 41530, 41547, 41564, 41582, 41599, 41616, 41634, 41651, 41668, 41685, 41703, 41720, 41737, 41754, 41771, 41788, 41805, 41822, 41839, 41856, 41873, 41890, 41907, 41924, 41941, 41958, 41975, 41992, 42009, 42026, 42042, 42059, 42076, 42093, 42110, 42126, 42143, 42160, 42176, 42193, 42210, 42226, 42243, 42260, 42276, 42293, 42309, 42326, 42342, 42359, 42375, 42392, 42408, 42425, 42441, 42457, 42474, 42490, 42506, 42523, 42539, 42555, 42572, 42588, 42604, 42620, 42637, 42653, 42669, 42685, 42701, 42717, 42733, 42750, 42766, 42782, 42798, 42814, 42830, 42846, 42862, 42878, 42894, 42909, 42925, 42941, 42957, 42973, 42989, 43005, 43021, 43036, 43052, 43068, 43084, 43099, 43115, 43131, 43146, 43162, 43178, 43193, 43209, 43225, 43240, 43256, 43271, 43287, 43302, 43318, 43333, 43349, 43364, 43380, 43395, 43411, 43426, 43442, 43457, 43472, 43488, 43503, 43518, 43534, 43549, 43564, 43579, 43595, 43610, 43625, 43640, 43656, 43671, 43686, 43701, 43716, 43731, 43746, 43761, 43777, 43792, 43807, 43822, 43837, 43852, 43867, 43882, 43897, 43912, 43926, 43941, 43956, 43971, 43986, 44001, 44016, 44031, 44045, 44060, 44075, 44090, 44105, 44119, 44134, 44149, 44163, 44178, 44193, 44207, 44222, 44237, 44251, 44266, 44281, 44295, 44310, 44324, 44339, 44353, 44368, 44382, 44397, 44411, 44426, 44440, 44455, 44469, 44484, 44498, 44512, 44527, 44541, 44555, 44570, 44584, 44598, 44613, 44627, 44641, 44655, 44670, 44684, 44698, 44712, 44727, 44741, 44755, 44769, 44783, 44797, 44811, 44825, 44840, 44854, 44868, 44882, 44896, 44910, 44924, 44938, 44952, 44966, 44980, 44994, 45008, 45022, 45036, 45049, 45063, 45077, 45091, 45105, 45119, 45133, 45146, 45160, 45174, 45188, 45202, 45215, 45229, 45243, 45256, 45270, 45284, 45298, 45311, 45325, 45339, 45352, 45366, 45379, 45393, 45407, 45420, 45434, 45447, 45461, 45474, 45488, 45501, 45515, 45528, 45542, 45555, 45569, 45582, 45596, 45609, 45622, 45636, 45649, 45663, 45676, 45689, 45703, 45716, 45729, 45743, 45756, 45769, 45782, 45796, 45809, 45822, 45835, 45849, 45862, 45875, 45888, 45901, 45915, 45928, 45941, 45954, 45967, 45980, 45993, 46006, 46019, 46032, 46046, 46059, 46072, 46085, 46098, 46111, 46124, 46137, 46150, 46162, 46175, 46188, 46201, 46214, 46227, 46240, 46253, 46266, 46279, 46291, 46304, 46317, 46330, 46343, 46356, 46368, 46381, 46394, 46407, 46419, 46432, 46445, 46458, 46470, 46483, 46496, 46508, 46521, 46534, 46546, 46559, 46571, 46584, 46597, 46609, 46622, 46634, 46647, 46660, 46672, 46685, 46697, 46710, 46722, 46735, 46747, 46760, 46772, 46784, 46797, 46809, 46822, 46834, 46847, 46859, 46871, 46884, 46896, 46908, 46921, 46933, 46945, 46958, 46970, 46982, 46995, 47007, 47019, 47031, 47044, 47056, 47068, 47080, 47093, 47105, 47117, 47129, 47141, 47154, 47166, 47178, 47190, 47202, 47214, 47226, 47238, 47251, 47263, 47275, 47287, 47299, 47311, 47323, 47335, 47347, 47359, 47371, 47383, 47395, 47407, 47419, 47431, 47443, 47455, 47467, 47478, 47490, 47502, 47514, 47526, 47538, 47550, 47562, 47573, 47585, 47597, 47609, 47621, 47633, 47644, 47656, 47668, 47680, 47691, 47703, 47715, 47727, 47738, 47750, 47762, 47773, 47785, 47797, 47808, 47820, 47832, 47843, 47855, 47867, 47878, 47890, 47902, 47913, 47925, 47936, 47948, 47959, 47971, 47982, 47994, 48006, 48017, 48029, 48040, 48052, 48063, 48074, 48086, 48097, 48109, 48120, 48132, 48143, 48155, 48166, 48177, 48189, 48200, 48212, 48223, 48234, 48246, 48257, 48268, 48280, 48291, 48302, 48313, 48325, 48336, 48347, 48359, 48370, 48381, 48392, 48404, 48415, 48426, 48437, 48448, 48460, 48471, 48482, 48493, 48504, 48516, 48527, 48538, 48549, 48560, 48571, 48582, 48593, 48604, 48616, 48627, 48638, 48649, 48660, 48671, 48682, 48693, 48704, 48715, 48726, 48737, 48748, 48759, 48770, 48781, 48792, 48803, 48814, 48825, 48836, 48847, 48857, 48868, 48879, 48890, 48901, 48912, 48923, 48934, 48945, 48955, 48966, 48977, 48988, 48999, 49010, 49020, 49031, 49042, 49053, 49063, 49074, 49085, 49096, 49106, 49117, 49128, 49139, 49149, 49160, 49171, 49182, 49192, 49203, 49214, 49224, 49235, 49246, 49256, 49267, 49277, 49288, 49299, 49309, 49320, 49330, 49341, 49352, 49362, 49373, 49383, 49394, 49404, 49415, 49425, 49436, 49447, 49457, 49468, 49478, 49489, 49499, 49509, 49520, 49530, 49541, 49551, 49562, 49572, 49583, 49593, 49603, 49614, 49624, 49635, 49645, 49655, 49666, 49676, 49686, 49697, 49707, 49718, 49728, 49738, 49748, 49759, 49769, 49779, 49790, 49800, 49810, 49820, 49831, 49841, 49851, 49862, 49872, 49882, 49892, 49902, 49913, 49923, 49933, 49943, 49953, 49964, 49974, 49984, 49994, 50004, 50014, 50024, 50035, 50045, 50055, 50065, 50075, 50085, 50095, 50105, 50115, 50125, 50136, 50146, 50156, 50166, 50176, 50186, 50196, 50206, 50216, 50226, 50236, 50246, 50256, 50266, 50276, 50286, 50296, 50306, 50316, 50326, 50336, 50345, 50355, 50365, 50375, 50385, 50395, 50405, 50415, 50425, 50435, 50444, 50454, 50464, 50474, 50484, 50494, 50504, 50513, 50523, 50533, 50543, 50553, 50562, 50572, 50582, 50592, 50602, 50611, 50621, 50631, 50641, 50650, 50660, 50670, 50679, 50689, 50699, 50709, 50718, 50728, 50738, 50747, 50757, 50767, 50776, 50786, 50796, 50805, 50815, 50825, 50834, 50844, 50854, 50863, 50873, 50882, 50892, 50902, 50911, 50921, 50930, 50940, 50949, 50959, 50968, 50978, 50988, 50997, 51007, 51016, 51026, 51035, 51045, 51054, 51064, 51073, 51083, 51092, 51102, 51111, 51120, 51130, 51139, 51149, 51158, 51168, 51177, 51186, 51196, 51205, 51215, 51224, 51233, 51243, 51252, 51262, 51271, 51280, 51290, 51299, 51308, 51318, 51327, 51336, 51346, 51355, 51364, 51374, 51383, 51392, 51401, 51411, 51420, 51429, 51439, 51448, 51457, 51466, 51476, 51485, 51494, 51503, 51513, 51522, 51531, 51540, 51549, 51559, 51568, 51577, 51586, 51595, 51604, 51614, 51623, 51632, 51641, 51650, 51659, 51668, 51678, 51687, 51696, 51705, 51714, 51723, 51732, 51741, 51750, 51760, 51769, 51778, 51787, 51796, 51805, 51814, 51823, 51832, 51841, 51850, 51859, 51868, 51877, 51886, 51895, 51904, 51913, 51922, 51931, 51940, 51949, 51958, 51967, 51976, 51985, 51994, 52003, 52012, 52021, 52030, 52038, 52047, 52056, 52065, 52074, 52083, 52092, 52101, 52110, 52118, 52127, 52136, 52145, 52154, 52163, 52172, 52180, 52189, 52198, 52207, 52216, 52225, 52233, 52242, 52251, 52260, 52269, 52277, 52286, 52295, 52304, 52312, 52321, 52330, 52339, 52348, 52356, 52365, 52374, 52382, 52391, 52400, 52409, 52417, 52426, 52435, 52443, 52452, 52461, 52469, 52478, 52487, 52495, 52504, 52513, 52521, 52530, 52539, 52547, 52556, 52565, 52573, 52582, 52590, 52599, 52608, 52616, 52625, 52633, 52642, 52651, 52659, 52668, 52676, 52685, 52693, 52702, 52711, 52719, 52728, 52736, 52745, 52753, 52762, 52770, 52779, 52787, 52796, 52804, 52813, 52821, 52830, 52838, 52847, 52855, 52864, 52872, 52881, 52889, 52897, 52906, 52914, 52923, 52931, 52940, 52948, 52956, 52965, 52973, 52982, 52990, 52998, 53007, 53015, 53024, 53032, 53040, 53049, 53057, 53065, 53074, 53082, 53090, 53099, 53107, 53115, 53124, 53132, 53140, 53149, 53157, 53165, 53174, 53182, 53190, 53199, 53207, 53215, 53223, 53232, 53240, 53248, 53256, 53265, 53273, 53281, 53289, 53298, 53306, 53314, 53322, 53331, 53339, 53347, 53355, 53363, 53372, 53380, 53388, 53396, 53404, 53413, 53421, 53429, 53437, 53445, 53453, 53461, 53470, 53478, 53486, 53494, 53502, 53510, 53518, 53527, 53535, 53543, 53551, 53559, 53567, 53575, 53583, 53591, 53599, 53607, 53616, 53624, 53632, 53640, 53648, 53656, 53664, 53672, 53680, 53688, 53696, 53704, 53712, 53720, 53728, 53736, 53744, 53752, 53760, 53768, 53776, 53784, 53792, 53800, 53808, 53816, 53824, 53832, 53840, 53848, 53856, 53864, 53872, 53880, 53887, 53895, 53903, 53911, 53919, 53927, 53935, 53943, 53951, 53959, 53967, 53974, 53982, 53990, 53998, 54006, 54014, 54022, 54030, 54037, 54045, 54053, 54061, 54069, 54077, 54085, 54092, 54100, 54108, 54116, 54124, 54131, 54139, 54147, 54155, 54163, 54170, 54178, 54186, 54194, 54202, 54209, 54217, 54225, 54233, 54240, 54248, 54256, 54264, 54271, 54279, 54287, 54295, 54302, 54310, 54318, 54325, 54333, 54341, 54349, 54356, 54364, 54372, 54379, 54387, 54395, 54402, 54410, 54418, 54425, 54433, 54441, 54448, 54456, 54464, 54471, 54479, 54487, 54494, 54502, 54509, 54517, 54525, 54532, 54540, 54548, 54555, 54563, 54570, 54578, 54586, 54593, 54601, 54608, 54616, 54623, 54631, 54639, 54646, 54654, 54661, 54669, 54676, 54684, 54691, 54699, 54706, 54714, 54722, 54729, 54737, 54744, 54752, 54759, 54767, 54774, 54782, 54789, 54797, 54804, 54812, 54819, 54826, 54834, 54841, 54849, 54856, 54864, 54871, 54879, 54886, 54894, 54901, 54908, 54916, 54923, 54931, 54938, 54946, 54953, 54960, 54968, 54975, 54983, 54990, 54997, 55005, 55012, 55020, 55027, 55034, 55042, 55049, 55056, 55064, 55071, 55078, 55086, 55093, 55101, 55108, 55115, 55123, 55130, 55137, 55145, 55152, 55159, 55166, 55174, 55181, 55188, 55196, 55203, 55210, 55218, 55225, 55232, 55239, 55247, 55254, 55261, 55268, 55276, 55283, 55290, 55298, 55305, 55312, 55319, 55327, 55334, 55341, 55348, 55355, 55363, 55370, 55377, 55384, 55392, 55399, 55406, 55413, 55420, 55428, 55435, 55442, 55449, 55456, 55463, 55471, 55478, 55485, 55492, 55499, 55506, 55514, 55521, 55528, 55535, 55542, 55549, 55556, 55564, 55571, 55578, 55585, 55592, 55599, 55606, 55613, 55621, 55628, 55635, 55642, 55649, 55656, 55663, 55670, 55677, 55684, 55691, 55698, 55706, 55713, 55720, 55727, 55734, 55741, 55748, 55755, 55762, 55769, 55776, 55783, 55790, 55797, 55804, 55811, 55818, 55825, 55832, 55839, 55846, 55853, 55860, 55867, 55874, 55881, 55888, 55895, 55902, 55909, 55916, 55923, 55930, 55937, 55944, 55951, 55958, 55965, 55972, 55979, 55986, 55993, 56000, 56006, 56013, 56020, 56027, 56034, 56041, 56048, 56055, 56062, 56069, 56076, 56083, 56089, 56096, 56103, 56110, 56117, 56124, 56131, 56138, 56145, 56151, 56158, 56165, 56172, 56179, 56186, 56193, 56199, 56206, 56213, 56220, 56227, 56234, 56240, 56247, 56254, 56261, 56268, 56275, 56281, 56288, 56295, 56302, 56309, 56315, 56322, 56329, 56336, 56343, 56349, 56356, 56363, 56370, 56376, 56383, 56390, 56397, 56404, 56410, 56417, 56424, 56431, 56437, 56444, 56451, 56458, 56464, 56471, 56478, 56484, 56491, 56498, 56505, 56511, 56518, 56525, 56531, 56538, 56545, 56552, 56558, 56565, 56572, 56578, 56585, 56592, 56598, 56605, 56612, 56618, 56625, 56632, 56638, 56645, 56652, 56658, 56665, 56672, 56678, 56685, 56692, 56698, 56705, 56711, 56718, 56725, 56731, 56738, 56745, 56751, 56758, 56764, 56771, 56778, 56784, 56791, 56797, 56804, 56811, 56817, 56824, 56830, 56837, 56844, 56850, 56857, 56863, 56870, 56876, 56883, 56889, 56896, 56903, 56909, 56916, 56922, 56929, 56935, 56942, 56948, 56955, 56961, 56968, 56974, 56981, 56987, 56994, 57000, 57007, 57014, 57020, 57027, 57033, 57040, 57046, 57052, 57059, 57065, 57072, 57078, 57085, 57091, 57098, 57104, 57111, 57117, 57124, 57130, 57137, 57143, 57149, 57156, 57162, 57169, 57175, 57182, 57188, 57195, 57201, 57207, 57214, 57220, 57227, 57233, 57239, 57246, 57252, 57259, 57265, 57272, 57278, 57284, 57291, 57297, 57303, 57310, 57316, 57323, 57329, 57335, 57342, 57348, 57354, 57361, 57367, 57374, 57380, 57386, 57393, 57399, 57405, 57412, 57418, 57424, 57431, 57437, 57443, 57450, 57456, 57462, 57469, 57475, 57481, 57488, 57494, 57500, 57506, 57513, 57519, 57525, 57532, 57538, 57544, 57551, 57557, 57563, 57569, 57576, 57582, 57588, 57594, 57601, 57607, 57613, 57620, 57626, 57632, 57638, 57645, 57651, 57657, 57663, 57670, 57676, 57682, 57688, 57694, 57701, 57707, 57713, 57719, 57726, 57732, 57738, 57744, 57750, 57757, 57763, 57769, 57775, 57781, 57788, 57794, 57800, 57806, 57812, 57819, 57825, 57831, 57837, 57843, 57849, 57856, 57862, 57868, 57874, 57880, 57886, 57893, 57899, 57905, 57911, 57917, 57923, 57929, 57935, 57942, 57948, 57954, 57960, 57966, 57972, 57978, 57984, 57991, 57997, 58003, 58009, 58015, 58021, 58027, 58033, 58039, 58046, 58052, 58058, 58064, 58070, 58076, 58082, 58088, 58094, 58100, 58106, 58112, 58118, 58125, 58131, 58137, 58143, 58149, 58155, 58161, 58167, 58173, 58179, 58185, 58191, 58197, 58203, 58209, 58215, 58221, 58227, 58233, 58239, 58245, 58251, 58257, 58263, 58269, 58275, 58281, 58287, 58293, 58299, 58305, 58311, 58317, 58323, 58329, 58335, 58341, 58347, 58353, 58359, 58365, 58371, 58377, 58383, 58389, 58395, 58401, 58407, 58413, 58419, 58425, 58431, 58437, 58442, 58448, 58454, 58460, 58466, 58472, 58478, 58484, 58490, 58496, 58502, 58508, 58514, 58520, 58525, 58531, 58537, 58543, 58549, 58555, 58561, 58567, 58573, 58579, 58584, 58590, 58596, 58602, 58608, 58614, 58620, 58626, 58631, 58637, 58643, 58649, 58655, 58661, 58667, 58672, 58678, 58684, 58690, 58696, 58702, 58708, 58713, 58719, 58725, 58731, 58737, 58743, 58748, 58754, 58760, 58766, 58772, 58777, 58783, 58789, 58795, 58801, 58807, 58812, 58818, 58824, 58830, 58836, 58841, 58847, 58853, 58859, 58864, 58870, 58876, 58882, 58888, 58893, 58899, 58905, 58911, 58916, 58922, 58928, 58934, 58939, 58945, 58951, 58957, 58962, 58968, 58974, 58980, 58985, 58991, 58997, 59003, 59008, 59014, 59020, 59026, 59031, 59037, 59043, 59048, 59054, 59060, 59066, 59071, 59077, 59083, 59088, 59094, 59100, 59105, 59111, 59117, 59123, 59128, 59134, 59140, 59145, 59151, 59157, 59162, 59168, 59174, 59179, 59185, 59191, 59196, 59202, 59208, 59213, 59219, 59225, 59230, 59236, 59242, 59247, 59253, 59258, 59264, 59270, 59275, 59281, 59287, 59292, 59298, 59304, 59309, 59315, 59320, 59326, 59332, 59337, 59343, 59348, 59354, 59360, 59365, 59371, 59376, 59382, 59388, 59393, 59399, 59404, 59410, 59416, 59421, 59427, 59432, 59438, 59444, 59449, 59455, 59460, 59466, 59471, 59477, 59482, 59488, 59494, 59499, 59505, 59510, 59516, 59521, 59527, 59532, 59538, 59544, 59549, 59555, 59560, 59566, 59571, 59577, 59582, 59588, 59593, 59599, 59604, 59610, 59615, 59621, 59626, 59632, 59637, 59643, 59648, 59654, 59659, 59665, 59670, 59676, 59681, 59687, 59692, 59698, 59703, 59709, 59714, 59720, 59725, 59731, 59736, 59742, 59747, 59753, 59758, 59764, 59769, 59774, 59780, 59785, 59791, 59796, 59802, 59807, 59813, 59818, 59823, 59829, 59834, 59840, 59845, 59851, 59856, 59862, 59867, 59872, 59878, 59883, 59889, 59894, 59899, 59905, 59910, 59916, 59921, 59927, 59932, 59937, 59943, 59948, 59954, 59959, 59964, 59970, 59975, 59981, 59986, 59991, 59997, 60002, 60007, 60013, 60018, 60024, 60029, 60034, 60040, 60045, 60050, 60056, 60061, 60066, 60072, 60077, 60083, 60088, 60093, 60099, 60104, 60109, 60115, 60120, 60125, 60131, 60136, 60141, 60147, 60152, 60157, 60163, 60168, 60173, 60179, 60184, 60189, 60195, 60200, 60205, 60210, 60216, 60221, 60226, 60232, 60237, 60242, 60248, 60253, 60258, 60263, 60269, 60274, 60279, 60285, 60290, 60295, 60300, 60306, 60311, 60316, 60322, 60327, 60332, 60337, 60343, 60348, 60353, 60358, 60364, 60369, 60374, 60379, 60385, 60390, 60395, 60400, 60406, 60411, 60416, 60421, 60427, 60432, 60437, 60442, 60448, 60453, 60458, 60463, 60468, 60474, 60479, 60484, 60489, 60495, 60500, 60505, 60510, 60515, 60521, 60526, 60531, 60536, 60541, 60547, 60552, 60557, 60562, 60567, 60573, 60578, 60583, 60588, 60593, 60599, 60604, 60609, 60614, 60619, 60624, 60630, 60635, 60640, 60645, 60650, 60655, 60661, 60666, 60671, 60676, 60681, 60686, 60692, 60697, 60702, 60707, 60712, 60717, 60722, 60728, 60733, 60738, 60743, 60748, 60753, 60758, 60763, 60769, 60774, 60779, 60784, 60789, 60794, 60799, 60804, 60809, 60815, 60820, 60825, 60830, 60835, 60840, 60845, 60850, 60855, 60861, 60866, 60871, 60876, 60881, 60886, 60891, 60896, 60901, 60906, 60911, 60916, 60922, 60927, 60932, 60937, 60942, 60947, 60952, 60957, 60962, 60967, 60972, 60977, 60982, 60987, 60992, 60997, 61003, 61008, 61013, 61018, 61023, 61028, 61033, 61038, 61043, 61048, 61053, 61058, 61063, 61068, 61073, 61078, 61083, 61088, 61093, 61098, 61103, 61108, 61113, 61118, 61123, 61128, 61133, 61138, 61143, 61148, 61153, 61158, 61163, 61168, 61173, 61178, 61183, 61188, 61193, 61198, 61203, 61208, 61213, 61218, 61223, 61228, 61233, 61238, 61243, 61248, 61253, 61258, 61263, 61268, 61273, 61278, 61283, 61288, 61293, 61298, 61303, 61308, 61313, 61317, 61322, 61327, 61332, 61337, 61342, 61347, 61352, 61357, 61362, 61367, 61372, 61377, 61382, 61387, 61392, 61396, 61401, 61406, 61411, 61416, 61421, 61426, 61431, 61436, 61441, 61446, 61451, 61455, 61460, 61465, 61470, 61475, 61480, 61485, 61490, 61495, 61500, 61504, 61509, 61514, 61519, 61524, 61529, 61534, 61539, 61543, 61548, 61553, 61558, 61563, 61568, 61573, 61578, 61582, 61587, 61592, 61597, 61602, 61607, 61612, 61616, 61621, 61626, 61631, 61636, 61641, 61646, 61650, 61655, 61660, 61665, 61670, 61675, 61679, 61684, 61689, 61694, 61699, 61704, 61708, 61713, 61718, 61723, 61728, 61733, 61737, 61742, 61747, 61752, 61757, 61761, 61766, 61771, 61776, 61781, 61786, 61790, 61795, 61800, 61805, 61810, 61814, 61819, 61824, 61829, 61834, 61838, 61843, 61848, 61853, 61857, 61862, 61867, 61872, 61877, 61881, 61886, 61891, 61896, 61900, 61905, 61910, 61915, 61919, 61924, 61929, 61934, 61939, 61943, 61948, 61953, 61958, 61962, 61967, 61972, 61977, 61981, 61986, 61991, 61996, 62000, 62005, 62010, 62014, 62019, 62024, 62029, 62033, 62038, 62043, 62048, 62052, 62057, 62062, 62066, 62071, 62076, 62081, 62085, 62090, 62095, 62099, 62104, 62109, 62114, 62118, 62123, 62128, 62132, 62137, 62142, 62146, 62151, 62156, 62161, 62165, 62170, 62175, 62179, 62184, 62189, 62193, 62198, 62203, 62207, 62212, 62217, 62221, 62226, 62231, 62235, 62240, 62245, 62249, 62254, 62259, 62263, 62268, 62273, 62277, 62282, 62287, 62291, 62296, 62301, 62305, 62310, 62315, 62319, 62324, 62329, 62333, 62338, 62342, 62347, 62352, 62356, 62361, 62366, 62370, 62375, 62380, 62384, 62389, 62393, 62398, 62403, 62407, 62412, 62416, 62421, 62426, 62430, 62435, 62440, 62444, 62449, 62453, 62458, 62463, 62467, 62472, 62476, 62481, 62486, 62490, 62495, 62499, 62504, 62509, 62513, 62518, 62522, 62527, 62531, 62536, 62541, 62545, 62550, 62554, 62559, 62564, 62568, 62573, 62577, 62582, 62586, 62591, 62595, 62600, 62605, 62609, 62614, 62618, 62623, 62627, 62632, 62637, 62641, 62646, 62650, 62655, 62659, 62664, 62668, 62673, 62677, 62682, 62686, 62691, 62696, 62700, 62705, 62709, 62714, 62718, 62723, 62727, 62732, 62736, 62741, 62745, 62750, 62754, 62759, 62763, 62768, 62772, 62777, 62781, 62786, 62791, 62795, 62800, 62804, 62809, 62813, 62818, 62822, 62827, 62831, 62836, 62840, 62845, 62849, 62853, 62858, 62862, 62867, 62871, 62876, 62880, 62885, 62889, 62894, 62898, 62903, 62907, 62912, 62916, 62921, 62925, 62930, 62934, 62939, 62943, 62947, 62952, 62956, 62961, 62965, 62970, 62974, 62979, 62983, 62988, 62992, 62996, 63001, 63005, 63010, 63014, 63019, 63023, 63028, 63032, 63036, 63041, 63045, 63050, 63054, 63059, 63063, 63068, 63072, 63076, 63081, 63085, 63090, 63094, 63098, 63103, 63107, 63112, 63116, 63121, 63125, 63129, 63134, 63138, 63143, 63147, 63151, 63156, 63160, 63165, 63169, 63173, 63178, 63182, 63187, 63191, 63195, 63200, 63204, 63209, 63213, 63217, 63222, 63226, 63231, 63235, 63239, 63244, 63248, 63252, 63257, 63261, 63266, 63270, 63274, 63279, 63283, 63287, 63292, 63296, 63301, 63305, 63309, 63314, 63318, 63322, 63327, 63331, 63335, 63340, 63344, 63348, 63353, 63357, 63361, 63366, 63370, 63375, 63379, 63383, 63388, 63392, 63396, 63401, 63405, 63409, 63414, 63418, 63422, 63427, 63431, 63435, 63440, 63444, 63448, 63453, 63457, 63461, 63465, 63470, 63474, 63478, 63483, 63487, 63491, 63496, 63500, 63504, 63509, 63513, 63517, 63522, 63526, 63530, 63534, 63539, 63543, 63547, 63552, 63556, 63560, 63564, 63569, 63573, 63577, 63582, 63586, 63590, 63594, 63599, 63603, 63607, 63612, 63616, 63620, 63624, 63629, 63633, 63637, 63642, 63646, 63650, 63654, 63659, 63663, 63667, 63671, 63676, 63680, 63684, 63688, 63693, 63697, 63701, 63705, 63710, 63714, 63718, 63722, 63727, 63731, 63735, 63739, 63744, 63748, 63752, 63756, 63761, 63765, 63769, 63773, 63778, 63782, 63786, 63790, 63795, 63799, 63803, 63807, 63811, 63816, 63820, 63824, 63828, 63833, 63837, 63841, 63845, 63849, 63854, 63858, 63862, 63866, 63870, 63875, 63879, 63883, 63887, 63891, 63896, 63900, 63904, 63908, 63912, 63917, 63921, 63925, 63929, 63933, 63938, 63942, 63946, 63950, 63954, 63959, 63963, 63967, 63971, 63975, 63980, 63984, 63988, 63992, 63996, 64000, 64005, 64009, 64013, 64017, 64021, 64025, 64030, 64034, 64038, 64042, 64046, 64050, 64055, 64059, 64063, 64067, 64071, 64075, 64080, 64084, 64088, 64092, 64096, 64100, 64104, 64109, 64113, 64117, 64121, 64125, 64129, 64133, 64138, 64142, 64146, 64150, 64154, 64158, 64162, 64166, 64171, 64175, 64179, 64183, 64187, 64191, 64195, 64200, 64204, 64208, 64212, 64216, 64220, 64224, 64228, 64232, 64237, 64241, 64245, 64249, 64253, 64257, 64261, 64265, 64269, 64274, 64278, 64282, 64286, 64290, 64294, 64298, 64302, 64306, 64310, 64314, 64319, 64323, 64327, 64331, 64335, 64339, 64343, 64347, 64351, 64355, 64359, 64364, 64368, 64372, 64376, 64380, 64384, 64388, 64392, 64396, 64400, 64404, 64408, 64412, 64416, 64421, 64425, 64429, 64433, 64437, 64441, 64445, 64449, 64453, 64457, 64461, 64465, 64469, 64473, 64477, 64481, 64485, 64489, 64494, 64498, 64502, 64506, 64510, 64514, 64518, 64522, 64526, 64530, 64534, 64538, 64542, 64546, 64550, 64554, 64558, 64562, 64566, 64570, 64574, 64578, 64582, 64586, 64590, 64594, 64598, 64602, 64606, 64610, 64614, 64618, 64622, 64626, 64630, 64634, 64638, 64642, 64647, 64651, 64655, 64659, 64663, 64667, 64671, 64675, 64679, 64683, 64687, 64691, 64695, 64699, 64702, 64706, 64710, 64714, 64718, 64722, 64726, 64730, 64734, 64738, 64742, 64746, 64750, 64754, 64758, 64762, 64766, 64770, 64774, 64778, 64782, 64786, 64790, 64794, 64798, 64802, 64806, 64810, 64814, 64818, 64822, 64826, 64830, 64834, 64838, 64842, 64846, 64850, 64853, 64857, 64861, 64865, 64869, 64873, 64877, 64881, 64885, 64889, 64893, 64897, 64901, 64905, 64909, 64913, 64917, 64921, 64924, 64928, 64932, 64936, 64940, 64944, 64948, 64952, 64956, 64960, 64964, 64968, 64972, 64976, 64980, 64983, 64987, 64991, 64995, 64999, 65003, 65007, 65011, 65015, 65019, 65023, 65027, 65030, 65034, 65038, 65042, 65046, 65050, 65054, 65058, 65062, 65066, 65069, 65073, 65077, 65081, 65085, 65089, 65093, 65097, 65101, 65105, 65108, 65112, 65116, 65120, 65124, 65128, 65132, 65136, 65140, 65143, 65147, 65151, 65155, 65159, 65163, 65167, 65171, 65174, 65178, 65182, 65186, 65190, 65194, 65198, 65202, 65205, 65209, 65213, 65217, 65221, 65225, 65229, 65232, 65236, 65240, 65244, 65248, 65252, 65256, 65259, 65263, 65267, 65271, 65275, 65279, 65283, 65286, 65290, 65294, 65298, 65302, 65306, 65309, 65313, 65317, 65321, 65325, 65329, 65332, 65336, 65340, 65344, 65348, 65352, 65355, 65359, 65363, 65367, 65371, 65375, 65378, 65382, 65386, 65390, 65394, 65398, 65401, 65405, 65409, 65413, 65417, 65420, 65424, 65428, 65432, 65436, 65440, 65443, 65447, 65451, 65455, 65459, 65462, 65466, 65470, 65474, 65478, 65481, 65485, 65489, 65493, 65497, 65500, 65504, 65508, 65512, 65516, 65519, 65523, 65527, 65531, 65535};
-	static constexpr int32_t linSlope[4097] = {0, 15, 31, 47, 63, 79, 95, 111, 127, 143, 159, 175, 191, 207, 223, 239, 255, 271, 287, 303, 319, 335, 351, 367, 383, 399, 415, 431, 447, 463, 479, 495, 511, 527, 543, 559, 575, 591, 607, 623, 639, 655, 671, 687, 703, 719, 735, 751, 767, 783, 799, 815, 831, 847, 863, 879, 895, 911, 927, 943, 959, 975, 991, 1007, 1023, 1039, 1055, 1071, 1087, 1103, 1119, 1135, 1151, 1167, 1183, 1199, 1215, 1231, 1247, 1263, 1279, 1295, 1311, 1327, 1343, 1359, 1375, 1391, 1407, 1423, 1439, 1455, 1471, 1487, 1503, 1519, 1535, 1551, 1567, 1583, 1599, 1615, 1631, 1647, 1663, 1679, 1695, 1711, 1727, 1743, 1759, 1775, 1791, 1807, 1823, 1839, 1855, 1871, 1887, 1903, 1919, 1935, 1951, 1967, 1983, 1999, 2015, 2031, 2047, 2063, 2079, 2095, 2111, 2127, 2143, 2159, 2175, 2191, 2207, 2223, 2239, 2255, 2271, 2287, 2303, 2319, 2335, 2351, 2367, 2383, 2399, 2415, 2431, 2447, 2463, 2479, 2495, 2511, 2527, 2543, 2559, 2575, 2591, 2607, 2623, 2639, 2655, 2671, 2687, 2703, 2719, 2735, 2751, 2767, 2783, 2799, 2815, 2831, 2847, 2863, 2879, 2895, 2911, 2927, 2943, 2959, 2975, 2991, 3007, 3023, 3039, 3055, 3071, 3087, 3103, 3119, 3135, 3151, 3167, 3183, 3199, 3215, 3231, 3247, 3263, 3279, 3295, 3311, 3327, 3343, 3359, 3375, 3391, 3407, 3423, 3439, 3455, 3471, 3487, 3503, 3519, 3535, 3551, 3567, 3583, 3599, 3615, 3631, 3647, 3663, 3679, 3695, 3711, 3727, 3743, 3759, 3775, 3791, 3807, 3823, 3839, 3855, 3871, 3887, 3903, 3919, 3935, 3951, 3967, 3983, 3999, 4015, 4031, 4047, 4063, 4079, 4095, 4111, 4127, 4143, 4159, 4175, 4191, 4207, 4223, 4239, 4255, 4271, 4287, 4303, 4319, 4335, 4351, 4367, 4383, 4399, 4415, 4431, 4447, 4463, 4479, 4495, 4511, 4527, 4543, 4559, 4575, 4591, 4607, 4623, 4639, 4655, 4671, 4687, 4703, 4719, 4735, 4751, 4767, 4783, 4799, 4815, 4831, 4847, 4863, 4879, 4895, 4911, 4927, 4943, 4959, 4975, 4991, 5007, 5023, 5039, 5055, 5071, 5087, 5103, 5119, 5135, 5151, 5167, 5183, 5199, 5215, 5231, 5247, 5263, 5279, 5295, 5311, 5327, 5343, 5359, 5375, 5391, 5407, 5423, 5439, 5455, 5471, 5487, 5503, 5519, 5535, 5551, 5567, 5583, 5599, 5615, 5631, 5647, 5663, 5679, 5695, 5711, 5727, 5743, 5759, 5775, 5791, 5807, 5823, 5839, 5855, 5871, 5887, 5903, 5919, 5935, 5951, 5967, 5983, 5999, 6015, 6031, 6047, 6063, 6079, 6095, 6111, 6127, 6143, 6159, 6175, 6191, 6207, 6223, 6239, 6255, 6271, 6287, 6303, 6319, 6335, 6351, 6367, 6383, 6399, 6415, 6431, 6447, 6463, 6479, 6495, 6511, 6527, 6543, 6559, 6575, 6591, 6607, 6623, 6639, 6655, 6671, 6687, 6703, 6719, 6735, 6751, 6767, 6783, 6799, 6815, 6831, 6847, 6863, 6879, 6895, 6911, 6927, 6943, 6959, 6975, 6991, 7007, 7023, 7039, 7055, 7071, 7087, 7103, 7119, 7135, 7151, 7167, 7183, 7199, 7215, 7231, 7247, 7263, 7279, 7295, 7311, 7327, 7343, 7359, 7375, 7391, 7407, 7423, 7439, 7455, 7471, 7487, 7503, 7519, 7535, 7551, 7567, 7583, 7599, 7615, 7631, 7647, 7663, 7679, 7695, 7711, 7727, 7743, 7759, 7775, 7791, 7807, 7823, 7839, 7855, 7871, 7887, 7903, 7919, 7935, 7951, 7967, 7983, 7999, 8015, 8031, 8047, 8063, 8079, 8095, 8111, 8127, 8143, 8159, 8175, 8191, 8207, 8223, 8239, 8255, 8271, 8287, 8303, 8319, 8335, 8351, 8367, 8383, 8399, 8415, 8431, 8447, 8463, 8479, 8495, 8511, 8527, 8543, 8559, 8575, 8591, 8607, 8623, 8639, 8655, 8671, 8687, 8703, 8719, 8735, 8751, 8767, 8783, 8799, 8815, 8831, 8847, 8863, 8879, 8895, 8911, 8927, 8943, 8959, 8975, 8991, 9007, 9023, 9039, 9055, 9071, 9087, 9103, 9119, 9135, 9151, 9167, 9183, 9199, 9215, 9231, 9247, 9263, 9279, 9295, 9311, 9327, 9343, 9359, 9375, 9391, 9407, 9423, 9439, 9455, 9471, 9487, 9503, 9519, 9535, 9551, 9567, 9583, 9599, 9615, 9631, 9647, 9663, 9679, 9695, 9711, 9727, 9743, 9759, 9775, 9791, 9807, 9823, 9839, 9855, 9871, 9887, 9903, 9919, 9935, 9951, 9967, 9983, 9999, 10015, 10031, 10047, 10063, 10079, 10095, 10111, 10127, 10143, 10159, 10175, 10191, 10207, 10223, 10239, 10255, 10271, 10287, 10303, 10319, 10335, 10351, 10367, 10383, 10399, 10415, 10431, 10447, 10463, 10479, 10495, 10511, 10527, 10543, 10559, 10575, 10591, 10607, 10623, 10639, 10655, 10671, 10687, 10703, 10719, 10735, 10751, 10767, 10783, 10799, 10815, 10831, 10847, 10863, 10879, 10895, 10911, 10927, 10943, 10959, 10975, 10991, 11007, 11023, 11039, 11055, 11071, 11087, 11103, 11119, 11135, 11151, 11167, 11183, 11199, 11215, 11231, 11247, 11263, 11279, 11295, 11311, 11327, 11343, 11359, 11375, 11391, 11407, 11423, 11439, 11455, 11471, 11487, 11503, 11519, 11535, 11551, 11567, 11583, 11599, 11615, 11631, 11647, 11663, 11679, 11695, 11711, 11727, 11743, 11759, 11775, 11791, 11807, 11823, 11839, 11855, 11871, 11887, 11903, 11919, 11935, 11951, 11967, 11983, 11999, 12015, 12031, 12047, 12063, 12079, 12095, 12111, 12127, 12143, 12159, 12175, 12191, 12207, 12223, 12239, 12255, 12271, 12287, 12303, 12319, 12335, 12351, 12367, 12383, 12399, 12415, 12431, 12447, 12463, 12479, 12495, 12511, 12527, 12543, 12559, 12575, 12591, 12607, 12623, 12639, 12655, 12671, 12687, 12703, 12719, 12735, 12751, 12767, 12783, 12799, 12815, 12831, 12847, 12863, 12879, 12895, 12911, 12927, 12943, 12959, 12975, 12991, 13007, 13023, 13039, 13055, 13071, 13087, 13103, 13119, 13135, 13151, 13167, 13183, 13199, 13215, 13231, 13247, 13263, 13279, 13295, 13311, 13327, 13343, 13359, 13375, 13391, 13407, 13423, 13439, 13455, 13471, 13487, 13503, 13519, 13535, 13551, 13567, 13583, 13599, 13615, 13631, 13647, 13663, 13679, 13695, 13711, 13727, 13743, 13759, 13775, 13791, 13807, 13823, 13839, 13855, 13871, 13887, 13903, 13919, 13935, 13951, 13967, 13983, 13999, 14015, 14031, 14047, 14063, 14079, 14095, 14111, 14127, 14143, 14159, 14175, 14191, 14207, 14223, 14239, 14255, 14271, 14287, 14303, 14319, 14335, 14351, 14367, 14383, 14399, 14415, 14431, 14447, 14463, 14479, 14495, 14511, 14527, 14543, 14559, 14575, 14591, 14607, 14623, 14639, 14655, 14671, 14687, 14703, 14719, 14735, 14751, 14767, 14783, 14799, 14815, 14831, 14847, 14863, 14879, 14895, 14911, 14927, 14943, 14959, 14975, 14991, 15007, 15023, 15039, 15055, 15071, 15087, 15103, 15119, 15135, 15151, 15167, 15183, 15199, 15215, 15231, 15247, 15263, 15279, 15295, 15311, 15327, 15343, 15359, 15375, 15391, 15407, 15423, 15439, 15455, 15471, 15487, 15503, 15519, 15535, 15551, 15567, 15583, 15599, 15615, 15631, 15647, 15663, 15679, 15695, 15711, 15727, 15743, 15759, 15775, 15791, 15807, 15823, 15839, 15855, 15871, 15887, 15903, 15919, 15935, 15951, 15967, 15983, 15999, 16015, 16031, 16047, 16063, 16079, 16095, 16111, 16127, 16143, 16159, 16175, 16191, 16207, 16223, 16239, 16255, 16271, 16287, 16303, 16319, 16335, 16351, 16367, 16383, 16399, 16415, 16431, 16447, 16463, 16479, 16495, 16511, 16527, 16543, 16559, 16575, 16591, 16607, 16623, 16639, 16655, 16671, 16687, 16703, 16719, 16735, 16751, 16767, 16783, 16799, 16815, 16831, 16847, 16863, 16879, 16895, 16911, 16927, 16943, 16959, 16975, 16991, 17007, 17023, 17039, 17055, 17071, 17087, 17103, 17119, 17135, 17151, 17167, 17183, 17199, 17215, 17231, 17247, 17263, 17279, 17295, 17311, 17327, 17343, 17359, 17375, 17391, 17407, 17423, 17439, 17455, 17471, 17487, 17503, 17519, 17535, 17551, 17567, 17583, 17599, 17615, 17631, 17647, 17663, 17679, 17695, 17711, 17727, 17743, 17759, 17775, 17791, 17807, 17823, 17839, 17855, 17871, 17887, 17903, 17919, 17935, 17951, 17967, 17983, 17999, 18015, 18031, 18047, 18063, 18079, 18095, 18111, 18127, 18143, 18159, 18175, 18191, 18207, 18223, 18239, 18255, 18271, 18287, 18303, 18319, 18335, 18351, 18367, 18383, 18399, 18415, 18431, 18447, 18463, 18479, 18495, 18511, 18527, 18543, 18559, 18575, 18591, 18607, 18623, 18639, 18655, 18671, 18687, 18703, 18719, 18735, 18751, 18767, 18783, 18799, 18815, 18831, 18847, 18863, 18879, 18895, 18911, 18927, 18943, 18959, 18975, 18991, 19007, 19023, 19039, 19055, 19071, 19087, 19103, 19119, 19135, 19151, 19167, 19183, 19199, 19215, 19231, 19247, 19263, 19279, 19295, 19311, 19327, 19343, 19359, 19375, 19391, 19407, 19423, 19439, 19455, 19471, 19487, 19503, 19519, 19535, 19551, 19567, 19583, 19599, 19615, 19631, 19647, 19663, 19679, 19695, 19711, 19727, 19743, 19759, 19775, 19791, 19807, 19823, 19839, 19855, 19871, 19887, 19903, 19919, 19935, 19951, 19967, 19983, 19999, 20015, 20031, 20047, 20063, 20079, 20095, 20111, 20127, 20143, 20159, 20175, 20191, 20207, 20223, 20239, 20255, 20271, 20287, 20303, 20319, 20335, 20351, 20367, 20383, 20399, 20415, 20431, 20447, 20463, 20479, 20495, 20511, 20527, 20543, 20559, 20575, 20591, 20607, 20623, 20639, 20655, 20671, 20687, 20703, 20719, 20735, 20751, 20767, 20783, 20799, 20815, 20831, 20847, 20863, 20879, 20895, 20911, 20927, 20943, 20959, 20975, 20991, 21007, 21023, 21039, 21055, 21071, 21087, 21103, 21119, 21135, 21151, 21167, 21183, 21199, 21215, 21231, 21247, 21263, 21279, 21295, 21311, 21327, 21343, 21359, 21375, 21391, 21407, 21423, 21439, 21455, 21471, 21487, 21503, 21519, 21535, 21551, 21567, 21583, 21599, 21615, 21631, 21647, 21663, 21679, 21695, 21711, 21727, 21743, 21759, 21775, 21791, 21807, 21823, 21839, 21855, 21871, 21887, 21903, 21919, 21935, 21951, 21967, 21983, 21999, 22015, 22031, 22047, 22063, 22079, 22095, 22111, 22127, 22143, 22159, 22175, 22191, 22207, 22223, 22239, 22255, 22271, 22287, 22303, 22319, 22335, 22351, 22367, 22383, 22399, 22415, 22431, 22447, 22463, 22479, 22495, 22511, 22527, 22543, 22559, 22575, 22591, 22607, 22623, 22639, 22655, 22671, 22687, 22703, 22719, 22735, 22751, 22767, 22783, 22799, 22815, 22831, 22847, 22863, 22879, 22895, 22911, 22927, 22943, 22959, 22975, 22991, 23007, 23023, 23039, 23055, 23071, 23087, 23103, 23119, 23135, 23151, 23167, 23183, 23199, 23215, 23231, 23247, 23263, 23279, 23295, 23311, 23327, 23343, 23359, 23375, 23391, 23407, 23423, 23439, 23455, 23471, 23487, 23503, 23519, 23535, 23551, 23567, 23583, 23599, 23615, 23631, 23647, 23663, 23679, 23695, 23711, 23727, 23743, 23759, 23775, 23791, 23807, 23823, 23839, 23855, 23871, 23887, 23903, 23919, 23935, 23951, 23967, 23983, 23999, 24015, 24031, 24047, 24063, 24079, 24095, 24111, 24127, 24143, 24159, 24175, 24191, 24207, 24223, 24239, 24255, 24271, 24287, 24303, 24319, 24335, 24351, 24367, 24383, 24399, 24415, 24431, 24447, 24463, 24479, 24495, 24511, 24527, 24543, 24559, 24575, 24591, 24607, 24623, 24639, 24655, 24671, 24687, 24703, 24719, 24735, 24751, 24767, 24783, 24799, 24815, 24831, 24847, 24863, 24879, 24895, 24911, 24927, 24943, 24959, 24975, 24991, 25007, 25023, 25039, 25055, 25071, 25087, 25103, 25119, 25135, 25151, 25167, 25183, 25199, 25215, 25231, 25247, 25263, 25279, 25295, 25311, 25327, 25343, 25359, 25375, 25391, 25407, 25423, 25439, 25455, 25471, 25487, 25503, 25519, 25535, 25551, 25567, 25583, 25599, 25615, 25631, 25647, 25663, 25679, 25695, 25711, 25727, 25743, 25759, 25775, 25791, 25807, 25823, 25839, 25855, 25871, 25887, 25903, 25919, 25935, 25951, 25967, 25983, 25999, 26015, 26031, 26047, 26063, 26079, 26095, 26111, 26127, 26143, 26159, 26175, 26191, 26207, 26223, 26239, 26255, 26271, 26287, 26303, 26319, 26335, 26351, 26367, 26383, 26399, 26415, 26431, 26447, 26463, 26479, 26495, 26511, 26527, 26543, 26559, 26575, 26591, 26607, 26623, 26639, 26655, 26671, 26687, 26703, 26719, 26735, 26751, 26767, 26783, 26799, 26815, 26831, 26847, 26863, 26879, 26895, 26911, 26927, 26943, 26959, 26975, 26991, 27007, 27023, 27039, 27055, 27071, 27087, 27103, 27119, 27135, 27151, 27167, 27183, 27199, 27215, 27231, 27247, 27263, 27279, 27295, 27311, 27327, 27343, 27359, 27375, 27391, 27407, 27423, 27439, 27455, 27471, 27487, 27503, 27519, 27535, 27551, 27567, 27583, 27599, 27615, 27631, 27647, 27663, 27679, 27695, 27711, 27727, 27743, 27759, 27775, 27791, 27807, 27823, 27839, 27855, 27871, 27887, 27903, 27919, 27935, 27951, 27967, 27983, 27999, 28015, 28031, 28047, 28063, 28079, 28095, 28111, 28127, 28143, 28159, 28175, 28191, 28207, 28223, 28239, 28255, 28271, 28287, 28303, 28319, 28335, 28351, 28367, 28383, 28399, 28415, 28431, 28447, 28463, 28479, 28495, 28511, 28527, 28543, 28559, 28575, 28591, 28607, 28623, 28639, 28655, 28671, 28687, 28703, 28719, 28735, 28751, 28767, 28783, 28799, 28815, 28831, 28847, 28863, 28879, 28895, 28911, 28927, 28943, 28959, 28975, 28991, 29007, 29023, 29039, 29055, 29071, 29087, 29103, 29119, 29135, 29151, 29167, 29183, 29199, 29215, 29231, 29247, 29263, 29279, 29295, 29311, 29327, 29343, 29359, 29375, 29391, 29407, 29423, 29439, 29455, 29471, 29487, 29503, 29519, 29535, 29551, 29567, 29583, 29599, 29615, 29631, 29647, 29663, 29679, 29695, 29711, 29727, 29743, 29759, 29775, 29791, 29807, 29823, 29839, 29855, 29871, 29887, 29903, 29919, 29935, 29951, 29967, 29983, 29999, 30015, 30031, 30047, 30063, 30079, 30095, 30111, 30127, 30143, 30159, 30175, 30191, 30207, 30223, 30239, 30255, 30271, 30287, 30303, 30319, 30335, 30351, 30367, 30383, 30399, 30415, 30431, 30447, 30463, 30479, 30495, 30511, 30527, 30543, 30559, 30575, 30591, 30607, 30623, 30639, 30655, 30671, 30687, 30703, 30719, 30735, 30751, 30767, 30783, 30799, 30815, 30831, 30847, 30863, 30879, 30895, 30911, 30927, 30943, 30959, 30975, 30991, 31007, 31023, 31039, 31055, 31071, 31087, 31103, 31119, 31135, 31151, 31167, 31183, 31199, 31215, 31231, 31247, 31263, 31279, 31295, 31311, 31327, 31343, 31359, 31375, 31391, 31407, 31423, 31439, 31455, 31471, 31487, 31503, 31519, 31535, 31551, 31567, 31583, 31599, 31615, 31631, 31647, 31663, 31679, 31695, 31711, 31727, 31743, 31759, 31775, 31791, 31807, 31823, 31839, 31855, 31871, 31887, 31903, 31919, 31935, 31951, 31967, 31983, 31999, 32015, 32031, 32047, 32063, 32079, 32095, 32111, 32127, 32143, 32159, 32175, 32191, 32207, 32223, 32239, 32255, 32271, 32287, 32303, 32319, 32335, 32351, 32367, 32383, 32399, 32415, 32431, 32447, 32463, 32479, 32495, 32511, 32527, 32543, 32559, 32575, 32591, 32607, 32623, 32639, 32655, 32671, 32687, 32703, 32719, 32735, 32751, 32767, 32783, 32799, 32815, 32831, 32847, 32863, 32879, 32895, 32911, 32927, 32943, 32959, 32975, 32991, 33007, 33023, 33039, 33055, 33071, 33087, 33103, 33119, 33135, 33151, 33167, 33183, 33199, 33215, 33231, 33247, 33263, 33279, 33295, 33311, 33327, 33343, 33359, 33375, 33391, 33407, 33423, 33439, 33455, 33471, 33487, 33503, 33519, 33535, 33551, 33567, 33583, 33599, 33615, 33631, 33647, 33663, 33679, 33695, 33711, 33727, 33743, 33759, 33775, 33791, 33807, 33823, 33839, 33855, 33871, 33887, 33903, 33919, 33935, 33951, 33967, 33983, 33999, 34015, 34031, 34047, 34063, 34079, 34095, 34111, 34127, 34143, 34159, 34175, 34191, 34207, 34223, 34239, 34255, 34271, 34287, 34303, 34319, 34335, 34351, 34367, 34383, 34399, 34415, 34431, 34447, 34463, 34479, 34495, 34511, 34527, 34543, 34559, 34575, 34591, 34607, 34623, 34639, 34655, 34671, 34687, 34703, 34719, 34735, 34751, 34767, 34783, 34799, 34815, 34831, 34847, 34863, 34879, 34895, 34911, 34927, 34943, 34959, 34975, 34991, 35007, 35023, 35039, 35055, 35071, 35087, 35103, 35119, 35135, 35151, 35167, 35183, 35199, 35215, 35231, 35247, 35263, 35279, 35295, 35311, 35327, 35343, 35359, 35375, 35391, 35407, 35423, 35439, 35455, 35471, 35487, 35503, 35519, 35535, 35551, 35567, 35583, 35599, 35615, 35631, 35647, 35663, 35679, 35695, 35711, 35727, 35743, 35759, 35775, 35791, 35807, 35823, 35839, 35855, 35871, 35887, 35903, 35919, 35935, 35951, 35967, 35983, 35999, 36015, 36031, 36047, 36063, 36079, 36095, 36111, 36127, 36143, 36159, 36175, 36191, 36207, 36223, 36239, 36255, 36271, 36287, 36303, 36319, 36335, 36351, 36367, 36383, 36399, 36415, 36431, 36447, 36463, 36479, 36495, 36511, 36527, 36543, 36559, 36575, 36591, 36607, 36623, 36639, 36655, 36671, 36687, 36703, 36719, 36735, 36751, 36767, 36783, 36799, 36815, 36831, 36847, 36863, 36879, 36895, 36911, 36927, 36943, 36959, 36975, 36991, 37007, 37023, 37039, 37055, 37071, 37087, 37103, 37119, 37135, 37151, 37167, 37183, 37199, 37215, 37231, 37247, 37263, 37279, 37295, 37311, 37327, 37343, 37359, 37375, 37391, 37407, 37423, 37439, 37455, 37471, 37487, 37503, 37519, 37535, 37551, 37567, 37583, 37599, 37615, 37631, 37647, 37663, 37679, 37695, 37711, 37727, 37743, 37759, 37775, 37791, 37807, 37823, 37839, 37855, 37871, 37887, 37903, 37919, 37935, 37951, 37967, 37983, 37999, 38015, 38031, 38047, 38063, 38079, 38095, 38111, 38127, 38143, 38159, 38175, 38191, 38207, 38223, 38239, 38255, 38271, 38287, 38303, 38319, 38335, 38351, 38367, 38383, 38399, 38415, 38431, 38447, 38463, 38479, 38495, 38511, 38527, 38543, 38559, 38575, 38591, 38607, 38623, 38639, 38655, 38671, 38687, 38703, 38719, 38735, 38751, 38767, 38783, 38799, 38815, 38831, 38847, 38863, 38879, 38895, 38911, 38927, 38943, 38959, 38975, 38991, 39007, 39023, 39039, 39055, 39071, 39087, 39103, 39119, 39135, 39151, 39167, 39183, 39199, 39215, 39231, 39247, 39263, 39279, 39295, 39311, 39327, 39343, 39359, 39375, 39391, 39407, 39423, 39439, 39455, 39471, 39487, 39503, 39519, 39535, 39551, 39567, 39583, 39599, 39615, 39631, 39647, 39663, 39679, 39695, 39711, 39727, 39743, 39759, 39775, 39791, 39807, 39823, 39839, 39855, 39871, 39887, 39903, 39919, 39935, 39951, 39967, 39983, 39999, 40015, 40031, 40047, 40063, 40079, 40095, 40111, 40127, 40143, 40159, 40175, 40191, 40207, 40223, 40239, 40255, 40271, 40287, 40303, 40319, 40335, 40351, 40367, 40383, 40399, 40415, 40431, 40447, 40463, 40479, 40495, 40511, 40527, 40543, 40559, 40575, 40591, 40607, 40623, 40639, 40655, 40671, 40687, 40703, 40719, 40735, 40751, 40767, 40783, 40799, 40815, 40831, 40847, 40863, 40879, 40895, 40911, 40927, 40943, 40959, 40975, 40991, 41007, 41023, 41039, 41055, 41071, 41087, 41103, 41119, 41135, 41151, 41167, 41183, 41199, 41215, 41231, 41247, 41263, 41279, 41295, 41311, 41327, 41343, 41359, 41375, 41391, 41407, 41423, 41439, 41455, 41471, 41487, 41503, 41519, 41535, 41551, 41567, 41583, 41599, 41615, 41631, 41647, 41663, 41679, 41695, 41711, 41727, 41743, 41759, 41775, 41791, 41807, 41823, 41839, 41855, 41871, 41887, 41903, 41919, 41935, 41951, 41967, 41983, 41999, 42015, 42031, 42047, 42063, 42079, 42095, 42111, 42127, 42143, 42159, 42175, 42191, 42207, 42223, 42239, 42255, 42271, 42287, 42303, 42319, 42335, 42351, 42367, 42383, 42399, 42415, 42431, 42447, 42463, 42479, 42495, 42511, 42527, 42543, 42559, 42575, 42591, 42607, 42623, 42639, 42655, 42671, 42687, 42703, 42719, 42735, 42751, 42767, 42783, 42799, 42815, 42831, 42847, 42863, 42879, 42895, 42911, 42927, 42943, 42959, 42975, 42991, 43007, 43023, 43039, 43055, 43071, 43087, 43103, 43119, 43135, 43151, 43167, 43183, 43199, 43215, 43231, 43247, 43263, 43279, 43295, 43311, 43327, 43343, 43359, 43375, 43391, 43407, 43423, 43439, 43455, 43471, 43487, 43503, 43519, 43535, 43551, 43567, 43583, 43599, 43615, 43631, 43647, 43663, 43679, 43695, 43711, 43727, 43743, 43759, 43775, 43791, 43807, 43823, 43839, 43855, 43871, 43887, 43903, 43919, 43935, 43951, 43967, 43983, 43999, 44015, 44031, 44047, 44063, 44079, 44095, 44111, 44127, 44143, 44159, 44175, 44191, 44207, 44223, 44239, 44255, 44271, 44287, 44303, 44319, 44335, 44351, 44367, 44383, 44399, 44415, 44431, 44447, 44463, 44479, 44495, 44511, 44527, 44543, 44559, 44575, 44591, 44607, 44623, 44639, 44655, 44671, 44687, 44703, 44719, 44735, 44751, 44767, 44783, 44799, 44815, 44831, 44847, 44863, 44879, 44895, 44911, 44927, 44943, 44959, 44975, 44991, 45007, 45023, 45039, 45055, 45071, 45087, 45103, 45119, 45135, 45151, 45167, 45183, 45199, 45215, 45231, 45247, 45263, 45279, 45295, 45311, 45327, 45343, 45359, 45375, 45391, 45407, 45423, 45439, 45455, 45471, 45487, 45503, 45519, 45535, 45551, 45567, 45583, 45599, 45615, 45631, 45647, 45663, 45679, 45695, 45711, 45727, 45743, 45759, 45775, 45791, 45807, 45823, 45839, 45855, 45871, 45887, 45903, 45919, 45935, 45951, 45967, 45983, 45999, 46015, 46031, 46047, 46063, 46079, 46095, 46111, 46127, 46143, 46159, 46175, 46191, 46207, 46223, 46239, 46255, 46271, 46287, 46303, 46319, 46335, 46351, 46367, 46383, 46399, 46415, 46431, 46447, 46463, 46479, 46495, 46511, 46527, 46543, 46559, 46575, 46591, 46607, 46623, 46639, 46655, 46671, 46687, 46703, 46719, 46735, 46751, 46767, 46783, 46799, 46815, 46831, 46847, 46863, 46879, 46895, 46911, 46927, 46943, 46959, 46975, 46991, 47007, 47023, 47039, 47055, 47071, 47087, 47103, 47119, 47135, 47151, 47167, 47183, 47199, 47215, 47231, 47247, 47263, 47279, 47295, 47311, 47327, 47343, 47359, 47375, 47391, 47407, 47423, 47439, 47455, 47471, 47487, 47503, 47519, 47535, 47551, 47567, 47583, 47599, 47615, 47631, 47647, 47663, 47679, 47695, 47711, 47727, 47743, 47759, 47775, 47791, 47807, 47823, 47839, 47855, 47871, 47887, 47903, 47919, 47935, 47951, 47967, 47983, 47999, 48015, 48031, 48047, 48063, 48079, 48095, 48111, 48127, 48143, 48159, 48175, 48191, 48207, 48223, 48239, 48255, 48271, 48287, 48303, 48319, 48335, 48351, 48367, 48383, 48399, 48415, 48431, 48447, 48463, 48479, 48495, 48511, 48527, 48543, 48559, 48575, 48591, 48607, 48623, 48639, 48655, 48671, 48687, 48703, 48719, 48735, 48751, 48767, 48783, 48799, 48815, 48831, 48847, 48863, 48879, 48895, 48911, 48927, 48943, 48959, 48975, 48991, 49007, 49023, 49039, 49055, 49071, 49087, 49103, 49119, 49135, 49151, 49167, 49183, 49199, 49215, 49231, 49247, 49263, 49279, 49295, 49311, 49327, 49343, 49359, 49375, 49391, 49407, 49423, 49439, 49455, 49471, 49487, 49503, 49519, 49535, 49551, 49567, 49583, 49599, 49615, 49631, 49647, 49663, 49679, 49695, 49711, 49727, 49743, 49759, 49775, 49791, 49807, 49823, 49839, 49855, 49871, 49887, 49903, 49919, 49935, 49951, 49967, 49983, 49999, 50015, 50031, 50047, 50063, 50079, 50095, 50111, 50127, 50143, 50159, 50175, 50191, 50207, 50223, 50239, 50255, 50271, 50287, 50303, 50319, 50335, 50351, 50367, 50383, 50399, 50415, 50431, 50447, 50463, 50479, 50495, 50511, 50527, 50543, 50559, 50575, 50591, 50607, 50623, 50639, 50655, 50671, 50687, 50703, 50719, 50735, 50751, 50767, 50783, 50799, 50815, 50831, 50847, 50863, 50879, 50895, 50911, 50927, 50943, 50959, 50975, 50991, 51007, 51023, 51039, 51055, 51071, 51087, 51103, 51119, 51135, 51151, 51167, 51183, 51199, 51215, 51231, 51247, 51263, 51279, 51295, 51311, 51327, 51343, 51359, 51375, 51391, 51407, 51423, 51439, 51455, 51471, 51487, 51503, 51519, 51535, 51551, 51567, 51583, 51599, 51615, 51631, 51647, 51663, 51679, 51695, 51711, 51727, 51743, 51759, 51775, 51791, 51807, 51823, 51839, 51855, 51871, 51887, 51903, 51919, 51935, 51951, 51967, 51983, 51999, 52015, 52031, 52047, 52063, 52079, 52095, 52111, 52127, 52143, 52159, 52175, 52191, 52207, 52223, 52239, 52255, 52271, 52287, 52303, 52319, 52335, 52351, 52367, 52383, 52399, 52415, 52431, 52447, 52463, 52479, 52495, 52511, 52527, 52543, 52559, 52575, 52591, 52607, 52623, 52639, 52655, 52671, 52687, 52703, 52719, 52735, 52751, 52767, 52783, 52799, 52815, 52831, 52847, 52863, 52879, 52895, 52911, 52927, 52943, 52959, 52975, 52991, 53007, 53023, 53039, 53055, 53071, 53087, 53103, 53119, 53135, 53151, 53167, 53183, 53199, 53215, 53231, 53247, 53263, 53279, 53295, 53311, 53327, 53343, 53359, 53375, 53391, 53407, 53423, 53439, 53455, 53471, 53487, 53503, 53519, 53535, 53551, 53567, 53583, 53599, 53615, 53631, 53647, 53663, 53679, 53695, 53711, 53727, 53743, 53759, 53775, 53791, 53807, 53823, 53839, 53855, 53871, 53887, 53903, 53919, 53935, 53951, 53967, 53983, 53999, 54015, 54031, 54047, 54063, 54079, 54095, 54111, 54127, 54143, 54159, 54175, 54191, 54207, 54223, 54239, 54255, 54271, 54287, 54303, 54319, 54335, 54351, 54367, 54383, 54399, 54415, 54431, 54447, 54463, 54479, 54495, 54511, 54527, 54543, 54559, 54575, 54591, 54607, 54623, 54639, 54655, 54671, 54687, 54703, 54719, 54735, 54751, 54767, 54783, 54799, 54815, 54831, 54847, 54863, 54879, 54895, 54911, 54927, 54943, 54959, 54975, 54991, 55007, 55023, 55039, 55055, 55071, 55087, 55103, 55119, 55135, 55151, 55167, 55183, 55199, 55215, 55231, 55247, 55263, 55279, 55295, 55311, 55327, 55343, 55359, 55375, 55391, 55407, 55423, 55439, 55455, 55471, 55487, 55503, 55519, 55535, 55551, 55567, 55583, 55599, 55615, 55631, 55647, 55663, 55679, 55695, 55711, 55727, 55743, 55759, 55775, 55791, 55807, 55823, 55839, 55855, 55871, 55887, 55903, 55919, 55935, 55951, 55967, 55983, 55999, 56015, 56031, 56047, 56063, 56079, 56095, 56111, 56127, 56143, 56159, 56175, 56191, 56207, 56223, 56239, 56255, 56271, 56287, 56303, 56319, 56335, 56351, 56367, 56383, 56399, 56415, 56431, 56447, 56463, 56479, 56495, 56511, 56527, 56543, 56559, 56575, 56591, 56607, 56623, 56639, 56655, 56671, 56687, 56703, 56719, 56735, 56751, 56767, 56783, 56799, 56815, 56831, 56847, 56863, 56879, 56895, 56911, 56927, 56943, 56959, 56975, 56991, 57007, 57023, 57039, 57055, 57071, 57087, 57103, 57119, 57135, 57151, 57167, 57183, 57199, 57215, 57231, 57247, 57263, 57279, 57295, 57311, 57327, 57343, 57359, 57375, 57391, 57407, 57423, 57439, 57455, 57471, 57487, 57503, 57519, 57535, 57551, 57567, 57583, 57599, 57615, 57631, 57647, 57663, 57679, 57695, 57711, 57727, 57743, 57759, 57775, 57791, 57807, 57823, 57839, 57855, 57871, 57887, 57903, 57919, 57935, 57951, 57967, 57983, 57999, 58015, 58031, 58047, 58063, 58079, 58095, 58111, 58127, 58143, 58159, 58175, 58191, 58207, 58223, 58239, 58255, 58271, 58287, 58303, 58319, 58335, 58351, 58367, 58383, 58399, 58415, 58431, 58447, 58463, 58479, 58495, 58511, 58527, 58543, 58559, 58575, 58591, 58607, 58623, 58639, 58655, 58671, 58687, 58703, 58719, 58735, 58751, 58767, 58783, 58799, 58815, 58831, 58847, 58863, 58879, 58895, 58911, 58927, 58943, 58959, 58975, 58991, 59007, 59023, 59039, 59055, 59071, 59087, 59103, 59119, 59135, 59151, 59167, 59183, 59199, 59215, 59231, 59247, 59263, 59279, 59295, 59311, 59327, 59343, 59359, 59375, 59391, 59407, 59423, 59439, 59455, 59471, 59487, 59503, 59519, 59535, 59551, 59567, 59583, 59599, 59615, 59631, 59647, 59663, 59679, 59695, 59711, 59727, 59743, 59759, 59775, 59791, 59807, 59823, 59839, 59855, 59871, 59887, 59903, 59919, 59935, 59951, 59967, 59983, 59999, 60015, 60031, 60047, 60063, 60079, 60095, 60111, 60127, 60143, 60159, 60175, 60191, 60207, 60223, 60239, 60255, 60271, 60287, 60303, 60319, 60335, 60351, 60367, 60383, 60399, 60415, 60431, 60447, 60463, 60479, 60495, 60511, 60527, 60543, 60559, 60575, 60591, 60607, 60623, 60639, 60655, 60671, 60687, 60703, 60719, 60735, 60751, 60767, 60783, 60799, 60815, 60831, 60847, 60863, 60879, 60895, 60911, 60927, 60943, 60959, 60975, 60991, 61007, 61023, 61039, 61055, 61071, 61087, 61103, 61119, 61135, 61151, 61167, 61183, 61199, 61215, 61231, 61247, 61263, 61279, 61295, 61311, 61327, 61343, 61359, 61375, 61391, 61407, 61423, 61439, 61455, 61471, 61487, 61503, 61519, 61535, 61551, 61567, 61583, 61599, 61615, 61631, 61647, 61663, 61679, 61695, 61711, 61727, 61743, 61759, 61775, 61791, 61807, 61823, 61839, 61855, 61871, 61887, 61903, 61919, 61935, 61951, 61967, 61983, 61999, 62015, 62031, 62047, 62063, 62079, 62095, 62111, 62127, 62143, 62159, 62175, 62191, 62207, 62223, 62239, 62255, 62271, 62287, 62303, 62319, 62335, 62351, 62367, 62383, 62399, 62415, 62431, 62447, 62463, 62479, 62495, 62511, 62527, 62543, 62559, 62575, 62591, 62607, 62623, 62639, 62655, 62671, 62687, 62703, 62719, 62735, 62751, 62767, 62783, 62799, 62815, 62831, 62847, 62863, 62879, 62895, 62911, 62927, 62943, 62959, 62975, 62991, 63007, 63023, 63039, 63055, 63071, 63087, 63103, 63119, 63135, 63151, 63167, 63183, 63199, 63215, 63231, 63247, 63263, 63279, 63295, 63311, 63327, 63343, 63359, 63375, 63391, 63407, 63423, 63439, 63455, 63471, 63487, 63503, 63519, 63535, 63551, 63567, 63583, 63599, 63615, 63631, 63647, 63663, 63679, 63695, 63711, 63727, 63743, 63759, 63775, 63791, 63807, 63823, 63839, 63855, 63871, 63887, 63903, 63919, 63935, 63951, 63967, 63983, 63999, 64015, 64031, 64047, 64063, 64079, 64095, 64111, 64127, 64143, 64159, 64175, 64191, 64207, 64223, 64239, 64255, 64271, 64287, 64303, 64319, 64335, 64351, 64367, 64383, 64399, 64415, 64431, 64447, 64463, 64479, 64495, 64511, 64527, 64543, 64559, 64575, 64591, 64607, 64623, 64639, 64655, 64671, 64687, 64703, 64719, 64735, 64751, 64767, 64783, 64799, 64815, 64831, 64847, 64863, 64879, 64895, 64911, 64927, 64943, 64959, 64975, 64991, 65007, 65023, 65039, 65055, 65071, 65087, 65103, 65119, 65135, 65151, 65167, 65183, 65199, 65215, 65231, 65247, 65263, 65279, 65295, 65311, 65327, 65343, 65359, 65375, 65391, 65407, 65423, 65439, 65455, 65471, 65487, 65503, 65519, 65535};
-	static constexpr int32_t sigmoidSlope[4097] = {0, 2, 4, 7, 9, 11, 14, 16, 18, 21, 23, 26, 28, 30, 33, 35, 38, 40, 42, 45, 47, 50, 52, 55, 57, 60, 62, 64, 67, 69, 72, 74, 77, 79, 82, 84, 87, 89, 92, 94, 97, 99, 102, 105, 107, 110, 112, 115, 117, 120, 122, 125, 128, 130, 133, 135, 138, 141, 143, 146, 148, 151, 154, 156, 159, 162, 164, 167, 170, 172, 175, 178, 180, 183, 186, 188, 191, 194, 197, 199, 202, 205, 207, 210, 213, 216, 218, 221, 224, 227, 229, 232, 235, 238, 241, 243, 246, 249, 252, 255, 257, 260, 263, 266, 269, 272, 275, 277, 280, 283, 286, 289, 292, 295, 298, 301, 303, 306, 309, 312, 315, 318, 321, 324, 327, 330, 333, 336, 339, 342, 345, 348, 351, 354, 357, 360, 363, 366, 369, 372, 375, 378, 381, 384, 387, 390, 393, 396, 400, 403, 406, 409, 412, 415, 418, 421, 424, 428, 431, 434, 437, 440, 443, 447, 450, 453, 456, 459, 463, 466, 469, 472, 475, 479, 482, 485, 488, 492, 495, 498, 502, 505, 508, 511, 515, 518, 521, 525, 528, 531, 535, 538, 541, 545, 548, 551, 555, 558, 562, 565, 568, 572, 575, 579, 582, 586, 589, 592, 596, 599, 603, 606, 610, 613, 617, 620, 624, 627, 631, 634, 638, 641, 645, 648, 652, 656, 659, 663, 666, 670, 674, 677, 681, 684, 688, 692, 695, 699, 703, 706, 710, 714, 717, 721, 725, 728, 732, 736, 739, 743, 747, 751, 754, 758, 762, 766, 769, 773, 777, 781, 785, 788, 792, 796, 800, 804, 808, 811, 815, 819, 823, 827, 831, 835, 839, 842, 846, 850, 854, 858, 862, 866, 870, 874, 878, 882, 886, 890, 894, 898, 902, 906, 910, 914, 918, 922, 926, 930, 934, 938, 943, 947, 951, 955, 959, 963, 967, 971, 976, 980, 984, 988, 992, 996, 1001, 1005, 1009, 1013, 1018, 1022, 1026, 1030, 1034, 1039, 1043, 1047, 1052, 1056, 1060, 1065, 1069, 1073, 1078, 1082, 1086, 1091, 1095, 1099, 1104, 1108, 1113, 1117, 1121, 1126, 1130, 1135, 1139, 1144, 1148, 1152, 1157, 1161, 1166, 1170, 1175, 1179, 1184, 1189, 1193, 1198, 1202, 1207, 1211, 1216, 1221, 1225, 1230, 1234, 1239, 1244, 1248, 1253, 1258, 1262, 1267, 1272, 1276, 1281, 1286, 1291, 1295, 1300, 1305, 1310, 1314, 1319, 1324, 1329, 1333, 1338, 1343, 1348, 1353, 1358, 1362, 1367, 1372, 1377, 1382, 1387, 1392, 1397, 1402, 1407, 1411, 1416, 1421, 1426, 1431, 1436, 1441, 1446, 1451, 1456, 1461, 1466, 1471, 1477, 1482, 1487, 1492, 1497, 1502, 1507, 1512, 1517, 1522, 1528, 1533, 1538, 1543, 1548, 1553, 1559, 1564, 1569, 1574, 1580, 1585, 1590, 1595, 1601, 1606, 1611, 1617, 1622, 1627, 1633, 1638, 1643, 1649, 1654, 1659, 1665, 1670, 1676, 1681, 1686, 1692, 1697, 1703, 1708, 1714, 1719, 1725, 1730, 1736, 1741, 1747, 1752, 1758, 1764, 1769, 1775, 1780, 1786, 1792, 1797, 1803, 1809, 1814, 1820, 1826, 1831, 1837, 1843, 1848, 1854, 1860, 1866, 1871, 1877, 1883, 1889, 1895, 1900, 1906, 1912, 1918, 1924, 1930, 1935, 1941, 1947, 1953, 1959, 1965, 1971, 1977, 1983, 1989, 1995, 2001, 2007, 2013, 2019, 2025, 2031, 2037, 2043, 2049, 2055, 2061, 2067, 2074, 2080, 2086, 2092, 2098, 2104, 2111, 2117, 2123, 2129, 2135, 2142, 2148, 2154, 2160, 2167, 2173, 2179, 2186, 2192, 2198, 2205, 2211, 2217, 2224, 2230, 2237, 2243, 2249, 2256, 2262, 2269, 2275, 2282, 2288, 2295, 2301, 2308, 2314, 2321, 2327, 2334, 2341, 2347, 2354, 2360, 2367, 2374, 2380, 2387, 2394, 2400, 2407, 2414, 2421, 2427, 2434, 2441, 2448, 2454, 2461, 2468, 2475, 2482, 2489, 2495, 2502, 2509, 2516, 2523, 2530, 2537, 2544, 2551, 2558, 2565, 2572, 2579, 2586, 2593, 2600, 2607, 2614, 2621, 2628, 2635, 2642, 2649, 2657, 2664, 2671, 2678, 2685, 2692, 2700, 2707, 2714, 2721, 2729, 2736, 2743, 2750, 2758, 2765, 2772, 2780, 2787, 2795, 2802, 2809, 2817, 2824, 2832, 2839, 2847, 2854, 2862, 2869, 2877, 2884, 2892, 2899, 2907, 2914, 2922, 2930, 2937, 2945, 2952, 2960, 2968, 2975, 2983, 2991, 2999, 3006, 3014, 3022, 3030, 3037, 3045, 3053, 3061, 3069, 3077, 3084, 3092, 3100, 3108, 3116, 3124, 3132, 3140, 3148, 3156, 3164, 3172, 3180, 3188, 3196, 3204, 3212, 3220, 3229, 3237, 3245, 3253, 3261, 3269, 3278, 3286, 3294, 3302, 3310, 3319, 3327, 3335, 3344, 3352, 3360, 3369, 3377, 3385, 3394, 3402, 3411, 3419, 3428, 3436, 3444, 3453, 3461, 3470, 3479, 3487, 3496, 3504, 3513, 3521, 3530, 3539, 3547, 3556, 3565, 3573, 3582, 3591, 3600, 3608, 3617, 3626, 3635, 3644, 3652, 3661, 3670, 3679, 3688, 3697, 3706, 3715, 3724, 3733, 3742, 3751, 3760, 3769, 3778, 3787, 3796, 3805, 3814, 3823, 3832, 3841, 3851, 3860, 3869, 3878, 3887, 3897, 3906, 3915, 3924, 3934, 3943, 3952, 3962, 3971, 3980, 3990, 3999, 4009, 4018, 4028, 4037, 4046, 4056, 4065, 4075, 4085, 4094, 4104, 4113, 4123, 4133, 4142, 4152, 4162, 4171, 4181, 4191, 4200, 4210, 4220, 4230, 4240, 4249, 4259, 4269, 4279, 4289, 4299, 4309, 4319, 4328, 4338, 4348, 4358, 4368, 4378, 4389, 4399, 4409, 4419, 4429, 4439, 4449, 4459, 4469, 4480, 4490, 4500, 4510, 4521, 4531, 4541, 4552, 4562, 4572, 4583, 4593, 4603, 4614, 4624, 4635, 4645, 4656, 4666, 4677, 4687, 4698, 4708, 4719, 4729, 4740, 4751, 4761, 4772, 4783, 4793, 4804, 4815, 4826, 4836, 4847, 4858, 4869, 4880, 4890, 4901, 4912, 4923, 4934, 4945, 4956, 4967, 4978, 4989, 5000, 5011, 5022, 5033, 5044, 5055, 5067, 5078, 5089, 5100, 5111, 5123, 5134, 5145, 5156, 5168, 5179, 5190, 5202, 5213, 5224, 5236, 5247, 5259, 5270, 5282, 5293, 5305, 5316, 5328, 5339, 5351, 5362, 5374, 5386, 5397, 5409, 5421, 5433, 5444, 5456, 5468, 5480, 5491, 5503, 5515, 5527, 5539, 5551, 5563, 5575, 5587, 5599, 5611, 5623, 5635, 5647, 5659, 5671, 5683, 5695, 5707, 5719, 5732, 5744, 5756, 5768, 5780, 5793, 5805, 5817, 5830, 5842, 5854, 5867, 5879, 5892, 5904, 5917, 5929, 5942, 5954, 5967, 5979, 5992, 6004, 6017, 6030, 6042, 6055, 6068, 6080, 6093, 6106, 6119, 6132, 6144, 6157, 6170, 6183, 6196, 6209, 6222, 6235, 6248, 6261, 6274, 6287, 6300, 6313, 6326, 6339, 6352, 6365, 6378, 6392, 6405, 6418, 6431, 6445, 6458, 6471, 6485, 6498, 6511, 6525, 6538, 6552, 6565, 6579, 6592, 6606, 6619, 6633, 6646, 6660, 6673, 6687, 6701, 6714, 6728, 6742, 6756, 6769, 6783, 6797, 6811, 6825, 6839, 6852, 6866, 6880, 6894, 6908, 6922, 6936, 6950, 6964, 6978, 6992, 7007, 7021, 7035, 7049, 7063, 7077, 7092, 7106, 7120, 7135, 7149, 7163, 7178, 7192, 7206, 7221, 7235, 7250, 7264, 7279, 7293, 7308, 7322, 7337, 7352, 7366, 7381, 7396, 7410, 7425, 7440, 7455, 7469, 7484, 7499, 7514, 7529, 7544, 7559, 7574, 7589, 7604, 7619, 7634, 7649, 7664, 7679, 7694, 7709, 7724, 7739, 7755, 7770, 7785, 7800, 7816, 7831, 7846, 7862, 7877, 7893, 7908, 7923, 7939, 7954, 7970, 7985, 8001, 8017, 8032, 8048, 8063, 8079, 8095, 8111, 8126, 8142, 8158, 8174, 8189, 8205, 8221, 8237, 8253, 8269, 8285, 8301, 8317, 8333, 8349, 8365, 8381, 8397, 8413, 8430, 8446, 8462, 8478, 8494, 8511, 8527, 8543, 8560, 8576, 8592, 8609, 8625, 8642, 8658, 8675, 8691, 8708, 8724, 8741, 8758, 8774, 8791, 8808, 8824, 8841, 8858, 8875, 8891, 8908, 8925, 8942, 8959, 8976, 8993, 9010, 9027, 9044, 9061, 9078, 9095, 9112, 9129, 9146, 9163, 9181, 9198, 9215, 9232, 9250, 9267, 9284, 9302, 9319, 9336, 9354, 9371, 9389, 9406, 9424, 9441, 9459, 9477, 9494, 9512, 9530, 9547, 9565, 9583, 9600, 9618, 9636, 9654, 9672, 9690, 9708, 9725, 9743, 9761, 9779, 9797, 9815, 9834, 9852, 9870, 9888, 9906, 9924, 9942, 9961, 9979, 9997, 10016, 10034, 10052, 10071, 10089, 10107, 10126, 10144, 10163, 10181, 10200, 10219, 10237, 10256, 10274, 10293, 10312, 10330, 10349, 10368, 10387, 10406, 10424, 10443, 10462, 10481, 10500, 10519, 10538, 10557, 10576, 10595, 10614, 10633, 10652, 10672, 10691, 10710, 10729, 10748, 10768, 10787, 10806, 10826, 10845, 10864, 10884, 10903, 10923, 10942, 10962, 10981, 11001, 11021, 11040, 11060, 11079, 11099, 11119, 11139, 11158, 11178, 11198, 11218, 11238, 11258, 11277, 11297, 11317, 11337, 11357, 11377, 11397, 11418, 11438, 11458, 11478, 11498, 11518, 11539, 11559, 11579, 11599, 11620, 11640, 11661, 11681, 11701, 11722, 11742, 11763, 11783, 11804, 11824, 11845, 11866, 11886, 11907, 11928, 11948, 11969, 11990, 12011, 12032, 12052, 12073, 12094, 12115, 12136, 12157, 12178, 12199, 12220, 12241, 12262, 12284, 12305, 12326, 12347, 12368, 12390, 12411, 12432, 12453, 12475, 12496, 12518, 12539, 12560, 12582, 12603, 12625, 12646, 12668, 12690, 12711, 12733, 12755, 12776, 12798, 12820, 12842, 12863, 12885, 12907, 12929, 12951, 12973, 12995, 13017, 13039, 13061, 13083, 13105, 13127, 13149, 13171, 13193, 13216, 13238, 13260, 13282, 13305, 13327, 13349, 13372, 13394, 13416, 13439, 13461, 13484, 13506, 13529, 13551, 13574, 13597, 13619, 13642, 13665, 13687, 13710, 13733, 13756, 13779, 13801, 13824, 13847, 13870, 13893, 13916, 13939, 13962, 13985, 14008, 14031, 14054, 14078, 14101, 14124, 14147, 14170, 14194, 14217, 14240, 14264, 14287, 14310, 14334, 14357, 14381, 14404, 14428, 14451, 14475, 14498, 14522, 14546, 14569, 14593, 14617, 14640, 14664, 14688, 14712, 14736, 14760, 14783, 14807, 14831, 14855, 14879, 14903, 14927, 14951, 14975, 15000, 15024, 15048, 15072, 15096, 15120, 15145, 15169, 15193, 15218, 15242, 15266, 15291, 15315, 15340, 15364, 15389, 15413, 15438, 15462, 15487, 15512, 15536, 15561, 15586, 15610, 15635, 15660, 15685, 15709, 15734, 15759, 15784, 15809, 15834, 15859, 15884, 15909, 15934, 15959, 15984, 16009, 16034, 16060, 16085, 16110, 16135, 16160, 16186, 16211, 16236, 16262, 16287, 16312, 16338, 16363, 16389, 16414, 16440, 16465, 16491, 16517, 16542, 16568, 16593, 16619, 16645, 16671, 16696, 16722, 16748, 16774, 16800, 16826, 16851, 16877, 16903, 16929, 16955, 16981, 17007, 17033, 17060, 17086, 17112, 17138, 17164, 17190, 17217, 17243, 17269, 17295, 17322, 17348, 17374, 17401, 17427, 17454, 17480, 17507, 17533, 17560, 17586, 17613, 17640, 17666, 17693, 17719, 17746, 17773, 17800, 17826, 17853, 17880, 17907, 17934, 17961, 17988, 18014, 18041, 18068, 18095, 18122, 18149, 18176, 18204, 18231, 18258, 18285, 18312, 18339, 18367, 18394, 18421, 18448, 18476, 18503, 18530, 18558, 18585, 18613, 18640, 18668, 18695, 18723, 18750, 18778, 18805, 18833, 18860, 18888, 18916, 18943, 18971, 18999, 19027, 19054, 19082, 19110, 19138, 19166, 19194, 19222, 19250, 19277, 19305, 19333, 19361, 19390, 19418, 19446, 19474, 19502, 19530, 19558, 19586, 19615, 19643, 19671, 19699, 19728, 19756, 19784, 19813, 19841, 19869, 19898, 19926, 19955, 19983, 20012, 20040, 20069, 20097, 20126, 20155, 20183, 20212, 20241, 20269, 20298, 20327, 20356, 20384, 20413, 20442, 20471, 20500, 20529, 20557, 20586, 20615, 20644, 20673, 20702, 20731, 20760, 20789, 20818, 20848, 20877, 20906, 20935, 20964, 20993, 21023, 21052, 21081, 21110, 21140, 21169, 21198, 21228, 21257, 21286, 21316, 21345, 21375, 21404, 21434, 21463, 21493, 21522, 21552, 21581, 21611, 21641, 21670, 21700, 21730, 21759, 21789, 21819, 21849, 21878, 21908, 21938, 21968, 21998, 22028, 22057, 22087, 22117, 22147, 22177, 22207, 22237, 22267, 22297, 22327, 22357, 22387, 22418, 22448, 22478, 22508, 22538, 22568, 22599, 22629, 22659, 22689, 22720, 22750, 22780, 22811, 22841, 22871, 22902, 22932, 22963, 22993, 23023, 23054, 23084, 23115, 23145, 23176, 23207, 23237, 23268, 23298, 23329, 23360, 23390, 23421, 23452, 23482, 23513, 23544, 23575, 23605, 23636, 23667, 23698, 23729, 23759, 23790, 23821, 23852, 23883, 23914, 23945, 23976, 24007, 24038, 24069, 24100, 24131, 24162, 24193, 24224, 24255, 24286, 24317, 24349, 24380, 24411, 24442, 24473, 24505, 24536, 24567, 24598, 24630, 24661, 24692, 24724, 24755, 24786, 24818, 24849, 24880, 24912, 24943, 24975, 25006, 25038, 25069, 25101, 25132, 25164, 25195, 25227, 25258, 25290, 25322, 25353, 25385, 25416, 25448, 25480, 25511, 25543, 25575, 25606, 25638, 25670, 25702, 25733, 25765, 25797, 25829, 25861, 25892, 25924, 25956, 25988, 26020, 26052, 26084, 26116, 26148, 26179, 26211, 26243, 26275, 26307, 26339, 26371, 26403, 26435, 26467, 26500, 26532, 26564, 26596, 26628, 26660, 26692, 26724, 26756, 26789, 26821, 26853, 26885, 26917, 26950, 26982, 27014, 27046, 27079, 27111, 27143, 27175, 27208, 27240, 27272, 27305, 27337, 27369, 27402, 27434, 27466, 27499, 27531, 27564, 27596, 27628, 27661, 27693, 27726, 27758, 27791, 27823, 27856, 27888, 27921, 27953, 27986, 28018, 28051, 28083, 28116, 28149, 28181, 28214, 28246, 28279, 28312, 28344, 28377, 28410, 28442, 28475, 28508, 28540, 28573, 28606, 28638, 28671, 28704, 28736, 28769, 28802, 28835, 28867, 28900, 28933, 28966, 28998, 29031, 29064, 29097, 29130, 29163, 29195, 29228, 29261, 29294, 29327, 29360, 29392, 29425, 29458, 29491, 29524, 29557, 29590, 29623, 29656, 29688, 29721, 29754, 29787, 29820, 29853, 29886, 29919, 29952, 29985, 30018, 30051, 30084, 30117, 30150, 30183, 30216, 30249, 30282, 30315, 30348, 30381, 30414, 30447, 30480, 30513, 30546, 30579, 30612, 30645, 30678, 30712, 30745, 30778, 30811, 30844, 30877, 30910, 30943, 30976, 31009, 31042, 31076, 31109, 31142, 31175, 31208, 31241, 31274, 31307, 31341, 31374, 31407, 31440, 31473, 31506, 31539, 31573, 31606, 31639, 31672, 31705, 31738, 31771, 31805, 31838, 31871, 31904, 31937, 31971, 32004, 32037, 32070, 32103, 32136, 32170, 32203, 32236, 32269, 32302, 32336, 32369, 32402, 32435, 32468, 32501, 32535, 32568, 32601, 32634, 32667, 32701, 32734, 32767, 32800, 32833, 32867, 32900, 32933, 32966, 32999, 33033, 33066, 33099, 33132, 33165, 33198, 33232, 33265, 33298, 33331, 33364, 33398, 33431, 33464, 33497, 33530, 33563, 33597, 33630, 33663, 33696, 33729, 33763, 33796, 33829, 33862, 33895, 33928, 33961, 33995, 34028, 34061, 34094, 34127, 34160, 34193, 34227, 34260, 34293, 34326, 34359, 34392, 34425, 34458, 34492, 34525, 34558, 34591, 34624, 34657, 34690, 34723, 34756, 34789, 34822, 34856, 34889, 34922, 34955, 34988, 35021, 35054, 35087, 35120, 35153, 35186, 35219, 35252, 35285, 35318, 35351, 35384, 35417, 35450, 35483, 35516, 35549, 35582, 35615, 35648, 35681, 35714, 35747, 35780, 35813, 35846, 35878, 35911, 35944, 35977, 36010, 36043, 36076, 36109, 36142, 36174, 36207, 36240, 36273, 36306, 36339, 36371, 36404, 36437, 36470, 36503, 36536, 36568, 36601, 36634, 36667, 36699, 36732, 36765, 36798, 36830, 36863, 36896, 36928, 36961, 36994, 37026, 37059, 37092, 37124, 37157, 37190, 37222, 37255, 37288, 37320, 37353, 37385, 37418, 37451, 37483, 37516, 37548, 37581, 37613, 37646, 37678, 37711, 37743, 37776, 37808, 37841, 37873, 37906, 37938, 37970, 38003, 38035, 38068, 38100, 38132, 38165, 38197, 38229, 38262, 38294, 38326, 38359, 38391, 38423, 38455, 38488, 38520, 38552, 38584, 38617, 38649, 38681, 38713, 38745, 38778, 38810, 38842, 38874, 38906, 38938, 38970, 39002, 39034, 39067, 39099, 39131, 39163, 39195, 39227, 39259, 39291, 39323, 39355, 39386, 39418, 39450, 39482, 39514, 39546, 39578, 39610, 39642, 39673, 39705, 39737, 39769, 39801, 39832, 39864, 39896, 39928, 39959, 39991, 40023, 40054, 40086, 40118, 40149, 40181, 40212, 40244, 40276, 40307, 40339, 40370, 40402, 40433, 40465, 40496, 40528, 40559, 40591, 40622, 40654, 40685, 40716, 40748, 40779, 40810, 40842, 40873, 40904, 40936, 40967, 40998, 41029, 41061, 41092, 41123, 41154, 41185, 41217, 41248, 41279, 41310, 41341, 41372, 41403, 41434, 41465, 41496, 41527, 41558, 41589, 41620, 41651, 41682, 41713, 41744, 41775, 41805, 41836, 41867, 41898, 41929, 41959, 41990, 42021, 42052, 42082, 42113, 42144, 42174, 42205, 42236, 42266, 42297, 42327, 42358, 42389, 42419, 42450, 42480, 42511, 42541, 42571, 42602, 42632, 42663, 42693, 42723, 42754, 42784, 42814, 42845, 42875, 42905, 42935, 42966, 42996, 43026, 43056, 43086, 43116, 43147, 43177, 43207, 43237, 43267, 43297, 43327, 43357, 43387, 43417, 43447, 43477, 43506, 43536, 43566, 43596, 43626, 43656, 43685, 43715, 43745, 43775, 43804, 43834, 43864, 43893, 43923, 43953, 43982, 44012, 44041, 44071, 44100, 44130, 44159, 44189, 44218, 44248, 44277, 44306, 44336, 44365, 44394, 44424, 44453, 44482, 44511, 44541, 44570, 44599, 44628, 44657, 44686, 44716, 44745, 44774, 44803, 44832, 44861, 44890, 44919, 44948, 44977, 45005, 45034, 45063, 45092, 45121, 45150, 45178, 45207, 45236, 45265, 45293, 45322, 45351, 45379, 45408, 45437, 45465, 45494, 45522, 45551, 45579, 45608, 45636, 45665, 45693, 45721, 45750, 45778, 45806, 45835, 45863, 45891, 45919, 45948, 45976, 46004, 46032, 46060, 46088, 46116, 46144, 46173, 46201, 46229, 46257, 46284, 46312, 46340, 46368, 46396, 46424, 46452, 46480, 46507, 46535, 46563, 46591, 46618, 46646, 46674, 46701, 46729, 46756, 46784, 46811, 46839, 46866, 46894, 46921, 46949, 46976, 47004, 47031, 47058, 47086, 47113, 47140, 47167, 47195, 47222, 47249, 47276, 47303, 47330, 47358, 47385, 47412, 47439, 47466, 47493, 47520, 47546, 47573, 47600, 47627, 47654, 47681, 47708, 47734, 47761, 47788, 47815, 47841, 47868, 47894, 47921, 47948, 47974, 48001, 48027, 48054, 48080, 48107, 48133, 48160, 48186, 48212, 48239, 48265, 48291, 48317, 48344, 48370, 48396, 48422, 48448, 48474, 48501, 48527, 48553, 48579, 48605, 48631, 48657, 48683, 48708, 48734, 48760, 48786, 48812, 48838, 48863, 48889, 48915, 48941, 48966, 48992, 49017, 49043, 49069, 49094, 49120, 49145, 49171, 49196, 49222, 49247, 49272, 49298, 49323, 49348, 49374, 49399, 49424, 49449, 49474, 49500, 49525, 49550, 49575, 49600, 49625, 49650, 49675, 49700, 49725, 49750, 49775, 49800, 49825, 49849, 49874, 49899, 49924, 49948, 49973, 49998, 50022, 50047, 50072, 50096, 50121, 50145, 50170, 50194, 50219, 50243, 50268, 50292, 50316, 50341, 50365, 50389, 50414, 50438, 50462, 50486, 50510, 50534, 50559, 50583, 50607, 50631, 50655, 50679, 50703, 50727, 50751, 50774, 50798, 50822, 50846, 50870, 50894, 50917, 50941, 50965, 50988, 51012, 51036, 51059, 51083, 51106, 51130, 51153, 51177, 51200, 51224, 51247, 51270, 51294, 51317, 51340, 51364, 51387, 51410, 51433, 51456, 51480, 51503, 51526, 51549, 51572, 51595, 51618, 51641, 51664, 51687, 51710, 51733, 51755, 51778, 51801, 51824, 51847, 51869, 51892, 51915, 51937, 51960, 51983, 52005, 52028, 52050, 52073, 52095, 52118, 52140, 52162, 52185, 52207, 52229, 52252, 52274, 52296, 52318, 52341, 52363, 52385, 52407, 52429, 52451, 52473, 52495, 52517, 52539, 52561, 52583, 52605, 52627, 52649, 52671, 52692, 52714, 52736, 52758, 52779, 52801, 52823, 52844, 52866, 52888, 52909, 52931, 52952, 52974, 52995, 53016, 53038, 53059, 53081, 53102, 53123, 53144, 53166, 53187, 53208, 53229, 53250, 53272, 53293, 53314, 53335, 53356, 53377, 53398, 53419, 53440, 53461, 53482, 53502, 53523, 53544, 53565, 53586, 53606, 53627, 53648, 53668, 53689, 53710, 53730, 53751, 53771, 53792, 53812, 53833, 53853, 53873, 53894, 53914, 53935, 53955, 53975, 53995, 54016, 54036, 54056, 54076, 54096, 54116, 54137, 54157, 54177, 54197, 54217, 54237, 54257, 54276, 54296, 54316, 54336, 54356, 54376, 54395, 54415, 54435, 54455, 54474, 54494, 54513, 54533, 54553, 54572, 54592, 54611, 54631, 54650, 54670, 54689, 54708, 54728, 54747, 54766, 54786, 54805, 54824, 54843, 54862, 54882, 54901, 54920, 54939, 54958, 54977, 54996, 55015, 55034, 55053, 55072, 55091, 55110, 55128, 55147, 55166, 55185, 55204, 55222, 55241, 55260, 55278, 55297, 55315, 55334, 55353, 55371, 55390, 55408, 55427, 55445, 55463, 55482, 55500, 55518, 55537, 55555, 55573, 55592, 55610, 55628, 55646, 55664, 55682, 55700, 55719, 55737, 55755, 55773, 55791, 55809, 55826, 55844, 55862, 55880, 55898, 55916, 55934, 55951, 55969, 55987, 56004, 56022, 56040, 56057, 56075, 56093, 56110, 56128, 56145, 56163, 56180, 56198, 56215, 56232, 56250, 56267, 56284, 56302, 56319, 56336, 56353, 56371, 56388, 56405, 56422, 56439, 56456, 56473, 56490, 56507, 56524, 56541, 56558, 56575, 56592, 56609, 56626, 56643, 56659, 56676, 56693, 56710, 56726, 56743, 56760, 56776, 56793, 56810, 56826, 56843, 56859, 56876, 56892, 56909, 56925, 56942, 56958, 56974, 56991, 57007, 57023, 57040, 57056, 57072, 57088, 57104, 57121, 57137, 57153, 57169, 57185, 57201, 57217, 57233, 57249, 57265, 57281, 57297, 57313, 57329, 57345, 57360, 57376, 57392, 57408, 57423, 57439, 57455, 57471, 57486, 57502, 57517, 57533, 57549, 57564, 57580, 57595, 57611, 57626, 57641, 57657, 57672, 57688, 57703, 57718, 57734, 57749, 57764, 57779, 57795, 57810, 57825, 57840, 57855, 57870, 57885, 57900, 57915, 57930, 57945, 57960, 57975, 57990, 58005, 58020, 58035, 58050, 58065, 58079, 58094, 58109, 58124, 58138, 58153, 58168, 58182, 58197, 58212, 58226, 58241, 58255, 58270, 58284, 58299, 58313, 58328, 58342, 58356, 58371, 58385, 58399, 58414, 58428, 58442, 58457, 58471, 58485, 58499, 58513, 58527, 58542, 58556, 58570, 58584, 58598, 58612, 58626, 58640, 58654, 58668, 58682, 58695, 58709, 58723, 58737, 58751, 58765, 58778, 58792, 58806, 58820, 58833, 58847, 58861, 58874, 58888, 58901, 58915, 58928, 58942, 58955, 58969, 58982, 58996, 59009, 59023, 59036, 59049, 59063, 59076, 59089, 59103, 59116, 59129, 59142, 59156, 59169, 59182, 59195, 59208, 59221, 59234, 59247, 59260, 59273, 59286, 59299, 59312, 59325, 59338, 59351, 59364, 59377, 59390, 59402, 59415, 59428, 59441, 59454, 59466, 59479, 59492, 59504, 59517, 59530, 59542, 59555, 59567, 59580, 59592, 59605, 59617, 59630, 59642, 59655, 59667, 59680, 59692, 59704, 59717, 59729, 59741, 59754, 59766, 59778, 59790, 59802, 59815, 59827, 59839, 59851, 59863, 59875, 59887, 59899, 59911, 59923, 59935, 59947, 59959, 59971, 59983, 59995, 60007, 60019, 60031, 60043, 60054, 60066, 60078, 60090, 60101, 60113, 60125, 60137, 60148, 60160, 60172, 60183, 60195, 60206, 60218, 60229, 60241, 60252, 60264, 60275, 60287, 60298, 60310, 60321, 60332, 60344, 60355, 60366, 60378, 60389, 60400, 60411, 60423, 60434, 60445, 60456, 60467, 60479, 60490, 60501, 60512, 60523, 60534, 60545, 60556, 60567, 60578, 60589, 60600, 60611, 60622, 60633, 60644, 60654, 60665, 60676, 60687, 60698, 60708, 60719, 60730, 60741, 60751, 60762, 60773, 60783, 60794, 60805, 60815, 60826, 60836, 60847, 60857, 60868, 60878, 60889, 60899, 60910, 60920, 60931, 60941, 60951, 60962, 60972, 60982, 60993, 61003, 61013, 61024, 61034, 61044, 61054, 61065, 61075, 61085, 61095, 61105, 61115, 61125, 61135, 61145, 61156, 61166, 61176, 61186, 61196, 61206, 61215, 61225, 61235, 61245, 61255, 61265, 61275, 61285, 61294, 61304, 61314, 61324, 61334, 61343, 61353, 61363, 61372, 61382, 61392, 61401, 61411, 61421, 61430, 61440, 61449, 61459, 61469, 61478, 61488, 61497, 61506, 61516, 61525, 61535, 61544, 61554, 61563, 61572, 61582, 61591, 61600, 61610, 61619, 61628, 61637, 61647, 61656, 61665, 61674, 61683, 61693, 61702, 61711, 61720, 61729, 61738, 61747, 61756, 61765, 61774, 61783, 61792, 61801, 61810, 61819, 61828, 61837, 61846, 61855, 61864, 61873, 61882, 61890, 61899, 61908, 61917, 61926, 61934, 61943, 61952, 61961, 61969, 61978, 61987, 61995, 62004, 62013, 62021, 62030, 62038, 62047, 62055, 62064, 62073, 62081, 62090, 62098, 62106, 62115, 62123, 62132, 62140, 62149, 62157, 62165, 62174, 62182, 62190, 62199, 62207, 62215, 62224, 62232, 62240, 62248, 62256, 62265, 62273, 62281, 62289, 62297, 62305, 62314, 62322, 62330, 62338, 62346, 62354, 62362, 62370, 62378, 62386, 62394, 62402, 62410, 62418, 62426, 62434, 62442, 62450, 62457, 62465, 62473, 62481, 62489, 62497, 62504, 62512, 62520, 62528, 62535, 62543, 62551, 62559, 62566, 62574, 62582, 62589, 62597, 62604, 62612, 62620, 62627, 62635, 62642, 62650, 62657, 62665, 62672, 62680, 62687, 62695, 62702, 62710, 62717, 62725, 62732, 62739, 62747, 62754, 62762, 62769, 62776, 62784, 62791, 62798, 62805, 62813, 62820, 62827, 62834, 62842, 62849, 62856, 62863, 62870, 62877, 62885, 62892, 62899, 62906, 62913, 62920, 62927, 62934, 62941, 62948, 62955, 62962, 62969, 62976, 62983, 62990, 62997, 63004, 63011, 63018, 63025, 63032, 63039, 63045, 63052, 63059, 63066, 63073, 63080, 63086, 63093, 63100, 63107, 63113, 63120, 63127, 63134, 63140, 63147, 63154, 63160, 63167, 63174, 63180, 63187, 63193, 63200, 63207, 63213, 63220, 63226, 63233, 63239, 63246, 63252, 63259, 63265, 63272, 63278, 63285, 63291, 63297, 63304, 63310, 63317, 63323, 63329, 63336, 63342, 63348, 63355, 63361, 63367, 63374, 63380, 63386, 63392, 63399, 63405, 63411, 63417, 63423, 63430, 63436, 63442, 63448, 63454, 63460, 63467, 63473, 63479, 63485, 63491, 63497, 63503, 63509, 63515, 63521, 63527, 63533, 63539, 63545, 63551, 63557, 63563, 63569, 63575, 63581, 63587, 63593, 63599, 63604, 63610, 63616, 63622, 63628, 63634, 63639, 63645, 63651, 63657, 63663, 63668, 63674, 63680, 63686, 63691, 63697, 63703, 63708, 63714, 63720, 63725, 63731, 63737, 63742, 63748, 63754, 63759, 63765, 63770, 63776, 63782, 63787, 63793, 63798, 63804, 63809, 63815, 63820, 63826, 63831, 63837, 63842, 63848, 63853, 63858, 63864, 63869, 63875, 63880, 63885, 63891, 63896, 63901, 63907, 63912, 63917, 63923, 63928, 63933, 63939, 63944, 63949, 63954, 63960, 63965, 63970, 63975, 63981, 63986, 63991, 63996, 64001, 64006, 64012, 64017, 64022, 64027, 64032, 64037, 64042, 64047, 64052, 64057, 64063, 64068, 64073, 64078, 64083, 64088, 64093, 64098, 64103, 64108, 64113, 64118, 64123, 64127, 64132, 64137, 64142, 64147, 64152, 64157, 64162, 64167, 64172, 64176, 64181, 64186, 64191, 64196, 64201, 64205, 64210, 64215, 64220, 64224, 64229, 64234, 64239, 64243, 64248, 64253, 64258, 64262, 64267, 64272, 64276, 64281, 64286, 64290, 64295, 64300, 64304, 64309, 64313, 64318, 64323, 64327, 64332, 64336, 64341, 64345, 64350, 64355, 64359, 64364, 64368, 64373, 64377, 64382, 64386, 64390, 64395, 64399, 64404, 64408, 64413, 64417, 64421, 64426, 64430, 64435, 64439, 64443, 64448, 64452, 64456, 64461, 64465, 64469, 64474, 64478, 64482, 64487, 64491, 64495, 64500, 64504, 64508, 64512, 64516, 64521, 64525, 64529, 64533, 64538, 64542, 64546, 64550, 64554, 64558, 64563, 64567, 64571, 64575, 64579, 64583, 64587, 64591, 64596, 64600, 64604, 64608, 64612, 64616, 64620, 64624, 64628, 64632, 64636, 64640, 64644, 64648, 64652, 64656, 64660, 64664, 64668, 64672, 64676, 64680, 64684, 64688, 64692, 64695, 64699, 64703, 64707, 64711, 64715, 64719, 64723, 64726, 64730, 64734, 64738, 64742, 64746, 64749, 64753, 64757, 64761, 64765, 64768, 64772, 64776, 64780, 64783, 64787, 64791, 64795, 64798, 64802, 64806, 64809, 64813, 64817, 64820, 64824, 64828, 64831, 64835, 64839, 64842, 64846, 64850, 64853, 64857, 64860, 64864, 64868, 64871, 64875, 64878, 64882, 64886, 64889, 64893, 64896, 64900, 64903, 64907, 64910, 64914, 64917, 64921, 64924, 64928, 64931, 64935, 64938, 64942, 64945, 64948, 64952, 64955, 64959, 64962, 64966, 64969, 64972, 64976, 64979, 64983, 64986, 64989, 64993, 64996, 64999, 65003, 65006, 65009, 65013, 65016, 65019, 65023, 65026, 65029, 65032, 65036, 65039, 65042, 65046, 65049, 65052, 65055, 65059, 65062, 65065, 65068, 65071, 65075, 65078, 65081, 65084, 65087, 65091, 65094, 65097, 65100, 65103, 65106, 65110, 65113, 65116, 65119, 65122, 65125, 65128, 65131, 65134, 65138, 65141, 65144, 65147, 65150, 65153, 65156, 65159, 65162, 65165, 65168, 65171, 65174, 65177, 65180, 65183, 65186, 65189, 65192, 65195, 65198, 65201, 65204, 65207, 65210, 65213, 65216, 65219, 65222, 65225, 65228, 65231, 65233, 65236, 65239, 65242, 65245, 65248, 65251, 65254, 65257, 65259, 65262, 65265, 65268, 65271, 65274, 65277, 65279, 65282, 65285, 65288, 65291, 65293, 65296, 65299, 65302, 65305, 65307, 65310, 65313, 65316, 65318, 65321, 65324, 65327, 65329, 65332, 65335, 65337, 65340, 65343, 65346, 65348, 65351, 65354, 65356, 65359, 65362, 65364, 65367, 65370, 65372, 65375, 65378, 65380, 65383, 65386, 65388, 65391, 65393, 65396, 65399, 65401, 65404, 65406, 65409, 65412, 65414, 65417, 65419, 65422, 65424, 65427, 65429, 65432, 65435, 65437, 65440, 65442, 65445, 65447, 65450, 65452, 65455, 65457, 65460, 65462, 65465, 65467, 65470, 65472, 65474, 65477, 65479, 65482, 65484, 65487, 65489, 65492, 65494, 65496, 65499, 65501, 65504, 65506, 65508, 65511, 65513, 65516, 65518, 65520, 65523, 65525, 65527, 65530, 65532, 65535};
-	int32_t * aSlope = (int32_t *) linSlope;
-	int32_t * dSlope = (int32_t *) expoSlope;
-	int32_t * rSlope = (int32_t *) expoSlope;
+	typedef LookupTable<int32_t, ATSR_SLOPE_LENGTH> SlopeTable;
+
+	static constexpr SlopeTable expoSlope = generateTable<int32_t, ATSR_SLOPE_LENGTH, ExpoSlopeGenerator>();
+	static constexpr SlopeTable logSlope = generateTable<int32_t, ATSR_SLOPE_LENGTH, LogSlopeGenerator>();
+	static constexpr SlopeTable linSlope = generateTable<int32_t, ATSR_SLOPE_LENGTH, LinSlopeGenerator>();
+	static constexpr SlopeTable sigmoidSlope = generateTable<int32_t, ATSR_SLOPE_LENGTH, SigmoidSlopeGenerator>();
+	int32_t * aSlope = (int32_t *) linSlope.data;
+	int32_t * dSlope = (int32_t *) expoSlope.data;
+	int32_t * rSlope = (int32_t *) expoSlope.data;
 
 	int32_t evaluateA(int32_t phase) {
 
-		int32_t index = phase >> 16;
-		int32_t fractional = phase & 0xFFFF;
+		int32_t index = phase >> (28 - ATSR_SLOPE_BITS);
+		int32_t fractional = (phase >> (12 - ATSR_SLOPE_BITS)) & 0xFFFF;
 		int32_t leftSample = *(aSlope + index);
 		int32_t difference = *(aSlope + index + 1) - leftSample;
 
@@ -178,8 +214,8 @@ public:
 
 	int32_t evaluateD(int32_t phase) {
 
-		int32_t index = phase >> 16;
-		int32_t fractional = phase & 0xFFFF;
+		int32_t index = phase >> (28 - ATSR_SLOPE_BITS);
+		int32_t fractional = (phase >> (12 - ATSR_SLOPE_BITS)) & 0xFFFF;
 		int32_t leftSample = *(dSlope + index);
 		int32_t difference = *(dSlope + index + 1) - leftSample;
 
@@ -188,8 +224,8 @@ public:
 
 	int32_t evaluateR(int32_t phase) {
 
-		int32_t index = phase >> 16;
-		int32_t fractional = phase & 0xFFFF;
+		int32_t index = phase >> (28 - ATSR_SLOPE_BITS);
+		int32_t fractional = (phase >> (12 - ATSR_SLOPE_BITS)) & 0xFFFF;
 		int32_t leftSample = *(rSlope + index);
 		int32_t difference = *(rSlope + index + 1) - leftSample;
 
@@ -650,17 +686,24 @@ public:
 		rMod += 32767 - cv3Calibration;
 		tMod >>= 4;
 		rMod >>= 4;
-		tMod = expo.convert(__USAT(tMod, 12)) >> 5;
-		rMod = expo.convert(__USAT(rMod, 12)) >> 5;
 
-		int32_t cycleMod;
+		// all six time controls go through the expo table in one pass
+		int32_t expoIn[6] = {__USAT(tMod, 12), __USAT(rMod, 12),
+				(int32_t) (4095 - controls.cv1Value + cv1Calibration),
+				(int32_t) (4095 - controls.knob1Value),
+				(int32_t) (4095 - controls.knob2Value),
+				(int32_t) (4095 - controls.knob3Value)};
+		int32_t expoOut[6];
+		expo.convert(expoIn, expoOut, 6);
+
+		tMod = expoOut[0] >> 5;
+		rMod = expoOut[1] >> 5;
+
+		int32_t cycleMod = expoOut[2] >> 5;
 
 		if (cycleTime) {
-			cycleMod = expo.convert(4095 - controls.cv1Value + cv1Calibration) >> 5;
 			tMod = __USAT(fix16_mul(cycleMod, tMod), 26);
 			rMod = __USAT(fix16_mul(cycleMod, rMod), 26);
-		} else {
-			cycleMod = expo.convert(4095 - controls.cv1Value + cv1Calibration) >> 5;
 		}
 
 		if (attacking) {
@@ -680,10 +723,10 @@ public:
 		}
 
 		atsrState->attackIncrement = __USAT(fix16_mul(cycleMod,
-				expo.convert(4095 - controls.knob1Value) >> 7), 25);
-		atsrState->tIncrement = __USAT(fix16_mul(expo.convert(4095 - controls.knob2Value) >> 7,
+				expoOut[3] >> 7), 25);
+		atsrState->tIncrement = __USAT(fix16_mul(expoOut[4] >> 7,
 				tMod), 25);
-		atsrState->releaseIncrement = __USAT(fix16_mul(expo.convert(4095 - controls.knob3Value) >> 7,
+		atsrState->releaseIncrement = __USAT(fix16_mul(expoOut[5] >> 7,
 				rMod), 25);
 		updateRGBDisplay(atsrState->bLevel >> 4,
 				((atsrState->aLevel + atsrState->bLevel) >> 4) * cycleTime,
@@ -74,6 +74,8 @@ public:
 	uint32_t offset = 0;
 
 	uint32_t periodCount = 48000;
+	/// Divides by periodCount for the soft gate times, updated on each clock.
+	InvariantDivisor periodDivisor;
 	uint32_t clockOn = 0;
 	uint32_t multiplier = 1;
 	uint32_t multReset = 0;
@@ -133,6 +135,11 @@ public:
 	void updateLogicOutput(void);
 	void parseControls(ViaControls *, ViaInputStreams *);
 
+	DualEuclidean() {
+		// the soft gate times can be read before the first clock latches a period
+		periodDivisor.set(periodCount);
+	}
+
 };
 
 
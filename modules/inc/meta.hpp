@@ -12,6 +12,22 @@
 #include <via_platform_binding.hpp>
 #include <dsp.hpp>
 #include "meta_tables.hpp"
+#include "wavetable_import.hpp"
+#include "stdio.h"
+
+#define META_BUFFER_SIZE 8
+/// log2 of META_BUFFER_SIZE.
+#define META_BUFFER_SHIFT 3
+
+#ifdef BUILD_VIRTUAL
+/// Most half-band stages the audio mode can decimate through, 16x oversampling.
+#define META_MAX_DECIMATION_STAGES 4
+/// Block increment (plus per sample fm depth) at which the top partial of a 512 sample table reaches the dac nyquist.
+/// Below it nothing can fold, so the audio mode skips its decimation stages. They come in a little under it
+/// and drop out further down, so a pitch sitting near the crossover doesn't switch paths every block.
+#define META_DECIMATE_ABOVE_INCREMENT (3 << 17)
+#define META_UNDECIMATE_BELOW_INCREMENT (2 << 17)
+#endif
 
 // simplest wavetable, provide a phase and a morph
 
@@ -25,8 +41,12 @@ public:
 	int32_t phase = 0;
 	uint32_t tableSize = 0;
 	int32_t increment = 0;
+	/// Per sample offsets from increment across the block, applied in the direction of increment.
+	int32_t * incrementMod;
 
 	int32_t morphModOffset = 0;
+	/// Morph (16 bit, before scaling to the table) at the end of the last block, where the next block's ramp starts.
+	int32_t lastMorph = 0;
 
 	int32_t oversamplingFactor = 3;
 	int32_t bufferSize = 8;
@@ -39,17 +59,85 @@ public:
 
 	void parseControls(ViaControls * controls);
 
-	void advance(uint32_t * wavetable) {
+#ifdef WAVETABLE_MIPMAP
+	/// Band-limited levels of the active table, set by the module.
+	WavetableMipmap * mipmap = 0;
+#endif
+
+#ifdef BUILD_VIRTUAL
+	/// The oversampled path renders bufferSize << decimationStages sub-samples and halves the rate that many times,
+	/// 0 writes the sub-samples straight to the dacs. See ViaMeta::setOversampling.
+	/// Only used while decimating, slow phases take the plain path whatever this is set to.
+	int32_t decimationStages = 0;
+	/// Banks 1 and 2 filter the outgoing tables during a table crossfade, see forkDecimators.
+	HalfBandDecimator<META_BUFFER_SIZE << META_MAX_DECIMATION_STAGES> decimators[3][META_MAX_DECIMATION_STAGES];
+	int32_t decimatorBank = 0;
+	int32_t oversampledOut[META_BUFFER_SIZE << META_MAX_DECIMATION_STAGES];
+
+	/// Start an outgoing table's filters from the state of the active ones.
+	void forkDecimators(int32_t bank) {
+		for (int32_t i = 0; i < META_MAX_DECIMATION_STAGES; i++) {
+			decimators[bank][i] = decimators[0][i];
+		}
+	}
+
+	/// Start every bank's filters as if the input had been sitting at value, so they pick up without a step.
+	void primeDecimators(int32_t value) {
+		for (int32_t i = 0; i < META_MAX_DECIMATION_STAGES; i++) {
+			decimators[0][i].prime(value);
+			decimators[1][i].prime(value);
+			decimators[2][i].prime(value);
+		}
+	}
+
+	/// Set while the increment is high enough for the decimated path, see updateDecimating.
+	int32_t decimating = 0;
+
+	/// Decide per block whether the decimation stages are worth running, from the increment and fm depth.
+	int32_t updateDecimating(void) {
+		int32_t speed = abs(increment) + abs(incrementMod[0]);
+		if (decimating) {
+			decimating = speed > META_UNDECIMATE_BELOW_INCREMENT;
+		} else if (speed > META_DECIMATE_ABOVE_INCREMENT) {
+			// the filters last ran before the pitch dropped, start them from where the plain path left off
+			primeDecimators(signalOut[bufferSize - 1]);
+			decimating = 1;
+		}
+		return decimating;
+	}
+
+	void advanceDecimated(const uint32_t * wavetable);
+#endif
+
+	void advance(const uint32_t * wavetable) {
 		if (oversamplingFactor) {
+#ifdef BUILD_VIRTUAL
+			int32_t stages = updateDecimating() ? decimationStages : 0;
+#endif
+#ifdef WAVETABLE_MIPMAP
+			// read the level band-limited for the per sub-sample increment, so no partial passes the render nyquist
+			int32_t subSampleIncrement = increment >> oversamplingFactor;
+#ifdef BUILD_VIRTUAL
+			subSampleIncrement >>= stages;
+#endif
+			const uint32_t * level = mipmap ? mipmap->select(wavetable, subSampleIncrement) : 0;
+			wavetable = level ? level : wavetable;
+#endif
+#ifdef BUILD_VIRTUAL
+			if (stages) {
+				advanceDecimated(wavetable);
+				return;
+			}
+#endif
 			advanceOversampled(wavetable);
 		} else {
 			advanceSingleSample(wavetable);
 		}
 	}
 
-	void advanceSingleSample(uint32_t * wavetable);
+	void advanceSingleSample(const uint32_t * wavetable);
 
-	void advanceOversampled(uint32_t * wavetable);
+	void advanceOversampled(const uint32_t * wavetable);
 
 };
 
@@ -75,10 +163,16 @@ public:
 	int32_t increment2 = 0;
 	int32_t incrementUsed = 0;
 	int32_t dutyCycle = 0;
+	/// Phase distortion for the pwm modes, breakpoint set from dutyCycle.
+	PhaseWarp pwmWarp;
 	int32_t lastPhase = 0;
 	int32_t oscillatorOn = 0;
 	int16_t * fm;
 	int32_t * expoFM;
+	/// Offset of each sample's increment from incrementUsed, filled by generateIncrementsAudio, sums to zero over the block.
+	int32_t incrementMod[META_BUFFER_SIZE];
+	/// Increment at the end of the last block, the start of this block's ramp.
+	int32_t lastIncrement = 0;
 
 	int32_t cv1Offset = 0;
 	int32_t cv2Offset = 0;
@@ -112,11 +206,11 @@ public:
 	void generateIncrementsEnv(ViaInputStreams * inputs);
 	void generateIncrementsSeq(ViaInputStreams * inputs);
 
-	void advancePhaseExternal(uint32_t * phaseDistTable);
+	void advancePhaseExternal(void);
 
-	int32_t (MetaController::*advancePhase)(uint32_t * phaseDistTable);
-	int32_t advancePhasePWM(uint32_t * phaseDistTable);
-	int32_t advancePhaseOversampled(uint32_t * phaseDistTable);
+	int32_t (MetaController::*advancePhase)(void);
+	int32_t advancePhasePWM(void);
+	int32_t advancePhaseOversampled(void);
 
 
 	int32_t (MetaController::*incrementArbiter)(void);
@@ -179,18 +273,79 @@ public:
 	int32_t * output;
 
 	void parseControls (ViaControls * controls, ViaInputStreams * inputs);
-	void advance (ViaInputStreams * inputs, uint32_t * wavetable);
 
-	int32_t (SimpleEnvelope::*incrementArbiter)(void);
+	enum envelopeStates {resting, attacking, releasing, retriggering};
+
+	uint32_t state = resting;
+
+	/// Take the transition for the current state, trigger and last phase event, return the increment for a whole block.
+	inline int32_t nextIncrement(void) {
+		switch (state) {
+		case attacking:
+			if (phaseEvent == AT_B_FROM_ATTACK) {
+				state = releasing;
+				return release;
+			}
+			return attack;
+		case releasing:
+			if (trigger == 0) {
+				state = retriggering;
+				return -attack;
+			}
+			if (phaseEvent == AT_A_FROM_RELEASE) {
+				state = resting;
+				phase = 1;
+				return 0;
+			}
+			return release;
+		case retriggering:
+			if (phaseEvent == AT_B_FROM_RELEASE) {
+				state = releasing;
+				return release;
+			}
+			return -attack;
+		default:
+			if (trigger == 0) {
+				state = attacking;
+				return attack;
+			}
+			return 0;
+		}
+	}
 
-	int32_t attackState(void);
-	int32_t releaseState(void);
-	int32_t retriggerState(void);
-	int32_t restingState(void);
+	/// Advance by sample subStep of a block of META_BUFFER_SIZE, transitions land on the sample the phase event happens in.
+	inline void step(int32_t subStep) {
 
-};
+		increment = nextIncrement();
+		trigger = 1;
 
-#define META_BUFFER_SIZE 8
+		// the block's increment split evenly with the remainder handed out a step at a time, so a block still covers all of it
+		int32_t localIncrement = ((int32_t) increment >> META_BUFFER_SHIFT) +
+				(subStep < (int32_t) (increment & (META_BUFFER_SIZE - 1)));
+
+		int32_t localPhase = phase + localIncrement;
+
+		// add wavetable length if phase < 0, subtract it if phase > wavetable length
+		int32_t phaseWrapper = ((uint32_t)(localPhase) >> 31) * WAVETABLE_LENGTH;
+		phaseWrapper -= ((uint32_t)(WAVETABLE_LENGTH - localPhase) >> 31) * WAVETABLE_LENGTH;
+		localPhase += phaseWrapper;
+
+		// -1 if the max value index of the wavetable is crossed from the left, 1 from the right, see MetaController
+		int32_t atBIndicator = ((uint32_t)(localPhase - AT_B_PHASE) >> 31) - ((uint32_t)(previousPhase - AT_B_PHASE) >> 31);
+
+		phaseEvent = phaseWrapper + atBIndicator;
+		previousPhase = localPhase;
+		phase = localPhase;
+
+	}
+
+	/// Envelope level at the current phase.
+	inline int32_t read(const uint32_t * wavetable) {
+		uint32_t leftSample = phase >> 16;
+		return fast_15_16_lerp(wavetable[leftSample], wavetable[leftSample + 1], phase & 0xFFFF);
+	}
+
+};
 
 /*
  *
@@ -297,6 +452,8 @@ public:
 
 		void writeStockPresets(void) override;
 
+		void presetStoredCallback(int32_t position) override;
+
 		void blinkOnCallback(void) override {
 			restoreRed = *(this_module.redLevel);
 			restoreGreen = *(this_module.greenLevel);
@@ -359,21 +516,93 @@ public:
 	const Wavetable * wavetableArray[3][8];
 
 	// declare arrays to store the active tables
-	uint32_t wavetableRead[9][517];
+#if defined(WAVETABLE_PREDECODED)
+	// point at the build time images in flash
+	const uint32_t * wavetableRead = MetaWavetableSet::impevens.image;
+	const uint32_t * wavetableReadDrum = MetaWavetableSet::drum.image;
+#elif defined(WAVETABLE_INCREMENTAL_LOAD)
+	// front and back buffers for the incremental loader, wavetableRead follows its front buffer
+	uint32_t wavetableBuffers[2][9][517];
+	const uint32_t * wavetableRead = wavetableBuffers[0][0];
+	WavetableLoader wavetableLoader;
 	uint32_t wavetableReadDrum[517];
+#else
+	// decoded in place on each table change
+	uint32_t wavetableBuffer[9][517];
+	const uint32_t * wavetableRead = wavetableBuffer[0];
+	uint32_t wavetableReadDrum[517];
+#endif
 	uint32_t wavetableReadDrum2[517];
 
+	/// Blocks to crossfade from the outgoing table over, 0 switches straight over.
+	/// Only possible when the outgoing table stays intact (pre-decoded or incremental loading).
+#ifndef META_TABLE_CROSSFADE_BLOCKS
+#define META_TABLE_CROSSFADE_BLOCKS 16
+#endif
+	/// Outgoing tables of the crossfade. A change mid-fade fades from the blend playing at the time,
+	/// which is the second table mixed over the first at lastTableGain (16 bit, 0 for the first alone).
+	const uint32_t * lastWavetableRead[2] = {0, 0};
+	uint32_t lastTableSize[2] = {0, 0};
+	int32_t lastTableGain = 0;
+	/// Gain of the incoming table at the end of the last block.
+	int32_t tableGain = 0;
+	int32_t tableCrossfade = 0;
+	/// A change arriving while the outgoing side is already a blend waits here for the fade to end.
+	const uint32_t * pendingWavetableRead = 0;
+	uint32_t pendingTableSize = 0;
+
+#ifdef WAVETABLE_MIPMAP
+	/// Band-limited levels of wavetableRead for the audio mode, built a slope per slowConversionCallback.
+	WavetableMipmap wavetableMipmap;
+#endif
+
 	// declare functions to set the currently active tables
 	void switchWavetable(const Wavetable *);
-	// phase distortion table is fixed
-	void initPhaseDistTable(void);
+	void flipWavetable(const uint32_t * table, uint32_t tableSize);
+	void advanceLastWavetable(int32_t index, int32_t * out);
+	void advanceWavetable(void);
 	void fillWavetableArray(void);
+
+#ifdef BUILD_VIRTUAL
+	/// Tables imported from user files, see importWavetable.
+	WavetableImport userWavetables[WAVETABLE_USER_TABLES];
+	/// Import a wav or raw family file into userWavetables[index] and put it at wavetableArray[bank][slot] and any slot
+	/// holding the table the index imported before, switching to it if one of those is playing. cachePath may be null.
+	/// Returns 0 if the import fails or a table change is still fading or loading.
+	int32_t importWavetable(const char * path, const char * cachePath, int32_t index, int32_t bank, int32_t slot);
+
+	/// Oversampling of the audio modes relative to the dac rate: 1, 2, 4, 8 or 16, other values round down.
+	/// Above 1 the oscillator renders that many sub-samples per dac sample and decimates them with half-band filters.
+	void setOversampling(int32_t ratio) {
+		int32_t stages = 0;
+		while (stages < META_MAX_DECIMATION_STAGES && (2 << stages) <= ratio) {
+			stages++;
+		}
+		if (stages != metaWavetable.decimationStages) {
+			// the filters run at different rates now, so their history no longer lines up
+			// start them from the last output rather than zero, which would click
+			metaWavetable.primeDecimators(metaWavetable.signalOut[metaWavetable.bufferSize - 1]);
+			metaWavetable.decimationStages = stages;
+		}
+	}
+
+	/// Mean time the controller takes to generate the increments and advance the phase for a block, in nanoseconds,
+	/// in frequency mode freq, loop mode loop and trigger mode trig, over blocks blocks.
+	/// The main logic input rises every gatePeriod blocks and falls half way between.
+	double benchController(int32_t freq, int32_t loop, int32_t trig, int32_t blocks, int32_t gatePeriod);
+	/// Print the best of a few benchController runs for every frequency, loop and trigger mode, each on a fresh module.
+	static void reportControllerBench(FILE * report, int32_t blocks, int32_t gatePeriod);
+#endif
 	void initDrum(void);
-	int16_t drumWrite[4];
+	/// Step all three drum envelopes through the block together.
+	void advanceDrumEnvelopes(void);
+	/// Amp envelope, a sample per dac sample.
+	int32_t drumWrite[META_BUFFER_SIZE];
 	int16_t drum2Write[4];
 	int16_t drum3Write[4];
 	int16_t drumFullScale[4];
 	int32_t drumOff[4];
+	int32_t incrementOff[META_BUFFER_SIZE];
 
 	void readCalibrationPacket(void) {
 		calibrationPacket = metaUI.loadFromMemory(7);
@@ -386,27 +615,40 @@ public:
 	 *
 	 */
 
-	void (ViaMeta::*outputStage)(int32_t writeIndex);
+	// how the wavetable output reaches dacs 1 and 2
+	enum metaOutputStages {oversampleStage, addThreeBitsStage, drumStage, numOutputStages};
+	enum metaDac3Modes {dac3Phasor, dac3Contour, dac3DrumEnv, dac3Noise, dac3PhasorEnv, dac3ContourEnv, numDac3Modes};
+
+	int32_t outputStage = oversampleStage;
+	int32_t dac3Mode = dac3Phasor;
+	/// A meta_aux2Modes value.
+	int32_t logicAMode = releaseGate;
+	/// A meta_button1Modes value.
+	int32_t shMode = nosampleandhold;
+
+	/// Single pass over the block writing every output, instantiated per output stage and dac 3 mode.
+	/// The logic A and S&H outputs are one write per block, so they switch on their mode inside the kernel instead of multiplying the instances.
+	template<int32_t OUTPUT_STAGE, int32_t DAC3_MODE>
+	void renderOutputsKernel(int32_t half);
+	static void (ViaMeta::* const outputKernels[numOutputStages][numDac3Modes])(int32_t half);
+	/// Kernel for the current outputStage and dac3Mode, called once per half transfer.
+	void (ViaMeta::*renderOutputs)(int32_t half);
+
+	void setOutputStage(int32_t stage) {
+		outputStage = stage;
+		renderOutputs = outputKernels[outputStage][dac3Mode];
+	}
+	void setDac3Mode(int32_t mode) {
+		dac3Mode = mode;
+		renderOutputs = outputKernels[outputStage][dac3Mode];
+	}
 
 	int32_t dac3OffsetCompensation;
 
-	void oversample(int32_t writeIndex);
-	void addThreeBits(int32_t writeIndex);
-	void drumMode(int32_t writeIndex);
-
 	uint16_t virtualFM[2];
 	uint16_t virtualMorph[2];
 
-	void (ViaMeta::*calculateDac3)(int32_t writeIndex);
-
-	void calculateDac3Phasor(int32_t writeIndex);
-	void calculateDac3Contour(int32_t writeIndex);
-	void calculateDac3DrumEnv(int32_t writeIndex);
-	void calculateDac3Noise(int32_t writeIndex);
-	void calculateDac3PhasorEnv(int32_t writeIndex);
-	void calculateDac3ContourEnv(int32_t writeIndex);
-
-	void (ViaMeta::*calculateLogicA)(int32_t writeIndex);
+	void calculateLogicA(int32_t writeIndex);
 
 	void calculateLogicAReleaseGate(int32_t writeIndex);
 	void calculateLogicAAttackGate(int32_t writeIndex);
@@ -461,7 +703,7 @@ public:
 		lfsrState &= 4095;
 	}
 
-	void (ViaMeta::*calculateSH)(int32_t writeIndex);
+	void calculateSH(int32_t writeIndex);
 	// No S&H
 	void calculateSHMode1(int32_t writeIndex);
 	// Sample A from A to B
@@ -503,7 +745,7 @@ public:
 	void updateRGBDrum(void) {
 		
 		int32_t displayFreq = abs(fix16_mul(__USAT(controls.knob1Value + controls.cv1Value - 1000, 12), metaController.fm[0] + 32767));
-		uint32_t drumEnvelopeLevel = ampEnvelope.output[0] << 1;
+		uint32_t drumEnvelopeLevel = ampEnvelope.output[META_BUFFER_SIZE - 1] << 1;
 
 		int32_t redSignal = fix16_mul(4095 - displayFreq, drumEnvelopeLevel);
 		int32_t blueSignal = fix16_mul(displayFreq, drumEnvelopeLevel);
@@ -584,6 +826,76 @@ public:
 	int32_t presetOverride = 0;
 	int32_t presetSequence[8] = {1, 2, 3, 4, 5, 6, 1, 2};
 
+	/// Everything the mode handlers set for one preset, captured once so a sequenced preset is a copy rather than an EEPROM read.
+	struct MetaPreset {
+		/// Mode word as it is stored in EEPROM.
+		uint32_t modes;
+		const Wavetable * table;
+
+		int32_t outputStage;
+		int32_t dac3Mode;
+		int32_t logicAMode;
+		int32_t shMode;
+
+		void (MetaController::*parseControls)(ViaControls * controls, ViaInputStreams * inputs);
+		void (MetaController::*generateIncrements)(ViaInputStreams * inputs);
+		int32_t (MetaController::*advancePhase)(void);
+		int16_t * fm;
+		int32_t * expoFM;
+		uint32_t loopMode;
+		void (MetaController::*loopHandler)(void);
+		int32_t (MetaController::*incrementArbiter)(void);
+		int32_t gateOn;
+		int32_t drumBaseIncrement;
+
+		int16_t * morphScale;
+		int32_t * incrementMod;
+		int32_t oversamplingFactor;
+
+		uint32_t ampAttack;
+		int32_t morphAttackMultiplier;
+		int32_t morphReleaseMultiplier;
+		uint32_t morphReleaseClamp;
+		int32_t freqAttackMultiplier;
+		int32_t freqReleaseMultiplier;
+		int32_t transientScale;
+		uint32_t minTransientLength;
+	};
+
+	/// Entry 0 is the state sequencing started from, 1-6 are the presets. Filled when preset sequencing is entered.
+	MetaPreset presetCache[7];
+	/// Table last passed to switchWavetable, lets a preset step skip reloading the table it is already playing.
+	const Wavetable * currentWavetable = 0;
+
+	void capturePreset(MetaPreset * preset);
+	/// Set the mode word and everything the handlers set.
+	void applyPreset(const MetaPreset * preset);
+	/// Set everything the handlers set, leaving the ui alone.
+	void applySettings(const MetaPreset * preset);
+
+	// the fields each handler sets, filled into a preset so the handlers and decodePreset share them
+	void triggerModeSettings(int32_t mode, int32_t loop, MetaPreset * preset);
+	void drumAuxModeSettings(int32_t mode, MetaPreset * preset);
+	void drumModeSettings(int32_t mode, MetaPreset * preset);
+	void dac3ModeSettings(int32_t mode, int32_t freq, MetaPreset * preset);
+	void drumSettings(int32_t drumAux, int32_t drumMode, MetaPreset * preset);
+	/// sequenced picks the preset sequence controls, see initializeOscillator.
+	void oscillatorSettings(int32_t trig, int32_t dac3, int32_t sequenced, MetaPreset * preset);
+	void envelopeSettings(int32_t trig, int32_t dac3, MetaPreset * preset);
+	void simpleLFOSettings(int32_t trig, int32_t dac3, MetaPreset * preset);
+	void sequenceSettings(int32_t trig, int32_t dac3, MetaPreset * preset);
+	void complexLFOSettings(int32_t trig, int32_t dac3, MetaPreset * preset);
+	/// Restart the trigger state machine after the arbiter changes.
+	void restartTrigger(void);
+	/// Work out the preset for a stored mode word without touching the running module, see fillPresetCache.
+	void decodePreset(uint32_t modes, const MetaPreset * previous, MetaPreset * preset);
+	/// Decode each stored preset into the cache, starting from the running state.
+	void fillPresetCache(void);
+	/// Switch to a cached preset, constant time unless the preset uses a different table.
+	void recallPreset(int32_t position);
+	/// Repoint the cached tables after wavetableArray has changed.
+	void refreshPresetCacheTables(void);
+
 	MetaWavetable metaWavetable;
 	MetaController metaController;
 	SimpleEnvelope ampEnvelope;
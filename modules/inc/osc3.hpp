@@ -17,6 +17,23 @@ void osc3TouchLink (void *);
 #include <via_platform_binding.hpp>
 #include <dsp.hpp>
 
+/// Semitone quantizer tables, index 4 is the bottom of the range and the last entry is the unquantized top.
+/// Mask has bit n set for each pitch class n in the scale.
+constexpr int32_t quantizeToScale(int32_t semitone, int32_t mask) {
+	return ((mask >> (semitone % 12)) & 1) ? semitone : quantizeToScale(semitone - 1, mask);
+}
+
+template <int32_t Mask>
+struct ScaleGenerator {
+	static constexpr int32_t value(int32_t index, int32_t length) {
+		return (index == length - 1) ? index - 4 : quantizeToScale((index > 4) ? index - 4 : 0, Mask);
+	}
+};
+
+#define CHROMATIC_MASK 0xFFF
+#define MAJOR_MASK 0xAB5
+#define MINOR_MASK 0x5AD
+
 /// Calibration/template module class.
 
 /** A simple self calibration tool that doubles as an introductory template.*/
@@ -215,9 +232,9 @@ public:
 	int32_t shAOn = 1;
 	int32_t shBOn = 1;
 
-	int32_t chromatic[128] = {0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123};
-	int32_t major[128] = {0, 0, 0, 0, 0, 0, 2, 2, 4, 5, 5, 7, 7, 9, 9, 11, 12, 12, 14, 14, 16, 17, 17, 19, 19, 21, 21, 23, 24, 24, 26, 26, 28, 29, 29, 31, 31, 33, 33, 35, 36, 36, 38, 38, 40, 41, 41, 43, 43, 45, 45, 47, 48, 48, 50, 50, 52, 53, 53, 55, 55, 57, 57, 59, 60, 60, 62, 62, 64, 65, 65, 67, 67, 69, 69, 71, 72, 72, 74, 74, 76, 77, 77, 79, 79, 81, 81, 83, 84, 84, 86, 86, 88, 89, 89, 91, 91, 93, 93, 95, 96, 96, 98, 98, 100, 101, 101, 103, 103, 105, 105, 107, 108, 108, 110, 110, 112, 113, 113, 115, 115, 117, 117, 119, 120, 120, 122, 123};
-	int32_t minor[128] = {0, 0, 0, 0, 0, 0, 2, 3, 3, 5, 5, 7, 8, 8, 10, 10, 12, 12, 14, 15, 15, 17, 17, 19, 20, 20, 22, 22, 24, 24, 26, 27, 27, 29, 29, 31, 32, 32, 34, 34, 36, 36, 38, 39, 39, 41, 41, 43, 44, 44, 46, 46, 48, 48, 50, 51, 51, 53, 53, 55, 56, 56, 58, 58, 60, 60, 62, 63, 63, 65, 65, 67, 68, 68, 70, 70, 72, 72, 74, 75, 75, 77, 77, 79, 80, 80, 82, 82, 84, 84, 86, 87, 87, 89, 89, 91, 92, 92, 94, 94, 96, 96, 98, 99, 99, 101, 101, 103, 104, 104, 106, 106, 108, 108, 110, 111, 111, 113, 113, 115, 116, 116, 118, 118, 120, 120, 122, 123};
+	static constexpr LookupTable<int8_t, 128> chromatic = generateTable<int8_t, 128, ScaleGenerator<CHROMATIC_MASK>>();
+	static constexpr LookupTable<int8_t, 128> major = generateTable<int8_t, 128, ScaleGenerator<MAJOR_MASK>>();
+	static constexpr LookupTable<int8_t, 128> minor = generateTable<int8_t, 128, ScaleGenerator<MINOR_MASK>>();
 
 	int32_t minorIntervals[40] = {-24, -22, -21, -19, -17, -16, -14, -12, -10, -9, -7, -5, -4, -2, 0, 2, 3, 5, 7, 8, 10, 12, 14, 15, 17, 19, 20, 22, 24};
 	int32_t majorIntervals[40] = {-24, -22, -20, -19, -17, -15, -13, -12, -10, -8, -7, -5, -3, -1, 0, 2, 4, 5, 7, 9, 11, 12, 14, 16, 17, 19, 21, 23, 24};
@@ -237,7 +254,7 @@ public:
           {-4, 2}, {-5, 4}, {-5, 5}, {-4, 5}, {-6, 5}, {-6, 6}, {-6, 7}, {-7, 7}, {-7, 7}
 	};
 
-	int32_t * scale = chromatic;
+	const int8_t * scale = chromatic.data;
 	int32_t * intervals = majorIntervals;
 	int32_t scaleMode = 0;
 
@@ -526,39 +543,36 @@ public:
 		root = knob1Index;
 		offset = __USAT((cv1Index - (4 << 5)), 12);
 
+		// unquantized, so track the cv at 16 bit resolution and sum coarse tune and cv in the exponent
+		int32_t pitchIndex = (root << 4) + __USAT((int32_t) controls.cv1ValueHiRes - (cv1Calibration << 4) - (4 << 9), 16);
+
 		if (chordMode) {
 
 			int32_t fineTune = 65535 + (controls.knob2Value << 3);
-			int32_t coarseTune = expo.convert(root) >> 3;
 
 			int32_t chord = __USAT(((controls.knob3Value << 4)) + (int32_t) -inputs.cv3Samples[0], 16);
 			int32_t chordFrac = chord & 0xFFF;
 			chord >>= 12;
 
-			cBasePitch = fix16_mul(coarseTune,
-					expo.convert(offset) >> 2);
-			cBasePitch = fix16_mul(cBasePitch, absoluteTune);
-			cBasePitch = fix16_mul(cBasePitch, fineTune);
+			cBasePitch = expo.multiply(fix16_mul(absoluteTune, fineTune), pitchIndex, 5);
 
 			int32_t chordMultiplier = scale[64 + intervals[14 + chords[chord][1]]] << 5;
 			int32_t chordMultiplier1 = scale[64 + intervals[14 + chords[chord + 1][1]]] << 5;
 			chordMultiplier = chordMultiplier + (((chordMultiplier1 - chordMultiplier) * chordFrac) >> 12);
 
-			aBasePitch = fix16_mul(cBasePitch, expo.convert(chordMultiplier) >> 5);
+			aBasePitch = expo.multiply(cBasePitch, chordMultiplier << 4, 5);
 
 			chordMultiplier = scale[64 + intervals[14 + chords[chord][0]]] << 5;
 			chordMultiplier1 = scale[64 + intervals[14 + chords[chord + 1][0]]] << 5;
 			chordMultiplier = chordMultiplier + (((chordMultiplier1 - chordMultiplier) * chordFrac) >> 12);
 
-			bBasePitch = fix16_mul(cBasePitch, expo.convert(chordMultiplier) >> 5);
+			bBasePitch = expo.multiply(cBasePitch, chordMultiplier << 4, 5);
 
 			detuneBase = 0;
 
 		} else {
-			cBasePitch = fix16_mul(expo.convert(knob1Index) >> 3,
-					expo.convert(offset) >> 2);
-			cBasePitch = fix16_mul(cBasePitch, absoluteTune);
-			cBasePitch = fix16_mul(cBasePitch, 65535 + (controls.knob2Value << 3));
+			cBasePitch = expo.multiply(fix16_mul(absoluteTune, 65535 + (controls.knob2Value << 3)),
+					pitchIndex, 5);
 			detuneBase = clockedBeat + (controls.knob3Value << 4);
 		}
 
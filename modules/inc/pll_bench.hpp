@@ -0,0 +1,122 @@
+/*
+ * pll_bench.hpp
+ *
+ *  Virtual build only: synthetic clocks and lock/jitter measurements
+ *  for the Sync and Sync3 phase locked loops.
+ */
+
+#ifndef INC_PLL_BENCH_HPP_
+#define INC_PLL_BENCH_HPP_
+
+#include <stdint.h>
+
+#ifdef BUILD_VIRTUAL
+
+#include <stdio.h>
+
+/// Phase error (fraction of an output cycle, 2^32 per cycle) the PLL has to stay within to count as locked.
+#define PLL_BENCH_LOCK_TOLERANCE (1 << 26)
+/// Consecutive corrections within tolerance that count as locked.
+#define PLL_BENCH_LOCK_RUN 8
+/// Samples between slow conversion callbacks while benchmarking.
+#define PLL_BENCH_SLOW_CONVERSION_SAMPLES 64
+
+/**
+ *
+ * Synthetic clock
+ *
+ * Rising and falling edges at a steady period in samples, optionally stepping or ramping to a second period
+ * from changeEdge on, with uniform edge time jitter and dropped edges.
+ *
+ */
+
+class SyntheticClock {
+
+	/// Time of the next edge before jitter, in samples since start.
+	double gridTime = 0;
+	double edgeTime = 0;
+	double time = 0;
+	uint32_t noise = 1;
+	int32_t high = 0;
+	int32_t dropped = 0;
+
+	double nextPeriod(void);
+
+public:
+
+	/// Period in samples at the start.
+	float period = 480;
+	/// Period to change to from changeEdge on, 0 to stay at period.
+	float changeTo = 0;
+	/// Edge where the change starts.
+	int32_t changeEdge = 0;
+	/// Edges to ramp over, 0 for a step.
+	int32_t rampEdges = 0;
+	/// Peak edge time error as a fraction of the current period.
+	float jitter = 0;
+	/// Leave out every dropEvery'th rising edge, 0 for none.
+	int32_t dropEvery = 0;
+	uint32_t seed = 1;
+
+	/// Rising edges so far, dropped ones included.
+	int32_t edges = 0;
+	/// Period of the last interval before jitter.
+	double currentPeriod = 0;
+
+	void start(void);
+	/// Advance one sample, returns 1 on a rising edge, -1 on a falling edge, 0 otherwise.
+	int32_t advance(void);
+
+};
+
+/// Figures from one benchmark run.
+typedef struct {
+	/// Edges from the start (or from changeEdge if the clock changes) to the first correction of the run within
+	/// PLL_BENCH_LOCK_TOLERANCE that lasts to the end, -1 if that run is shorter than PLL_BENCH_LOCK_RUN.
+	int32_t lockEdges;
+	/// RMS phase error over the last quarter of the corrections, as a fraction of an output cycle.
+	float phaseError;
+	/// RMS change in phase error from one correction to the next over the same span, as a fraction of an output cycle.
+	float phaseJitter;
+	/// Worst phase error over the same span.
+	float peakError;
+	/// Mean time in the audio rate callbacks per block, in nanoseconds.
+	float blockTime;
+	/// Output cycles per input cycle the module had selected by the end of the run.
+	float ratio;
+} PllBenchResult;
+
+/**
+ *
+ * PLL meter
+ *
+ * Collects the phase error of each correction the PLL makes and the time spent per block.
+ *
+ */
+
+class PllMeter {
+
+	int32_t maxCorrections;
+	int32_t * errors;
+	/// Clock edge each correction followed, counted from the edge locking is measured from.
+	int32_t * edges;
+	int32_t corrections = 0;
+	double blockTime = 0;
+	int32_t blocks = 0;
+
+public:
+
+	/// The PLL corrects at most once per clock edge, so a run of clockEdges edges fits.
+	PllMeter(int32_t clockEdges);
+	~PllMeter();
+
+	/// Record the error of the correction following edge, negative for edges before the one locking is measured from.
+	void addCorrection(int32_t error, int32_t edge);
+	void addBlock(double nanoseconds);
+	PllBenchResult result(float ratio);
+
+};
+
+#endif
+
+#endif /* INC_PLL_BENCH_HPP_ */
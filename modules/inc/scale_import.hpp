@@ -0,0 +1,76 @@
+/*
+ * scale_import.hpp
+ *
+ *  Virtual build only: compiles Scala tunings into the ratio grid
+ *  format of the built in Sync scales.
+ */
+
+#ifndef INC_SCALE_IMPORT_HPP_
+#define INC_SCALE_IMPORT_HPP_
+
+#include "scales.hpp"
+
+#ifdef BUILD_VIRTUAL
+
+/// Rows of an imported grid, the modes of the tuning spread evenly across them.
+#define SCALE_IMPORT_ROWS 16
+/// t2Bitshift for SCALE_IMPORT_ROWS rows.
+#define SCALE_IMPORT_ROW_SHIFT 8
+/// Number of imported scales Sync can hold at once.
+#define SCALE_USER_SCALES 4
+/// Largest denominator (and so the most input cycles between phase resets) a note is approximated with.
+#define SCALE_IMPORT_MAX_DENOMINATOR 2048
+/// Notes further than this many octaves from a row's root repeat the last note in range.
+#define SCALE_IMPORT_OCTAVE_RANGE 5
+
+/**
+ *
+ * Scale imported from a Scala tuning
+ *
+ * Reads a .scl file and optionally a .kbm keyboard mapping (map size, first, last and middle note and the formal
+ * octave are used, the reference frequency is not as the ratios are relative to the clock).
+ * Each row of the grid is a mode of the tuning, starting from a later key the further up the rows,
+ * and the ratio knob steps across keys from about 5 octaves below to 5 above the row's root in the middle column.
+ * Notes are approximated by the nearest fraction with a denominator up to SCALE_IMPORT_MAX_DENOMINATOR,
+ * so the PLL realigns at most every 2048 edges. The compiled grid is cached on disk keyed on a hash of the files.
+ *
+ */
+
+class ScaleImport {
+
+	/// Compiled grid in the layout of the built in scales, ratios and gcds indexed by note, and the Scale Sync points at.
+	struct Grid {
+		uint16_t cells[SCALE_IMPORT_ROWS * SCALE_GRID_COLUMNS];
+		uint64_t ratios[SCALE_IMPORT_ROWS * SCALE_GRID_COLUMNS];
+		uint32_t gcds[SCALE_IMPORT_ROWS * SCALE_GRID_COLUMNS];
+		uint32_t numNotes;
+		const Scale scale = {cells, ratios, gcds, SCALE_IMPORT_ROW_SHIFT, 1};
+	};
+
+	/// Allocated on the first import, so a module that never imports doesn't carry the grids.
+	Grid * current = 0;
+	Grid * scratch = 0;
+
+	static int32_t compile(const char * scl, const char * kbm, Grid * out);
+	static int32_t readCache(const char * cachePath, uint32_t sourceSize, uint32_t sourceHash, Grid * out);
+	static void writeCache(const Grid * in, const char * cachePath, uint32_t sourceSize, uint32_t sourceHash);
+
+public:
+
+	~ScaleImport();
+
+	/// Scale to slot into Sync's scaleArray, null until an import has succeeded.
+	const Scale * scale(void) {
+		return current ? &current->scale : 0;
+	}
+
+	/// Compile the tuning at sclPath, mapped by kbmPath if not null (or read its grid from cachePath, which may be null).
+	/// Returns 0 and leaves scale() untouched if either file can't be read or parsed.
+	/// On success scale() returns the new scale, the one it returned before is overwritten by the next import.
+	int32_t import(const char * sclPath, const char * kbmPath, const char * cachePath);
+
+};
+
+#endif
+
+#endif /* INC_SCALE_IMPORT_HPP_ */
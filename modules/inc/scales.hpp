@@ -8,6 +8,10 @@
 #ifndef INC_SCALES_HPP_
 #define INC_SCALES_HPP_
 
+#include <dsp.hpp>
+
+/// Cells in each row of a scale grid, one per 32 steps of the 12 bit ratio control.
+#define SCALE_GRID_COLUMNS 128
 
 /// Data structure for a note in a scale as represented by a precalculated ratio of integers. Generated with (link).
 typedef struct {
@@ -22,13 +26,60 @@ typedef struct {
 
 /// Data structure for a grid of scale notes. Generated with (link).
 typedef struct {
-    /// An array of scales (an array of pointers to notes).
-	const ScaleNote* const** grid;
+    /// Index into ratios and gcds of each cell, rows of SCALE_GRID_COLUMNS cells one after another.
+	const uint16_t * cells;
+	/// 64 bit ratio of each note, integerPart then fractionalPart (scaleRatios for the built in scales).
+	const uint64_t * ratios;
+	/// fundamentalDivision of each note (scaleGCDs for the built in scales).
+	const uint32_t * gcds;
 	/// 12 - log2(number of scales) used to scale a control to an lookup index.
 	const uint32_t t2Bitshift;
 	/// Use 1v_oct control parsing if 1.
 	const uint32_t oneVoltOct;
 } Scale;
 
+/// Flattens a grid of rows of note indices into the cells of a Scale, at compile time.
+template <const uint16_t * const * grid>
+struct ScaleCellGenerator {
+	static constexpr uint16_t value(int32_t index, int32_t) {
+		return grid[index / SCALE_GRID_COLUMNS][index % SCALE_GRID_COLUMNS];
+	}
+};
+
+/// Splits the notes into a table of 64 bit ratios and a table of gcds, so a lookup reads one entry of each.
+template <const ScaleNote * notes>
+struct ScaleRatioGenerator {
+	static constexpr uint64_t value(int32_t index, int32_t) {
+		return ((uint64_t) notes[index].integerPart << 32) | notes[index].fractionalPart;
+	}
+};
+
+template <const ScaleNote * notes>
+struct ScaleGCDGenerator {
+	static constexpr uint32_t value(int32_t index, int32_t) {
+		return notes[index].fundamentalDivision;
+	}
+};
+
+/// Expand a note list X(name, integerPart, fractionalPart, fundamentalDivision) into an index enum and a ScaleNote array.
+#define SCALE_NOTE_INDEX(name, integerPart, fractionalPart, fundamentalDivision) name,
+#define SCALE_NOTE_ENTRY(name, integerPart, fractionalPart, fundamentalDivision) {integerPart, fractionalPart, fundamentalDivision},
+
+/// Rows of a grid that a 12 bit control reaches after the t2Bitshift.
+#define SCALE_GRID_ROWS(bitshift) (1 << (12 - (bitshift)))
+
+/// Define the Scale name, with its cells flattened from the reachable rows of nameGrid.
+#define SCALE_DEF(name, bitshift, voct) \
+	static_assert(sizeof(name##Grid) / sizeof(name##Grid[0]) >= SCALE_GRID_ROWS(bitshift), \
+			#name "Grid has fewer rows than its t2Bitshift reaches"); \
+	static constexpr LookupTable<uint16_t, SCALE_GRID_ROWS(bitshift) * SCALE_GRID_COLUMNS> name##Cells = \
+			generateTable<uint16_t, SCALE_GRID_ROWS(bitshift) * SCALE_GRID_COLUMNS, ScaleCellGenerator<name##Grid>>(); \
+	static const Scale name = { \
+		.cells = name##Cells.data, \
+		.ratios = scaleRatios.data, \
+		.gcds = scaleGCDs.data, \
+		.t2Bitshift = bitshift, \
+		.oneVoltOct = voct};
+
 
 #endif /* INC_SCALES_HPP_ */
@@ -11,6 +11,14 @@
 #include "user_interface.hpp"
 #include <via_platform_binding.hpp>
 #include <scanner_tables.hpp>
+#include <wavetable_import.hpp>
+
+/// With SCANNER_TERRAIN_VECTOR, the virtual build folds the scan indices and reads oversampled blocks with AVX2 kernels
+/// when the host CPU has it, checked once at startup. The kernels match the scalar loops bit for bit.
+/// Define SCANNER_NO_TERRAIN_VECTOR to always take the scalar loops.
+#if defined(BUILD_VIRTUAL) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(SCANNER_NO_TERRAIN_VECTOR)
+#define SCANNER_TERRAIN_VECTOR
+#endif
 
 class ThreeAxisScanner {
 
@@ -26,13 +34,15 @@ private:
 	int32_t * xIndexBuffer;
 	int32_t * yIndexBuffer;
 
-	inline void scanTerrainMultiply(void);
-
-	inline void scanTerrainLighten(void);
+	/// Fill altitude and locationBlend for the block and update the logic states.
+	/// Terrain supplies the combine ops, the interpolation flags only matter to the block rate (not oversampled) read.
+	template<class Terrain, int32_t xInterpolateOff, int32_t yInterpolateOff, int32_t oversampled>
+	void scanTerrain(void);
 
-	inline void scanTerrainSum(void);
+	typedef void (ThreeAxisScanner::*TerrainKernel)(void);
 
-	inline void scanTerrainDifference(void);
+	/// Kernels for the current terrain and interpolation, indexed by oversample.
+	TerrainKernel terrainKernels[2];
 
 	int32_t xReversed = 0;
 	int32_t yReversed = 0;
@@ -168,8 +178,8 @@ private:
 
 public:
 
-	uint32_t *xTable;
-	uint32_t *yTable;
+	const uint32_t *xTable;
+	const uint32_t *yTable;
 
 	int32_t xInput = 0;
 	int32_t yInput = 0;
@@ -198,6 +208,19 @@ public:
 	int32_t hemisphereBlend = 0;
 	int32_t deltaBlend = 0;
 
+#ifdef SCANNER_TERRAIN_VECTOR
+	/// Fold length (a multiple of 8) scan indices into out, the index stepping by increment from a sample after index.
+	typedef void (*FoldKernel)(uint32_t index, int32_t increment, int32_t offset, int32_t length, int32_t * out);
+	/// Oversampled reads of both tables and the terrain combine for length (a multiple of 8) samples.
+	typedef void (*TerrainVectorKernel)(const int32_t * xIndex, const int32_t * yIndex, const int32_t * xTableRead,
+			const int32_t * yTableRead, int32_t morphFrac, int32_t length, int32_t * altitude, int32_t * locationBlend);
+	/// Kernels picked for the host CPU, null to take the scalar loops. terrainVectorKernels is indexed by terrain.
+	static FoldKernel foldKernel;
+	static const TerrainVectorKernel * terrainVectorKernels;
+	/// Kernel for the current terrain, set by selectKernels.
+	TerrainVectorKernel terrainVectorKernel = 0;
+#endif
+
 	// dumb
 	int32_t fix32Mul(int32_t x, int32_t y) {
 		int64_t out = (int64_t) x * (int64_t) y;
@@ -215,15 +238,13 @@ public:
 
 
 	inline void fillBufferExternal(void) {
-		(this->*fillBuffer)();
+		fillBuffer();
 	}
 
-	void (ThreeAxisScanner::*fillBuffer)(void);
+	void fillBuffer(void);
 
-	void fillBufferSum(void);
-	void fillBufferMultiply(void);
-	void fillBufferDifference(void);
-	void fillBufferLighten(void);
+	/// Pick the terrain kernels after a change to terrainType or the interpolation flags.
+	void selectKernels(void);
 
 	inline void scanSetup(void);
 
@@ -424,18 +445,32 @@ public:
 	const Wavetable * wavetableArray[2][8];
 
 	// declare arrays to store the active tables
+#if defined(WAVETABLE_INCREMENTAL_LOAD) && !defined(WAVETABLE_PREDECODED)
+	// front and back buffers for the incremental loaders, the scanner tables follow their front buffers
+	uint32_t wavetableXBuffers[2][5][517];
+	uint32_t wavetableYBuffers[2][5][517];
+	WavetableLoader wavetableXLoader;
+	WavetableLoader wavetableYLoader;
+#elif !defined(WAVETABLE_PREDECODED)
 	uint32_t wavetableXRead[5][517];
 	uint32_t wavetableYRead[5][517];
+#endif
 
 	void fillWavetableArray(void);
 
+#ifdef BUILD_VIRTUAL
+	/// Tables imported from user files, see importWavetable.
+	WavetableImport userWavetables[WAVETABLE_USER_TABLES];
+	/// Import a wav or raw family file into userWavetables[index] and put it at wavetableArray[bank][slot] and any slot
+	/// holding the table the index imported before, switching to it if one of those is playing. cachePath may be null.
+	/// Returns 0 if the import fails or a table change is still fading or loading.
+	int32_t importWavetable(const char * path, const char * cachePath, int32_t index, int32_t bank, int32_t slot);
+#endif
+
 	// declare functions to set the currently active tables
 	void switchWavetableX(const Wavetable *);
 	void switchWavetableY(const Wavetable *);
 
-	// phase distortion table is fixed
-	void initPhaseDistTable(void);
-
 	int32_t reverseBuffer[SCANNER_BUFFER_SIZE*2];
 
 	int32_t reverseSignal = 1;
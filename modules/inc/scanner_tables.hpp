@@ -1,9 +1,9 @@
 #ifndef SCANNER_TABLES
 #define SCANNER_TABLES
 
-#include "tables.hpp"
+#include "shared_tables.hpp"
 
-class ScannerWavetableSet: public WavetableSet {
+class ScannerWavetableSet: public SharedWavetableSet {
 
 public:
 
@@ -292,462 +292,6 @@ public:
 		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
 		32767}
 
-	#define exciteBikeReleaseFamily0 {\
-		0, 1394, 2712, 3956, 5127, 6227, 7259, 8224, 9125, 9962, 10739, 11457, 12118, 12724, 13277, 13779,\
-		14232, 14637, 14998, 15315, 15590, 15827, 16025, 16189, 16319, 16417, 16485, 16526, 16541, 16533, 16502, 16452,\
-		16384, 16299, 16201, 16090, 15970, 15841, 15706, 15566, 15424, 15282, 15142, 15004, 14873, 14748, 14633, 14530,\
-		14439, 14364, 14306, 14267, 14249, 14254, 14284, 14341, 14426, 14543, 14692, 14876, 15096, 15355, 15655, 15997,\
-		16384, 16815, 17290, 17803, 18352, 18932, 19540, 20171, 20823, 21491, 22171, 22861, 23556, 24252, 24946, 25634,\
-		26312, 26976, 27623, 28249, 28851, 29423, 29964, 30468, 30932, 31353, 31727, 32050, 32318, 32527, 32674, 32755,\
-		32766, 32706, 32575, 32379, 32122, 31808, 31440, 31022, 30560, 30056, 29515, 28941, 28338, 27710, 27061, 26395,\
-		25716, 25028, 24335, 23641, 22951, 22267, 21595, 20939, 20301, 19687, 19101, 18546, 18026, 17546, 17110, 16721,\
-		16383, 16101, 15870, 15689, 15553, 15459, 15403, 15383, 15395, 15435, 15500, 15587, 15692, 15812, 15944, 16083,\
-		16227, 16373, 16516, 16653, 16782, 16898, 16998, 17079, 17138, 17170, 17174, 17144, 17078, 16972, 16824, 16628,\
-		16384, 16086, 15740, 15347, 14912, 14437, 13928, 13387, 12817, 12223, 11608, 10975, 10329, 9672, 9008, 8342,\
-		7676, 7013, 6359, 5716, 5087, 4477, 3888, 3326, 2792, 2291, 1826, 1401, 1020, 685, 401, 172,\
-		0, 0, 0, 0, 0, 16, 182, 398, 662, 972, 1326, 1722, 2158, 2633, 3144, 3689,\
-		4268, 4876, 5514, 6178, 6867, 7580, 8313, 9065, 9835, 10620, 11419, 12228, 13048, 13875, 14708, 15545,\
-		16384, 17222, 18059, 18892, 19719, 20539, 21348, 22147, 22932, 23702, 24454, 25187, 25900, 26589, 27253, 27890,\
-		28499, 29077, 29623, 30134, 30608, 31045, 31441, 31795, 32104, 32368, 32584, 32750, 32767, 32767, 32767, 32767,\
-		32767}
-
-	#define exciteBikeReleaseFamily1 {\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 303, 623, 958, 1308, 1674, 2054, 2449, 2858, 3282, 3719, 4170, 4634, 5112, 5602, 6106,\
-		6622, 7150, 7690, 8242, 8805, 9380, 9966, 10562, 11170, 11788, 12415, 13053, 13701, 14358, 15024, 15699,\
-		16384, 17076, 17775, 18479, 19186, 19894, 20601, 21306, 22007, 22701, 23388, 24065, 24730, 25381, 26018, 26637,\
-		27237, 27817, 28374, 28906, 29412, 29890, 30338, 30754, 31137, 31484, 31794, 32064, 32294, 32481, 32623, 32719,\
-		32767, 32764, 32714, 32616, 32473, 32286, 32057, 31787, 31478, 31131, 30749, 30332, 29881, 29400, 28889, 28349,\
-		27783, 27192, 26578, 25941, 25284, 24609, 23916, 23207, 22485, 21749, 21003, 20248, 19484, 18715, 17940, 17163,\
-		16383, 15604, 14827, 14052, 13283, 12519, 11764, 11018, 10282, 9560, 8851, 8158, 7482, 6825, 6189, 5574,\
-		4983, 4417, 3878, 3366, 2885, 2435, 2018, 1635, 1288, 979, 709, 480, 293, 150, 52, 2,\
-		0, 47, 143, 285, 472, 702, 972, 1282, 1629, 2012, 2428, 2876, 3354, 3860, 4393, 4950,\
-		5529, 6129, 6749, 7385, 8037, 8702, 9379, 10066, 10760, 11461, 12166, 12873, 13581, 14288, 14992, 15691,\
-		16383, 17068, 17743, 18409, 19066, 19714, 20352, 20979, 21597, 22205, 22801, 23387, 23962, 24525, 25077, 25617,\
-		26145, 26661, 27164, 27655, 28132, 28597, 29048, 29485, 29908, 30317, 30712, 31092, 31458, 31808, 32143, 32463,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767}
-
-	#define exciteBikeReleaseFamily2 {\
-		0, 2256, 4417, 6486, 8463, 10350, 12149, 13861, 15487, 17029, 18489, 19867, 21167, 22388, 23533, 24602,\
-		25598, 26523, 27376, 28161, 28878, 29530, 30116, 30640, 31102, 31505, 31848, 32135, 32366, 32544, 32668, 32742,\
-		32767, 32743, 32673, 32557, 32399, 32198, 31957, 31676, 31359, 31005, 30617, 30196, 29743, 29260, 28749, 28211,\
-		27647, 27059, 26449, 25818, 25167, 24498, 23813, 23113, 22399, 21674, 20937, 20192, 19439, 18681, 17917, 17151,\
-		16384, 15616, 14850, 14086, 13328, 12575, 11830, 11093, 10368, 9654, 8954, 8268, 7600, 6949, 6318, 5707,\
-		5120, 4556, 4018, 3506, 3024, 2571, 2150, 1761, 1408, 1090, 810, 568, 368, 209, 93, 23,\
-		0, 23, 94, 209, 368, 568, 810, 1090, 1408, 1761, 2150, 2571, 3024, 3506, 4018, 4556,\
-		5120, 5707, 6318, 6949, 7600, 8268, 8954, 9654, 10368, 11093, 11830, 12575, 13328, 14086, 14850, 15616,\
-		16384, 17151, 17917, 18681, 19439, 20192, 20937, 21674, 22399, 23113, 23813, 24498, 25167, 25818, 26449, 27059,\
-		27647, 28211, 28749, 29260, 29743, 30195, 30617, 31005, 31359, 31676, 31957, 32198, 32399, 32557, 32673, 32743,\
-		32766, 32743, 32673, 32557, 32399, 32198, 31957, 31676, 31359, 31005, 30617, 30195, 29743, 29260, 28749, 28211,\
-		27647, 27059, 26449, 25818, 25167, 24498, 23813, 23113, 22399, 21673, 20937, 20192, 19439, 18681, 17917, 17151,\
-		16383, 15616, 14850, 14086, 13328, 12575, 11830, 11093, 10368, 9654, 8954, 8268, 7600, 6949, 6318, 5707,\
-		5120, 4556, 4018, 3506, 3024, 2571, 2150, 1761, 1408, 1090, 810, 568, 368, 209, 94, 23,\
-		0, 24, 97, 222, 399, 631, 917, 1261, 1663, 2126, 2649, 3236, 3887, 4604, 5389, 6243,\
-		7167, 8163, 9233, 10378, 11599, 12898, 14277, 15737, 17279, 18905, 20617, 22415, 24303, 26280, 28349, 30510,\
-		32767}
-
-	#define exciteBikeReleaseFamily3 {\
-		0, 435, 862, 1280, 1690, 2092, 2485, 2871, 3250, 3622, 3987, 4345, 4698, 5044, 5385, 5721,\
-		6052, 6378, 6700, 7018, 7332, 7643, 7950, 8254, 8556, 8856, 9153, 9449, 9743, 10036, 10328, 10620,\
-		10912, 11203, 11495, 11787, 12080, 12375, 12671, 12968, 13268, 13570, 13875, 14183, 14494, 14808, 15126, 15449,\
-		15776, 16107, 16444, 16785, 17133, 17486, 17845, 18211, 18584, 18963, 19350, 19745, 20147, 20558, 20977, 21405,\
-		21843, 22289, 22743, 23203, 23669, 24138, 24609, 25081, 25551, 26020, 26484, 26944, 27396, 27840, 28275, 28698,\
-		29109, 29506, 29887, 30251, 30597, 30922, 31226, 31508, 31765, 31996, 32199, 32374, 32519, 32632, 32712, 32757,\
-		32767, 32739, 32675, 32576, 32445, 32283, 32090, 31870, 31623, 31352, 31057, 30740, 30402, 30047, 29674, 29286,\
-		28883, 28469, 28043, 27609, 27167, 26719, 26266, 25811, 25354, 24898, 24444, 23993, 23547, 23107, 22676, 22255,\
-		21845, 21447, 21061, 20687, 20323, 19969, 19623, 19286, 18955, 18630, 18311, 17996, 17685, 17377, 17070, 16765,\
-		16460, 16154, 15847, 15537, 15225, 14908, 14587, 14260, 13927, 13586, 13237, 12878, 12510, 12132, 11741, 11339,\
-		10922, 10493, 10051, 9598, 9137, 8669, 8196, 7719, 7241, 6763, 6288, 5816, 5350, 4891, 4442, 4004,\
-		3578, 3168, 2774, 2398, 2043, 1709, 1399, 1114, 857, 629, 432, 268, 138, 44, 0, 0,\
-		0, 69, 180, 332, 524, 754, 1020, 1322, 1658, 2026, 2426, 2856, 3314, 3800, 4311, 4847,\
-		5406, 5986, 6587, 7208, 7845, 8500, 9169, 9851, 10546, 11252, 11968, 12691, 13421, 14157, 14897, 15640,\
-		16383, 17127, 17870, 18610, 19346, 20076, 20799, 21515, 22221, 22915, 23598, 24267, 24921, 25559, 26179, 26780,\
-		27361, 27920, 28456, 28967, 29452, 29911, 30340, 30740, 31109, 31444, 31746, 32013, 32242, 32434, 32586, 32697,\
-		32767}
-
-	#define exciteBikeReleaseFamily4 {\
-		0, 1634, 3187, 4662, 6061, 7384, 8635, 9815, 10926, 11970, 12948, 13864, 14717, 15512, 16249, 16930,\
-		17557, 18133, 18659, 19136, 19568, 19955, 20300, 20605, 20871, 21100, 21295, 21457, 21588, 21691, 21766, 21816,\
-		21843, 21848, 21834, 21802, 21755, 21695, 21622, 21539, 21449, 21352, 21252, 21149, 21045, 20944, 20845, 20752,\
-		20667, 20590, 20525, 20473, 20435, 20414, 20413, 20431, 20472, 20538, 20630, 20750, 20901, 21083, 21300, 21552,\
-		21843, 22171, 22537, 22934, 23361, 23814, 24288, 24781, 25289, 25808, 26335, 26867, 27399, 27929, 28452, 28965,\
-		29465, 29949, 30411, 30850, 31262, 31642, 31988, 32295, 32561, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32766, 32500, 32164, 31763, 31302, 30784, 30214, 29595, 28933, 28231, 27494, 26726, 25931, 25114, 24278, 23428,\
-		22568, 21702, 20835, 19971, 19114, 18268, 17438, 16627, 15841, 15083, 14357, 13668, 13020, 12417, 11863, 11363,\
-		10922, 10541, 10218, 9951, 9736, 9570, 9448, 9368, 9327, 9320, 9345, 9398, 9475, 9573, 9689, 9820,\
-		9961, 10110, 10263, 10417, 10568, 10713, 10848, 10970, 11076, 11162, 11225, 11261, 11267, 11240, 11175, 11071,\
-		10922, 10728, 10490, 10212, 9897, 9548, 9169, 8764, 8335, 7887, 7423, 6945, 6458, 5965, 5469, 4975,\
-		4484, 4001, 3529, 3071, 2632, 2214, 1820, 1455, 1121, 822, 562, 344, 171, 46, 0, 0,\
-		0, 103, 267, 489, 766, 1097, 1478, 1909, 2385, 2906, 3469, 4071, 4711, 5385, 6093, 6831,\
-		7597, 8389, 9204, 10041, 10897, 11770, 12657, 13556, 14465, 15382, 16304, 17230, 18156, 19080, 20001, 20916,\
-		21823, 22718, 23601, 24469, 25319, 26150, 26958, 27742, 28500, 29228, 29926, 30590, 31218, 31809, 32359, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767}
-
-	#define skipsaw0 {\
-		0, 128, 256, 384, 512, 640, 768, 896, 1024, 1152, 1280, 1408, 1536, 1664, 1792, 1920,\
-		2047, 2175, 2303, 2431, 2559, 2687, 2815, 2944, 3072, 3200, 3328, 3456, 3584, 3712, 3840, 3968,\
-		4096, 4224, 4352, 4480, 4608, 4736, 4863, 4992, 5120, 5248, 5376, 5504, 5632, 5760, 5888, 6015,\
-		6144, 6272, 6400, 6528, 6655, 6783, 6911, 7039, 7168, 7296, 7424, 7552, 7680, 7807, 7935, 8063,\
-		8192, 8320, 8448, 8576, 8703, 8831, 8959, 9087, 9216, 9344, 9472, 9600, 9728, 9855, 9983, 10111,\
-		10240, 10368, 10496, 10624, 10752, 10879, 11007, 11135, 11264, 11392, 11520, 11648, 11776, 11903, 12031, 12159,\
-		12288, 12416, 12544, 12672, 12800, 12927, 13055, 13183, 13312, 13440, 13568, 13696, 13824, 13951, 14079, 14207,\
-		14335, 14464, 14592, 14720, 14847, 14975, 15103, 15231, 15360, 15488, 15616, 15744, 15872, 15999, 16127, 16255,\
-		16382, 16510, 16638, 16766, 16895, 17023, 17151, 17279, 17407, 17534, 17662, 17790, 17919, 18047, 18175, 18303,\
-		18431, 18558, 18686, 18814, 18943, 19071, 19199, 19327, 19454, 19582, 19710, 19838, 19967, 20095, 20223, 20351,\
-		20479, 20606, 20734, 20862, 20991, 21119, 21247, 21375, 21503, 21630, 21758, 21886, 22015, 22143, 22271, 22399,\
-		22527, 22654, 22782, 22910, 23038, 23167, 23295, 23423, 23551, 23678, 23806, 23934, 24063, 24191, 24319, 24447,\
-		24575, 24702, 24830, 24958, 25087, 25215, 25343, 25471, 25599, 25727, 25854, 25982, 26110, 26238, 26366, 26495,\
-		26622, 26750, 26879, 27007, 27134, 27262, 27390, 27518, 27646, 27774, 27903, 28031, 28159, 28287, 28415, 28542,\
-		28670, 28798, 28926, 29055, 29183, 29311, 29438, 29566, 29694, 29822, 29950, 30079, 30207, 30335, 30462, 30590,\
-		30718, 30846, 30975, 31103, 31231, 31359, 31487, 31615, 31743, 31871, 31999, 32127, 32255, 32383, 32511, 32639,\
-		32767}
-
-	#define skipsaw1 {\
-		0, 193, 386, 579, 772, 965, 1158, 1351, 1544, 1737, 1930, 2123, 2316, 2509, 2702, 2895,\
-		3088, 3281, 3473, 3666, 3859, 4053, 4246, 4439, 4632, 4824, 5017, 5210, 5404, 5597, 5790, 5983,\
-		6176, 6368, 6561, 6754, 6948, 7141, 7334, 7527, 7719, 7912, 8105, 8298, 8492, 8685, 8878, 9071,\
-		9264, 9456, 9649, 9842, 10036, 10229, 10422, 10615, 10808, 11000, 11193, 11386, 11580, 11773, 11966, 12159,\
-		12352, 12544, 12737, 12930, 13124, 13317, 13510, 13703, 13896, 14088, 14281, 14474, 14668, 14861, 15054, 15247,\
-		15440, 15632, 15825, 16018, 16211, 16405, 16598, 16791, 16984, 17176, 17369, 17562, 17756, 17949, 18142, 18335,\
-		18527, 18720, 18913, 19106, 19300, 19493, 19686, 19879, 20072, 20263, 20455, 20648, 20843, 21041, 21238, 21431,\
-		21616, 21791, 21969, 22163, 22388, 22645, 22894, 23083, 23160, 23113, 23097, 23305, 23932, 25017, 25990, 26127,\
-		24704, 21307, 16769, 12231, 8835, 7411, 7548, 8521, 9607, 10233, 10441, 10425, 10379, 10455, 10644, 10893,\
-		11151, 11375, 11569, 11747, 11923, 12107, 12300, 12497, 12694, 12890, 13083, 13275, 13466, 13659, 13852, 14045,\
-		14239, 14432, 14625, 14818, 15010, 15203, 15396, 15589, 15783, 15976, 16169, 16362, 16555, 16747, 16940, 17133,\
-		17327, 17520, 17713, 17906, 18099, 18291, 18484, 18677, 18871, 19064, 19257, 19450, 19643, 19835, 20028, 20221,\
-		20415, 20608, 20801, 20994, 21187, 21379, 21572, 21765, 21959, 22152, 22345, 22538, 22730, 22923, 23116, 23309,\
-		23503, 23696, 23889, 24082, 24275, 24467, 24660, 24853, 25047, 25240, 25433, 25626, 25819, 26011, 26204, 26397,\
-		26591, 26784, 26977, 27170, 27363, 27555, 27748, 27941, 28135, 28328, 28521, 28714, 28907, 29099, 29292, 29485,\
-		29678, 29872, 30065, 30258, 30451, 30644, 30837, 31030, 31223, 31416, 31609, 31802, 31995, 32188, 32381, 32574,\
-		32767}
-
-	#define skipsaw2 {\
-		0, 258, 516, 775, 1033, 1292, 1551, 1809, 2068, 2326, 2584, 2843, 3102, 3360, 3619, 3877,\
-		4136, 4394, 4652, 4911, 5169, 5428, 5687, 5945, 6204, 6462, 6720, 6979, 7238, 7496, 7755, 8013,\
-		8272, 8530, 8788, 9047, 9306, 9564, 9823, 10082, 10340, 10599, 10858, 11116, 11375, 11633, 11891, 12150,\
-		12408, 12667, 12926, 13184, 13443, 13701, 13959, 14218, 14476, 14735, 14994, 15253, 15511, 15768, 16025, 16284,\
-		16545, 16808, 17070, 17328, 17578, 17820, 18063, 18323, 18612, 18935, 19250, 19504, 19647, 19665, 19714, 19987,\
-		20680, 21835, 22876, 23078, 21715, 18370, 13878, 9387, 6043, 4679, 4881, 5922, 7076, 7770, 8043, 8092,\
-		8111, 8253, 8507, 8822, 9144, 9434, 9694, 9937, 10179, 10429, 10687, 10949, 11213, 11473, 11732, 11989,\
-		12247, 12504, 12763, 13022, 13281, 13539, 13798, 14056, 14314, 14573, 14831, 15090, 15349, 15607, 15865, 16124,\
-		16382, 16641, 16900, 17159, 17418, 17676, 17935, 18193, 18452, 18710, 18968, 19227, 19486, 19744, 20003, 20262,\
-		20520, 20777, 21034, 21293, 21554, 21817, 22079, 22337, 22588, 22829, 23072, 23332, 23622, 23944, 24259, 24513,\
-		24656, 24674, 24723, 24996, 25690, 26844, 27885, 28087, 26724, 23379, 18887, 14396, 11052, 9688, 9890, 10931,\
-		12086, 12779, 13052, 13101, 13120, 13262, 13516, 13831, 14154, 14443, 14703, 14946, 15188, 15438, 15696, 15958,\
-		16222, 16482, 16741, 16998, 17255, 17513, 17772, 18031, 18290, 18548, 18807, 19065, 19323, 19582, 19840, 20099,\
-		20358, 20616, 20875, 21133, 21391, 21650, 21908, 22167, 22426, 22684, 22943, 23202, 23461, 23719, 23978, 24236,\
-		24495, 24753, 25011, 25270, 25529, 25787, 26046, 26304, 26562, 26821, 27079, 27338, 27596, 27855, 28114, 28372,\
-		28630, 28889, 29147, 29406, 29665, 29923, 30182, 30440, 30699, 30957, 31215, 31474, 31732, 31991, 32250, 32508,\
-		32767}
-
-	#define skipsaw3 {\
-		0, 324, 649, 973, 1297, 1622, 1946, 2271, 2596, 2920, 3245, 3570, 3894, 4219, 4544, 4868,\
-		5193, 5517, 5841, 6166, 6490, 6815, 7140, 7464, 7789, 8113, 8437, 8762, 9086, 9411, 9736, 10061,\
-		10386, 10710, 11034, 11359, 11684, 12008, 12333, 12658, 12981, 13305, 13628, 13953, 14280, 14609, 14937, 15261,\
-		15578, 15885, 16195, 16520, 16876, 17266, 17647, 17967, 18175, 18258, 18372, 18712, 19473, 20696, 21807, 22075,\
-		20771, 17478, 13033, 8589, 5297, 3992, 4260, 5371, 6595, 7355, 7695, 7809, 7892, 8100, 8420, 8801,\
-		9190, 9547, 9872, 10182, 10490, 10806, 11130, 11458, 11788, 12114, 12439, 12762, 13086, 13409, 13734, 14059,\
-		14384, 14708, 15032, 15357, 15681, 16007, 16332, 16656, 16981, 17304, 17627, 17952, 18279, 18608, 18936, 19260,\
-		19577, 19884, 20193, 20519, 20875, 21264, 21644, 21965, 22173, 22256, 22370, 22710, 23472, 24695, 25806, 26074,\
-		24770, 21476, 17032, 12588, 9294, 7990, 8259, 9370, 10594, 11355, 11694, 11808, 11891, 12099, 12419, 12800,\
-		13190, 13545, 13871, 14180, 14488, 14804, 15128, 15456, 15785, 16112, 16437, 16761, 17085, 17409, 17733, 18058,\
-		18383, 18707, 19031, 19356, 19680, 20005, 20330, 20655, 20979, 21302, 21625, 21950, 22277, 22606, 22935, 23259,\
-		23576, 23883, 24192, 24518, 24874, 25263, 25643, 25964, 26172, 26255, 26369, 26709, 27470, 28693, 29804, 30072,\
-		28768, 25475, 21030, 16586, 13294, 11989, 12257, 13368, 14592, 15352, 15692, 15806, 15890, 16097, 16418, 16799,\
-		17189, 17544, 17870, 18179, 18487, 18803, 19127, 19455, 19785, 20111, 20436, 20759, 21083, 21406, 21731, 22056,\
-		22381, 22705, 23030, 23355, 23680, 24004, 24329, 24653, 24978, 25302, 25626, 25951, 26276, 26600, 26925, 27249,\
-		27574, 27898, 28222, 28547, 28872, 29196, 29521, 29846, 30171, 30495, 30820, 31144, 31469, 31793, 32117, 32442,\
-		32767}
-
-	#define skipsaw4 {\
-		0, 390, 781, 1172, 1564, 1955, 2346, 2737, 3129, 3520, 3910, 4301, 4693, 5084, 5475, 5866,\
-		6258, 6648, 7039, 7430, 7821, 8213, 8605, 8996, 9387, 9776, 10166, 10557, 10951, 11346, 11742, 12133,\
-		12516, 12889, 13265, 13657, 14080, 14535, 14983, 15370, 15644, 15793, 15973, 16379, 17209, 18502, 19683, 20017,\
-		18773, 15531, 11135, 6738, 3497, 2253, 2588, 3769, 5063, 5892, 6298, 6477, 6626, 6900, 7288, 7735,\
-		8192, 8614, 9006, 9382, 9755, 10138, 10529, 10924, 11321, 11714, 12105, 12495, 12885, 13274, 13664, 14056,\
-		14449, 14845, 15241, 15631, 16013, 16387, 16763, 17155, 17578, 18034, 18482, 18869, 19143, 19292, 19471, 19877,\
-		20707, 22000, 23181, 23516, 22272, 19031, 14634, 10238, 6997, 5752, 6086, 7267, 8561, 9390, 9796, 9976,\
-		10126, 10399, 10786, 11234, 11690, 12112, 12505, 12881, 13255, 13637, 14028, 14423, 14819, 15212, 15603, 15993,\
-		16382, 16772, 17162, 17554, 17947, 18343, 18738, 19129, 19511, 19885, 20261, 20654, 21076, 21532, 21980, 22367,\
-		22640, 22790, 22970, 23376, 24206, 25499, 26680, 27014, 25769, 22528, 18132, 13735, 10495, 9250, 9585, 10766,\
-		12060, 12889, 13295, 13474, 13623, 13897, 14284, 14732, 15189, 15611, 16003, 16379, 16752, 17135, 17525, 17921,\
-		18317, 18710, 19102, 19492, 19881, 20271, 20661, 21052, 21446, 21842, 22237, 22628, 23011, 23384, 23760, 24152,\
-		24575, 25031, 25478, 25866, 26139, 26289, 26468, 26874, 27704, 28997, 30178, 30513, 29268, 26028, 21631, 17235,\
-		13994, 12749, 13083, 14264, 15558, 16387, 16793, 16973, 17123, 17396, 17783, 18231, 18687, 19109, 19501, 19877,\
-		20250, 20633, 21024, 21420, 21816, 22209, 22600, 22990, 23380, 23770, 24161, 24553, 24945, 25336, 25727, 26118,\
-		26508, 26900, 27291, 27682, 28074, 28465, 28856, 29246, 29638, 30029, 30420, 30811, 31203, 31594, 31985, 32376,\
-		32767}
-
-	#define circular_257_slopes0 {\
-		0, 0, 1, 2, 4, 6, 9, 12, 16, 20, 25, 30, 36, 42, 49, 56,\
-		64, 72, 81, 90, 100, 110, 121, 133, 144, 157, 169, 183, 197, 211, 226, 241,\
-		257, 273, 290, 308, 326, 344, 363, 382, 402, 423, 444, 466, 488, 510, 533, 557,\
-		581, 606, 631, 657, 683, 710, 737, 765, 794, 823, 852, 882, 913, 944, 975, 1008,\
-		1040, 1074, 1108, 1142, 1177, 1213, 1249, 1285, 1323, 1360, 1399, 1438, 1477, 1517, 1558, 1599,\
-		1641, 1683, 1726, 1770, 1814, 1859, 1904, 1950, 1997, 2044, 2092, 2140, 2189, 2239, 2289, 2340,\
-		2391, 2443, 2496, 2549, 2603, 2658, 2713, 2769, 2826, 2883, 2941, 2999, 3059, 3119, 3179, 3240,\
-		3302, 3365, 3428, 3492, 3557, 3622, 3688, 3755, 3823, 3891, 3960, 4030, 4100, 4172, 4244, 4316,\
-		4390, 4464, 4539, 4615, 4692, 4769, 4847, 4926, 5006, 5087, 5168, 5251, 5334, 5418, 5503, 5589,\
-		5675, 5763, 5851, 5941, 6031, 6122, 6214, 6307, 6401, 6496, 6592, 6689, 6787, 6886, 6985, 7086,\
-		7188, 7291, 7395, 7500, 7607, 7714, 7823, 7932, 8043, 8155, 8268, 8382, 8498, 8614, 8732, 8852,\
-		8972, 9094, 9217, 9342, 9467, 9595, 9723, 9854, 9985, 10118, 10253, 10389, 10527, 10666, 10807, 10949,\
-		11094, 11240, 11387, 11537, 11688, 11842, 11997, 12154, 12313, 12474, 12638, 12803, 12971, 13141, 13313, 13488,\
-		13665, 13845, 14027, 14212, 14400, 14590, 14784, 14980, 15180, 15383, 15589, 15798, 16012, 16229, 16450, 16675,\
-		16904, 17137, 17376, 17619, 17867, 18120, 18379, 18644, 18915, 19193, 19478, 19770, 20070, 20379, 20697, 21025,\
-		21365, 21716, 22080, 22458, 22852, 23265, 23698, 24155, 24640, 25157, 25714, 26323, 26997, 27765, 28679, 29874,\
-		32767}
-
-	#define circular_257_slopes1 {\
-		0, 0, 2, 5, 8, 13, 18, 25, 32, 41, 50, 61, 72, 85, 98, 113,\
-		129, 145, 163, 181, 201, 222, 244, 267, 291, 316, 342, 369, 397, 426, 456, 488,\
-		520, 554, 589, 624, 661, 699, 739, 779, 821, 863, 907, 952, 998, 1046, 1095, 1144,\
-		1196, 1248, 1302, 1357, 1413, 1470, 1529, 1590, 1651, 1714, 1778, 1844, 1911, 1980, 2050, 2122,\
-		2195, 2270, 2346, 2424, 2503, 2584, 2667, 2751, 2838, 2926, 3015, 3107, 3201, 3296, 3393, 3493,\
-		3594, 3698, 3803, 3911, 4021, 4134, 4249, 4366, 4486, 4609, 4734, 4862, 4993, 5126, 5263, 5403,\
-		5547, 5694, 5844, 5998, 6157, 6319, 6486, 6657, 6833, 7014, 7200, 7392, 7590, 7794, 8006, 8225,\
-		8452, 8688, 8933, 9189, 9458, 9739, 10035, 10349, 10682, 11040, 11426, 11849, 12320, 12857, 13499, 14340,\
-		16383, 18427, 19268, 19910, 20447, 20918, 21341, 21727, 22085, 22418, 22732, 23028, 23309, 23578, 23834, 24079,\
-		24315, 24542, 24761, 24973, 25177, 25375, 25567, 25753, 25934, 26110, 26281, 26448, 26610, 26769, 26923, 27073,\
-		27220, 27364, 27504, 27641, 27774, 27905, 28033, 28158, 28281, 28401, 28518, 28633, 28746, 28856, 28964, 29069,\
-		29173, 29274, 29374, 29471, 29566, 29660, 29752, 29841, 29929, 30016, 30100, 30183, 30264, 30343, 30421, 30497,\
-		30572, 30645, 30717, 30787, 30856, 30923, 30989, 31053, 31116, 31177, 31238, 31297, 31354, 31410, 31465, 31519,\
-		31571, 31623, 31672, 31721, 31769, 31815, 31860, 31904, 31946, 31988, 32028, 32068, 32106, 32143, 32178, 32213,\
-		32247, 32279, 32311, 32341, 32370, 32398, 32425, 32451, 32476, 32500, 32523, 32545, 32566, 32586, 32604, 32622,\
-		32638, 32654, 32669, 32682, 32695, 32706, 32717, 32726, 32735, 32742, 32749, 32754, 32759, 32762, 32765, 32767,\
-		32767}
-
-	#define circular_257_slopes2 {\
-		0, 2044, 2885, 3526, 4064, 4534, 4957, 5344, 5701, 6035, 6348, 6645, 6926, 7194, 7450, 7696,\
-		7932, 8159, 8378, 8589, 8794, 8992, 9184, 9370, 9551, 9727, 9898, 10065, 10227, 10385, 10539, 10690,\
-		10837, 10980, 11120, 11257, 11391, 11522, 11650, 11775, 11897, 12017, 12135, 12250, 12362, 12472, 12580, 12686,\
-		12789, 12891, 12990, 13088, 13183, 13276, 13368, 13458, 13546, 13632, 13716, 13799, 13880, 13960, 14038, 14114,\
-		14189, 14262, 14333, 14403, 14472, 14539, 14605, 14669, 14732, 14794, 14854, 14913, 14971, 15027, 15082, 15136,\
-		15188, 15239, 15289, 15338, 15385, 15431, 15476, 15520, 15563, 15605, 15645, 15684, 15722, 15759, 15795, 15830,\
-		15863, 15896, 15927, 15957, 15987, 16015, 16042, 16068, 16093, 16117, 16140, 16162, 16182, 16202, 16221, 16238,\
-		16255, 16271, 16285, 16299, 16311, 16323, 16333, 16343, 16351, 16359, 16365, 16371, 16375, 16379, 16381, 16383,\
-		16383, 16384, 16386, 16388, 16392, 16396, 16402, 16408, 16416, 16424, 16434, 16444, 16456, 16468, 16482, 16496,\
-		16512, 16529, 16546, 16565, 16585, 16605, 16627, 16650, 16674, 16699, 16725, 16752, 16780, 16810, 16840, 16871,\
-		16904, 16937, 16972, 17008, 17045, 17083, 17122, 17162, 17204, 17247, 17291, 17336, 17382, 17429, 17478, 17528,\
-		17579, 17631, 17685, 17740, 17796, 17854, 17913, 17973, 18035, 18098, 18162, 18228, 18295, 18364, 18434, 18505,\
-		18578, 18653, 18729, 18807, 18887, 18968, 19051, 19135, 19221, 19309, 19399, 19491, 19584, 19679, 19777, 19876,\
-		19978, 20081, 20187, 20295, 20405, 20517, 20632, 20750, 20870, 20992, 21117, 21245, 21376, 21510, 21647, 21787,\
-		21930, 22077, 22228, 22382, 22540, 22702, 22869, 23040, 23216, 23397, 23583, 23775, 23973, 24178, 24389, 24608,\
-		24835, 25071, 25317, 25573, 25841, 26122, 26419, 26732, 27066, 27423, 27810, 28233, 28703, 29241, 29882, 30723,\
-		32767}
-
-	#define circular_257_slopes3 {\
-		0, 2893, 4088, 5002, 5770, 6444, 7053, 7610, 8127, 8612, 9069, 9502, 9915, 10309, 10687, 11051,\
-		11402, 11742, 12070, 12388, 12697, 12997, 13289, 13574, 13852, 14123, 14388, 14647, 14900, 15148, 15391, 15630,\
-		15863, 16092, 16317, 16538, 16755, 16969, 17178, 17384, 17587, 17787, 17983, 18177, 18367, 18555, 18740, 18922,\
-		19102, 19279, 19454, 19626, 19796, 19964, 20129, 20293, 20454, 20613, 20770, 20925, 21079, 21230, 21380, 21527,\
-		21673, 21818, 21960, 22101, 22240, 22378, 22514, 22649, 22782, 22913, 23044, 23172, 23300, 23425, 23550, 23673,\
-		23795, 23915, 24035, 24153, 24269, 24385, 24499, 24612, 24724, 24835, 24944, 25053, 25160, 25267, 25372, 25476,\
-		25579, 25681, 25782, 25881, 25980, 26078, 26175, 26271, 26366, 26460, 26553, 26645, 26736, 26826, 26916, 27004,\
-		27092, 27178, 27264, 27349, 27433, 27516, 27599, 27680, 27761, 27841, 27920, 27998, 28075, 28152, 28228, 28303,\
-		28377, 28451, 28523, 28595, 28667, 28737, 28807, 28876, 28944, 29012, 29079, 29145, 29210, 29275, 29339, 29402,\
-		29465, 29527, 29588, 29648, 29708, 29768, 29826, 29884, 29941, 29998, 30054, 30109, 30164, 30218, 30271, 30324,\
-		30376, 30427, 30478, 30528, 30578, 30627, 30675, 30723, 30770, 30817, 30863, 30908, 30953, 30997, 31041, 31084,\
-		31126, 31168, 31209, 31250, 31290, 31329, 31368, 31407, 31444, 31482, 31518, 31554, 31590, 31625, 31659, 31693,\
-		31727, 31759, 31792, 31823, 31854, 31885, 31915, 31944, 31973, 32002, 32030, 32057, 32084, 32110, 32136, 32161,\
-		32186, 32210, 32234, 32257, 32279, 32301, 32323, 32344, 32365, 32385, 32404, 32423, 32441, 32459, 32477, 32494,\
-		32510, 32526, 32541, 32556, 32570, 32584, 32598, 32610, 32623, 32634, 32646, 32657, 32667, 32677, 32686, 32695,\
-		32703, 32711, 32718, 32725, 32731, 32737, 32742, 32747, 32751, 32755, 32758, 32761, 32763, 32765, 32766, 32767,\
-		32767}
-
-	#define test_fm_attack0 {\
-		0, 24, 89, 193, 336, 515, 732, 988, 1279, 1605, 1964, 2359, 2785, 3242, 3728, 4244,\
-		4786, 5353, 5944, 6558, 7192, 7845, 8515, 9201, 9901, 10613, 11334, 12065, 12802, 13544, 14288, 15036,\
-		15782, 16525, 17265, 18001, 18731, 19451, 20161, 20862, 21550, 22223, 22881, 23525, 24151, 24758, 25346, 25916,\
-		26464, 26991, 27495, 27978, 28438, 28873, 29285, 29674, 30038, 30377, 30692, 30982, 31249, 31490, 31708, 31902,\
-		32072, 32219, 32342, 32444, 32523, 32580, 32617, 32633, 32630, 32606, 32564, 32505, 32428, 32334, 32224, 32099,\
-		31960, 31806, 31640, 31462, 31272, 31071, 30859, 30639, 30410, 30173, 29928, 29677, 29420, 29158, 28890, 28619,\
-		28345, 28067, 27787, 27506, 27223, 26939, 26655, 26372, 26089, 25808, 25528, 25250, 24974, 24701, 24431, 24165,\
-		23902, 23643, 23388, 23138, 22893, 22652, 22417, 22187, 21963, 21744, 21531, 21324, 21124, 20930, 20742, 20560,\
-		20385, 20217, 20056, 19901, 19753, 19612, 19478, 19351, 19231, 19118, 19013, 18914, 18821, 18737, 18659, 18588,\
-		18525, 18469, 18419, 18377, 18342, 18314, 18292, 18278, 18270, 18270, 18276, 18290, 18310, 18337, 18370, 18411,\
-		18458, 18511, 18571, 18638, 18711, 18791, 18877, 18969, 19067, 19172, 19283, 19400, 19522, 19651, 19786, 19925,\
-		20070, 20222, 20379, 20541, 20708, 20880, 21057, 21238, 21424, 21616, 21811, 22010, 22214, 22422, 22633, 22847,\
-		23065, 23286, 23511, 23737, 23966, 24198, 24432, 24667, 24904, 25143, 25383, 25623, 25863, 26105, 26347, 26588,\
-		26828, 27068, 27307, 27544, 27779, 28013, 28245, 28474, 28699, 28922, 29142, 29357, 29568, 29775, 29978, 30175,\
-		30367, 30554, 30735, 30909, 31077, 31239, 31394, 31541, 31681, 31814, 31939, 32055, 32163, 32264, 32356, 32438,\
-		32511, 32577, 32633, 32678, 32714, 32742, 32760, 32767, 32764, 32753, 32732, 32700, 32658, 32608, 32548, 32477,\
-		32396}
-
-	#define test_fm_attack1 {\
-		0, 11, 59, 143, 265, 424, 621, 855, 1127, 1435, 1780, 2160, 2575, 3024, 3505, 4017,\
-		4560, 5130, 5727, 6349, 6993, 7659, 8343, 9045, 9760, 10488, 11226, 11972, 12724, 13480, 14238, 14994,\
-		15748, 16497, 17239, 17973, 18697, 19410, 20109, 20793, 21462, 22113, 22746, 23359, 23953, 24525, 25077, 25607,\
-		26114, 26599, 27062, 27501, 27918, 28314, 28687, 29038, 29368, 29677, 29966, 30234, 30484, 30715, 30929, 31125,\
-		31306, 31470, 31621, 31757, 31881, 31992, 32093, 32182, 32261, 32332, 32394, 32449, 32497, 32538, 32574, 32604,\
-		32630, 32652, 32671, 32686, 32699, 32709, 32718, 32725, 32730, 32734, 32737, 32739, 32740, 32741, 32740, 32738,\
-		32736, 32733, 32729, 32723, 32717, 32708, 32698, 32685, 32671, 32654, 32634, 32610, 32583, 32552, 32518, 32478,\
-		32433, 32383, 32327, 32265, 32196, 32121, 32038, 31948, 31851, 31745, 31631, 31508, 31376, 31235, 31085, 30926,\
-		30757, 30578, 30390, 30193, 29986, 29769, 29543, 29307, 29063, 28809, 28547, 28276, 27998, 27712, 27418, 27118,\
-		26811, 26498, 26179, 25856, 25528, 25196, 24861, 24523, 24183, 23842, 23500, 23157, 22815, 22474, 22134, 21797,\
-		21462, 21131, 20804, 20481, 20163, 19851, 19545, 19246, 18954, 18670, 18393, 18126, 17866, 17617, 17376, 17146,\
-		16926, 16717, 16519, 16332, 16157, 15992, 15840, 15701, 15574, 15458, 15356, 15266, 15190, 15127, 15077, 15041,\
-		15019, 15010, 15015, 15034, 15067, 15114, 15176, 15252, 15343, 15448, 15568, 15703, 15852, 16016, 16195, 16389,\
-		16598, 16821, 17059, 17312, 17579, 17861, 18156, 18466, 18789, 19126, 19475, 19837, 20210, 20596, 20992, 21399,\
-		21815, 22239, 22672, 23112, 23558, 24008, 24462, 24919, 25377, 25836, 26292, 26747, 27197, 27641, 28077, 28505,\
-		28922, 29326, 29716, 30090, 30447, 30784, 31100, 31393, 31663, 31906, 32122, 32309, 32466, 32591, 32684, 32743,\
-		32766}
-
-	#define test_fm_attack2 {\
-		0, 7, 25, 52, 89, 135, 191, 256, 329, 409, 497, 592, 692, 798, 908, 1022,\
-		1138, 1256, 1374, 1493, 1610, 1726, 1838, 1947, 2051, 2149, 2241, 2326, 2404, 2472, 2532, 2581,\
-		2621, 2650, 2668, 2674, 2670, 2653, 2625, 2586, 2535, 2473, 2401, 2317, 2224, 2122, 2012, 1894,\
-		1769, 1639, 1504, 1366, 1226, 1086, 947, 811, 679, 553, 436, 328, 232, 151, 85, 36,\
-		7, 0, 16, 57, 125, 221, 347, 505, 694, 917, 1173, 1464, 1790, 2151, 2547, 2978,\
-		3442, 3940, 4469, 5030, 5619, 6236, 6879, 7545, 8232, 8939, 9661, 10398, 11146, 11902, 12664, 13429,\
-		14194, 14957, 15715, 16465, 17206, 17935, 18651, 19350, 20032, 20694, 21336, 21957, 22554, 23128, 23678, 24204,\
-		24704, 25179, 25629, 26054, 26454, 26830, 27181, 27510, 27815, 28099, 28361, 28602, 28824, 29027, 29211, 29378,\
-		29528, 29662, 29781, 29885, 29975, 30051, 30115, 30166, 30205, 30232, 30248, 30252, 30245, 30227, 30198, 30159,\
-		30108, 30046, 29973, 29889, 29794, 29687, 29568, 29437, 29295, 29140, 28973, 28795, 28603, 28399, 28183, 27955,\
-		27714, 27462, 27198, 26922, 26636, 26339, 26032, 25715, 25390, 25056, 24715, 24368, 24015, 23656, 23294, 22929,\
-		22563, 22195, 21828, 21462, 21098, 20738, 20382, 20031, 19688, 19352, 19024, 18706, 18398, 18102, 17818, 17547,\
-		17290, 17047, 16819, 16607, 16412, 16234, 16073, 15930, 15805, 15700, 15614, 15547, 15501, 15475, 15470, 15486,\
-		15523, 15581, 15661, 15763, 15887, 16032, 16200, 16391, 16603, 16838, 17094, 17373, 17673, 17995, 18337, 18700,\
-		19082, 19484, 19904, 20341, 20795, 21264, 21747, 22242, 22748, 23264, 23787, 24315, 24848, 25381, 25914, 26443,\
-		26966, 27482, 27988, 28480, 28957, 29415, 29853, 30268, 30658, 31020, 31353, 31655, 31923, 32156, 32354, 32514,\
-		32636}
-
-	#define test_fm_attack3 {\
-		0, 5, 50, 133, 253, 409, 597, 816, 1062, 1332, 1622, 1929, 2250, 2579, 2913, 3248,\
-		3581, 3908, 4226, 4531, 4820, 5092, 5344, 5573, 5778, 5957, 6109, 6234, 6331, 6400, 6440, 6451,\
-		6436, 6393, 6324, 6230, 6113, 5974, 5815, 5638, 5444, 5236, 5016, 4786, 4549, 4306, 4060, 3814,\
-		3568, 3326, 3088, 2857, 2634, 2421, 2218, 2027, 1849, 1682, 1529, 1389, 1262, 1148, 1047, 958,\
-		881, 816, 761, 717, 683, 658, 644, 638, 643, 657, 682, 718, 766, 827, 903, 994,\
-		1102, 1230, 1379, 1550, 1747, 1970, 2223, 2505, 2819, 3167, 3550, 3968, 4422, 4911, 5437, 5997,\
-		6592, 7218, 7874, 8558, 9266, 9996, 10743, 11505, 12276, 13053, 13832, 14608, 15378, 16137, 16881, 17607,\
-		18312, 18993, 19647, 20271, 20865, 21426, 21953, 22444, 22901, 23322, 23707, 24057, 24371, 24651, 24896, 25107,\
-		25286, 25432, 25546, 25630, 25683, 25707, 25702, 25669, 25608, 25520, 25405, 25265, 25099, 24910, 24696, 24460,\
-		24202, 23924, 23627, 23313, 22982, 22637, 22280, 21912, 21535, 21153, 20767, 20380, 19993, 19611, 19235, 18867,\
-		18511, 18168, 17840, 17531, 17242, 16976, 16733, 16516, 16326, 16166, 16035, 15937, 15870, 15838, 15839, 15877,\
-		15950, 16059, 16205, 16388, 16608, 16865, 17159, 17489, 17854, 18253, 18685, 19149, 19642, 20164, 20710, 21278,\
-		21866, 22470, 23087, 23713, 24343, 24975, 25602, 26223, 26831, 27424, 27997, 28547, 29070, 29563, 30024, 30451,\
-		30841, 31195, 31510, 31787, 32027, 32229, 32396, 32529, 32630, 32701, 32745, 32766, 32764, 32745, 32711, 32664,\
-		32609, 32547, 32483, 32417, 32353, 32291, 32236, 32187, 32146, 32114, 32092, 32079, 32077, 32085, 32102, 32128,\
-		32162, 32203, 32250, 32302, 32357, 32413, 32470, 32525, 32578, 32626, 32669, 32705, 32734, 32755, 32765, 32766,\
-		32758}
-
-	#define test_fm_attack4 {\
-		0, 2, 15, 37, 65, 97, 130, 160, 184, 199, 203, 195, 175, 145, 109, 70,\
-		34, 8, 0, 14, 58, 136, 254, 411, 609, 845, 1114, 1409, 1724, 2047, 2370, 2682,\
-		2974, 3236, 3461, 3642, 3776, 3859, 3891, 3874, 3809, 3702, 3559, 3385, 3190, 2979, 2762, 2544,\
-		2334, 2135, 1954, 1794, 1658, 1547, 1463, 1408, 1381, 1385, 1421, 1490, 1597, 1742, 1930, 2163,\
-		2446, 2779, 3164, 3600, 4085, 4614, 5183, 5783, 6405, 7037, 7667, 8284, 8876, 9431, 9938, 10389,\
-		10776, 11092, 11334, 11500, 11589, 11603, 11544, 11419, 11232, 10991, 10706, 10386, 10041, 9681, 9317, 8959,\
-		8617, 8300, 8016, 7773, 7577, 7432, 7345, 7318, 7356, 7461, 7634, 7878, 8193, 8580, 9037, 9561,\
-		10149, 10795, 11491, 12229, 12998, 13786, 14582, 15371, 16142, 16883, 17581, 18227, 18813, 19331, 19777, 20146,\
-		20437, 20648, 20781, 20835, 20816, 20725, 20569, 20352, 20083, 19768, 19418, 19040, 18647, 18249, 17857, 17481,\
-		17134, 16825, 16563, 16358, 16216, 16144, 16147, 16228, 16389, 16632, 16956, 17357, 17832, 18375, 18979, 19633,\
-		20329, 21053, 21795, 22540, 23277, 23994, 24680, 25325, 25922, 26464, 26949, 27372, 27733, 28033, 28271, 28450,\
-		28572, 28639, 28653, 28617, 28533, 28404, 28234, 28025, 27784, 27515, 27225, 26921, 26612, 26307, 26014, 25743,\
-		25505, 25308, 25158, 25064, 25031, 25064, 25163, 25330, 25563, 25859, 26211, 26614, 27057, 27531, 28025, 28528,\
-		29028, 29515, 29978, 30410, 30803, 31155, 31461, 31723, 31940, 32117, 32257, 32365, 32445, 32503, 32541, 32565,\
-		32574, 32572, 32559, 32534, 32495, 32444, 32377, 32297, 32202, 32094, 31975, 31849, 31720, 31594, 31474, 31369,\
-		31282, 31220, 31187, 31185, 31216, 31281, 31378, 31502, 31650, 31814, 31987, 32161, 32326, 32474, 32598, 32691,\
-		32748}
-
-	#define test_fm_release0 {\
-		0, 13, 65, 157, 288, 457, 664, 909, 1192, 1509, 1861, 2249, 2670, 3122, 3605, 4118,\
-		4660, 5226, 5818, 6435, 7074, 7732, 8407, 9102, 9811, 10532, 11263, 12006, 12757, 13511, 14270, 15032,\
-		15794, 16553, 17308, 18061, 18808, 19543, 20269, 20986, 21690, 22377, 23049, 23707, 24346, 24964, 25562, 26141,\
-		26699, 27230, 27738, 28225, 28687, 29121, 29528, 29914, 30272, 30602, 30904, 31183, 31435, 31658, 31854, 32027,\
-		32174, 32293, 32386, 32458, 32505, 32526, 32523, 32501, 32457, 32388, 32298, 32193, 32068, 31921, 31757, 31580,\
-		31387, 31174, 30947, 30711, 30462, 30197, 29920, 29638, 29347, 29042, 28729, 28414, 28093, 27760, 27423, 27087,\
-		26748, 26399, 26048, 25703, 25356, 25001, 24646, 24300, 23955, 23603, 23253, 22915, 22580, 22238, 21899, 21575,\
-		21256, 20929, 20607, 20304, 20007, 19700, 19398, 19119, 18848, 18564, 18284, 18034, 17795, 17532, 17272, 17058,\
-		16861, 16613, 16348, 16197, 16193, 16197, 16067, 15840, 15643, 15512, 15379, 15214, 15061, 14946, 14835, 14707,\
-		14588, 14498, 14413, 14317, 14230, 14165, 14107, 14043, 13986, 13948, 13916, 13881, 13853, 13842, 13838, 13831,\
-		13831, 13847, 13869, 13890, 13918, 13960, 14009, 14057, 14112, 14180, 14255, 14330, 14411, 14505, 14605, 14706,\
-		14813, 14932, 15058, 15184, 15317, 15460, 15610, 15761, 15918, 16085, 16259, 16433, 16614, 16804, 16999, 17196,\
-		17399, 17611, 17827, 18046, 18269, 18500, 18736, 18973, 19214, 19463, 19716, 19969, 20226, 20490, 20757, 21024,\
-		21294, 21569, 21847, 22125, 22404, 22688, 22973, 23256, 23541, 23829, 24117, 24403, 24688, 24976, 25263, 25546,\
-		25828, 26111, 26392, 26668, 26941, 27214, 27484, 27748, 28008, 28266, 28520, 28766, 29008, 29247, 29479, 29704,\
-		29922, 30137, 30344, 30543, 30734, 30919, 31097, 31265, 31425, 31578, 31723, 31857, 31983, 32101, 32210, 32308,\
-		32396}
-
-	#define test_fm_release1 {\
-		0, 23, 82, 175, 300, 457, 644, 860, 1103, 1373, 1666, 1982, 2319, 2676, 3050, 3440,\
-		3844, 4261, 4689, 5125, 5569, 6019, 6474, 6930, 7389, 7847, 8304, 8758, 9208, 9654, 10094, 10527,\
-		10951, 11367, 11774, 12170, 12556, 12929, 13291, 13640, 13977, 14300, 14610, 14905, 15187, 15454, 15707, 15945,\
-		16168, 16377, 16571, 16750, 16914, 17063, 17198, 17318, 17423, 17514, 17590, 17652, 17699, 17732, 17751, 17756,\
-		17747, 17725, 17689, 17639, 17576, 17500, 17410, 17308, 17192, 17065, 16926, 16774, 16609, 16434, 16247, 16049,\
-		15840, 15620, 15390, 15149, 14900, 14640, 14373, 14096, 13812, 13520, 13221, 12915, 12603, 12285, 11962, 11635,\
-		11304, 10969, 10632, 10292, 9951, 9609, 9266, 8924, 8583, 8243, 7905, 7570, 7238, 6910, 6587, 6268,\
-		5955, 5648, 5348, 5054, 4768, 4490, 4219, 3957, 3703, 3459, 3223, 2997, 2780, 2573, 2376, 2188,\
-		2009, 1840, 1681, 1531, 1390, 1258, 1135, 1021, 915, 818, 728, 645, 570, 501, 439, 383,\
-		333, 288, 248, 214, 183, 156, 132, 112, 95, 81, 68, 58, 49, 43, 37, 33,\
-		30, 28, 26, 25, 26, 27, 29, 32, 36, 41, 48, 57, 67, 80, 95, 114,\
-		136, 162, 192, 228, 269, 317, 372, 434, 505, 584, 673, 774, 885, 1009, 1145, 1296,\
-		1460, 1641, 1837, 2051, 2282, 2532, 2800, 3089, 3398, 3728, 4079, 4452, 4848, 5265, 5704, 6167,\
-		6652, 7159, 7689, 8241, 8813, 9407, 10020, 10653, 11304, 11973, 12657, 13356, 14069, 14793, 15527, 16269,\
-		17018, 17772, 18528, 19286, 20042, 20794, 21540, 22278, 23006, 23721, 24423, 25107, 25773, 26417, 27039, 27636,\
-		28206, 28749, 29261, 29742, 30191, 30606, 30986, 31331, 31639, 31911, 32145, 32342, 32501, 32623, 32707, 32755,\
-		32766}
-
-	#define test_fm_release2 {\
-		0, 2, 14, 36, 66, 105, 153, 209, 271, 341, 416, 496, 581, 669, 759, 852,\
-		945, 1039, 1131, 1222, 1310, 1394, 1474, 1549, 1618, 1681, 1737, 1785, 1824, 1855, 1877, 1890,\
-		1892, 1885, 1868, 1842, 1805, 1759, 1704, 1640, 1568, 1488, 1401, 1308, 1209, 1107, 1001, 893,\
-		785, 677, 571, 469, 373, 284, 203, 134, 76, 34, 8, 0, 11, 45, 102, 185,\
-		294, 431, 598, 797, 1027, 1289, 1585, 1915, 2279, 2678, 3110, 3576, 4075, 4606, 5168, 5759,\
-		6378, 7023, 7693, 8385, 9096, 9824, 10568, 11323, 12089, 12860, 13636, 14413, 15189, 15960, 16726, 17482,\
-		18226, 18958, 19674, 20373, 21053, 21712, 22349, 22964, 23554, 24120, 24661, 25177, 25666, 26130, 26567, 26980,\
-		27367, 27730, 28068, 28383, 28676, 28947, 29196, 29425, 29635, 29826, 30000, 30157, 30298, 30425, 30537, 30636,\
-		30722, 30795, 30857, 30908, 30948, 30978, 30998, 31008, 31009, 31001, 30983, 30955, 30919, 30873, 30817, 30752,\
-		30676, 30591, 30496, 30390, 30273, 30145, 30006, 29856, 29694, 29520, 29335, 29138, 28928, 28708, 28475, 28231,\
-		27975, 27709, 27432, 27145, 26848, 26542, 26227, 25905, 25575, 25240, 24899, 24554, 24205, 23854, 23501, 23148,\
-		22795, 22445, 22097, 21752, 21413, 21080, 20754, 20436, 20126, 19827, 19539, 19262, 18998, 18747, 18511, 18290,\
-		18084, 17894, 17722, 17567, 17430, 17311, 17211, 17131, 17071, 17031, 17011, 17012, 17034, 17077, 17142, 17229,\
-		17337, 17468, 17620, 17794, 17990, 18208, 18448, 18709, 18991, 19294, 19618, 19961, 20324, 20705, 21103, 21518,\
-		21948, 22393, 22850, 23319, 23798, 24285, 24779, 25277, 25778, 26278, 26777, 27271, 27759, 28238, 28705, 29158,\
-		29594, 30011, 30407, 30779, 31125, 31443, 31731, 31986, 32208, 32395, 32545, 32657, 32732, 32767, 32762, 32718,\
-		32636}
-
-	#define test_fm_release3 {\
-		0, 33, 106, 218, 366, 550, 766, 1013, 1287, 1585, 1903, 2238, 2585, 2942, 3302, 3664,\
-		4023, 4376, 4719, 5048, 5362, 5657, 5931, 6181, 6407, 6606, 6778, 6921, 7035, 7119, 7174, 7199,\
-		7194, 7162, 7101, 7015, 6903, 6768, 6610, 6432, 6237, 6025, 5799, 5561, 5314, 5059, 4800, 4538,\
-		4275, 4014, 3757, 3505, 3260, 3024, 2798, 2584, 2381, 2190, 2014, 1850, 1701, 1566, 1444, 1336,\
-		1241, 1159, 1090, 1033, 987, 953, 931, 920, 920, 932, 956, 993, 1043, 1108, 1189, 1286,\
-		1403, 1539, 1698, 1879, 2087, 2321, 2585, 2880, 3206, 3567, 3962, 4392, 4858, 5360, 5897, 6469,\
-		7074, 7712, 8379, 9073, 9791, 10530, 11287, 12057, 12836, 13621, 14408, 15191, 15967, 16732, 17482, 18215,\
-		18925, 19611, 20269, 20898, 21496, 22061, 22592, 23088, 23549, 23973, 24363, 24717, 25036, 25321, 25571, 25789,\
-		25975, 26128, 26251, 26344, 26408, 26443, 26450, 26430, 26383, 26309, 26210, 26086, 25937, 25764, 25568, 25350,\
-		25110, 24849, 24569, 24271, 23956, 23625, 23282, 22926, 22562, 22189, 21812, 21431, 21050, 20672, 20297, 19930,\
-		19571, 19225, 18894, 18579, 18282, 18007, 17754, 17527, 17325, 17152, 17009, 16896, 16816, 16769, 16756, 16778,\
-		16835, 16929, 17059, 17226, 17430, 17670, 17947, 18260, 18608, 18990, 19405, 19851, 20327, 20829, 21357, 21906,\
-		22475, 23060, 23657, 24263, 24873, 25483, 26090, 26689, 27276, 27847, 28398, 28925, 29426, 29897, 30335, 30738,\
-		31105, 31435, 31726, 31979, 32195, 32373, 32515, 32623, 32700, 32747, 32766, 32762, 32737, 32694, 32637, 32568,\
-		32491, 32408, 32323, 32238, 32155, 32077, 32006, 31943, 31889, 31846, 31815, 31795, 31787, 31791, 31807, 31834,\
-		31871, 31916, 31970, 32031, 32097, 32167, 32239, 32311, 32382, 32451, 32516, 32576, 32629, 32675, 32712, 32740,\
-		32758}
-
-	#define test_fm_release4 {\
-		0, 6, 21, 43, 68, 94, 117, 133, 142, 141, 130, 110, 83, 53, 25, 5,\
-		0, 15, 58, 134, 248, 402, 596, 830, 1100, 1399, 1721, 2057, 2396, 2729, 3046, 3336,\
-		3592, 3806, 3972, 4088, 4151, 4162, 4123, 4037, 3911, 3749, 3559, 3349, 3127, 2901, 2677, 2462,\
-		2263, 2082, 1924, 1792, 1687, 1611, 1565, 1551, 1569, 1621, 1711, 1839, 2011, 2227, 2493, 2809,\
-		3177, 3598, 4069, 4588, 5150, 5746, 6370, 7009, 7653, 8289, 8906, 9491, 10033, 10523, 10951, 11312,\
-		11600, 11811, 11945, 12003, 11985, 11897, 11743, 11531, 11269, 10965, 10630, 10273, 9906, 9539, 9183, 8846,\
-		8538, 8266, 8039, 7861, 7738, 7675, 7675, 7742, 7878, 8084, 8363, 8713, 9135, 9627, 10185, 10805,\
-		11479, 12199, 12956, 13739, 14535, 15332, 16116, 16875, 17599, 18275, 18895, 19450, 19936, 20347, 20682, 20937,\
-		21113, 21211, 21234, 21184, 21066, 20885, 20647, 20359, 20030, 19669, 19285, 18890, 18494, 18109, 17745, 17413,\
-		17123, 16884, 16705, 16592, 16551, 16586, 16701, 16898, 17175, 17531, 17963, 18467, 19035, 19658, 20328, 21032,\
-		21760, 22498, 23233, 23954, 24650, 25310, 25925, 26489, 26997, 27446, 27833, 28160, 28426, 28634, 28784, 28879,\
-		28922, 28915, 28860, 28760, 28617, 28435, 28218, 27971, 27699, 27409, 27108, 26806, 26510, 26231, 25978, 25760,\
-		25584, 25460, 25392, 25387, 25446, 25573, 25765, 26020, 26335, 26702, 27114, 27562, 28034, 28521, 29010, 29490,\
-		29952, 30386, 30784, 31143, 31457, 31728, 31954, 32139, 32285, 32399, 32484, 32545, 32587, 32615, 32629, 32633,\
-		32627, 32612, 32585, 32548, 32497, 32434, 32356, 32265, 32162, 32049, 31931, 31811, 31695, 31588, 31495, 31423,\
-		31375, 31356, 31367, 31410, 31484, 31587, 31714, 31859, 32016, 32177, 32332, 32475, 32595, 32688, 32746, 32766,\
-		32748}
-
 	#define hyperbolic_shapers_attack0 {\
 		0, 397, 786, 1165, 1534, 1895, 2247, 2590, 2925, 3252, 3571, 3883, 4186, 4483, 4772, 5054,\
 		5329, 5597, 5859, 6115, 6364, 6608, 6845, 7077, 7303, 7524, 7739, 7949, 8154, 8354, 8549, 8739,\
@@ -1318,1008 +862,6 @@ public:
 		24149, 23843, 23536, 23229, 22923, 22619, 22317, 22020, 21727, 21440, 21160, 20889, 20625, 20372, 20129, 19898,\
 		19678}
 
-	#define block_test_attack0 {\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		32766}
-
-	#define block_test_attack1 {\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		32767}
-
-	#define block_test_attack2 {\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		32766}
-
-	#define block_test_attack3 {\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		32766}
-
-	#define block_test_attack4 {\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		32766}
-
-	#define block_test_release0 {\
-		0, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		16383, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32766, 32766, 32766,\
-		32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32766, 32766, 32766,\
-		32766}
-
-	#define block_test_release1 {\
-		0, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		16383, 32766, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
-		32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32766,\
-		32767}
-
-	#define block_test_release2 {\
-		0, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		16383, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 32766, 32766, 32766, 32766, 32767, 32767, 32766, 32767, 32766, 32766, 32767, 32766, 32766, 32766, 32766,\
-		32766, 32767, 32767, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
-		32766}
-
-	#define block_test_release3 {\
-		0, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
-		16383, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
-		32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
-		32766}
-
-	#define block_test_release4 {\
-		0, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
-		4095, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
-		12287, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
-		8191, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
-		20479, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
-		28671, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
-		24575, 32766, 32767, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32767, 32766,\
-		32766, 32766, 32766, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32767, 32766,\
-		32766}
-
-	#define half_sines_attack0 {\
-		0, 10, 41, 93, 165, 257, 367, 494, 636, 794, 964, 1146, 1336, 1534, 1737, 1944,\
-		2151, 2358, 2561, 2759, 2949, 3131, 3301, 3458, 3601, 3728, 3838, 3929, 4001, 4053, 4085, 4095,\
-		4095, 4106, 4137, 4189, 4261, 4353, 4462, 4589, 4732, 4890, 5060, 5241, 5432, 5630, 5833, 6040,\
-		6247, 6453, 6657, 6855, 7045, 7227, 7397, 7554, 7697, 7824, 7934, 8025, 8097, 8149, 8181, 8191,\
-		8191, 8202, 8233, 8285, 8357, 8449, 8558, 8685, 8828, 8986, 9156, 9337, 9528, 9726, 9929, 10135,\
-		10343, 10549, 10753, 10950, 11141, 11322, 11493, 11650, 11793, 11920, 12030, 12121, 12193, 12245, 12277, 12287,\
-		12287, 12298, 12329, 12381, 12453, 12544, 12654, 12781, 12924, 13082, 13252, 13433, 13624, 13822, 14025, 14231,\
-		14439, 14645, 14848, 15046, 15237, 15418, 15589, 15746, 15889, 16016, 16126, 16217, 16289, 16341, 16372, 16383,\
-		16383, 16394, 16425, 16477, 16549, 16640, 16750, 16877, 17020, 17177, 17348, 17529, 17720, 17918, 18121, 18327,\
-		18535, 18741, 18944, 19142, 19333, 19514, 19684, 19842, 19985, 20112, 20222, 20313, 20385, 20437, 20468, 20479,\
-		20479, 20489, 20521, 20573, 20645, 20736, 20846, 20973, 21116, 21273, 21444, 21625, 21816, 22013, 22217, 22423,\
-		22631, 22837, 23040, 23238, 23429, 23610, 23780, 23938, 24081, 24208, 24317, 24409, 24481, 24533, 24564, 24575,\
-		24575, 24585, 24617, 24669, 24741, 24832, 24942, 25069, 25212, 25369, 25539, 25721, 25911, 26109, 26313, 26519,\
-		26726, 26933, 27136, 27334, 27525, 27706, 27876, 28034, 28177, 28304, 28413, 28505, 28577, 28629, 28660, 28671,\
-		28671, 28681, 28713, 28765, 28837, 28928, 29038, 29165, 29308, 29465, 29635, 29817, 30007, 30205, 30408, 30615,\
-		30822, 31029, 31232, 31430, 31620, 31802, 31972, 32130, 32272, 32399, 32509, 32601, 32673, 32725, 32756, 32767,\
-		32767}
-
-	#define half_sines_attack1 {\
-		0, 42, 167, 375, 663, 1029, 1468, 1976, 2547, 3177, 3858, 4584, 5346, 6138, 6951, 7776,\
-		8606, 9432, 10245, 11036, 11799, 12524, 13205, 13835, 14407, 14915, 15354, 15719, 16007, 16215, 16341, 16383,\
-		16383, 16351, 16257, 16101, 15885, 15611, 15282, 14901, 14472, 14000, 13489, 12945, 12373, 11779, 11170, 10550,\
-		9928, 9309, 8699, 8105, 7533, 6989, 6479, 6006, 5578, 5197, 4867, 4593, 4377, 4221, 4127, 4095,\
-		4095, 4137, 4263, 4471, 4759, 5125, 5564, 6072, 6643, 7273, 7954, 8680, 9442, 10234, 11047, 11872,\
-		12702, 13528, 14340, 15132, 15895, 16620, 17301, 17931, 18503, 19011, 19450, 19815, 20103, 20311, 20437, 20479,\
-		20479, 20447, 20353, 20197, 19981, 19707, 19378, 18997, 18568, 18096, 17585, 17041, 16469, 15875, 15265, 14646,\
-		14024, 13405, 12795, 12201, 11629, 11085, 10574, 10102, 9673, 9292, 8963, 8689, 8473, 8317, 8223, 8191,\
-		8191, 8233, 8359, 8567, 8855, 9221, 9660, 10167, 10739, 11369, 12050, 12775, 13538, 14330, 15143, 15968,\
-		16798, 17623, 18436, 19228, 19991, 20716, 21397, 22027, 22599, 23106, 23545, 23911, 24199, 24407, 24533, 24575,\
-		24575, 24543, 24449, 24293, 24077, 23803, 23474, 23093, 22664, 22192, 21681, 21137, 20565, 19971, 19361, 18742,\
-		18120, 17501, 16891, 16297, 15725, 15181, 14670, 14198, 13769, 13388, 13059, 12785, 12569, 12413, 12319, 12287,\
-		12287, 12329, 12455, 12663, 12951, 13316, 13755, 14263, 14835, 15465, 16146, 16871, 17634, 18426, 19238, 20064,\
-		20894, 21719, 22532, 23324, 24086, 24812, 25493, 26123, 26694, 27202, 27641, 28007, 28295, 28503, 28629, 28671,\
-		28671, 28681, 28713, 28765, 28837, 28928, 29038, 29165, 29308, 29465, 29635, 29817, 30007, 30205, 30408, 30615,\
-		30822, 31029, 31232, 31430, 31620, 31802, 31972, 32130, 32272, 32399, 32509, 32601, 32673, 32725, 32756, 32767,\
-		32767}
-
-	#define half_sines_attack2 {\
-		0, 21, 83, 187, 331, 514, 734, 988, 1273, 1588, 1929, 2292, 2673, 3069, 3475, 3888,\
-		4303, 4716, 5122, 5518, 5899, 6262, 6602, 6917, 7203, 7457, 7677, 7859, 8003, 8107, 8170, 8191,\
-		8191, 8212, 8275, 8379, 8523, 8706, 8925, 9179, 9465, 9780, 10121, 10483, 10865, 11260, 11667, 12080,\
-		12495, 12907, 13314, 13710, 14091, 14454, 14794, 15109, 15395, 15649, 15868, 16051, 16195, 16299, 16362, 16383,\
-		16383, 16404, 16467, 16571, 16715, 16898, 17117, 17371, 17657, 17972, 18312, 18675, 19056, 19452, 19859, 20271,\
-		20686, 21099, 21506, 21901, 22283, 22645, 22986, 23301, 23587, 23841, 24060, 24243, 24387, 24491, 24554, 24575,\
-		24575, 24522, 24365, 24105, 23745, 23288, 22739, 22105, 21390, 20603, 19751, 18845, 17891, 16902, 15886, 14854,\
-		13816, 12784, 11768, 10779, 9826, 8919, 8067, 7280, 6566, 5931, 5382, 4925, 4565, 4305, 4148, 4095,\
-		4095, 4116, 4179, 4283, 4427, 4610, 4830, 5083, 5369, 5684, 6025, 6387, 6769, 7165, 7571, 7984,\
-		8399, 8811, 9218, 9614, 9995, 10358, 10698, 11013, 11299, 11553, 11772, 11955, 12099, 12203, 12266, 12287,\
-		12287, 12308, 12371, 12475, 12619, 12802, 13021, 13275, 13561, 13876, 14216, 14579, 14960, 15356, 15763, 16176,\
-		16590, 17003, 17410, 17806, 18187, 18550, 18890, 19205, 19491, 19745, 19964, 20147, 20291, 20395, 20458, 20479,\
-		20479, 20500, 20563, 20667, 20811, 20994, 21213, 21467, 21753, 22068, 22408, 22771, 23152, 23548, 23955, 24367,\
-		24782, 25195, 25601, 25997, 26379, 26741, 27082, 27397, 27683, 27936, 28156, 28339, 28483, 28587, 28650, 28671,\
-		28671, 28681, 28713, 28765, 28837, 28928, 29038, 29165, 29308, 29465, 29635, 29817, 30007, 30205, 30408, 30615,\
-		30822, 31029, 31232, 31430, 31620, 31802, 31972, 32130, 32272, 32399, 32509, 32601, 32673, 32725, 32756, 32767,\
-		32766}
-
-	#define half_sines_attack3 {\
-		0, 31, 125, 281, 497, 771, 1101, 1482, 1910, 2383, 2893, 3438, 4010, 4603, 5213, 5832,\
-		6454, 7074, 7683, 8277, 8849, 9393, 9904, 10376, 10805, 11186, 11515, 11789, 12005, 12161, 12256, 12287,\
-		12287, 12319, 12413, 12569, 12785, 13059, 13388, 13769, 14198, 14670, 15181, 15725, 16297, 16891, 17501, 18120,\
-		18742, 19361, 19971, 20565, 21137, 21681, 22192, 22664, 23093, 23474, 23803, 24077, 24293, 24449, 24543, 24575,\
-		24575, 24522, 24365, 24105, 23745, 23288, 22739, 22105, 21390, 20603, 19751, 18845, 17891, 16902, 15886, 14854,\
-		13816, 12784, 11768, 10779, 9826, 8919, 8067, 7280, 6566, 5931, 5382, 4925, 4565, 4305, 4148, 4095,\
-		4095, 4127, 4221, 4377, 4593, 4867, 5197, 5578, 6006, 6479, 6989, 7533, 8105, 8699, 9309, 9928,\
-		10550, 11170, 11779, 12373, 12945, 13489, 14000, 14472, 14901, 15282, 15611, 15885, 16101, 16257, 16351, 16383,\
-		16383, 16415, 16509, 16665, 16881, 17155, 17484, 17865, 18294, 18766, 19277, 19821, 20393, 20987, 21596, 22216,\
-		22838, 23457, 24067, 24661, 25233, 25777, 26287, 26760, 27188, 27569, 27899, 28173, 28389, 28545, 28639, 28671,\
-		28671, 28618, 28461, 28201, 27841, 27384, 26835, 26200, 25486, 24699, 23847, 22940, 21987, 20998, 19982, 18950,\
-		17912, 16880, 15864, 14875, 13921, 13015, 12163, 11376, 10661, 10027, 9478, 9021, 8661, 8401, 8244, 8191,\
-		8191, 8223, 8317, 8473, 8689, 8963, 9292, 9673, 10102, 10574, 11085, 11629, 12201, 12795, 13405, 14024,\
-		14646, 15265, 15875, 16469, 17041, 17585, 18096, 18568, 18997, 19378, 19707, 19981, 20197, 20353, 20447, 20479,\
-		20479, 20510, 20605, 20761, 20977, 21251, 21580, 21961, 22390, 22862, 23373, 23917, 24489, 25083, 25692, 26312,\
-		26934, 27553, 28163, 28756, 29328, 29873, 30383, 30856, 31284, 31665, 31995, 32269, 32485, 32641, 32735, 32766,\
-		32767}
-
-	#define half_sines_attack4 {\
-		0, 31, 125, 281, 497, 771, 1101, 1482, 1910, 2383, 2893, 3438, 4010, 4603, 5213, 5832,\
-		6454, 7074, 7683, 8277, 8849, 9393, 9904, 10376, 10805, 11186, 11515, 11789, 12005, 12161, 12256, 12287,\
-		12287, 12319, 12413, 12569, 12785, 13059, 13388, 13769, 14198, 14670, 15181, 15725, 16297, 16891, 17501, 18120,\
-		18742, 19361, 19971, 20565, 21137, 21681, 22192, 22664, 23093, 23474, 23803, 24077, 24293, 24449, 24543, 24575,\
-		24575, 24554, 24491, 24387, 24243, 24060, 23841, 23587, 23301, 22986, 22645, 22283, 21901, 21506, 21099, 20686,\
-		20271, 19859, 19452, 19056, 18675, 18312, 17972, 17657, 17371, 17117, 16898, 16715, 16571, 16467, 16404, 16383,\
-		16383, 16362, 16299, 16195, 16051, 15868, 15649, 15395, 15109, 14794, 14454, 14091, 13710, 13314, 12907, 12495,\
-		12080, 11667, 11260, 10865, 10483, 10121, 9780, 9465, 9179, 8925, 8706, 8523, 8379, 8275, 8212, 8191,\
-		8191, 8223, 8317, 8473, 8689, 8963, 9292, 9673, 10102, 10574, 11085, 11629, 12201, 12795, 13405, 14024,\
-		14646, 15265, 15875, 16469, 17041, 17585, 18096, 18568, 18997, 19378, 19707, 19981, 20197, 20353, 20447, 20479,\
-		20479, 20500, 20563, 20667, 20811, 20994, 21213, 21467, 21753, 22068, 22408, 22771, 23152, 23548, 23955, 24367,\
-		24782, 25195, 25601, 25997, 26379, 26741, 27082, 27397, 27683, 27936, 28156, 28339, 28483, 28587, 28650, 28671,\
-		28671, 28660, 28629, 28577, 28505, 28413, 28304, 28177, 28034, 27876, 27706, 27525, 27334, 27136, 26933, 26726,\
-		26519, 26313, 26109, 25911, 25721, 25539, 25369, 25212, 25069, 24942, 24832, 24741, 24669, 24617, 24585, 24575,\
-		24575, 24596, 24659, 24763, 24907, 25089, 25309, 25563, 25849, 26164, 26504, 26867, 27248, 27644, 28050, 28463,\
-		28878, 29291, 29697, 30093, 30474, 30837, 31178, 31493, 31778, 32032, 32252, 32435, 32579, 32683, 32745, 32766,\
-		32767}
-
-	#define half_sines_release0 {\
-		0, 0, 10, 41, 93, 165, 257, 367, 494, 636, 794, 964, 1146, 1336, 1534, 1737,\
-		1944, 2151, 2358, 2561, 2759, 2949, 3131, 3301, 3458, 3601, 3728, 3838, 3929, 4001, 4053, 4085,\
-		4095, 4095, 4106, 4137, 4189, 4261, 4353, 4462, 4589, 4732, 4890, 5060, 5241, 5432, 5630, 5833,\
-		6040, 6247, 6453, 6657, 6855, 7045, 7227, 7397, 7554, 7697, 7824, 7934, 8025, 8097, 8149, 8181,\
-		8191, 8191, 8202, 8233, 8285, 8357, 8449, 8558, 8685, 8828, 8986, 9156, 9337, 9528, 9726, 9929,\
-		10135, 10343, 10549, 10753, 10950, 11141, 11322, 11493, 11650, 11793, 11920, 12030, 12121, 12193, 12245, 12277,\
-		12287, 12287, 12298, 12329, 12381, 12453, 12544, 12654, 12781, 12924, 13082, 13252, 13433, 13624, 13822, 14025,\
-		14231, 14439, 14645, 14848, 15046, 15237, 15418, 15589, 15746, 15889, 16016, 16126, 16217, 16289, 16341, 16372,\
-		16383, 16383, 16394, 16425, 16477, 16549, 16640, 16750, 16877, 17020, 17177, 17348, 17529, 17720, 17918, 18121,\
-		18327, 18535, 18741, 18944, 19142, 19333, 19514, 19684, 19842, 19985, 20112, 20222, 20313, 20385, 20437, 20468,\
-		20479, 20479, 20489, 20521, 20573, 20645, 20736, 20846, 20973, 21116, 21273, 21444, 21625, 21816, 22013, 22217,\
-		22423, 22631, 22837, 23040, 23238, 23429, 23610, 23780, 23938, 24081, 24208, 24317, 24409, 24481, 24533, 24564,\
-		24575, 24575, 24585, 24617, 24669, 24741, 24832, 24942, 25069, 25212, 25369, 25539, 25721, 25911, 26109, 26313,\
-		26519, 26726, 26933, 27136, 27334, 27525, 27706, 27876, 28034, 28177, 28304, 28413, 28505, 28577, 28629, 28660,\
-		28671, 28671, 28681, 28713, 28765, 28837, 28928, 29038, 29165, 29308, 29465, 29635, 29817, 30007, 30205, 30408,\
-		30615, 30822, 31029, 31232, 31430, 31620, 31802, 31972, 32130, 32272, 32399, 32509, 32601, 32673, 32725, 32756,\
-		32767}
-
-	#define half_sines_release1 {\
-		0, 0, 10, 41, 93, 165, 257, 367, 494, 636, 794, 964, 1146, 1336, 1534, 1737,\
-		1944, 2151, 2358, 2561, 2759, 2949, 3131, 3301, 3458, 3601, 3728, 3838, 3929, 4001, 4053, 4085,\
-		4095, 4095, 4137, 4263, 4471, 4759, 5125, 5564, 6072, 6643, 7273, 7954, 8680, 9442, 10234, 11047,\
-		11872, 12702, 13528, 14340, 15132, 15895, 16620, 17301, 17931, 18503, 19011, 19450, 19815, 20103, 20311, 20437,\
-		20479, 20479, 20447, 20353, 20197, 19981, 19707, 19378, 18997, 18568, 18096, 17585, 17041, 16469, 15875, 15265,\
-		14646, 14024, 13405, 12795, 12201, 11629, 11085, 10574, 10102, 9673, 9292, 8963, 8689, 8473, 8317, 8223,\
-		8191, 8191, 8233, 8359, 8567, 8855, 9221, 9660, 10167, 10739, 11369, 12050, 12775, 13538, 14330, 15143,\
-		15968, 16798, 17623, 18436, 19228, 19991, 20716, 21397, 22027, 22599, 23106, 23545, 23911, 24199, 24407, 24533,\
-		24575, 24575, 24543, 24449, 24293, 24077, 23803, 23474, 23093, 22664, 22192, 21681, 21137, 20565, 19971, 19361,\
-		18742, 18120, 17501, 16891, 16297, 15725, 15181, 14670, 14198, 13769, 13388, 13059, 12785, 12569, 12413, 12319,\
-		12287, 12287, 12329, 12455, 12663, 12951, 13316, 13755, 14263, 14835, 15465, 16146, 16871, 17634, 18426, 19238,\
-		20064, 20894, 21719, 22532, 23324, 24086, 24812, 25493, 26123, 26694, 27202, 27641, 28007, 28295, 28503, 28629,\
-		28671, 28671, 28639, 28545, 28389, 28173, 27899, 27569, 27188, 26760, 26287, 25777, 25233, 24661, 24067, 23457,\
-		22838, 22216, 21596, 20987, 20393, 19821, 19277, 18766, 18294, 17865, 17484, 17155, 16881, 16665, 16509, 16415,\
-		16383, 16383, 16425, 16551, 16759, 17047, 17412, 17851, 18359, 18931, 19561, 20242, 20967, 21730, 22521, 23334,\
-		24160, 24990, 25815, 26628, 27420, 28182, 28908, 29589, 30219, 30790, 31298, 31737, 32103, 32391, 32599, 32724,\
-		32767}
-
-	#define half_sines_release2 {\
-		0, 0, 10, 41, 93, 165, 257, 367, 494, 636, 794, 964, 1146, 1336, 1534, 1737,\
-		1944, 2151, 2358, 2561, 2759, 2949, 3131, 3301, 3458, 3601, 3728, 3838, 3929, 4001, 4053, 4085,\
-		4095, 4095, 4116, 4179, 4283, 4427, 4610, 4830, 5083, 5369, 5684, 6025, 6387, 6769, 7165, 7571,\
-		7984, 8399, 8811, 9218, 9614, 9995, 10358, 10698, 11013, 11299, 11553, 11772, 11955, 12099, 12203, 12266,\
-		12287, 12287, 12308, 12371, 12475, 12619, 12802, 13021, 13275, 13561, 13876, 14216, 14579, 14960, 15356, 15763,\
-		16176, 16590, 17003, 17410, 17806, 18187, 18550, 18890, 19205, 19491, 19745, 19964, 20147, 20291, 20395, 20458,\
-		20479, 20479, 20500, 20563, 20667, 20811, 20994, 21213, 21467, 21753, 22068, 22408, 22771, 23152, 23548, 23955,\
-		24367, 24782, 25195, 25601, 25997, 26379, 26741, 27082, 27397, 27683, 27936, 28156, 28339, 28483, 28587, 28650,\
-		28671, 28671, 28618, 28461, 28201, 27841, 27384, 26835, 26200, 25486, 24699, 23847, 22940, 21987, 20998, 19982,\
-		18950, 17912, 16880, 15864, 14875, 13921, 13015, 12163, 11376, 10661, 10027, 9478, 9021, 8661, 8401, 8244,\
-		8191, 8191, 8212, 8275, 8379, 8523, 8706, 8925, 9179, 9465, 9780, 10121, 10483, 10865, 11260, 11667,\
-		12080, 12495, 12907, 13314, 13710, 14091, 14454, 14794, 15109, 15395, 15649, 15868, 16051, 16195, 16299, 16362,\
-		16383, 16383, 16404, 16467, 16571, 16715, 16898, 17117, 17371, 17657, 17972, 18312, 18675, 19056, 19452, 19859,\
-		20271, 20686, 21099, 21506, 21901, 22283, 22645, 22986, 23301, 23587, 23841, 24060, 24243, 24387, 24491, 24554,\
-		24575, 24575, 24596, 24659, 24763, 24907, 25089, 25309, 25563, 25849, 26164, 26504, 26867, 27248, 27644, 28050,\
-		28463, 28878, 29291, 29697, 30093, 30474, 30837, 31178, 31493, 31778, 32032, 32252, 32435, 32579, 32683, 32745,\
-		32766}
-
-	#define half_sines_release3 {\
-		0, 0, 31, 125, 281, 497, 771, 1101, 1482, 1910, 2383, 2893, 3438, 4010, 4603, 5213,\
-		5832, 6454, 7074, 7683, 8277, 8849, 9393, 9904, 10376, 10805, 11186, 11515, 11789, 12005, 12161, 12256,\
-		12287, 12287, 12319, 12413, 12569, 12785, 13059, 13388, 13769, 14198, 14670, 15181, 15725, 16297, 16891, 17501,\
-		18120, 18742, 19361, 19971, 20565, 21137, 21681, 22192, 22664, 23093, 23474, 23803, 24077, 24293, 24449, 24543,\
-		24575, 24575, 24522, 24365, 24105, 23745, 23288, 22739, 22105, 21390, 20603, 19751, 18845, 17891, 16902, 15886,\
-		14854, 13816, 12784, 11768, 10779, 9826, 8919, 8067, 7280, 6566, 5931, 5382, 4925, 4565, 4305, 4148,\
-		4095, 4095, 4127, 4221, 4377, 4593, 4867, 5197, 5578, 6006, 6479, 6989, 7533, 8105, 8699, 9309,\
-		9928, 10550, 11170, 11779, 12373, 12945, 13489, 14000, 14472, 14901, 15282, 15611, 15885, 16101, 16257, 16351,\
-		16383, 16383, 16415, 16509, 16665, 16881, 17155, 17484, 17865, 18294, 18766, 19277, 19821, 20393, 20987, 21596,\
-		22216, 22838, 23457, 24067, 24661, 25233, 25777, 26287, 26760, 27188, 27569, 27899, 28173, 28389, 28545, 28639,\
-		28671, 28671, 28618, 28461, 28201, 27841, 27384, 26835, 26200, 25486, 24699, 23847, 22940, 21987, 20998, 19982,\
-		18950, 17912, 16880, 15864, 14875, 13921, 13015, 12163, 11376, 10661, 10027, 9478, 9021, 8661, 8401, 8244,\
-		8191, 8191, 8223, 8317, 8473, 8689, 8963, 9292, 9673, 10102, 10574, 11085, 11629, 12201, 12795, 13405,\
-		14024, 14646, 15265, 15875, 16469, 17041, 17585, 18096, 18568, 18997, 19378, 19707, 19981, 20197, 20353, 20447,\
-		20479, 20479, 20510, 20605, 20761, 20977, 21251, 21580, 21961, 22390, 22862, 23373, 23917, 24489, 25083, 25692,\
-		26312, 26934, 27553, 28163, 28756, 29328, 29873, 30383, 30856, 31284, 31665, 31995, 32269, 32485, 32641, 32735,\
-		32767}
-
-	#define half_sines_release4 {\
-		0, 0, 10, 41, 93, 165, 257, 367, 494, 636, 794, 964, 1146, 1336, 1534, 1737,\
-		1944, 2151, 2358, 2561, 2759, 2949, 3131, 3301, 3458, 3601, 3728, 3838, 3929, 4001, 4053, 4085,\
-		4095, 4095, 4116, 4179, 4283, 4427, 4610, 4830, 5083, 5369, 5684, 6025, 6387, 6769, 7165, 7571,\
-		7984, 8399, 8811, 9218, 9614, 9995, 10358, 10698, 11013, 11299, 11553, 11772, 11955, 12099, 12203, 12266,\
-		12287, 12287, 12319, 12413, 12569, 12785, 13059, 13388, 13769, 14198, 14670, 15181, 15725, 16297, 16891, 17501,\
-		18120, 18742, 19361, 19971, 20565, 21137, 21681, 22192, 22664, 23093, 23474, 23803, 24077, 24293, 24449, 24543,\
-		24575, 24575, 24533, 24407, 24199, 23911, 23545, 23106, 22599, 22027, 21397, 20716, 19991, 19228, 18436, 17623,\
-		16798, 15968, 15143, 14330, 13538, 12775, 12050, 11369, 10739, 10167, 9660, 9221, 8855, 8567, 8359, 8233,\
-		8191, 8191, 8223, 8317, 8473, 8689, 8963, 9292, 9673, 10102, 10574, 11085, 11629, 12201, 12795, 13405,\
-		14024, 14646, 15265, 15875, 16469, 17041, 17585, 18096, 18568, 18997, 19378, 19707, 19981, 20197, 20353, 20447,\
-		20479, 20479, 20500, 20563, 20667, 20811, 20994, 21213, 21467, 21753, 22068, 22408, 22771, 23152, 23548, 23955,\
-		24367, 24782, 25195, 25601, 25997, 26379, 26741, 27082, 27397, 27683, 27936, 28156, 28339, 28483, 28587, 28650,\
-		28671, 28671, 28660, 28629, 28577, 28505, 28413, 28304, 28177, 28034, 27876, 27706, 27525, 27334, 27136, 26933,\
-		26726, 26519, 26313, 26109, 25911, 25721, 25539, 25369, 25212, 25069, 24942, 24832, 24741, 24669, 24617, 24585,\
-		24575, 24575, 24596, 24659, 24763, 24907, 25089, 25309, 25563, 25849, 26164, 26504, 26867, 27248, 27644, 28050,\
-		28463, 28878, 29291, 29697, 30093, 30474, 30837, 31178, 31493, 31778, 32032, 32252, 32435, 32579, 32683, 32745,\
-		32767}
-
-	#define mountains_attack0 {\
-		0, 127, 255, 383, 511, 639, 767, 895, 1023, 1151, 1279, 1407, 1535, 1663, 1791, 1919,\
-		2047, 2175, 2303, 2431, 2559, 2687, 2815, 2943, 3071, 3199, 3327, 3455, 3583, 3711, 3839, 3967,\
-		4095, 4223, 4351, 4479, 4607, 4735, 4863, 4991, 5119, 5247, 5375, 5503, 5631, 5759, 5887, 6015,\
-		6143, 6271, 6399, 6527, 6655, 6783, 6911, 7039, 7167, 7295, 7423, 7551, 7679, 7807, 7935, 8063,\
-		8191, 8319, 8447, 8575, 8703, 8831, 8959, 9087, 9215, 9343, 9471, 9599, 9727, 9855, 9983, 10111,\
-		10239, 10367, 10495, 10623, 10751, 10879, 11007, 11135, 11263, 11391, 11519, 11647, 11775, 11903, 12031, 12159,\
-		12287, 12415, 12543, 12671, 12799, 12927, 13055, 13183, 13311, 13439, 13567, 13695, 13823, 13951, 14079, 14207,\
-		14335, 14463, 14591, 14719, 14847, 14975, 15103, 15231, 15359, 15487, 15615, 15743, 15871, 15999, 16127, 16255,\
-		16383, 16511, 16639, 16767, 16895, 17023, 17151, 17279, 17407, 17535, 17663, 17791, 17919, 18047, 18175, 18303,\
-		18431, 18559, 18687, 18815, 18943, 19071, 19199, 19327, 19455, 19583, 19711, 19839, 19967, 20095, 20223, 20351,\
-		20479, 20607, 20735, 20863, 20991, 21119, 21247, 21375, 21503, 21631, 21759, 21887, 22015, 22143, 22271, 22399,\
-		22527, 22655, 22783, 22911, 23039, 23167, 23295, 23423, 23551, 23679, 23807, 23935, 24063, 24191, 24319, 24447,\
-		24575, 24703, 24831, 24959, 25087, 25215, 25343, 25471, 25599, 25727, 25855, 25983, 26111, 26239, 26367, 26495,\
-		26623, 26751, 26879, 27007, 27135, 27263, 27391, 27519, 27647, 27775, 27903, 28031, 28159, 28287, 28415, 28543,\
-		28671, 28799, 28927, 29055, 29183, 29311, 29439, 29567, 29695, 29823, 29951, 30079, 30207, 30335, 30463, 30591,\
-		30719, 30847, 30975, 31103, 31231, 31359, 31487, 31615, 31743, 31871, 31999, 32127, 32255, 32383, 32511, 32639,\
-		32767}
-
-	#define mountains_attack1 {\
-		0, 191, 383, 575, 767, 959, 1151, 1343, 1535, 1727, 1919, 2111, 2303, 2495, 2687, 2879,\
-		3071, 3263, 3455, 3647, 3839, 4031, 4223, 4415, 4607, 4799, 4991, 5183, 5375, 5567, 5759, 5951,\
-		6143, 6335, 6527, 6719, 6911, 7103, 7295, 7487, 7679, 7871, 8063, 8255, 8447, 8639, 8831, 9023,\
-		9215, 9407, 9599, 9791, 9983, 10175, 10367, 10559, 10751, 10943, 11135, 11327, 11519, 11711, 11903, 12095,\
-		12287, 12479, 12671, 12863, 13055, 13247, 13439, 13631, 13823, 14015, 14207, 14399, 14591, 14783, 14975, 15167,\
-		15359, 15551, 15743, 15935, 16127, 16319, 16511, 16703, 16895, 17087, 17279, 17471, 17663, 17855, 18047, 18239,\
-		18431, 18623, 18815, 19007, 19199, 19391, 19583, 19775, 19967, 20159, 20351, 20543, 20735, 20927, 21119, 21311,\
-		21503, 21695, 21887, 22079, 22271, 22463, 22655, 22847, 23039, 23231, 23423, 23615, 23807, 23999, 24191, 24383,\
-		24575, 24639, 24703, 24767, 24831, 24895, 24959, 25023, 25087, 25151, 25215, 25279, 25343, 25407, 25471, 25535,\
-		25599, 25663, 25727, 25791, 25855, 25919, 25983, 26047, 26111, 26175, 26239, 26303, 26367, 26431, 26495, 26559,\
-		26623, 26687, 26751, 26815, 26879, 26943, 27007, 27071, 27135, 27199, 27263, 27327, 27391, 27455, 27519, 27583,\
-		27647, 27711, 27775, 27839, 27903, 27967, 28031, 28095, 28159, 28223, 28287, 28351, 28415, 28479, 28543, 28607,\
-		28671, 28735, 28799, 28863, 28927, 28991, 29055, 29119, 29183, 29247, 29311, 29375, 29439, 29503, 29567, 29631,\
-		29695, 29759, 29823, 29887, 29951, 30015, 30079, 30143, 30207, 30271, 30335, 30399, 30463, 30527, 30591, 30655,\
-		30719, 30783, 30847, 30911, 30975, 31039, 31103, 31167, 31231, 31295, 31359, 31423, 31487, 31551, 31615, 31679,\
-		31743, 31807, 31871, 31935, 31999, 32063, 32127, 32191, 32255, 32319, 32383, 32447, 32511, 32575, 32639, 32703,\
-		32767}
-
-	#define mountains_attack2 {\
-		0, 255, 511, 767, 1023, 1279, 1535, 1791, 2047, 2303, 2559, 2815, 3071, 3327, 3583, 3839,\
-		4095, 4351, 4607, 4863, 5119, 5375, 5631, 5887, 6143, 6399, 6655, 6911, 7167, 7423, 7679, 7935,\
-		8191, 8447, 8703, 8959, 9215, 9471, 9727, 9983, 10239, 10495, 10751, 11007, 11263, 11519, 11775, 12031,\
-		12287, 12543, 12799, 13055, 13311, 13567, 13823, 14079, 14335, 14591, 14847, 15103, 15359, 15615, 15871, 16127,\
-		16383, 16511, 16639, 16767, 16895, 17023, 17151, 17279, 17407, 17535, 17663, 17791, 17919, 18047, 18175, 18303,\
-		18431, 18559, 18687, 18815, 18943, 19071, 19199, 19327, 19455, 19583, 19711, 19839, 19967, 20095, 20223, 20351,\
-		20479, 20607, 20735, 20863, 20991, 21119, 21247, 21375, 21503, 21631, 21759, 21887, 22015, 22143, 22271, 22399,\
-		22527, 22655, 22783, 22911, 23039, 23167, 23295, 23423, 23551, 23679, 23807, 23935, 24063, 24191, 24319, 24447,\
-		24575, 24319, 24063, 23807, 23551, 23295, 23039, 22783, 22527, 22271, 22015, 21759, 21503, 21247, 20991, 20735,\
-		20479, 20223, 19967, 19711, 19455, 19199, 18943, 18687, 18431, 18175, 17919, 17663, 17407, 17151, 16895, 16639,\
-		16383, 16127, 15871, 15615, 15359, 15103, 14847, 14591, 14335, 14079, 13823, 13567, 13311, 13055, 12799, 12543,\
-		12287, 12031, 11775, 11519, 11263, 11007, 10751, 10495, 10239, 9983, 9727, 9471, 9215, 8959, 8703, 8447,\
-		8191, 8575, 8959, 9343, 9727, 10111, 10495, 10879, 11263, 11647, 12031, 12415, 12799, 13183, 13567, 13951,\
-		14335, 14719, 15103, 15487, 15871, 16255, 16639, 17023, 17407, 17791, 18175, 18559, 18943, 19327, 19711, 20095,\
-		20479, 20863, 21247, 21631, 22015, 22399, 22783, 23167, 23551, 23935, 24319, 24703, 25087, 25471, 25855, 26239,\
-		26623, 27007, 27391, 27775, 28159, 28543, 28927, 29311, 29695, 30079, 30463, 30847, 31231, 31615, 31999, 32383,\
-		32767}
-
-	#define mountains_attack3 {\
-		0, 639, 1279, 1919, 2559, 3199, 3839, 4479, 5119, 5759, 6399, 7039, 7679, 8319, 8959, 9599,\
-		10239, 10879, 11519, 12159, 12799, 13439, 14079, 14719, 15359, 15999, 16639, 17279, 17919, 18559, 19199, 19839,\
-		20479, 20351, 20223, 20095, 19967, 19839, 19711, 19583, 19455, 19327, 19199, 19071, 18943, 18815, 18687, 18559,\
-		18431, 18303, 18175, 18047, 17919, 17791, 17663, 17535, 17407, 17279, 17151, 17023, 16895, 16767, 16639, 16511,\
-		16383, 15999, 15615, 15231, 14847, 14463, 14079, 13695, 13311, 12927, 12543, 12159, 11775, 11391, 11007, 10623,\
-		10239, 9855, 9471, 9087, 8703, 8319, 7935, 7551, 7167, 6783, 6399, 6015, 5631, 5247, 4863, 4479,\
-		4095, 4735, 5375, 6015, 6655, 7295, 7935, 8575, 9215, 9855, 10495, 11135, 11775, 12415, 13055, 13695,\
-		14335, 14975, 15615, 16255, 16895, 17535, 18175, 18815, 19455, 20095, 20735, 21375, 22015, 22655, 23295, 23935,\
-		24575, 24703, 24831, 24959, 25087, 25215, 25343, 25471, 25599, 25727, 25855, 25983, 26111, 26239, 26367, 26495,\
-		26623, 26751, 26879, 27007, 27135, 27263, 27391, 27519, 27647, 27775, 27903, 28031, 28159, 28287, 28415, 28543,\
-		28671, 28031, 27391, 26751, 26111, 25471, 24831, 24191, 23551, 22911, 22271, 21631, 20991, 20351, 19711, 19071,\
-		18431, 17791, 17151, 16511, 15871, 15231, 14591, 13951, 13311, 12671, 12031, 11391, 10751, 10111, 9471, 8831,\
-		8191, 8319, 8447, 8575, 8703, 8831, 8959, 9087, 9215, 9343, 9471, 9599, 9727, 9855, 9983, 10111,\
-		10239, 10367, 10495, 10623, 10751, 10879, 11007, 11135, 11263, 11391, 11519, 11647, 11775, 11903, 12031, 12159,\
-		12287, 12927, 13567, 14207, 14847, 15487, 16127, 16767, 17407, 18047, 18687, 19327, 19967, 20607, 21247, 21887,\
-		22527, 23167, 23807, 24447, 25087, 25727, 26367, 27007, 27647, 28287, 28927, 29567, 30207, 30847, 31487, 32127,\
-		32767}
-
-	#define mountains_release0 {\
-		0, 127, 255, 383, 511, 639, 767, 895, 1023, 1151, 1279, 1407, 1535, 1663, 1791, 1919,\
-		2047, 2175, 2303, 2431, 2559, 2687, 2815, 2943, 3071, 3199, 3327, 3455, 3583, 3711, 3839, 3967,\
-		4095, 4223, 4351, 4479, 4607, 4735, 4863, 4991, 5119, 5247, 5375, 5503, 5631, 5759, 5887, 6015,\
-		6143, 6271, 6399, 6527, 6655, 6783, 6911, 7039, 7167, 7295, 7423, 7551, 7679, 7807, 7935, 8063,\
-		8191, 8319, 8447, 8575, 8703, 8831, 8959, 9087, 9215, 9343, 9471, 9599, 9727, 9855, 9983, 10111,\
-		10239, 10367, 10495, 10623, 10751, 10879, 11007, 11135, 11263, 11391, 11519, 11647, 11775, 11903, 12031, 12159,\
-		12287, 12415, 12543, 12671, 12799, 12927, 13055, 13183, 13311, 13439, 13567, 13695, 13823, 13951, 14079, 14207,\
-		14335, 14463, 14591, 14719, 14847, 14975, 15103, 15231, 15359, 15487, 15615, 15743, 15871, 15999, 16127, 16255,\
-		16383, 16511, 16639, 16767, 16895, 17023, 17151, 17279, 17407, 17535, 17663, 17791, 17919, 18047, 18175, 18303,\
-		18431, 18559, 18687, 18815, 18943, 19071, 19199, 19327, 19455, 19583, 19711, 19839, 19967, 20095, 20223, 20351,\
-		20479, 20607, 20735, 20863, 20991, 21119, 21247, 21375, 21503, 21631, 21759, 21887, 22015, 22143, 22271, 22399,\
-		22527, 22655, 22783, 22911, 23039, 23167, 23295, 23423, 23551, 23679, 23807, 23935, 24063, 24191, 24319, 24447,\
-		24575, 24703, 24831, 24959, 25087, 25215, 25343, 25471, 25599, 25727, 25855, 25983, 26111, 26239, 26367, 26495,\
-		26623, 26751, 26879, 27007, 27135, 27263, 27391, 27519, 27647, 27775, 27903, 28031, 28159, 28287, 28415, 28543,\
-		28671, 28799, 28927, 29055, 29183, 29311, 29439, 29567, 29695, 29823, 29951, 30079, 30207, 30335, 30463, 30591,\
-		30719, 30847, 30975, 31103, 31231, 31359, 31487, 31615, 31743, 31871, 31999, 32127, 32255, 32383, 32511, 32639,\
-		32767}
-
-	#define mountains_release1 {\
-		0, 63, 127, 191, 255, 319, 383, 447, 511, 575, 639, 703, 767, 831, 895, 959,\
-		1023, 1087, 1151, 1215, 1279, 1343, 1407, 1471, 1535, 1599, 1663, 1727, 1791, 1855, 1919, 1983,\
-		2047, 2111, 2175, 2239, 2303, 2367, 2431, 2495, 2559, 2623, 2687, 2751, 2815, 2879, 2943, 3007,\
-		3071, 3135, 3199, 3263, 3327, 3391, 3455, 3519, 3583, 3647, 3711, 3775, 3839, 3903, 3967, 4031,\
-		4095, 4159, 4223, 4287, 4351, 4415, 4479, 4543, 4607, 4671, 4735, 4799, 4863, 4927, 4991, 5055,\
-		5119, 5183, 5247, 5311, 5375, 5439, 5503, 5567, 5631, 5695, 5759, 5823, 5887, 5951, 6015, 6079,\
-		6143, 6207, 6271, 6335, 6399, 6463, 6527, 6591, 6655, 6719, 6783, 6847, 6911, 6975, 7039, 7103,\
-		7167, 7231, 7295, 7359, 7423, 7487, 7551, 7615, 7679, 7743, 7807, 7871, 7935, 7999, 8063, 8127,\
-		8191, 8383, 8575, 8767, 8959, 9151, 9343, 9535, 9727, 9919, 10111, 10303, 10495, 10687, 10879, 11071,\
-		11263, 11455, 11647, 11839, 12031, 12223, 12415, 12607, 12799, 12991, 13183, 13375, 13567, 13759, 13951, 14143,\
-		14335, 14527, 14719, 14911, 15103, 15295, 15487, 15679, 15871, 16063, 16255, 16447, 16639, 16831, 17023, 17215,\
-		17407, 17599, 17791, 17983, 18175, 18367, 18559, 18751, 18943, 19135, 19327, 19519, 19711, 19903, 20095, 20287,\
-		20479, 20671, 20863, 21055, 21247, 21439, 21631, 21823, 22015, 22207, 22399, 22591, 22783, 22975, 23167, 23359,\
-		23551, 23743, 23935, 24127, 24319, 24511, 24703, 24895, 25087, 25279, 25471, 25663, 25855, 26047, 26239, 26431,\
-		26623, 26815, 27007, 27199, 27391, 27583, 27775, 27967, 28159, 28351, 28543, 28735, 28927, 29119, 29311, 29503,\
-		29695, 29887, 30079, 30271, 30463, 30655, 30847, 31039, 31231, 31423, 31615, 31807, 31999, 32191, 32383, 32575,\
-		32767}
-
-	#define mountains_release2 {\
-		0, 383, 767, 1151, 1535, 1919, 2303, 2687, 3071, 3455, 3839, 4223, 4607, 4991, 5375, 5759,\
-		6143, 6527, 6911, 7295, 7679, 8063, 8447, 8831, 9215, 9599, 9983, 10367, 10751, 11135, 11519, 11903,\
-		12287, 12671, 13055, 13439, 13823, 14207, 14591, 14975, 15359, 15743, 16127, 16511, 16895, 17279, 17663, 18047,\
-		18431, 18815, 19199, 19583, 19967, 20351, 20735, 21119, 21503, 21887, 22271, 22655, 23039, 23423, 23807, 24191,\
-		24575, 24319, 24063, 23807, 23551, 23295, 23039, 22783, 22527, 22271, 22015, 21759, 21503, 21247, 20991, 20735,\
-		20479, 20223, 19967, 19711, 19455, 19199, 18943, 18687, 18431, 18175, 17919, 17663, 17407, 17151, 16895, 16639,\
-		16383, 16127, 15871, 15615, 15359, 15103, 14847, 14591, 14335, 14079, 13823, 13567, 13311, 13055, 12799, 12543,\
-		12287, 12031, 11775, 11519, 11263, 11007, 10751, 10495, 10239, 9983, 9727, 9471, 9215, 8959, 8703, 8447,\
-		8191, 8319, 8447, 8575, 8703, 8831, 8959, 9087, 9215, 9343, 9471, 9599, 9727, 9855, 9983, 10111,\
-		10239, 10367, 10495, 10623, 10751, 10879, 11007, 11135, 11263, 11391, 11519, 11647, 11775, 11903, 12031, 12159,\
-		12287, 12415, 12543, 12671, 12799, 12927, 13055, 13183, 13311, 13439, 13567, 13695, 13823, 13951, 14079, 14207,\
-		14335, 14463, 14591, 14719, 14847, 14975, 15103, 15231, 15359, 15487, 15615, 15743, 15871, 15999, 16127, 16255,\
-		16383, 16639, 16895, 17151, 17407, 17663, 17919, 18175, 18431, 18687, 18943, 19199, 19455, 19711, 19967, 20223,\
-		20479, 20735, 20991, 21247, 21503, 21759, 22015, 22271, 22527, 22783, 23039, 23295, 23551, 23807, 24063, 24319,\
-		24575, 24831, 25087, 25343, 25599, 25855, 26111, 26367, 26623, 26879, 27135, 27391, 27647, 27903, 28159, 28415,\
-		28671, 28927, 29183, 29439, 29695, 29951, 30207, 30463, 30719, 30975, 31231, 31487, 31743, 31999, 32255, 32511,\
-		32767}
-
-	#define mountains_release3 {\
-		0, 639, 1279, 1919, 2559, 3199, 3839, 4479, 5119, 5759, 6399, 7039, 7679, 8319, 8959, 9599,\
-		10239, 10879, 11519, 12159, 12799, 13439, 14079, 14719, 15359, 15999, 16639, 17279, 17919, 18559, 19199, 19839,\
-		20479, 20607, 20735, 20863, 20991, 21119, 21247, 21375, 21503, 21631, 21759, 21887, 22015, 22143, 22271, 22399,\
-		22527, 22655, 22783, 22911, 23039, 23167, 23295, 23423, 23551, 23679, 23807, 23935, 24063, 24191, 24319, 24447,\
-		24575, 23935, 23295, 22655, 22015, 21375, 20735, 20095, 19455, 18815, 18175, 17535, 16895, 16255, 15615, 14975,\
-		14335, 13695, 13055, 12415, 11775, 11135, 10495, 9855, 9215, 8575, 7935, 7295, 6655, 6015, 5375, 4735,\
-		4095, 4223, 4351, 4479, 4607, 4735, 4863, 4991, 5119, 5247, 5375, 5503, 5631, 5759, 5887, 6015,\
-		6143, 6271, 6399, 6527, 6655, 6783, 6911, 7039, 7167, 7295, 7423, 7551, 7679, 7807, 7935, 8063,\
-		8191, 8831, 9471, 10111, 10751, 11391, 12031, 12671, 13311, 13951, 14591, 15231, 15871, 16511, 17151, 17791,\
-		18431, 19071, 19711, 20351, 20991, 21631, 22271, 22911, 23551, 24191, 24831, 25471, 26111, 26751, 27391, 28031,\
-		28671, 28287, 27903, 27519, 27135, 26751, 26367, 25983, 25599, 25215, 24831, 24447, 24063, 23679, 23295, 22911,\
-		22527, 22143, 21759, 21375, 20991, 20607, 20223, 19839, 19455, 19071, 18687, 18303, 17919, 17535, 17151, 16767,\
-		16383, 16255, 16127, 15999, 15871, 15743, 15615, 15487, 15359, 15231, 15103, 14975, 14847, 14719, 14591, 14463,\
-		14335, 14207, 14079, 13951, 13823, 13695, 13567, 13439, 13311, 13183, 13055, 12927, 12799, 12671, 12543, 12415,\
-		12287, 12927, 13567, 14207, 14847, 15487, 16127, 16767, 17407, 18047, 18687, 19327, 19967, 20607, 21247, 21887,\
-		22527, 23167, 23807, 24447, 25087, 25727, 26367, 27007, 27647, 28287, 28927, 29567, 30207, 30847, 31487, 32127,\
-		32767}
-
-	#define rubberband_attacks0 {\
-		0, 1236, 1349, 1488, 1645, 1814, 1989, 2163, 2331, 2489, 2639, 2780, 2912, 3036, 3151, 3257,\
-		3354, 3443, 3522, 3593, 3656, 3709, 3753, 3788, 3813, 3828, 3832, 3826, 3809, 3782, 3746, 3700,\
-		3645, 3581, 3509, 3428, 3338, 3240, 3133, 3018, 2894, 2762, 2621, 2472, 2315, 2149, 1974, 1792,\
-		1600, 1401, 1193, 976, 755, 541, 346, 183, 63, 0, 1, 58, 159, 292, 444, 604,\
-		761, 912, 1056, 1194, 1327, 1455, 1577, 1695, 1808, 1916, 2019, 2117, 2210, 2298, 2382, 2460,\
-		2534, 2602, 2666, 2727, 2794, 2874, 2978, 3113, 3289, 3512, 3778, 4078, 4403, 4745, 5096, 5447,\
-		5796, 6143, 6488, 6833, 7176, 7519, 7862, 8204, 8546, 8888, 9230, 9572, 9914, 10256, 10598, 10940,\
-		11282, 11625, 11967, 12311, 12659, 13011, 13370, 13737, 14113, 14498, 14889, 15286, 15687, 16090, 16494, 16896,\
-		17296, 17692, 18082, 18465, 18839, 19204, 19562, 19913, 20259, 20603, 20946, 21288, 21630, 21972, 22314, 22656,\
-		22998, 23340, 23682, 24024, 24366, 24708, 25051, 25394, 25738, 26082, 26428, 26776, 27125, 27477, 27826, 28165,\
-		28486, 28779, 29036, 29249, 29415, 29543, 29640, 29717, 29781, 29843, 29907, 29977, 30052, 30131, 30216, 30305,\
-		30399, 30499, 30603, 30712, 30825, 30944, 31068, 31196, 31331, 31470, 31616, 31768, 31926, 32086, 32235, 32362,\
-		32454, 32500, 32487, 32410, 32280, 32109, 31908, 31692, 31471, 31256, 31050, 30852, 30663, 30482, 30309, 30145,\
-		29990, 29842, 29704, 29573, 29452, 29338, 29233, 29137, 29049, 28970, 28899, 28837, 28784, 28740, 28706, 28682,\
-		28667, 28663, 28670, 28687, 28714, 28751, 28797, 28852, 28917, 28990, 29071, 29162, 29261, 29369, 29486, 29611,\
-		29745, 29888, 30040, 30200, 30370, 30548, 30734, 30930, 31134, 31347, 31569, 31797, 32025, 32243, 32445, 32622,\
-		32767}
-
-	#define rubberband_attacks1 {\
-		0, 0, 112, 252, 412, 580, 749, 909, 1060, 1201, 1332, 1454, 1566, 1668, 1760, 1843,\
-		1916, 1983, 2057, 2155, 2296, 2496, 2767, 3096, 3465, 3857, 4254, 4640, 5012, 5371, 5717, 6049,\
-		6368, 6673, 6966, 7244, 7510, 7762, 8001, 8226, 8438, 8637, 8821, 8981, 9109, 9193, 9226, 9199,\
-		9119, 8997, 8842, 8664, 8470, 8264, 8045, 7813, 7569, 7313, 7045, 6764, 6472, 6168, 5851, 5523,\
-		5182, 4830, 4465, 4092, 3724, 3380, 3078, 2836, 2666, 2557, 2492, 2452, 2422, 2386, 2343, 2293,\
-		2237, 2176, 2110, 2040, 1966, 1887, 1804, 1717, 1626, 1530, 1430, 1326, 1221, 1137, 1098, 1128,\
-		1252, 1486, 1815, 2215, 2661, 3129, 3601, 4070, 4538, 5003, 5466, 5926, 6385, 6842, 7298, 7756,\
-		8215, 8675, 9137, 9601, 10066, 10534, 11011, 11507, 12028, 12583, 13178, 13806, 14460, 15130, 15809, 16488,\
-		17158, 17812, 18440, 19035, 19590, 20112, 20607, 21085, 21552, 22018, 22481, 22943, 23403, 23862, 24320, 24777,\
-		25234, 25692, 26152, 26615, 27080, 27548, 28018, 28489, 28958, 29404, 29803, 30132, 30367, 30491, 30521, 30481,\
-		30397, 30293, 30188, 30088, 29993, 29901, 29814, 29731, 29652, 29578, 29508, 29442, 29381, 29326, 29276, 29232,\
-		29197, 29166, 29127, 29061, 28952, 28782, 28540, 28238, 27894, 27527, 27153, 26788, 26436, 26095, 25767, 25450,\
-		25146, 24854, 24574, 24305, 24049, 23805, 23573, 23354, 23148, 22955, 22776, 22621, 22499, 22420, 22393, 22425,\
-		22510, 22637, 22798, 22981, 23180, 23392, 23617, 23856, 24108, 24374, 24653, 24945, 25250, 25569, 25901, 26247,\
-		26606, 26979, 27365, 27761, 28153, 28523, 28852, 29122, 29322, 29463, 29562, 29636, 29702, 29775, 29858, 29951,\
-		30053, 30165, 30286, 30418, 30559, 30709, 30870, 31040, 31219, 31409, 31608, 31816, 32033, 32248, 32449, 32626,\
-		32767}
-
-	#define rubberband_attacks2 {\
-		0, 0, 236, 534, 876, 1246, 1625, 1998, 2363, 2720, 3069, 3409, 3742, 4066, 4381, 4689,\
-		4988, 5280, 5570, 5863, 6165, 6482, 6819, 7169, 7528, 7887, 8241, 8584, 8915, 9234, 9541, 9836,\
-		10119, 10391, 10651, 10900, 11137, 11362, 11575, 11777, 11967, 12145, 12311, 12456, 12573, 12653, 12689, 12673,\
-		12613, 12517, 12392, 12246, 12088, 11919, 11739, 11549, 11349, 11140, 10921, 10694, 10457, 10211, 9956, 9691,\
-		9418, 9135, 8843, 8543, 8240, 7942, 7654, 7383, 7134, 6904, 6685, 6473, 6262, 6046, 5826, 5602,\
-		5374, 5144, 4912, 4677, 4442, 4205, 3967, 3728, 3488, 3247, 3005, 2763, 2524, 2312, 2153, 2076,\
-		2106, 2264, 2530, 2877, 3279, 3708, 4141, 4572, 4997, 5415, 5821, 6214, 6597, 6972, 7342, 7711,\
-		8080, 8450, 8822, 9195, 9569, 9948, 10342, 10769, 11244, 11781, 12391, 13064, 13784, 14535, 15302, 16069,\
-		16820, 17540, 18213, 18823, 19360, 19835, 20261, 20656, 21034, 21409, 21782, 22153, 22524, 22893, 23262, 23632,\
-		24007, 24390, 24783, 25189, 25606, 26032, 26462, 26896, 27325, 27727, 28074, 28340, 28497, 28528, 28451, 28292,\
-		28080, 27841, 27598, 27357, 27116, 26876, 26637, 26399, 26162, 25926, 25692, 25460, 25230, 25002, 24778, 24558,\
-		24342, 24131, 23919, 23700, 23470, 23221, 22950, 22662, 22364, 22061, 21761, 21469, 21186, 20912, 20648, 20393,\
-		20147, 19910, 19682, 19464, 19255, 19055, 18865, 18685, 18515, 18357, 18212, 18087, 17990, 17930, 17915, 17951,\
-		18031, 18148, 18293, 18459, 18637, 18827, 19029, 19242, 19467, 19704, 19952, 20213, 20484, 20768, 21063, 21370,\
-		21689, 22020, 22363, 22717, 23076, 23434, 23785, 24121, 24439, 24741, 25034, 25324, 25616, 25915, 26223, 26538,\
-		26862, 27194, 27535, 27884, 28241, 28606, 28979, 29361, 29751, 30149, 30555, 30970, 31390, 31799, 32177, 32506,\
-		32767}
-
-	#define rubberband_attacks3 {\
-		0, 0, 78, 176, 285, 395, 497, 587, 667, 735, 793, 839, 874, 898, 912, 933,\
-		999, 1148, 1418, 1822, 2326, 2892, 3482, 4067, 4643, 5208, 5764, 6310, 6846, 7373, 7890, 8397,\
-		8895, 9382, 9860, 10329, 10782, 11214, 11615, 11978, 12301, 12591, 12854, 13098, 13328, 13546, 13751, 13944,\
-		14126, 14296, 14454, 14600, 14735, 14858, 14969, 15069, 15157, 15233, 15295, 15343, 15375, 15391, 15392, 15380,\
-		15356, 15320, 15274, 15219, 15155, 15085, 15008, 14924, 14833, 14736, 14632, 14522, 14404, 14280, 14144, 13988,\
-		13806, 13591, 13343, 13072, 12785, 12489, 12190, 11888, 11581, 11271, 10956, 10639, 10320, 10002, 9686, 9372,\
-		9061, 8751, 8447, 8177, 7980, 7894, 7952, 8144, 8434, 8782, 9151, 9515, 9863, 10181, 10459, 10693,\
-		10893, 11070, 11238, 11404, 11570, 11737, 11903, 12075, 12282, 12562, 12953, 13485, 14146, 14896, 15699, 16518,\
-		17314, 18051, 18691, 19198, 19566, 19830, 20028, 20197, 20363, 20529, 20696, 20862, 21030, 21211, 21416, 21657,\
-		21943, 22268, 22620, 22986, 23354, 23694, 23969, 24140, 24171, 24061, 23848, 23570, 23264, 22953, 22641, 22327,\
-		22010, 21692, 21374, 21057, 20743, 20433, 20127, 19825, 19527, 19233, 18948, 18680, 18438, 18229, 18052, 17900,\
-		17767, 17644, 17528, 17419, 17316, 17220, 17130, 17047, 16971, 16902, 16841, 16787, 16743, 16709, 16687, 16677,\
-		16681, 16700, 16735, 16785, 16850, 16928, 17018, 17120, 17233, 17358, 17495, 17644, 17804, 17976, 18159, 18355,\
-		18562, 18782, 19015, 19262, 19529, 19824, 20154, 20525, 20932, 21368, 21825, 22295, 22775, 23264, 23764, 24273,\
-		24791, 25320, 25858, 26405, 26963, 27530, 28107, 28694, 29283, 29841, 30329, 30711, 30956, 31088, 31143, 31160,\
-		31175, 31201, 31239, 31287, 31346, 31417, 31498, 31591, 31694, 31809, 31934, 32071, 32219, 32374, 32526, 32661,\
-		32767}
-
-	#define rubberband_attacks4 {\
-		0, 0, 224, 512, 841, 1186, 1526, 1854, 2171, 2476, 2770, 3051, 3322, 3580, 3827, 4073,\
-		4339, 4646, 5016, 5455, 5946, 6467, 6998, 7522, 8038, 8545, 9043, 9533, 10014, 10487, 10951, 11407,\
-		11855, 12294, 12724, 13146, 13550, 13923, 14248, 14510, 14708, 14854, 14964, 15054, 15134, 15207, 15273, 15332,\
-		15386, 15434, 15477, 15514, 15545, 15571, 15592, 15607, 15617, 15628, 15648, 15687, 15753, 15848, 15961, 16085,\
-		16209, 16329, 16444, 16557, 16667, 16775, 16882, 16989, 17096, 17203, 17311, 17419, 17527, 17635, 17731, 17802,\
-		17830, 17803, 17722, 17601, 17456, 17302, 17146, 16985, 16816, 16634, 16437, 16231, 16019, 15806, 15596, 15388,\
-		15184, 14983, 14788, 14613, 14480, 14410, 14421, 14508, 14649, 14824, 15010, 15185, 15329, 15418, 15432, 15364,\
-		15232, 15059, 14866, 14670, 14471, 14272, 14071, 13875, 13720, 13648, 13704, 13925, 14294, 14768, 15302, 15855,\
-		16382, 16840, 17185, 17376, 17405, 17315, 17149, 16951, 16750, 16551, 16353, 16157, 15966, 15799, 15677, 15622,\
-		15651, 15752, 15903, 16082, 16268, 16438, 16571, 16646, 16641, 16558, 16416, 16236, 16039, 15838, 15633, 15425,\
-		15214, 15001, 14789, 14585, 14391, 14211, 14044, 13884, 13729, 13575, 13434, 13319, 13246, 13230, 13267, 13343,\
-		13443, 13551, 13659, 13767, 13874, 13982, 14088, 14195, 14303, 14412, 14522, 14635, 14751, 14872, 14996, 15119,\
-		15229, 15319, 15380, 15415, 15433, 15443, 15453, 15470, 15491, 15518, 15551, 15589, 15633, 15682, 15737, 15797,\
-		15864, 15938, 16020, 16112, 16228, 16382, 16590, 16865, 17200, 17579, 17988, 18411, 18843, 19284, 19733, 20190,\
-		20656, 21130, 21613, 22104, 22604, 23113, 23630, 24156, 24687, 25204, 25687, 26115, 26472, 26769, 27030, 27275,\
-		27524, 27785, 28057, 28341, 28636, 28944, 29262, 29593, 29935, 30289, 30654, 31031, 31420, 31813, 32186, 32513,\
-		32767}
-
-	#define newest_bounce_attack0 {\
-		0, 688, 1461, 2317, 3252, 4265, 5352, 6509, 7734, 9023, 10372, 11776, 13232, 14736, 16284, 17870,\
-		19491, 21142, 22818, 24515, 26227, 27951, 29681, 31412, 32394, 30681, 29013, 27422, 25936, 24581, 23384, 22364,\
-		21541, 20928, 20537, 20373, 20438, 20731, 21245, 21970, 22892, 23992, 25250, 26642, 28141, 29720, 31349, 32537,\
-		30940, 29576, 28613, 28167, 28292, 28970, 30116, 31585, 32340, 31116, 31197, 32513, 31510, 32181, 32212, 32245,\
-		32281, 32317, 32356, 32395, 32437, 32479, 32522, 32566, 32610, 32655, 32700, 32745, 32743, 32663, 32557, 32628,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767}
-
-	#define newest_bounce_attack1 {\
-		0, 688, 1461, 2317, 3252, 4265, 5352, 6509, 7734, 9023, 10372, 11776, 13232, 14736, 16284, 17870,\
-		19491, 21142, 22818, 24515, 26227, 27951, 29681, 31412, 32394, 30678, 28994, 27362, 25802, 24333, 22971, 21732,\
-		20631, 19682, 18893, 18275, 17835, 17576, 17501, 17611, 17903, 18373, 19015, 19820, 20778, 21877, 23103, 24440,\
-		25872, 27382, 28951, 30559, 32188, 31717, 30140, 28708, 27497, 26570, 25975, 25742, 25882, 26387, 27227, 28358,\
-		29718, 31234, 32709, 31180, 30023, 29501, 29733, 30662, 32072, 31898, 31043, 31826, 32035, 32537, 31791, 32715,\
-		32718, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767}
-
-	#define newest_bounce_attack2 {\
-		0, 688, 1461, 2317, 3252, 4265, 5352, 6509, 7734, 9023, 10372, 11776, 13232, 14736, 16284, 17870,\
-		19491, 21142, 22818, 24515, 26227, 27951, 29681, 31412, 32394, 30676, 28981, 27324, 25716, 24170, 22698, 21312,\
-		20021, 18837, 17768, 16821, 16004, 15323, 14783, 14387, 14138, 14037, 14085, 14280, 14621, 15104, 15724, 16477,\
-		17355, 18352, 19459, 20666, 21965, 23344, 24791, 26296, 27846, 29429, 31032, 32642, 31287, 29715, 28220, 26834,\
-		25588, 24512, 23628, 22956, 22511, 22301, 22332, 22599, 23098, 23816, 24734, 25833, 27085, 28462, 29931, 31460,\
-		32522, 30999, 29597, 28409, 27512, 26964, 26799, 27027, 27631, 28570, 29781, 31183, 32684, 31350, 30066, 29294,\
-		29178, 29736, 30862, 32340, 31640, 30583, 30679, 31875, 31998, 31331, 32667, 31397, 32285, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767}
-
-	#define newest_bounce_attack3 {\
-		0, 688, 1461, 2317, 3252, 4265, 5352, 6509, 7734, 9023, 10372, 11776, 13232, 14736, 16284, 17870,\
-		19491, 21142, 22818, 24515, 26227, 27951, 29681, 31412, 32394, 30675, 28974, 27300, 25662, 24069, 22529, 21050,\
-		19639, 18305, 17054, 15892, 14825, 13858, 12997, 12246, 11607, 11085, 10681, 10397, 10234, 10193, 10273, 10473,\
-		10792, 11228, 11777, 12437, 13203, 14072, 15037, 16093, 17235, 18455, 19747, 21104, 22518, 23981, 25486, 27024,\
-		28586, 30165, 31751, 32198, 30625, 29080, 27581, 26142, 24778, 23504, 22332, 21274, 20342, 19543, 18887, 18379,\
-		18025, 17827, 17786, 17903, 18176, 18601, 19173, 19885, 20730, 21698, 22779, 23960, 25229, 26572, 27975, 29423,\
-		30900, 32390, 31655, 30192, 28788, 27471, 26269, 25205, 24301, 23574, 23040, 22707, 22583, 22669, 22963, 23457,\
-		24140, 24998, 26013, 27162, 28422, 29767, 31168, 32596, 31512, 30135, 28869, 27765, 26867, 26209, 25819, 25709,\
-		25884, 26335, 27044, 27980, 29104, 30372, 31731, 32407, 31048, 29829, 28846, 28175, 27868, 27948, 28406, 29205,\
-		30281, 31548, 32628, 31309, 30218, 29522, 29325, 29657, 30463, 31619, 32588, 31339, 30519, 30368, 30928, 32032,\
-		32185, 31185, 31085, 31939, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
-		32767}
-
-	#define newest_bounce_attack4 {\
-		0, 693, 1472, 2334, 3276, 4296, 5391, 6557, 7791, 9089, 10447, 11862, 13329, 14844, 16403, 18001,\
-		19634, 21297, 22985, 24694, 26419, 28156, 29898, 31642, 32631, 30899, 29181, 27485, 25816, 24182, 22587, 21038,\
-		19540, 18099, 16721, 15409, 14170, 13006, 11923, 10923, 10011, 9190, 8462, 7830, 7295, 6860, 6525, 6292,\
-		6161, 6131, 6204, 6377, 6651, 7023, 7492, 8055, 8710, 9455, 10286, 11199, 12191, 13258, 14395, 15598,\
-		16862, 18182, 19553, 20969, 22425, 23915, 25434, 26975, 28533, 30102, 31675, 32767, 31203, 29654, 28129, 26636,\
-		25181, 23774, 22420, 21127, 19901, 18748, 17674, 16685, 15784, 14977, 14268, 13659, 13153, 12753, 12460, 12276,\
-		12200, 12233, 12375, 12624, 12978, 13435, 13992, 14646, 15394, 16230, 17151, 18150, 19224, 20364, 21566, 22824,\
-		24129, 25475, 26855, 28262, 29688, 31126, 32567, 32009, 30583, 29180, 27811, 26484, 25210, 23997, 22853, 21788,\
-		20807, 19918, 19127, 18439, 17859, 17390, 17035, 16797, 16676, 16674, 16789, 17020, 17366, 17822, 18387, 19054,\
-		19819, 20676, 21619, 22639, 23731, 24884, 26092, 27344, 28633, 29947, 31279, 32617, 32061, 30739, 29445, 28191,\
-		26990, 25854, 24794, 23819, 22940, 22164, 21499, 20950, 20524, 20224, 20052, 20009, 20096, 20310, 20650, 21112,\
-		21689, 22377, 23168, 24053, 25024, 26070, 27181, 28346, 29552, 30787, 32040, 32717, 31468, 30246, 29067, 27947,\
-		26900, 25941, 25083, 24337, 23713, 23219, 22861, 22644, 22569, 22638, 22849, 23199, 23681, 24290, 25015, 25848,\
-		26775, 27784, 28860, 29989, 31155, 32342, 32481, 31304, 30164, 29083, 28080, 27174, 26383, 25720, 25197, 24824,\
-		24608, 24551, 24655, 24916, 25330, 25887, 26576, 27384, 28296, 29293, 30357, 31466, 32600, 32277, 31162, 30100,\
-		29118, 28241, 27492, 26891, 26451, 26184, 26097, 26190, 26461, 26901, 27500, 28240, 29101, 30061, 31094, 32767,\
-		32767}
-
-	#define newest_bounce_release0 {\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 139, 210, 104, 24, 22, 67, 112, 157, 201, 245, 288, 330, 372, 411, 450,\
-		486, 522, 555, 586, 1257, 254, 1570, 1651, 427, 1182, 2651, 3797, 4475, 4600, 4154, 3191,\
-		1827, 230, 1418, 3047, 4626, 6125, 7517, 8775, 9875, 10797, 11522, 12036, 12329, 12394, 12230, 11839,\
-		11226, 10403, 9383, 8186, 6831, 5345, 3754, 2086, 373, 1355, 3086, 4816, 6540, 8252, 9949, 11625,\
-		13276, 14897, 16483, 18031, 19535, 20991, 22395, 23744, 25033, 26258, 27415, 28502, 29515, 30450, 31306, 32079,\
-		32767}
-
-	#define newest_bounce_release1 {\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		49, 52, 976, 230, 732, 941, 1724, 869, 695, 2105, 3034, 3266, 2744, 1587, 58, 1533,\
-		3049, 4409, 5540, 6380, 6885, 7025, 6792, 6197, 5270, 4059, 2627, 1050, 579, 2208, 3816, 5385,\
-		6895, 8327, 9664, 10890, 11989, 12947, 13752, 14394, 14864, 15156, 15266, 15191, 14932, 14492, 13874, 13085,\
-		12136, 11035, 9796, 8434, 6965, 5405, 3773, 2089, 373, 1355, 3086, 4816, 6540, 8252, 9949, 11625,\
-		13276, 14897, 16483, 18031, 19535, 20991, 22395, 23744, 25033, 26258, 27415, 28502, 29515, 30450, 31306, 32079,\
-		32767}
-
-	#define newest_bounce_release2 {\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 482, 1370, 100, 1436, 769, 892, 2088, 2184, 1127, 427, 1905, 3031,\
-		3589, 3473, 2701, 1417, 83, 1584, 2986, 4197, 5136, 5740, 5968, 5803, 5255, 4358, 3170, 1768,\
-		245, 1307, 2836, 4305, 5682, 6934, 8033, 8951, 9669, 10168, 10435, 10466, 10256, 9811, 9139, 8255,\
-		7179, 5933, 4547, 3052, 1480, 125, 1735, 3338, 4921, 6471, 7976, 9423, 10802, 12101, 13308, 14415,\
-		15412, 16290, 17043, 17663, 18146, 18487, 18682, 18730, 18629, 18380, 17984, 17444, 16763, 15946, 14999, 13930,\
-		12746, 11455, 10069, 8597, 7051, 5443, 3786, 2091, 373, 1355, 3086, 4816, 6540, 8252, 9949, 11625,\
-		13276, 14897, 16483, 18031, 19535, 20991, 22395, 23744, 25033, 26258, 27415, 28502, 29515, 30450, 31306, 32079,\
-		32767}
-
-	#define newest_bounce_release3 {\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 828, 1682, 1582,\
-		582, 735, 1839, 2399, 2248, 1428, 179, 1148, 2304, 3110, 3442, 3245, 2549, 1458, 139, 1219,\
-		2486, 3562, 4361, 4819, 4899, 4592, 3921, 2938, 1719, 360, 1036, 2395, 3663, 4787, 5723, 6432,\
-		6883, 7058, 6948, 6558, 5900, 5002, 3898, 2632, 1255, 171, 1599, 3000, 4345, 5605, 6754, 7769,\
-		8627, 9310, 9804, 10098, 10184, 10060, 9727, 9193, 8466, 7562, 6498, 5296, 3979, 2575, 1112, 377,\
-		1867, 3344, 4792, 6195, 7538, 8807, 9988, 11069, 12037, 12882, 13594, 14166, 14591, 14864, 14981, 14940,\
-		14742, 14388, 13880, 13224, 12425, 11493, 10435, 9263, 7989, 6625, 5186, 3687, 2142, 569, 1016, 2602,\
-		4181, 5743, 7281, 8786, 10249, 11663, 13020, 14312, 15532, 16674, 17730, 18695, 19564, 20330, 20990, 21539,\
-		21975, 22294, 22494, 22574, 22533, 22370, 22086, 21682, 21160, 20521, 19770, 18909, 17942, 16875, 15713, 14462,\
-		13128, 11717, 10238, 8698, 7105, 5467, 3793, 2092, 373, 1355, 3086, 4816, 6540, 8252, 9949, 11625,\
-		13276, 14897, 16483, 18031, 19535, 20991, 22395, 23744, 25033, 26258, 27415, 28502, 29515, 30450, 31306, 32079,\
-		32767}
-
-	#define newest_bounce_release4 {\
-		0, 0, 1673, 2706, 3666, 4527, 5267, 5866, 6306, 6577, 6670, 6583, 6316, 5876, 5275, 4526,\
-		3649, 2667, 1605, 490, 167, 1301, 2410, 3474, 4471, 5383, 6191, 6880, 7437, 7851, 8112, 8216,\
-		8159, 7943, 7570, 7047, 6384, 5593, 4687, 3684, 2603, 1463, 286, 425, 1612, 2778, 3907, 4983,\
-		5992, 6919, 7752, 8477, 9086, 9568, 9918, 10129, 10198, 10123, 9906, 9548, 9054, 8430, 7684, 6826,\
-		5867, 4820, 3700, 2521, 1299, 50, 727, 1980, 3215, 4421, 5586, 6697, 7743, 8714, 9599, 10390,\
-		11078, 11655, 12117, 12457, 12671, 12758, 12715, 12543, 12243, 11817, 11268, 10603, 9827, 8948, 7973, 6913,\
-		5777, 4576, 3322, 2028, 706, 150, 1488, 2820, 4134, 5423, 6675, 7883, 9036, 10128, 11148, 12091,\
-		12948, 13713, 14380, 14945, 15401, 15747, 15978, 16093, 16091, 15970, 15732, 15377, 14908, 14328, 13640, 12849,\
-		11960, 10979, 9914, 8770, 7557, 6283, 4956, 3587, 2184, 758, 200, 1641, 3079, 4505, 5912, 7292,\
-		8638, 9943, 11201, 12403, 13543, 14617, 15616, 16537, 17373, 18121, 18775, 19332, 19789, 20143, 20392, 20534,\
-		20567, 20491, 20307, 20014, 19614, 19108, 18499, 17790, 16983, 16082, 15093, 14019, 12866, 11640, 10347, 8993,\
-		7586, 6131, 4638, 3113, 1564, 0, 1092, 2665, 4234, 5792, 7333, 8852, 10342, 11798, 13214, 14585,\
-		15905, 17169, 18372, 19509, 20576, 21568, 22481, 23312, 24057, 24712, 25275, 25744, 26116, 26390, 26563, 26636,\
-		26606, 26475, 26242, 25907, 25472, 24937, 24305, 23577, 22756, 21844, 20844, 19761, 18597, 17358, 16046, 14668,\
-		13227, 11729, 10180, 8585, 6951, 5282, 3586, 1868, 136, 1125, 2869, 4611, 6348, 8073, 9782, 11470,\
-		13133, 14766, 16364, 17923, 19438, 20905, 22320, 23678, 24976, 26210, 27376, 28471, 29491, 30433, 31295, 32074,\
-		32767}
-
-	#define new_waves_attack0 {\
-		0, 17, 37, 58, 80, 104, 129, 155, 184, 214, 246, 280, 316, 354, 395, 438,\
-		483, 531, 582, 637, 694, 754, 818, 886, 958, 1033, 1113, 1197, 1285, 1378, 1476, 1579,\
-		1687, 1801, 1920, 2045, 2176, 2313, 2456, 2605, 2760, 2922, 3090, 3265, 3446, 3634, 3828, 4028,\
-		4235, 4447, 4666, 4890, 5120, 5354, 5594, 5838, 6086, 6338, 6593, 6851, 7111, 7373, 7636, 7900,\
-		8164, 8428, 8691, 8952, 9212, 9469, 9723, 9974, 10222, 10465, 10703, 10936, 11165, 11388, 11605, 11816,\
-		12021, 12220, 12412, 12598, 12778, 12951, 13117, 13278, 13431, 13579, 13720, 13855, 13985, 14108, 14226, 14338,\
-		14445, 14547, 14644, 14736, 14823, 14906, 14985, 15059, 15129, 15196, 15259, 15319, 15376, 15429, 15479, 15527,\
-		15572, 15614, 15654, 15692, 15727, 15761, 15792, 15822, 15850, 15876, 15901, 15924, 15946, 15967, 15986, 15839,\
-		8170, 8000, 8002, 8008, 8013, 8020, 8027, 8035, 8044, 8054, 8064, 8076, 8089, 8104, 8120, 8138,\
-		8157, 8179, 8203, 8230, 8259, 8291, 8327, 8366, 8410, 8458, 8511, 8569, 8633, 8704, 8781, 8867,\
-		8961, 9064, 9177, 9301, 9436, 9585, 9747, 9924, 10116, 10326, 10553, 10799, 11066, 11353, 11663, 11995,\
-		12351, 12731, 13136, 13565, 14019, 14498, 14999, 15524, 16069, 16634, 17217, 17815, 18426, 19046, 19673, 20304,\
-		20936, 21564, 22187, 22800, 23401, 23988, 24558, 25108, 25638, 26146, 26630, 27090, 27526, 27936, 28323, 28685,\
-		29023, 29338, 29631, 29903, 30154, 30386, 30600, 30797, 30977, 31143, 31294, 31433, 31560, 31676, 31781, 31877,\
-		31965, 32044, 32117, 32182, 32242, 32296, 32345, 32390, 32430, 32467, 32500, 32530, 32557, 32582, 32604, 32624,\
-		32643, 32659, 32674, 32688, 32700, 32711, 32721, 32730, 32738, 32745, 32752, 32758, 32758, 32763, 32763, 32767}
-
-	#define new_waves_attack1 {\
-		0, 30, 65, 102, 141, 183, 229, 277, 329, 384, 444, 507, 574, 646, 722, 803,\
-		889, 980, 1077, 1179, 1287, 1401, 1520, 1646, 1779, 1917, 2062, 2213, 2370, 2533, 2702, 2877,\
-		3058, 3244, 3434, 3629, 3829, 4032, 4238, 4446, 4657, 4869, 5081, 5294, 5506, 5718, 5927, 6134,\
-		6339, 6540, 6737, 6929, 7117, 7300, 7478, 7650, 7816, 7976, 8129, 8277, 8418, 8553, 8682, 8804,\
-		8921, 9031, 9136, 9235, 9328, 9417, 9500, 9578, 9652, 9721, 9786, 9847, 9904, 9958, 10008, 10054,\
-		10098, 10139, 10177, 10212, 10245, 7126, 5242, 5259, 5279, 5300, 5325, 5352, 5382, 5416, 5454, 5496,\
-		5544, 5596, 5655, 5720, 5792, 5873, 5962, 6061, 6171, 6292, 6425, 6572, 6734, 6911, 7104, 7316,\
-		7545, 7795, 8064, 8354, 8665, 8996, 9349, 9722, 10114, 10525, 10953, 11395, 11849, 12314, 12786, 13262,\
-		13739, 14213, 14683, 15145, 15595, 16033, 16455, 16860, 17246, 17612, 17958, 18283, 18587, 18870, 19132, 19375,\
-		19598, 19804, 19992, 20164, 20320, 20463, 20592, 20709, 20815, 20910, 20997, 21074, 21144, 21207, 21264, 21314,\
-		21360, 21401, 21437, 21470, 21499, 21525, 21549, 21570, 21588, 21605, 17493, 10658, 10661, 10669, 10678, 10688,\
-		10700, 10714, 10730, 10749, 10771, 10797, 10826, 10861, 10901, 10947, 11001, 11063, 11135, 11219, 11315, 11426,\
-		11555, 11702, 11871, 12064, 12285, 12537, 12822, 13144, 13507, 13912, 14364, 14864, 15413, 16011, 16658, 17352,\
-		18088, 18862, 19667, 20495, 21337, 22183, 23023, 23849, 24651, 25421, 26153, 26842, 27484, 28077, 28620, 29114,\
-		29561, 29962, 30319, 30637, 30919, 31167, 31384, 31575, 31741, 31887, 32013, 32122, 32217, 32299, 32370, 32431,\
-		32484, 32530, 32569, 32603, 32632, 32657, 32679, 32698, 32713, 32727, 32739, 32749, 32758, 32760, 32765, 32767}
-
-	#define new_waves_attack2 {\
-		0, 38, 81, 128, 178, 233, 291, 354, 422, 494, 572, 656, 745, 840, 941, 1048,\
-		1161, 1281, 1408, 1540, 1679, 1825, 1976, 2133, 2296, 2464, 2636, 2812, 2992, 3174, 3359, 3545,\
-		3731, 3918, 4104, 4288, 4470, 4649, 4825, 4996, 5163, 5325, 5481, 5631, 5775, 5913, 6045, 6170,\
-		6288, 6401, 6507, 6607, 6700, 6788, 6871, 6948, 7019, 7086, 7148, 7206, 7259, 7309, 7355, 7397,\
-		3914, 3934, 3966, 4003, 4044, 4090, 4143, 4202, 4268, 4343, 4426, 4520, 4624, 4741, 4870, 5014,\
-		5173, 5348, 5540, 5750, 5979, 6227, 6495, 6783, 7089, 7414, 7756, 8113, 8484, 8867, 9257, 9654,\
-		10052, 10450, 10843, 11230, 11606, 11970, 12319, 12651, 12966, 13262, 13538, 13795, 14032, 14251, 14450, 14633,\
-		14799, 14949, 15084, 15206, 15316, 15414, 15502, 15580, 15650, 15712, 15767, 15816, 15860, 15899, 15933, 15963,\
-		7923, 7939, 7958, 7980, 8006, 8037, 8073, 8116, 8165, 8224, 8292, 8372, 8465, 8574, 8701, 8847,\
-		9017, 9212, 9437, 9693, 9985, 10315, 10685, 11098, 11554, 12054, 12597, 13180, 13798, 14446, 15116, 15800,\
-		16489, 17174, 17846, 18495, 19115, 19700, 20245, 20748, 21207, 21623, 21996, 22328, 22622, 22880, 23107, 23304,\
-		23475, 23623, 23750, 23860, 23954, 24035, 24104, 24163, 24213, 24256, 24293, 24324, 24350, 24373, 24392, 24377,\
-		12019, 12019, 12029, 12041, 12056, 12074, 12095, 12122, 12155, 12195, 12243, 12303, 12375, 12463, 12570, 12699,\
-		12855, 13044, 13270, 13540, 13860, 14240, 14684, 15200, 15795, 16470, 17229, 18068, 18980, 19955, 20978, 22029,\
-		23087, 24131, 25141, 26098, 26988, 27802, 28534, 29184, 29754, 30247, 30670, 31030, 31334, 31590, 31803, 31981,\
-		32128, 32250, 32350, 32433, 32501, 32557, 32603, 32640, 32671, 32696, 32716, 32733, 32747, 32758, 32763, 32767}
-
-	#define new_waves_attack3 {\
-		0, 48, 102, 161, 225, 296, 373, 456, 547, 644, 748, 860, 978, 1104, 1236, 1374,\
-		1518, 1667, 1820, 1977, 2135, 2296, 2456, 2616, 2773, 2928, 3080, 3226, 3368, 3503, 3632, 3754,\
-		3869, 3978, 4079, 4172, 4260, 4340, 4414, 4482, 4544, 4600, 4652, 2651, 2703, 2763, 2832, 2910,\
-		3000, 3102, 3217, 3347, 3494, 3657, 3838, 4038, 4256, 4494, 4749, 5021, 5309, 5609, 5919, 6235,\
-		6555, 6873, 7188, 7494, 7789, 8070, 8336, 8584, 8813, 9024, 9216, 9390, 9546, 9685, 9809, 9919,\
-		10015, 10100, 10174, 10239, 10296, 7179, 5306, 5352, 5407, 5473, 5551, 5645, 5756, 5888, 6043, 6225,\
-		6436, 6681, 6961, 7279, 7635, 8031, 8464, 8930, 9425, 9940, 10469, 11000, 11524, 12033, 12518, 12973,\
-		13393, 13775, 14117, 14421, 14688, 14920, 15121, 15292, 15439, 15563, 15667, 15755, 15829, 15891, 15942, 15985,\
-		7961, 7990, 8027, 8073, 8130, 8202, 8291, 8401, 8538, 8705, 8910, 9158, 9458, 9815, 10235, 10723,\
-		11282, 11909, 12598, 13339, 14116, 14910, 15701, 16469, 17196, 17867, 18473, 19010, 19478, 19878, 20217, 20500,\
-		20734, 20927, 21084, 21212, 21315, 21398, 21465, 21519, 21562, 21596, 17496, 10678, 10700, 10728, 10765, 10813,\
-		10876, 10956, 11060, 11195, 11367, 11586, 11863, 12211, 12643, 13171, 13806, 14555, 15416, 16379, 17425, 18522,\
-		19634, 20721, 21748, 22688, 23521, 24241, 24848, 25351, 25760, 26090, 26351, 26558, 26719, 26845, 26943, 27019,\
-		27077, 27122, 27156, 27183, 27203, 13409, 13413, 13429, 13450, 13479, 13519, 13572, 13643, 13740, 13869, 14041,\
-		14270, 14572, 14967, 15475, 16121, 16924, 17898, 19044, 20343, 21758, 23234, 24702, 26099, 27371, 28483, 29423,\
-		30194, 30812, 31296, 31671, 31957, 32174, 32337, 32459, 32550, 32617, 32667, 32704, 32732, 32752, 32767, 32767}
-
-	#define new_waves_attack4 {\
-		0, 52, 112, 179, 252, 334, 423, 520, 625, 738, 858, 985, 1119, 1257, 1400, 1546,\
-		1693, 1840, 1985, 2127, 2266, 2398, 2525, 2645, 2757, 2861, 2957, 3045, 3125, 3198, 3264, 3323,\
-		2017, 2080, 2154, 2240, 2340, 2454, 2585, 2734, 2902, 3088, 3294, 3519, 3760, 4016, 4284, 4560,\
-		4839, 5118, 5392, 5656, 5908, 6144, 6363, 6562, 6743, 6904, 7047, 7172, 7282, 7377, 7459, 7529,\
-		4005, 4067, 4142, 4234, 4345, 4478, 4638, 4827, 5049, 5307, 5602, 5935, 6303, 6704, 7131, 7574,\
-		8026, 8475, 8910, 9323, 9707, 10056, 10369, 10643, 10881, 11085, 11258, 11402, 11523, 11623, 11705, 11773,\
-		6000, 6053, 6122, 6209, 6320, 6458, 6632, 6847, 7111, 7431, 7812, 8257, 8767, 9335, 9952, 10602,\
-		11265, 11920, 12546, 13127, 13651, 14112, 14508, 14841, 15118, 15344, 15526, 15673, 15789, 15882, 15954, 16011,\
-		8010, 8053, 8112, 8189, 8292, 8426, 8602, 8830, 9122, 9491, 9949, 10506, 11166, 11923, 12762, 13656,\
-		14570, 15464, 16305, 17063, 17725, 18283, 18743, 19113, 19406, 19635, 19811, 19946, 20049, 20127, 20185, 20230,\
-		10036, 10070, 10117, 10183, 10274, 10398, 10567, 10796, 11103, 11509, 12034, 12699, 13515, 14480, 15572, 16749,\
-		17952, 19116, 20186, 21121, 21906, 22541, 23040, 23424, 23713, 23929, 24088, 24204, 24289, 24351, 24395, 24427,\
-		12075, 12101, 12138, 12192, 12270, 12381, 12538, 12761, 13073, 13503, 14084, 14850, 15827, 17017, 18394, 19894,\
-		21424, 22882, 24186, 25287, 26173, 26857, 27370, 27746, 28017, 28210, 28346, 28441, 28508, 28554, 28586, 28604,\
-		14123, 14143, 14172, 14215, 14280, 14377, 14520, 14731, 15040, 15484, 16111, 16973, 18112, 19546, 21241, 23105,\
-		24996, 26765, 28300, 29545, 30502, 31207, 31711, 32063, 32306, 32470, 32582, 32657, 32707, 32740, 32763, 32767}
-
-	#define new_waves_release0 {\
-		0, 16588, 16592, 16592, 16589, 16585, 16581, 16576, 16571, 16565, 16559, 16552, 16544, 16535, 16526, 16515,\
-		16504, 16491, 16477, 16461, 16444, 16424, 16403, 16380, 16354, 16326, 16294, 16260, 16222, 16180, 16134, 16083,\
-		16027, 15965, 15898, 15824, 15743, 15654, 15557, 15451, 15335, 15208, 15071, 14922, 14760, 14585, 14396, 14192,\
-		13973, 13739, 13488, 13221, 12938, 12638, 12321, 11989, 11642, 11280, 10904, 10517, 10118, 9711, 9297, 8878,\
-		8455, 8032, 7610, 7192, 6780, 6374, 5979, 5594, 5222, 4863, 4520, 4191, 3879, 3583, 3304, 3041,\
-		2794, 2563, 2348, 2149, 1963, 1791, 1633, 1486, 1352, 1228, 1115, 1011, 916, 829, 750, 677,\
-		611, 551, 497, 447, 402, 361, 324, 290, 260, 232, 207, 184, 163, 145, 128, 112,\
-		99, 86, 75, 65, 55, 47, 39, 32, 26, 21, 16, 11, 7, 3, 0, 2,\
-		681, 32120, 32767, 32737, 32705, 32671, 32635, 32596, 32555, 32512, 32466, 32417, 32365, 32310, 32251, 32189,\
-		32124, 32054, 31980, 31902, 31819, 31732, 31639, 31541, 31438, 31329, 31213, 31092, 30963, 30828, 30686, 30537,\
-		30379, 30214, 30041, 29859, 29668, 29469, 29261, 29043, 28816, 28579, 28333, 28077, 27811, 27536, 27250, 26955,\
-		26651, 26337, 26015, 25683, 25343, 24995, 24639, 24276, 23907, 23531, 23150, 22765, 22375, 21982, 21587, 21190,\
-		20792, 20394, 19996, 19600, 19207, 18816, 18430, 18048, 17671, 17300, 16935, 16577, 16227, 15885, 15551, 15226,\
-		14910, 14604, 14306, 14019, 13741, 13472, 13214, 12965, 12726, 12497, 12277, 12066, 11864, 11672, 11488, 11312,\
-		11145, 10986, 10834, 10690, 10553, 10423, 10300, 10183, 10073, 9968, 9869, 9775, 9686, 9602, 9523, 9448,\
-		9377, 9310, 9248, 9188, 9132, 9080, 9030, 8983, 8939, 8898, 8859, 8822, 8787, 8755, 8724, 8695,\
-		8670}
-
-	#define new_waves_release1 {\
-		0, 11204, 11207, 11204, 11200, 11195, 11190, 11184, 11176, 11168, 11158, 11146, 11133, 11117, 11099, 11078,\
-		11054, 11026, 10993, 10956, 10912, 10861, 10803, 10736, 10659, 10571, 10470, 10355, 10224, 10075, 9907, 9719,\
-		9508, 9274, 9015, 8731, 8422, 8089, 7732, 7355, 6959, 6548, 6126, 5699, 5270, 4845, 4429, 4026,\
-		3639, 3273, 2929, 2609, 2314, 2044, 1799, 1578, 1380, 1203, 1046, 907, 785, 678, 584, 503,\
-		431, 369, 316, 269, 229, 194, 164, 138, 115, 96, 80, 65, 53, 42, 33, 25,\
-		19, 13, 8, 4, 0, 1, 13913, 22301, 22283, 22263, 22241, 22217, 22189, 22158, 22124, 22085,\
-		22042, 21995, 21941, 21882, 21816, 21743, 21661, 21570, 21470, 21359, 21236, 21101, 20952, 20788, 20609, 20412,\
-		20198, 19965, 19713, 19440, 19146, 18831, 18494, 18137, 17759, 17361, 16945, 16511, 16063, 15602, 15131, 14653,\
-		14170, 13687, 13206, 12729, 12262, 11805, 11361, 10933, 10523, 10131, 9760, 9410, 9080, 8772, 8485, 8219,\
-		7973, 7747, 7538, 7348, 7174, 7015, 6871, 6740, 6621, 6514, 6417, 6329, 6250, 6179, 6116, 6058,\
-		6007, 5961, 5920, 5882, 5849, 5820, 5793, 5769, 5748, 5729, 5712, 15910, 32767, 32698, 32625, 32546,\
-		32461, 32371, 32274, 32171, 32060, 31942, 31815, 31681, 31538, 31385, 31223, 31051, 30868, 30675, 30470, 30254,\
-		30026, 29786, 29533, 29268, 28990, 28700, 28397, 28081, 27752, 27412, 27060, 26696, 26322, 25937, 25543, 25141,\
-		24731, 24315, 23893, 23467, 23038, 22607, 22176, 21745, 21316, 20890, 20469, 20053, 19644, 19243, 18850, 18467,\
-		18094, 17731, 17380, 17041, 16714, 16400, 16098, 15809, 15532, 15269, 15017, 14779, 14552, 14337, 14134, 13941,\
-		13760, 13589, 13428, 13276, 13134, 13001, 12875, 12758, 12648, 12545, 12449, 12359, 12275, 12197, 12124, 12056,\
-		11996}
-
-	#define new_waves_release2 {\
-		0, 8487, 8489, 8485, 8480, 8475, 8468, 8460, 8449, 8437, 8421, 8403, 8380, 8352, 8318, 8277,\
-		8227, 8167, 8094, 8007, 7902, 7778, 7631, 7458, 7256, 7023, 6757, 6457, 6124, 5760, 5369, 4956,\
-		4528, 4095, 3665, 3247, 2848, 2475, 2132, 1821, 1545, 1302, 1090, 909, 753, 622, 512, 419,\
-		342, 278, 225, 182, 146, 116, 92, 72, 56, 42, 31, 22, 15, 9, 4, 0,\
-		0, 16892, 16922, 16908, 16890, 16870, 16846, 16818, 16785, 16747, 16702, 16649, 16587, 16514, 16430, 16332,\
-		16219, 16088, 15936, 15763, 15564, 15339, 15084, 14798, 14479, 14127, 13741, 13323, 12874, 12399, 11901, 11386,\
-		10860, 10331, 9806, 9292, 8795, 8321, 7874, 7458, 7074, 6724, 6407, 6123, 5870, 5647, 5450, 5278,\
-		5128, 4998, 4885, 4788, 4705, 4633, 4572, 4519, 4475, 4436, 4404, 4376, 4353, 4332, 4315, 4301,\
-		4289, 25194, 25153, 25106, 25054, 24994, 24927, 24852, 24767, 24672, 24565, 24445, 24311, 24162, 23996, 23811,\
-		23606, 23380, 23131, 22859, 22561, 22237, 21887, 21510, 21107, 20678, 20224, 19748, 19252, 18739, 18212, 17675,\
-		17133, 16590, 16049, 15516, 14995, 14489, 14001, 13535, 13092, 12674, 12282, 11917, 11578, 11266, 10979, 10717,\
-		10479, 10262, 10066, 9890, 9731, 9588, 9461, 9347, 9245, 9155, 9074, 9003, 8939, 8883, 8833, 8789,\
-		8810, 32767, 32658, 32541, 32414, 32277, 32130, 31971, 31800, 31617, 31420, 31209, 30985, 30745, 30489, 30218,\
-		29931, 29628, 29308, 28971, 28619, 28250, 27866, 27467, 27053, 26627, 26189, 25740, 25282, 24817, 24345, 23870,\
-		23393, 22916, 22440, 21968, 21501, 21042, 20591, 20151, 19722, 19306, 18904, 18517, 18146, 17790, 17450, 17127,\
-		16821, 16531, 16257, 15998, 15756, 15528, 15315, 15116, 14930, 14757, 14596, 14446, 14307, 14178, 14059, 13949,\
-		13851}
-
-	#define new_waves_release3 {\
-		0, 5732, 5732, 5728, 5722, 5714, 5703, 5688, 5668, 5641, 5605, 5557, 5493, 5408, 5297, 5153,\
-		4971, 4742, 4464, 4135, 3758, 3344, 2909, 2473, 2053, 1669, 1330, 1041, 803, 612, 461, 345,\
-		255, 187, 136, 98, 70, 48, 33, 21, 12, 6, 1, 0, 11451, 11440, 11427, 11409,\
-		11385, 11355, 11316, 11265, 11200, 11116, 11009, 10874, 10703, 10491, 10230, 9915, 9542, 9111, 8624, 8092,\
-		7528, 6952, 6383, 5842, 5342, 4896, 4508, 4179, 3905, 3682, 3501, 3358, 3244, 3155, 3085, 3031,\
-		2990, 2957, 2932, 2913, 2899, 2887, 11768, 17114, 17086, 17050, 17005, 16950, 16881, 16795, 16689, 16559,\
-		16399, 16205, 15970, 15689, 15357, 14970, 14524, 14022, 13465, 12863, 12226, 11570, 10912, 10267, 9653, 9082,\
-		8562, 8099, 7694, 7345, 7049, 6801, 6595, 6425, 6286, 6173, 6082, 6008, 5949, 5901, 5863, 5832,\
-		5808, 22697, 22642, 22575, 22495, 22400, 22286, 22150, 21990, 21800, 21578, 21318, 21017, 20672, 20278, 19834,\
-		19339, 18796, 18207, 17578, 16919, 16239, 15551, 14867, 14198, 13558, 12954, 12393, 11880, 11418, 11006, 10643,\
-		10327, 10053, 9817, 9617, 9446, 9302, 9180, 9078, 8993, 8922, 8863, 16061, 27965, 27848, 27713, 27559,\
-		27383, 27183, 26956, 26699, 26410, 26086, 25726, 25329, 24892, 24416, 23902, 23352, 22769, 22157, 21522, 20871,\
-		20210, 19548, 18892, 18249, 17627, 17031, 16467, 15938, 15446, 14993, 14579, 14203, 13865, 13562, 13292, 13052,\
-		12841, 12655, 12492, 12350, 12226, 12118, 32767, 32580, 32375, 32150, 31904, 31636, 31344, 31028, 30688, 30321,\
-		29929, 29511, 29068, 28600, 28109, 27596, 27064, 26515, 25953, 25381, 24802, 24220, 23639, 23063, 22495, 21940,\
-		21400, 20878, 20376, 19897, 19442, 19012, 18607, 18229, 17876, 17549, 17246, 16967, 16710, 16476, 16261, 16066,\
-		15893}
-
-	#define new_waves_release4 {\
-		0, 4350, 4349, 4344, 4336, 4325, 4307, 4281, 4243, 4186, 4104, 3986, 3822, 3598, 3308, 2950,\
-		2537, 2096, 1661, 1265, 931, 665, 464, 318, 214, 142, 93, 59, 37, 21, 11, 5,\
-		0, 8694, 8688, 8675, 8657, 8631, 8593, 8539, 8464, 8357, 8209, 8007, 7737, 7389, 6955, 6442,\
-		5867, 5265, 4675, 4132, 3663, 3279, 2977, 2748, 2579, 2456, 2369, 2307, 2263, 2232, 2211, 2196,\
-		2186, 13023, 13004, 12977, 12940, 12889, 12820, 12724, 12595, 12421, 12191, 11891, 11510, 11039, 10478, 9837,\
-		9138, 8416, 7710, 7054, 6476, 5986, 5587, 5272, 5029, 4845, 4707, 4605, 4531, 4477, 4437, 4409,\
-		4388, 17314, 17276, 17224, 17156, 17066, 16948, 16794, 16594, 16337, 16013, 15611, 15122, 14544, 13880, 13145,\
-		12362, 11562, 10780, 10046, 9383, 8806, 8318, 7917, 7595, 7339, 7140, 6986, 6868, 6779, 6711, 6660,\
-		6622, 21533, 21461, 21369, 21253, 21106, 20922, 20692, 20407, 20058, 19638, 19140, 18559, 17899, 17167, 16378,\
-		15553, 14717, 13898, 13121, 12404, 11762, 11201, 10721, 10319, 9986, 9715, 9496, 9321, 9182, 9072, 8986,\
-		8918, 25609, 25485, 25334, 25150, 24928, 24662, 24345, 23971, 23533, 23029, 22455, 21813, 21108, 20349, 19548,\
-		18724, 17894, 17079, 16295, 15559, 14881, 14270, 13728, 13254, 12846, 12498, 12205, 11959, 11756, 11588, 11449,\
-		11336, 29420, 29223, 28994, 28728, 28422, 28070, 27670, 27218, 26713, 26154, 25543, 24882, 24177, 23437, 22670,\
-		21890, 21107, 20335, 19585, 18867, 18191, 17563, 16986, 16463, 15994, 15578, 15211, 14890, 14611, 14370, 14163,\
-		13992, 32767, 32488, 32177, 31833, 31453, 31036, 30582, 30090, 29561, 28996, 28398, 27770, 27117, 26444, 25757,\
-		25063, 24369, 23681, 23006, 22351, 21720, 21119, 20550, 20017, 19521, 19062, 18641, 18258, 17909, 17595, 17313,\
-		17065}
-
 	#define block_slope_attack0 {\
 		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
 		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
@@ -2703,214 +1245,246 @@ public:
 	static constexpr uint16_t moog5SquareShiftAttackFamily[5][257] = {
 		moog5SquareShiftAttackFamily0, moog5SquareShiftAttackFamily1, moog5SquareShiftAttackFamily2, moog5SquareShiftAttackFamily3,
 		moog5SquareShiftAttackFamily4};
+	WAVETABLE_COMPRESSED_DECL(moog5SquareShiftAttackFamily, 5)
 
 	static constexpr uint16_t moog5SquareShiftReleaseFamily[5][257] = {
 		moog5SquareShiftReleaseFamily0, moog5SquareShiftReleaseFamily1, moog5SquareShiftReleaseFamily2, moog5SquareShiftReleaseFamily3,
 		moog5SquareShiftReleaseFamily4};
+	WAVETABLE_COMPRESSED_DECL(moog5SquareShiftReleaseFamily, 5)
 
 	static constexpr uint16_t exciteBikeAttackFamily[5][257] = {
 		exciteBikeAttackFamily0, exciteBikeAttackFamily1, exciteBikeAttackFamily2, exciteBikeAttackFamily3,
 		exciteBikeAttackFamily4};
-
-	static constexpr uint16_t exciteBikeReleaseFamily[5][257] = {
-		exciteBikeReleaseFamily0, exciteBikeReleaseFamily1, exciteBikeReleaseFamily2, exciteBikeReleaseFamily3,
-		exciteBikeReleaseFamily4};
-
-	static constexpr uint16_t skipsaw[5][257] = {
-		skipsaw0, skipsaw1, skipsaw2, skipsaw3,
-		skipsaw4};
-
-	static constexpr uint16_t circular_257_slopes[4][257] = {
-		circular_257_slopes0, circular_257_slopes1, circular_257_slopes2, circular_257_slopes3};
-
-	static constexpr uint16_t test_fm_attack[5][257] = {
-		test_fm_attack0, test_fm_attack1, test_fm_attack2, test_fm_attack3,
-		test_fm_attack4};
-
-	static constexpr uint16_t test_fm_release[5][257] = {
-		test_fm_release0, test_fm_release1, test_fm_release2, test_fm_release3,
-		test_fm_release4};
+	WAVETABLE_COMPRESSED_DECL(exciteBikeAttackFamily, 5)
 
 	static constexpr uint16_t hyperbolic_shapers_attack[5][257] = {
 		hyperbolic_shapers_attack0, hyperbolic_shapers_attack1, hyperbolic_shapers_attack2, hyperbolic_shapers_attack3,
 		hyperbolic_shapers_attack4};
+	WAVETABLE_COMPRESSED_DECL(hyperbolic_shapers_attack, 5)
 
 	static constexpr uint16_t hyperbolic_shapers_release[5][257] = {
 		hyperbolic_shapers_release0, hyperbolic_shapers_release1, hyperbolic_shapers_release2, hyperbolic_shapers_release3,
 		hyperbolic_shapers_release4};
+	WAVETABLE_COMPRESSED_DECL(hyperbolic_shapers_release, 5)
 
 	static constexpr uint16_t bitcrush_attack[5][257] = {
 		bitcrush_attack0, bitcrush_attack1, bitcrush_attack2, bitcrush_attack3,
 		bitcrush_attack4};
+	WAVETABLE_COMPRESSED_DECL(bitcrush_attack, 5)
 
 	static constexpr uint16_t bitcrush_release[5][257] = {
 		bitcrush_release0, bitcrush_release1, bitcrush_release2, bitcrush_release3,
 		bitcrush_release4};
+	WAVETABLE_COMPRESSED_DECL(bitcrush_release, 5)
 
 	static constexpr uint16_t bessel_attack[5][257] = {
 		bessel_attack0, bessel_attack1, bessel_attack2, bessel_attack3,
 		bessel_attack4};
+	WAVETABLE_COMPRESSED_DECL(bessel_attack, 5)
 
 	static constexpr uint16_t bessel_release[5][257] = {
 		bessel_release0, bessel_release1, bessel_release2, bessel_release3,
 		bessel_release4};
-
-	static constexpr uint16_t block_test_attack[5][257] = {
-		block_test_attack0, block_test_attack1, block_test_attack2, block_test_attack3,
-		block_test_attack4};
-
-	static constexpr uint16_t block_test_release[5][257] = {
-		block_test_release0, block_test_release1, block_test_release2, block_test_release3,
-		block_test_release4};
-
-	static constexpr uint16_t half_sines_attack[5][257] = {
-		half_sines_attack0, half_sines_attack1, half_sines_attack2, half_sines_attack3,
-		half_sines_attack4};
-
-	static constexpr uint16_t half_sines_release[5][257] = {
-		half_sines_release0, half_sines_release1, half_sines_release2, half_sines_release3,
-		half_sines_release4};
-
-	static constexpr uint16_t mountains_attack[4][257] = {
-		mountains_attack0, mountains_attack1, mountains_attack2, mountains_attack3};
-
-	static constexpr uint16_t mountains_release[4][257] = {
-		mountains_release0, mountains_release1, mountains_release2, mountains_release3};
-
-	static constexpr uint16_t rubberband_attacks[5][257] = {
-		rubberband_attacks0, rubberband_attacks1, rubberband_attacks2, rubberband_attacks3,
-		rubberband_attacks4};
-
-	static constexpr uint16_t newest_bounce_attack[5][257] = {
-		newest_bounce_attack0, newest_bounce_attack1, newest_bounce_attack2, newest_bounce_attack3,
-		newest_bounce_attack4};
-
-	static constexpr uint16_t newest_bounce_release[5][257] = {
-		newest_bounce_release0, newest_bounce_release1, newest_bounce_release2, newest_bounce_release3,
-		newest_bounce_release4};
-
-	static constexpr uint16_t new_waves_attack[5][257] = {
-		new_waves_attack0, new_waves_attack1, new_waves_attack2, new_waves_attack3,
-		new_waves_attack4};
-
-	static constexpr uint16_t new_waves_release[5][257] = {
-		new_waves_release0, new_waves_release1, new_waves_release2, new_waves_release3,
-		new_waves_release4};
+	WAVETABLE_COMPRESSED_DECL(bessel_release, 5)
 
 	static constexpr uint16_t block_slope_attack[5][257] = {
 		block_slope_attack0, block_slope_attack1, block_slope_attack2, block_slope_attack3,
 		block_slope_attack4};
+	WAVETABLE_COMPRESSED_DECL(block_slope_attack, 5)
 
 	static constexpr uint16_t block_slope_release[5][257] = {
 		block_slope_release0, block_slope_release1, block_slope_release2, block_slope_release3,
 		block_slope_release4};
+	WAVETABLE_COMPRESSED_DECL(block_slope_release, 5)
 
 	static constexpr uint16_t staircase_attack[5][257] = {
 		staircase_attack0, staircase_attack1, staircase_attack2, staircase_attack3,
 		staircase_attack4};
+	WAVETABLE_COMPRESSED_DECL(staircase_attack, 5)
 
 	static constexpr uint16_t staircase_release[5][257] = {
 		staircase_release0, staircase_release1, staircase_release2, staircase_release3,
 		staircase_release4};
+	WAVETABLE_COMPRESSED_DECL(staircase_release, 5)
 
 	// TABLES 
 
+	WAVETABLE_IMAGE_DECL(moog5Square, 5)
 	static constexpr Wavetable moog5Square = {
-		.attackSlope = moog5SquareShiftAttackFamily,
-		.releaseSlope = moog5SquareShiftReleaseFamily,
+		.attackSlope = WAVETABLE_SLOPES(moog5SquareShiftAttackFamily),
+		.releaseSlope = WAVETABLE_SLOPES(moog5SquareShiftReleaseFamily),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(moog5Square),
+		.compressedAttack = WAVETABLE_COMPRESSED(moog5SquareShiftAttackFamily),
+		.compressedRelease = WAVETABLE_COMPRESSED(moog5SquareShiftReleaseFamily)};
 
+	WAVETABLE_IMAGE_DECL(exciteBike, 5)
 	static constexpr Wavetable exciteBike = {
-		.attackSlope = exciteBikeAttackFamily,
-		.releaseSlope = exciteBikeReleaseFamily,
+		.attackSlope = WAVETABLE_SLOPES(exciteBikeAttackFamily),
+		.releaseSlope = WAVETABLE_SLOPES(exciteBikeAttackFamily),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(exciteBike),
+		.compressedAttack = WAVETABLE_COMPRESSED(exciteBikeAttackFamily),
+		.compressedRelease = WAVETABLE_COMPRESSED(exciteBikeAttackFamily)};
 
+	WAVETABLE_IMAGE_DECL(skipSaw, 5)
 	static constexpr Wavetable skipSaw = {
-		.attackSlope = skipsaw,
-		.releaseSlope = skipsaw,
+		.attackSlope = WAVETABLE_SLOPES(skipsaw),
+		.releaseSlope = WAVETABLE_SLOPES(skipsaw),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(skipSaw),
+		.compressedAttack = WAVETABLE_COMPRESSED(skipsaw),
+		.compressedRelease = WAVETABLE_COMPRESSED(skipsaw)};
 
+	WAVETABLE_IMAGE_DECL(circular_257, 4)
 	static constexpr Wavetable circular_257 = {
-		.attackSlope = circular_257_slopes,
-		.releaseSlope = circular_257_slopes,
+		.attackSlope = WAVETABLE_SLOPES(circular_257_slopes),
+		.releaseSlope = WAVETABLE_SLOPES(circular_257_slopes),
 		.slopeLength = 256,
-		.numWaveforms = 4};
+		.numWaveforms = 4,
+		.image = WAVETABLE_IMAGE(circular_257),
+		.compressedAttack = WAVETABLE_COMPRESSED(circular_257_slopes),
+		.compressedRelease = WAVETABLE_COMPRESSED(circular_257_slopes)};
 
+	WAVETABLE_IMAGE_DECL(test_fm, 5)
 	static constexpr Wavetable test_fm = {
-		.attackSlope = test_fm_attack,
-		.releaseSlope = test_fm_release,
+		.attackSlope = WAVETABLE_SLOPES(test_fm_attack),
+		.releaseSlope = WAVETABLE_SLOPES(test_fm_release),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(test_fm),
+		.compressedAttack = WAVETABLE_COMPRESSED(test_fm_attack),
+		.compressedRelease = WAVETABLE_COMPRESSED(test_fm_release)};
 
+	WAVETABLE_IMAGE_DECL(hyperbolic_shapers, 5)
 	static constexpr Wavetable hyperbolic_shapers = {
-		.attackSlope = hyperbolic_shapers_attack,
-		.releaseSlope = hyperbolic_shapers_release,
+		.attackSlope = WAVETABLE_SLOPES(hyperbolic_shapers_attack),
+		.releaseSlope = WAVETABLE_SLOPES(hyperbolic_shapers_release),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(hyperbolic_shapers),
+		.compressedAttack = WAVETABLE_COMPRESSED(hyperbolic_shapers_attack),
+		.compressedRelease = WAVETABLE_COMPRESSED(hyperbolic_shapers_release)};
 
+	WAVETABLE_IMAGE_DECL(bitcrush, 5)
 	static constexpr Wavetable bitcrush = {
-		.attackSlope = bitcrush_attack,
-		.releaseSlope = bitcrush_release,
+		.attackSlope = WAVETABLE_SLOPES(bitcrush_attack),
+		.releaseSlope = WAVETABLE_SLOPES(bitcrush_release),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(bitcrush),
+		.compressedAttack = WAVETABLE_COMPRESSED(bitcrush_attack),
+		.compressedRelease = WAVETABLE_COMPRESSED(bitcrush_release)};
 
+	WAVETABLE_IMAGE_DECL(bessel, 5)
 	static constexpr Wavetable bessel = {
-		.attackSlope = bessel_attack,
-		.releaseSlope = bessel_release,
+		.attackSlope = WAVETABLE_SLOPES(bessel_attack),
+		.releaseSlope = WAVETABLE_SLOPES(bessel_release),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(bessel),
+		.compressedAttack = WAVETABLE_COMPRESSED(bessel_attack),
+		.compressedRelease = WAVETABLE_COMPRESSED(bessel_release)};
 
+	WAVETABLE_IMAGE_DECL(block_test, 5)
 	static constexpr Wavetable block_test = {
-		.attackSlope = block_test_attack,
-		.releaseSlope = block_test_release,
+		.attackSlope = WAVETABLE_SLOPES(block_test_attack),
+		.releaseSlope = WAVETABLE_SLOPES(block_test_release),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(block_test),
+		.compressedAttack = WAVETABLE_COMPRESSED(block_test_attack),
+		.compressedRelease = WAVETABLE_COMPRESSED(block_test_release)};
 
+	WAVETABLE_IMAGE_DECL(half_sines, 5)
 	static constexpr Wavetable half_sines = {
-		.attackSlope = half_sines_attack,
-		.releaseSlope = half_sines_release,
+		.attackSlope = WAVETABLE_SLOPES(half_sines_attack),
+		.releaseSlope = WAVETABLE_SLOPES(half_sines_release),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(half_sines),
+		.compressedAttack = WAVETABLE_COMPRESSED(half_sines_attack),
+		.compressedRelease = WAVETABLE_COMPRESSED(half_sines_release)};
 
+	WAVETABLE_IMAGE_DECL(mountains, 4)
 	static constexpr Wavetable mountains = {
-		.attackSlope = mountains_attack,
-		.releaseSlope = mountains_release,
+		.attackSlope = WAVETABLE_SLOPES(mountains_attack),
+		.releaseSlope = WAVETABLE_SLOPES(mountains_release),
 		.slopeLength = 256,
-		.numWaveforms = 4};
+		.numWaveforms = 4,
+		.image = WAVETABLE_IMAGE(mountains),
+		.compressedAttack = WAVETABLE_COMPRESSED(mountains_attack),
+		.compressedRelease = WAVETABLE_COMPRESSED(mountains_release)};
 
+	WAVETABLE_IMAGE_DECL(rubberband, 5)
 	static constexpr Wavetable rubberband = {
-		.attackSlope = rubberband_attacks,
-		.releaseSlope = rubberband_attacks,
+		.attackSlope = WAVETABLE_SLOPES(rubberband_attacks),
+		.releaseSlope = WAVETABLE_SLOPES(rubberband_attacks),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(rubberband),
+		.compressedAttack = WAVETABLE_COMPRESSED(rubberband_attacks),
+		.compressedRelease = WAVETABLE_COMPRESSED(rubberband_attacks)};
 
+	WAVETABLE_IMAGE_DECL(newest_bounce, 5)
 	static constexpr Wavetable newest_bounce = {
-		.attackSlope = newest_bounce_attack,
-		.releaseSlope = newest_bounce_release,
+		.attackSlope = WAVETABLE_SLOPES(newest_bounce_attack),
+		.releaseSlope = WAVETABLE_SLOPES(newest_bounce_release),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(newest_bounce),
+		.compressedAttack = WAVETABLE_COMPRESSED(newest_bounce_attack),
+		.compressedRelease = WAVETABLE_COMPRESSED(newest_bounce_release)};
 
+	WAVETABLE_IMAGE_DECL(new_waves, 5)
 	static constexpr Wavetable new_waves = {
-		.attackSlope = new_waves_attack,
-		.releaseSlope = new_waves_release,
+		.attackSlope = WAVETABLE_SLOPES(new_waves_attack),
+		.releaseSlope = WAVETABLE_SLOPES(new_waves_release),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(new_waves),
+		.compressedAttack = WAVETABLE_COMPRESSED(new_waves_attack),
+		.compressedRelease = WAVETABLE_COMPRESSED(new_waves_release)};
 
+	WAVETABLE_IMAGE_DECL(block_slope, 5)
 	static constexpr Wavetable block_slope = {
-		.attackSlope = block_slope_attack,
-		.releaseSlope = block_slope_release,
+		.attackSlope = WAVETABLE_SLOPES(block_slope_attack),
+		.releaseSlope = WAVETABLE_SLOPES(block_slope_release),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(block_slope),
+		.compressedAttack = WAVETABLE_COMPRESSED(block_slope_attack),
+		.compressedRelease = WAVETABLE_COMPRESSED(block_slope_release)};
 
+	WAVETABLE_IMAGE_DECL(staircase, 5)
 	static constexpr Wavetable staircase = {
-		.attackSlope = staircase_attack,
-		.releaseSlope = staircase_release,
+		.attackSlope = WAVETABLE_SLOPES(staircase_attack),
+		.releaseSlope = WAVETABLE_SLOPES(staircase_release),
 		.slopeLength = 256,
-		.numWaveforms = 5};
+		.numWaveforms = 5,
+		.image = WAVETABLE_IMAGE(staircase),
+		.compressedAttack = WAVETABLE_COMPRESSED(staircase_attack),
+		.compressedRelease = WAVETABLE_COMPRESSED(staircase_release)};
 
 };
 
+/// Every slope family the set stores, see WAVETABLE_FAMILY_DEF.
+#define SCANNER_WAVETABLE_FAMILIES(X) \
+	X(ScannerWavetableSet, moog5SquareShiftAttackFamily, 5) \
+	X(ScannerWavetableSet, moog5SquareShiftReleaseFamily, 5) \
+	X(ScannerWavetableSet, exciteBikeAttackFamily, 5) \
+	X(ScannerWavetableSet, hyperbolic_shapers_attack, 5) \
+	X(ScannerWavetableSet, hyperbolic_shapers_release, 5) \
+	X(ScannerWavetableSet, bitcrush_attack, 5) \
+	X(ScannerWavetableSet, bitcrush_release, 5) \
+	X(ScannerWavetableSet, bessel_attack, 5) \
+	X(ScannerWavetableSet, bessel_release, 5) \
+	X(ScannerWavetableSet, block_slope_attack, 5) \
+	X(ScannerWavetableSet, block_slope_release, 5) \
+	X(ScannerWavetableSet, staircase_attack, 5) \
+	X(ScannerWavetableSet, staircase_release, 5)
+
 #endif
\ No newline at end of file
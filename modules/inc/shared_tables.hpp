@@ -0,0 +1,3121 @@
+#ifndef SHARED_TABLES
+#define SHARED_TABLES
+
+#include "tables.hpp"
+
+/// Slope families used by more than one module, stored once and inherited by each module's table set.
+/// Module sets take the first numWaveforms slopes of a family, so a 5 slope table can share a 9 slope family.
+class SharedWavetableSet: public WavetableSet {
+
+public:
+
+	#define impshort0 {\
+		0, 0, 3, 10, 19, 29, 43, 58, 77, 97, 120, 146, 174, 204, 236, 271,\
+		309, 348, 391, 435, 482, 532, 584, 637, 694, 752, 813, 877, 943, 1010, 1081, 1153,\
+		1228, 1304, 1384, 1465, 1549, 1634, 1722, 1812, 1905, 1999, 2096, 2194, 2294, 2397, 2503, 2610,\
+		2719, 2829, 2942, 3058, 3175, 3295, 3416, 3538, 3662, 3790, 3919, 4049, 4181, 4315, 4451, 4588,\
+		4728, 4869, 5012, 5156, 5302, 5450, 5599, 5750, 5903, 6057, 6212, 6370, 6528, 6688, 6849, 7013,\
+		7177, 7343, 7510, 7678, 7848, 8018, 8191, 8364, 8539, 8714, 8891, 9070, 9249, 9428, 9610, 9792,\
+		9976, 10160, 10344, 10530, 10717, 10904, 11092, 11282, 11473, 11663, 11855, 12046, 12239, 12432, 12627, 12821,\
+		13015, 13211, 13407, 13604, 13801, 13998, 14195, 14393, 14592, 14790, 14989, 15187, 15387, 15585, 15785, 15984,\
+		16183, 16383, 16583, 16782, 16982, 17181, 17380, 17579, 17777, 17976, 18175, 18373, 18571, 18768, 18965, 19162,\
+		19359, 19555, 19751, 19945, 20140, 20334, 20528, 20720, 20912, 21103, 21294, 21484, 21674, 21862, 22050, 22236,\
+		22422, 22606, 22791, 22974, 23157, 23338, 23518, 23696, 23875, 24052, 24228, 24402, 24575, 24747, 24918, 25088,\
+		25256, 25423, 25589, 25753, 25916, 26078, 26238, 26396, 26554, 26709, 26863, 27016, 27167, 27316, 27464, 27610,\
+		27755, 27897, 28039, 28178, 28316, 28451, 28586, 28717, 28848, 28976, 29104, 29228, 29351, 29471, 29591, 29708,\
+		29824, 29937, 30047, 30156, 30264, 30369, 30472, 30572, 30670, 30767, 30861, 30954, 31045, 31132, 31218, 31301,\
+		31382, 31462, 31538, 31613, 31686, 31756, 31824, 31889, 31953, 32014, 32073, 32129, 32183, 32234, 32284, 32331,\
+		32375, 32418, 32457, 32495, 32530, 32562, 32593, 32620, 32646, 32669, 32690, 32708, 32724, 32737, 32748, 32756,\
+		32763}
+
+	#define impshort1 {\
+		0, 2, 10, 25, 45, 70, 100, 137, 180, 227, 280, 339, 404, 473, 548, 629,\
+		715, 806, 903, 1004, 1112, 1224, 1342, 1464, 1592, 1724, 1861, 2004, 2151, 2304, 2461, 2622,\
+		2788, 2958, 3133, 3312, 3496, 3683, 3876, 4072, 4272, 4476, 4684, 4895, 5111, 5329, 5552, 5777,\
+		6007, 6239, 6475, 6713, 6954, 7199, 7446, 7696, 7948, 8203, 8461, 8720, 8983, 9246, 9512, 9779,\
+		10050, 10321, 10594, 10869, 11145, 11422, 11701, 11980, 12260, 12542, 12825, 13107, 13390, 13675, 13959, 14244,\
+		14528, 14814, 15100, 15385, 15670, 15954, 16238, 16521, 16805, 17087, 17370, 17651, 17930, 18210, 18487, 18764,\
+		19040, 19314, 19587, 19857, 20127, 20394, 20660, 20925, 21188, 21448, 21707, 21963, 22216, 22468, 22717, 22965,\
+		23210, 23452, 23692, 23928, 24163, 24394, 24623, 24850, 25073, 25292, 25510, 25724, 25935, 26142, 26347, 26550,\
+		26748, 26944, 27135, 27324, 27510, 27692, 27870, 28046, 28219, 28387, 28553, 28714, 28872, 29028, 29179, 29327,\
+		29472, 29613, 29751, 29885, 30017, 30144, 30268, 30388, 30505, 30619, 30730, 30837, 30940, 31041, 31139, 31232,\
+		31323, 31410, 31495, 31576, 31655, 31730, 31802, 31871, 31936, 31999, 32060, 32117, 32172, 32223, 32272, 32318,\
+		32363, 32403, 32442, 32478, 32512, 32543, 32573, 32599, 32623, 32646, 32666, 32684, 32701, 32715, 32728, 32738,\
+		32746, 32754, 32760, 32763, 32766, 32766, 32766, 32764, 32761, 32756, 32751, 32744, 32737, 32728, 32718, 32707,\
+		32696, 32683, 32671, 32657, 32642, 32628, 32613, 32597, 32581, 32564, 32547, 32530, 32513, 32495, 32478, 32461,\
+		32444, 32426, 32408, 32391, 32374, 32357, 32341, 32324, 32308, 32293, 32278, 32263, 32248, 32235, 32222, 32209,\
+		32197, 32185, 32175, 32164, 32155, 32146, 32137, 32130, 32124, 32118, 32113, 32108, 32105, 32102, 32100, 32098,\
+		32098}
+
+	#define impshort2 {\
+		0, 8, 37, 84, 151, 236, 340, 462, 602, 762, 938, 1133, 1345, 1574, 1820, 2082,\
+		2361, 2655, 2965, 3289, 3629, 3982, 4349, 4729, 5122, 5526, 5942, 6369, 6807, 7254, 7711, 8176,\
+		8649, 9131, 9619, 10113, 10612, 11118, 11628, 12140, 12656, 13175, 13696, 14219, 14742, 15264, 15786, 16308,\
+		16828, 17345, 17860, 18371, 18879, 19382, 19881, 20373, 20860, 21340, 21815, 22281, 22740, 23190, 23633, 24066,\
+		24491, 24905, 25310, 25706, 26091, 26465, 26829, 27182, 27523, 27854, 28173, 28480, 28775, 29059, 29332, 29592,\
+		29842, 30078, 30304, 30517, 30720, 30911, 31091, 31259, 31416, 31561, 31696, 31822, 31937, 32041, 32134, 32219,\
+		32294, 32361, 32419, 32468, 32509, 32541, 32567, 32584, 32595, 32598, 32597, 32589, 32576, 32556, 32533, 32505,\
+		32472, 32436, 32396, 32352, 32307, 32258, 32208, 32155, 32102, 32047, 31991, 31934, 31877, 31819, 31763, 31706,\
+		31651, 31596, 31543, 31491, 31441, 31391, 31344, 31300, 31259, 31219, 31182, 31147, 31115, 31087, 31061, 31039,\
+		31020, 31003, 30991, 30981, 30975, 30971, 30970, 30974, 30980, 30990, 31002, 31017, 31036, 31057, 31081, 31107,\
+		31136, 31167, 31201, 31236, 31273, 31313, 31354, 31397, 31442, 31487, 31535, 31582, 31630, 31679, 31729, 31778,\
+		31829, 31879, 31929, 31978, 32028, 32076, 32123, 32170, 32217, 32261, 32305, 32346, 32387, 32425, 32463, 32498,\
+		32532, 32563, 32592, 32618, 32644, 32667, 32688, 32706, 32722, 32735, 32745, 32754, 32760, 32765, 32766, 32766,\
+		32763, 32757, 32749, 32740, 32729, 32715, 32699, 32682, 32663, 32643, 32621, 32597, 32572, 32545, 32518, 32489,\
+		32459, 32429, 32398, 32367, 32336, 32304, 32272, 32239, 32207, 32175, 32144, 32112, 32082, 32052, 32023, 31994,\
+		31967, 31941, 31917, 31893, 31871, 31850, 31830, 31813, 31797, 31783, 31770, 31760, 31752, 31745, 31740, 31736,\
+		31736}
+
+	#define impshort3 {\
+		0, 31, 130, 293, 520, 809, 1160, 1571, 2040, 2565, 3143, 3772, 4449, 5169, 5931, 6732,\
+		7567, 8432, 9324, 10239, 11172, 12121, 13081, 14047, 15018, 15987, 16953, 17910, 18856, 19786, 20700, 21592,\
+		22460, 23301, 24113, 24893, 25641, 26355, 27032, 27671, 28272, 28833, 29355, 29837, 30279, 30681, 31044, 31369,\
+		31656, 31905, 32119, 32300, 32448, 32565, 32654, 32715, 32752, 32765, 32757, 32729, 32686, 32627, 32557, 32475,\
+		32386, 32289, 32188, 32085, 31982, 31879, 31778, 31680, 31586, 31500, 31421, 31349, 31285, 31231, 31187, 31152,\
+		31128, 31113, 31108, 31114, 31130, 31154, 31187, 31229, 31279, 31334, 31397, 31464, 31537, 31612, 31690, 31771,\
+		31852, 31935, 32017, 32097, 32175, 32250, 32321, 32389, 32453, 32511, 32563, 32611, 32652, 32686, 32715, 32736,\
+		32751, 32761, 32765, 32762, 32755, 32741, 32723, 32702, 32676, 32646, 32613, 32577, 32541, 32502, 32463, 32424,\
+		32386, 32347, 32311, 32275, 32242, 32213, 32186, 32161, 32140, 32124, 32110, 32102, 32096, 32095, 32099, 32106,\
+		32117, 32131, 32148, 32169, 32193, 32220, 32250, 32280, 32313, 32347, 32381, 32417, 32452, 32486, 32519, 32553,\
+		32585, 32614, 32642, 32667, 32689, 32709, 32727, 32740, 32752, 32760, 32765, 32766, 32763, 32759, 32751, 32741,\
+		32728, 32712, 32694, 32675, 32654, 32631, 32609, 32584, 32560, 32535, 32511, 32487, 32463, 32442, 32421, 32403,\
+		32386, 32370, 32358, 32347, 32340, 32334, 32332, 32332, 32335, 32340, 32347, 32357, 32370, 32384, 32401, 32418,\
+		32438, 32458, 32480, 32503, 32527, 32550, 32574, 32597, 32620, 32641, 32662, 32681, 32699, 32714, 32729, 32741,\
+		32750, 32758, 32762, 32765, 32766, 32764, 32760, 32753, 32745, 32734, 32720, 32706, 32690, 32672, 32652, 32633,\
+		32613, 32592, 32571, 32550, 32530, 32509, 32489, 32471, 32454, 32439, 32426, 32413, 32404, 32396, 32391, 32387,\
+		32386}
+
+	#define impshort4 {\
+		0, 67, 274, 615, 1088, 1687, 2408, 3242, 4182, 5218, 6342, 7540, 8804, 10120, 11477, 12862,\
+		14265, 15672, 17073, 18455, 19808, 21125, 22394, 23606, 24757, 25838, 26844, 27773, 28621, 29385, 30066, 30663,\
+		31179, 31613, 31970, 32255, 32472, 32624, 32719, 32762, 32759, 32717, 32643, 32542, 32421, 32285, 32142, 31995,\
+		31850, 31711, 31583, 31468, 31368, 31287, 31225, 31185, 31165, 31165, 31185, 31223, 31279, 31350, 31435, 31530,\
+		31634, 31743, 31857, 31971, 32085, 32194, 32298, 32394, 32482, 32558, 32624, 32677, 32718, 32746, 32762, 32766,\
+		32759, 32741, 32714, 32680, 32640, 32594, 32544, 32493, 32441, 32391, 32344, 32300, 32261, 32227, 32200, 32180,\
+		32167, 32163, 32166, 32176, 32194, 32217, 32247, 32281, 32321, 32363, 32406, 32452, 32497, 32540, 32583, 32622,\
+		32658, 32688, 32715, 32736, 32752, 32761, 32766, 32764, 32758, 32746, 32731, 32711, 32688, 32662, 32635, 32606,\
+		32577, 32550, 32524, 32499, 32478, 32459, 32443, 32433, 32426, 32424, 32426, 32431, 32442, 32456, 32474, 32493,\
+		32515, 32540, 32566, 32592, 32618, 32643, 32668, 32690, 32710, 32728, 32743, 32754, 32762, 32765, 32765, 32763,\
+		32757, 32747, 32735, 32719, 32703, 32685, 32665, 32646, 32626, 32606, 32588, 32572, 32558, 32545, 32536, 32529,\
+		32525, 32523, 32525, 32531, 32539, 32550, 32562, 32578, 32594, 32612, 32631, 32650, 32669, 32687, 32704, 32719,\
+		32733, 32744, 32754, 32760, 32765, 32766, 32765, 32760, 32754, 32745, 32733, 32721, 32706, 32691, 32675, 32659,\
+		32644, 32628, 32614, 32601, 32590, 32580, 32573, 32568, 32566, 32566, 32569, 32574, 32582, 32591, 32602, 32615,\
+		32629, 32645, 32660, 32677, 32693, 32707, 32720, 32733, 32744, 32753, 32759, 32764, 32766, 32765, 32763, 32758,\
+		32751, 32741, 32729, 32717, 32704, 32689, 32673, 32659, 32644, 32631, 32618, 32606, 32597, 32589, 32583, 32579,\
+		32578}
+
+	#define impshort5 {\
+		0, 115, 469, 1051, 1850, 2853, 4044, 5403, 6908, 8532, 10251, 12039, 13868, 15710, 17540, 19333,\
+		21067, 22719, 24274, 25713, 27028, 28206, 29245, 30139, 30891, 31503, 31983, 32337, 32577, 32716, 32767, 32741,\
+		32656, 32524, 32360, 32177, 31987, 31802, 31631, 31480, 31357, 31266, 31209, 31186, 31198, 31242, 31315, 31414,\
+		31533, 31667, 31811, 31958, 32104, 32243, 32372, 32486, 32583, 32659, 32715, 32751, 32766, 32761, 32740, 32703,\
+		32655, 32598, 32536, 32471, 32407, 32348, 32296, 32252, 32220, 32198, 32190, 32193, 32210, 32237, 32274, 32318,\
+		32370, 32424, 32481, 32536, 32589, 32637, 32680, 32714, 32741, 32758, 32766, 32765, 32756, 32739, 32716, 32687,\
+		32656, 32622, 32588, 32555, 32525, 32499, 32479, 32464, 32455, 32455, 32461, 32472, 32490, 32512, 32539, 32568,\
+		32598, 32629, 32660, 32688, 32713, 32733, 32749, 32760, 32765, 32766, 32760, 32751, 32737, 32719, 32699, 32677,\
+		32656, 32634, 32614, 32595, 32580, 32569, 32562, 32560, 32563, 32568, 32579, 32593, 32609, 32628, 32649, 32670,\
+		32691, 32709, 32727, 32742, 32753, 32761, 32765, 32766, 32764, 32757, 32747, 32734, 32720, 32703, 32686, 32671,\
+		32656, 32642, 32630, 32620, 32615, 32612, 32613, 32617, 32623, 32633, 32645, 32659, 32674, 32690, 32706, 32721,\
+		32735, 32746, 32756, 32762, 32766, 32766, 32765, 32759, 32751, 32741, 32730, 32717, 32704, 32690, 32677, 32665,\
+		32656, 32647, 32642, 32639, 32639, 32641, 32647, 32654, 32664, 32675, 32688, 32701, 32714, 32726, 32738, 32748,\
+		32757, 32762, 32765, 32766, 32765, 32761, 32754, 32746, 32736, 32724, 32712, 32700, 32688, 32678, 32669, 32661,\
+		32655, 32652, 32652, 32653, 32658, 32664, 32671, 32681, 32692, 32704, 32717, 32728, 32739, 32749, 32757, 32762,\
+		32766, 32767, 32765, 32762, 32756, 32748, 32739, 32728, 32717, 32705, 32694, 32683, 32674, 32666, 32660, 32656,\
+		32656}
+
+	#define impshort6 {\
+		0, 176, 717, 1596, 2793, 4278, 6015, 7957, 10058, 12267, 14533, 16807, 19039, 21184, 23206, 25068,\
+		26746, 28219, 29479, 30518, 31344, 31962, 32391, 32648, 32758, 32746, 32641, 32468, 32253, 32022, 31795, 31589,\
+		31419, 31293, 31219, 31197, 31227, 31304, 31421, 31568, 31736, 31915, 32095, 32265, 32419, 32548, 32649, 32719,\
+		32758, 32765, 32746, 32703, 32643, 32571, 32494, 32416, 32344, 32285, 32240, 32211, 32202, 32211, 32238, 32279,\
+		32333, 32395, 32463, 32530, 32595, 32651, 32699, 32735, 32758, 32766, 32762, 32745, 32719, 32685, 32647, 32606,\
+		32568, 32532, 32503, 32481, 32470, 32468, 32476, 32492, 32516, 32548, 32583, 32619, 32655, 32688, 32717, 32741,\
+		32757, 32765, 32766, 32758, 32744, 32725, 32702, 32677, 32652, 32628, 32607, 32591, 32580, 32575, 32576, 32584,\
+		32597, 32615, 32637, 32660, 32683, 32706, 32727, 32744, 32756, 32764, 32766, 32763, 32756, 32743, 32728, 32710,\
+		32693, 32675, 32658, 32645, 32635, 32630, 32628, 32632, 32640, 32650, 32664, 32681, 32699, 32715, 32731, 32744,\
+		32756, 32762, 32766, 32765, 32761, 32752, 32742, 32728, 32715, 32701, 32688, 32676, 32666, 32660, 32658, 32659,\
+		32664, 32671, 32682, 32693, 32707, 32720, 32733, 32745, 32755, 32761, 32766, 32766, 32764, 32758, 32749, 32740,\
+		32729, 32716, 32705, 32694, 32685, 32679, 32676, 32675, 32677, 32683, 32691, 32700, 32711, 32723, 32734, 32744,\
+		32754, 32760, 32765, 32766, 32765, 32761, 32755, 32746, 32736, 32726, 32716, 32706, 32698, 32691, 32688, 32686,\
+		32686, 32690, 32695, 32703, 32713, 32723, 32734, 32743, 32752, 32759, 32764, 32766, 32766, 32763, 32758, 32751,\
+		32743, 32733, 32724, 32714, 32706, 32699, 32694, 32691, 32690, 32693, 32698, 32704, 32713, 32722, 32732, 32741,\
+		32749, 32757, 32763, 32765, 32766, 32764, 32761, 32754, 32747, 32738, 32729, 32719, 32711, 32703, 32698, 32694,\
+		32693}
+
+	#define impshort7 {\
+		0, 248, 1013, 2247, 3904, 5931, 8255, 10793, 13460, 16169, 18838, 21392, 23764, 25898, 27759, 29317,\
+		30568, 31512, 32170, 32568, 32747, 32746, 32613, 32391, 32124, 31850, 31601, 31402, 31268, 31207, 31221, 31302,\
+		31441, 31621, 31827, 32041, 32246, 32428, 32577, 32684, 32747, 32766, 32746, 32693, 32617, 32529, 32438, 32353,\
+		32282, 32234, 32211, 32214, 32241, 32291, 32357, 32433, 32513, 32589, 32656, 32710, 32747, 32764, 32764, 32745,\
+		32714, 32672, 32627, 32580, 32539, 32505, 32484, 32475, 32480, 32498, 32527, 32563, 32605, 32647, 32686, 32720,\
+		32746, 32761, 32767, 32761, 32745, 32723, 32695, 32666, 32639, 32615, 32597, 32586, 32583, 32590, 32604, 32624,\
+		32648, 32675, 32702, 32726, 32746, 32759, 32766, 32765, 32758, 32744, 32727, 32707, 32688, 32669, 32653, 32643,\
+		32638, 32639, 32645, 32658, 32674, 32692, 32711, 32729, 32744, 32756, 32764, 32765, 32762, 32755, 32743, 32729,\
+		32714, 32699, 32685, 32676, 32670, 32668, 32671, 32678, 32689, 32701, 32715, 32730, 32744, 32755, 32763, 32766,\
+		32766, 32761, 32753, 32742, 32731, 32718, 32707, 32697, 32690, 32686, 32687, 32690, 32697, 32708, 32720, 32731,\
+		32743, 32753, 32761, 32765, 32766, 32764, 32759, 32750, 32741, 32730, 32721, 32711, 32704, 32699, 32699, 32700,\
+		32705, 32711, 32720, 32731, 32742, 32751, 32759, 32763, 32765, 32765, 32762, 32756, 32749, 32739, 32730, 32721,\
+		32714, 32709, 32706, 32707, 32710, 32714, 32721, 32730, 32740, 32748, 32756, 32762, 32766, 32766, 32765, 32760,\
+		32754, 32746, 32738, 32729, 32722, 32715, 32712, 32710, 32712, 32715, 32722, 32729, 32738, 32746, 32754, 32759,\
+		32764, 32766, 32766, 32763, 32758, 32751, 32743, 32734, 32727, 32720, 32715, 32713, 32714, 32716, 32720, 32727,\
+		32735, 32743, 32750, 32757, 32763, 32765, 32765, 32764, 32760, 32754, 32747, 32739, 32732, 32724, 32719, 32715,\
+		32714}
+
+	#define impshort8 {\
+		0, 331, 1357, 2997, 5166, 7772, 10692, 13788, 16930, 19986, 22846, 25415, 27626, 29432, 30823, 31808,\
+		32424, 32717, 32755, 32605, 32340, 32025, 31718, 31462, 31288, 31211, 31233, 31346, 31528, 31755, 32002, 32240,\
+		32450, 32612, 32718, 32763, 32753, 32698, 32611, 32508, 32405, 32315, 32250, 32217, 32219, 32254, 32317, 32399,\
+		32489, 32579, 32658, 32718, 32755, 32766, 32753, 32721, 32676, 32623, 32571, 32527, 32496, 32481, 32484, 32504,\
+		32539, 32583, 32632, 32678, 32718, 32747, 32764, 32765, 32754, 32731, 32702, 32669, 32637, 32612, 32595, 32588,\
+		32593, 32607, 32631, 32659, 32690, 32719, 32742, 32758, 32766, 32764, 32754, 32736, 32714, 32692, 32672, 32655,\
+		32644, 32642, 32648, 32660, 32677, 32698, 32719, 32738, 32754, 32763, 32766, 32762, 32753, 32739, 32723, 32706,\
+		32690, 32679, 32674, 32674, 32679, 32690, 32704, 32719, 32736, 32749, 32760, 32765, 32766, 32761, 32753, 32741,\
+		32728, 32715, 32704, 32696, 32693, 32694, 32700, 32709, 32720, 32733, 32745, 32756, 32763, 32766, 32765, 32760,\
+		32752, 32741, 32731, 32720, 32712, 32706, 32704, 32707, 32713, 32721, 32732, 32742, 32752, 32759, 32764, 32766,\
+		32764, 32758, 32750, 32742, 32733, 32724, 32717, 32714, 32714, 32717, 32722, 32730, 32740, 32749, 32757, 32762,\
+		32766, 32766, 32762, 32757, 32750, 32741, 32734, 32727, 32722, 32719, 32720, 32723, 32729, 32736, 32744, 32753,\
+		32760, 32764, 32766, 32765, 32762, 32756, 32748, 32741, 32734, 32728, 32725, 32723, 32725, 32729, 32735, 32741,\
+		32749, 32756, 32762, 32765, 32766, 32764, 32761, 32755, 32747, 32740, 32734, 32728, 32726, 32725, 32728, 32732,\
+		32739, 32745, 32753, 32759, 32764, 32766, 32766, 32763, 32759, 32752, 32746, 32739, 32733, 32729, 32727, 32727,\
+		32731, 32735, 32742, 32748, 32755, 32760, 32765, 32766, 32766, 32762, 32757, 32750, 32744, 32737, 32732, 32728,\
+		32728}
+
+	#define skipsaw0 {\
+		0, 128, 256, 384, 512, 640, 768, 896, 1024, 1152, 1280, 1408, 1536, 1664, 1792, 1920,\
+		2047, 2175, 2303, 2431, 2559, 2687, 2815, 2944, 3072, 3200, 3328, 3456, 3584, 3712, 3840, 3968,\
+		4096, 4224, 4352, 4480, 4608, 4736, 4863, 4992, 5120, 5248, 5376, 5504, 5632, 5760, 5888, 6015,\
+		6144, 6272, 6400, 6528, 6655, 6783, 6911, 7039, 7168, 7296, 7424, 7552, 7680, 7807, 7935, 8063,\
+		8192, 8320, 8448, 8576, 8703, 8831, 8959, 9087, 9216, 9344, 9472, 9600, 9728, 9855, 9983, 10111,\
+		10240, 10368, 10496, 10624, 10752, 10879, 11007, 11135, 11264, 11392, 11520, 11648, 11776, 11903, 12031, 12159,\
+		12288, 12416, 12544, 12672, 12800, 12927, 13055, 13183, 13312, 13440, 13568, 13696, 13824, 13951, 14079, 14207,\
+		14335, 14464, 14592, 14720, 14847, 14975, 15103, 15231, 15360, 15488, 15616, 15744, 15872, 15999, 16127, 16255,\
+		16382, 16510, 16638, 16766, 16895, 17023, 17151, 17279, 17407, 17534, 17662, 17790, 17919, 18047, 18175, 18303,\
+		18431, 18558, 18686, 18814, 18943, 19071, 19199, 19327, 19454, 19582, 19710, 19838, 19967, 20095, 20223, 20351,\
+		20479, 20606, 20734, 20862, 20991, 21119, 21247, 21375, 21503, 21630, 21758, 21886, 22015, 22143, 22271, 22399,\
+		22527, 22654, 22782, 22910, 23038, 23167, 23295, 23423, 23551, 23678, 23806, 23934, 24063, 24191, 24319, 24447,\
+		24575, 24702, 24830, 24958, 25087, 25215, 25343, 25471, 25599, 25727, 25854, 25982, 26110, 26238, 26366, 26495,\
+		26622, 26750, 26879, 27007, 27134, 27262, 27390, 27518, 27646, 27774, 27903, 28031, 28159, 28287, 28415, 28542,\
+		28670, 28798, 28926, 29055, 29183, 29311, 29438, 29566, 29694, 29822, 29950, 30079, 30207, 30335, 30462, 30590,\
+		30718, 30846, 30975, 31103, 31231, 31359, 31487, 31615, 31743, 31871, 31999, 32127, 32255, 32383, 32511, 32639,\
+		32767}
+
+	#define skipsaw1 {\
+		0, 193, 386, 579, 772, 965, 1158, 1351, 1544, 1737, 1930, 2123, 2316, 2509, 2702, 2895,\
+		3088, 3281, 3473, 3666, 3859, 4053, 4246, 4439, 4632, 4824, 5017, 5210, 5404, 5597, 5790, 5983,\
+		6176, 6368, 6561, 6754, 6948, 7141, 7334, 7527, 7719, 7912, 8105, 8298, 8492, 8685, 8878, 9071,\
+		9264, 9456, 9649, 9842, 10036, 10229, 10422, 10615, 10808, 11000, 11193, 11386, 11580, 11773, 11966, 12159,\
+		12352, 12544, 12737, 12930, 13124, 13317, 13510, 13703, 13896, 14088, 14281, 14474, 14668, 14861, 15054, 15247,\
+		15440, 15632, 15825, 16018, 16211, 16405, 16598, 16791, 16984, 17176, 17369, 17562, 17756, 17949, 18142, 18335,\
+		18527, 18720, 18913, 19106, 19300, 19493, 19686, 19879, 20072, 20263, 20455, 20648, 20843, 21041, 21238, 21431,\
+		21616, 21791, 21969, 22163, 22388, 22645, 22894, 23083, 23160, 23113, 23097, 23305, 23932, 25017, 25990, 26127,\
+		24704, 21307, 16769, 12231, 8835, 7411, 7548, 8521, 9607, 10233, 10441, 10425, 10379, 10455, 10644, 10893,\
+		11151, 11375, 11569, 11747, 11923, 12107, 12300, 12497, 12694, 12890, 13083, 13275, 13466, 13659, 13852, 14045,\
+		14239, 14432, 14625, 14818, 15010, 15203, 15396, 15589, 15783, 15976, 16169, 16362, 16555, 16747, 16940, 17133,\
+		17327, 17520, 17713, 17906, 18099, 18291, 18484, 18677, 18871, 19064, 19257, 19450, 19643, 19835, 20028, 20221,\
+		20415, 20608, 20801, 20994, 21187, 21379, 21572, 21765, 21959, 22152, 22345, 22538, 22730, 22923, 23116, 23309,\
+		23503, 23696, 23889, 24082, 24275, 24467, 24660, 24853, 25047, 25240, 25433, 25626, 25819, 26011, 26204, 26397,\
+		26591, 26784, 26977, 27170, 27363, 27555, 27748, 27941, 28135, 28328, 28521, 28714, 28907, 29099, 29292, 29485,\
+		29678, 29872, 30065, 30258, 30451, 30644, 30837, 31030, 31223, 31416, 31609, 31802, 31995, 32188, 32381, 32574,\
+		32767}
+
+	#define skipsaw2 {\
+		0, 258, 516, 775, 1033, 1292, 1551, 1809, 2068, 2326, 2584, 2843, 3102, 3360, 3619, 3877,\
+		4136, 4394, 4652, 4911, 5169, 5428, 5687, 5945, 6204, 6462, 6720, 6979, 7238, 7496, 7755, 8013,\
+		8272, 8530, 8788, 9047, 9306, 9564, 9823, 10082, 10340, 10599, 10858, 11116, 11375, 11633, 11891, 12150,\
+		12408, 12667, 12926, 13184, 13443, 13701, 13959, 14218, 14476, 14735, 14994, 15253, 15511, 15768, 16025, 16284,\
+		16545, 16808, 17070, 17328, 17578, 17820, 18063, 18323, 18612, 18935, 19250, 19504, 19647, 19665, 19714, 19987,\
+		20680, 21835, 22876, 23078, 21715, 18370, 13878, 9387, 6043, 4679, 4881, 5922, 7076, 7770, 8043, 8092,\
+		8111, 8253, 8507, 8822, 9144, 9434, 9694, 9937, 10179, 10429, 10687, 10949, 11213, 11473, 11732, 11989,\
+		12247, 12504, 12763, 13022, 13281, 13539, 13798, 14056, 14314, 14573, 14831, 15090, 15349, 15607, 15865, 16124,\
+		16382, 16641, 16900, 17159, 17418, 17676, 17935, 18193, 18452, 18710, 18968, 19227, 19486, 19744, 20003, 20262,\
+		20520, 20777, 21034, 21293, 21554, 21817, 22079, 22337, 22588, 22829, 23072, 23332, 23622, 23944, 24259, 24513,\
+		24656, 24674, 24723, 24996, 25690, 26844, 27885, 28087, 26724, 23379, 18887, 14396, 11052, 9688, 9890, 10931,\
+		12086, 12779, 13052, 13101, 13120, 13262, 13516, 13831, 14154, 14443, 14703, 14946, 15188, 15438, 15696, 15958,\
+		16222, 16482, 16741, 16998, 17255, 17513, 17772, 18031, 18290, 18548, 18807, 19065, 19323, 19582, 19840, 20099,\
+		20358, 20616, 20875, 21133, 21391, 21650, 21908, 22167, 22426, 22684, 22943, 23202, 23461, 23719, 23978, 24236,\
+		24495, 24753, 25011, 25270, 25529, 25787, 26046, 26304, 26562, 26821, 27079, 27338, 27596, 27855, 28114, 28372,\
+		28630, 28889, 29147, 29406, 29665, 29923, 30182, 30440, 30699, 30957, 31215, 31474, 31732, 31991, 32250, 32508,\
+		32767}
+
+	#define skipsaw3 {\
+		0, 324, 649, 973, 1297, 1622, 1946, 2271, 2596, 2920, 3245, 3570, 3894, 4219, 4544, 4868,\
+		5193, 5517, 5841, 6166, 6490, 6815, 7140, 7464, 7789, 8113, 8437, 8762, 9086, 9411, 9736, 10061,\
+		10386, 10710, 11034, 11359, 11684, 12008, 12333, 12658, 12981, 13305, 13628, 13953, 14280, 14609, 14937, 15261,\
+		15578, 15885, 16195, 16520, 16876, 17266, 17647, 17967, 18175, 18258, 18372, 18712, 19473, 20696, 21807, 22075,\
+		20771, 17478, 13033, 8589, 5297, 3992, 4260, 5371, 6595, 7355, 7695, 7809, 7892, 8100, 8420, 8801,\
+		9190, 9547, 9872, 10182, 10490, 10806, 11130, 11458, 11788, 12114, 12439, 12762, 13086, 13409, 13734, 14059,\
+		14384, 14708, 15032, 15357, 15681, 16007, 16332, 16656, 16981, 17304, 17627, 17952, 18279, 18608, 18936, 19260,\
+		19577, 19884, 20193, 20519, 20875, 21264, 21644, 21965, 22173, 22256, 22370, 22710, 23472, 24695, 25806, 26074,\
+		24770, 21476, 17032, 12588, 9294, 7990, 8259, 9370, 10594, 11355, 11694, 11808, 11891, 12099, 12419, 12800,\
+		13190, 13545, 13871, 14180, 14488, 14804, 15128, 15456, 15785, 16112, 16437, 16761, 17085, 17409, 17733, 18058,\
+		18383, 18707, 19031, 19356, 19680, 20005, 20330, 20655, 20979, 21302, 21625, 21950, 22277, 22606, 22935, 23259,\
+		23576, 23883, 24192, 24518, 24874, 25263, 25643, 25964, 26172, 26255, 26369, 26709, 27470, 28693, 29804, 30072,\
+		28768, 25475, 21030, 16586, 13294, 11989, 12257, 13368, 14592, 15352, 15692, 15806, 15890, 16097, 16418, 16799,\
+		17189, 17544, 17870, 18179, 18487, 18803, 19127, 19455, 19785, 20111, 20436, 20759, 21083, 21406, 21731, 22056,\
+		22381, 22705, 23030, 23355, 23680, 24004, 24329, 24653, 24978, 25302, 25626, 25951, 26276, 26600, 26925, 27249,\
+		27574, 27898, 28222, 28547, 28872, 29196, 29521, 29846, 30171, 30495, 30820, 31144, 31469, 31793, 32117, 32442,\
+		32767}
+
+	#define skipsaw4 {\
+		0, 390, 781, 1172, 1564, 1955, 2346, 2737, 3129, 3520, 3910, 4301, 4693, 5084, 5475, 5866,\
+		6258, 6648, 7039, 7430, 7821, 8213, 8605, 8996, 9387, 9776, 10166, 10557, 10951, 11346, 11742, 12133,\
+		12516, 12889, 13265, 13657, 14080, 14535, 14983, 15370, 15644, 15793, 15973, 16379, 17209, 18502, 19683, 20017,\
+		18773, 15531, 11135, 6738, 3497, 2253, 2588, 3769, 5063, 5892, 6298, 6477, 6626, 6900, 7288, 7735,\
+		8192, 8614, 9006, 9382, 9755, 10138, 10529, 10924, 11321, 11714, 12105, 12495, 12885, 13274, 13664, 14056,\
+		14449, 14845, 15241, 15631, 16013, 16387, 16763, 17155, 17578, 18034, 18482, 18869, 19143, 19292, 19471, 19877,\
+		20707, 22000, 23181, 23516, 22272, 19031, 14634, 10238, 6997, 5752, 6086, 7267, 8561, 9390, 9796, 9976,\
+		10126, 10399, 10786, 11234, 11690, 12112, 12505, 12881, 13255, 13637, 14028, 14423, 14819, 15212, 15603, 15993,\
+		16382, 16772, 17162, 17554, 17947, 18343, 18738, 19129, 19511, 19885, 20261, 20654, 21076, 21532, 21980, 22367,\
+		22640, 22790, 22970, 23376, 24206, 25499, 26680, 27014, 25769, 22528, 18132, 13735, 10495, 9250, 9585, 10766,\
+		12060, 12889, 13295, 13474, 13623, 13897, 14284, 14732, 15189, 15611, 16003, 16379, 16752, 17135, 17525, 17921,\
+		18317, 18710, 19102, 19492, 19881, 20271, 20661, 21052, 21446, 21842, 22237, 22628, 23011, 23384, 23760, 24152,\
+		24575, 25031, 25478, 25866, 26139, 26289, 26468, 26874, 27704, 28997, 30178, 30513, 29268, 26028, 21631, 17235,\
+		13994, 12749, 13083, 14264, 15558, 16387, 16793, 16973, 17123, 17396, 17783, 18231, 18687, 19109, 19501, 19877,\
+		20250, 20633, 21024, 21420, 21816, 22209, 22600, 22990, 23380, 23770, 24161, 24553, 24945, 25336, 25727, 26118,\
+		26508, 26900, 27291, 27682, 28074, 28465, 28856, 29246, 29638, 30029, 30420, 30811, 31203, 31594, 31985, 32376,\
+		32767}
+
+	#define circular_257_slopes0 {\
+		0, 0, 1, 2, 4, 6, 9, 12, 16, 20, 25, 30, 36, 42, 49, 56,\
+		64, 72, 81, 90, 100, 110, 121, 133, 144, 157, 169, 183, 197, 211, 226, 241,\
+		257, 273, 290, 308, 326, 344, 363, 382, 402, 423, 444, 466, 488, 510, 533, 557,\
+		581, 606, 631, 657, 683, 710, 737, 765, 794, 823, 852, 882, 913, 944, 975, 1008,\
+		1040, 1074, 1108, 1142, 1177, 1213, 1249, 1285, 1323, 1360, 1399, 1438, 1477, 1517, 1558, 1599,\
+		1641, 1683, 1726, 1770, 1814, 1859, 1904, 1950, 1997, 2044, 2092, 2140, 2189, 2239, 2289, 2340,\
+		2391, 2443, 2496, 2549, 2603, 2658, 2713, 2769, 2826, 2883, 2941, 2999, 3059, 3119, 3179, 3240,\
+		3302, 3365, 3428, 3492, 3557, 3622, 3688, 3755, 3823, 3891, 3960, 4030, 4100, 4172, 4244, 4316,\
+		4390, 4464, 4539, 4615, 4692, 4769, 4847, 4926, 5006, 5087, 5168, 5251, 5334, 5418, 5503, 5589,\
+		5675, 5763, 5851, 5941, 6031, 6122, 6214, 6307, 6401, 6496, 6592, 6689, 6787, 6886, 6985, 7086,\
+		7188, 7291, 7395, 7500, 7607, 7714, 7823, 7932, 8043, 8155, 8268, 8382, 8498, 8614, 8732, 8852,\
+		8972, 9094, 9217, 9342, 9467, 9595, 9723, 9854, 9985, 10118, 10253, 10389, 10527, 10666, 10807, 10949,\
+		11094, 11240, 11387, 11537, 11688, 11842, 11997, 12154, 12313, 12474, 12638, 12803, 12971, 13141, 13313, 13488,\
+		13665, 13845, 14027, 14212, 14400, 14590, 14784, 14980, 15180, 15383, 15589, 15798, 16012, 16229, 16450, 16675,\
+		16904, 17137, 17376, 17619, 17867, 18120, 18379, 18644, 18915, 19193, 19478, 19770, 20070, 20379, 20697, 21025,\
+		21365, 21716, 22080, 22458, 22852, 23265, 23698, 24155, 24640, 25157, 25714, 26323, 26997, 27765, 28679, 29874,\
+		32767}
+
+	#define circular_257_slopes1 {\
+		0, 0, 2, 5, 8, 13, 18, 25, 32, 41, 50, 61, 72, 85, 98, 113,\
+		129, 145, 163, 181, 201, 222, 244, 267, 291, 316, 342, 369, 397, 426, 456, 488,\
+		520, 554, 589, 624, 661, 699, 739, 779, 821, 863, 907, 952, 998, 1046, 1095, 1144,\
+		1196, 1248, 1302, 1357, 1413, 1470, 1529, 1590, 1651, 1714, 1778, 1844, 1911, 1980, 2050, 2122,\
+		2195, 2270, 2346, 2424, 2503, 2584, 2667, 2751, 2838, 2926, 3015, 3107, 3201, 3296, 3393, 3493,\
+		3594, 3698, 3803, 3911, 4021, 4134, 4249, 4366, 4486, 4609, 4734, 4862, 4993, 5126, 5263, 5403,\
+		5547, 5694, 5844, 5998, 6157, 6319, 6486, 6657, 6833, 7014, 7200, 7392, 7590, 7794, 8006, 8225,\
+		8452, 8688, 8933, 9189, 9458, 9739, 10035, 10349, 10682, 11040, 11426, 11849, 12320, 12857, 13499, 14340,\
+		16383, 18427, 19268, 19910, 20447, 20918, 21341, 21727, 22085, 22418, 22732, 23028, 23309, 23578, 23834, 24079,\
+		24315, 24542, 24761, 24973, 25177, 25375, 25567, 25753, 25934, 26110, 26281, 26448, 26610, 26769, 26923, 27073,\
+		27220, 27364, 27504, 27641, 27774, 27905, 28033, 28158, 28281, 28401, 28518, 28633, 28746, 28856, 28964, 29069,\
+		29173, 29274, 29374, 29471, 29566, 29660, 29752, 29841, 29929, 30016, 30100, 30183, 30264, 30343, 30421, 30497,\
+		30572, 30645, 30717, 30787, 30856, 30923, 30989, 31053, 31116, 31177, 31238, 31297, 31354, 31410, 31465, 31519,\
+		31571, 31623, 31672, 31721, 31769, 31815, 31860, 31904, 31946, 31988, 32028, 32068, 32106, 32143, 32178, 32213,\
+		32247, 32279, 32311, 32341, 32370, 32398, 32425, 32451, 32476, 32500, 32523, 32545, 32566, 32586, 32604, 32622,\
+		32638, 32654, 32669, 32682, 32695, 32706, 32717, 32726, 32735, 32742, 32749, 32754, 32759, 32762, 32765, 32767,\
+		32767}
+
+	#define circular_257_slopes2 {\
+		0, 2044, 2885, 3526, 4064, 4534, 4957, 5344, 5701, 6035, 6348, 6645, 6926, 7194, 7450, 7696,\
+		7932, 8159, 8378, 8589, 8794, 8992, 9184, 9370, 9551, 9727, 9898, 10065, 10227, 10385, 10539, 10690,\
+		10837, 10980, 11120, 11257, 11391, 11522, 11650, 11775, 11897, 12017, 12135, 12250, 12362, 12472, 12580, 12686,\
+		12789, 12891, 12990, 13088, 13183, 13276, 13368, 13458, 13546, 13632, 13716, 13799, 13880, 13960, 14038, 14114,\
+		14189, 14262, 14333, 14403, 14472, 14539, 14605, 14669, 14732, 14794, 14854, 14913, 14971, 15027, 15082, 15136,\
+		15188, 15239, 15289, 15338, 15385, 15431, 15476, 15520, 15563, 15605, 15645, 15684, 15722, 15759, 15795, 15830,\
+		15863, 15896, 15927, 15957, 15987, 16015, 16042, 16068, 16093, 16117, 16140, 16162, 16182, 16202, 16221, 16238,\
+		16255, 16271, 16285, 16299, 16311, 16323, 16333, 16343, 16351, 16359, 16365, 16371, 16375, 16379, 16381, 16383,\
+		16383, 16384, 16386, 16388, 16392, 16396, 16402, 16408, 16416, 16424, 16434, 16444, 16456, 16468, 16482, 16496,\
+		16512, 16529, 16546, 16565, 16585, 16605, 16627, 16650, 16674, 16699, 16725, 16752, 16780, 16810, 16840, 16871,\
+		16904, 16937, 16972, 17008, 17045, 17083, 17122, 17162, 17204, 17247, 17291, 17336, 17382, 17429, 17478, 17528,\
+		17579, 17631, 17685, 17740, 17796, 17854, 17913, 17973, 18035, 18098, 18162, 18228, 18295, 18364, 18434, 18505,\
+		18578, 18653, 18729, 18807, 18887, 18968, 19051, 19135, 19221, 19309, 19399, 19491, 19584, 19679, 19777, 19876,\
+		19978, 20081, 20187, 20295, 20405, 20517, 20632, 20750, 20870, 20992, 21117, 21245, 21376, 21510, 21647, 21787,\
+		21930, 22077, 22228, 22382, 22540, 22702, 22869, 23040, 23216, 23397, 23583, 23775, 23973, 24178, 24389, 24608,\
+		24835, 25071, 25317, 25573, 25841, 26122, 26419, 26732, 27066, 27423, 27810, 28233, 28703, 29241, 29882, 30723,\
+		32767}
+
+	#define circular_257_slopes3 {\
+		0, 2893, 4088, 5002, 5770, 6444, 7053, 7610, 8127, 8612, 9069, 9502, 9915, 10309, 10687, 11051,\
+		11402, 11742, 12070, 12388, 12697, 12997, 13289, 13574, 13852, 14123, 14388, 14647, 14900, 15148, 15391, 15630,\
+		15863, 16092, 16317, 16538, 16755, 16969, 17178, 17384, 17587, 17787, 17983, 18177, 18367, 18555, 18740, 18922,\
+		19102, 19279, 19454, 19626, 19796, 19964, 20129, 20293, 20454, 20613, 20770, 20925, 21079, 21230, 21380, 21527,\
+		21673, 21818, 21960, 22101, 22240, 22378, 22514, 22649, 22782, 22913, 23044, 23172, 23300, 23425, 23550, 23673,\
+		23795, 23915, 24035, 24153, 24269, 24385, 24499, 24612, 24724, 24835, 24944, 25053, 25160, 25267, 25372, 25476,\
+		25579, 25681, 25782, 25881, 25980, 26078, 26175, 26271, 26366, 26460, 26553, 26645, 26736, 26826, 26916, 27004,\
+		27092, 27178, 27264, 27349, 27433, 27516, 27599, 27680, 27761, 27841, 27920, 27998, 28075, 28152, 28228, 28303,\
+		28377, 28451, 28523, 28595, 28667, 28737, 28807, 28876, 28944, 29012, 29079, 29145, 29210, 29275, 29339, 29402,\
+		29465, 29527, 29588, 29648, 29708, 29768, 29826, 29884, 29941, 29998, 30054, 30109, 30164, 30218, 30271, 30324,\
+		30376, 30427, 30478, 30528, 30578, 30627, 30675, 30723, 30770, 30817, 30863, 30908, 30953, 30997, 31041, 31084,\
+		31126, 31168, 31209, 31250, 31290, 31329, 31368, 31407, 31444, 31482, 31518, 31554, 31590, 31625, 31659, 31693,\
+		31727, 31759, 31792, 31823, 31854, 31885, 31915, 31944, 31973, 32002, 32030, 32057, 32084, 32110, 32136, 32161,\
+		32186, 32210, 32234, 32257, 32279, 32301, 32323, 32344, 32365, 32385, 32404, 32423, 32441, 32459, 32477, 32494,\
+		32510, 32526, 32541, 32556, 32570, 32584, 32598, 32610, 32623, 32634, 32646, 32657, 32667, 32677, 32686, 32695,\
+		32703, 32711, 32718, 32725, 32731, 32737, 32742, 32747, 32751, 32755, 32758, 32761, 32763, 32765, 32766, 32767,\
+		32767}
+
+	#define csound_formants_attack0 {\
+		43, 43, 62, 101, 159, 237, 333, 448, 581, 730, 897, 1079, 1276, 1488, 1712, 1948,\
+		2196, 2453, 2720, 2995, 3278, 3567, 3862, 4162, 4468, 4777, 5090, 5406, 5726, 6048, 6373, 6700,\
+		7031, 7363, 7698, 8036, 8376, 8719, 9064, 9412, 9762, 10114, 10468, 10824, 11182, 11540, 11899, 12259,\
+		12618, 12976, 13333, 13688, 14041, 14391, 14737, 15079, 15416, 15749, 16076, 16397, 16712, 17021, 17323, 17619,\
+		17907, 18189, 18464, 18731, 18991, 19243, 19488, 19725, 19954, 20175, 20388, 20592, 20787, 20972, 21148, 21313,\
+		21468, 21612, 21744, 21865, 21973, 22070, 22153, 22224, 22282, 22327, 22359, 22380, 22388, 22384, 22370, 22344,\
+		22309, 22265, 22212, 22152, 22084, 22011, 21932, 21848, 21760, 21669, 21575, 21478, 21379, 21279, 21177, 21073,\
+		20968, 20862, 20754, 20643, 20531, 20417, 20299, 20179, 20055, 19928, 19797, 19662, 19522, 19379, 19230, 19078,\
+		18921, 18760, 18595, 18427, 18256, 18082, 17907, 17730, 17553, 17376, 17200, 17026, 16854, 16686, 16522, 16364,\
+		16211, 16064, 15924, 15792, 15668, 15553, 15446, 15348, 15259, 15179, 15109, 15047, 14994, 14950, 14913, 14885,\
+		14864, 14850, 14842, 14840, 14844, 14854, 14868, 14887, 14910, 14937, 14968, 15003, 15041, 15083, 15129, 15178,\
+		15232, 15289, 15351, 15416, 15487, 15561, 15641, 15726, 15815, 15909, 16009, 16113, 16222, 16336, 16455, 16577,\
+		16704, 16834, 16968, 17105, 17245, 17387, 17531, 17677, 17825, 17974, 18124, 18274, 18425, 18577, 18728, 18880,\
+		19031, 19182, 19332, 19482, 19630, 19777, 19924, 20068, 20210, 20351, 20488, 20623, 20754, 20881, 21004, 21123,\
+		21236, 21343, 21444, 21539, 21626, 21707, 21779, 21843, 21899, 21946, 21985, 22015, 22036, 22049, 22053, 22048,\
+		22036, 22015, 21986, 21950, 21907, 21858, 21801, 21739, 21671, 21598, 21519, 21436, 21347, 21255, 21157, 21056,\
+		20950}
+
+	#define csound_formants_attack1 {\
+		0, 6, 47, 123, 232, 375, 551, 758, 997, 1266, 1564, 1890, 2243, 2622, 3025, 3450,\
+		3898, 4365, 4851, 5353, 5870, 6402, 6945, 7499, 8062, 8632, 9209, 9792, 10379, 10969, 11562, 12157,\
+		12754, 13353, 13952, 14554, 15156, 15761, 16367, 16975, 17586, 18200, 18816, 19435, 20056, 20680, 21305, 21931,\
+		22556, 23179, 23800, 24415, 25023, 25621, 26208, 26780, 27335, 27871, 28384, 28872, 29333, 29764, 30163, 30529,\
+		30860, 31154, 31410, 31629, 31810, 31952, 32057, 32126, 32159, 32158, 32124, 32060, 31966, 31845, 31700, 31532,\
+		31342, 31134, 30908, 30667, 30412, 30145, 29866, 29576, 29277, 28969, 28652, 28327, 27994, 27654, 27305, 26949,\
+		26584, 26211, 25831, 25442, 25044, 24639, 24225, 23803, 23374, 22937, 22493, 22043, 21586, 21125, 20659, 20189,\
+		19717, 19242, 18767, 18292, 17818, 17347, 16879, 16416, 15959, 15508, 15066, 14632, 14209, 13797, 13397, 13010,\
+		12637, 12279, 11936, 11610, 11300, 11007, 10733, 10476, 10238, 10018, 9818, 9636, 9473, 9330, 9205, 9098,\
+		9011, 8941, 8890, 8856, 8839, 8839, 8855, 8886, 8932, 8992, 9065, 9150, 9247, 9355, 9472, 9597,\
+		9729, 9868, 10012, 10160, 10312, 10465, 10620, 10775, 10930, 11084, 11237, 11389, 11539, 11687, 11834, 11980,\
+		12125, 12270, 12416, 12562, 12711, 12862, 13017, 13177, 13341, 13511, 13686, 13868, 14057, 14252, 14453, 14660,\
+		14872, 15089, 15309, 15532, 15757, 15981, 16205, 16425, 16642, 16854, 17059, 17257, 17445, 17625, 17794, 17952,\
+		18098, 18234, 18358, 18471, 18573, 18666, 18749, 18824, 18891, 18953, 19009, 19061, 19110, 19157, 19204, 19252,\
+		19301, 19352, 19407, 19465, 19527, 19594, 19666, 19743, 19825, 19912, 20003, 20099, 20199, 20302, 20408, 20517,\
+		20628, 20740, 20853, 20966, 21078, 21189, 21298, 21405, 21509, 21610, 21707, 21800, 21888, 21972, 22051, 22124,\
+		22192}
+
+	#define csound_formants_attack2 {\
+		6, 53, 149, 292, 482, 717, 992, 1306, 1654, 2033, 2437, 2862, 3304, 3757, 4216, 4676,\
+		5133, 5581, 6017, 6435, 6832, 7204, 7548, 7861, 8140, 8384, 8591, 8760, 8890, 8980, 9031, 9044,\
+		9019, 8957, 8862, 8734, 8576, 8392, 8184, 7956, 7712, 7457, 7193, 6927, 6662, 6402, 6153, 5919,\
+		5704, 5512, 5347, 5212, 5110, 5043, 5014, 5023, 5072, 5159, 5286, 5450, 5650, 5883, 6146, 6436,\
+		6750, 7082, 7429, 7786, 8148, 8511, 8871, 9223, 9563, 9889, 10197, 10484, 10749, 10989, 11205, 11396,\
+		11562, 11704, 11823, 11921, 12000, 12063, 12111, 12148, 12177, 12200, 12220, 12240, 12262, 12288, 12320, 12360,\
+		12409, 12467, 12536, 12614, 12702, 12799, 12904, 13015, 13131, 13251, 13371, 13491, 13608, 13720, 13825, 13922,\
+		14009, 14084, 14146, 14194, 14229, 14249, 14255, 14248, 14229, 14199, 14160, 14115, 14066, 14017, 13972, 13933,\
+		13906, 13896, 13906, 13941, 14008, 14109, 14251, 14436, 14671, 14957, 15298, 15696, 16152, 16666, 17238, 17866,\
+		18546, 19275, 20046, 20852, 21686, 22538, 23399, 24257, 25101, 25919, 26699, 27429, 28096, 28690, 29201, 29618,\
+		29934, 30144, 30241, 30223, 30091, 29844, 29487, 29024, 28465, 27817, 27092, 26303, 25464, 24590, 23696, 22798,\
+		21913, 21057, 20244, 19489, 18805, 18204, 17698, 17293, 16997, 16815, 16748, 16799, 16964, 17242, 17626, 18111,\
+		18687, 19346, 20077, 20868, 21707, 22582, 23481, 24391, 25299, 26194, 27064, 27899, 28689, 29426, 30101, 30709,\
+		31244, 31702, 32079, 32375, 32587, 32717, 32767, 32737, 32632, 32455, 32212, 31908, 31549, 31141, 30691, 30207,\
+		29694, 29162, 28616, 28063, 27511, 26967, 26435, 25922, 25434, 24973, 24546, 24154, 23801, 23489, 23219, 22993,\
+		22809, 22669, 22570, 22512, 22493, 22510, 22560, 22642, 22751, 22883, 23037, 23207, 23390, 23582, 23780, 23980,\
+		24179}
+
+	#define csound_formants_attack3 {\
+		0, 158, 553, 1158, 1924, 2791, 3691, 4560, 5342, 5995, 6499, 6855, 7083, 7225, 7334, 7469,\
+		7688, 8043, 8569, 9284, 10184, 11246, 12425, 13669, 14915, 16101, 17172, 18088, 18824, 19377, 19762, 20013,\
+		20174, 20301, 20445, 20656, 20970, 21406, 21969, 22641, 23393, 24179, 24949, 25652, 26241, 26681, 26950, 27044,\
+		26975, 26771, 26470, 26119, 25765, 25453, 25216, 25078, 25045, 25111, 25254, 25443, 25639, 25803, 25898, 25896,\
+		25778, 25539, 25187, 24743, 24236, 23702, 23178, 22699, 22294, 21982, 21771, 21659, 21631, 21665, 21733, 21805,\
+		21854, 21855, 21794, 21662, 21464, 21209, 20917, 20611, 20315, 20052, 19843, 19701, 19631, 19632, 19696, 19806,\
+		19945, 20091, 20225, 20330, 20393, 20407, 20371, 20290, 20172, 20030, 19877, 19727, 19591, 19477, 19390, 19329,\
+		19291, 19269, 19253, 19233, 19199, 19141, 19054, 18933, 18776, 18585, 18363, 18116, 17849, 17568, 17279, 16987,\
+		16695, 16406, 16120, 15837, 15558, 15281, 15005, 14730, 14454, 14179, 13902, 13625, 13348, 13069, 12790, 12511,\
+		12231, 11952, 11676, 11404, 11140, 10888, 10653, 10440, 10254, 10098, 9977, 9892, 9843, 9829, 9846, 9890,\
+		9954, 10033, 10123, 10217, 10316, 10417, 10524, 10641, 10773, 10928, 11112, 11332, 11594, 11899, 12247, 12636,\
+		13059, 13509, 13976, 14449, 14919, 15378, 15820, 16241, 16642, 17025, 17397, 17763, 18133, 18514, 18912, 19332,\
+		19775, 20238, 20717, 21203, 21686, 22155, 22599, 23009, 23376, 23697, 23970, 24197, 24383, 24537, 24667, 24783,\
+		24894, 25006, 25124, 25249, 25379, 25510, 25633, 25739, 25819, 25864, 25866, 25821, 25725, 25581, 25394, 25170,\
+		24919, 24652, 24378, 24108, 23850, 23606, 23381, 23171, 22973, 22780, 22584, 22376, 22149, 21897, 21614, 21302,\
+		20960, 20596, 20216, 19830, 19448, 19081, 18737, 18423, 18144, 17901, 17691, 17509, 17348, 17198, 17052, 16900,\
+		16735}
+
+	#define csound_formants_attack4 {\
+		0, 53, 200, 441, 775, 1201, 1713, 2306, 2974, 3709, 4501, 5340, 6213, 7109, 8015, 8917,\
+		9801, 10655, 11465, 12219, 12905, 13512, 14032, 14456, 14777, 14992, 15096, 15090, 14974, 14750, 14423, 13998,\
+		13484, 12889, 12223, 11499, 10726, 9919, 9090, 8252, 7417, 6599, 5809, 5058, 4357, 3715, 3139, 2637,\
+		2214, 1874, 1618, 1450, 1368, 1370, 1455, 1619, 1856, 2161, 2528, 2950, 3420, 3929, 4471, 5038,\
+		5621, 6213, 6807, 7397, 7977, 8540, 9082, 9598, 10086, 10541, 10963, 11350, 11700, 12015, 12294, 12539,\
+		12751, 12931, 13084, 13210, 13312, 13394, 13458, 13508, 13545, 13572, 13592, 13607, 13618, 13628, 13638, 13648,\
+		13659, 13672, 13687, 13704, 13723, 13743, 13764, 13786, 13807, 13829, 13849, 13868, 13885, 13900, 13914, 13925,\
+		13935, 13943, 13950, 13956, 13961, 13966, 13971, 13977, 13984, 13993, 14002, 14014, 14027, 14042, 14059, 14077,\
+		14097, 14119, 14143, 14168, 14196, 14226, 14260, 14297, 14339, 14388, 14443, 14508, 14582, 14670, 14771, 14888,\
+		15024, 15179, 15356, 15556, 15779, 16028, 16302, 16602, 16926, 17275, 17645, 18036, 18444, 18866, 19298, 19736,\
+		20176, 20612, 21038, 21450, 21842, 22207, 22542, 22839, 23095, 23304, 23463, 23569, 23618, 23608, 23539, 23410,\
+		23221, 22974, 22672, 22318, 21916, 21470, 20986, 20471, 19932, 19375, 18808, 18240, 17678, 17131, 16605, 16110,\
+		15651, 15236, 14871, 14561, 14310, 14122, 13999, 13944, 13957, 14037, 14183, 14391, 14660, 14983, 15357, 15774,\
+		16228, 16712, 17219, 17739, 18267, 18792, 19309, 19808, 20284, 20729, 21137, 21504, 21824, 22094, 22311, 22474,\
+		22581, 22632, 22628, 22571, 22462, 22306, 22104, 21862, 21583, 21273, 20936, 20578, 20203, 19816, 19423, 19027,\
+		18632, 18244, 17865, 17498, 17146, 16812, 16496, 16200, 15926, 15673, 15441, 15232, 15043, 14874, 14724, 14592,\
+		14477}
+
+	#define csound_formants_attack5 {\
+		0, 198, 907, 2092, 3668, 5505, 7448, 9328, 10985, 12284, 13130, 13478, 13341, 12784, 11920, 10893,\
+		9867, 9002, 8438, 8278, 8578, 9341, 10512, 11992, 13644, 15310, 16831, 18063, 18894, 19258, 19141, 18581,\
+		17666, 16522, 15300, 14156, 13239, 12666, 12519, 12827, 13571, 14684, 16059, 17562, 19049, 20382, 21444, 22151,\
+		22464, 22389, 21977, 21319, 20530, 19741, 19079, 18655, 18551, 18812, 19440, 20397, 21607, 22968, 24362, 25671,\
+		26786, 27623, 28129, 28286, 28115, 27667, 27023, 26275, 25522, 24857, 24355, 24063, 24003, 24163, 24503, 24960,\
+		25458, 25913, 26245, 26388, 26297, 25947, 25343, 24513, 23504, 22379, 21206, 20053, 18981, 18035, 17243, 16613,\
+		16134, 15779, 15509, 15278, 15039, 14751, 14382, 13912, 13336, 12663, 11912, 11116, 10308, 9527, 8807, 8176,\
+		7654, 7253, 6971, 6802, 6730, 6735, 6795, 6888, 6996, 7102, 7198, 7279, 7345, 7400, 7451, 7507,\
+		7576, 7666, 7783, 7931, 8113, 8329, 8577, 8856, 9162, 9492, 9840, 10203, 10575, 10951, 11325, 11691,\
+		12043, 12373, 12678, 12952, 13194, 13402, 13581, 13733, 13867, 13990, 14112, 14243, 14391, 14563, 14761, 14988,\
+		15240, 15512, 15795, 16082, 16361, 16623, 16862, 17073, 17253, 17405, 17535, 17649, 17757, 17870, 17997, 18149,\
+		18330, 18546, 18796, 19079, 19389, 19718, 20059, 20401, 20735, 21053, 21347, 21613, 21848, 22049, 22219, 22360,\
+		22474, 22567, 22642, 22706, 22761, 22813, 22863, 22914, 22966, 23018, 23065, 23105, 23130, 23133, 23106, 23040,\
+		22927, 22760, 22535, 22251, 21909, 21514, 21077, 20609, 20123, 19636, 19162, 18713, 18299, 17924, 17588, 17285,\
+		17005, 16732, 16451, 16146, 15801, 15407, 14957, 14454, 13907, 13330, 12744, 12172, 11641, 11172, 10785, 10492,\
+		10296, 10194, 10172, 10211, 10284, 10366, 10428, 10450, 10416, 10318, 10159, 9952, 9716, 9479, 9268, 9114,\
+		9040}
+
+	#define csound_formants_attack6 {\
+		0, 198, 943, 2139, 3649, 5309, 6954, 8427, 9606, 10406, 10795, 10787, 10444, 9862, 9158, 8455,\
+		7868, 7487, 7371, 7540, 7974, 8617, 9390, 10194, 10933, 11520, 11890, 12009, 11880, 11539, 11052, 10509,\
+		10011, 9655, 9530, 9699, 10192, 11006, 12101, 13405, 14823, 16243, 17554, 18653, 19455, 19908, 19990, 19719,\
+		19144, 18343, 17416, 16470, 15614, 14943, 14533, 14431, 14654, 15186, 15983, 16978, 18086, 19218, 20286, 21213,\
+		21941, 22436, 22686, 22707, 22536, 22224, 21836, 21434, 21078, 20816, 20678, 20677, 20803, 21031, 21321, 21624,\
+		21890, 22074, 22140, 22070, 21862, 21533, 21119, 20666, 20230, 19870, 19635, 19564, 19680, 19982, 20448, 21036,\
+		21684, 22324, 22878, 23276, 23459, 23387, 23044, 22438, 21606, 20607, 19517, 18422, 17409, 16558, 15931, 15568,\
+		15483, 15660, 16058, 16613, 17246, 17873, 18411, 18790, 18959, 18890, 18584, 18067, 17386, 16605, 15797, 15032,\
+		14374, 13867, 13536, 13382, 13379, 13487, 13647, 13797, 13877, 13837, 13645, 13290, 12787, 12170, 11494, 10824,\
+		10229, 9773, 9504, 9450, 9616, 9978, 10488, 11081, 11676, 12192, 12555, 12705, 12605, 12247, 11651, 10865,\
+		9959, 9015, 8122, 7364, 6811, 6508, 6476, 6706, 7162, 7783, 8496, 9219, 9874, 10395, 10735, 10871,\
+		10805, 10565, 10198, 9766, 9334, 8966, 8713, 8611, 8671, 8886, 9226, 9645, 10090, 10502, 10832, 11041,\
+		11109, 11038, 10847, 10576, 10278, 10009, 9827, 9780, 9901, 10202, 10677, 11295, 12011, 12767, 13499, 14145,\
+		14654, 14989, 15134, 15093, 14890, 14568, 14180, 13786, 13444, 13205, 13105, 13163, 13383, 13747, 14225, 14775,\
+		15352, 15909, 16406, 16816, 17122, 17321, 17425, 17455, 17438, 17406, 17387, 17403, 17469, 17589, 17756, 17956,\
+		18170, 18374, 18546, 18670, 18733, 18734, 18680, 18584, 18465, 18348, 18254, 18203, 18210, 18282, 18416, 18605,\
+		18834}
+
+	#define csound_formants_attack7 {\
+		0, 206, 817, 1751, 2913, 4196, 5498, 6728, 7813, 8702, 9371, 9820, 10071, 10165, 10155, 10096,\
+		10044, 10046, 10136, 10330, 10629, 11014, 11452, 11898, 12302, 12615, 12794, 12806, 12637, 12291, 11795, 11191,\
+		10542, 9921, 9407, 9075, 8995, 9218, 9773, 10663, 11863, 13320, 14957, 16678, 18374, 19936, 21259, 22257,\
+		22866, 23050, 22809, 22176, 21212, 20007, 18666, 17304, 16032, 14950, 14138, 13648, 13501, 13688, 14168, 14876,\
+		15731, 16643, 17525, 18298, 18901, 19298, 19475, 19447, 19249, 18932, 18558, 18189, 17880, 17673, 17590, 17632,\
+		17777, 17983, 18196, 18354, 18392, 18258, 17913, 17338, 16540, 15551, 14423, 13228, 12049, 10971, 10075, 9428,\
+		9077, 9044, 9322, 9881, 10663, 11593, 12586, 13549, 14397, 15054, 15464, 15592, 15428, 14985, 14299, 13424,\
+		12425, 11373, 10337, 9381, 8558, 7904, 7439, 7169, 7079, 7147, 7339, 7617, 7941, 8278, 8597, 8877,\
+		9108, 9287, 9422, 9526, 9615, 9710, 9828, 9983, 10183, 10430, 10718, 11034, 11358, 11666, 11932, 12132,\
+		12242, 12247, 12136, 11912, 11584, 11175, 10716, 10244, 9803, 9437, 9188, 9094, 9180, 9462, 9940, 10599,\
+		11411, 12333, 13313, 14293, 15215, 16023, 16669, 17119, 17353, 17370, 17186, 16830, 16347, 15789, 15213, 14673,\
+		14217, 13883, 13694, 13657, 13764, 13994, 14313, 14684, 15064, 15415, 15707, 15919, 16043, 16084, 16057, 15990,\
+		15912, 15855, 15847, 15909, 16050, 16268, 16547, 16861, 17173, 17444, 17632, 17702, 17627, 17393, 17000, 16464,\
+		15814, 15092, 14347, 13631, 12995, 12481, 12124, 11942, 11939, 12103, 12409, 12819, 13291, 13777, 14231, 14615,\
+		14896, 15054, 15079, 14975, 14754, 14437, 14050, 13621, 13177, 12744, 12340, 11979, 11669, 11412, 11205, 11040,\
+		10911, 10808, 10725, 10655, 10596, 10548, 10510, 10487, 10482, 10500, 10543, 10615, 10715, 10843, 10995, 11166,\
+		11351}
+
+	#define csound_formants_attack8 {\
+		0, 667, 1953, 3699, 5709, 7771, 9679, 11257, 12381, 12992, 13100, 12786, 12192, 11498, 10907, 10616,\
+		10792, 11549, 12937, 14929, 17427, 20267, 23239, 26110, 28649, 30652, 31967, 32509, 32271, 31323, 29808, 27919,\
+		25881, 23926, 22264, 21061, 20419, 20370, 20868, 21799, 22996, 24259, 25378, 26162, 26460, 26180, 25299, 23867,\
+		22003, 19875, 17689, 15658, 13980, 12817, 12274, 12389, 13127, 14389, 16019, 17828, 19608, 21165, 22334, 22999,\
+		23106, 22664, 21746, 20477, 19016, 17539, 16215, 15189, 14564, 14387, 14651, 15291, 16198, 17229, 18229, 19045,\
+		19550, 19654, 19314, 18541, 17395, 15980, 14428, 12887, 11502, 10400, 9674, 9377, 9517, 10055, 10919, 12005,\
+		13198, 14382, 15454, 16337, 16987, 17393, 17582, 17610, 17553, 17495, 17523, 17706, 18095, 18714, 19554, 20581,\
+		21735, 22944, 24124, 25196, 26093, 26765, 27182, 27342, 27262, 26979, 26543, 26007, 25425, 24842, 24291, 23790,\
+		23341, 22934, 22547, 22155, 21730, 21250, 20702, 20082, 19397, 18665, 17913, 17170, 16466, 15827, 15275, 14818,\
+		14460, 14193, 14004, 13876, 13790, 13733, 13695, 13673, 13673, 13705, 13785, 13928, 14150, 14456, 14850, 15320,\
+		15848, 16408, 16967, 17490, 17944, 18303, 18550, 18680, 18700, 18630, 18500, 18345, 18202, 18106, 18083, 18148,\
+		18303, 18535, 18821, 19127, 19413, 19641, 19777, 19797, 19691, 19465, 19140, 18750, 18340, 17960, 17658, 17475,\
+		17444, 17579, 17877, 18319, 18871, 19485, 20110, 20692, 21184, 21549, 21767, 21833, 21759, 21573, 21314, 21028,\
+		20762, 20556, 20442, 20436, 20538, 20733, 20991, 21271, 21524, 21705, 21769, 21686, 21436, 21017, 20445, 19750,\
+		18972, 18161, 17369, 16643, 16023, 15538, 15201, 15011, 14950, 14993, 15103, 15242, 15371, 15460, 15486, 15438,\
+		15319, 15144, 14937, 14731, 14562, 14464, 14466, 14591, 14848, 15237, 15743, 16342, 17002, 17685, 18355, 18974,\
+		19512}
+
+	#define csound_formants_release0 {\
+		0, 19, 57, 113, 188, 279, 387, 511, 649, 802, 967, 1145, 1334, 1533, 1743, 1961,\
+		2188, 2423, 2666, 2916, 3174, 3440, 3714, 3995, 4286, 4585, 4894, 5213, 5543, 5885, 6239, 6606,\
+		6986, 7379, 7787, 8208, 8644, 9093, 9557, 10033, 10522, 11022, 11534, 12055, 12584, 13122, 13665, 14213,\
+		14764, 15317, 15871, 16425, 16976, 17525, 18070, 18611, 19145, 19674, 20196, 20710, 21217, 21717, 22208, 22691,\
+		23165, 23631, 24089, 24538, 24978, 25410, 25833, 26246, 26650, 27045, 27429, 27803, 28167, 28519, 28859, 29187,\
+		29502, 29805, 30094, 30368, 30629, 30875, 31106, 31322, 31522, 31708, 31878, 32032, 32172, 32296, 32405, 32500,\
+		32580, 32645, 32697, 32734, 32757, 32767, 32762, 32744, 32713, 32668, 32608, 32535, 32448, 32346, 32230, 32098,\
+		31952, 31789, 31611, 31416, 31205, 30976, 30731, 30469, 30189, 29893, 29580, 29250, 28904, 28542, 28166, 27776,\
+		27373, 26958, 26532, 26097, 25655, 25206, 24753, 24297, 23839, 23382, 22926, 22473, 22024, 21582, 21145, 20717,\
+		20296, 19884, 19481, 19087, 18701, 18324, 17954, 17592, 17237, 16887, 16541, 16200, 15861, 15524, 15188, 14853,\
+		14517, 14182, 13846, 13509, 13173, 12837, 12502, 12170, 11841, 11517, 11198, 10888, 10587, 10297, 10019, 9756,\
+		9509, 9279, 9067, 8876, 8704, 8554, 8426, 8319, 8234, 8171, 8130, 8109, 8108, 8126, 8163, 8216,\
+		8285, 8369, 8467, 8577, 8698, 8829, 8970, 9120, 9277, 9441, 9612, 9789, 9972, 10161, 10354, 10553,\
+		10758, 10967, 11182, 11401, 11626, 11856, 12090, 12330, 12574, 12822, 13074, 13331, 13590, 13852, 14117, 14383,\
+		14650, 14918, 15186, 15452, 15717, 15980, 16240, 16496, 16747, 16994, 17236, 17472, 17702, 17926, 18143, 18353,\
+		18556, 18753, 18942, 19124, 19300, 19468, 19631, 19787, 19937, 20081, 20220, 20354, 20482, 20606, 20725, 20840,\
+		20950}
+
+	#define csound_formants_release1 {\
+		19, 48, 112, 210, 344, 512, 714, 950, 1219, 1521, 1855, 2220, 2614, 3038, 3488, 3965,\
+		4467, 4992, 5539, 6105, 6691, 7292, 7909, 8538, 9179, 9828, 10485, 11147, 11812, 12479, 13146, 13810,\
+		14471, 15126, 15774, 16414, 17045, 17666, 18276, 18874, 19460, 20034, 20596, 21145, 21684, 22211, 22728, 23235,\
+		23734, 24225, 24709, 25186, 25658, 26124, 26585, 27041, 27492, 27936, 28374, 28804, 29223, 29632, 30027, 30406,\
+		30766, 31105, 31420, 31708, 31966, 32193, 32384, 32539, 32655, 32732, 32767, 32760, 32711, 32621, 32490, 32321,\
+		32114, 31872, 31597, 31293, 30963, 30611, 30239, 29851, 29451, 29042, 28627, 28210, 27793, 27379, 26969, 26565,\
+		26168, 25780, 25400, 25030, 24669, 24316, 23971, 23634, 23302, 22976, 22653, 22334, 22015, 21698, 21379, 21060,\
+		20738, 20414, 20086, 19756, 19421, 19083, 18742, 18397, 18050, 17701, 17351, 17000, 16649, 16299, 15951, 15606,\
+		15264, 14928, 14597, 14272, 13956, 13647, 13348, 13059, 12781, 12514, 12260, 12018, 11789, 11574, 11372, 11184,\
+		11010, 10850, 10705, 10573, 10454, 10348, 10256, 10176, 10107, 10050, 10004, 9968, 9942, 9925, 9917, 9917,\
+		9925, 9941, 9965, 9997, 10036, 10082, 10137, 10199, 10270, 10350, 10439, 10538, 10648, 10768, 10899, 11042,\
+		11197, 11364, 11544, 11737, 11942, 12159, 12388, 12629, 12880, 13141, 13412, 13690, 13976, 14267, 14563, 14862,\
+		15163, 15465, 15765, 16064, 16359, 16650, 16936, 17216, 17489, 17754, 18012, 18260, 18500, 18731, 18954, 19167,\
+		19371, 19567, 19755, 19934, 20106, 20270, 20427, 20577, 20720, 20857, 20988, 21113, 21232, 21346, 21455, 21558,\
+		21656, 21749, 21836, 21919, 21997, 22069, 22137, 22200, 22258, 22311, 22359, 22403, 22441, 22476, 22505, 22530,\
+		22550, 22565, 22576, 22582, 22583, 22580, 22571, 22557, 22538, 22514, 22485, 22450, 22409, 22363, 22312, 22255,\
+		22192}
+
+	#define csound_formants_release2 {\
+		0, 2, 52, 150, 293, 479, 705, 968, 1261, 1582, 1925, 2285, 2656, 3032, 3407, 3776,\
+		4134, 4475, 4794, 5086, 5348, 5576, 5766, 5917, 6027, 6095, 6120, 6104, 6047, 5952, 5820, 5655,\
+		5461, 5241, 4999, 4742, 4473, 4198, 3921, 3648, 3384, 3132, 2898, 2684, 2494, 2329, 2193, 2087,\
+		2010, 1962, 1943, 1951, 1985, 2040, 2115, 2206, 2309, 2421, 2537, 2653, 2767, 2874, 2973, 3060,\
+		3134, 3193, 3236, 3265, 3279, 3280, 3270, 3251, 3226, 3199, 3174, 3153, 3142, 3144, 3162, 3200,\
+		3262, 3349, 3464, 3609, 3783, 3988, 4223, 4486, 4775, 5089, 5424, 5777, 6143, 6520, 6901, 7282,\
+		7659, 8027, 8381, 8718, 9032, 9320, 9579, 9806, 9998, 10153, 10270, 10347, 10384, 10381, 10339, 10259,\
+		10142, 9990, 9805, 9591, 9350, 9087, 8805, 8508, 8201, 7888, 7576, 7267, 6969, 6686, 6423, 6185,\
+		5978, 5807, 5675, 5587, 5548, 5559, 5625, 5746, 5926, 6163, 6460, 6813, 7224, 7688, 8202, 8764,\
+		9368, 10009, 10681, 11378, 12093, 12818, 13545, 14268, 14978, 15667, 16327, 16952, 17534, 18067, 18544, 18961,\
+		19312, 19595, 19807, 19946, 20011, 20003, 19923, 19773, 19559, 19283, 18953, 18573, 18153, 17699, 17220, 16726,\
+		16227, 15730, 15247, 14786, 14357, 13969, 13628, 13342, 13117, 12959, 12871, 12855, 12914, 13046, 13251, 13525,\
+		13866, 14267, 14723, 15227, 15770, 16345, 16943, 17555, 18172, 18785, 19387, 19969, 20524, 21047, 21532, 21976,\
+		22375, 22727, 23032, 23291, 23504, 23674, 23805, 23900, 23965, 24003, 24020, 24021, 24012, 23997, 23981, 23969,\
+		23963, 23967, 23984, 24014, 24059, 24118, 24193, 24280, 24379, 24487, 24603, 24722, 24842, 24960, 25073, 25178,\
+		25271, 25350, 25413, 25458, 25482, 25485, 25466, 25424, 25360, 25273, 25166, 25039, 24894, 24733, 24558, 24373,\
+		24179}
+
+	#define csound_formants_release3 {\
+		0, 86, 402, 911, 1559, 2282, 3014, 3694, 4272, 4716, 5017, 5187, 5260, 5286, 5327, 5446,\
+		5706, 6152, 6818, 7711, 8817, 10103, 11513, 12985, 14448, 15836, 17093, 18180, 19079, 19794, 20348, 20785,\
+		21160, 21533, 21962, 22495, 23167, 23991, 24961, 26050, 27212, 28392, 29525, 30551, 31416, 32082, 32526, 32748,\
+		32767, 32618, 32351, 32022, 31685, 31391, 31178, 31068, 31064, 31154, 31307, 31483, 31632, 31707, 31664, 31469,\
+		31103, 30563, 29863, 29030, 28105, 27134, 26165, 25244, 24407, 23679, 23073, 22585, 22200, 21892, 21629, 21375,\
+		21099, 20773, 20379, 19912, 19375, 18784, 18163, 17540, 16948, 16416, 15969, 15626, 15396, 15280, 15269, 15348,\
+		15496, 15692, 15913, 16140, 16358, 16558, 16736, 16894, 17039, 17179, 17325, 17485, 17668, 17875, 18108, 18363,\
+		18633, 18910, 19185, 19449, 19695, 19920, 20121, 20301, 20463, 20613, 20757, 20901, 21049, 21204, 21365, 21531,\
+		21698, 21858, 22007, 22138, 22248, 22332, 22392, 22428, 22445, 22448, 22442, 22432, 22423, 22417, 22413, 22411,\
+		22405, 22390, 22362, 22314, 22242, 22145, 22022, 21876, 21713, 21537, 21356, 21179, 21009, 20852, 20709, 20580,\
+		20461, 20346, 20229, 20102, 19960, 19797, 19612, 19404, 19178, 18939, 18695, 18455, 18229, 18023, 17844, 17693,\
+		17570, 17472, 17391, 17319, 17247, 17166, 17069, 16951, 16811, 16650, 16474, 16290, 16108, 15937, 15788, 15667,\
+		15579, 15526, 15504, 15508, 15529, 15557, 15581, 15592, 15581, 15543, 15477, 15385, 15272, 15148, 15023, 14906,\
+		14808, 14736, 14695, 14687, 14707, 14751, 14810, 14872, 14929, 14968, 14982, 14967, 14920, 14845, 14746, 14632,\
+		14513, 14401, 14306, 14237, 14198, 14193, 14221, 14276, 14352, 14439, 14527, 14606, 14669, 14709, 14725, 14718,\
+		14691, 14653, 14614, 14582, 14570, 14585, 14635, 14724, 14852, 15018, 15214, 15433, 15665, 15901, 16132, 16351,\
+		16552}
+
+	#define csound_formants_release4 {\
+		393, 430, 556, 765, 1052, 1411, 1835, 2316, 2847, 3418, 4021, 4647, 5289, 5938, 6587, 7227,\
+		7854, 8460, 9041, 9591, 10109, 10590, 11032, 11435, 11799, 12122, 12406, 12653, 12865, 13043, 13191, 13312,\
+		13409, 13484, 13542, 13585, 13616, 13639, 13655, 13667, 13677, 13685, 13695, 13705, 13716, 13729, 13744, 13759,\
+		13775, 13791, 13805, 13818, 13828, 13836, 13840, 13840, 13836, 13829, 13818, 13804, 13788, 13770, 13752, 13733,\
+		13716, 13700, 13687, 13677, 13670, 13667, 13667, 13671, 13677, 13685, 13695, 13704, 13713, 13721, 13727, 13730,\
+		13731, 13729, 13726, 13722, 13720, 13722, 13731, 13751, 13786, 13840, 13919, 14028, 14171, 14355, 14584, 14864,\
+		15197, 15589, 16040, 16554, 17129, 17765, 18460, 19209, 20008, 20850, 21726, 22627, 23543, 24462, 25371, 26258,\
+		27109, 27910, 28648, 29310, 29882, 30354, 30715, 30956, 31070, 31050, 30893, 30598, 30165, 29596, 28897, 28074,\
+		27138, 26099, 24971, 23768, 22508, 21207, 19885, 18561, 17255, 15988, 14778, 13645, 12607, 11682, 10885, 10229,\
+		9726, 9386, 9215, 9217, 9394, 9744, 10263, 10944, 11777, 12749, 13846, 15051, 16345, 17708, 19119, 20557,\
+		21998, 23421, 24804, 26126, 27369, 28514, 29545, 30449, 31215, 31834, 32300, 32611, 32766, 32767, 32619, 32329,\
+		31908, 31365, 30714, 29968, 29142, 28252, 27312, 26339, 25347, 24350, 23361, 22392, 21453, 20555, 19703, 18905,\
+		18165, 17485, 16867, 16312, 15818, 15384, 15007, 14682, 14407, 14177, 13987, 13833, 13711, 13615, 13542, 13488,\
+		13450, 13425, 13409, 13402, 13401, 13405, 13412, 13421, 13433, 13446, 13459, 13474, 13490, 13506, 13523, 13540,\
+		13558, 13576, 13594, 13613, 13633, 13652, 13672, 13691, 13710, 13729, 13747, 13765, 13783, 13799, 13815, 13831,\
+		13846, 13861, 13875, 13891, 13907, 13924, 13944, 13967, 13993, 14024, 14061, 14105, 14157, 14219, 14292, 14378,\
+		14477}
+
+	#define csound_formants_release5 {\
+		0, 290, 999, 2011, 3183, 4360, 5391, 6151, 6549, 6545, 6147, 5415, 4452, 3391, 2382, 1571,\
+		1089, 1033, 1458, 2372, 3731, 5453, 7419, 9494, 11536, 13415, 15028, 16305, 17219, 17784, 18058, 18126,\
+		18097, 18086, 18202, 18536, 19150, 20070, 21285, 22750, 24388, 26103, 27789, 29340, 30666, 31697, 32392, 32741,\
+		32767, 32516, 32057, 31471, 30839, 30238, 29727, 29350, 29122, 29040, 29076, 29187, 29319, 29416, 29424, 29300,\
+		29014, 28552, 27917, 27132, 26227, 25244, 24229, 23227, 22276, 21407, 20642, 19989, 19448, 19009, 18657, 18372,\
+		18136, 17930, 17740, 17558, 17378, 17199, 17024, 16856, 16700, 16556, 16427, 16309, 16200, 16093, 15983, 15862,\
+		15728, 15576, 15409, 15228, 15039, 14849, 14664, 14492, 14338, 14203, 14088, 13988, 13899, 13813, 13721, 13617,\
+		13494, 13349, 13183, 12997, 12798, 12595, 12395, 12210, 12046, 11911, 11808, 11736, 11694, 11675, 11672, 11678,\
+		11683, 11681, 11668, 11641, 11602, 11555, 11506, 11463, 11434, 11428, 11452, 11510, 11606, 11739, 11907, 12106,\
+		12329, 12569, 12820, 13075, 13329, 13578, 13821, 14056, 14285, 14510, 14734, 14961, 15194, 15436, 15691, 15961,\
+		16246, 16546, 16862, 17191, 17528, 17871, 18214, 18549, 18871, 19173, 19449, 19693, 19901, 20071, 20205, 20306,\
+		20379, 20431, 20472, 20512, 20558, 20619, 20697, 20796, 20910, 21034, 21156, 21266, 21348, 21389, 21379, 21310,\
+		21179, 20990, 20751, 20476, 20181, 19887, 19613, 19376, 19189, 19058, 18984, 18959, 18969, 18996, 19018, 19011,\
+		18956, 18838, 18647, 18384, 18056, 17679, 17275, 16870, 16491, 16163, 15904, 15727, 15635, 15620, 15666, 15749,\
+		15841, 15912, 15933, 15881, 15741, 15509, 15188, 14795, 14353, 13891, 13442, 13036, 12697, 12444, 12284, 12213,\
+		12218, 12277, 12359, 12434, 12470, 12441, 12329, 12126, 11833, 11463, 11040, 10593, 10155, 9757, 9430, 9195,\
+		9064}
+
+	#define csound_formants_release6 {\
+		0, 198, 943, 2139, 3649, 5309, 6954, 8427, 9606, 10406, 10795, 10787, 10444, 9862, 9158, 8455,\
+		7868, 7487, 7371, 7540, 7974, 8617, 9390, 10194, 10933, 11520, 11890, 12009, 11880, 11539, 11052, 10509,\
+		10011, 9655, 9530, 9699, 10192, 11006, 12101, 13405, 14823, 16243, 17554, 18653, 19455, 19908, 19990, 19719,\
+		19144, 18343, 17416, 16470, 15614, 14943, 14533, 14431, 14654, 15186, 15983, 16978, 18086, 19218, 20286, 21213,\
+		21941, 22436, 22686, 22707, 22536, 22224, 21836, 21434, 21078, 20816, 20678, 20677, 20803, 21031, 21321, 21624,\
+		21890, 22074, 22140, 22070, 21862, 21533, 21119, 20666, 20230, 19870, 19635, 19564, 19680, 19982, 20448, 21036,\
+		21684, 22324, 22878, 23276, 23459, 23387, 23044, 22438, 21606, 20607, 19517, 18422, 17409, 16558, 15931, 15568,\
+		15483, 15660, 16058, 16613, 17246, 17873, 18411, 18790, 18959, 18890, 18584, 18067, 17386, 16605, 15797, 15032,\
+		14374, 13867, 13536, 13382, 13379, 13487, 13647, 13797, 13877, 13837, 13645, 13290, 12787, 12170, 11494, 10824,\
+		10229, 9773, 9504, 9450, 9616, 9978, 10488, 11081, 11676, 12192, 12555, 12705, 12605, 12247, 11651, 10865,\
+		9959, 9015, 8122, 7364, 6811, 6508, 6476, 6706, 7162, 7783, 8496, 9219, 9874, 10395, 10735, 10871,\
+		10805, 10565, 10198, 9766, 9334, 8966, 8713, 8611, 8671, 8886, 9226, 9645, 10090, 10502, 10832, 11041,\
+		11109, 11038, 10847, 10576, 10278, 10009, 9827, 9780, 9901, 10202, 10677, 11295, 12011, 12767, 13499, 14145,\
+		14654, 14989, 15134, 15093, 14890, 14568, 14180, 13786, 13444, 13205, 13105, 13163, 13383, 13747, 14225, 14775,\
+		15352, 15909, 16406, 16816, 17122, 17321, 17425, 17455, 17438, 17406, 17387, 17403, 17469, 17589, 17756, 17956,\
+		18170, 18374, 18546, 18670, 18733, 18734, 18680, 18584, 18465, 18348, 18254, 18203, 18210, 18282, 18416, 18605,\
+		18834}
+
+	#define csound_formants_release7 {\
+		0, 206, 817, 1751, 2913, 4196, 5498, 6728, 7813, 8702, 9371, 9820, 10071, 10165, 10155, 10096,\
+		10044, 10046, 10136, 10330, 10629, 11014, 11452, 11898, 12302, 12615, 12794, 12806, 12637, 12291, 11795, 11191,\
+		10542, 9921, 9407, 9075, 8995, 9218, 9773, 10663, 11863, 13320, 14957, 16678, 18374, 19936, 21259, 22257,\
+		22866, 23050, 22809, 22176, 21212, 20007, 18666, 17304, 16032, 14950, 14138, 13648, 13501, 13688, 14168, 14876,\
+		15731, 16643, 17525, 18298, 18901, 19298, 19475, 19447, 19249, 18932, 18558, 18189, 17880, 17673, 17590, 17632,\
+		17777, 17983, 18196, 18354, 18392, 18258, 17913, 17338, 16540, 15551, 14423, 13228, 12049, 10971, 10075, 9428,\
+		9077, 9044, 9322, 9881, 10663, 11593, 12586, 13549, 14397, 15054, 15464, 15592, 15428, 14985, 14299, 13424,\
+		12425, 11373, 10337, 9381, 8558, 7904, 7439, 7169, 7079, 7147, 7339, 7617, 7941, 8278, 8597, 8877,\
+		9108, 9287, 9422, 9526, 9615, 9710, 9828, 9983, 10183, 10430, 10718, 11034, 11358, 11666, 11932, 12132,\
+		12242, 12247, 12136, 11912, 11584, 11175, 10716, 10244, 9803, 9437, 9188, 9094, 9180, 9462, 9940, 10599,\
+		11411, 12333, 13313, 14293, 15215, 16023, 16669, 17119, 17353, 17370, 17186, 16830, 16347, 15789, 15213, 14673,\
+		14217, 13883, 13694, 13657, 13764, 13994, 14313, 14684, 15064, 15415, 15707, 15919, 16043, 16084, 16057, 15990,\
+		15912, 15855, 15847, 15909, 16050, 16268, 16547, 16861, 17173, 17444, 17632, 17702, 17627, 17393, 17000, 16464,\
+		15814, 15092, 14347, 13631, 12995, 12481, 12124, 11942, 11939, 12103, 12409, 12819, 13291, 13777, 14231, 14615,\
+		14896, 15054, 15079, 14975, 14754, 14437, 14050, 13621, 13177, 12744, 12340, 11979, 11669, 11412, 11205, 11040,\
+		10911, 10808, 10725, 10655, 10596, 10548, 10510, 10487, 10482, 10500, 10543, 10615, 10715, 10843, 10995, 11166,\
+		11351}
+
+	#define csound_formants_release8 {\
+		0, 50, 851, 2365, 4490, 7066, 9902, 12788, 15525, 17940, 19909, 21362, 22293, 22755, 22849, 22713,\
+		22501, 22362, 22427, 22787, 23488, 24523, 25836, 27327, 28866, 30310, 31518, 32367, 32767, 32668, 32069, 31012,\
+		29579, 27883, 26053, 24220, 22504, 21006, 19794, 18901, 18326, 18038, 17981, 18084, 18274, 18479, 18646, 18736,\
+		18734, 18646, 18496, 18319, 18155, 18045, 18018, 18093, 18272, 18542, 18875, 19233, 19577, 19864, 20063, 20152,\
+		20123, 19984, 19757, 19474, 19172, 18892, 18668, 18526, 18480, 18530, 18662, 18853, 19069, 19276, 19440, 19535,\
+		19543, 19458, 19290, 19055, 18783, 18506, 18257, 18066, 17955, 17936, 18008, 18160, 18371, 18612, 18851, 19059,\
+		19209, 19283, 19275, 19186, 19028, 18823, 18595, 18370, 18174, 18025, 17934, 17906, 17932, 18000, 18089, 18177,\
+		18243, 18267, 18237, 18147, 18001, 17808, 17585, 17353, 17133, 16945, 16804, 16723, 16703, 16742, 16832, 16958,\
+		17105, 17257, 17402, 17530, 17637, 17724, 17798, 17867, 17945, 18042, 18168, 18330, 18530, 18763, 19021, 19294,\
+		19566, 19822, 20051, 20241, 20388, 20489, 20549, 20575, 20577, 20565, 20551, 20540, 20537, 20540, 20545, 20542,\
+		20521, 20470, 20378, 20238, 20045, 19803, 19519, 19204, 18874, 18548, 18242, 17973, 17752, 17585, 17471, 17407,\
+		17379, 17375, 17379, 17374, 17349, 17294, 17209, 17095, 16963, 16826, 16702, 16608, 16561, 16573, 16652, 16797,\
+		17002, 17253, 17533, 17819, 18089, 18321, 18498, 18608, 18647, 18617, 18529, 18398, 18245, 18091, 17958, 17863,\
+		17820, 17834, 17905, 18026, 18181, 18353, 18522, 18668, 18773, 18826, 18819, 18755, 18642, 18494, 18333, 18182,\
+		18063, 17999, 18007, 18099, 18277, 18537, 18867, 19247, 19654, 20060, 20440, 20767, 21024, 21198, 21283, 21284,\
+		21211, 21083, 20922, 20750, 20592, 20466, 20385, 20356, 20376, 20434, 20510, 20580, 20618, 20594, 20486, 20274,\
+		19950}
+
+	#define new_perlin_slope0 {\
+		0, 127, 255, 382, 509, 635, 762, 888, 1014, 1139, 1265, 1390, 1514, 1639, 1763, 1886,\
+		2010, 2134, 2257, 2380, 2505, 2631, 2757, 2883, 3009, 3135, 3262, 3389, 3516, 3644, 3772, 3900,\
+		4028, 4157, 4286, 4416, 4546, 4676, 4806, 4938, 5069, 5201, 5333, 5466, 5599, 5733, 5867, 6001,\
+		6136, 6272, 6408, 6544, 6681, 6818, 6956, 7094, 7233, 7372, 7512, 7652, 7793, 7934, 8075, 8217,\
+		8360, 8503, 8646, 8790, 8934, 9078, 9223, 9369, 9514, 9660, 9807, 9954, 10101, 10249, 10396, 10545,\
+		10693, 10842, 10991, 11140, 11290, 11440, 11590, 11740, 11890, 12041, 12191, 12342, 12493, 12644, 12795, 12946,\
+		13097, 13248, 13399, 13550, 13701, 13852, 14002, 14153, 14303, 14453, 14603, 14753, 14902, 15051, 15200, 15348,\
+		15496, 15643, 15790, 15937, 16083, 16228, 16373, 16517, 16661, 16803, 16946, 17087, 17227, 17367, 17506, 17643,\
+		17780, 17916, 18052, 18187, 18322, 18457, 18591, 18724, 18857, 18990, 19123, 19255, 19386, 19517, 19648, 19778,\
+		19908, 20038, 20167, 20296, 20424, 20552, 20679, 20806, 20933, 21059, 21185, 21311, 21436, 21561, 21685, 21809,\
+		21933, 22056, 22179, 22301, 22423, 22545, 22667, 22788, 22908, 23029, 23149, 23268, 23388, 23507, 23625, 23744,\
+		23862, 23979, 24097, 24214, 24330, 24447, 24563, 24679, 24794, 24909, 25024, 25139, 25254, 25368, 25482, 25595,\
+		25709, 25822, 25935, 26047, 26160, 26272, 26384, 26496, 26607, 26719, 26830, 26941, 27052, 27163, 27273, 27384,\
+		27494, 27604, 27714, 27824, 27933, 28043, 28153, 28262, 28371, 28480, 28590, 28699, 28808, 28917, 29026, 29134,\
+		29243, 29352, 29461, 29570, 29679, 29788, 29896, 30005, 30114, 30223, 30332, 30442, 30551, 30660, 30747, 30836,\
+		30927, 31021, 31116, 31213, 31312, 31412, 31515, 31620, 31726, 31834, 31945, 32056, 32170, 32285, 32402, 32520,\
+		32767}
+
+	#define new_perlin_slope1 {\
+		0, 241, 455, 641, 800, 933, 1040, 1122, 1179, 1213, 1223, 1210, 1176, 1121, 1045, 950,\
+		836, 704, 555, 390, 327, 270, 217, 170, 129, 93, 63, 39, 20, 7, 1, 0,\
+		5, 17, 35, 59, 89, 126, 168, 218, 273, 335, 404, 479, 560, 648, 742, 843,\
+		950, 1063, 1183, 1309, 1442, 1581, 1726, 1877, 2035, 2199, 2369, 2545, 2727, 2915, 3109, 3308,\
+		3514, 3725, 3941, 4163, 4391, 4624, 4862, 5105, 5353, 5606, 5864, 6126, 6393, 6665, 6941, 7220,\
+		7504, 7792, 8084, 8379, 8677, 8979, 9284, 9592, 9902, 10215, 10531, 10849, 11169, 11490, 11814, 12138,\
+		12464, 12792, 13120, 13448, 13777, 14106, 14436, 14764, 15093, 15420, 15747, 16073, 16396, 16719, 17039, 17357,\
+		17672, 17985, 18294, 18600, 18903, 19202, 19496, 19786, 20071, 20351, 20625, 20894, 21157, 21413, 21663, 21906,\
+		22141, 22371, 22598, 22822, 23042, 23259, 23473, 23684, 23892, 24097, 24298, 24496, 24691, 24883, 25072, 25258,\
+		25440, 25620, 25796, 25969, 26140, 26307, 26471, 26632, 26790, 26945, 27096, 27245, 27391, 27534, 27674, 27811,\
+		27946, 28077, 28205, 28331, 28454, 28574, 28691, 28805, 28917, 29026, 29133, 29236, 29337, 29436, 29532, 29625,\
+		29716, 29804, 29890, 29974, 30055, 30134, 30210, 30285, 30357, 30426, 30494, 30559, 30623, 30684, 30743, 30801,\
+		30856, 30910, 30961, 31011, 31059, 31105, 31150, 31193, 31235, 31274, 31313, 31350, 31385, 31420, 31453, 31484,\
+		31515, 31544, 31573, 31600, 31626, 31651, 31676, 31700, 31723, 31745, 31767, 31788, 31808, 31828, 31848, 31867,\
+		31886, 31905, 31924, 31943, 31961, 31980, 31999, 32018, 32037, 32057, 32077, 32097, 32118, 32140, 32067, 32005,\
+		31955, 31917, 31890, 31875, 31871, 31878, 31897, 31926, 31965, 32016, 32076, 32147, 32227, 32317, 32416, 32524,\
+		32767}
+
+	#define new_perlin_slope2 {\
+		0, 239, 490, 770, 1096, 1477, 1923, 2440, 3030, 3695, 4432, 5235, 6099, 7012, 7961, 8933,\
+		9909, 10869, 11791, 12650, 12877, 12986, 12968, 12810, 12503, 12035, 11397, 10576, 9575, 8520, 7466, 6433,\
+		5437, 4494, 3617, 2820, 2113, 1504, 1001, 610, 336, 179, 142, 223, 421, 730, 1145, 1660,\
+		2265, 2949, 3700, 4505, 5347, 6211, 7076, 7924, 8730, 9473, 10127, 10665, 11058, 11276, 11448, 11777,\
+		12233, 12789, 13422, 14109, 14831, 15567, 16301, 17015, 17695, 18328, 18902, 19405, 19830, 20168, 20412, 20559,\
+		20604, 20547, 20385, 20121, 19756, 19295, 18742, 18105, 17391, 16609, 15772, 14891, 13980, 13054, 12130, 11211,\
+		10212, 9142, 8033, 6915, 5814, 4755, 3761, 2851, 2043, 1353, 794, 377, 110, 0, 51, 265,\
+		640, 1175, 1865, 2700, 3673, 4771, 5980, 7283, 8661, 10093, 11556, 13024, 14469, 15860, 17166, 18350,\
+		19377, 20270, 21082, 21813, 22464, 23035, 23528, 23945, 24289, 24562, 24767, 24908, 24988, 25012, 24984, 24910,\
+		24794, 24643, 24463, 24259, 24041, 23814, 23586, 23366, 23162, 22982, 22837, 22736, 22689, 22706, 22799, 22978,\
+		23255, 23642, 24145, 24727, 25365, 26043, 26744, 27453, 28157, 28843, 29499, 30115, 30682, 31193, 31640, 32017,\
+		32322, 32549, 32698, 32768, 32759, 32671, 32510, 32277, 31978, 31620, 31209, 30755, 30268, 29757, 29236, 28717,\
+		28216, 27748, 27329, 26975, 26645, 26311, 25981, 25665, 25369, 25101, 24865, 24668, 24514, 24406, 24348, 24342,\
+		24389, 24490, 24645, 24854, 25114, 25424, 25781, 26180, 26618, 27089, 27588, 28107, 28639, 29176, 29709, 30228,\
+		30724, 31184, 31596, 31949, 32229, 32407, 32436, 32333, 32119, 31813, 31433, 30998, 30523, 30024, 29559, 29164,\
+		28850, 28623, 28486, 28439, 28480, 28605, 28808, 29078, 29408, 29784, 30195, 30628, 31069, 31505, 31921, 32304,\
+		32767}
+
+	#define new_perlin_slope3 {\
+		0, 162, 418, 804, 1355, 2095, 3005, 3952, 4885, 5762, 6550, 7221, 7756, 8145, 8383, 8479,\
+		8447, 8314, 8116, 7899, 7464, 7183, 7106, 7286, 7777, 8634, 9914, 11549, 13387, 15306, 17200, 18976,\
+		20556, 21877, 22889, 23557, 23861, 23794, 23364, 22593, 21519, 20191, 18676, 17053, 15416, 13874, 12548, 11563,\
+		10931, 10611, 10559, 10734, 11095, 11602, 12215, 12894, 13602, 14302, 14955, 15527, 15981, 16283, 16400, 16296,\
+		15940, 15300, 14345, 13065, 11700, 10375, 9143, 8047, 7124, 6401, 5898, 5627, 5590, 5782, 6182, 6766,\
+		7506, 8362, 9290, 10234, 11133, 11914, 12498, 12798, 13020, 13513, 14201, 15012, 15882, 16752, 17574, 18304,\
+		18908, 19355, 19627, 19709, 19596, 19287, 18792, 18127, 17313, 16383, 15372, 14327, 13271, 12073, 10787, 9503,\
+		8296, 7231, 6362, 5732, 5370, 5298, 5523, 6042, 6841, 7893, 9163, 10600, 12146, 13729, 15267, 16665,\
+		17819, 18738, 19508, 20132, 20615, 20961, 21179, 21279, 21272, 21173, 20997, 20762, 20487, 20194, 19906, 19648,\
+		19448, 19335, 19340, 19496, 19838, 20388, 21073, 21832, 22616, 23382, 24093, 24718, 25232, 25615, 25854, 25941,\
+		25874, 25659, 25303, 24825, 24245, 23592, 22898, 22203, 21554, 21000, 20486, 19973, 19490, 19059, 18700, 18428,\
+		18256, 18192, 18240, 18400, 18669, 19037, 19490, 20013, 20585, 21184, 21780, 22344, 22840, 23229, 23443, 23404,\
+		23163, 22780, 22307, 21790, 21274, 20795, 20386, 20073, 19878, 19819, 19908, 20150, 20547, 21097, 21790, 22612,\
+		23544, 24563, 25641, 26775, 27926, 29038, 30064, 30963, 31703, 32261, 32619, 32768, 32708, 32444, 31991, 31372,\
+		30616, 29760, 28850, 27939, 27088, 26365, 25847, 25452, 24853, 24103, 23271, 22418, 21596, 20852, 20757, 20872,\
+		21196, 21714, 22404, 23235, 24172, 25179, 26215, 27243, 28226, 29134, 29943, 30635, 31200, 31656, 32032, 32352,\
+		32767}
+
+	#define new_perlin_slope4 {\
+		0, 664, 1221, 1638, 1893, 1958, 1831, 1559, 1215, 882, 647, 591, 779, 1254, 2022, 3047,\
+		4241, 5456, 6477, 7238, 7512, 7584, 7504, 7322, 7087, 6847, 6649, 6537, 6556, 6749, 7159, 7827,\
+		8624, 8621, 7929, 6826, 5560, 4339, 3338, 2696, 2517, 2870, 3788, 5268, 7274, 9762, 12342, 14121,\
+		15135, 15490, 15298, 14686, 13787, 12746, 11717, 10864, 10363, 10397, 11160, 12858, 15484, 18539, 21606, 24348,\
+		26503, 27887, 28392, 27985, 26711, 24690, 22120, 19276, 16505, 14237, 12813, 12160, 12128, 12568, 13339, 14298,\
+		15311, 16245, 16970, 17361, 17297, 16658, 15331, 13245, 10983, 8903, 7168, 5896, 5162, 4997, 5385, 6269,\
+		7544, 9064, 10636, 12023, 12945, 13368, 14304, 15640, 17133, 18577, 19808, 20699, 21164, 21155, 20664, 19722,\
+		18398, 16802, 15082, 13229, 11100, 8999, 7183, 5849, 5135, 5116, 5809, 7170, 9094, 11414, 13907, 16285,\
+		18202, 19579, 20603, 21287, 21655, 21739, 21582, 21240, 20777, 20266, 19792, 19451, 19347, 19597, 20320, 21420,\
+		22670, 23904, 24989, 25820, 26327, 26470, 26240, 25660, 24784, 23698, 22519, 21395, 20464, 19562, 18721, 18021,\
+		17522, 17262, 17260, 17513, 17999, 18676, 19479, 20326, 21112, 21713, 21931, 21598, 20906, 20041, 19167, 18417,\
+		17898, 17688, 17839, 18376, 19296, 20567, 22133, 23906, 25821, 27769, 29560, 31044, 32112, 32695, 32768, 32345,\
+		31481, 30275, 28864, 27429, 26191, 25407, 24548, 23294, 21883, 20519, 19363, 18539, 18132, 18188, 18713, 19675,\
+		21005, 22590, 24284, 25891, 27146, 28001, 28472, 28594, 28411, 27981, 27374, 26668, 25955, 25338, 24931, 24858,\
+		25258, 26196, 27269, 28301, 29199, 29892, 30333, 30500, 30392, 30033, 29468, 28768, 28026, 27358, 27085, 27203,\
+		27655, 28289, 28984, 29653, 30237, 30703, 31039, 31251, 31357, 31390, 31385, 31384, 31428, 31494, 31648, 32017,\
+		32767}
+
+	#define new_perlin_slope5 {\
+		0, 603, 1330, 2032, 2577, 2884, 2945, 2852, 2832, 3266, 4382, 5893, 7532, 9014, 10076, 10512,\
+		10207, 9178, 7608, 5880, 4147, 2745, 1826, 1466, 1653, 2297, 3232, 4215, 4926, 4989, 5205, 5906,\
+		6782, 7586, 8132, 8299, 8026, 7314, 6228, 4884, 3279, 1722, 555, 0, 164, 1034, 2481, 4258,\
+		6001, 7248, 7918, 8169, 8121, 7892, 7595, 7340, 7234, 7383, 7929, 8777, 8420, 7114, 5479, 4014,\
+		3105, 3017, 3899, 5784, 8586, 11846, 13880, 14628, 14357, 13370, 12002, 10621, 9628, 9459, 10580, 13351,\
+		16983, 20476, 23105, 24402, 24155, 22406, 19453, 15847, 12398, 10092, 9179, 9308, 10131, 11305, 12489, 13369,\
+		13646, 13029, 11239, 8442, 5829, 3845, 2740, 2620, 3443, 5015, 6998, 8904, 10098, 10880, 12502, 14400,\
+		16098, 17251, 17645, 17199, 15959, 14108, 11955, 9493, 6797, 4529, 3154, 2935, 3934, 6012, 8826, 11833,\
+		14289, 15865, 16844, 17270, 17223, 16817, 16201, 15556, 15098, 15079, 15782, 17156, 18705, 20069, 20990, 21317,\
+		21002, 20102, 18782, 17307, 16039, 14900, 13889, 13177, 12868, 12996, 13527, 14361, 15327, 16188, 16622, 16160,\
+		15101, 13887, 12864, 12289, 12328, 13046, 14420, 16333, 18593, 21012, 23180, 24754, 25530, 25438, 24551, 23074,\
+		21355, 19875, 19034, 17685, 16023, 14522, 13525, 13245, 13766, 15040, 16890, 19009, 20932, 22183, 22756, 22733,\
+		22233, 21416, 20477, 19652, 19212, 19470, 20582, 21828, 22885, 23571, 23789, 23523, 22832, 21855, 20810, 19990,\
+		19747, 20094, 20760, 21513, 22166, 22577, 22652, 22343, 21647, 20607, 18908, 16206, 13372, 11107, 9890, 9983,\
+		11427, 14045, 17438, 20990, 24420, 27837, 30619, 32336, 32768, 31906, 29950, 27314, 24613, 22679, 21889, 21139,\
+		20713, 20755, 21292, 22259, 23524, 24914, 26238, 27315, 28236, 29095, 29818, 30390, 30843, 31233, 31628, 32085,\
+		32767}
+
+	#define new_perlin_slope6 {\
+		0, 684, 997, 873, 563, 470, 976, 2279, 4223, 6123, 7250, 7606, 7380, 6913, 6694, 7366,\
+		9721, 13640, 17660, 20606, 20728, 18929, 15846, 12708, 10252, 6647, 3389, 1718, 2223, 4842, 8861, 12922,\
+		15870, 17398, 17436, 16200, 14211, 12280, 11495, 12764, 14859, 16668, 17508, 17078, 15454, 13093, 10812, 9032,\
+		7951, 7744, 8378, 9607, 10977, 11822, 12104, 13123, 14344, 15293, 15668, 15334, 14330, 12845, 10992, 9418,\
+		8678, 9005, 10314, 12227, 14052, 15022, 15303, 15153, 14817, 14527, 14508, 14977, 15956, 15311, 13492, 11659,\
+		10647, 10975, 12836, 16105, 19245, 20285, 19724, 18194, 16417, 15207, 15468, 18110, 22248, 25904, 27801, 27356,\
+		24686, 20604, 16609, 14496, 14263, 15186, 16567, 17742, 18078, 16974, 14065, 11063, 9094, 8584, 9554, 11620,\
+		13996, 15488, 16716, 18887, 20914, 22063, 21959, 20587, 18289, 15576, 12389, 9874, 8909, 9817, 12373, 15800,\
+		18770, 20460, 21246, 21258, 20715, 19933, 19321, 19380, 20592, 22377, 23915, 24699, 24507, 23406, 21748, 20171,\
+		18842, 17772, 17258, 17411, 18155, 19228, 20179, 20285, 19170, 17692, 16568, 16262, 16986, 18703, 21126, 23861,\
+		26157, 27387, 27304, 26037, 24092, 22349, 21288, 19475, 17740, 16815, 17075, 18540, 20871, 23373, 25027, 25635,\
+		25376, 24538, 23508, 22783, 22960, 24314, 25681, 26554, 26706, 26123, 25003, 23760, 23020, 23236, 23978, 24771,\
+		25261, 25233, 24593, 23378, 21183, 17763, 14750, 13266, 13835, 16380, 20225, 24177, 28147, 31305, 32768, 32226,\
+		29945, 26767, 24108, 22659, 21181, 20191, 20020, 20739, 22154, 23811, 25080, 26317, 27379, 27952, 27894, 27249,\
+		26250, 25306, 24328, 22908, 21705, 21153, 21443, 22520, 24085, 25648, 27112, 28156, 28522, 28160, 27392, 26551,\
+		26151, 26525, 27291, 28098, 28742, 29136, 29285, 29261, 29248, 29725, 30422, 31074, 31559, 31864, 32060, 32270,\
+		32767}
+
+	#define new_perlin_slope7 {\
+		0, 728, 1690, 2627, 3202, 3238, 2811, 1706, 753, 842, 2382, 4918, 7249, 9154, 10007, 9552,\
+		8177, 7121, 8305, 11077, 12900, 12905, 10819, 7302, 4710, 4274, 5432, 7255, 8448, 7365, 3890, 811,\
+		0, 1970, 5875, 9481, 10553, 9767, 8260, 7188, 7727, 10799, 14474, 16486, 15902, 13057, 9546, 6621,\
+		2701, 159, 363, 3283, 7489, 10736, 12214, 11847, 10168, 8329, 8100, 10125, 12291, 13293, 12636, 10642,\
+		8432, 6856, 6255, 6767, 8081, 9430, 9829, 10736, 11896, 12548, 12317, 11221, 9519, 7665, 6718, 7178,\
+		8857, 10878, 11956, 12117, 11803, 11418, 11346, 11954, 12004, 10132, 8266, 7715, 9101, 12353, 14804, 14764,\
+		13233, 11403, 10664, 12574, 16717, 20021, 20642, 18248, 14009, 10558, 9767, 10677, 12115, 12975, 12220, 9284,\
+		6592, 5567, 6484, 8751, 10905, 12054, 14266, 16088, 16487, 15203, 12747, 9673, 6800, 5810, 7236, 10425,\
+		13545, 15111, 15540, 15111, 14308, 13811, 14492, 16254, 17744, 18161, 17322, 15659, 14129, 12866, 12210, 12410,\
+		13313, 14368, 14541, 13259, 11833, 11260, 11997, 13959, 16605, 18942, 19897, 19170, 17264, 15485, 14164, 12254,\
+		11163, 11609, 13542, 16151, 17910, 18335, 17773, 16795, 16198, 16974, 18499, 19481, 19516, 18657, 17416, 16759,\
+		17215, 18027, 18538, 18364, 17393, 15442, 11951, 9267, 8945, 11257, 15193, 19153, 22617, 24011, 22820, 19767,\
+		16809, 15211, 13771, 13239, 13869, 15355, 16827, 18029, 19058, 19419, 19002, 18083, 17289, 16111, 14924, 14540,\
+		15246, 16803, 18503, 19996, 20777, 20578, 19579, 18404, 18030, 18477, 19082, 19386, 19142, 18314, 17564, 18130,\
+		19153, 19858, 19709, 18409, 16608, 15820, 16118, 17192, 18382, 18679, 17872, 17141, 16996, 17589, 19328, 20898,\
+		20612, 19596, 19367, 20518, 22924, 26048, 29604, 31851, 32104, 30870, 29329, 28711, 29032, 29915, 30974, 31905,\
+		32767}
+
+	#define new_perlin_slope8 {\
+		0, 728, 1690, 2627, 3202, 3238, 2811, 1706, 753, 842, 2382, 4918, 7249, 9154, 10007, 9552,\
+		8177, 7121, 8305, 11077, 12900, 12905, 10819, 7302, 4710, 4274, 5432, 7255, 8448, 7365, 3890, 811,\
+		0, 1970, 5875, 9481, 10553, 9767, 8260, 7188, 7727, 10799, 14474, 16486, 15902, 13057, 9546, 6621,\
+		2701, 159, 363, 3283, 7489, 10736, 12214, 11847, 10168, 8329, 8100, 10125, 12291, 13293, 12636, 10642,\
+		8432, 6856, 6255, 6767, 8081, 9430, 9829, 10736, 11896, 12548, 12317, 11221, 9519, 7665, 6718, 7178,\
+		8857, 10878, 11956, 12117, 11803, 11418, 11346, 11954, 12004, 10132, 8266, 7715, 9101, 12353, 14804, 14764,\
+		13233, 11403, 10664, 12574, 16717, 20021, 20642, 18248, 14009, 10558, 9767, 10677, 12115, 12975, 12220, 9284,\
+		6592, 5567, 6484, 8751, 10905, 12054, 14266, 16088, 16487, 15203, 12747, 9673, 6800, 5810, 7236, 10425,\
+		13545, 15111, 15540, 15111, 14308, 13811, 14492, 16254, 17744, 18161, 17322, 15659, 14129, 12866, 12210, 12410,\
+		13313, 14368, 14541, 13259, 11833, 11260, 11997, 13959, 16605, 18942, 19897, 19170, 17264, 15485, 14164, 12254,\
+		11163, 11609, 13542, 16151, 17910, 18335, 17773, 16795, 16198, 16974, 18499, 19481, 19516, 18657, 17416, 16759,\
+		17215, 18027, 18538, 18364, 17393, 15442, 11951, 9267, 8945, 11257, 15193, 19153, 22617, 24011, 22820, 19767,\
+		16809, 15211, 13771, 13239, 13869, 15355, 16827, 18029, 19058, 19419, 19002, 18083, 17289, 16111, 14924, 14540,\
+		15246, 16803, 18503, 19996, 20777, 20578, 19579, 18404, 18030, 18477, 19082, 19386, 19142, 18314, 17564, 18130,\
+		19153, 19858, 19709, 18409, 16608, 15820, 16118, 17192, 18382, 18679, 17872, 17141, 16996, 17589, 19328, 20898,\
+		20612, 19596, 19367, 20518, 22924, 26048, 29604, 31851, 32104, 30870, 29329, 28711, 29032, 29915, 30974, 31905,\
+		32767}
+
+	#define new_perlin_slope_20 {\
+		0, 127, 252, 376, 499, 620, 740, 858, 975, 1091, 1205, 1318, 1429, 1539, 1647, 1754,\
+		1859, 1962, 2063, 2163, 2275, 2387, 2499, 2610, 2721, 2832, 2942, 3052, 3161, 3270, 3379, 3487,\
+		3595, 3702, 3809, 3915, 4021, 4127, 4232, 4336, 4440, 4543, 4646, 4749, 4851, 4952, 5053, 5154,\
+		5254, 5353, 5452, 5550, 5648, 5746, 5843, 5939, 6035, 6131, 6226, 6321, 6415, 6509, 6602, 6695,\
+		6787, 6879, 6971, 7062, 7153, 7244, 7334, 7425, 7514, 7604, 7693, 7782, 7871, 7959, 8048, 8136,\
+		8224, 8312, 8400, 8487, 8575, 8663, 8751, 8838, 8926, 9014, 9102, 9190, 9279, 9367, 9456, 9545,\
+		9634, 9724, 9814, 9904, 9995, 10087, 10178, 10271, 10364, 10457, 10551, 10646, 10742, 10838, 10935, 11033,\
+		11132, 11232, 11333, 11435, 11538, 11642, 11747, 11853, 11961, 12070, 12180, 12292, 12405, 12520, 12636, 12754,\
+		12873, 12994, 13117, 13242, 13369, 13497, 13627, 13758, 13891, 14026, 14162, 14299, 14438, 14578, 14720, 14862,\
+		15006, 15152, 15298, 15445, 15594, 15743, 15894, 16045, 16198, 16351, 16505, 16660, 16816, 16972, 17130, 17288,\
+		17446, 17605, 17765, 17926, 18087, 18248, 18410, 18573, 18736, 18899, 19063, 19227, 19391, 19556, 19721, 19886,\
+		20051, 20217, 20383, 20549, 20715, 20881, 21047, 21213, 21380, 21546, 21713, 21879, 22046, 22212, 22378, 22545,\
+		22711, 22877, 23043, 23209, 23374, 23540, 23705, 23870, 24035, 24200, 24364, 24529, 24693, 24856, 25020, 25183,\
+		25346, 25508, 25671, 25833, 25994, 26156, 26317, 26477, 26638, 26798, 26957, 27116, 27275, 27434, 27592, 27750,\
+		27907, 28064, 28221, 28377, 28533, 28689, 28844, 28999, 29153, 29308, 29461, 29615, 29768, 29921, 30087, 30251,\
+		30412, 30570, 30726, 30879, 31029, 31176, 31321, 31464, 31604, 31741, 31876, 32009, 32140, 32268, 32395, 32519,\
+		32767}
+
+	#define new_perlin_slope_21 {\
+		0, 143, 317, 521, 754, 1015, 1303, 1617, 1955, 2317, 2701, 3106, 3531, 3975, 4437, 4915,\
+		5407, 5913, 6431, 6961, 7252, 7535, 7809, 8075, 8333, 8583, 8823, 9055, 9279, 9493, 9699, 9897,\
+		10085, 10265, 10435, 10597, 10751, 10895, 11031, 11157, 11275, 11385, 11485, 11577, 11660, 11735, 11801, 11859,\
+		11908, 11949, 11981, 12006, 12022, 12030, 12030, 12023, 12007, 11985, 11954, 11916, 11871, 11819, 11760, 11694,\
+		11621, 11542, 11456, 11364, 11266, 11162, 11052, 10937, 10817, 10691, 10560, 10425, 10285, 10141, 9993, 9840,\
+		9685, 9525, 9363, 9198, 9030, 8859, 8687, 8512, 8336, 8159, 7981, 7801, 7622, 7442, 7263, 7083,\
+		6905, 6728, 6552, 6378, 6206, 6036, 5870, 5706, 5546, 5389, 5237, 5090, 4947, 4810, 4679, 4554,\
+		4435, 4323, 4219, 4122, 4034, 3954, 3883, 3822, 3771, 3730, 3700, 3681, 3674, 3679, 3697, 3728,\
+		3773, 3832, 3906, 3995, 4098, 4215, 4345, 4488, 4644, 4811, 4991, 5182, 5383, 5596, 5819, 6051,\
+		6293, 6544, 6804, 7073, 7349, 7633, 7925, 8224, 8529, 8841, 9159, 9482, 9811, 10145, 10484, 10828,\
+		11175, 11527, 11882, 12240, 12602, 12966, 13333, 13701, 14072, 14444, 14818, 15193, 15568, 15944, 16321, 16697,\
+		17074, 17450, 17825, 18200, 18573, 18946, 19316, 19685, 20052, 20417, 20779, 21139, 21496, 21850, 22201, 22549,\
+		22893, 23234, 23570, 23903, 24231, 24555, 24875, 25190, 25500, 25805, 26105, 26400, 26689, 26973, 27251, 27523,\
+		27790, 28050, 28305, 28553, 28795, 29030, 29259, 29481, 29697, 29906, 30108, 30303, 30491, 30671, 30845, 31012,\
+		31171, 31323, 31467, 31604, 31733, 31855, 31970, 32077, 32176, 32268, 32352, 32428, 32496, 32557, 32491, 32426,\
+		32363, 32304, 32249, 32199, 32157, 32123, 32099, 32085, 32084, 32095, 32120, 32162, 32219, 32295, 32390, 32504,\
+		32767}
+
+	#define new_perlin_slope_22 {\
+		0, 143, 310, 494, 688, 885, 1079, 1264, 1435, 1589, 1721, 1829, 1909, 1959, 1978, 1965,\
+		1918, 1838, 1724, 1577, 1456, 1330, 1203, 1076, 952, 831, 716, 608, 510, 423, 349, 289,\
+		246, 219, 211, 224, 257, 314, 394, 496, 621, 769, 943, 1141, 1366, 1617, 1896, 2202,\
+		2537, 2900, 3292, 3714, 4165, 4647, 5159, 5701, 6275, 6879, 7514, 8180, 8878, 9606, 10365, 11155,\
+		11975, 12806, 13640, 14474, 15303, 16126, 16938, 17736, 18517, 19280, 20021, 20737, 21427, 22088, 22718, 23316,\
+		23880, 24408, 24900, 25352, 25766, 26139, 26471, 26761, 27010, 27216, 27379, 27499, 27577, 27613, 27607, 27560,\
+		27473, 27346, 27180, 26977, 26739, 26465, 26159, 25822, 25456, 25063, 24646, 24206, 23746, 23269, 22779, 22277,\
+		21767, 21252, 20737, 20224, 19717, 19220, 18737, 18273, 17831, 17417, 17035, 16690, 16387, 16130, 15926, 15780,\
+		15696, 15683, 15740, 15863, 16046, 16285, 16575, 16913, 17293, 17713, 18167, 18652, 19164, 19699, 20254, 20826,\
+		21410, 22004, 22604, 23208, 23812, 24414, 25011, 25600, 26179, 26746, 27298, 27833, 28349, 28844, 29316, 29764,\
+		30185, 30579, 30944, 31279, 31582, 31852, 32089, 32292, 32459, 32591, 32687, 32746, 32768, 32753, 32701, 32611,\
+		32485, 32321, 32122, 31886, 31615, 31309, 30970, 30597, 30192, 29757, 29292, 28799, 28279, 27734, 27165, 26574,\
+		25964, 25338, 24707, 24074, 23441, 22814, 22192, 21581, 20981, 20396, 19828, 19279, 18750, 18244, 17763, 17308,\
+		16880, 16482, 16113, 15777, 15472, 15201, 14964, 14762, 14595, 14463, 14367, 14308, 14284, 14298, 14348, 14435,\
+		14558, 14717, 14910, 15137, 15397, 15688, 16009, 16360, 16737, 17140, 17567, 18015, 18483, 18968, 20040, 21084,\
+		22095, 23070, 24006, 24899, 25748, 26551, 27307, 28016, 28679, 29297, 29871, 30406, 30904, 31370, 31811, 32231,\
+		32767}
+
+	#define new_perlin_slope_23 {\
+		0, 388, 674, 864, 969, 1000, 973, 903, 811, 714, 634, 591, 604, 693, 876, 1169,\
+		1586, 2139, 2837, 3683, 4572, 5522, 6515, 7535, 8562, 9577, 10555, 11472, 12306, 13068, 13764, 14391,\
+		14949, 15437, 15854, 16200, 16477, 16686, 16828, 16906, 16924, 16884, 16790, 16648, 16463, 16239, 15985, 15705,\
+		15408, 15102, 14795, 14496, 14215, 13961, 13745, 13579, 13475, 13444, 13499, 13654, 13922, 14319, 14756, 15097,\
+		15348, 15520, 15620, 15658, 15643, 15584, 15487, 15361, 15213, 15050, 14880, 14707, 14540, 14382, 14240, 14119,\
+		14023, 13958, 13927, 13934, 13982, 14076, 14218, 14410, 14655, 14954, 15310, 15723, 16195, 16726, 17317, 17963,\
+		18628, 19294, 19949, 20584, 21187, 21752, 22269, 22734, 23140, 23483, 23759, 23966, 24101, 24164, 24155, 24076,\
+		23929, 23716, 23443, 23113, 22734, 22313, 21856, 21374, 20877, 20375, 19880, 19405, 18964, 18572, 18245, 17999,\
+		17852, 17823, 17905, 18085, 18346, 18676, 19061, 19488, 19945, 20423, 20909, 21394, 21870, 22328, 22760, 23160,\
+		23522, 23839, 24107, 24323, 24482, 24582, 24621, 24598, 24513, 24364, 24155, 23885, 23557, 23174, 22741, 22260,\
+		21738, 21180, 20596, 20008, 19428, 18866, 18331, 17831, 17372, 16961, 16602, 16300, 16059, 15880, 15766, 15718,\
+		15734, 15814, 15957, 16158, 16416, 16725, 17079, 17472, 17898, 18347, 18812, 19282, 19746, 20193, 20610, 20984,\
+		21301, 21545, 21700, 21751, 21697, 21555, 21341, 21066, 20745, 20390, 20010, 19619, 19224, 18836, 18463, 18113,\
+		17792, 17508, 17266, 17070, 16925, 16834, 16800, 16825, 16911, 17057, 17264, 17531, 17856, 18237, 18671, 19154,\
+		19681, 20248, 20848, 21475, 22121, 22795, 23538, 24333, 25163, 26008, 26853, 27683, 28483, 29241, 29967, 30575,\
+		31070, 31455, 31740, 31935, 32051, 32103, 32104, 32070, 32017, 31960, 31916, 31898, 31921, 31997, 32137, 32349,\
+		32767}
+
+	#define new_perlin_slope_24 {\
+		0, 1012, 1887, 2600, 3137, 3496, 3674, 3645, 3429, 3063, 2595, 2081, 1582, 1160, 876, 786,\
+		941, 1379, 2126, 3190, 4460, 5868, 7344, 8808, 10164, 11310, 12148, 13067, 14178, 15394, 16636, 17835,\
+		18934, 19882, 20639, 21174, 21468, 21508, 21292, 20827, 20132, 19232, 18163, 16970, 15710, 14446, 13253, 12022,\
+		10486, 8767, 6988, 5256, 3664, 2288, 1193, 426, 22, 0, 364, 1104, 2196, 3600, 5261, 7113,\
+		9070, 11036, 12897, 14535, 15956, 17169, 18167, 18947, 19511, 19866, 20023, 19998, 19810, 19485, 19048, 18531,\
+		17971, 17412, 16898, 16483, 16222, 16175, 16409, 16993, 17681, 18072, 18212, 18149, 17929, 17593, 17182, 16731,\
+		16276, 15848, 15475, 15183, 14996, 14934, 15016, 15255, 15664, 16254, 17030, 17996, 19142, 20341, 21517, 22619,\
+		23602, 24430, 25075, 25518, 25746, 25756, 25551, 25144, 24554, 23810, 22948, 22011, 21052, 20131, 19315, 18681,\
+		18312, 18287, 18571, 19091, 19780, 20575, 21422, 22270, 23075, 23799, 24408, 24876, 25182, 25311, 25253, 25004,\
+		24568, 23950, 23166, 22235, 21182, 20047, 18918, 17851, 16888, 16065, 15410, 14943, 14679, 14621, 14770, 15116,\
+		15643, 16327, 17137, 18034, 18973, 19899, 20753, 21466, 21963, 22160, 22035, 21662, 21107, 20432, 19693, 18940,\
+		18217, 17562, 17007, 16580, 16301, 16187, 16247, 16485, 16899, 17479, 18211, 19076, 20046, 21091, 22219, 23530,\
+		24941, 26366, 27729, 28966, 30022, 30856, 31436, 31743, 31766, 31509, 30985, 30217, 29242, 28106, 26866, 25592,\
+		24363, 23270, 22402, 21394, 20135, 18743, 17320, 15957, 14731, 13708, 12939, 12464, 12307, 12483, 12991, 13820,\
+		14943, 16322, 17906, 19631, 21419, 23182, 24815, 26209, 27319, 28157, 28738, 29079, 29200, 29123, 28950, 28687,\
+		28381, 28075, 27810, 27617, 27524, 27551, 27710, 28006, 28434, 28980, 29620, 30318, 31010, 31622, 32109, 32449,\
+		32767}
+
+	#define new_perlin_slope_25 {\
+		0, 601, 1197, 1754, 2236, 2636, 2985, 3309, 3636, 3998, 4424, 4935, 5548, 6263, 7066, 7924,\
+		8781, 9554, 10140, 10593, 10551, 10472, 10377, 10281, 10200, 10144, 10121, 10135, 10191, 10285, 10416, 10575,\
+		10855, 11773, 13149, 14713, 16240, 17545, 18488, 18970, 18935, 18371, 17306, 15813, 14006, 12014, 9920, 7684,\
+		5556, 3750, 2428, 1695, 1605, 2153, 3284, 4887, 6795, 8790, 10596, 11885, 12970, 14463, 16103, 17667,\
+		18978, 19902, 20350, 20277, 19684, 18614, 17157, 15445, 13656, 12001, 9994, 7571, 5108, 2914, 1229, 223,\
+		0, 595, 1974, 4036, 6609, 9456, 12270, 14689, 16636, 18118, 19122, 19659, 19760, 19479, 18890, 18088,\
+		17192, 16339, 15691, 15429, 15757, 16631, 17014, 16910, 16466, 15814, 15075, 14355, 13750, 13341, 13195, 13370,\
+		13908, 14839, 16180, 17836, 19494, 20981, 22170, 22969, 23326, 23224, 22685, 21765, 20562, 19206, 17869, 16757,\
+		16114, 16161, 16780, 17756, 18899, 20049, 21070, 21854, 22322, 22418, 22118, 21420, 20352, 18968, 17352, 15707,\
+		14222, 13020, 12191, 11788, 11831, 12306, 13163, 14317, 15650, 17008, 18203, 19012, 19194, 18781, 17988, 17004,\
+		15989, 15077, 14373, 13957, 13879, 14164, 14808, 15780, 17023, 18450, 20050, 21956, 23914, 25688, 27093, 27998,\
+		28323, 28039, 27169, 25791, 24031, 22070, 20140, 18524, 16981, 14942, 12749, 10696, 9018, 7888, 7422, 7673,\
+		8635, 10243, 12370, 14830, 17378, 19706, 21519, 22779, 23529, 23825, 23731, 23327, 22700, 21953, 21198, 20558,\
+		20170, 20180, 20748, 22039, 23968, 26183, 28374, 30291, 31742, 32593, 32768, 32248, 31074, 29345, 27215, 24901,\
+		22675, 20854, 19586, 18830, 18532, 18628, 19044, 19700, 20504, 21356, 22149, 22763, 23074, 22944, 22657, 22118,\
+		22070, 22433, 23091, 23943, 24898, 25880, 26829, 27698, 28455, 29088, 29599, 30009, 30358, 30799, 31389, 32027,\
+		32767}
+
+	#define new_perlin_slope_26 {\
+		0, 259, 384, 406, 403, 474, 720, 1219, 2005, 3044, 3966, 4460, 4589, 4464, 4235, 4087,\
+		4225, 4873, 6259, 8612, 11304, 13894, 15951, 17194, 17492, 16864, 15481, 13666, 11891, 10775, 10409, 10491,\
+		10872, 11411, 11976, 12447, 12711, 12664, 12214, 11289, 10247, 9384, 8816, 8603, 8750, 9209, 9876, 10593,\
+		11146, 11295, 11215, 11069, 10920, 10817, 10798, 10888, 11101, 11432, 11820, 12380, 14132, 16561, 18944, 20735,\
+		21565, 21242, 19752, 17260, 14106, 10698, 7085, 3910, 1724, 852, 1391, 3210, 5953, 9038, 11655, 13357,\
+		15732, 18299, 20453, 21774, 22027, 21160, 19310, 16797, 14128, 11414, 7758, 4129, 1375, 57, 441, 2519,\
+		5994, 10289, 14538, 17847, 20143, 21404, 21679, 21108, 19921, 18434, 17057, 16286, 16707, 17741, 17643, 16810,\
+		15633, 14453, 13554, 13168, 13472, 14589, 16589, 19172, 21574, 23373, 24304, 24256, 23273, 21557, 19461, 17496,\
+		16325, 16560, 17834, 19552, 21228, 22489, 23076, 22841, 21748, 19875, 17412, 14839, 12695, 11302, 10838, 11333,\
+		12674, 14606, 16724, 18483, 19196, 18602, 17275, 15746, 14433, 13638, 13552, 14248, 15687, 17715, 20101, 23064,\
+		26083, 28490, 29836, 29890, 28637, 26285, 23256, 20190, 17750, 14594, 11078, 8053, 6118, 5624, 6669, 9104,\
+		12526, 16285, 19488, 21522, 22458, 22465, 21762, 20616, 19343, 18307, 17922, 18649, 20936, 24334, 27856, 30741,\
+		32470, 32768, 31602, 29180, 25954, 22620, 20060, 18634, 18194, 18554, 19488, 20734, 21993, 22928, 23165, 22293,\
+		20528, 19600, 19459, 19901, 20710, 21660, 22511, 23014, 22907, 21918, 20581, 20438, 21144, 22317, 23615, 24735,\
+		25416, 25436, 24616, 22815, 20726, 19647, 19479, 20053, 21164, 22562, 23955, 25012, 25367, 24614, 23402, 22492,\
+		22111, 22334, 23120, 24338, 25796, 27268, 28524, 29359, 29844, 30204, 30505, 30796, 31105, 31447, 31825, 32230,\
+		32767}
+
+	#define new_perlin_slope_27 {\
+		0, 551, 1400, 2271, 2929, 3234, 3193, 3033, 3251, 4281, 4948, 5080, 4785, 4276, 3872, 4006,\
+		5234, 8319, 12292, 15634, 16452, 15016, 11706, 7566, 3976, 1274, 0, 375, 2211, 4912, 7472, 8495,\
+		7876, 6791, 5941, 5776, 6498, 8066, 10179, 11906, 12062, 11273, 10185, 9355, 9249, 10239, 12593, 15630,\
+		18115, 19320, 18964, 17211, 14668, 12388, 11418, 11305, 11684, 12253, 12737, 12888, 12484, 11362, 10132, 9330,\
+		9137, 9577, 10512, 11602, 12342, 12430, 12308, 12131, 12002, 11985, 12106, 12358, 12843, 15092, 18084, 20409,\
+		21180, 20028, 17111, 13103, 8682, 4560, 2040, 1781, 3774, 7348, 11161, 13606, 16690, 19848, 21902, 22217,\
+		20703, 17815, 14546, 10704, 6035, 2583, 1581, 3428, 7685, 13074, 17604, 20422, 21525, 21083, 19533, 17573,\
+		16162, 16523, 17386, 16615, 15122, 13668, 12854, 13125, 14766, 17772, 20841, 22901, 23432, 22369, 20104, 17481,\
+		15801, 16319, 18228, 20330, 21758, 21973, 20768, 18264, 14983, 12097, 10431, 10343, 11766, 14209, 16753, 18059,\
+		17267, 15468, 13738, 12821, 13122, 14712, 17326, 20637, 24551, 27619, 28846, 27878, 24999, 21131, 17804, 13898,\
+		9550, 6485, 5687, 7408, 11165, 15737, 19264, 20855, 20811, 19609, 17869, 16354, 15970, 17759, 21734, 25910,\
+		28711, 29272, 27444, 23790, 19583, 16638, 15561, 15979, 17396, 19209, 20707, 21066, 19465, 18202, 18241, 19120,\
+		20353, 21419, 21764, 20802, 19195, 19366, 20575, 22041, 23101, 23211, 21946, 19132, 17129, 16675, 17407, 18839,\
+		20363, 21251, 20651, 18484, 16565, 15525, 15628, 16823, 18735, 20675, 21705, 22048, 22106, 22043, 22015, 22150,\
+		22544, 23268, 24178, 24883, 25313, 25462, 25392, 25224, 25142, 25538, 27536, 30104, 32091, 32768, 31751, 29504,\
+		26719, 24907, 24843, 25800, 27145, 28358, 29047, 28957, 28146, 27905, 28316, 29116, 30044, 30889, 31543, 32050,\
+		32767}
+
+	#define new_perlin_slope_28 {\
+		0, 487, 678, 752, 1148, 2309, 4551, 7930, 10903, 11951, 10415, 7160, 4196, 1537, 470, 1687,\
+		4723, 7574, 7575, 5792, 3815, 3136, 4273, 7060, 7804, 5379, 2373, 776, 1976, 6652, 10392, 10917,\
+		9045, 6279, 4806, 6941, 8278, 7849, 6693, 5916, 6691, 10414, 16674, 21394, 22146, 18621, 12632, 7337,\
+		3939, 3502, 5915, 9769, 12351, 11416, 9367, 7967, 8140, 10009, 12889, 14018, 12783, 10857, 9622, 10167,\
+		13271, 17652, 20543, 20620, 17976, 14122, 11828, 11613, 12423, 13513, 14188, 13790, 12069, 10531, 9991, 10573,\
+		11891, 13043, 13076, 12724, 12379, 12243, 12403, 12826, 15094, 19605, 22803, 22710, 19008, 13043, 6388, 1510,\
+		736, 4265, 10177, 14587, 19267, 23780, 25539, 23703, 19170, 14094, 7032, 1620, 1023, 5736, 13589, 20129,\
+		23347, 23370, 21050, 18077, 16976, 18457, 17198, 14836, 13133, 13347, 16227, 21073, 24694, 25470, 23254, 19352,\
+		16519, 17647, 20781, 23289, 23591, 21158, 16528, 11920, 9605, 10364, 13622, 17445, 18640, 16474, 13768, 12543,\
+		13747, 17256, 22267, 28120, 31605, 31009, 26658, 20914, 15786, 9248, 5167, 5690, 10618, 17420, 21832, 22666,\
+		20947, 18170, 16282, 17691, 23398, 29129, 31423, 29093, 23223, 17168, 14459, 14830, 17073, 19631, 20601, 18237,\
+		17169, 18262, 20314, 22015, 21952, 19728, 20259, 22490, 24560, 25001, 22720, 18578, 17212, 18208, 20360, 22072,\
+		21362, 17868, 15194, 14539, 16022, 18744, 20789, 21159, 20973, 20640, 20502, 20828, 21807, 22848, 23428, 23515,\
+		23272, 23060, 23649, 27064, 30899, 32768, 31634, 27805, 23426, 22554, 24342, 27117, 29070, 28262, 24510, 22907,\
+		23570, 25620, 27631, 27628, 26703, 28662, 31081, 32110, 30631, 26256, 20403, 16315, 15629, 18316, 23071, 25817,\
+		25468, 24193, 23375, 23675, 25178, 27404, 28349, 28259, 27928, 27942, 28654, 30129, 31602, 32337, 32421, 32359,\
+		32767}
+
+	#define additive_pairs_slopes0 {\
+		0, 5, 13, 24, 37, 53, 71, 92, 115, 140, 167, 196, 229, 263, 300, 339,\
+		380, 425, 471, 520, 570, 624, 679, 737, 797, 859, 923, 990, 1060, 1131, 1205, 1280,\
+		1359, 1439, 1521, 1606, 1693, 1781, 1872, 1965, 2061, 2158, 2257, 2358, 2462, 2567, 2674, 2784,\
+		2896, 3009, 3125, 3242, 3362, 3483, 3606, 3731, 3857, 3986, 4116, 4249, 4383, 4518, 4656, 4795,\
+		4936, 5078, 5222, 5368, 5516, 5665, 5815, 5968, 6122, 6277, 6433, 6591, 6751, 6911, 7074, 7237,\
+		7403, 7569, 7737, 7905, 8075, 8247, 8419, 8593, 8768, 8943, 9120, 9298, 9478, 9658, 9839, 10021,\
+		10204, 10387, 10572, 10757, 10943, 11131, 11319, 11508, 11698, 11888, 12078, 12270, 12462, 12654, 12847, 13040,\
+		13234, 13429, 13624, 13820, 14015, 14212, 14408, 14605, 14801, 14999, 15196, 15394, 15591, 15789, 15987, 16185,\
+		16384, 16582, 16780, 16978, 17176, 17373, 17571, 17768, 17966, 18162, 18359, 18555, 18752, 18947, 19143, 19338,\
+		19533, 19727, 19920, 20113, 20306, 20497, 20689, 20879, 21070, 21259, 21448, 21636, 21824, 22010, 22195, 22380,\
+		22564, 22746, 22928, 23109, 23290, 23469, 23647, 23824, 24000, 24174, 24348, 24520, 24692, 24862, 25030, 25198,\
+		25364, 25530, 25693, 25856, 26017, 26176, 26334, 26490, 26646, 26799, 26952, 27102, 27252, 27399, 27545, 27689,\
+		27832, 27972, 28111, 28249, 28385, 28518, 28651, 28781, 28909, 29036, 29161, 29284, 29405, 29525, 29642, 29758,\
+		29871, 29983, 30093, 30200, 30305, 30409, 30510, 30609, 30707, 30802, 30895, 30986, 31074, 31161, 31246, 31328,\
+		31409, 31487, 31562, 31636, 31708, 31777, 31844, 31908, 31970, 32030, 32088, 32143, 32197, 32247, 32296, 32342,\
+		32387, 32428, 32467, 32504, 32539, 32570, 32600, 32627, 32653, 32675, 32696, 32714, 32730, 32743, 32753, 32761,\
+		32767}
+
+	#define additive_pairs_slopes1 {\
+		0, 1, 2, 6, 10, 15, 22, 30, 39, 50, 61, 74, 88, 103, 120, 137,\
+		156, 176, 198, 220, 244, 268, 294, 322, 350, 380, 410, 442, 475, 509, 545, 581,\
+		619, 658, 697, 738, 780, 824, 868, 913, 960, 1007, 1056, 1106, 1157, 1208, 1261, 1315,\
+		1370, 1426, 1483, 1541, 1600, 1660, 1721, 1783, 1846, 1909, 1974, 2040, 2106, 2174, 2242, 2312,\
+		2382, 2454, 2532, 2616, 2705, 2800, 2901, 3008, 3120, 3237, 3361, 3489, 3624, 3763, 3908, 4059,\
+		4214, 4375, 4541, 4712, 4889, 5070, 5256, 5447, 5642, 5843, 6048, 6257, 6471, 6689, 6911, 7138,\
+		7369, 7603, 7842, 8084, 8330, 8579, 8832, 9089, 9348, 9611, 9876, 10145, 10416, 10690, 10967, 11246,\
+		11527, 11810, 12096, 12383, 12672, 12963, 13255, 13549, 13844, 14140, 14437, 14735, 15034, 15333, 15633, 15933,\
+		16233, 16534, 16834, 17134, 17434, 17733, 18032, 18330, 18627, 18923, 19218, 19512, 19804, 20095, 20384, 20671,\
+		20957, 21240, 21521, 21800, 22077, 22351, 22622, 22891, 23156, 23419, 23678, 23935, 24188, 24437, 24683, 24925,\
+		25164, 25398, 25629, 25856, 26078, 26296, 26510, 26719, 26924, 27125, 27320, 27511, 27697, 27878, 28055, 28226,\
+		28392, 28553, 28708, 28859, 29004, 29143, 29278, 29406, 29530, 29647, 29759, 29866, 29967, 30062, 30151, 30235,\
+		30313, 30385, 30452, 30513, 30593, 30661, 30727, 30793, 30858, 30921, 30984, 31046, 31107, 31167, 31226, 31284,\
+		31341, 31397, 31452, 31506, 31559, 31610, 31661, 31711, 31760, 31807, 31854, 31899, 31943, 31987, 32029, 32070,\
+		32109, 32148, 32186, 32222, 32258, 32292, 32325, 32357, 32387, 32417, 32445, 32473, 32499, 32523, 32547, 32569,\
+		32591, 32611, 32630, 32647, 32664, 32679, 32693, 32706, 32717, 32728, 32737, 32745, 32752, 32757, 32761, 32765,\
+		32767}
+
+	#define additive_pairs_slopes2 {\
+		0, 6, 22, 50, 88, 137, 198, 268, 350, 442, 545, 658, 780, 913, 1056, 1208,\
+		1370, 1541, 1721, 1909, 2106, 2312, 2525, 2745, 2973, 3208, 3450, 3698, 3952, 4212, 4477, 4747,\
+		5022, 5309, 5619, 5951, 6307, 6684, 7083, 7502, 7942, 8401, 8878, 9373, 9885, 10412, 10955, 11511,\
+		12081, 12662, 13255, 13857, 14467, 15085, 15709, 16338, 16971, 17607, 18244, 18881, 19517, 20150, 20779, 21404,\
+		22023, 22633, 23236, 23828, 24409, 24978, 25533, 26074, 26598, 27106, 27596, 28067, 28518, 28948, 29356, 29741,\
+		30102, 30440, 30752, 31038, 31297, 31530, 31735, 31912, 32060, 32179, 32269, 32330, 32360, 32361, 32332, 32273,\
+		32185, 32066, 31918, 31740, 31533, 31297, 31033, 30741, 30422, 30075, 29703, 29305, 28882, 28435, 27965, 27472,\
+		26958, 26424, 25871, 25299, 24709, 24104, 23484, 22850, 22203, 21546, 20878, 20201, 19517, 18827, 18132, 17434,\
+		16734, 16033, 15333, 14635, 13940, 13250, 12566, 11889, 11221, 10564, 9917, 9283, 8663, 8058, 7468, 6896,\
+		6343, 5809, 5295, 4802, 4332, 3885, 3462, 3064, 2692, 2345, 2026, 1734, 1470, 1234, 1027, 849,\
+		701, 582, 494, 435, 406, 407, 437, 498, 588, 707, 855, 1032, 1237, 1470, 1729, 2015,\
+		2327, 2665, 3026, 3411, 3819, 4249, 4700, 5171, 5661, 6169, 6693, 7234, 7789, 8358, 8939, 9531,\
+		10134, 10744, 11363, 11988, 12617, 13250, 13886, 14523, 15160, 15796, 16429, 17058, 17682, 18300, 18910, 19512,\
+		20105, 20686, 21256, 21812, 22355, 22882, 23394, 23889, 24366, 24825, 25265, 25684, 26083, 26460, 26816, 27148,\
+		27458, 27745, 28020, 28290, 28555, 28815, 29069, 29317, 29559, 29794, 30022, 30242, 30455, 30661, 30858, 31046,\
+		31226, 31397, 31559, 31711, 31854, 31987, 32109, 32222, 32325, 32417, 32499, 32569, 32630, 32679, 32717, 32745,\
+		32767}
+
+	#define additive_pairs_slopes3 {\
+		0, 31, 92, 183, 304, 455, 634, 842, 1077, 1339, 1626, 1938, 2273, 2630, 3008, 3406,\
+		3821, 4253, 4699, 5158, 5629, 6116, 6652, 7237, 7870, 8547, 9267, 10025, 10819, 11645, 12500, 13379,\
+		14280, 15197, 16127, 17064, 18006, 18948, 19884, 20811, 21724, 22619, 23492, 24338, 25153, 25933, 26675, 27374,\
+		28027, 28630, 29181, 29677, 30115, 30492, 30806, 31057, 31241, 31359, 31408, 31389, 31301, 31144, 30919, 30626,\
+		30266, 29841, 29353, 28803, 28193, 27527, 26807, 26036, 25218, 24356, 23454, 22516, 21546, 20549, 19530, 18492,\
+		17441, 16382, 15319, 14257, 13202, 12157, 11129, 10122, 9141, 8190, 7273, 6396, 5562, 4776, 4040, 3359,\
+		2736, 2174, 1676, 1243, 879, 585, 362, 212, 136, 133, 205, 350, 569, 860, 1222, 1654,\
+		2154, 2718, 3346, 4033, 4777, 5575, 6422, 7316, 8251, 9223, 10228, 11261, 12318, 13394, 14483, 15581,\
+		16682, 17782, 18875, 19956, 21020, 22063, 23079, 24064, 25013, 25922, 26787, 27604, 28369, 29078, 29728, 30317,\
+		30842, 31300, 31690, 32009, 32257, 32431, 32533, 32561, 32515, 32395, 32203, 31939, 31605, 31203, 30734, 30201,\
+		29606, 28953, 28244, 27483, 26674, 25821, 24927, 23996, 23035, 22046, 21034, 20005, 18963, 17913, 16860, 15809,\
+		14764, 13731, 12714, 11718, 10747, 9806, 8899, 8031, 7204, 6423, 5691, 5011, 4386, 3819, 3312, 2867,\
+		2486, 2171, 1922, 1740, 1626, 1580, 1601, 1690, 1845, 2066, 2351, 2698, 3105, 3570, 4090, 4664,\
+		5286, 5956, 6668, 7419, 8206, 9025, 9872, 10742, 11631, 12535, 13450, 14371, 15294, 16215, 17129, 18032,\
+		18920, 19789, 20635, 21454, 22243, 22998, 23715, 24393, 25028, 25673, 26167, 26654, 27135, 27605, 28064, 28511,\
+		28942, 29357, 29755, 30133, 30490, 30825, 31137, 31424, 31686, 31921, 32129, 32309, 32459, 32580, 32672, 32733,\
+		32767}
+
+	#define additive_pairs_slopes4 {\
+		0, 30, 120, 268, 475, 738, 1056, 1426, 1846, 2312, 2820, 3369, 3952, 4567, 5208, 5871,\
+		6551, 7243, 7942, 8642, 9340, 10029, 10704, 11361, 12027, 12743, 13504, 14303, 15134, 15991, 16866, 17752,\
+		18641, 19526, 20397, 21249, 22071, 22858, 23601, 24294, 24929, 25500, 26000, 26426, 26771, 27032, 27205, 27287,\
+		27277, 27173, 26976, 26684, 26301, 25828, 25267, 24623, 23901, 23105, 22243, 21319, 20343, 19321, 18262, 17175,\
+		16069, 14953, 13837, 12730, 11643, 10585, 9565, 8593, 7677, 6827, 6049, 5352, 4742, 4225, 3807, 3492,\
+		3284, 3186, 3199, 3325, 3563, 3912, 4370, 4934, 5601, 6364, 7219, 8159, 9176, 10263, 11409, 12607,\
+		13846, 15115, 16405, 17704, 19000, 20284, 21543, 22767, 23945, 25066, 26121, 27101, 27995, 28797, 29498, 30093,\
+		30574, 30938, 31181, 31300, 31293, 31159, 30900, 30516, 30011, 29387, 28650, 27806, 26861, 25823, 24699, 23501,\
+		22236, 20917, 19553, 18157, 16739, 15314, 13891, 12484, 11104, 9764, 8475, 7248, 6095, 5024, 4046, 3168,\
+		2400, 1748, 1217, 813, 540, 399, 393, 523, 787, 1183, 1708, 2359, 3130, 4015, 5005, 6094,\
+		7272, 8529, 9855, 11238, 12667, 14129, 15613, 17105, 18593, 20064, 21506, 22906, 24253, 25535, 26740, 27859,\
+		28882, 29800, 30606, 31291, 31852, 32282, 32578, 32737, 32758, 32642, 32388, 31999, 31478, 30831, 30061, 29177,\
+		28185, 27094, 25913, 24653, 23324, 21937, 20505, 19040, 17554, 16060, 14570, 13097, 11654, 10253, 8906, 7625,\
+		6419, 5299, 4275, 3354, 2546, 1855, 1289, 851, 545, 374, 337, 436, 669, 1035, 1528, 2145,\
+		2881, 3728, 4679, 5725, 6859, 8068, 9344, 10675, 12049, 13454, 14879, 16312, 17739, 19149, 20531, 21872,\
+		23160, 24386, 25540, 26611, 27591, 28472, 29247, 29947, 30455, 30921, 31341, 31711, 32029, 32292, 32499, 32647,\
+		32767}
+
+	#define additive_pairs_slopes5 {\
+		0, 50, 198, 442, 1349, 1468, 1790, 2312, 3026, 3925, 4998, 6230, 7605, 9105, 10711, 12401,\
+		14152, 15940, 17742, 19534, 21289, 22985, 24598, 26106, 27488, 28725, 29799, 30694, 31400, 31904, 32200, 32282,\
+		32150, 31804, 31248, 30490, 29539, 28407, 27109, 25664, 24089, 22407, 20639, 18810, 16944, 15067, 13204, 11381,\
+		9622, 7951, 6392, 4965, 3691, 2586, 1666, 945, 431, 132, 52, 193, 553, 1128, 1908, 2885,\
+		4045, 5372, 6849, 8454, 10168, 11965, 13823, 15715, 17616, 19501, 21343, 23117, 24800, 26369, 27802, 29080,\
+		30186, 31104, 31824, 32334, 32628, 32703, 32557, 32193, 31616, 30834, 29858, 28702, 27381, 25914, 24321, 22623,\
+		20844, 19008, 17141, 15267, 13412, 11602, 9860, 8210, 6675, 5274, 4027, 2951, 2058, 1361, 869, 587,\
+		520, 667, 1025, 1590, 2352, 3301, 4422, 5702, 7120, 8658, 10294, 12006, 13770, 15563, 17358, 19133,\
+		20863, 22525, 24096, 25556, 26886, 28067, 29085, 29927, 30582, 31042, 31302, 31359, 31214, 30870, 30332, 29610,\
+		28713, 27655, 26452, 25120, 23678, 22147, 20548, 18903, 17234, 15566, 13919, 12317, 10781, 9331, 7987, 6765,\
+		5682, 4752, 3985, 3391, 2977, 2747, 2703, 2843, 3166, 3663, 4328, 5150, 6117, 7213, 8424, 9731,\
+		11116, 12560, 14041, 15541, 17037, 18511, 19941, 21310, 22598, 23789, 24868, 25822, 26638, 27308, 27822, 28177,\
+		28369, 28397, 28262, 27969, 27522, 26931, 26204, 25353, 24392, 23334, 22196, 20993, 19743, 18464, 17174, 15890,\
+		14630, 13411, 12248, 11158, 10153, 9247, 8450, 7772, 7221, 6801, 6518, 6372, 6364, 6492, 6751, 7136,\
+		7641, 8255, 8969, 9771, 10649, 11590, 12579, 13601, 14643, 15690, 16726, 17739, 18714, 19638, 20500, 21289,\
+		22158, 23032, 23925, 24825, 25723, 26607, 27466, 28290, 29069, 29794, 30455, 31046, 31559, 31987, 32325, 32569,\
+		32767}
+
+	#define additive_pairs_slopes6 {\
+		0, 148, 440, 873, 1437, 2123, 2918, 3808, 4777, 5852, 6888, 8124, 9537, 11099, 12781, 14551,\
+		16374, 18214, 20034, 21798, 23470, 25015, 26402, 27602, 28588, 29340, 29840, 30077, 30043, 29737, 29163, 28331,\
+		27254, 25954, 24453, 22781, 20970, 19054, 17072, 15063, 13065, 11120, 9266, 7542, 5981, 4617, 3478, 2588,\
+		1966, 1626, 1577, 1821, 2355, 3170, 4252, 5580, 7129, 8870, 10768, 12787, 14887, 17027, 19165, 21257,\
+		23262, 25139, 26851, 28363, 29644, 30667, 31412, 31861, 32005, 31840, 31368, 30598, 29542, 28223, 26664, 24896,\
+		22953, 20874, 18699, 16472, 14236, 12036, 9915, 7917, 6081, 4443, 3038, 1894, 1033, 474, 228, 302,\
+		693, 1396, 2397, 3675, 5208, 6963, 8908, 11003, 13208, 15478, 17769, 20035, 22231, 24313, 26241, 27975,\
+		29481, 30729, 31695, 32357, 32705, 32729, 32430, 31814, 30892, 29683, 28211, 26505, 24599, 22531, 20341, 18074,\
+		15774, 13487, 11258, 9131, 7149, 5351, 3772, 2444, 1392, 637, 194, 71, 270, 787, 1612, 2726,\
+		4109, 5731, 7561, 9562, 11693, 13913, 16177, 18440, 20657, 22784, 24781, 26606, 28224, 29605, 30720, 31550,\
+		32077, 32293, 32194, 31783, 31069, 30067, 28799, 27289, 25569, 23674, 21641, 19512, 17329, 15136, 12976, 10891,\
+		8923, 7111, 5489, 4088, 2937, 2056, 1461, 1163, 1167, 1471, 2068, 2944, 4080, 5453, 7034, 8791,\
+		10688, 12686, 14746, 16826, 18885, 20883, 22779, 24538, 26125, 27509, 28665, 29571, 30211, 30573, 30654, 30452,\
+		29973, 29230, 28239, 27021, 25602, 24011, 22282, 20450, 18552, 16626, 14710, 12842, 11060, 9397, 7885, 6554,\
+		5428, 4528, 3869, 3463, 3315, 3426, 3791, 4401, 5241, 6293, 7533, 8935, 10469, 12104, 13807, 15543,\
+		17276, 18974, 20602, 22128, 23524, 24771, 25868, 26941, 27971, 28941, 29831, 30626, 31312, 31876, 32308, 32601,\
+		32767}
+
+	#define additive_pairs_slopes7 {\
+		0, 103, 410, 913, 1600, 2453, 3450, 4567, 5775, 7125, 8737, 10573, 12584, 14718, 16915, 19117,\
+		21264, 23294, 25153, 26787, 28150, 29202, 29911, 30257, 30225, 29815, 29035, 27903, 26448, 24707, 22727, 20560,\
+		18263, 15900, 13534, 11230, 9053, 7061, 5312, 3854, 2730, 1971, 1602, 1634, 2069, 2898, 4099, 5642,\
+		7486, 9583, 11876, 14305, 16802, 19300, 21730, 24026, 26124, 27967, 29501, 30684, 31483, 31873, 31842, 31389,\
+		30526, 29273, 27664, 25742, 23557, 21169, 18642, 16045, 13449, 10924, 8540, 6362, 4451, 2859, 1631, 802,\
+		396, 424, 886, 1773, 3059, 4711, 6685, 8927, 11378, 13969, 16631, 19291, 21877, 24318, 26546, 28501,\
+		30129, 31385, 32235, 32653, 32630, 32164, 31268, 29965, 28293, 26294, 24025, 21546, 18925, 16233, 13545, 10933,\
+		8469, 6219, 4246, 2603, 1335, 477, 51, 70, 533, 1427, 2727, 4398, 6394, 8660, 11134, 13749,\
+		16433, 19114, 21717, 24172, 26412, 28376, 30012, 31275, 32131, 32557, 32543, 32090, 31211, 29930, 28283, 26317,\
+		24084, 21648, 19074, 16433, 13797, 11238, 8825, 6625, 4695, 3089, 1849, 1007, 586, 596, 1034, 1888,\
+		3133, 4733, 6644, 8813, 11179, 13678, 16241, 18797, 21277, 23614, 25745, 27613, 29167, 30367, 31182, 31591,\
+		31586, 31167, 30349, 29157, 27623, 25792, 23715, 21450, 19060, 16611, 14169, 11801, 9571, 7539, 5760, 4279,\
+		3137, 2360, 1970, 1973, 2367, 3139, 4266, 5713, 7440, 9398, 11531, 13780, 16084, 18379, 20602, 22694,\
+		24599, 26266, 27651, 28719, 29445, 29809, 29807, 29440, 28723, 27677, 26333, 24732, 22919, 20945, 18866, 16739,\
+		14622, 12574, 10649, 8898, 7368, 6098, 5120, 4457, 4125, 4129, 4465, 5121, 6075, 7298, 8753, 10399,\
+		12188, 14070, 15992, 17901, 19747, 21873, 23131, 24425, 25723, 26992, 28200, 29317, 30314, 31167, 31854, 32357,\
+		32767}
+
+	#define additive_pairs_slopes8 {\
+		0, 137, 545, 1208, 2106, 3208, 4477, 5871, 7342, 8988, 10920, 13069, 15361, 17715, 20044, 22266,\
+		24299, 26067, 27503, 28552, 29173, 29339, 29039, 28281, 27086, 25496, 23562, 21353, 18945, 16425, 13881, 11406,\
+		9089, 7017, 5264, 3898, 2971, 2519, 2563, 3105, 4129, 5601, 7472, 9677, 12139, 14770, 17478, 20165,\
+		22734, 25091, 27150, 28836, 30084, 30847, 31094, 30815, 30014, 28719, 26974, 24837, 22385, 19704, 16889, 14041,\
+		11263, 8654, 6310, 4317, 2747, 1660, 1096, 1079, 1612, 2678, 4241, 6246, 8624, 11290, 14149, 17100,\
+		20037, 22853, 25447, 27726, 29605, 31016, 31906, 32242, 32010, 31217, 29888, 28072, 25830, 23243, 20404, 17412,\
+		14376, 11405, 8605, 6078, 3914, 2194, 978, 313, 223, 713, 1765, 3343, 5391, 7837, 10593, 13560,\
+		16633, 19700, 22652, 25382, 27793, 29796, 31321, 32312, 32732, 32567, 31821, 30522, 28716, 26467, 23856, 20977,\
+		17933, 14834, 11790, 8911, 6300, 4051, 2245, 946, 200, 35, 455, 1446, 2971, 4974, 7385, 10115,\
+		13067, 16134, 19207, 22174, 24930, 27376, 29424, 31002, 32054, 32544, 32454, 31789, 30573, 28853, 26689, 24162,\
+		21362, 18391, 15355, 12363, 9524, 6937, 4695, 2879, 1550, 757, 525, 861, 1751, 3162, 5041, 7320,\
+		9914, 12730, 15667, 18618, 21477, 24143, 26521, 28526, 30089, 31155, 31688, 31671, 31107, 30020, 28450, 26457,\
+		24113, 21504, 18726, 15878, 13063, 10382, 7930, 5793, 4048, 2753, 1952, 1673, 1920, 2683, 3931, 5617,\
+		7676, 10033, 12602, 15289, 17997, 20628, 23090, 25295, 27166, 28638, 29662, 30204, 30248, 29796, 28869, 27503,\
+		25750, 23678, 21361, 18886, 16342, 13822, 11414, 9205, 7271, 5681, 4486, 3728, 3428, 3594, 4215, 5264,\
+		6700, 8468, 10501, 12723, 15052, 17406, 19698, 21847, 23779, 25425, 26896, 28290, 29559, 30661, 31559, 32222,\
+		32767}
+
+	#define block_test_attack0 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		32766}
+
+	#define block_test_attack1 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		32767}
+
+	#define block_test_attack2 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		32766}
+
+	#define block_test_attack3 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		32766}
+
+	#define block_test_attack4 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		32766}
+
+	#define block_test_attack5 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		32767}
+
+	#define block_test_attack6 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		32766}
+
+	#define block_test_attack7 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		32766}
+
+	#define block_test_attack8 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		32766}
+
+	#define block_test_release0 {\
+		0, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32766, 32766, 32766,\
+		32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32766, 32766, 32766,\
+		32766}
+
+	#define block_test_release1 {\
+		0, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 32766, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
+		32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32766,\
+		32767}
+
+	#define block_test_release2 {\
+		0, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 32766, 32766, 32766, 32766, 32767, 32767, 32766, 32767, 32766, 32766, 32767, 32766, 32766, 32766, 32766,\
+		32766, 32767, 32767, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
+		32766}
+
+	#define block_test_release3 {\
+		0, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
+		32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
+		32766}
+
+	#define block_test_release4 {\
+		0, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 32766, 32767, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32767, 32766,\
+		32766, 32766, 32766, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32767, 32766,\
+		32766}
+
+	#define block_test_release5 {\
+		0, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 32766, 32767, 32766, 32766,\
+		32766, 32766, 32766, 32766, 32767, 32766, 32767, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 32766,\
+		32767}
+
+	#define block_test_release6 {\
+		0, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 32766, 32767, 32767, 32767, 32766, 32767, 32766, 32767, 32767, 32767, 32767, 32767, 32766, 32767, 32766,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32766}
+
+	#define block_test_release7 {\
+		0, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479, 20479,\
+		20479, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287, 12287,\
+		12287, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671, 28671,\
+		28671, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,\
+		4095, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
+		32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32766, 32767, 32766, 32766, 32766, 32767,\
+		32766}
+
+	#define block_test_release8 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 32766, 32766, 32767, 32767, 32766, 32766, 32767, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
+		32766, 32767, 32767, 32767, 32767, 32767, 32767, 32766, 32766, 32767, 32767, 32767, 32766, 32766, 32766, 32766,\
+		32766, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,\
+		8191, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
+		32766, 32767, 32767, 32767, 32766, 32767, 32767, 32766, 32766, 32767, 32767, 32766, 32766, 32766, 32766, 32766,\
+		32766, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,\
+		16383, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32766, 32766,\
+		32766, 32766, 32766, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
+		32766, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575, 24575,\
+		24575, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
+		32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766,\
+		32766}
+
+	#define half_sines_attack0 {\
+		0, 10, 41, 93, 165, 257, 367, 494, 636, 794, 964, 1146, 1336, 1534, 1737, 1944,\
+		2151, 2358, 2561, 2759, 2949, 3131, 3301, 3458, 3601, 3728, 3838, 3929, 4001, 4053, 4085, 4095,\
+		4095, 4106, 4137, 4189, 4261, 4353, 4462, 4589, 4732, 4890, 5060, 5241, 5432, 5630, 5833, 6040,\
+		6247, 6453, 6657, 6855, 7045, 7227, 7397, 7554, 7697, 7824, 7934, 8025, 8097, 8149, 8181, 8191,\
+		8191, 8202, 8233, 8285, 8357, 8449, 8558, 8685, 8828, 8986, 9156, 9337, 9528, 9726, 9929, 10135,\
+		10343, 10549, 10753, 10950, 11141, 11322, 11493, 11650, 11793, 11920, 12030, 12121, 12193, 12245, 12277, 12287,\
+		12287, 12298, 12329, 12381, 12453, 12544, 12654, 12781, 12924, 13082, 13252, 13433, 13624, 13822, 14025, 14231,\
+		14439, 14645, 14848, 15046, 15237, 15418, 15589, 15746, 15889, 16016, 16126, 16217, 16289, 16341, 16372, 16383,\
+		16383, 16394, 16425, 16477, 16549, 16640, 16750, 16877, 17020, 17177, 17348, 17529, 17720, 17918, 18121, 18327,\
+		18535, 18741, 18944, 19142, 19333, 19514, 19684, 19842, 19985, 20112, 20222, 20313, 20385, 20437, 20468, 20479,\
+		20479, 20489, 20521, 20573, 20645, 20736, 20846, 20973, 21116, 21273, 21444, 21625, 21816, 22013, 22217, 22423,\
+		22631, 22837, 23040, 23238, 23429, 23610, 23780, 23938, 24081, 24208, 24317, 24409, 24481, 24533, 24564, 24575,\
+		24575, 24585, 24617, 24669, 24741, 24832, 24942, 25069, 25212, 25369, 25539, 25721, 25911, 26109, 26313, 26519,\
+		26726, 26933, 27136, 27334, 27525, 27706, 27876, 28034, 28177, 28304, 28413, 28505, 28577, 28629, 28660, 28671,\
+		28671, 28681, 28713, 28765, 28837, 28928, 29038, 29165, 29308, 29465, 29635, 29817, 30007, 30205, 30408, 30615,\
+		30822, 31029, 31232, 31430, 31620, 31802, 31972, 32130, 32272, 32399, 32509, 32601, 32673, 32725, 32756, 32767,\
+		32767}
+
+	#define half_sines_attack1 {\
+		0, 42, 167, 375, 663, 1029, 1468, 1976, 2547, 3177, 3858, 4584, 5346, 6138, 6951, 7776,\
+		8606, 9432, 10245, 11036, 11799, 12524, 13205, 13835, 14407, 14915, 15354, 15719, 16007, 16215, 16341, 16383,\
+		16383, 16351, 16257, 16101, 15885, 15611, 15282, 14901, 14472, 14000, 13489, 12945, 12373, 11779, 11170, 10550,\
+		9928, 9309, 8699, 8105, 7533, 6989, 6479, 6006, 5578, 5197, 4867, 4593, 4377, 4221, 4127, 4095,\
+		4095, 4137, 4263, 4471, 4759, 5125, 5564, 6072, 6643, 7273, 7954, 8680, 9442, 10234, 11047, 11872,\
+		12702, 13528, 14340, 15132, 15895, 16620, 17301, 17931, 18503, 19011, 19450, 19815, 20103, 20311, 20437, 20479,\
+		20479, 20447, 20353, 20197, 19981, 19707, 19378, 18997, 18568, 18096, 17585, 17041, 16469, 15875, 15265, 14646,\
+		14024, 13405, 12795, 12201, 11629, 11085, 10574, 10102, 9673, 9292, 8963, 8689, 8473, 8317, 8223, 8191,\
+		8191, 8233, 8359, 8567, 8855, 9221, 9660, 10167, 10739, 11369, 12050, 12775, 13538, 14330, 15143, 15968,\
+		16798, 17623, 18436, 19228, 19991, 20716, 21397, 22027, 22599, 23106, 23545, 23911, 24199, 24407, 24533, 24575,\
+		24575, 24543, 24449, 24293, 24077, 23803, 23474, 23093, 22664, 22192, 21681, 21137, 20565, 19971, 19361, 18742,\
+		18120, 17501, 16891, 16297, 15725, 15181, 14670, 14198, 13769, 13388, 13059, 12785, 12569, 12413, 12319, 12287,\
+		12287, 12329, 12455, 12663, 12951, 13316, 13755, 14263, 14835, 15465, 16146, 16871, 17634, 18426, 19238, 20064,\
+		20894, 21719, 22532, 23324, 24086, 24812, 25493, 26123, 26694, 27202, 27641, 28007, 28295, 28503, 28629, 28671,\
+		28671, 28681, 28713, 28765, 28837, 28928, 29038, 29165, 29308, 29465, 29635, 29817, 30007, 30205, 30408, 30615,\
+		30822, 31029, 31232, 31430, 31620, 31802, 31972, 32130, 32272, 32399, 32509, 32601, 32673, 32725, 32756, 32767,\
+		32767}
+
+	#define half_sines_attack2 {\
+		0, 21, 83, 187, 331, 514, 734, 988, 1273, 1588, 1929, 2292, 2673, 3069, 3475, 3888,\
+		4303, 4716, 5122, 5518, 5899, 6262, 6602, 6917, 7203, 7457, 7677, 7859, 8003, 8107, 8170, 8191,\
+		8191, 8212, 8275, 8379, 8523, 8706, 8925, 9179, 9465, 9780, 10121, 10483, 10865, 11260, 11667, 12080,\
+		12495, 12907, 13314, 13710, 14091, 14454, 14794, 15109, 15395, 15649, 15868, 16051, 16195, 16299, 16362, 16383,\
+		16383, 16404, 16467, 16571, 16715, 16898, 17117, 17371, 17657, 17972, 18312, 18675, 19056, 19452, 19859, 20271,\
+		20686, 21099, 21506, 21901, 22283, 22645, 22986, 23301, 23587, 23841, 24060, 24243, 24387, 24491, 24554, 24575,\
+		24575, 24522, 24365, 24105, 23745, 23288, 22739, 22105, 21390, 20603, 19751, 18845, 17891, 16902, 15886, 14854,\
+		13816, 12784, 11768, 10779, 9826, 8919, 8067, 7280, 6566, 5931, 5382, 4925, 4565, 4305, 4148, 4095,\
+		4095, 4116, 4179, 4283, 4427, 4610, 4830, 5083, 5369, 5684, 6025, 6387, 6769, 7165, 7571, 7984,\
+		8399, 8811, 9218, 9614, 9995, 10358, 10698, 11013, 11299, 11553, 11772, 11955, 12099, 12203, 12266, 12287,\
+		12287, 12308, 12371, 12475, 12619, 12802, 13021, 13275, 13561, 13876, 14216, 14579, 14960, 15356, 15763, 16176,\
+		16590, 17003, 17410, 17806, 18187, 18550, 18890, 19205, 19491, 19745, 19964, 20147, 20291, 20395, 20458, 20479,\
+		20479, 20500, 20563, 20667, 20811, 20994, 21213, 21467, 21753, 22068, 22408, 22771, 23152, 23548, 23955, 24367,\
+		24782, 25195, 25601, 25997, 26379, 26741, 27082, 27397, 27683, 27936, 28156, 28339, 28483, 28587, 28650, 28671,\
+		28671, 28681, 28713, 28765, 28837, 28928, 29038, 29165, 29308, 29465, 29635, 29817, 30007, 30205, 30408, 30615,\
+		30822, 31029, 31232, 31430, 31620, 31802, 31972, 32130, 32272, 32399, 32509, 32601, 32673, 32725, 32756, 32767,\
+		32766}
+
+	#define half_sines_attack3 {\
+		0, 31, 125, 281, 497, 771, 1101, 1482, 1910, 2383, 2893, 3438, 4010, 4603, 5213, 5832,\
+		6454, 7074, 7683, 8277, 8849, 9393, 9904, 10376, 10805, 11186, 11515, 11789, 12005, 12161, 12256, 12287,\
+		12287, 12319, 12413, 12569, 12785, 13059, 13388, 13769, 14198, 14670, 15181, 15725, 16297, 16891, 17501, 18120,\
+		18742, 19361, 19971, 20565, 21137, 21681, 22192, 22664, 23093, 23474, 23803, 24077, 24293, 24449, 24543, 24575,\
+		24575, 24522, 24365, 24105, 23745, 23288, 22739, 22105, 21390, 20603, 19751, 18845, 17891, 16902, 15886, 14854,\
+		13816, 12784, 11768, 10779, 9826, 8919, 8067, 7280, 6566, 5931, 5382, 4925, 4565, 4305, 4148, 4095,\
+		4095, 4127, 4221, 4377, 4593, 4867, 5197, 5578, 6006, 6479, 6989, 7533, 8105, 8699, 9309, 9928,\
+		10550, 11170, 11779, 12373, 12945, 13489, 14000, 14472, 14901, 15282, 15611, 15885, 16101, 16257, 16351, 16383,\
+		16383, 16415, 16509, 16665, 16881, 17155, 17484, 17865, 18294, 18766, 19277, 19821, 20393, 20987, 21596, 22216,\
+		22838, 23457, 24067, 24661, 25233, 25777, 26287, 26760, 27188, 27569, 27899, 28173, 28389, 28545, 28639, 28671,\
+		28671, 28618, 28461, 28201, 27841, 27384, 26835, 26200, 25486, 24699, 23847, 22940, 21987, 20998, 19982, 18950,\
+		17912, 16880, 15864, 14875, 13921, 13015, 12163, 11376, 10661, 10027, 9478, 9021, 8661, 8401, 8244, 8191,\
+		8191, 8223, 8317, 8473, 8689, 8963, 9292, 9673, 10102, 10574, 11085, 11629, 12201, 12795, 13405, 14024,\
+		14646, 15265, 15875, 16469, 17041, 17585, 18096, 18568, 18997, 19378, 19707, 19981, 20197, 20353, 20447, 20479,\
+		20479, 20510, 20605, 20761, 20977, 21251, 21580, 21961, 22390, 22862, 23373, 23917, 24489, 25083, 25692, 26312,\
+		26934, 27553, 28163, 28756, 29328, 29873, 30383, 30856, 31284, 31665, 31995, 32269, 32485, 32641, 32735, 32766,\
+		32767}
+
+	#define half_sines_attack4 {\
+		0, 31, 125, 281, 497, 771, 1101, 1482, 1910, 2383, 2893, 3438, 4010, 4603, 5213, 5832,\
+		6454, 7074, 7683, 8277, 8849, 9393, 9904, 10376, 10805, 11186, 11515, 11789, 12005, 12161, 12256, 12287,\
+		12287, 12319, 12413, 12569, 12785, 13059, 13388, 13769, 14198, 14670, 15181, 15725, 16297, 16891, 17501, 18120,\
+		18742, 19361, 19971, 20565, 21137, 21681, 22192, 22664, 23093, 23474, 23803, 24077, 24293, 24449, 24543, 24575,\
+		24575, 24554, 24491, 24387, 24243, 24060, 23841, 23587, 23301, 22986, 22645, 22283, 21901, 21506, 21099, 20686,\
+		20271, 19859, 19452, 19056, 18675, 18312, 17972, 17657, 17371, 17117, 16898, 16715, 16571, 16467, 16404, 16383,\
+		16383, 16362, 16299, 16195, 16051, 15868, 15649, 15395, 15109, 14794, 14454, 14091, 13710, 13314, 12907, 12495,\
+		12080, 11667, 11260, 10865, 10483, 10121, 9780, 9465, 9179, 8925, 8706, 8523, 8379, 8275, 8212, 8191,\
+		8191, 8223, 8317, 8473, 8689, 8963, 9292, 9673, 10102, 10574, 11085, 11629, 12201, 12795, 13405, 14024,\
+		14646, 15265, 15875, 16469, 17041, 17585, 18096, 18568, 18997, 19378, 19707, 19981, 20197, 20353, 20447, 20479,\
+		20479, 20500, 20563, 20667, 20811, 20994, 21213, 21467, 21753, 22068, 22408, 22771, 23152, 23548, 23955, 24367,\
+		24782, 25195, 25601, 25997, 26379, 26741, 27082, 27397, 27683, 27936, 28156, 28339, 28483, 28587, 28650, 28671,\
+		28671, 28660, 28629, 28577, 28505, 28413, 28304, 28177, 28034, 27876, 27706, 27525, 27334, 27136, 26933, 26726,\
+		26519, 26313, 26109, 25911, 25721, 25539, 25369, 25212, 25069, 24942, 24832, 24741, 24669, 24617, 24585, 24575,\
+		24575, 24596, 24659, 24763, 24907, 25089, 25309, 25563, 25849, 26164, 26504, 26867, 27248, 27644, 28050, 28463,\
+		28878, 29291, 29697, 30093, 30474, 30837, 31178, 31493, 31778, 32032, 32252, 32435, 32579, 32683, 32745, 32766,\
+		32767}
+
+	#define half_sines_attack5 {\
+		0, 21, 83, 187, 331, 514, 734, 988, 1273, 1588, 1929, 2292, 2673, 3069, 3475, 3888,\
+		4303, 4716, 5122, 5518, 5899, 6262, 6602, 6917, 7203, 7457, 7677, 7859, 8003, 8107, 8170, 8191,\
+		8191, 8212, 8275, 8379, 8523, 8706, 8925, 9179, 9465, 9780, 10121, 10483, 10865, 11260, 11667, 12080,\
+		12495, 12907, 13314, 13710, 14091, 14454, 14794, 15109, 15395, 15649, 15868, 16051, 16195, 16299, 16362, 16383,\
+		16383, 16404, 16467, 16571, 16715, 16898, 17117, 17371, 17657, 17972, 18312, 18675, 19056, 19452, 19859, 20271,\
+		20686, 21099, 21506, 21901, 22283, 22645, 22986, 23301, 23587, 23841, 24060, 24243, 24387, 24491, 24554, 24575,\
+		24575, 24564, 24533, 24481, 24409, 24317, 24208, 24081, 23938, 23780, 23610, 23429, 23238, 23040, 22837, 22631,\
+		22423, 22217, 22013, 21816, 21625, 21444, 21273, 21116, 20973, 20846, 20736, 20645, 20573, 20521, 20489, 20479,\
+		20479, 20458, 20395, 20291, 20147, 19964, 19745, 19491, 19205, 18890, 18550, 18187, 17806, 17410, 17003, 16590,\
+		16176, 15763, 15356, 14960, 14579, 14216, 13876, 13561, 13275, 13021, 12802, 12619, 12475, 12371, 12308, 12287,\
+		12287, 12266, 12203, 12099, 11955, 11772, 11553, 11299, 11013, 10698, 10358, 9995, 9614, 9218, 8811, 8399,\
+		7984, 7571, 7165, 6769, 6387, 6025, 5684, 5369, 5083, 4830, 4610, 4427, 4283, 4179, 4116, 4095,\
+		4095, 4158, 4347, 4659, 5091, 5639, 6298, 7060, 7917, 8862, 9883, 10972, 12115, 13303, 14522, 15761,\
+		17005, 18244, 19463, 20651, 21794, 22883, 23904, 24849, 25706, 26468, 27127, 27675, 28107, 28419, 28608, 28671,\
+		28671, 28681, 28713, 28765, 28837, 28928, 29038, 29165, 29308, 29465, 29635, 29817, 30007, 30205, 30408, 30615,\
+		30822, 31029, 31232, 31430, 31620, 31802, 31972, 32130, 32272, 32399, 32509, 32601, 32673, 32725, 32756, 32767,\
+		32766}
+
+	#define half_sines_attack6 {\
+		0, 10, 41, 93, 165, 257, 367, 494, 636, 794, 964, 1146, 1336, 1534, 1737, 1944,\
+		2151, 2358, 2561, 2759, 2949, 3131, 3301, 3458, 3601, 3728, 3838, 3929, 4001, 4053, 4085, 4095,\
+		4095, 4137, 4263, 4471, 4759, 5125, 5564, 6072, 6643, 7273, 7954, 8680, 9442, 10234, 11047, 11872,\
+		12702, 13528, 14340, 15132, 15895, 16620, 17301, 17931, 18503, 19011, 19450, 19815, 20103, 20311, 20437, 20479,\
+		20479, 20500, 20563, 20667, 20811, 20994, 21213, 21467, 21753, 22068, 22408, 22771, 23152, 23548, 23955, 24367,\
+		24782, 25195, 25601, 25997, 26379, 26741, 27082, 27397, 27683, 27936, 28156, 28339, 28483, 28587, 28650, 28671,\
+		28671, 28660, 28629, 28577, 28505, 28413, 28304, 28177, 28034, 27876, 27706, 27525, 27334, 27136, 26933, 26726,\
+		26519, 26313, 26109, 25911, 25721, 25539, 25369, 25212, 25069, 24942, 24832, 24741, 24669, 24617, 24585, 24575,\
+		24575, 24543, 24449, 24293, 24077, 23803, 23474, 23093, 22664, 22192, 21681, 21137, 20565, 19971, 19361, 18742,\
+		18120, 17501, 16891, 16297, 15725, 15181, 14670, 14198, 13769, 13388, 13059, 12785, 12569, 12413, 12319, 12287,\
+		12287, 12277, 12245, 12193, 12121, 12030, 11920, 11793, 11650, 11493, 11322, 11141, 10950, 10753, 10549, 10343,\
+		10135, 9929, 9726, 9528, 9337, 9156, 8986, 8828, 8685, 8558, 8449, 8357, 8285, 8233, 8202, 8191,\
+		8191, 8212, 8275, 8379, 8523, 8706, 8925, 9179, 9465, 9780, 10121, 10483, 10865, 11260, 11667, 12080,\
+		12495, 12907, 13314, 13710, 14091, 14454, 14794, 15109, 15395, 15649, 15868, 16051, 16195, 16299, 16362, 16383,\
+		16383, 16425, 16551, 16759, 17047, 17412, 17851, 18359, 18931, 19561, 20242, 20967, 21730, 22521, 23334, 24160,\
+		24990, 25815, 26628, 27420, 28182, 28908, 29589, 30219, 30790, 31298, 31737, 32103, 32391, 32599, 32724, 32767,\
+		32767}
+
+	#define half_sines_attack7 {\
+		0, 73, 293, 657, 1161, 1801, 2569, 3458, 4458, 5560, 6752, 8022, 9356, 10742, 12164, 13609,\
+		15061, 16506, 17928, 19314, 20648, 21918, 23110, 24212, 25212, 26101, 26869, 27509, 28013, 28377, 28597, 28671,\
+		28671, 28608, 28419, 28107, 27675, 27127, 26468, 25706, 24849, 23904, 22883, 21794, 20651, 19463, 18244, 17005,\
+		15761, 14522, 13303, 12115, 10972, 9883, 8862, 7917, 7060, 6298, 5639, 5091, 4659, 4347, 4158, 4095,\
+		4095, 4148, 4305, 4565, 4925, 5382, 5931, 6566, 7280, 8067, 8919, 9826, 10779, 11768, 12784, 13816,\
+		14854, 15886, 16902, 17891, 18845, 19751, 20603, 21390, 22105, 22739, 23288, 23745, 24105, 24365, 24522, 24575,\
+		24575, 24564, 24533, 24481, 24409, 24317, 24208, 24081, 23938, 23780, 23610, 23429, 23238, 23040, 22837, 22631,\
+		22423, 22217, 22013, 21816, 21625, 21444, 21273, 21116, 20973, 20846, 20736, 20645, 20573, 20521, 20489, 20479,\
+		20479, 20447, 20353, 20197, 19981, 19707, 19378, 18997, 18568, 18096, 17585, 17041, 16469, 15875, 15265, 14646,\
+		14024, 13405, 12795, 12201, 11629, 11085, 10574, 10102, 9673, 9292, 8963, 8689, 8473, 8317, 8223, 8191,\
+		8191, 8212, 8275, 8379, 8523, 8706, 8925, 9179, 9465, 9780, 10121, 10483, 10865, 11260, 11667, 12080,\
+		12495, 12907, 13314, 13710, 14091, 14454, 14794, 15109, 15395, 15649, 15868, 16051, 16195, 16299, 16362, 16383,\
+		16383, 16372, 16341, 16289, 16217, 16126, 16016, 15889, 15746, 15589, 15418, 15237, 15046, 14848, 14645, 14439,\
+		14231, 14025, 13822, 13624, 13433, 13252, 13082, 12924, 12781, 12654, 12544, 12453, 12381, 12329, 12298, 12287,\
+		12287, 12340, 12497, 12757, 13117, 13574, 14122, 14757, 15472, 16259, 17110, 18017, 18971, 19960, 20976, 22008,\
+		23045, 24077, 25093, 26083, 27036, 27943, 28795, 29582, 30296, 30931, 31480, 31937, 32297, 32557, 32714, 32767,\
+		32767}
+
+	#define half_sines_attack8 {\
+		0, 10, 41, 93, 165, 257, 367, 494, 636, 794, 964, 1146, 1336, 1534, 1737, 1944,\
+		2151, 2358, 2561, 2759, 2949, 3131, 3301, 3458, 3601, 3728, 3838, 3929, 4001, 4053, 4085, 4095,\
+		4095, 4085, 4053, 4001, 3929, 3838, 3728, 3601, 3458, 3301, 3131, 2949, 2759, 2561, 2358, 2151,\
+		1944, 1737, 1534, 1336, 1146, 964, 794, 636, 494, 367, 257, 165, 93, 41, 10, 0,\
+		0, 31, 125, 281, 497, 771, 1101, 1482, 1910, 2383, 2893, 3438, 4010, 4603, 5213, 5832,\
+		6454, 7074, 7683, 8277, 8849, 9393, 9904, 10376, 10805, 11186, 11515, 11789, 12005, 12161, 12256, 12287,\
+		12287, 12256, 12161, 12005, 11789, 11515, 11186, 10805, 10376, 9904, 9393, 8849, 8277, 7683, 7074, 6454,\
+		5832, 5213, 4603, 4010, 3438, 2893, 2383, 1910, 1482, 1101, 771, 497, 281, 125, 31, 0,\
+		0, 52, 209, 469, 829, 1286, 1835, 2470, 3184, 3971, 4823, 5730, 6683, 7673, 8689, 9721,\
+		10758, 11790, 12806, 13795, 14749, 15656, 16507, 17294, 18009, 18644, 19192, 19649, 20009, 20269, 20426, 20479,\
+		20479, 20426, 20269, 20009, 19649, 19192, 18644, 18009, 17294, 16507, 15656, 14749, 13795, 12806, 11790, 10758,\
+		9721, 8689, 7673, 6683, 5730, 4823, 3971, 3184, 2470, 1835, 1286, 829, 469, 209, 52, 0,\
+		0, 73, 293, 657, 1161, 1801, 2569, 3458, 4458, 5560, 6752, 8022, 9356, 10742, 12164, 13609,\
+		15061, 16506, 17928, 19314, 20648, 21918, 23110, 24212, 25212, 26101, 26869, 27509, 28013, 28377, 28597, 28671,\
+		28671, 28681, 28713, 28765, 28837, 28928, 29038, 29165, 29308, 29465, 29635, 29817, 30007, 30205, 30408, 30615,\
+		30822, 31029, 31232, 31430, 31620, 31802, 31972, 32130, 32272, 32399, 32509, 32601, 32673, 32725, 32756, 32767,\
+		32766}
+
+	#define half_sines_release0 {\
+		0, 0, 10, 41, 93, 165, 257, 367, 494, 636, 794, 964, 1146, 1336, 1534, 1737,\
+		1944, 2151, 2358, 2561, 2759, 2949, 3131, 3301, 3458, 3601, 3728, 3838, 3929, 4001, 4053, 4085,\
+		4095, 4095, 4106, 4137, 4189, 4261, 4353, 4462, 4589, 4732, 4890, 5060, 5241, 5432, 5630, 5833,\
+		6040, 6247, 6453, 6657, 6855, 7045, 7227, 7397, 7554, 7697, 7824, 7934, 8025, 8097, 8149, 8181,\
+		8191, 8191, 8202, 8233, 8285, 8357, 8449, 8558, 8685, 8828, 8986, 9156, 9337, 9528, 9726, 9929,\
+		10135, 10343, 10549, 10753, 10950, 11141, 11322, 11493, 11650, 11793, 11920, 12030, 12121, 12193, 12245, 12277,\
+		12287, 12287, 12298, 12329, 12381, 12453, 12544, 12654, 12781, 12924, 13082, 13252, 13433, 13624, 13822, 14025,\
+		14231, 14439, 14645, 14848, 15046, 15237, 15418, 15589, 15746, 15889, 16016, 16126, 16217, 16289, 16341, 16372,\
+		16383, 16383, 16394, 16425, 16477, 16549, 16640, 16750, 16877, 17020, 17177, 17348, 17529, 17720, 17918, 18121,\
+		18327, 18535, 18741, 18944, 19142, 19333, 19514, 19684, 19842, 19985, 20112, 20222, 20313, 20385, 20437, 20468,\
+		20479, 20479, 20489, 20521, 20573, 20645, 20736, 20846, 20973, 21116, 21273, 21444, 21625, 21816, 22013, 22217,\
+		22423, 22631, 22837, 23040, 23238, 23429, 23610, 23780, 23938, 24081, 24208, 24317, 24409, 24481, 24533, 24564,\
+		24575, 24575, 24585, 24617, 24669, 24741, 24832, 24942, 25069, 25212, 25369, 25539, 25721, 25911, 26109, 26313,\
+		26519, 26726, 26933, 27136, 27334, 27525, 27706, 27876, 28034, 28177, 28304, 28413, 28505, 28577, 28629, 28660,\
+		28671, 28671, 28681, 28713, 28765, 28837, 28928, 29038, 29165, 29308, 29465, 29635, 29817, 30007, 30205, 30408,\
+		30615, 30822, 31029, 31232, 31430, 31620, 31802, 31972, 32130, 32272, 32399, 32509, 32601, 32673, 32725, 32756,\
+		32767}
+
+	#define half_sines_release1 {\
+		0, 0, 10, 41, 93, 165, 257, 367, 494, 636, 794, 964, 1146, 1336, 1534, 1737,\
+		1944, 2151, 2358, 2561, 2759, 2949, 3131, 3301, 3458, 3601, 3728, 3838, 3929, 4001, 4053, 4085,\
+		4095, 4095, 4137, 4263, 4471, 4759, 5125, 5564, 6072, 6643, 7273, 7954, 8680, 9442, 10234, 11047,\
+		11872, 12702, 13528, 14340, 15132, 15895, 16620, 17301, 17931, 18503, 19011, 19450, 19815, 20103, 20311, 20437,\
+		20479, 20479, 20447, 20353, 20197, 19981, 19707, 19378, 18997, 18568, 18096, 17585, 17041, 16469, 15875, 15265,\
+		14646, 14024, 13405, 12795, 12201, 11629, 11085, 10574, 10102, 9673, 9292, 8963, 8689, 8473, 8317, 8223,\
+		8191, 8191, 8233, 8359, 8567, 8855, 9221, 9660, 10167, 10739, 11369, 12050, 12775, 13538, 14330, 15143,\
+		15968, 16798, 17623, 18436, 19228, 19991, 20716, 21397, 22027, 22599, 23106, 23545, 23911, 24199, 24407, 24533,\
+		24575, 24575, 24543, 24449, 24293, 24077, 23803, 23474, 23093, 22664, 22192, 21681, 21137, 20565, 19971, 19361,\
+		18742, 18120, 17501, 16891, 16297, 15725, 15181, 14670, 14198, 13769, 13388, 13059, 12785, 12569, 12413, 12319,\
+		12287, 12287, 12329, 12455, 12663, 12951, 13316, 13755, 14263, 14835, 15465, 16146, 16871, 17634, 18426, 19238,\
+		20064, 20894, 21719, 22532, 23324, 24086, 24812, 25493, 26123, 26694, 27202, 27641, 28007, 28295, 28503, 28629,\
+		28671, 28671, 28639, 28545, 28389, 28173, 27899, 27569, 27188, 26760, 26287, 25777, 25233, 24661, 24067, 23457,\
+		22838, 22216, 21596, 20987, 20393, 19821, 19277, 18766, 18294, 17865, 17484, 17155, 16881, 16665, 16509, 16415,\
+		16383, 16383, 16425, 16551, 16759, 17047, 17412, 17851, 18359, 18931, 19561, 20242, 20967, 21730, 22521, 23334,\
+		24160, 24990, 25815, 26628, 27420, 28182, 28908, 29589, 30219, 30790, 31298, 31737, 32103, 32391, 32599, 32724,\
+		32767}
+
+	#define half_sines_release2 {\
+		0, 0, 10, 41, 93, 165, 257, 367, 494, 636, 794, 964, 1146, 1336, 1534, 1737,\
+		1944, 2151, 2358, 2561, 2759, 2949, 3131, 3301, 3458, 3601, 3728, 3838, 3929, 4001, 4053, 4085,\
+		4095, 4095, 4116, 4179, 4283, 4427, 4610, 4830, 5083, 5369, 5684, 6025, 6387, 6769, 7165, 7571,\
+		7984, 8399, 8811, 9218, 9614, 9995, 10358, 10698, 11013, 11299, 11553, 11772, 11955, 12099, 12203, 12266,\
+		12287, 12287, 12308, 12371, 12475, 12619, 12802, 13021, 13275, 13561, 13876, 14216, 14579, 14960, 15356, 15763,\
+		16176, 16590, 17003, 17410, 17806, 18187, 18550, 18890, 19205, 19491, 19745, 19964, 20147, 20291, 20395, 20458,\
+		20479, 20479, 20500, 20563, 20667, 20811, 20994, 21213, 21467, 21753, 22068, 22408, 22771, 23152, 23548, 23955,\
+		24367, 24782, 25195, 25601, 25997, 26379, 26741, 27082, 27397, 27683, 27936, 28156, 28339, 28483, 28587, 28650,\
+		28671, 28671, 28618, 28461, 28201, 27841, 27384, 26835, 26200, 25486, 24699, 23847, 22940, 21987, 20998, 19982,\
+		18950, 17912, 16880, 15864, 14875, 13921, 13015, 12163, 11376, 10661, 10027, 9478, 9021, 8661, 8401, 8244,\
+		8191, 8191, 8212, 8275, 8379, 8523, 8706, 8925, 9179, 9465, 9780, 10121, 10483, 10865, 11260, 11667,\
+		12080, 12495, 12907, 13314, 13710, 14091, 14454, 14794, 15109, 15395, 15649, 15868, 16051, 16195, 16299, 16362,\
+		16383, 16383, 16404, 16467, 16571, 16715, 16898, 17117, 17371, 17657, 17972, 18312, 18675, 19056, 19452, 19859,\
+		20271, 20686, 21099, 21506, 21901, 22283, 22645, 22986, 23301, 23587, 23841, 24060, 24243, 24387, 24491, 24554,\
+		24575, 24575, 24596, 24659, 24763, 24907, 25089, 25309, 25563, 25849, 26164, 26504, 26867, 27248, 27644, 28050,\
+		28463, 28878, 29291, 29697, 30093, 30474, 30837, 31178, 31493, 31778, 32032, 32252, 32435, 32579, 32683, 32745,\
+		32766}
+
+	#define half_sines_release3 {\
+		0, 0, 31, 125, 281, 497, 771, 1101, 1482, 1910, 2383, 2893, 3438, 4010, 4603, 5213,\
+		5832, 6454, 7074, 7683, 8277, 8849, 9393, 9904, 10376, 10805, 11186, 11515, 11789, 12005, 12161, 12256,\
+		12287, 12287, 12319, 12413, 12569, 12785, 13059, 13388, 13769, 14198, 14670, 15181, 15725, 16297, 16891, 17501,\
+		18120, 18742, 19361, 19971, 20565, 21137, 21681, 22192, 22664, 23093, 23474, 23803, 24077, 24293, 24449, 24543,\
+		24575, 24575, 24522, 24365, 24105, 23745, 23288, 22739, 22105, 21390, 20603, 19751, 18845, 17891, 16902, 15886,\
+		14854, 13816, 12784, 11768, 10779, 9826, 8919, 8067, 7280, 6566, 5931, 5382, 4925, 4565, 4305, 4148,\
+		4095, 4095, 4127, 4221, 4377, 4593, 4867, 5197, 5578, 6006, 6479, 6989, 7533, 8105, 8699, 9309,\
+		9928, 10550, 11170, 11779, 12373, 12945, 13489, 14000, 14472, 14901, 15282, 15611, 15885, 16101, 16257, 16351,\
+		16383, 16383, 16415, 16509, 16665, 16881, 17155, 17484, 17865, 18294, 18766, 19277, 19821, 20393, 20987, 21596,\
+		22216, 22838, 23457, 24067, 24661, 25233, 25777, 26287, 26760, 27188, 27569, 27899, 28173, 28389, 28545, 28639,\
+		28671, 28671, 28618, 28461, 28201, 27841, 27384, 26835, 26200, 25486, 24699, 23847, 22940, 21987, 20998, 19982,\
+		18950, 17912, 16880, 15864, 14875, 13921, 13015, 12163, 11376, 10661, 10027, 9478, 9021, 8661, 8401, 8244,\
+		8191, 8191, 8223, 8317, 8473, 8689, 8963, 9292, 9673, 10102, 10574, 11085, 11629, 12201, 12795, 13405,\
+		14024, 14646, 15265, 15875, 16469, 17041, 17585, 18096, 18568, 18997, 19378, 19707, 19981, 20197, 20353, 20447,\
+		20479, 20479, 20510, 20605, 20761, 20977, 21251, 21580, 21961, 22390, 22862, 23373, 23917, 24489, 25083, 25692,\
+		26312, 26934, 27553, 28163, 28756, 29328, 29873, 30383, 30856, 31284, 31665, 31995, 32269, 32485, 32641, 32735,\
+		32767}
+
+	#define half_sines_release4 {\
+		0, 0, 10, 41, 93, 165, 257, 367, 494, 636, 794, 964, 1146, 1336, 1534, 1737,\
+		1944, 2151, 2358, 2561, 2759, 2949, 3131, 3301, 3458, 3601, 3728, 3838, 3929, 4001, 4053, 4085,\
+		4095, 4095, 4116, 4179, 4283, 4427, 4610, 4830, 5083, 5369, 5684, 6025, 6387, 6769, 7165, 7571,\
+		7984, 8399, 8811, 9218, 9614, 9995, 10358, 10698, 11013, 11299, 11553, 11772, 11955, 12099, 12203, 12266,\
+		12287, 12287, 12319, 12413, 12569, 12785, 13059, 13388, 13769, 14198, 14670, 15181, 15725, 16297, 16891, 17501,\
+		18120, 18742, 19361, 19971, 20565, 21137, 21681, 22192, 22664, 23093, 23474, 23803, 24077, 24293, 24449, 24543,\
+		24575, 24575, 24533, 24407, 24199, 23911, 23545, 23106, 22599, 22027, 21397, 20716, 19991, 19228, 18436, 17623,\
+		16798, 15968, 15143, 14330, 13538, 12775, 12050, 11369, 10739, 10167, 9660, 9221, 8855, 8567, 8359, 8233,\
+		8191, 8191, 8223, 8317, 8473, 8689, 8963, 9292, 9673, 10102, 10574, 11085, 11629, 12201, 12795, 13405,\
+		14024, 14646, 15265, 15875, 16469, 17041, 17585, 18096, 18568, 18997, 19378, 19707, 19981, 20197, 20353, 20447,\
+		20479, 20479, 20500, 20563, 20667, 20811, 20994, 21213, 21467, 21753, 22068, 22408, 22771, 23152, 23548, 23955,\
+		24367, 24782, 25195, 25601, 25997, 26379, 26741, 27082, 27397, 27683, 27936, 28156, 28339, 28483, 28587, 28650,\
+		28671, 28671, 28660, 28629, 28577, 28505, 28413, 28304, 28177, 28034, 27876, 27706, 27525, 27334, 27136, 26933,\
+		26726, 26519, 26313, 26109, 25911, 25721, 25539, 25369, 25212, 25069, 24942, 24832, 24741, 24669, 24617, 24585,\
+		24575, 24575, 24596, 24659, 24763, 24907, 25089, 25309, 25563, 25849, 26164, 26504, 26867, 27248, 27644, 28050,\
+		28463, 28878, 29291, 29697, 30093, 30474, 30837, 31178, 31493, 31778, 32032, 32252, 32435, 32579, 32683, 32745,\
+		32767}
+
+	#define half_sines_release5 {\
+		0, 0, 10, 41, 93, 165, 257, 367, 494, 636, 794, 964, 1146, 1336, 1534, 1737,\
+		1944, 2151, 2358, 2561, 2759, 2949, 3131, 3301, 3458, 3601, 3728, 3838, 3929, 4001, 4053, 4085,\
+		4095, 4095, 4158, 4347, 4659, 5091, 5639, 6298, 7060, 7917, 8862, 9883, 10972, 12115, 13303, 14522,\
+		15761, 17005, 18244, 19463, 20651, 21794, 22883, 23904, 24849, 25706, 26468, 27127, 27675, 28107, 28419, 28608,\
+		28671, 28671, 28650, 28587, 28483, 28339, 28156, 27936, 27683, 27397, 27082, 26741, 26379, 25997, 25601, 25195,\
+		24782, 24367, 23955, 23548, 23152, 22771, 22408, 22068, 21753, 21467, 21213, 20994, 20811, 20667, 20563, 20500,\
+		20479, 20479, 20458, 20395, 20291, 20147, 19964, 19745, 19491, 19205, 18890, 18550, 18187, 17806, 17410, 17003,\
+		16590, 16176, 15763, 15356, 14960, 14579, 14216, 13876, 13561, 13275, 13021, 12802, 12619, 12475, 12371, 12308,\
+		12287, 12287, 12277, 12245, 12193, 12121, 12030, 11920, 11793, 11650, 11493, 11322, 11141, 10950, 10753, 10549,\
+		10343, 10135, 9929, 9726, 9528, 9337, 9156, 8986, 8828, 8685, 8558, 8449, 8357, 8285, 8233, 8202,\
+		8191, 8191, 8212, 8275, 8379, 8523, 8706, 8925, 9179, 9465, 9780, 10121, 10483, 10865, 11260, 11667,\
+		12080, 12495, 12907, 13314, 13710, 14091, 14454, 14794, 15109, 15395, 15649, 15868, 16051, 16195, 16299, 16362,\
+		16383, 16383, 16404, 16467, 16571, 16715, 16898, 17117, 17371, 17657, 17972, 18312, 18675, 19056, 19452, 19859,\
+		20271, 20686, 21099, 21506, 21901, 22283, 22645, 22986, 23301, 23587, 23841, 24060, 24243, 24387, 24491, 24554,\
+		24575, 24575, 24596, 24659, 24763, 24907, 25089, 25309, 25563, 25849, 26164, 26504, 26867, 27248, 27644, 28050,\
+		28463, 28878, 29291, 29697, 30093, 30474, 30837, 31178, 31493, 31778, 32032, 32252, 32435, 32579, 32683, 32745,\
+		32766}
+
+	#define half_sines_release6 {\
+		0, 0, 42, 167, 375, 663, 1029, 1468, 1976, 2547, 3177, 3858, 4584, 5346, 6138, 6951,\
+		7776, 8606, 9432, 10245, 11036, 11799, 12524, 13205, 13835, 14407, 14915, 15354, 15719, 16007, 16215, 16341,\
+		16383, 16383, 16404, 16467, 16571, 16715, 16898, 17117, 17371, 17657, 17972, 18312, 18675, 19056, 19452, 19859,\
+		20271, 20686, 21099, 21506, 21901, 22283, 22645, 22986, 23301, 23587, 23841, 24060, 24243, 24387, 24491, 24554,\
+		24575, 24575, 24564, 24533, 24481, 24409, 24317, 24208, 24081, 23938, 23780, 23610, 23429, 23238, 23040, 22837,\
+		22631, 22423, 22217, 22013, 21816, 21625, 21444, 21273, 21116, 20973, 20846, 20736, 20645, 20573, 20521, 20489,\
+		20479, 20479, 20447, 20353, 20197, 19981, 19707, 19378, 18997, 18568, 18096, 17585, 17041, 16469, 15875, 15265,\
+		14646, 14024, 13405, 12795, 12201, 11629, 11085, 10574, 10102, 9673, 9292, 8963, 8689, 8473, 8317, 8223,\
+		8191, 8191, 8181, 8149, 8097, 8025, 7934, 7824, 7697, 7554, 7397, 7227, 7045, 6855, 6657, 6453,\
+		6247, 6040, 5833, 5630, 5432, 5241, 5060, 4890, 4732, 4589, 4462, 4353, 4261, 4189, 4137, 4106,\
+		4095, 4095, 4116, 4179, 4283, 4427, 4610, 4830, 5083, 5369, 5684, 6025, 6387, 6769, 7165, 7571,\
+		7984, 8399, 8811, 9218, 9614, 9995, 10358, 10698, 11013, 11299, 11553, 11772, 11955, 12099, 12203, 12266,\
+		12287, 12287, 12329, 12455, 12663, 12951, 13316, 13755, 14263, 14835, 15465, 16146, 16871, 17634, 18426, 19238,\
+		20064, 20894, 21719, 22532, 23324, 24086, 24812, 25493, 26123, 26694, 27202, 27641, 28007, 28295, 28503, 28629,\
+		28671, 28671, 28681, 28713, 28765, 28837, 28928, 29038, 29165, 29308, 29465, 29635, 29817, 30007, 30205, 30408,\
+		30615, 30822, 31029, 31232, 31430, 31620, 31802, 31972, 32130, 32272, 32399, 32509, 32601, 32673, 32725, 32756,\
+		32767}
+
+	#define half_sines_release7 {\
+		0, 0, 42, 167, 375, 663, 1029, 1468, 1976, 2547, 3177, 3858, 4584, 5346, 6138, 6951,\
+		7776, 8606, 9432, 10245, 11036, 11799, 12524, 13205, 13835, 14407, 14915, 15354, 15719, 16007, 16215, 16341,\
+		16383, 16383, 16394, 16425, 16477, 16549, 16640, 16750, 16877, 17020, 17177, 17348, 17529, 17720, 17918, 18121,\
+		18327, 18535, 18741, 18944, 19142, 19333, 19514, 19684, 19842, 19985, 20112, 20222, 20313, 20385, 20437, 20468,\
+		20479, 20479, 20458, 20395, 20291, 20147, 19964, 19745, 19491, 19205, 18890, 18550, 18187, 17806, 17410, 17003,\
+		16590, 16176, 15763, 15356, 14960, 14579, 14216, 13876, 13561, 13275, 13021, 12802, 12619, 12475, 12371, 12308,\
+		12287, 12287, 12319, 12413, 12569, 12785, 13059, 13388, 13769, 14198, 14670, 15181, 15725, 16297, 16891, 17501,\
+		18120, 18742, 19361, 19971, 20565, 21137, 21681, 22192, 22664, 23093, 23474, 23803, 24077, 24293, 24449, 24543,\
+		24575, 24575, 24533, 24407, 24199, 23911, 23545, 23106, 22599, 22027, 21397, 20716, 19991, 19228, 18436, 17623,\
+		16798, 15968, 15143, 14330, 13538, 12775, 12050, 11369, 10739, 10167, 9660, 9221, 8855, 8567, 8359, 8233,\
+		8191, 8191, 8244, 8401, 8661, 9021, 9478, 10027, 10661, 11376, 12163, 13015, 13921, 14875, 15864, 16880,\
+		17912, 18950, 19982, 20998, 21987, 22940, 23847, 24699, 25486, 26200, 26835, 27384, 27841, 28201, 28461, 28618,\
+		28671, 28671, 28608, 28419, 28107, 27675, 27127, 26468, 25706, 24849, 23904, 22883, 21794, 20651, 19463, 18244,\
+		17005, 15761, 14522, 13303, 12115, 10972, 9883, 8862, 7917, 7060, 6298, 5639, 5091, 4659, 4347, 4158,\
+		4095, 4095, 4169, 4389, 4753, 5257, 5897, 6665, 7554, 8554, 9656, 10848, 12118, 13452, 14838, 16260,\
+		17705, 19157, 20602, 22024, 23410, 24744, 26014, 27206, 28308, 29308, 30197, 30965, 31605, 32109, 32473, 32693,\
+		32767}
+
+	#define half_sines_release8 {\
+		0, 0, 42, 167, 375, 663, 1029, 1468, 1976, 2547, 3177, 3858, 4584, 5346, 6138, 6951,\
+		7776, 8606, 9432, 10245, 11036, 11799, 12524, 13205, 13835, 14407, 14915, 15354, 15719, 16007, 16215, 16341,\
+		16383, 16383, 16425, 16551, 16759, 17047, 17412, 17851, 18359, 18931, 19561, 20242, 20967, 21730, 22521, 23334,\
+		24160, 24990, 25815, 26628, 27420, 28182, 28908, 29589, 30219, 30790, 31298, 31737, 32103, 32391, 32599, 32724,\
+		32766, 32766, 32703, 32515, 32203, 31771, 31223, 30564, 29802, 28945, 28000, 26979, 25890, 24746, 23559, 22340,\
+		21101, 19857, 18618, 17399, 16211, 15067, 13979, 12958, 12013, 11156, 10394, 9735, 9187, 8755, 8443, 8254,\
+		8191, 8191, 8254, 8443, 8755, 9187, 9735, 10394, 11156, 12013, 12958, 13979, 15067, 16211, 17399, 18618,\
+		19857, 21101, 22340, 23559, 24746, 25890, 26979, 28000, 28945, 29802, 30564, 31223, 31771, 32203, 32515, 32703,\
+		32766, 32766, 32724, 32599, 32391, 32103, 31737, 31298, 30790, 30219, 29589, 28908, 28182, 27420, 26628, 25815,\
+		24990, 24160, 23334, 22521, 21730, 20967, 20242, 19561, 18931, 18359, 17851, 17412, 17047, 16759, 16551, 16425,\
+		16383, 16383, 16425, 16551, 16759, 17047, 17412, 17851, 18359, 18931, 19561, 20242, 20967, 21730, 22521, 23334,\
+		24160, 24990, 25815, 26628, 27420, 28182, 28908, 29589, 30219, 30790, 31298, 31737, 32103, 32391, 32599, 32724,\
+		32766, 32766, 32745, 32683, 32579, 32435, 32252, 32032, 31778, 31493, 31178, 30837, 30474, 30093, 29697, 29291,\
+		28878, 28463, 28050, 27644, 27248, 26867, 26504, 26164, 25849, 25563, 25309, 25089, 24907, 24763, 24659, 24596,\
+		24575, 24575, 24596, 24659, 24763, 24907, 25089, 25309, 25563, 25849, 26164, 26504, 26867, 27248, 27644, 28050,\
+		28463, 28878, 29291, 29697, 30093, 30474, 30837, 31178, 31493, 31778, 32032, 32252, 32435, 32579, 32683, 32745,\
+		32766}
+
+	#define mountains_attack0 {\
+		0, 127, 255, 383, 511, 639, 767, 895, 1023, 1151, 1279, 1407, 1535, 1663, 1791, 1919,\
+		2047, 2175, 2303, 2431, 2559, 2687, 2815, 2943, 3071, 3199, 3327, 3455, 3583, 3711, 3839, 3967,\
+		4095, 4223, 4351, 4479, 4607, 4735, 4863, 4991, 5119, 5247, 5375, 5503, 5631, 5759, 5887, 6015,\
+		6143, 6271, 6399, 6527, 6655, 6783, 6911, 7039, 7167, 7295, 7423, 7551, 7679, 7807, 7935, 8063,\
+		8191, 8319, 8447, 8575, 8703, 8831, 8959, 9087, 9215, 9343, 9471, 9599, 9727, 9855, 9983, 10111,\
+		10239, 10367, 10495, 10623, 10751, 10879, 11007, 11135, 11263, 11391, 11519, 11647, 11775, 11903, 12031, 12159,\
+		12287, 12415, 12543, 12671, 12799, 12927, 13055, 13183, 13311, 13439, 13567, 13695, 13823, 13951, 14079, 14207,\
+		14335, 14463, 14591, 14719, 14847, 14975, 15103, 15231, 15359, 15487, 15615, 15743, 15871, 15999, 16127, 16255,\
+		16383, 16511, 16639, 16767, 16895, 17023, 17151, 17279, 17407, 17535, 17663, 17791, 17919, 18047, 18175, 18303,\
+		18431, 18559, 18687, 18815, 18943, 19071, 19199, 19327, 19455, 19583, 19711, 19839, 19967, 20095, 20223, 20351,\
+		20479, 20607, 20735, 20863, 20991, 21119, 21247, 21375, 21503, 21631, 21759, 21887, 22015, 22143, 22271, 22399,\
+		22527, 22655, 22783, 22911, 23039, 23167, 23295, 23423, 23551, 23679, 23807, 23935, 24063, 24191, 24319, 24447,\
+		24575, 24703, 24831, 24959, 25087, 25215, 25343, 25471, 25599, 25727, 25855, 25983, 26111, 26239, 26367, 26495,\
+		26623, 26751, 26879, 27007, 27135, 27263, 27391, 27519, 27647, 27775, 27903, 28031, 28159, 28287, 28415, 28543,\
+		28671, 28799, 28927, 29055, 29183, 29311, 29439, 29567, 29695, 29823, 29951, 30079, 30207, 30335, 30463, 30591,\
+		30719, 30847, 30975, 31103, 31231, 31359, 31487, 31615, 31743, 31871, 31999, 32127, 32255, 32383, 32511, 32639,\
+		32767}
+
+	#define mountains_attack1 {\
+		0, 191, 383, 575, 767, 959, 1151, 1343, 1535, 1727, 1919, 2111, 2303, 2495, 2687, 2879,\
+		3071, 3263, 3455, 3647, 3839, 4031, 4223, 4415, 4607, 4799, 4991, 5183, 5375, 5567, 5759, 5951,\
+		6143, 6335, 6527, 6719, 6911, 7103, 7295, 7487, 7679, 7871, 8063, 8255, 8447, 8639, 8831, 9023,\
+		9215, 9407, 9599, 9791, 9983, 10175, 10367, 10559, 10751, 10943, 11135, 11327, 11519, 11711, 11903, 12095,\
+		12287, 12479, 12671, 12863, 13055, 13247, 13439, 13631, 13823, 14015, 14207, 14399, 14591, 14783, 14975, 15167,\
+		15359, 15551, 15743, 15935, 16127, 16319, 16511, 16703, 16895, 17087, 17279, 17471, 17663, 17855, 18047, 18239,\
+		18431, 18623, 18815, 19007, 19199, 19391, 19583, 19775, 19967, 20159, 20351, 20543, 20735, 20927, 21119, 21311,\
+		21503, 21695, 21887, 22079, 22271, 22463, 22655, 22847, 23039, 23231, 23423, 23615, 23807, 23999, 24191, 24383,\
+		24575, 24639, 24703, 24767, 24831, 24895, 24959, 25023, 25087, 25151, 25215, 25279, 25343, 25407, 25471, 25535,\
+		25599, 25663, 25727, 25791, 25855, 25919, 25983, 26047, 26111, 26175, 26239, 26303, 26367, 26431, 26495, 26559,\
+		26623, 26687, 26751, 26815, 26879, 26943, 27007, 27071, 27135, 27199, 27263, 27327, 27391, 27455, 27519, 27583,\
+		27647, 27711, 27775, 27839, 27903, 27967, 28031, 28095, 28159, 28223, 28287, 28351, 28415, 28479, 28543, 28607,\
+		28671, 28735, 28799, 28863, 28927, 28991, 29055, 29119, 29183, 29247, 29311, 29375, 29439, 29503, 29567, 29631,\
+		29695, 29759, 29823, 29887, 29951, 30015, 30079, 30143, 30207, 30271, 30335, 30399, 30463, 30527, 30591, 30655,\
+		30719, 30783, 30847, 30911, 30975, 31039, 31103, 31167, 31231, 31295, 31359, 31423, 31487, 31551, 31615, 31679,\
+		31743, 31807, 31871, 31935, 31999, 32063, 32127, 32191, 32255, 32319, 32383, 32447, 32511, 32575, 32639, 32703,\
+		32767}
+
+	#define mountains_attack2 {\
+		0, 255, 511, 767, 1023, 1279, 1535, 1791, 2047, 2303, 2559, 2815, 3071, 3327, 3583, 3839,\
+		4095, 4351, 4607, 4863, 5119, 5375, 5631, 5887, 6143, 6399, 6655, 6911, 7167, 7423, 7679, 7935,\
+		8191, 8447, 8703, 8959, 9215, 9471, 9727, 9983, 10239, 10495, 10751, 11007, 11263, 11519, 11775, 12031,\
+		12287, 12543, 12799, 13055, 13311, 13567, 13823, 14079, 14335, 14591, 14847, 15103, 15359, 15615, 15871, 16127,\
+		16383, 16511, 16639, 16767, 16895, 17023, 17151, 17279, 17407, 17535, 17663, 17791, 17919, 18047, 18175, 18303,\
+		18431, 18559, 18687, 18815, 18943, 19071, 19199, 19327, 19455, 19583, 19711, 19839, 19967, 20095, 20223, 20351,\
+		20479, 20607, 20735, 20863, 20991, 21119, 21247, 21375, 21503, 21631, 21759, 21887, 22015, 22143, 22271, 22399,\
+		22527, 22655, 22783, 22911, 23039, 23167, 23295, 23423, 23551, 23679, 23807, 23935, 24063, 24191, 24319, 24447,\
+		24575, 24319, 24063, 23807, 23551, 23295, 23039, 22783, 22527, 22271, 22015, 21759, 21503, 21247, 20991, 20735,\
+		20479, 20223, 19967, 19711, 19455, 19199, 18943, 18687, 18431, 18175, 17919, 17663, 17407, 17151, 16895, 16639,\
+		16383, 16127, 15871, 15615, 15359, 15103, 14847, 14591, 14335, 14079, 13823, 13567, 13311, 13055, 12799, 12543,\
+		12287, 12031, 11775, 11519, 11263, 11007, 10751, 10495, 10239, 9983, 9727, 9471, 9215, 8959, 8703, 8447,\
+		8191, 8575, 8959, 9343, 9727, 10111, 10495, 10879, 11263, 11647, 12031, 12415, 12799, 13183, 13567, 13951,\
+		14335, 14719, 15103, 15487, 15871, 16255, 16639, 17023, 17407, 17791, 18175, 18559, 18943, 19327, 19711, 20095,\
+		20479, 20863, 21247, 21631, 22015, 22399, 22783, 23167, 23551, 23935, 24319, 24703, 25087, 25471, 25855, 26239,\
+		26623, 27007, 27391, 27775, 28159, 28543, 28927, 29311, 29695, 30079, 30463, 30847, 31231, 31615, 31999, 32383,\
+		32767}
+
+	#define mountains_attack3 {\
+		0, 639, 1279, 1919, 2559, 3199, 3839, 4479, 5119, 5759, 6399, 7039, 7679, 8319, 8959, 9599,\
+		10239, 10879, 11519, 12159, 12799, 13439, 14079, 14719, 15359, 15999, 16639, 17279, 17919, 18559, 19199, 19839,\
+		20479, 20351, 20223, 20095, 19967, 19839, 19711, 19583, 19455, 19327, 19199, 19071, 18943, 18815, 18687, 18559,\
+		18431, 18303, 18175, 18047, 17919, 17791, 17663, 17535, 17407, 17279, 17151, 17023, 16895, 16767, 16639, 16511,\
+		16383, 15999, 15615, 15231, 14847, 14463, 14079, 13695, 13311, 12927, 12543, 12159, 11775, 11391, 11007, 10623,\
+		10239, 9855, 9471, 9087, 8703, 8319, 7935, 7551, 7167, 6783, 6399, 6015, 5631, 5247, 4863, 4479,\
+		4095, 4735, 5375, 6015, 6655, 7295, 7935, 8575, 9215, 9855, 10495, 11135, 11775, 12415, 13055, 13695,\
+		14335, 14975, 15615, 16255, 16895, 17535, 18175, 18815, 19455, 20095, 20735, 21375, 22015, 22655, 23295, 23935,\
+		24575, 24703, 24831, 24959, 25087, 25215, 25343, 25471, 25599, 25727, 25855, 25983, 26111, 26239, 26367, 26495,\
+		26623, 26751, 26879, 27007, 27135, 27263, 27391, 27519, 27647, 27775, 27903, 28031, 28159, 28287, 28415, 28543,\
+		28671, 28031, 27391, 26751, 26111, 25471, 24831, 24191, 23551, 22911, 22271, 21631, 20991, 20351, 19711, 19071,\
+		18431, 17791, 17151, 16511, 15871, 15231, 14591, 13951, 13311, 12671, 12031, 11391, 10751, 10111, 9471, 8831,\
+		8191, 8319, 8447, 8575, 8703, 8831, 8959, 9087, 9215, 9343, 9471, 9599, 9727, 9855, 9983, 10111,\
+		10239, 10367, 10495, 10623, 10751, 10879, 11007, 11135, 11263, 11391, 11519, 11647, 11775, 11903, 12031, 12159,\
+		12287, 12927, 13567, 14207, 14847, 15487, 16127, 16767, 17407, 18047, 18687, 19327, 19967, 20607, 21247, 21887,\
+		22527, 23167, 23807, 24447, 25087, 25727, 26367, 27007, 27647, 28287, 28927, 29567, 30207, 30847, 31487, 32127,\
+		32767}
+
+	#define mountains_release0 {\
+		0, 127, 255, 383, 511, 639, 767, 895, 1023, 1151, 1279, 1407, 1535, 1663, 1791, 1919,\
+		2047, 2175, 2303, 2431, 2559, 2687, 2815, 2943, 3071, 3199, 3327, 3455, 3583, 3711, 3839, 3967,\
+		4095, 4223, 4351, 4479, 4607, 4735, 4863, 4991, 5119, 5247, 5375, 5503, 5631, 5759, 5887, 6015,\
+		6143, 6271, 6399, 6527, 6655, 6783, 6911, 7039, 7167, 7295, 7423, 7551, 7679, 7807, 7935, 8063,\
+		8191, 8319, 8447, 8575, 8703, 8831, 8959, 9087, 9215, 9343, 9471, 9599, 9727, 9855, 9983, 10111,\
+		10239, 10367, 10495, 10623, 10751, 10879, 11007, 11135, 11263, 11391, 11519, 11647, 11775, 11903, 12031, 12159,\
+		12287, 12415, 12543, 12671, 12799, 12927, 13055, 13183, 13311, 13439, 13567, 13695, 13823, 13951, 14079, 14207,\
+		14335, 14463, 14591, 14719, 14847, 14975, 15103, 15231, 15359, 15487, 15615, 15743, 15871, 15999, 16127, 16255,\
+		16383, 16511, 16639, 16767, 16895, 17023, 17151, 17279, 17407, 17535, 17663, 17791, 17919, 18047, 18175, 18303,\
+		18431, 18559, 18687, 18815, 18943, 19071, 19199, 19327, 19455, 19583, 19711, 19839, 19967, 20095, 20223, 20351,\
+		20479, 20607, 20735, 20863, 20991, 21119, 21247, 21375, 21503, 21631, 21759, 21887, 22015, 22143, 22271, 22399,\
+		22527, 22655, 22783, 22911, 23039, 23167, 23295, 23423, 23551, 23679, 23807, 23935, 24063, 24191, 24319, 24447,\
+		24575, 24703, 24831, 24959, 25087, 25215, 25343, 25471, 25599, 25727, 25855, 25983, 26111, 26239, 26367, 26495,\
+		26623, 26751, 26879, 27007, 27135, 27263, 27391, 27519, 27647, 27775, 27903, 28031, 28159, 28287, 28415, 28543,\
+		28671, 28799, 28927, 29055, 29183, 29311, 29439, 29567, 29695, 29823, 29951, 30079, 30207, 30335, 30463, 30591,\
+		30719, 30847, 30975, 31103, 31231, 31359, 31487, 31615, 31743, 31871, 31999, 32127, 32255, 32383, 32511, 32639,\
+		32767}
+
+	#define mountains_release1 {\
+		0, 63, 127, 191, 255, 319, 383, 447, 511, 575, 639, 703, 767, 831, 895, 959,\
+		1023, 1087, 1151, 1215, 1279, 1343, 1407, 1471, 1535, 1599, 1663, 1727, 1791, 1855, 1919, 1983,\
+		2047, 2111, 2175, 2239, 2303, 2367, 2431, 2495, 2559, 2623, 2687, 2751, 2815, 2879, 2943, 3007,\
+		3071, 3135, 3199, 3263, 3327, 3391, 3455, 3519, 3583, 3647, 3711, 3775, 3839, 3903, 3967, 4031,\
+		4095, 4159, 4223, 4287, 4351, 4415, 4479, 4543, 4607, 4671, 4735, 4799, 4863, 4927, 4991, 5055,\
+		5119, 5183, 5247, 5311, 5375, 5439, 5503, 5567, 5631, 5695, 5759, 5823, 5887, 5951, 6015, 6079,\
+		6143, 6207, 6271, 6335, 6399, 6463, 6527, 6591, 6655, 6719, 6783, 6847, 6911, 6975, 7039, 7103,\
+		7167, 7231, 7295, 7359, 7423, 7487, 7551, 7615, 7679, 7743, 7807, 7871, 7935, 7999, 8063, 8127,\
+		8191, 8383, 8575, 8767, 8959, 9151, 9343, 9535, 9727, 9919, 10111, 10303, 10495, 10687, 10879, 11071,\
+		11263, 11455, 11647, 11839, 12031, 12223, 12415, 12607, 12799, 12991, 13183, 13375, 13567, 13759, 13951, 14143,\
+		14335, 14527, 14719, 14911, 15103, 15295, 15487, 15679, 15871, 16063, 16255, 16447, 16639, 16831, 17023, 17215,\
+		17407, 17599, 17791, 17983, 18175, 18367, 18559, 18751, 18943, 19135, 19327, 19519, 19711, 19903, 20095, 20287,\
+		20479, 20671, 20863, 21055, 21247, 21439, 21631, 21823, 22015, 22207, 22399, 22591, 22783, 22975, 23167, 23359,\
+		23551, 23743, 23935, 24127, 24319, 24511, 24703, 24895, 25087, 25279, 25471, 25663, 25855, 26047, 26239, 26431,\
+		26623, 26815, 27007, 27199, 27391, 27583, 27775, 27967, 28159, 28351, 28543, 28735, 28927, 29119, 29311, 29503,\
+		29695, 29887, 30079, 30271, 30463, 30655, 30847, 31039, 31231, 31423, 31615, 31807, 31999, 32191, 32383, 32575,\
+		32767}
+
+	#define mountains_release2 {\
+		0, 383, 767, 1151, 1535, 1919, 2303, 2687, 3071, 3455, 3839, 4223, 4607, 4991, 5375, 5759,\
+		6143, 6527, 6911, 7295, 7679, 8063, 8447, 8831, 9215, 9599, 9983, 10367, 10751, 11135, 11519, 11903,\
+		12287, 12671, 13055, 13439, 13823, 14207, 14591, 14975, 15359, 15743, 16127, 16511, 16895, 17279, 17663, 18047,\
+		18431, 18815, 19199, 19583, 19967, 20351, 20735, 21119, 21503, 21887, 22271, 22655, 23039, 23423, 23807, 24191,\
+		24575, 24319, 24063, 23807, 23551, 23295, 23039, 22783, 22527, 22271, 22015, 21759, 21503, 21247, 20991, 20735,\
+		20479, 20223, 19967, 19711, 19455, 19199, 18943, 18687, 18431, 18175, 17919, 17663, 17407, 17151, 16895, 16639,\
+		16383, 16127, 15871, 15615, 15359, 15103, 14847, 14591, 14335, 14079, 13823, 13567, 13311, 13055, 12799, 12543,\
+		12287, 12031, 11775, 11519, 11263, 11007, 10751, 10495, 10239, 9983, 9727, 9471, 9215, 8959, 8703, 8447,\
+		8191, 8319, 8447, 8575, 8703, 8831, 8959, 9087, 9215, 9343, 9471, 9599, 9727, 9855, 9983, 10111,\
+		10239, 10367, 10495, 10623, 10751, 10879, 11007, 11135, 11263, 11391, 11519, 11647, 11775, 11903, 12031, 12159,\
+		12287, 12415, 12543, 12671, 12799, 12927, 13055, 13183, 13311, 13439, 13567, 13695, 13823, 13951, 14079, 14207,\
+		14335, 14463, 14591, 14719, 14847, 14975, 15103, 15231, 15359, 15487, 15615, 15743, 15871, 15999, 16127, 16255,\
+		16383, 16639, 16895, 17151, 17407, 17663, 17919, 18175, 18431, 18687, 18943, 19199, 19455, 19711, 19967, 20223,\
+		20479, 20735, 20991, 21247, 21503, 21759, 22015, 22271, 22527, 22783, 23039, 23295, 23551, 23807, 24063, 24319,\
+		24575, 24831, 25087, 25343, 25599, 25855, 26111, 26367, 26623, 26879, 27135, 27391, 27647, 27903, 28159, 28415,\
+		28671, 28927, 29183, 29439, 29695, 29951, 30207, 30463, 30719, 30975, 31231, 31487, 31743, 31999, 32255, 32511,\
+		32767}
+
+	#define mountains_release3 {\
+		0, 639, 1279, 1919, 2559, 3199, 3839, 4479, 5119, 5759, 6399, 7039, 7679, 8319, 8959, 9599,\
+		10239, 10879, 11519, 12159, 12799, 13439, 14079, 14719, 15359, 15999, 16639, 17279, 17919, 18559, 19199, 19839,\
+		20479, 20607, 20735, 20863, 20991, 21119, 21247, 21375, 21503, 21631, 21759, 21887, 22015, 22143, 22271, 22399,\
+		22527, 22655, 22783, 22911, 23039, 23167, 23295, 23423, 23551, 23679, 23807, 23935, 24063, 24191, 24319, 24447,\
+		24575, 23935, 23295, 22655, 22015, 21375, 20735, 20095, 19455, 18815, 18175, 17535, 16895, 16255, 15615, 14975,\
+		14335, 13695, 13055, 12415, 11775, 11135, 10495, 9855, 9215, 8575, 7935, 7295, 6655, 6015, 5375, 4735,\
+		4095, 4223, 4351, 4479, 4607, 4735, 4863, 4991, 5119, 5247, 5375, 5503, 5631, 5759, 5887, 6015,\
+		6143, 6271, 6399, 6527, 6655, 6783, 6911, 7039, 7167, 7295, 7423, 7551, 7679, 7807, 7935, 8063,\
+		8191, 8831, 9471, 10111, 10751, 11391, 12031, 12671, 13311, 13951, 14591, 15231, 15871, 16511, 17151, 17791,\
+		18431, 19071, 19711, 20351, 20991, 21631, 22271, 22911, 23551, 24191, 24831, 25471, 26111, 26751, 27391, 28031,\
+		28671, 28287, 27903, 27519, 27135, 26751, 26367, 25983, 25599, 25215, 24831, 24447, 24063, 23679, 23295, 22911,\
+		22527, 22143, 21759, 21375, 20991, 20607, 20223, 19839, 19455, 19071, 18687, 18303, 17919, 17535, 17151, 16767,\
+		16383, 16255, 16127, 15999, 15871, 15743, 15615, 15487, 15359, 15231, 15103, 14975, 14847, 14719, 14591, 14463,\
+		14335, 14207, 14079, 13951, 13823, 13695, 13567, 13439, 13311, 13183, 13055, 12927, 12799, 12671, 12543, 12415,\
+		12287, 12927, 13567, 14207, 14847, 15487, 16127, 16767, 17407, 18047, 18687, 19327, 19967, 20607, 21247, 21887,\
+		22527, 23167, 23807, 24447, 25087, 25727, 26367, 27007, 27647, 28287, 28927, 29567, 30207, 30847, 31487, 32127,\
+		32767}
+
+	#define rubberband_attacks0 {\
+		0, 1236, 1349, 1488, 1645, 1814, 1989, 2163, 2331, 2489, 2639, 2780, 2912, 3036, 3151, 3257,\
+		3354, 3443, 3522, 3593, 3656, 3709, 3753, 3788, 3813, 3828, 3832, 3826, 3809, 3782, 3746, 3700,\
+		3645, 3581, 3509, 3428, 3338, 3240, 3133, 3018, 2894, 2762, 2621, 2472, 2315, 2149, 1974, 1792,\
+		1600, 1401, 1193, 976, 755, 541, 346, 183, 63, 0, 1, 58, 159, 292, 444, 604,\
+		761, 912, 1056, 1194, 1327, 1455, 1577, 1695, 1808, 1916, 2019, 2117, 2210, 2298, 2382, 2460,\
+		2534, 2602, 2666, 2727, 2794, 2874, 2978, 3113, 3289, 3512, 3778, 4078, 4403, 4745, 5096, 5447,\
+		5796, 6143, 6488, 6833, 7176, 7519, 7862, 8204, 8546, 8888, 9230, 9572, 9914, 10256, 10598, 10940,\
+		11282, 11625, 11967, 12311, 12659, 13011, 13370, 13737, 14113, 14498, 14889, 15286, 15687, 16090, 16494, 16896,\
+		17296, 17692, 18082, 18465, 18839, 19204, 19562, 19913, 20259, 20603, 20946, 21288, 21630, 21972, 22314, 22656,\
+		22998, 23340, 23682, 24024, 24366, 24708, 25051, 25394, 25738, 26082, 26428, 26776, 27125, 27477, 27826, 28165,\
+		28486, 28779, 29036, 29249, 29415, 29543, 29640, 29717, 29781, 29843, 29907, 29977, 30052, 30131, 30216, 30305,\
+		30399, 30499, 30603, 30712, 30825, 30944, 31068, 31196, 31331, 31470, 31616, 31768, 31926, 32086, 32235, 32362,\
+		32454, 32500, 32487, 32410, 32280, 32109, 31908, 31692, 31471, 31256, 31050, 30852, 30663, 30482, 30309, 30145,\
+		29990, 29842, 29704, 29573, 29452, 29338, 29233, 29137, 29049, 28970, 28899, 28837, 28784, 28740, 28706, 28682,\
+		28667, 28663, 28670, 28687, 28714, 28751, 28797, 28852, 28917, 28990, 29071, 29162, 29261, 29369, 29486, 29611,\
+		29745, 29888, 30040, 30200, 30370, 30548, 30734, 30930, 31134, 31347, 31569, 31797, 32025, 32243, 32445, 32622,\
+		32767}
+
+	#define rubberband_attacks1 {\
+		0, 0, 112, 252, 412, 580, 749, 909, 1060, 1201, 1332, 1454, 1566, 1668, 1760, 1843,\
+		1916, 1983, 2057, 2155, 2296, 2496, 2767, 3096, 3465, 3857, 4254, 4640, 5012, 5371, 5717, 6049,\
+		6368, 6673, 6966, 7244, 7510, 7762, 8001, 8226, 8438, 8637, 8821, 8981, 9109, 9193, 9226, 9199,\
+		9119, 8997, 8842, 8664, 8470, 8264, 8045, 7813, 7569, 7313, 7045, 6764, 6472, 6168, 5851, 5523,\
+		5182, 4830, 4465, 4092, 3724, 3380, 3078, 2836, 2666, 2557, 2492, 2452, 2422, 2386, 2343, 2293,\
+		2237, 2176, 2110, 2040, 1966, 1887, 1804, 1717, 1626, 1530, 1430, 1326, 1221, 1137, 1098, 1128,\
+		1252, 1486, 1815, 2215, 2661, 3129, 3601, 4070, 4538, 5003, 5466, 5926, 6385, 6842, 7298, 7756,\
+		8215, 8675, 9137, 9601, 10066, 10534, 11011, 11507, 12028, 12583, 13178, 13806, 14460, 15130, 15809, 16488,\
+		17158, 17812, 18440, 19035, 19590, 20112, 20607, 21085, 21552, 22018, 22481, 22943, 23403, 23862, 24320, 24777,\
+		25234, 25692, 26152, 26615, 27080, 27548, 28018, 28489, 28958, 29404, 29803, 30132, 30367, 30491, 30521, 30481,\
+		30397, 30293, 30188, 30088, 29993, 29901, 29814, 29731, 29652, 29578, 29508, 29442, 29381, 29326, 29276, 29232,\
+		29197, 29166, 29127, 29061, 28952, 28782, 28540, 28238, 27894, 27527, 27153, 26788, 26436, 26095, 25767, 25450,\
+		25146, 24854, 24574, 24305, 24049, 23805, 23573, 23354, 23148, 22955, 22776, 22621, 22499, 22420, 22393, 22425,\
+		22510, 22637, 22798, 22981, 23180, 23392, 23617, 23856, 24108, 24374, 24653, 24945, 25250, 25569, 25901, 26247,\
+		26606, 26979, 27365, 27761, 28153, 28523, 28852, 29122, 29322, 29463, 29562, 29636, 29702, 29775, 29858, 29951,\
+		30053, 30165, 30286, 30418, 30559, 30709, 30870, 31040, 31219, 31409, 31608, 31816, 32033, 32248, 32449, 32626,\
+		32767}
+
+	#define rubberband_attacks2 {\
+		0, 0, 236, 534, 876, 1246, 1625, 1998, 2363, 2720, 3069, 3409, 3742, 4066, 4381, 4689,\
+		4988, 5280, 5570, 5863, 6165, 6482, 6819, 7169, 7528, 7887, 8241, 8584, 8915, 9234, 9541, 9836,\
+		10119, 10391, 10651, 10900, 11137, 11362, 11575, 11777, 11967, 12145, 12311, 12456, 12573, 12653, 12689, 12673,\
+		12613, 12517, 12392, 12246, 12088, 11919, 11739, 11549, 11349, 11140, 10921, 10694, 10457, 10211, 9956, 9691,\
+		9418, 9135, 8843, 8543, 8240, 7942, 7654, 7383, 7134, 6904, 6685, 6473, 6262, 6046, 5826, 5602,\
+		5374, 5144, 4912, 4677, 4442, 4205, 3967, 3728, 3488, 3247, 3005, 2763, 2524, 2312, 2153, 2076,\
+		2106, 2264, 2530, 2877, 3279, 3708, 4141, 4572, 4997, 5415, 5821, 6214, 6597, 6972, 7342, 7711,\
+		8080, 8450, 8822, 9195, 9569, 9948, 10342, 10769, 11244, 11781, 12391, 13064, 13784, 14535, 15302, 16069,\
+		16820, 17540, 18213, 18823, 19360, 19835, 20261, 20656, 21034, 21409, 21782, 22153, 22524, 22893, 23262, 23632,\
+		24007, 24390, 24783, 25189, 25606, 26032, 26462, 26896, 27325, 27727, 28074, 28340, 28497, 28528, 28451, 28292,\
+		28080, 27841, 27598, 27357, 27116, 26876, 26637, 26399, 26162, 25926, 25692, 25460, 25230, 25002, 24778, 24558,\
+		24342, 24131, 23919, 23700, 23470, 23221, 22950, 22662, 22364, 22061, 21761, 21469, 21186, 20912, 20648, 20393,\
+		20147, 19910, 19682, 19464, 19255, 19055, 18865, 18685, 18515, 18357, 18212, 18087, 17990, 17930, 17915, 17951,\
+		18031, 18148, 18293, 18459, 18637, 18827, 19029, 19242, 19467, 19704, 19952, 20213, 20484, 20768, 21063, 21370,\
+		21689, 22020, 22363, 22717, 23076, 23434, 23785, 24121, 24439, 24741, 25034, 25324, 25616, 25915, 26223, 26538,\
+		26862, 27194, 27535, 27884, 28241, 28606, 28979, 29361, 29751, 30149, 30555, 30970, 31390, 31799, 32177, 32506,\
+		32767}
+
+	#define rubberband_attacks3 {\
+		0, 0, 78, 176, 285, 395, 497, 587, 667, 735, 793, 839, 874, 898, 912, 933,\
+		999, 1148, 1418, 1822, 2326, 2892, 3482, 4067, 4643, 5208, 5764, 6310, 6846, 7373, 7890, 8397,\
+		8895, 9382, 9860, 10329, 10782, 11214, 11615, 11978, 12301, 12591, 12854, 13098, 13328, 13546, 13751, 13944,\
+		14126, 14296, 14454, 14600, 14735, 14858, 14969, 15069, 15157, 15233, 15295, 15343, 15375, 15391, 15392, 15380,\
+		15356, 15320, 15274, 15219, 15155, 15085, 15008, 14924, 14833, 14736, 14632, 14522, 14404, 14280, 14144, 13988,\
+		13806, 13591, 13343, 13072, 12785, 12489, 12190, 11888, 11581, 11271, 10956, 10639, 10320, 10002, 9686, 9372,\
+		9061, 8751, 8447, 8177, 7980, 7894, 7952, 8144, 8434, 8782, 9151, 9515, 9863, 10181, 10459, 10693,\
+		10893, 11070, 11238, 11404, 11570, 11737, 11903, 12075, 12282, 12562, 12953, 13485, 14146, 14896, 15699, 16518,\
+		17314, 18051, 18691, 19198, 19566, 19830, 20028, 20197, 20363, 20529, 20696, 20862, 21030, 21211, 21416, 21657,\
+		21943, 22268, 22620, 22986, 23354, 23694, 23969, 24140, 24171, 24061, 23848, 23570, 23264, 22953, 22641, 22327,\
+		22010, 21692, 21374, 21057, 20743, 20433, 20127, 19825, 19527, 19233, 18948, 18680, 18438, 18229, 18052, 17900,\
+		17767, 17644, 17528, 17419, 17316, 17220, 17130, 17047, 16971, 16902, 16841, 16787, 16743, 16709, 16687, 16677,\
+		16681, 16700, 16735, 16785, 16850, 16928, 17018, 17120, 17233, 17358, 17495, 17644, 17804, 17976, 18159, 18355,\
+		18562, 18782, 19015, 19262, 19529, 19824, 20154, 20525, 20932, 21368, 21825, 22295, 22775, 23264, 23764, 24273,\
+		24791, 25320, 25858, 26405, 26963, 27530, 28107, 28694, 29283, 29841, 30329, 30711, 30956, 31088, 31143, 31160,\
+		31175, 31201, 31239, 31287, 31346, 31417, 31498, 31591, 31694, 31809, 31934, 32071, 32219, 32374, 32526, 32661,\
+		32767}
+
+	#define rubberband_attacks4 {\
+		0, 0, 224, 512, 841, 1186, 1526, 1854, 2171, 2476, 2770, 3051, 3322, 3580, 3827, 4073,\
+		4339, 4646, 5016, 5455, 5946, 6467, 6998, 7522, 8038, 8545, 9043, 9533, 10014, 10487, 10951, 11407,\
+		11855, 12294, 12724, 13146, 13550, 13923, 14248, 14510, 14708, 14854, 14964, 15054, 15134, 15207, 15273, 15332,\
+		15386, 15434, 15477, 15514, 15545, 15571, 15592, 15607, 15617, 15628, 15648, 15687, 15753, 15848, 15961, 16085,\
+		16209, 16329, 16444, 16557, 16667, 16775, 16882, 16989, 17096, 17203, 17311, 17419, 17527, 17635, 17731, 17802,\
+		17830, 17803, 17722, 17601, 17456, 17302, 17146, 16985, 16816, 16634, 16437, 16231, 16019, 15806, 15596, 15388,\
+		15184, 14983, 14788, 14613, 14480, 14410, 14421, 14508, 14649, 14824, 15010, 15185, 15329, 15418, 15432, 15364,\
+		15232, 15059, 14866, 14670, 14471, 14272, 14071, 13875, 13720, 13648, 13704, 13925, 14294, 14768, 15302, 15855,\
+		16382, 16840, 17185, 17376, 17405, 17315, 17149, 16951, 16750, 16551, 16353, 16157, 15966, 15799, 15677, 15622,\
+		15651, 15752, 15903, 16082, 16268, 16438, 16571, 16646, 16641, 16558, 16416, 16236, 16039, 15838, 15633, 15425,\
+		15214, 15001, 14789, 14585, 14391, 14211, 14044, 13884, 13729, 13575, 13434, 13319, 13246, 13230, 13267, 13343,\
+		13443, 13551, 13659, 13767, 13874, 13982, 14088, 14195, 14303, 14412, 14522, 14635, 14751, 14872, 14996, 15119,\
+		15229, 15319, 15380, 15415, 15433, 15443, 15453, 15470, 15491, 15518, 15551, 15589, 15633, 15682, 15737, 15797,\
+		15864, 15938, 16020, 16112, 16228, 16382, 16590, 16865, 17200, 17579, 17988, 18411, 18843, 19284, 19733, 20190,\
+		20656, 21130, 21613, 22104, 22604, 23113, 23630, 24156, 24687, 25204, 25687, 26115, 26472, 26769, 27030, 27275,\
+		27524, 27785, 28057, 28341, 28636, 28944, 29262, 29593, 29935, 30289, 30654, 31031, 31420, 31813, 32186, 32513,\
+		32767}
+
+	#define rubberband_attacks5 {\
+		0, 0, 365, 837, 1377, 1948, 2517, 3073, 3616, 4146, 4663, 5168, 5659, 6138, 6603, 7057,\
+		7502, 7939, 8370, 8798, 9219, 9634, 10040, 10437, 10825, 11203, 11573, 11934, 12287, 12632, 12968, 13296,\
+		13616, 13928, 14231, 14526, 14806, 15060, 15275, 15442, 15557, 15633, 15682, 15718, 15749, 15778, 15805, 15833,\
+		15861, 15890, 15920, 15951, 15983, 16017, 16052, 16089, 16127, 16174, 16240, 16337, 16474, 16653, 16862, 17092,\
+		17330, 17570, 17812, 18054, 18297, 18541, 18787, 19037, 19293, 19556, 19827, 20105, 20392, 20685, 20976, 21252,\
+		21501, 21710, 21881, 22025, 22153, 22277, 22398, 22507, 22592, 22641, 22651, 22630, 22591, 22544, 22498, 22456,\
+		22416, 22380, 22348, 22319, 22297, 22282, 22276, 22278, 22285, 22296, 22307, 22299, 22237, 22083, 21800, 21378,\
+		20850, 20252, 19621, 18984, 18346, 17706, 17066, 16430, 15837, 15334, 14968, 14777, 14744, 14823, 14967, 15131,\
+		15267, 15329, 15271, 15048, 14653, 14130, 13526, 12888, 12247, 11608, 10970, 10334, 9706, 9118, 8606, 8208,\
+		7950, 7815, 7765, 7764, 7776, 7786, 7792, 7793, 7785, 7769, 7745, 7716, 7683, 7646, 7606, 7563,\
+		7517, 7470, 7433, 7417, 7434, 7491, 7581, 7692, 7815, 7939, 8068, 8216, 8393, 8611, 8865, 9145,\
+		9438, 9730, 10014, 10292, 10561, 10823, 11078, 11327, 11573, 11816, 12059, 12301, 12542, 12782, 13020, 13246,\
+		13451, 13623, 13752, 13843, 13905, 13949, 13987, 14023, 14058, 14092, 14124, 14155, 14185, 14213, 14241, 14269,\
+		14296, 14326, 14357, 14394, 14448, 14530, 14654, 14829, 15053, 15312, 15595, 15892, 16197, 16510, 16831, 17161,\
+		17499, 17845, 18200, 18563, 18934, 19314, 19703, 20101, 20509, 20925, 21348, 21776, 22209, 22647, 23093, 23549,\
+		24017, 24498, 24992, 25498, 26018, 26550, 27096, 27654, 28225, 28809, 29406, 30015, 30638, 31263, 31853, 32368,\
+		32767}
+
+	#define rubberband_attacks6 {\
+		0, 0, 197, 453, 739, 1029, 1305, 1566, 1813, 2045, 2263, 2466, 2654, 2842, 3072, 3388,\
+		3833, 4398, 5038, 5707, 6369, 7017, 7650, 8270, 8876, 9469, 10047, 10613, 11164, 11703, 12227, 12731,\
+		13198, 13607, 13941, 14207, 14423, 14611, 14786, 14951, 15108, 15257, 15399, 15534, 15661, 15782, 15895, 16001,\
+		16100, 16193, 16280, 16365, 16448, 16532, 16616, 16701, 16790, 16882, 16979, 17084, 17195, 17315, 17444, 17583,\
+		17732, 17890, 18059, 18238, 18432, 18643, 18874, 19123, 19388, 19666, 19953, 20243, 20534, 20819, 21100, 21384,\
+		21677, 21983, 22305, 22643, 22995, 23362, 23743, 24137, 24543, 24959, 25384, 25816, 26245, 26644, 26984, 27238,\
+		27410, 27529, 27623, 27717, 27813, 27914, 28017, 28114, 28185, 28211, 28175, 28086, 27964, 27827, 27669, 27430,\
+		27049, 26467, 25700, 24810, 23861, 22904, 21947, 20991, 20035, 19102, 18238, 17486, 16882, 16402, 16000, 15630,\
+		15246, 14804, 14256, 13563, 12739, 11829, 10878, 9921, 8964, 8007, 7052, 6130, 5305, 4640, 4182, 3893,\
+		3710, 3569, 3439, 3334, 3274, 3275, 3330, 3420, 3522, 3624, 3722, 3817, 3909, 4014, 4161, 4379,\
+		4686, 5064, 5485, 5918, 6346, 6766, 7177, 7576, 7962, 8335, 8693, 9036, 9365, 9677, 9975, 10262,\
+		10544, 10827, 11115, 11406, 11695, 11977, 12248, 12504, 12743, 12962, 13162, 13347, 13520, 13682, 13835, 13978,\
+		14111, 14235, 14349, 14457, 14557, 14651, 14741, 14827, 14912, 14995, 15079, 15163, 15249, 15339, 15435, 15539,\
+		15649, 15766, 15891, 16023, 16162, 16308, 16461, 16623, 16794, 16975, 17178, 17421, 17725, 18105, 18550, 19041,\
+		19559, 20092, 20638, 21198, 21771, 22358, 22959, 23573, 24201, 24842, 25498, 26167, 26825, 27426, 27925, 28290,\
+		28549, 28749, 28933, 29130, 29342, 29568, 29809, 30064, 30334, 30619, 30918, 31231, 31560, 31901, 32238, 32537,\
+		32767}
+
+	#define rubberband_attacks7 {\
+		0, 1507, 1856, 2313, 2830, 3361, 3878, 4379, 4865, 5336, 5791, 6231, 6656, 7070, 7492, 7938,\
+		8425, 8950, 9496, 10047, 10587, 11115, 11631, 12136, 12629, 13112, 13583, 14044, 14493, 14932, 15359, 15767,\
+		16132, 16429, 16636, 16760, 16826, 16860, 16885, 16902, 16915, 16924, 16930, 16934, 16934, 16933, 16928, 16922,\
+		16914, 16909, 16922, 16971, 17069, 17213, 17390, 17587, 17794, 18009, 18232, 18463, 18703, 18955, 19220, 19501,\
+		19798, 20111, 20441, 20782, 21126, 21463, 21783, 22090, 22395, 22707, 23031, 23356, 23668, 23955, 24218, 24472,\
+		24729, 25003, 25295, 25605, 25933, 26286, 26675, 27114, 27613, 28165, 28753, 29362, 29965, 30521, 30982, 31306,\
+		31500, 31610, 31681, 31749, 31822, 31900, 31982, 32056, 32098, 32081, 31985, 31820, 31614, 31389, 31143, 30813,\
+		30333, 29642, 28757, 27744, 26671, 25591, 24514, 23440, 22369, 21309, 20278, 19292, 18365, 17486, 16638, 15803,\
+		14963, 14099, 13194, 12231, 11216, 10166, 9098, 8025, 6949, 5870, 4791, 3745, 2799, 2021, 1461, 1078,\
+		805, 577, 360, 175, 48, 0, 21, 85, 167, 247, 321, 392, 458, 547, 701, 967,\
+		1376, 1899, 2489, 3100, 3698, 4267, 4789, 5252, 5660, 6026, 6363, 6680, 6980, 7261, 7524, 7778,\
+		8035, 8311, 8614, 8935, 9261, 9579, 9886, 10191, 10504, 10834, 11177, 11520, 11856, 12176, 12480, 12767,\
+		13039, 13295, 13540, 13774, 14000, 14219, 14429, 14630, 14817, 14977, 15095, 15163, 15189, 15189, 15181, 15174,\
+		15169, 15166, 15166, 15168, 15173, 15180, 15192, 15207, 15229, 15257, 15308, 15405, 15574, 15837, 16177, 16570,\
+		16992, 17426, 17871, 18327, 18794, 19272, 19761, 20261, 20773, 21296, 21831, 22378, 22928, 23464, 23969, 24430,\
+		24859, 25274, 25693, 26127, 26576, 27040, 27520, 28015, 28526, 29052, 29593, 30150, 30722, 31309, 31879, 32383,\
+		32767}
+
+	#define rubberband_attacks8 {\
+		0, 2015, 2519, 3191, 3924, 4643, 5337, 6006, 6652, 7273, 7871, 8465, 9087, 9766, 10488, 11221,\
+		11938, 12636, 13314, 13974, 14616, 15241, 15848, 16438, 17008, 17525, 17929, 18170, 18276, 18310, 18326, 18338,\
+		18347, 18355, 18363, 18374, 18388, 18405, 18426, 18463, 18535, 18662, 18837, 19044, 19266, 19497, 19729, 19962,\
+		20204, 20466, 20753, 21066, 21406, 21778, 22193, 22661, 23179, 23737, 24321, 24897, 25422, 25877, 26296, 26720,\
+		27176, 27666, 28189, 28735, 29289, 29836, 30379, 30933, 31497, 31985, 32289, 32353, 32262, 32121, 31997, 31894,\
+		31814, 31766, 31773, 31852, 31996, 32183, 32379, 32468, 32316, 31851, 31181, 30442, 29718, 29016, 28337, 27672,\
+		27007, 26330, 25646, 24972, 24320, 23666, 22977, 22236, 21467, 20701, 19961, 19246, 18558, 17901, 17284, 16716,\
+		16192, 15702, 15243, 14860, 14615, 14537, 14578, 14675, 14785, 14906, 15037, 15188, 15375, 15614, 15895, 16200,\
+		16507, 16795, 17043, 17240, 17397, 17531, 17653, 17766, 17867, 17924, 17875, 17662, 17302, 16854, 16369, 15853,\
+		15294, 14686, 14036, 13354, 12644, 11909, 11148, 10377, 9627, 8928, 8270, 7620, 6951, 6267, 5587, 4921,\
+		4257, 3582, 2885, 2165, 1425, 731, 215, 0, 52, 238, 432, 586, 679, 699, 661, 585,\
+		487, 367, 227, 118, 143, 399, 859, 1416, 1975, 2519, 3063, 3616, 4166, 4695, 5191, 5654,\
+		6084, 6500, 6944, 7455, 8024, 8610, 9175, 9702, 10180, 10605, 10985, 11330, 11649, 11941, 12207, 12452,\
+		12686, 12919, 13150, 13375, 13586, 13768, 13906, 13988, 14030, 14053, 14071, 14085, 14097, 14105, 14113, 14122,\
+		14133, 14148, 14175, 14261, 14471, 14846, 15345, 15909, 16495, 17099, 17720, 18359, 19016, 19690, 20384, 21097,\
+		21828, 22555, 23245, 23877, 24474, 25069, 25685, 26326, 26991, 27680, 28393, 29131, 29893, 30680, 31482, 32217,\
+		32767}
+
+	#define newest_bounce_attack0 {\
+		0, 688, 1461, 2317, 3252, 4265, 5352, 6509, 7734, 9023, 10372, 11776, 13232, 14736, 16284, 17870,\
+		19491, 21142, 22818, 24515, 26227, 27951, 29681, 31412, 32394, 30681, 29013, 27422, 25936, 24581, 23384, 22364,\
+		21541, 20928, 20537, 20373, 20438, 20731, 21245, 21970, 22892, 23992, 25250, 26642, 28141, 29720, 31349, 32537,\
+		30940, 29576, 28613, 28167, 28292, 28970, 30116, 31585, 32340, 31116, 31197, 32513, 31510, 32181, 32212, 32245,\
+		32281, 32317, 32356, 32395, 32437, 32479, 32522, 32566, 32610, 32655, 32700, 32745, 32743, 32663, 32557, 32628,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767}
+
+	#define newest_bounce_attack1 {\
+		0, 688, 1461, 2317, 3252, 4265, 5352, 6509, 7734, 9023, 10372, 11776, 13232, 14736, 16284, 17870,\
+		19491, 21142, 22818, 24515, 26227, 27951, 29681, 31412, 32394, 30678, 28994, 27362, 25802, 24333, 22971, 21732,\
+		20631, 19682, 18893, 18275, 17835, 17576, 17501, 17611, 17903, 18373, 19015, 19820, 20778, 21877, 23103, 24440,\
+		25872, 27382, 28951, 30559, 32188, 31717, 30140, 28708, 27497, 26570, 25975, 25742, 25882, 26387, 27227, 28358,\
+		29718, 31234, 32709, 31180, 30023, 29501, 29733, 30662, 32072, 31898, 31043, 31826, 32035, 32537, 31791, 32715,\
+		32718, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767}
+
+	#define newest_bounce_attack2 {\
+		0, 688, 1461, 2317, 3252, 4265, 5352, 6509, 7734, 9023, 10372, 11776, 13232, 14736, 16284, 17870,\
+		19491, 21142, 22818, 24515, 26227, 27951, 29681, 31412, 32394, 30676, 28981, 27324, 25716, 24170, 22698, 21312,\
+		20021, 18837, 17768, 16821, 16004, 15323, 14783, 14387, 14138, 14037, 14085, 14280, 14621, 15104, 15724, 16477,\
+		17355, 18352, 19459, 20666, 21965, 23344, 24791, 26296, 27846, 29429, 31032, 32642, 31287, 29715, 28220, 26834,\
+		25588, 24512, 23628, 22956, 22511, 22301, 22332, 22599, 23098, 23816, 24734, 25833, 27085, 28462, 29931, 31460,\
+		32522, 30999, 29597, 28409, 27512, 26964, 26799, 27027, 27631, 28570, 29781, 31183, 32684, 31350, 30066, 29294,\
+		29178, 29736, 30862, 32340, 31640, 30583, 30679, 31875, 31998, 31331, 32667, 31397, 32285, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767}
+
+	#define newest_bounce_attack3 {\
+		0, 688, 1461, 2317, 3252, 4265, 5352, 6509, 7734, 9023, 10372, 11776, 13232, 14736, 16284, 17870,\
+		19491, 21142, 22818, 24515, 26227, 27951, 29681, 31412, 32394, 30675, 28974, 27300, 25662, 24069, 22529, 21050,\
+		19639, 18305, 17054, 15892, 14825, 13858, 12997, 12246, 11607, 11085, 10681, 10397, 10234, 10193, 10273, 10473,\
+		10792, 11228, 11777, 12437, 13203, 14072, 15037, 16093, 17235, 18455, 19747, 21104, 22518, 23981, 25486, 27024,\
+		28586, 30165, 31751, 32198, 30625, 29080, 27581, 26142, 24778, 23504, 22332, 21274, 20342, 19543, 18887, 18379,\
+		18025, 17827, 17786, 17903, 18176, 18601, 19173, 19885, 20730, 21698, 22779, 23960, 25229, 26572, 27975, 29423,\
+		30900, 32390, 31655, 30192, 28788, 27471, 26269, 25205, 24301, 23574, 23040, 22707, 22583, 22669, 22963, 23457,\
+		24140, 24998, 26013, 27162, 28422, 29767, 31168, 32596, 31512, 30135, 28869, 27765, 26867, 26209, 25819, 25709,\
+		25884, 26335, 27044, 27980, 29104, 30372, 31731, 32407, 31048, 29829, 28846, 28175, 27868, 27948, 28406, 29205,\
+		30281, 31548, 32628, 31309, 30218, 29522, 29325, 29657, 30463, 31619, 32588, 31339, 30519, 30368, 30928, 32032,\
+		32185, 31185, 31085, 31939, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,\
+		32767}
+
+	#define newest_bounce_attack4 {\
+		0, 693, 1472, 2334, 3276, 4296, 5391, 6557, 7791, 9089, 10447, 11862, 13329, 14844, 16403, 18001,\
+		19634, 21297, 22985, 24694, 26419, 28156, 29898, 31642, 32631, 30899, 29181, 27485, 25816, 24182, 22587, 21038,\
+		19540, 18099, 16721, 15409, 14170, 13006, 11923, 10923, 10011, 9190, 8462, 7830, 7295, 6860, 6525, 6292,\
+		6161, 6131, 6204, 6377, 6651, 7023, 7492, 8055, 8710, 9455, 10286, 11199, 12191, 13258, 14395, 15598,\
+		16862, 18182, 19553, 20969, 22425, 23915, 25434, 26975, 28533, 30102, 31675, 32767, 31203, 29654, 28129, 26636,\
+		25181, 23774, 22420, 21127, 19901, 18748, 17674, 16685, 15784, 14977, 14268, 13659, 13153, 12753, 12460, 12276,\
+		12200, 12233, 12375, 12624, 12978, 13435, 13992, 14646, 15394, 16230, 17151, 18150, 19224, 20364, 21566, 22824,\
+		24129, 25475, 26855, 28262, 29688, 31126, 32567, 32009, 30583, 29180, 27811, 26484, 25210, 23997, 22853, 21788,\
+		20807, 19918, 19127, 18439, 17859, 17390, 17035, 16797, 16676, 16674, 16789, 17020, 17366, 17822, 18387, 19054,\
+		19819, 20676, 21619, 22639, 23731, 24884, 26092, 27344, 28633, 29947, 31279, 32617, 32061, 30739, 29445, 28191,\
+		26990, 25854, 24794, 23819, 22940, 22164, 21499, 20950, 20524, 20224, 20052, 20009, 20096, 20310, 20650, 21112,\
+		21689, 22377, 23168, 24053, 25024, 26070, 27181, 28346, 29552, 30787, 32040, 32717, 31468, 30246, 29067, 27947,\
+		26900, 25941, 25083, 24337, 23713, 23219, 22861, 22644, 22569, 22638, 22849, 23199, 23681, 24290, 25015, 25848,\
+		26775, 27784, 28860, 29989, 31155, 32342, 32481, 31304, 30164, 29083, 28080, 27174, 26383, 25720, 25197, 24824,\
+		24608, 24551, 24655, 24916, 25330, 25887, 26576, 27384, 28296, 29293, 30357, 31466, 32600, 32277, 31162, 30100,\
+		29118, 28241, 27492, 26891, 26451, 26184, 26097, 26190, 26461, 26901, 27500, 28240, 29101, 30061, 31094, 32767,\
+		32767}
+
+	#define newest_bounce_release0 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 139, 210, 104, 24, 22, 67, 112, 157, 201, 245, 288, 330, 372, 411, 450,\
+		486, 522, 555, 586, 1257, 254, 1570, 1651, 427, 1182, 2651, 3797, 4475, 4600, 4154, 3191,\
+		1827, 230, 1418, 3047, 4626, 6125, 7517, 8775, 9875, 10797, 11522, 12036, 12329, 12394, 12230, 11839,\
+		11226, 10403, 9383, 8186, 6831, 5345, 3754, 2086, 373, 1355, 3086, 4816, 6540, 8252, 9949, 11625,\
+		13276, 14897, 16483, 18031, 19535, 20991, 22395, 23744, 25033, 26258, 27415, 28502, 29515, 30450, 31306, 32079,\
+		32767}
+
+	#define newest_bounce_release1 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		49, 52, 976, 230, 732, 941, 1724, 869, 695, 2105, 3034, 3266, 2744, 1587, 58, 1533,\
+		3049, 4409, 5540, 6380, 6885, 7025, 6792, 6197, 5270, 4059, 2627, 1050, 579, 2208, 3816, 5385,\
+		6895, 8327, 9664, 10890, 11989, 12947, 13752, 14394, 14864, 15156, 15266, 15191, 14932, 14492, 13874, 13085,\
+		12136, 11035, 9796, 8434, 6965, 5405, 3773, 2089, 373, 1355, 3086, 4816, 6540, 8252, 9949, 11625,\
+		13276, 14897, 16483, 18031, 19535, 20991, 22395, 23744, 25033, 26258, 27415, 28502, 29515, 30450, 31306, 32079,\
+		32767}
+
+	#define newest_bounce_release2 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 482, 1370, 100, 1436, 769, 892, 2088, 2184, 1127, 427, 1905, 3031,\
+		3589, 3473, 2701, 1417, 83, 1584, 2986, 4197, 5136, 5740, 5968, 5803, 5255, 4358, 3170, 1768,\
+		245, 1307, 2836, 4305, 5682, 6934, 8033, 8951, 9669, 10168, 10435, 10466, 10256, 9811, 9139, 8255,\
+		7179, 5933, 4547, 3052, 1480, 125, 1735, 3338, 4921, 6471, 7976, 9423, 10802, 12101, 13308, 14415,\
+		15412, 16290, 17043, 17663, 18146, 18487, 18682, 18730, 18629, 18380, 17984, 17444, 16763, 15946, 14999, 13930,\
+		12746, 11455, 10069, 8597, 7051, 5443, 3786, 2091, 373, 1355, 3086, 4816, 6540, 8252, 9949, 11625,\
+		13276, 14897, 16483, 18031, 19535, 20991, 22395, 23744, 25033, 26258, 27415, 28502, 29515, 30450, 31306, 32079,\
+		32767}
+
+	#define newest_bounce_release3 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 828, 1682, 1582,\
+		582, 735, 1839, 2399, 2248, 1428, 179, 1148, 2304, 3110, 3442, 3245, 2549, 1458, 139, 1219,\
+		2486, 3562, 4361, 4819, 4899, 4592, 3921, 2938, 1719, 360, 1036, 2395, 3663, 4787, 5723, 6432,\
+		6883, 7058, 6948, 6558, 5900, 5002, 3898, 2632, 1255, 171, 1599, 3000, 4345, 5605, 6754, 7769,\
+		8627, 9310, 9804, 10098, 10184, 10060, 9727, 9193, 8466, 7562, 6498, 5296, 3979, 2575, 1112, 377,\
+		1867, 3344, 4792, 6195, 7538, 8807, 9988, 11069, 12037, 12882, 13594, 14166, 14591, 14864, 14981, 14940,\
+		14742, 14388, 13880, 13224, 12425, 11493, 10435, 9263, 7989, 6625, 5186, 3687, 2142, 569, 1016, 2602,\
+		4181, 5743, 7281, 8786, 10249, 11663, 13020, 14312, 15532, 16674, 17730, 18695, 19564, 20330, 20990, 21539,\
+		21975, 22294, 22494, 22574, 22533, 22370, 22086, 21682, 21160, 20521, 19770, 18909, 17942, 16875, 15713, 14462,\
+		13128, 11717, 10238, 8698, 7105, 5467, 3793, 2092, 373, 1355, 3086, 4816, 6540, 8252, 9949, 11625,\
+		13276, 14897, 16483, 18031, 19535, 20991, 22395, 23744, 25033, 26258, 27415, 28502, 29515, 30450, 31306, 32079,\
+		32767}
+
+	#define newest_bounce_release4 {\
+		0, 0, 1673, 2706, 3666, 4527, 5267, 5866, 6306, 6577, 6670, 6583, 6316, 5876, 5275, 4526,\
+		3649, 2667, 1605, 490, 167, 1301, 2410, 3474, 4471, 5383, 6191, 6880, 7437, 7851, 8112, 8216,\
+		8159, 7943, 7570, 7047, 6384, 5593, 4687, 3684, 2603, 1463, 286, 425, 1612, 2778, 3907, 4983,\
+		5992, 6919, 7752, 8477, 9086, 9568, 9918, 10129, 10198, 10123, 9906, 9548, 9054, 8430, 7684, 6826,\
+		5867, 4820, 3700, 2521, 1299, 50, 727, 1980, 3215, 4421, 5586, 6697, 7743, 8714, 9599, 10390,\
+		11078, 11655, 12117, 12457, 12671, 12758, 12715, 12543, 12243, 11817, 11268, 10603, 9827, 8948, 7973, 6913,\
+		5777, 4576, 3322, 2028, 706, 150, 1488, 2820, 4134, 5423, 6675, 7883, 9036, 10128, 11148, 12091,\
+		12948, 13713, 14380, 14945, 15401, 15747, 15978, 16093, 16091, 15970, 15732, 15377, 14908, 14328, 13640, 12849,\
+		11960, 10979, 9914, 8770, 7557, 6283, 4956, 3587, 2184, 758, 200, 1641, 3079, 4505, 5912, 7292,\
+		8638, 9943, 11201, 12403, 13543, 14617, 15616, 16537, 17373, 18121, 18775, 19332, 19789, 20143, 20392, 20534,\
+		20567, 20491, 20307, 20014, 19614, 19108, 18499, 17790, 16983, 16082, 15093, 14019, 12866, 11640, 10347, 8993,\
+		7586, 6131, 4638, 3113, 1564, 0, 1092, 2665, 4234, 5792, 7333, 8852, 10342, 11798, 13214, 14585,\
+		15905, 17169, 18372, 19509, 20576, 21568, 22481, 23312, 24057, 24712, 25275, 25744, 26116, 26390, 26563, 26636,\
+		26606, 26475, 26242, 25907, 25472, 24937, 24305, 23577, 22756, 21844, 20844, 19761, 18597, 17358, 16046, 14668,\
+		13227, 11729, 10180, 8585, 6951, 5282, 3586, 1868, 136, 1125, 2869, 4611, 6348, 8073, 9782, 11470,\
+		13133, 14766, 16364, 17923, 19438, 20905, 22320, 23678, 24976, 26210, 27376, 28471, 29491, 30433, 31295, 32074,\
+		32767}
+
+	#define euc_odd_sharp_attacks0 {\
+		0, 10000, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 14704, 13137, 12158, 11434, 10855, 10371, 9953, 9584, 9254, 8955, 8681, 8428, 8193, 7974,\
+		7768, 7573, 7389, 7215, 7048, 6890, 6738, 6592, 6452, 6317, 6187, 6062, 5941, 5823, 5710, 5599,\
+		5492, 5388, 5287, 5188, 5092, 4998, 4907, 4818, 4730, 4645, 4562, 4480, 4400, 4322, 4245, 4170,\
+		4096, 4023, 3952, 3882, 3813, 3746, 3679, 3614, 3550, 3486, 3424, 3363, 3303, 3243, 3184, 3127,\
+		3070, 3014, 2958, 2903, 2849, 2796, 2744, 2692, 2641, 2590, 2540, 2491, 2442, 2394, 2346, 2299,\
+		2252, 2206, 2160, 2115, 2071, 2027, 1983, 1940, 1897, 1854, 1813, 1771, 1730, 1689, 1649, 1609,\
+		1569, 1530, 1491, 1453, 1414, 1377, 1339, 1302, 1265, 1229, 1192, 1156, 1121, 1085, 1050, 1016,\
+		981, 947, 913, 879, 846, 813, 780, 747, 714, 682, 650, 619, 587, 556, 525, 494,\
+		463, 433, 403, 373, 343, 313, 284, 255, 226, 197, 168, 140, 111, 83, 55, 28,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 14704, 13137, 12158, 11434, 10855, 10371, 9953, 9584, 9254, 8955, 8681, 8428, 8193, 7974,\
+		7768, 7573, 7389, 7215, 7048, 6890, 6738, 6592, 6452, 6317, 6187, 6062, 5941, 5823, 5710, 5599,\
+		5492, 5388, 5287, 5188, 5092, 4998, 4907, 4818, 4730, 4645, 4562, 4480, 4400, 4322, 4245, 4170,\
+		4096, 4023, 3952, 3882, 3813, 3746, 3679, 3614, 3550, 3486, 3424, 3363, 3303, 3243, 3184, 3127,\
+		3070, 3014, 2958, 2903, 2849, 2796, 2744, 2692, 2641, 2590, 2540, 2491, 2442, 2394, 2346, 2299,\
+		2252}
+
+	#define euc_odd_sharp_attacks1 {\
+		0, 10000, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 13371, 11688, 10637, 9860, 9238, 8718, 8269, 7873, 7519, 7198, 6903, 6632, 6380, 6144,\
+		5923, 5714, 5516, 5329, 5150, 4980, 4817, 4660, 4510, 4365, 4226, 4091, 3961, 3835, 3713, 3594,\
+		3479, 3368, 3259, 3153, 3050, 2949, 2851, 2755, 2661, 2570, 2480, 2392, 2306, 2222, 2140, 2059,\
+		1980, 1902, 1825, 1750, 1676, 1604, 1533, 1462, 1393, 1325, 1259, 1193, 1128, 1064, 1001, 939,\
+		878, 818, 758, 699, 641, 584, 528, 472, 417, 363, 309, 256, 204, 152, 101, 50,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 13371, 11688, 10637, 9860, 9238, 8718, 8269, 7873, 7519, 7198, 6903, 6632, 6380, 6144,\
+		5923, 5714, 5516, 5329, 5150, 4980, 4817, 4660, 4510, 4365, 4226, 4091, 3961, 3835, 3713, 3594,\
+		3479, 3368, 3259, 3153, 3050, 2949, 2851, 2755, 2661, 2570, 2480, 2392, 2306, 2222, 2140, 2059,\
+		1980, 1902, 1825, 1750, 1676, 1604, 1533, 1462, 1393, 1325, 1259, 1193, 1128, 1064, 1001, 939,\
+		878, 818, 758, 699, 641, 584, 528, 472, 417, 363, 309, 256, 204, 152, 101, 50,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 13371, 11688, 10637, 9860, 9238, 8718, 8269, 7873, 7519, 7198, 6903, 6632, 6380, 6144,\
+		5923, 5714, 5516, 5329, 5150, 4980, 4817, 4660, 4510, 4365, 4226, 4091, 3961, 3835, 3713, 3594,\
+		3479, 3368, 3259, 3153, 3050, 2949, 2851, 2755, 2661, 2570, 2480, 2392, 2306, 2222, 2140, 2059,\
+		1980}
+
+	#define euc_odd_sharp_attacks2 {\
+		0, 10000, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 12123, 10333, 9214, 8387, 7725, 7172, 6694, 6272, 5895, 5553, 5240, 4952, 4683, 4432,\
+		4197, 3975, 3764, 3565, 3375, 3193, 3019, 2853, 2693, 2539, 2390, 2247, 2109, 1975, 1845, 1719,\
+		1596, 1477, 1361, 1249, 1139, 1032, 927, 825, 726, 628, 533, 439, 348, 258, 171, 84,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 12123, 10333, 9214, 8387, 7725, 7172, 6694, 6272, 5895, 5553, 5240, 4952, 4683, 4432,\
+		4197, 3975, 3764, 3565, 3375, 3193, 3019, 2853, 2693, 2539, 2390, 2247, 2109, 1975, 1845, 1719,\
+		1596, 1477, 1361, 1249, 1139, 1032, 927, 825, 726, 628, 533, 439, 348, 258, 171, 84,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 13371, 11688, 10637, 9860, 9238, 8718, 8269, 7873, 7519, 7198, 6903, 6632, 6380, 6144,\
+		5923, 5714, 5516, 5329, 5150, 4980, 4817, 4660, 4510, 4365, 4226, 4091, 3961, 3835, 3713, 3594,\
+		3479, 3368, 3259, 3153, 3050, 2949, 2851, 2755, 2661, 2570, 2480, 2392, 2306, 2222, 2140, 2059,\
+		1980, 1902, 1825, 1750, 1676, 1604, 1533, 1462, 1393, 1325, 1259, 1193, 1128, 1064, 1001, 939,\
+		878, 818, 758, 699, 641, 584, 528, 472, 417, 363, 309, 256, 204, 152, 101, 50,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 12123, 10333, 9214, 8387, 7725, 7172, 6694, 6272, 5895, 5553, 5240, 4952, 4683, 4432,\
+		4197}
+
+	#define euc_odd_sharp_attacks3 {\
+		0, 10000, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 12123, 10333, 9214, 8387, 7725, 7172, 6694, 6272, 5895, 5553, 5240, 4952, 4683, 4432,\
+		4197, 3975, 3764, 3565, 3375, 3193, 3019, 2853, 2693, 2539, 2390, 2247, 2109, 1975, 1845, 1719,\
+		1596, 1477, 1361, 1249, 1139, 1032, 927, 825, 726, 628, 533, 439, 348, 258, 171, 84,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 12123, 10333, 9214, 8387, 7725, 7172, 6694, 6272, 5895, 5553, 5240, 4952, 4683, 4432,\
+		4197, 3975, 3764, 3565, 3375, 3193, 3019, 2853, 2693, 2539, 2390, 2247, 2109, 1975, 1845, 1719,\
+		1596, 1477, 1361, 1249, 1139, 1032, 927, 825, 726, 628, 533, 439, 348, 258, 171, 84,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 12123, 10333, 9214, 8387, 7725, 7172, 6694, 6272, 5895, 5553, 5240, 4952, 4683, 4432,\
+		4197, 3975, 3764, 3565, 3375, 3193, 3019, 2853, 2693, 2539, 2390, 2247, 2109, 1975, 1845, 1719,\
+		1596, 1477, 1361, 1249, 1139, 1032, 927, 825, 726, 628, 533, 439, 348, 258, 171, 84,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 9091, 7038, 5755, 4806, 4047, 3412, 2864, 2381, 1948, 1556, 1197, 866, 558, 270,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 12123, 10333, 9214, 8387, 7725, 7172, 6694, 6272, 5895, 5553, 5240, 4952, 4683, 4432,\
+		4197}
+
+	#define euc_odd_sharp_attacks4 {\
+		0, 10000, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 9091, 7038, 5755, 4806, 4047, 3412, 2864, 2381, 1948, 1556, 1197, 866, 558, 270,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 12123, 10333, 9214, 8387, 7725, 7172, 6694, 6272, 5895, 5553, 5240, 4952, 4683, 4432,\
+		4197, 3975, 3764, 3565, 3375, 3193, 3019, 2853, 2693, 2539, 2390, 2247, 2109, 1975, 1845, 1719,\
+		1596, 1477, 1361, 1249, 1139, 1032, 927, 825, 726, 628, 533, 439, 348, 258, 171, 84,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 9091, 7038, 5755, 4806, 4047, 3412, 2864, 2381, 1948, 1556, 1197, 866, 558, 270,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 12123, 10333, 9214, 8387, 7725, 7172, 6694, 6272, 5895, 5553, 5240, 4952, 4683, 4432,\
+		4197, 3975, 3764, 3565, 3375, 3193, 3019, 2853, 2693, 2539, 2390, 2247, 2109, 1975, 1845, 1719,\
+		1596, 1477, 1361, 1249, 1139, 1032, 927, 825, 726, 628, 533, 439, 348, 258, 171, 84,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 9091, 7038, 5755, 4806, 4047, 3412, 2864, 2381, 1948, 1556, 1197, 866, 558, 270,\
+		0, 0, 23676, 25729, 27012, 27961, 28720, 29355, 29903, 30386, 30819, 31211, 31570, 31901, 32209, 32497,\
+		32767, 32767, 12123, 10333, 9214, 8387, 7725, 7172, 6694, 6272, 5895, 5553, 5240, 4952, 4683, 4432,\
+		4197}
+
+	#define euc_odd_sharp_releases0 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 50, 77, 104,\
+		132, 159, 187, 215, 243, 271, 299, 328, 356, 385, 414, 444, 473, 503, 533, 563,\
+		593, 624, 654, 685, 717, 748, 780, 811, 843, 876, 908, 941, 974, 1007, 1041, 1075,\
+		1109, 1143, 1178, 1213, 1248, 1284, 1319, 1355, 1392, 1429, 1466, 1503, 1541, 1579, 1617, 1656,\
+		1695, 1734, 1774, 1814, 1855, 1896, 1937, 1979, 2021, 2064, 2107, 2150, 2194, 2239, 2284, 2329,\
+		2375, 2421, 2468, 2516, 2564, 2612, 2662, 2711, 2762, 2813, 2864, 2917, 2970, 3024, 3078, 3133,\
+		3189, 3246, 3303, 3362, 3421, 3481, 3542, 3604, 3667, 3731, 3796, 3862, 3930, 3998, 4068, 4139,\
+		4211, 4285, 4360, 4436, 4514, 4594, 4675, 4758, 4843, 4930, 5019, 5110, 5204, 5299, 5397, 5498,\
+		5602, 5709, 5819, 5932, 6049, 6169, 6294, 6424, 6558, 6697, 6842, 6994, 7152, 7318, 7491, 7675,\
+		7868, 8074, 8292, 8526, 8778, 9051, 9349, 9677, 10044, 10461, 10944, 11520, 12241, 13216, 14776, 32767,\
+		32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676, 0,\
+		0, 28, 55, 83, 111, 140, 168, 197, 226, 255, 284, 313, 343, 373, 403, 433,\
+		463, 494, 525, 556, 587, 619, 650, 682, 714, 747, 780, 813, 846, 879, 913, 947,\
+		981, 1016, 1050, 1085, 1121, 1156, 1192, 1229, 1265, 1302, 1339, 1377, 1414, 1453, 1491, 1530,\
+		1569, 1609, 1649, 1689, 1730, 1771, 1813, 1854, 1897, 1940, 1983, 2027, 2071, 2115, 2160, 2206}
+
+	#define euc_odd_sharp_releases1 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,\
+		0, 0, 0, 34, 76, 119, 162, 206, 250, 295, 340, 385, 431, 478, 524, 572,\
+		620, 668, 717, 767, 817, 868, 919, 971, 1024, 1077, 1131, 1185, 1241, 1297, 1353, 1411,\
+		1469, 1528, 1588, 1649, 1711, 1773, 1837, 1901, 1967, 2033, 2101, 2170, 2239, 2310, 2383, 2456,\
+		2531, 2608, 2685, 2765, 2845, 2928, 3012, 3098, 3186, 3275, 3367, 3461, 3557, 3656, 3757, 3861,\
+		3967, 4077, 4189, 4305, 4425, 4548, 4676, 4808, 4944, 5086, 5233, 5387, 5547, 5714, 5889, 6072,\
+		6266, 6470, 6687, 6918, 7165, 7431, 7719, 8034, 8381, 8769, 9208, 9718, 10327, 11089, 12118, 13766,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 50, 101, 152, 204, 256, 309, 363, 417, 472, 528, 584, 641, 699, 758,\
+		818, 878, 939, 1001, 1064, 1128, 1193, 1259, 1325, 1393, 1462, 1533, 1604, 1676, 1750, 1825,\
+		1902, 1980, 2059, 2140, 2222, 2306, 2392, 2480, 2570, 2661, 2755, 2851, 2949, 3050, 3153, 3259,\
+		3368, 3479, 3594, 3713, 3835, 3961, 4091, 4226, 4365, 4510, 4660, 4817, 4980, 5150, 5329, 5516,\
+		5714, 5923, 6144, 6380, 6632, 6903, 7198, 7519, 7873, 8269, 8718, 9238, 9860, 10637, 11688, 13371,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 50, 101, 152, 204, 256, 309, 363, 417, 472, 528, 584, 641, 699, 758,\
+		818, 878, 939, 1001, 1064, 1128, 1193, 1259, 1325, 1393, 1462, 1533, 1604, 1676, 1750, 1825,\
+		1902}
+
+	#define euc_odd_sharp_releases2 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 173, 277, 384, 493, 605, 721,\
+		839, 960, 1085, 1214, 1346, 1483, 1624, 1771, 1922, 2079, 2242, 2412, 2590, 2775, 2969, 3172,\
+		3387, 3614, 3854, 4110, 4384, 4679, 4998, 5347, 5732, 6162, 6649, 7214, 7890, 8734, 9875, 11702,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 84, 171, 258, 348, 439, 533, 628, 726, 825, 927, 1032, 1139, 1249, 1361,\
+		1477, 1596, 1719, 1845, 1975, 2109, 2247, 2390, 2539, 2693, 2853, 3019, 3193, 3375, 3565, 3764,\
+		3975, 4197, 4432, 4683, 4952, 5240, 5553, 5895, 6272, 6694, 7172, 7725, 8387, 9214, 10333, 12123,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 50, 101, 152, 204, 256, 309, 363, 417, 472, 528, 584, 641, 699, 758,\
+		818, 878, 939, 1001, 1064, 1128, 1193, 1259, 1325, 1393, 1462, 1533, 1604, 1676, 1750, 1825,\
+		1902, 1980, 2059, 2140, 2222, 2306, 2392, 2480, 2570, 2661, 2755, 2851, 2949, 3050, 3153, 3259,\
+		3368, 3479, 3594, 3713, 3835, 3961, 4091, 4226, 4365, 4510, 4660, 4817, 4980, 5150, 5329, 5516,\
+		5714, 5923, 6144, 6380, 6632, 6903, 7198, 7519, 7873, 8269, 8718, 9238, 9860, 10637, 11688, 13371,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 84, 171, 258, 348, 439, 533, 628, 726, 825, 927, 1032, 1139, 1249, 1361,\
+		1477, 1596, 1719, 1845, 1975, 2109, 2247, 2390, 2539, 2693, 2853, 3019, 3193, 3375, 3565, 3764,\
+		3975}
+
+	#define euc_odd_sharp_releases3 {\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 173, 277, 384, 493, 605, 721,\
+		839, 960, 1085, 1214, 1346, 1483, 1624, 1771, 1922, 2079, 2242, 2412, 2590, 2775, 2969, 3172,\
+		3387, 3614, 3854, 4110, 4384, 4679, 4998, 5347, 5732, 6162, 6649, 7214, 7890, 8734, 9875, 11702,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 270, 558, 866, 1197, 1556, 1948, 2381, 2864, 3412, 4047, 4806, 5755, 7038, 9091,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 84, 171, 258, 348, 439, 533, 628, 726, 825, 927, 1032, 1139, 1249, 1361,\
+		1477, 1596, 1719, 1845, 1975, 2109, 2247, 2390, 2539, 2693, 2853, 3019, 3193, 3375, 3565, 3764,\
+		3975, 4197, 4432, 4683, 4952, 5240, 5553, 5895, 6272, 6694, 7172, 7725, 8387, 9214, 10333, 12123,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 84, 171, 258, 348, 439, 533, 628, 726, 825, 927, 1032, 1139, 1249, 1361,\
+		1477, 1596, 1719, 1845, 1975, 2109, 2247, 2390, 2539, 2693, 2853, 3019, 3193, 3375, 3565, 3764,\
+		3975, 4197, 4432, 4683, 4952, 5240, 5553, 5895, 6272, 6694, 7172, 7725, 8387, 9214, 10333, 12123,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 84, 171, 258, 348, 439, 533, 628, 726, 825, 927, 1032, 1139, 1249, 1361,\
+		1477, 1596, 1719, 1845, 1975, 2109, 2247, 2390, 2539, 2693, 2853, 3019, 3193, 3375, 3565, 3764,\
+		3975}
+
+	#define euc_odd_sharp_releases4 {\
+		0, 0, 0, 0, 215, 553, 919, 1319, 1761, 2254, 2813, 3461, 4235, 5204, 6513, 8608,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 84, 171, 258, 348, 439, 533, 628, 726, 825, 927, 1032, 1139, 1249, 1361,\
+		1477, 1596, 1719, 1845, 1975, 2109, 2247, 2390, 2539, 2693, 2853, 3019, 3193, 3375, 3565, 3764,\
+		3975, 4197, 4432, 4683, 4952, 5240, 5553, 5895, 6272, 6694, 7172, 7725, 8387, 9214, 10333, 12123,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 270, 558, 866, 1197, 1556, 1948, 2381, 2864, 3412, 4047, 4806, 5755, 7038, 9091,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 84, 171, 258, 348, 439, 533, 628, 726, 825, 927, 1032, 1139, 1249, 1361,\
+		1477, 1596, 1719, 1845, 1975, 2109, 2247, 2390, 2539, 2693, 2853, 3019, 3193, 3375, 3565, 3764,\
+		3975, 4197, 4432, 4683, 4952, 5240, 5553, 5895, 6272, 6694, 7172, 7725, 8387, 9214, 10333, 12123,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 270, 558, 866, 1197, 1556, 1948, 2381, 2864, 3412, 4047, 4806, 5755, 7038, 9091,\
+		32767, 32767, 32497, 32209, 31901, 31570, 31211, 30819, 30386, 29903, 29355, 28720, 27961, 27012, 25729, 23676,\
+		0, 0, 84, 171, 258, 348, 439, 533, 628, 726, 825, 927, 1032, 1139, 1249, 1361,\
+		1477, 1596, 1719, 1845, 1975, 2109, 2247, 2390, 2539, 2693, 2853, 3019, 3193, 3375, 3565, 3764,\
+		3975}
+
+	#define new_waves_attack0 {\
+		0, 17, 37, 58, 80, 104, 129, 155, 184, 214, 246, 280, 316, 354, 395, 438,\
+		483, 531, 582, 637, 694, 754, 818, 886, 958, 1033, 1113, 1197, 1285, 1378, 1476, 1579,\
+		1687, 1801, 1920, 2045, 2176, 2313, 2456, 2605, 2760, 2922, 3090, 3265, 3446, 3634, 3828, 4028,\
+		4235, 4447, 4666, 4890, 5120, 5354, 5594, 5838, 6086, 6338, 6593, 6851, 7111, 7373, 7636, 7900,\
+		8164, 8428, 8691, 8952, 9212, 9469, 9723, 9974, 10222, 10465, 10703, 10936, 11165, 11388, 11605, 11816,\
+		12021, 12220, 12412, 12598, 12778, 12951, 13117, 13278, 13431, 13579, 13720, 13855, 13985, 14108, 14226, 14338,\
+		14445, 14547, 14644, 14736, 14823, 14906, 14985, 15059, 15129, 15196, 15259, 15319, 15376, 15429, 15479, 15527,\
+		15572, 15614, 15654, 15692, 15727, 15761, 15792, 15822, 15850, 15876, 15901, 15924, 15946, 15967, 15986, 15839,\
+		8170, 8000, 8002, 8008, 8013, 8020, 8027, 8035, 8044, 8054, 8064, 8076, 8089, 8104, 8120, 8138,\
+		8157, 8179, 8203, 8230, 8259, 8291, 8327, 8366, 8410, 8458, 8511, 8569, 8633, 8704, 8781, 8867,\
+		8961, 9064, 9177, 9301, 9436, 9585, 9747, 9924, 10116, 10326, 10553, 10799, 11066, 11353, 11663, 11995,\
+		12351, 12731, 13136, 13565, 14019, 14498, 14999, 15524, 16069, 16634, 17217, 17815, 18426, 19046, 19673, 20304,\
+		20936, 21564, 22187, 22800, 23401, 23988, 24558, 25108, 25638, 26146, 26630, 27090, 27526, 27936, 28323, 28685,\
+		29023, 29338, 29631, 29903, 30154, 30386, 30600, 30797, 30977, 31143, 31294, 31433, 31560, 31676, 31781, 31877,\
+		31965, 32044, 32117, 32182, 32242, 32296, 32345, 32390, 32430, 32467, 32500, 32530, 32557, 32582, 32604, 32624,\
+		32643, 32659, 32674, 32688, 32700, 32711, 32721, 32730, 32738, 32745, 32752, 32758, 32758, 32763, 32763, 32767}
+
+	#define new_waves_attack1 {\
+		0, 30, 65, 102, 141, 183, 229, 277, 329, 384, 444, 507, 574, 646, 722, 803,\
+		889, 980, 1077, 1179, 1287, 1401, 1520, 1646, 1779, 1917, 2062, 2213, 2370, 2533, 2702, 2877,\
+		3058, 3244, 3434, 3629, 3829, 4032, 4238, 4446, 4657, 4869, 5081, 5294, 5506, 5718, 5927, 6134,\
+		6339, 6540, 6737, 6929, 7117, 7300, 7478, 7650, 7816, 7976, 8129, 8277, 8418, 8553, 8682, 8804,\
+		8921, 9031, 9136, 9235, 9328, 9417, 9500, 9578, 9652, 9721, 9786, 9847, 9904, 9958, 10008, 10054,\
+		10098, 10139, 10177, 10212, 10245, 7126, 5242, 5259, 5279, 5300, 5325, 5352, 5382, 5416, 5454, 5496,\
+		5544, 5596, 5655, 5720, 5792, 5873, 5962, 6061, 6171, 6292, 6425, 6572, 6734, 6911, 7104, 7316,\
+		7545, 7795, 8064, 8354, 8665, 8996, 9349, 9722, 10114, 10525, 10953, 11395, 11849, 12314, 12786, 13262,\
+		13739, 14213, 14683, 15145, 15595, 16033, 16455, 16860, 17246, 17612, 17958, 18283, 18587, 18870, 19132, 19375,\
+		19598, 19804, 19992, 20164, 20320, 20463, 20592, 20709, 20815, 20910, 20997, 21074, 21144, 21207, 21264, 21314,\
+		21360, 21401, 21437, 21470, 21499, 21525, 21549, 21570, 21588, 21605, 17493, 10658, 10661, 10669, 10678, 10688,\
+		10700, 10714, 10730, 10749, 10771, 10797, 10826, 10861, 10901, 10947, 11001, 11063, 11135, 11219, 11315, 11426,\
+		11555, 11702, 11871, 12064, 12285, 12537, 12822, 13144, 13507, 13912, 14364, 14864, 15413, 16011, 16658, 17352,\
+		18088, 18862, 19667, 20495, 21337, 22183, 23023, 23849, 24651, 25421, 26153, 26842, 27484, 28077, 28620, 29114,\
+		29561, 29962, 30319, 30637, 30919, 31167, 31384, 31575, 31741, 31887, 32013, 32122, 32217, 32299, 32370, 32431,\
+		32484, 32530, 32569, 32603, 32632, 32657, 32679, 32698, 32713, 32727, 32739, 32749, 32758, 32760, 32765, 32767}
+
+	#define new_waves_attack2 {\
+		0, 38, 81, 128, 178, 233, 291, 354, 422, 494, 572, 656, 745, 840, 941, 1048,\
+		1161, 1281, 1408, 1540, 1679, 1825, 1976, 2133, 2296, 2464, 2636, 2812, 2992, 3174, 3359, 3545,\
+		3731, 3918, 4104, 4288, 4470, 4649, 4825, 4996, 5163, 5325, 5481, 5631, 5775, 5913, 6045, 6170,\
+		6288, 6401, 6507, 6607, 6700, 6788, 6871, 6948, 7019, 7086, 7148, 7206, 7259, 7309, 7355, 7397,\
+		3914, 3934, 3966, 4003, 4044, 4090, 4143, 4202, 4268, 4343, 4426, 4520, 4624, 4741, 4870, 5014,\
+		5173, 5348, 5540, 5750, 5979, 6227, 6495, 6783, 7089, 7414, 7756, 8113, 8484, 8867, 9257, 9654,\
+		10052, 10450, 10843, 11230, 11606, 11970, 12319, 12651, 12966, 13262, 13538, 13795, 14032, 14251, 14450, 14633,\
+		14799, 14949, 15084, 15206, 15316, 15414, 15502, 15580, 15650, 15712, 15767, 15816, 15860, 15899, 15933, 15963,\
+		7923, 7939, 7958, 7980, 8006, 8037, 8073, 8116, 8165, 8224, 8292, 8372, 8465, 8574, 8701, 8847,\
+		9017, 9212, 9437, 9693, 9985, 10315, 10685, 11098, 11554, 12054, 12597, 13180, 13798, 14446, 15116, 15800,\
+		16489, 17174, 17846, 18495, 19115, 19700, 20245, 20748, 21207, 21623, 21996, 22328, 22622, 22880, 23107, 23304,\
+		23475, 23623, 23750, 23860, 23954, 24035, 24104, 24163, 24213, 24256, 24293, 24324, 24350, 24373, 24392, 24377,\
+		12019, 12019, 12029, 12041, 12056, 12074, 12095, 12122, 12155, 12195, 12243, 12303, 12375, 12463, 12570, 12699,\
+		12855, 13044, 13270, 13540, 13860, 14240, 14684, 15200, 15795, 16470, 17229, 18068, 18980, 19955, 20978, 22029,\
+		23087, 24131, 25141, 26098, 26988, 27802, 28534, 29184, 29754, 30247, 30670, 31030, 31334, 31590, 31803, 31981,\
+		32128, 32250, 32350, 32433, 32501, 32557, 32603, 32640, 32671, 32696, 32716, 32733, 32747, 32758, 32763, 32767}
+
+	#define new_waves_attack3 {\
+		0, 48, 102, 161, 225, 296, 373, 456, 547, 644, 748, 860, 978, 1104, 1236, 1374,\
+		1518, 1667, 1820, 1977, 2135, 2296, 2456, 2616, 2773, 2928, 3080, 3226, 3368, 3503, 3632, 3754,\
+		3869, 3978, 4079, 4172, 4260, 4340, 4414, 4482, 4544, 4600, 4652, 2651, 2703, 2763, 2832, 2910,\
+		3000, 3102, 3217, 3347, 3494, 3657, 3838, 4038, 4256, 4494, 4749, 5021, 5309, 5609, 5919, 6235,\
+		6555, 6873, 7188, 7494, 7789, 8070, 8336, 8584, 8813, 9024, 9216, 9390, 9546, 9685, 9809, 9919,\
+		10015, 10100, 10174, 10239, 10296, 7179, 5306, 5352, 5407, 5473, 5551, 5645, 5756, 5888, 6043, 6225,\
+		6436, 6681, 6961, 7279, 7635, 8031, 8464, 8930, 9425, 9940, 10469, 11000, 11524, 12033, 12518, 12973,\
+		13393, 13775, 14117, 14421, 14688, 14920, 15121, 15292, 15439, 15563, 15667, 15755, 15829, 15891, 15942, 15985,\
+		7961, 7990, 8027, 8073, 8130, 8202, 8291, 8401, 8538, 8705, 8910, 9158, 9458, 9815, 10235, 10723,\
+		11282, 11909, 12598, 13339, 14116, 14910, 15701, 16469, 17196, 17867, 18473, 19010, 19478, 19878, 20217, 20500,\
+		20734, 20927, 21084, 21212, 21315, 21398, 21465, 21519, 21562, 21596, 17496, 10678, 10700, 10728, 10765, 10813,\
+		10876, 10956, 11060, 11195, 11367, 11586, 11863, 12211, 12643, 13171, 13806, 14555, 15416, 16379, 17425, 18522,\
+		19634, 20721, 21748, 22688, 23521, 24241, 24848, 25351, 25760, 26090, 26351, 26558, 26719, 26845, 26943, 27019,\
+		27077, 27122, 27156, 27183, 27203, 13409, 13413, 13429, 13450, 13479, 13519, 13572, 13643, 13740, 13869, 14041,\
+		14270, 14572, 14967, 15475, 16121, 16924, 17898, 19044, 20343, 21758, 23234, 24702, 26099, 27371, 28483, 29423,\
+		30194, 30812, 31296, 31671, 31957, 32174, 32337, 32459, 32550, 32617, 32667, 32704, 32732, 32752, 32767, 32767}
+
+	#define new_waves_attack4 {\
+		0, 52, 112, 179, 252, 334, 423, 520, 625, 738, 858, 985, 1119, 1257, 1400, 1546,\
+		1693, 1840, 1985, 2127, 2266, 2398, 2525, 2645, 2757, 2861, 2957, 3045, 3125, 3198, 3264, 3323,\
+		2017, 2080, 2154, 2240, 2340, 2454, 2585, 2734, 2902, 3088, 3294, 3519, 3760, 4016, 4284, 4560,\
+		4839, 5118, 5392, 5656, 5908, 6144, 6363, 6562, 6743, 6904, 7047, 7172, 7282, 7377, 7459, 7529,\
+		4005, 4067, 4142, 4234, 4345, 4478, 4638, 4827, 5049, 5307, 5602, 5935, 6303, 6704, 7131, 7574,\
+		8026, 8475, 8910, 9323, 9707, 10056, 10369, 10643, 10881, 11085, 11258, 11402, 11523, 11623, 11705, 11773,\
+		6000, 6053, 6122, 6209, 6320, 6458, 6632, 6847, 7111, 7431, 7812, 8257, 8767, 9335, 9952, 10602,\
+		11265, 11920, 12546, 13127, 13651, 14112, 14508, 14841, 15118, 15344, 15526, 15673, 15789, 15882, 15954, 16011,\
+		8010, 8053, 8112, 8189, 8292, 8426, 8602, 8830, 9122, 9491, 9949, 10506, 11166, 11923, 12762, 13656,\
+		14570, 15464, 16305, 17063, 17725, 18283, 18743, 19113, 19406, 19635, 19811, 19946, 20049, 20127, 20185, 20230,\
+		10036, 10070, 10117, 10183, 10274, 10398, 10567, 10796, 11103, 11509, 12034, 12699, 13515, 14480, 15572, 16749,\
+		17952, 19116, 20186, 21121, 21906, 22541, 23040, 23424, 23713, 23929, 24088, 24204, 24289, 24351, 24395, 24427,\
+		12075, 12101, 12138, 12192, 12270, 12381, 12538, 12761, 13073, 13503, 14084, 14850, 15827, 17017, 18394, 19894,\
+		21424, 22882, 24186, 25287, 26173, 26857, 27370, 27746, 28017, 28210, 28346, 28441, 28508, 28554, 28586, 28604,\
+		14123, 14143, 14172, 14215, 14280, 14377, 14520, 14731, 15040, 15484, 16111, 16973, 18112, 19546, 21241, 23105,\
+		24996, 26765, 28300, 29545, 30502, 31207, 31711, 32063, 32306, 32470, 32582, 32657, 32707, 32740, 32763, 32767}
+
+	#define new_waves_release0 {\
+		0, 16588, 16592, 16592, 16589, 16585, 16581, 16576, 16571, 16565, 16559, 16552, 16544, 16535, 16526, 16515,\
+		16504, 16491, 16477, 16461, 16444, 16424, 16403, 16380, 16354, 16326, 16294, 16260, 16222, 16180, 16134, 16083,\
+		16027, 15965, 15898, 15824, 15743, 15654, 15557, 15451, 15335, 15208, 15071, 14922, 14760, 14585, 14396, 14192,\
+		13973, 13739, 13488, 13221, 12938, 12638, 12321, 11989, 11642, 11280, 10904, 10517, 10118, 9711, 9297, 8878,\
+		8455, 8032, 7610, 7192, 6780, 6374, 5979, 5594, 5222, 4863, 4520, 4191, 3879, 3583, 3304, 3041,\
+		2794, 2563, 2348, 2149, 1963, 1791, 1633, 1486, 1352, 1228, 1115, 1011, 916, 829, 750, 677,\
+		611, 551, 497, 447, 402, 361, 324, 290, 260, 232, 207, 184, 163, 145, 128, 112,\
+		99, 86, 75, 65, 55, 47, 39, 32, 26, 21, 16, 11, 7, 3, 0, 2,\
+		681, 32120, 32767, 32737, 32705, 32671, 32635, 32596, 32555, 32512, 32466, 32417, 32365, 32310, 32251, 32189,\
+		32124, 32054, 31980, 31902, 31819, 31732, 31639, 31541, 31438, 31329, 31213, 31092, 30963, 30828, 30686, 30537,\
+		30379, 30214, 30041, 29859, 29668, 29469, 29261, 29043, 28816, 28579, 28333, 28077, 27811, 27536, 27250, 26955,\
+		26651, 26337, 26015, 25683, 25343, 24995, 24639, 24276, 23907, 23531, 23150, 22765, 22375, 21982, 21587, 21190,\
+		20792, 20394, 19996, 19600, 19207, 18816, 18430, 18048, 17671, 17300, 16935, 16577, 16227, 15885, 15551, 15226,\
+		14910, 14604, 14306, 14019, 13741, 13472, 13214, 12965, 12726, 12497, 12277, 12066, 11864, 11672, 11488, 11312,\
+		11145, 10986, 10834, 10690, 10553, 10423, 10300, 10183, 10073, 9968, 9869, 9775, 9686, 9602, 9523, 9448,\
+		9377, 9310, 9248, 9188, 9132, 9080, 9030, 8983, 8939, 8898, 8859, 8822, 8787, 8755, 8724, 8695,\
+		8670}
+
+	#define new_waves_release1 {\
+		0, 11204, 11207, 11204, 11200, 11195, 11190, 11184, 11176, 11168, 11158, 11146, 11133, 11117, 11099, 11078,\
+		11054, 11026, 10993, 10956, 10912, 10861, 10803, 10736, 10659, 10571, 10470, 10355, 10224, 10075, 9907, 9719,\
+		9508, 9274, 9015, 8731, 8422, 8089, 7732, 7355, 6959, 6548, 6126, 5699, 5270, 4845, 4429, 4026,\
+		3639, 3273, 2929, 2609, 2314, 2044, 1799, 1578, 1380, 1203, 1046, 907, 785, 678, 584, 503,\
+		431, 369, 316, 269, 229, 194, 164, 138, 115, 96, 80, 65, 53, 42, 33, 25,\
+		19, 13, 8, 4, 0, 1, 13913, 22301, 22283, 22263, 22241, 22217, 22189, 22158, 22124, 22085,\
+		22042, 21995, 21941, 21882, 21816, 21743, 21661, 21570, 21470, 21359, 21236, 21101, 20952, 20788, 20609, 20412,\
+		20198, 19965, 19713, 19440, 19146, 18831, 18494, 18137, 17759, 17361, 16945, 16511, 16063, 15602, 15131, 14653,\
+		14170, 13687, 13206, 12729, 12262, 11805, 11361, 10933, 10523, 10131, 9760, 9410, 9080, 8772, 8485, 8219,\
+		7973, 7747, 7538, 7348, 7174, 7015, 6871, 6740, 6621, 6514, 6417, 6329, 6250, 6179, 6116, 6058,\
+		6007, 5961, 5920, 5882, 5849, 5820, 5793, 5769, 5748, 5729, 5712, 15910, 32767, 32698, 32625, 32546,\
+		32461, 32371, 32274, 32171, 32060, 31942, 31815, 31681, 31538, 31385, 31223, 31051, 30868, 30675, 30470, 30254,\
+		30026, 29786, 29533, 29268, 28990, 28700, 28397, 28081, 27752, 27412, 27060, 26696, 26322, 25937, 25543, 25141,\
+		24731, 24315, 23893, 23467, 23038, 22607, 22176, 21745, 21316, 20890, 20469, 20053, 19644, 19243, 18850, 18467,\
+		18094, 17731, 17380, 17041, 16714, 16400, 16098, 15809, 15532, 15269, 15017, 14779, 14552, 14337, 14134, 13941,\
+		13760, 13589, 13428, 13276, 13134, 13001, 12875, 12758, 12648, 12545, 12449, 12359, 12275, 12197, 12124, 12056,\
+		11996}
+
+	#define new_waves_release2 {\
+		0, 8487, 8489, 8485, 8480, 8475, 8468, 8460, 8449, 8437, 8421, 8403, 8380, 8352, 8318, 8277,\
+		8227, 8167, 8094, 8007, 7902, 7778, 7631, 7458, 7256, 7023, 6757, 6457, 6124, 5760, 5369, 4956,\
+		4528, 4095, 3665, 3247, 2848, 2475, 2132, 1821, 1545, 1302, 1090, 909, 753, 622, 512, 419,\
+		342, 278, 225, 182, 146, 116, 92, 72, 56, 42, 31, 22, 15, 9, 4, 0,\
+		0, 16892, 16922, 16908, 16890, 16870, 16846, 16818, 16785, 16747, 16702, 16649, 16587, 16514, 16430, 16332,\
+		16219, 16088, 15936, 15763, 15564, 15339, 15084, 14798, 14479, 14127, 13741, 13323, 12874, 12399, 11901, 11386,\
+		10860, 10331, 9806, 9292, 8795, 8321, 7874, 7458, 7074, 6724, 6407, 6123, 5870, 5647, 5450, 5278,\
+		5128, 4998, 4885, 4788, 4705, 4633, 4572, 4519, 4475, 4436, 4404, 4376, 4353, 4332, 4315, 4301,\
+		4289, 25194, 25153, 25106, 25054, 24994, 24927, 24852, 24767, 24672, 24565, 24445, 24311, 24162, 23996, 23811,\
+		23606, 23380, 23131, 22859, 22561, 22237, 21887, 21510, 21107, 20678, 20224, 19748, 19252, 18739, 18212, 17675,\
+		17133, 16590, 16049, 15516, 14995, 14489, 14001, 13535, 13092, 12674, 12282, 11917, 11578, 11266, 10979, 10717,\
+		10479, 10262, 10066, 9890, 9731, 9588, 9461, 9347, 9245, 9155, 9074, 9003, 8939, 8883, 8833, 8789,\
+		8810, 32767, 32658, 32541, 32414, 32277, 32130, 31971, 31800, 31617, 31420, 31209, 30985, 30745, 30489, 30218,\
+		29931, 29628, 29308, 28971, 28619, 28250, 27866, 27467, 27053, 26627, 26189, 25740, 25282, 24817, 24345, 23870,\
+		23393, 22916, 22440, 21968, 21501, 21042, 20591, 20151, 19722, 19306, 18904, 18517, 18146, 17790, 17450, 17127,\
+		16821, 16531, 16257, 15998, 15756, 15528, 15315, 15116, 14930, 14757, 14596, 14446, 14307, 14178, 14059, 13949,\
+		13851}
+
+	#define new_waves_release3 {\
+		0, 5732, 5732, 5728, 5722, 5714, 5703, 5688, 5668, 5641, 5605, 5557, 5493, 5408, 5297, 5153,\
+		4971, 4742, 4464, 4135, 3758, 3344, 2909, 2473, 2053, 1669, 1330, 1041, 803, 612, 461, 345,\
+		255, 187, 136, 98, 70, 48, 33, 21, 12, 6, 1, 0, 11451, 11440, 11427, 11409,\
+		11385, 11355, 11316, 11265, 11200, 11116, 11009, 10874, 10703, 10491, 10230, 9915, 9542, 9111, 8624, 8092,\
+		7528, 6952, 6383, 5842, 5342, 4896, 4508, 4179, 3905, 3682, 3501, 3358, 3244, 3155, 3085, 3031,\
+		2990, 2957, 2932, 2913, 2899, 2887, 11768, 17114, 17086, 17050, 17005, 16950, 16881, 16795, 16689, 16559,\
+		16399, 16205, 15970, 15689, 15357, 14970, 14524, 14022, 13465, 12863, 12226, 11570, 10912, 10267, 9653, 9082,\
+		8562, 8099, 7694, 7345, 7049, 6801, 6595, 6425, 6286, 6173, 6082, 6008, 5949, 5901, 5863, 5832,\
+		5808, 22697, 22642, 22575, 22495, 22400, 22286, 22150, 21990, 21800, 21578, 21318, 21017, 20672, 20278, 19834,\
+		19339, 18796, 18207, 17578, 16919, 16239, 15551, 14867, 14198, 13558, 12954, 12393, 11880, 11418, 11006, 10643,\
+		10327, 10053, 9817, 9617, 9446, 9302, 9180, 9078, 8993, 8922, 8863, 16061, 27965, 27848, 27713, 27559,\
+		27383, 27183, 26956, 26699, 26410, 26086, 25726, 25329, 24892, 24416, 23902, 23352, 22769, 22157, 21522, 20871,\
+		20210, 19548, 18892, 18249, 17627, 17031, 16467, 15938, 15446, 14993, 14579, 14203, 13865, 13562, 13292, 13052,\
+		12841, 12655, 12492, 12350, 12226, 12118, 32767, 32580, 32375, 32150, 31904, 31636, 31344, 31028, 30688, 30321,\
+		29929, 29511, 29068, 28600, 28109, 27596, 27064, 26515, 25953, 25381, 24802, 24220, 23639, 23063, 22495, 21940,\
+		21400, 20878, 20376, 19897, 19442, 19012, 18607, 18229, 17876, 17549, 17246, 16967, 16710, 16476, 16261, 16066,\
+		15893}
+
+	#define new_waves_release4 {\
+		0, 4350, 4349, 4344, 4336, 4325, 4307, 4281, 4243, 4186, 4104, 3986, 3822, 3598, 3308, 2950,\
+		2537, 2096, 1661, 1265, 931, 665, 464, 318, 214, 142, 93, 59, 37, 21, 11, 5,\
+		0, 8694, 8688, 8675, 8657, 8631, 8593, 8539, 8464, 8357, 8209, 8007, 7737, 7389, 6955, 6442,\
+		5867, 5265, 4675, 4132, 3663, 3279, 2977, 2748, 2579, 2456, 2369, 2307, 2263, 2232, 2211, 2196,\
+		2186, 13023, 13004, 12977, 12940, 12889, 12820, 12724, 12595, 12421, 12191, 11891, 11510, 11039, 10478, 9837,\
+		9138, 8416, 7710, 7054, 6476, 5986, 5587, 5272, 5029, 4845, 4707, 4605, 4531, 4477, 4437, 4409,\
+		4388, 17314, 17276, 17224, 17156, 17066, 16948, 16794, 16594, 16337, 16013, 15611, 15122, 14544, 13880, 13145,\
+		12362, 11562, 10780, 10046, 9383, 8806, 8318, 7917, 7595, 7339, 7140, 6986, 6868, 6779, 6711, 6660,\
+		6622, 21533, 21461, 21369, 21253, 21106, 20922, 20692, 20407, 20058, 19638, 19140, 18559, 17899, 17167, 16378,\
+		15553, 14717, 13898, 13121, 12404, 11762, 11201, 10721, 10319, 9986, 9715, 9496, 9321, 9182, 9072, 8986,\
+		8918, 25609, 25485, 25334, 25150, 24928, 24662, 24345, 23971, 23533, 23029, 22455, 21813, 21108, 20349, 19548,\
+		18724, 17894, 17079, 16295, 15559, 14881, 14270, 13728, 13254, 12846, 12498, 12205, 11959, 11756, 11588, 11449,\
+		11336, 29420, 29223, 28994, 28728, 28422, 28070, 27670, 27218, 26713, 26154, 25543, 24882, 24177, 23437, 22670,\
+		21890, 21107, 20335, 19585, 18867, 18191, 17563, 16986, 16463, 15994, 15578, 15211, 14890, 14611, 14370, 14163,\
+		13992, 32767, 32488, 32177, 31833, 31453, 31036, 30582, 30090, 29561, 28996, 28398, 27770, 27117, 26444, 25757,\
+		25063, 24369, 23681, 23006, 22351, 21720, 21119, 20550, 20017, 19521, 19062, 18641, 18258, 17909, 17595, 17313,\
+		17065}
+
+	#define test_fm_attack0 {\
+		0, 24, 89, 193, 336, 515, 732, 988, 1279, 1605, 1964, 2359, 2785, 3242, 3728, 4244,\
+		4786, 5353, 5944, 6558, 7192, 7845, 8515, 9201, 9901, 10613, 11334, 12065, 12802, 13544, 14288, 15036,\
+		15782, 16525, 17265, 18001, 18731, 19451, 20161, 20862, 21550, 22223, 22881, 23525, 24151, 24758, 25346, 25916,\
+		26464, 26991, 27495, 27978, 28438, 28873, 29285, 29674, 30038, 30377, 30692, 30982, 31249, 31490, 31708, 31902,\
+		32072, 32219, 32342, 32444, 32523, 32580, 32617, 32633, 32630, 32606, 32564, 32505, 32428, 32334, 32224, 32099,\
+		31960, 31806, 31640, 31462, 31272, 31071, 30859, 30639, 30410, 30173, 29928, 29677, 29420, 29158, 28890, 28619,\
+		28345, 28067, 27787, 27506, 27223, 26939, 26655, 26372, 26089, 25808, 25528, 25250, 24974, 24701, 24431, 24165,\
+		23902, 23643, 23388, 23138, 22893, 22652, 22417, 22187, 21963, 21744, 21531, 21324, 21124, 20930, 20742, 20560,\
+		20385, 20217, 20056, 19901, 19753, 19612, 19478, 19351, 19231, 19118, 19013, 18914, 18821, 18737, 18659, 18588,\
+		18525, 18469, 18419, 18377, 18342, 18314, 18292, 18278, 18270, 18270, 18276, 18290, 18310, 18337, 18370, 18411,\
+		18458, 18511, 18571, 18638, 18711, 18791, 18877, 18969, 19067, 19172, 19283, 19400, 19522, 19651, 19786, 19925,\
+		20070, 20222, 20379, 20541, 20708, 20880, 21057, 21238, 21424, 21616, 21811, 22010, 22214, 22422, 22633, 22847,\
+		23065, 23286, 23511, 23737, 23966, 24198, 24432, 24667, 24904, 25143, 25383, 25623, 25863, 26105, 26347, 26588,\
+		26828, 27068, 27307, 27544, 27779, 28013, 28245, 28474, 28699, 28922, 29142, 29357, 29568, 29775, 29978, 30175,\
+		30367, 30554, 30735, 30909, 31077, 31239, 31394, 31541, 31681, 31814, 31939, 32055, 32163, 32264, 32356, 32438,\
+		32511, 32577, 32633, 32678, 32714, 32742, 32760, 32767, 32764, 32753, 32732, 32700, 32658, 32608, 32548, 32477,\
+		32396}
+
+	#define test_fm_attack1 {\
+		0, 11, 59, 143, 265, 424, 621, 855, 1127, 1435, 1780, 2160, 2575, 3024, 3505, 4017,\
+		4560, 5130, 5727, 6349, 6993, 7659, 8343, 9045, 9760, 10488, 11226, 11972, 12724, 13480, 14238, 14994,\
+		15748, 16497, 17239, 17973, 18697, 19410, 20109, 20793, 21462, 22113, 22746, 23359, 23953, 24525, 25077, 25607,\
+		26114, 26599, 27062, 27501, 27918, 28314, 28687, 29038, 29368, 29677, 29966, 30234, 30484, 30715, 30929, 31125,\
+		31306, 31470, 31621, 31757, 31881, 31992, 32093, 32182, 32261, 32332, 32394, 32449, 32497, 32538, 32574, 32604,\
+		32630, 32652, 32671, 32686, 32699, 32709, 32718, 32725, 32730, 32734, 32737, 32739, 32740, 32741, 32740, 32738,\
+		32736, 32733, 32729, 32723, 32717, 32708, 32698, 32685, 32671, 32654, 32634, 32610, 32583, 32552, 32518, 32478,\
+		32433, 32383, 32327, 32265, 32196, 32121, 32038, 31948, 31851, 31745, 31631, 31508, 31376, 31235, 31085, 30926,\
+		30757, 30578, 30390, 30193, 29986, 29769, 29543, 29307, 29063, 28809, 28547, 28276, 27998, 27712, 27418, 27118,\
+		26811, 26498, 26179, 25856, 25528, 25196, 24861, 24523, 24183, 23842, 23500, 23157, 22815, 22474, 22134, 21797,\
+		21462, 21131, 20804, 20481, 20163, 19851, 19545, 19246, 18954, 18670, 18393, 18126, 17866, 17617, 17376, 17146,\
+		16926, 16717, 16519, 16332, 16157, 15992, 15840, 15701, 15574, 15458, 15356, 15266, 15190, 15127, 15077, 15041,\
+		15019, 15010, 15015, 15034, 15067, 15114, 15176, 15252, 15343, 15448, 15568, 15703, 15852, 16016, 16195, 16389,\
+		16598, 16821, 17059, 17312, 17579, 17861, 18156, 18466, 18789, 19126, 19475, 19837, 20210, 20596, 20992, 21399,\
+		21815, 22239, 22672, 23112, 23558, 24008, 24462, 24919, 25377, 25836, 26292, 26747, 27197, 27641, 28077, 28505,\
+		28922, 29326, 29716, 30090, 30447, 30784, 31100, 31393, 31663, 31906, 32122, 32309, 32466, 32591, 32684, 32743,\
+		32766}
+
+	#define test_fm_attack2 {\
+		0, 7, 25, 52, 89, 135, 191, 256, 329, 409, 497, 592, 692, 798, 908, 1022,\
+		1138, 1256, 1374, 1493, 1610, 1726, 1838, 1947, 2051, 2149, 2241, 2326, 2404, 2472, 2532, 2581,\
+		2621, 2650, 2668, 2674, 2670, 2653, 2625, 2586, 2535, 2473, 2401, 2317, 2224, 2122, 2012, 1894,\
+		1769, 1639, 1504, 1366, 1226, 1086, 947, 811, 679, 553, 436, 328, 232, 151, 85, 36,\
+		7, 0, 16, 57, 125, 221, 347, 505, 694, 917, 1173, 1464, 1790, 2151, 2547, 2978,\
+		3442, 3940, 4469, 5030, 5619, 6236, 6879, 7545, 8232, 8939, 9661, 10398, 11146, 11902, 12664, 13429,\
+		14194, 14957, 15715, 16465, 17206, 17935, 18651, 19350, 20032, 20694, 21336, 21957, 22554, 23128, 23678, 24204,\
+		24704, 25179, 25629, 26054, 26454, 26830, 27181, 27510, 27815, 28099, 28361, 28602, 28824, 29027, 29211, 29378,\
+		29528, 29662, 29781, 29885, 29975, 30051, 30115, 30166, 30205, 30232, 30248, 30252, 30245, 30227, 30198, 30159,\
+		30108, 30046, 29973, 29889, 29794, 29687, 29568, 29437, 29295, 29140, 28973, 28795, 28603, 28399, 28183, 27955,\
+		27714, 27462, 27198, 26922, 26636, 26339, 26032, 25715, 25390, 25056, 24715, 24368, 24015, 23656, 23294, 22929,\
+		22563, 22195, 21828, 21462, 21098, 20738, 20382, 20031, 19688, 19352, 19024, 18706, 18398, 18102, 17818, 17547,\
+		17290, 17047, 16819, 16607, 16412, 16234, 16073, 15930, 15805, 15700, 15614, 15547, 15501, 15475, 15470, 15486,\
+		15523, 15581, 15661, 15763, 15887, 16032, 16200, 16391, 16603, 16838, 17094, 17373, 17673, 17995, 18337, 18700,\
+		19082, 19484, 19904, 20341, 20795, 21264, 21747, 22242, 22748, 23264, 23787, 24315, 24848, 25381, 25914, 26443,\
+		26966, 27482, 27988, 28480, 28957, 29415, 29853, 30268, 30658, 31020, 31353, 31655, 31923, 32156, 32354, 32514,\
+		32636}
+
+	#define test_fm_attack3 {\
+		0, 5, 50, 133, 253, 409, 597, 816, 1062, 1332, 1622, 1929, 2250, 2579, 2913, 3248,\
+		3581, 3908, 4226, 4531, 4820, 5092, 5344, 5573, 5778, 5957, 6109, 6234, 6331, 6400, 6440, 6451,\
+		6436, 6393, 6324, 6230, 6113, 5974, 5815, 5638, 5444, 5236, 5016, 4786, 4549, 4306, 4060, 3814,\
+		3568, 3326, 3088, 2857, 2634, 2421, 2218, 2027, 1849, 1682, 1529, 1389, 1262, 1148, 1047, 958,\
+		881, 816, 761, 717, 683, 658, 644, 638, 643, 657, 682, 718, 766, 827, 903, 994,\
+		1102, 1230, 1379, 1550, 1747, 1970, 2223, 2505, 2819, 3167, 3550, 3968, 4422, 4911, 5437, 5997,\
+		6592, 7218, 7874, 8558, 9266, 9996, 10743, 11505, 12276, 13053, 13832, 14608, 15378, 16137, 16881, 17607,\
+		18312, 18993, 19647, 20271, 20865, 21426, 21953, 22444, 22901, 23322, 23707, 24057, 24371, 24651, 24896, 25107,\
+		25286, 25432, 25546, 25630, 25683, 25707, 25702, 25669, 25608, 25520, 25405, 25265, 25099, 24910, 24696, 24460,\
+		24202, 23924, 23627, 23313, 22982, 22637, 22280, 21912, 21535, 21153, 20767, 20380, 19993, 19611, 19235, 18867,\
+		18511, 18168, 17840, 17531, 17242, 16976, 16733, 16516, 16326, 16166, 16035, 15937, 15870, 15838, 15839, 15877,\
+		15950, 16059, 16205, 16388, 16608, 16865, 17159, 17489, 17854, 18253, 18685, 19149, 19642, 20164, 20710, 21278,\
+		21866, 22470, 23087, 23713, 24343, 24975, 25602, 26223, 26831, 27424, 27997, 28547, 29070, 29563, 30024, 30451,\
+		30841, 31195, 31510, 31787, 32027, 32229, 32396, 32529, 32630, 32701, 32745, 32766, 32764, 32745, 32711, 32664,\
+		32609, 32547, 32483, 32417, 32353, 32291, 32236, 32187, 32146, 32114, 32092, 32079, 32077, 32085, 32102, 32128,\
+		32162, 32203, 32250, 32302, 32357, 32413, 32470, 32525, 32578, 32626, 32669, 32705, 32734, 32755, 32765, 32766,\
+		32758}
+
+	#define test_fm_attack4 {\
+		0, 2, 15, 37, 65, 97, 130, 160, 184, 199, 203, 195, 175, 145, 109, 70,\
+		34, 8, 0, 14, 58, 136, 254, 411, 609, 845, 1114, 1409, 1724, 2047, 2370, 2682,\
+		2974, 3236, 3461, 3642, 3776, 3859, 3891, 3874, 3809, 3702, 3559, 3385, 3190, 2979, 2762, 2544,\
+		2334, 2135, 1954, 1794, 1658, 1547, 1463, 1408, 1381, 1385, 1421, 1490, 1597, 1742, 1930, 2163,\
+		2446, 2779, 3164, 3600, 4085, 4614, 5183, 5783, 6405, 7037, 7667, 8284, 8876, 9431, 9938, 10389,\
+		10776, 11092, 11334, 11500, 11589, 11603, 11544, 11419, 11232, 10991, 10706, 10386, 10041, 9681, 9317, 8959,\
+		8617, 8300, 8016, 7773, 7577, 7432, 7345, 7318, 7356, 7461, 7634, 7878, 8193, 8580, 9037, 9561,\
+		10149, 10795, 11491, 12229, 12998, 13786, 14582, 15371, 16142, 16883, 17581, 18227, 18813, 19331, 19777, 20146,\
+		20437, 20648, 20781, 20835, 20816, 20725, 20569, 20352, 20083, 19768, 19418, 19040, 18647, 18249, 17857, 17481,\
+		17134, 16825, 16563, 16358, 16216, 16144, 16147, 16228, 16389, 16632, 16956, 17357, 17832, 18375, 18979, 19633,\
+		20329, 21053, 21795, 22540, 23277, 23994, 24680, 25325, 25922, 26464, 26949, 27372, 27733, 28033, 28271, 28450,\
+		28572, 28639, 28653, 28617, 28533, 28404, 28234, 28025, 27784, 27515, 27225, 26921, 26612, 26307, 26014, 25743,\
+		25505, 25308, 25158, 25064, 25031, 25064, 25163, 25330, 25563, 25859, 26211, 26614, 27057, 27531, 28025, 28528,\
+		29028, 29515, 29978, 30410, 30803, 31155, 31461, 31723, 31940, 32117, 32257, 32365, 32445, 32503, 32541, 32565,\
+		32574, 32572, 32559, 32534, 32495, 32444, 32377, 32297, 32202, 32094, 31975, 31849, 31720, 31594, 31474, 31369,\
+		31282, 31220, 31187, 31185, 31216, 31281, 31378, 31502, 31650, 31814, 31987, 32161, 32326, 32474, 32598, 32691,\
+		32748}
+
+	#define test_fm_release0 {\
+		0, 13, 65, 157, 288, 457, 664, 909, 1192, 1509, 1861, 2249, 2670, 3122, 3605, 4118,\
+		4660, 5226, 5818, 6435, 7074, 7732, 8407, 9102, 9811, 10532, 11263, 12006, 12757, 13511, 14270, 15032,\
+		15794, 16553, 17308, 18061, 18808, 19543, 20269, 20986, 21690, 22377, 23049, 23707, 24346, 24964, 25562, 26141,\
+		26699, 27230, 27738, 28225, 28687, 29121, 29528, 29914, 30272, 30602, 30904, 31183, 31435, 31658, 31854, 32027,\
+		32174, 32293, 32386, 32458, 32505, 32526, 32523, 32501, 32457, 32388, 32298, 32193, 32068, 31921, 31757, 31580,\
+		31387, 31174, 30947, 30711, 30462, 30197, 29920, 29638, 29347, 29042, 28729, 28414, 28093, 27760, 27423, 27087,\
+		26748, 26399, 26048, 25703, 25356, 25001, 24646, 24300, 23955, 23603, 23253, 22915, 22580, 22238, 21899, 21575,\
+		21256, 20929, 20607, 20304, 20007, 19700, 19398, 19119, 18848, 18564, 18284, 18034, 17795, 17532, 17272, 17058,\
+		16861, 16613, 16348, 16197, 16193, 16197, 16067, 15840, 15643, 15512, 15379, 15214, 15061, 14946, 14835, 14707,\
+		14588, 14498, 14413, 14317, 14230, 14165, 14107, 14043, 13986, 13948, 13916, 13881, 13853, 13842, 13838, 13831,\
+		13831, 13847, 13869, 13890, 13918, 13960, 14009, 14057, 14112, 14180, 14255, 14330, 14411, 14505, 14605, 14706,\
+		14813, 14932, 15058, 15184, 15317, 15460, 15610, 15761, 15918, 16085, 16259, 16433, 16614, 16804, 16999, 17196,\
+		17399, 17611, 17827, 18046, 18269, 18500, 18736, 18973, 19214, 19463, 19716, 19969, 20226, 20490, 20757, 21024,\
+		21294, 21569, 21847, 22125, 22404, 22688, 22973, 23256, 23541, 23829, 24117, 24403, 24688, 24976, 25263, 25546,\
+		25828, 26111, 26392, 26668, 26941, 27214, 27484, 27748, 28008, 28266, 28520, 28766, 29008, 29247, 29479, 29704,\
+		29922, 30137, 30344, 30543, 30734, 30919, 31097, 31265, 31425, 31578, 31723, 31857, 31983, 32101, 32210, 32308,\
+		32396}
+
+	#define test_fm_release1 {\
+		0, 23, 82, 175, 300, 457, 644, 860, 1103, 1373, 1666, 1982, 2319, 2676, 3050, 3440,\
+		3844, 4261, 4689, 5125, 5569, 6019, 6474, 6930, 7389, 7847, 8304, 8758, 9208, 9654, 10094, 10527,\
+		10951, 11367, 11774, 12170, 12556, 12929, 13291, 13640, 13977, 14300, 14610, 14905, 15187, 15454, 15707, 15945,\
+		16168, 16377, 16571, 16750, 16914, 17063, 17198, 17318, 17423, 17514, 17590, 17652, 17699, 17732, 17751, 17756,\
+		17747, 17725, 17689, 17639, 17576, 17500, 17410, 17308, 17192, 17065, 16926, 16774, 16609, 16434, 16247, 16049,\
+		15840, 15620, 15390, 15149, 14900, 14640, 14373, 14096, 13812, 13520, 13221, 12915, 12603, 12285, 11962, 11635,\
+		11304, 10969, 10632, 10292, 9951, 9609, 9266, 8924, 8583, 8243, 7905, 7570, 7238, 6910, 6587, 6268,\
+		5955, 5648, 5348, 5054, 4768, 4490, 4219, 3957, 3703, 3459, 3223, 2997, 2780, 2573, 2376, 2188,\
+		2009, 1840, 1681, 1531, 1390, 1258, 1135, 1021, 915, 818, 728, 645, 570, 501, 439, 383,\
+		333, 288, 248, 214, 183, 156, 132, 112, 95, 81, 68, 58, 49, 43, 37, 33,\
+		30, 28, 26, 25, 26, 27, 29, 32, 36, 41, 48, 57, 67, 80, 95, 114,\
+		136, 162, 192, 228, 269, 317, 372, 434, 505, 584, 673, 774, 885, 1009, 1145, 1296,\
+		1460, 1641, 1837, 2051, 2282, 2532, 2800, 3089, 3398, 3728, 4079, 4452, 4848, 5265, 5704, 6167,\
+		6652, 7159, 7689, 8241, 8813, 9407, 10020, 10653, 11304, 11973, 12657, 13356, 14069, 14793, 15527, 16269,\
+		17018, 17772, 18528, 19286, 20042, 20794, 21540, 22278, 23006, 23721, 24423, 25107, 25773, 26417, 27039, 27636,\
+		28206, 28749, 29261, 29742, 30191, 30606, 30986, 31331, 31639, 31911, 32145, 32342, 32501, 32623, 32707, 32755,\
+		32766}
+
+	#define test_fm_release2 {\
+		0, 2, 14, 36, 66, 105, 153, 209, 271, 341, 416, 496, 581, 669, 759, 852,\
+		945, 1039, 1131, 1222, 1310, 1394, 1474, 1549, 1618, 1681, 1737, 1785, 1824, 1855, 1877, 1890,\
+		1892, 1885, 1868, 1842, 1805, 1759, 1704, 1640, 1568, 1488, 1401, 1308, 1209, 1107, 1001, 893,\
+		785, 677, 571, 469, 373, 284, 203, 134, 76, 34, 8, 0, 11, 45, 102, 185,\
+		294, 431, 598, 797, 1027, 1289, 1585, 1915, 2279, 2678, 3110, 3576, 4075, 4606, 5168, 5759,\
+		6378, 7023, 7693, 8385, 9096, 9824, 10568, 11323, 12089, 12860, 13636, 14413, 15189, 15960, 16726, 17482,\
+		18226, 18958, 19674, 20373, 21053, 21712, 22349, 22964, 23554, 24120, 24661, 25177, 25666, 26130, 26567, 26980,\
+		27367, 27730, 28068, 28383, 28676, 28947, 29196, 29425, 29635, 29826, 30000, 30157, 30298, 30425, 30537, 30636,\
+		30722, 30795, 30857, 30908, 30948, 30978, 30998, 31008, 31009, 31001, 30983, 30955, 30919, 30873, 30817, 30752,\
+		30676, 30591, 30496, 30390, 30273, 30145, 30006, 29856, 29694, 29520, 29335, 29138, 28928, 28708, 28475, 28231,\
+		27975, 27709, 27432, 27145, 26848, 26542, 26227, 25905, 25575, 25240, 24899, 24554, 24205, 23854, 23501, 23148,\
+		22795, 22445, 22097, 21752, 21413, 21080, 20754, 20436, 20126, 19827, 19539, 19262, 18998, 18747, 18511, 18290,\
+		18084, 17894, 17722, 17567, 17430, 17311, 17211, 17131, 17071, 17031, 17011, 17012, 17034, 17077, 17142, 17229,\
+		17337, 17468, 17620, 17794, 17990, 18208, 18448, 18709, 18991, 19294, 19618, 19961, 20324, 20705, 21103, 21518,\
+		21948, 22393, 22850, 23319, 23798, 24285, 24779, 25277, 25778, 26278, 26777, 27271, 27759, 28238, 28705, 29158,\
+		29594, 30011, 30407, 30779, 31125, 31443, 31731, 31986, 32208, 32395, 32545, 32657, 32732, 32767, 32762, 32718,\
+		32636}
+
+	#define test_fm_release3 {\
+		0, 33, 106, 218, 366, 550, 766, 1013, 1287, 1585, 1903, 2238, 2585, 2942, 3302, 3664,\
+		4023, 4376, 4719, 5048, 5362, 5657, 5931, 6181, 6407, 6606, 6778, 6921, 7035, 7119, 7174, 7199,\
+		7194, 7162, 7101, 7015, 6903, 6768, 6610, 6432, 6237, 6025, 5799, 5561, 5314, 5059, 4800, 4538,\
+		4275, 4014, 3757, 3505, 3260, 3024, 2798, 2584, 2381, 2190, 2014, 1850, 1701, 1566, 1444, 1336,\
+		1241, 1159, 1090, 1033, 987, 953, 931, 920, 920, 932, 956, 993, 1043, 1108, 1189, 1286,\
+		1403, 1539, 1698, 1879, 2087, 2321, 2585, 2880, 3206, 3567, 3962, 4392, 4858, 5360, 5897, 6469,\
+		7074, 7712, 8379, 9073, 9791, 10530, 11287, 12057, 12836, 13621, 14408, 15191, 15967, 16732, 17482, 18215,\
+		18925, 19611, 20269, 20898, 21496, 22061, 22592, 23088, 23549, 23973, 24363, 24717, 25036, 25321, 25571, 25789,\
+		25975, 26128, 26251, 26344, 26408, 26443, 26450, 26430, 26383, 26309, 26210, 26086, 25937, 25764, 25568, 25350,\
+		25110, 24849, 24569, 24271, 23956, 23625, 23282, 22926, 22562, 22189, 21812, 21431, 21050, 20672, 20297, 19930,\
+		19571, 19225, 18894, 18579, 18282, 18007, 17754, 17527, 17325, 17152, 17009, 16896, 16816, 16769, 16756, 16778,\
+		16835, 16929, 17059, 17226, 17430, 17670, 17947, 18260, 18608, 18990, 19405, 19851, 20327, 20829, 21357, 21906,\
+		22475, 23060, 23657, 24263, 24873, 25483, 26090, 26689, 27276, 27847, 28398, 28925, 29426, 29897, 30335, 30738,\
+		31105, 31435, 31726, 31979, 32195, 32373, 32515, 32623, 32700, 32747, 32766, 32762, 32737, 32694, 32637, 32568,\
+		32491, 32408, 32323, 32238, 32155, 32077, 32006, 31943, 31889, 31846, 31815, 31795, 31787, 31791, 31807, 31834,\
+		31871, 31916, 31970, 32031, 32097, 32167, 32239, 32311, 32382, 32451, 32516, 32576, 32629, 32675, 32712, 32740,\
+		32758}
+
+	#define test_fm_release4 {\
+		0, 6, 21, 43, 68, 94, 117, 133, 142, 141, 130, 110, 83, 53, 25, 5,\
+		0, 15, 58, 134, 248, 402, 596, 830, 1100, 1399, 1721, 2057, 2396, 2729, 3046, 3336,\
+		3592, 3806, 3972, 4088, 4151, 4162, 4123, 4037, 3911, 3749, 3559, 3349, 3127, 2901, 2677, 2462,\
+		2263, 2082, 1924, 1792, 1687, 1611, 1565, 1551, 1569, 1621, 1711, 1839, 2011, 2227, 2493, 2809,\
+		3177, 3598, 4069, 4588, 5150, 5746, 6370, 7009, 7653, 8289, 8906, 9491, 10033, 10523, 10951, 11312,\
+		11600, 11811, 11945, 12003, 11985, 11897, 11743, 11531, 11269, 10965, 10630, 10273, 9906, 9539, 9183, 8846,\
+		8538, 8266, 8039, 7861, 7738, 7675, 7675, 7742, 7878, 8084, 8363, 8713, 9135, 9627, 10185, 10805,\
+		11479, 12199, 12956, 13739, 14535, 15332, 16116, 16875, 17599, 18275, 18895, 19450, 19936, 20347, 20682, 20937,\
+		21113, 21211, 21234, 21184, 21066, 20885, 20647, 20359, 20030, 19669, 19285, 18890, 18494, 18109, 17745, 17413,\
+		17123, 16884, 16705, 16592, 16551, 16586, 16701, 16898, 17175, 17531, 17963, 18467, 19035, 19658, 20328, 21032,\
+		21760, 22498, 23233, 23954, 24650, 25310, 25925, 26489, 26997, 27446, 27833, 28160, 28426, 28634, 28784, 28879,\
+		28922, 28915, 28860, 28760, 28617, 28435, 28218, 27971, 27699, 27409, 27108, 26806, 26510, 26231, 25978, 25760,\
+		25584, 25460, 25392, 25387, 25446, 25573, 25765, 26020, 26335, 26702, 27114, 27562, 28034, 28521, 29010, 29490,\
+		29952, 30386, 30784, 31143, 31457, 31728, 31954, 32139, 32285, 32399, 32484, 32545, 32587, 32615, 32629, 32633,\
+		32627, 32612, 32585, 32548, 32497, 32434, 32356, 32265, 32162, 32049, 31931, 31811, 31695, 31588, 31495, 31423,\
+		31375, 31356, 31367, 31410, 31484, 31587, 31714, 31859, 32016, 32177, 32332, 32475, 32595, 32688, 32746, 32766,\
+		32748}
+
+	static constexpr uint16_t impshort[9][257] = {
+		impshort0, impshort1, impshort2, impshort3,
+		impshort4, impshort5, impshort6, impshort7,
+		impshort8};
+	WAVETABLE_COMPRESSED_DECL(impshort, 9)
+
+	static constexpr uint16_t skipsaw[5][257] = {
+		skipsaw0, skipsaw1, skipsaw2, skipsaw3,
+		skipsaw4};
+	WAVETABLE_COMPRESSED_DECL(skipsaw, 5)
+
+	static constexpr uint16_t circular_257_slopes[4][257] = {
+		circular_257_slopes0, circular_257_slopes1, circular_257_slopes2, circular_257_slopes3};
+	WAVETABLE_COMPRESSED_DECL(circular_257_slopes, 4)
+
+	static constexpr uint16_t csound_formants_attack[9][257] = {
+		csound_formants_attack0, csound_formants_attack1, csound_formants_attack2, csound_formants_attack3,
+		csound_formants_attack4, csound_formants_attack5, csound_formants_attack6, csound_formants_attack7,
+		csound_formants_attack8};
+	WAVETABLE_COMPRESSED_DECL(csound_formants_attack, 9)
+
+	static constexpr uint16_t csound_formants_release[9][257] = {
+		csound_formants_release0, csound_formants_release1, csound_formants_release2, csound_formants_release3,
+		csound_formants_release4, csound_formants_release5, csound_formants_release6, csound_formants_release7,
+		csound_formants_release8};
+	WAVETABLE_COMPRESSED_DECL(csound_formants_release, 9)
+
+	static constexpr uint16_t new_perlin_slope[9][257] = {
+		new_perlin_slope0, new_perlin_slope1, new_perlin_slope2, new_perlin_slope3,
+		new_perlin_slope4, new_perlin_slope5, new_perlin_slope6, new_perlin_slope7,
+		new_perlin_slope8};
+	WAVETABLE_COMPRESSED_DECL(new_perlin_slope, 9)
+
+	static constexpr uint16_t new_perlin_slope_2[9][257] = {
+		new_perlin_slope_20, new_perlin_slope_21, new_perlin_slope_22, new_perlin_slope_23,
+		new_perlin_slope_24, new_perlin_slope_25, new_perlin_slope_26, new_perlin_slope_27,
+		new_perlin_slope_28};
+	WAVETABLE_COMPRESSED_DECL(new_perlin_slope_2, 9)
+
+	static constexpr uint16_t additive_pairs_slopes[9][257] = {
+		additive_pairs_slopes0, additive_pairs_slopes1, additive_pairs_slopes2, additive_pairs_slopes3,
+		additive_pairs_slopes4, additive_pairs_slopes5, additive_pairs_slopes6, additive_pairs_slopes7,
+		additive_pairs_slopes8};
+	WAVETABLE_COMPRESSED_DECL(additive_pairs_slopes, 9)
+
+	static constexpr uint16_t block_test_attack[9][257] = {
+		block_test_attack0, block_test_attack1, block_test_attack2, block_test_attack3,
+		block_test_attack4, block_test_attack5, block_test_attack6, block_test_attack7,
+		block_test_attack8};
+	WAVETABLE_COMPRESSED_DECL(block_test_attack, 9)
+
+	static constexpr uint16_t block_test_release[9][257] = {
+		block_test_release0, block_test_release1, block_test_release2, block_test_release3,
+		block_test_release4, block_test_release5, block_test_release6, block_test_release7,
+		block_test_release8};
+	WAVETABLE_COMPRESSED_DECL(block_test_release, 9)
+
+	static constexpr uint16_t half_sines_attack[9][257] = {
+		half_sines_attack0, half_sines_attack1, half_sines_attack2, half_sines_attack3,
+		half_sines_attack4, half_sines_attack5, half_sines_attack6, half_sines_attack7,
+		half_sines_attack8};
+	WAVETABLE_COMPRESSED_DECL(half_sines_attack, 9)
+
+	static constexpr uint16_t half_sines_release[9][257] = {
+		half_sines_release0, half_sines_release1, half_sines_release2, half_sines_release3,
+		half_sines_release4, half_sines_release5, half_sines_release6, half_sines_release7,
+		half_sines_release8};
+	WAVETABLE_COMPRESSED_DECL(half_sines_release, 9)
+
+	static constexpr uint16_t mountains_attack[4][257] = {
+		mountains_attack0, mountains_attack1, mountains_attack2, mountains_attack3};
+	WAVETABLE_COMPRESSED_DECL(mountains_attack, 4)
+
+	static constexpr uint16_t mountains_release[4][257] = {
+		mountains_release0, mountains_release1, mountains_release2, mountains_release3};
+	WAVETABLE_COMPRESSED_DECL(mountains_release, 4)
+
+	static constexpr uint16_t rubberband_attacks[9][257] = {
+		rubberband_attacks0, rubberband_attacks1, rubberband_attacks2, rubberband_attacks3,
+		rubberband_attacks4, rubberband_attacks5, rubberband_attacks6, rubberband_attacks7,
+		rubberband_attacks8};
+	WAVETABLE_COMPRESSED_DECL(rubberband_attacks, 9)
+
+	static constexpr uint16_t newest_bounce_attack[5][257] = {
+		newest_bounce_attack0, newest_bounce_attack1, newest_bounce_attack2, newest_bounce_attack3,
+		newest_bounce_attack4};
+	WAVETABLE_COMPRESSED_DECL(newest_bounce_attack, 5)
+
+	static constexpr uint16_t newest_bounce_release[5][257] = {
+		newest_bounce_release0, newest_bounce_release1, newest_bounce_release2, newest_bounce_release3,
+		newest_bounce_release4};
+	WAVETABLE_COMPRESSED_DECL(newest_bounce_release, 5)
+
+	static constexpr uint16_t euc_odd_sharp_attacks[5][257] = {
+		euc_odd_sharp_attacks0, euc_odd_sharp_attacks1, euc_odd_sharp_attacks2, euc_odd_sharp_attacks3,
+		euc_odd_sharp_attacks4};
+	WAVETABLE_COMPRESSED_DECL(euc_odd_sharp_attacks, 5)
+
+	static constexpr uint16_t euc_odd_sharp_releases[5][257] = {
+		euc_odd_sharp_releases0, euc_odd_sharp_releases1, euc_odd_sharp_releases2, euc_odd_sharp_releases3,
+		euc_odd_sharp_releases4};
+	WAVETABLE_COMPRESSED_DECL(euc_odd_sharp_releases, 5)
+
+	static constexpr uint16_t new_waves_attack[5][257] = {
+		new_waves_attack0, new_waves_attack1, new_waves_attack2, new_waves_attack3,
+		new_waves_attack4};
+	WAVETABLE_COMPRESSED_DECL(new_waves_attack, 5)
+
+	static constexpr uint16_t new_waves_release[5][257] = {
+		new_waves_release0, new_waves_release1, new_waves_release2, new_waves_release3,
+		new_waves_release4};
+	WAVETABLE_COMPRESSED_DECL(new_waves_release, 5)
+
+	static constexpr uint16_t test_fm_attack[5][257] = {
+		test_fm_attack0, test_fm_attack1, test_fm_attack2, test_fm_attack3,
+		test_fm_attack4};
+	WAVETABLE_COMPRESSED_DECL(test_fm_attack, 5)
+
+	static constexpr uint16_t test_fm_release[5][257] = {
+		test_fm_release0, test_fm_release1, test_fm_release2, test_fm_release3,
+		test_fm_release4};
+	WAVETABLE_COMPRESSED_DECL(test_fm_release, 5)
+
+};
+
+/// Every slope family the set stores, see WAVETABLE_FAMILY_DEF.
+#define SHARED_WAVETABLE_FAMILIES(X) \
+	X(SharedWavetableSet, impshort, 9) \
+	X(SharedWavetableSet, skipsaw, 5) \
+	X(SharedWavetableSet, circular_257_slopes, 4) \
+	X(SharedWavetableSet, csound_formants_attack, 9) \
+	X(SharedWavetableSet, csound_formants_release, 9) \
+	X(SharedWavetableSet, new_perlin_slope, 9) \
+	X(SharedWavetableSet, new_perlin_slope_2, 9) \
+	X(SharedWavetableSet, additive_pairs_slopes, 9) \
+	X(SharedWavetableSet, block_test_attack, 9) \
+	X(SharedWavetableSet, block_test_release, 9) \
+	X(SharedWavetableSet, half_sines_attack, 9) \
+	X(SharedWavetableSet, half_sines_release, 9) \
+	X(SharedWavetableSet, mountains_attack, 4) \
+	X(SharedWavetableSet, mountains_release, 4) \
+	X(SharedWavetableSet, rubberband_attacks, 9) \
+	X(SharedWavetableSet, newest_bounce_attack, 5) \
+	X(SharedWavetableSet, newest_bounce_release, 5) \
+	X(SharedWavetableSet, euc_odd_sharp_attacks, 5) \
+	X(SharedWavetableSet, euc_odd_sharp_releases, 5) \
+	X(SharedWavetableSet, new_waves_attack, 5) \
+	X(SharedWavetableSet, new_waves_release, 5) \
+	X(SharedWavetableSet, test_fm_attack, 5) \
+	X(SharedWavetableSet, test_fm_release, 5)
+
+#endif
@@ -12,14 +12,31 @@
 #include <via_platform_binding.hpp>
 #include "sync_scale_defs.hpp"
 #include "sync_tables.hpp"
+#include "wavetable_import.hpp"
+#include "scale_import.hpp"
+#include "pll_bench.hpp"
 #include "stdio.h"
 
+/// With SYNC_OVERSAMPLE_VECTOR, the virtual build renders oversampled blocks with an AVX2 kernel when the host CPU has it,
+/// checked once at startup. The kernel matches the scalar loop bit for bit.
+/// Define SYNC_NO_OVERSAMPLE_VECTOR to always take the scalar loop.
+#if defined(BUILD_VIRTUAL) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(SYNC_NO_OVERSAMPLE_VECTOR)
+#define SYNC_OVERSAMPLE_VECTOR
+#endif
+
 
 class SyncWavetable {
 
 	int32_t previousPhase = 0;
 	int32_t previousPhaseMod = 0;
 
+	/// Pulse width phase distortion, the pwm only changes at control rate so its two divides usually drop out.
+	PhaseWarp pwmWarp;
+
+	/// Morph (16 bit, before scaling to the table) at the end of the last block, where the next oversampled block's ramp starts.
+	int32_t lastMorph = 0;
+
+
 public:
 
 	// assigned per mode
@@ -52,14 +69,40 @@ public:
 
 	void parseControls(ViaControls * controls);
 
-	void oversample(uint32_t * wavetable, uint32_t writePosition);
+	void oversample(const uint32_t * wavetable, uint32_t writePosition);
+
+#ifdef SYNC_OVERSAMPLE_VECTOR
+	/// Render length samples (a multiple of 8) of the oversample loop starting a sample after phase.
+	typedef void (*OversampleKernel)(uint32_t phase, int32_t increment, const PhaseWarp & warp, const MorphRamp & ramp,
+			int32_t length, uint32_t * purePhaseOut, uint32_t * phaseOut, uint32_t * signalOut);
+	/// Kernel picked for the host CPU, null to take the scalar loop.
+	static OversampleKernel oversampleKernel;
+#endif
+
+	void spline(const uint32_t * wavetable, uint32_t writePosition);
 
-	void spline(uint32_t * wavetable, uint32_t writePosition);
+#ifdef WAVETABLE_MIPMAP
+	/// Band-limited levels of the active table, set by the module.
+	WavetableMipmap * mipmap = 0;
 
-	void advance(uint32_t * wavetable, uint32_t writePosition) {
+	/// Level for a phase increment of increment (32 bit phase) per output sample, the table itself until the levels are built.
+	/// The pwm warp still compresses part of the cycle, so band-limiting the table takes out most but not all of the aliasing.
+	inline const uint32_t * selectLevel(const uint32_t * wavetable, int32_t increment) {
+		const uint32_t * level = mipmap ? mipmap->select(wavetable, increment >> 7) : 0;
+		return level ? level : wavetable;
+	}
+#endif
+
+	void advance(const uint32_t * wavetable, uint32_t writePosition) {
 		if (increment > (1 << 22)) {
+#ifdef WAVETABLE_MIPMAP
+			wavetable = selectLevel(wavetable, increment);
+#endif
 			oversample(wavetable, writePosition);
 		} else {
+#ifdef WAVETABLE_MIPMAP
+			wavetable = selectLevel(wavetable, increment);
+#endif
 			spline(wavetable, writePosition);
 		}
 	}
@@ -69,23 +112,6 @@ public:
 		return result >> 32;
 	}
 
-	inline uint32_t phaseDist(uint32_t phase, uint32_t bend, uint32_t bendUp, uint32_t bendDown) {
-
-		bend <<= 16;
-
-		if (phase < bend) {
-			uint32_t bendFrac = fix16_mul(phase >> 1, bendUp);
-			return bendFrac;
-
-		} else {
-
-			uint32_t bendFrac = fix16_mul((phase - bend) >> 1, bendDown);
-			return (1 << 31) + bendFrac;
-
-		}
-
-	}
-
 	SyncWavetable() {
 		for (int i = 0; i < 32; i++) {
 			phaseOut[i] = 0;
@@ -259,7 +285,23 @@ public:
 	const Wavetable * wavetableArrayGlobal[4];
 
 	// declare arrays to store the active tables
-	uint32_t wavetableRead[9][517];
+#if defined(WAVETABLE_PREDECODED)
+	// point at the build time images in flash
+	const uint32_t * wavetableRead = SyncWavetableSet::impevens.image;
+#elif defined(WAVETABLE_INCREMENTAL_LOAD)
+	// front and back buffers for the incremental loader, wavetableRead follows its front buffer
+	uint32_t wavetableBuffers[2][9][517];
+	const uint32_t * wavetableRead = wavetableBuffers[0][0];
+	WavetableLoader wavetableLoader;
+#else
+	// decoded in place on each table change
+	uint32_t wavetableBuffer[9][517];
+	const uint32_t * wavetableRead = wavetableBuffer[0];
+#endif
+#ifdef WAVETABLE_MIPMAP
+	/// Band-limited levels of wavetableRead, built a slope per slowConversionCallback.
+	WavetableMipmap wavetableMipmap;
+#endif
 
 	// declare functions to set the currently active tables
 	void switchWavetable(const Wavetable *);
@@ -267,8 +309,33 @@ public:
 
 	void fillWavetableArray(void);
 
+#ifdef BUILD_VIRTUAL
+	/// Tables imported from user files, see importWavetable.
+	WavetableImport userWavetables[WAVETABLE_USER_TABLES];
+	/// Import a wav or raw family file into userWavetables[index] and put it at wavetableArray[bank][slot] and any slot
+	/// holding the table the index imported before, switching to it if one of those is playing. cachePath may be null.
+	/// Returns 0 if the import fails or a table change is still fading or loading.
+	int32_t importWavetable(const char * path, const char * cachePath, int32_t index, int32_t bank, int32_t slot);
+
+	/// Phase error of the last doPLL correction, 2^32 per output cycle.
+	int32_t pllError = 0;
+	/// Drive the main logic input with clock for edges rising edges and measure the PLL,
+	/// in sync mode mode with scaleArray[group][scale] and the ratio knobs at ratioX and ratioY (CVs at rest).
+	PllBenchResult benchPLL(int32_t mode, int32_t group, int32_t scale, int32_t ratioX, int32_t ratioY, SyntheticClock clock, int32_t edges);
+	/// Print benchPLL figures for every scale and sync mode, at the middle of each row and ratios positions across it, each on a fresh module.
+	static void reportPLLBench(FILE * report, const SyntheticClock & clock, int32_t edges, int32_t ratios);
+#endif
+
 
 	const Scale * scaleArray[4][4];
+#ifdef BUILD_VIRTUAL
+	/// Scales compiled from Scala files, see importScale.
+	ScaleImport userScales[SCALE_USER_SCALES];
+	/// Compile a .scl tuning (mapped by a .kbm file if kbmPath isn't null) into userScales[index] and put it at scaleArray[group][slot],
+	/// switching to it if that slot is selected. Any other slot holding the scale userScales[index] had moves to the new one.
+	/// cachePath may be null. Returns 0 if the import fails.
+	int32_t importScale(const char * sclPath, const char * kbmPath, const char * cachePath, int32_t index, int32_t group, int32_t slot);
+#endif
 
 	const Scale * scale;
 
@@ -402,7 +469,14 @@ public:
 	int32_t lastRatioX = 1;
 	int32_t lastRatioY = 1;
 
+	/// Estimated span of the last reading, clockDiv clock periods, in measurement timer counts.
 	uint32_t periodCount = 48000;
+	/// periodCount * 8, for the divide in generateFrequency.
+	InvariantDivisor periodDivisor;
+	/// Smooths periodCount over the last 8 clock or tap intervals and rides out stray edges.
+	PeriodEstimator<8> periodEstimator;
+	/// Scale on pllNudge, 16.16, from half with no confidence in the period to 1.
+	int32_t pllGain = 65536;
 	uint32_t aggregatePeriod = 48000;
 	uint32_t pileUp = 0;
 	uint32_t clockDiv = 0;
@@ -419,7 +493,7 @@ public:
 	int16_t * rootMod;
 	uint32_t phaseOffset = 0;
 	uint32_t syncMode = 0;
-	Scale * selectedScale;
+	const Scale * selectedScale;
 	int32_t cv2Offset;
 	int32_t cv1Offset;
 
@@ -440,8 +514,8 @@ public:
 
 #ifdef BUILD_F373
 
-		// store the length of the last period
-		periodCount = reading;
+		// the reading spans clockDiv periods when edges piled up, the estimator takes one
+		periodCount = periodEstimator.update(reading / clockDiv) * clockDiv;
 		// reset the timer value
 		TIM2->CNT = 0;
 
@@ -449,11 +523,14 @@ public:
 
 #ifdef BUILD_VIRTUAL
 
-		periodCount = reading;
+		periodCount = periodEstimator.update(reading / clockDiv) * clockDiv;
 		resetMeasurementTimer();
 
 #endif
 
+		// the less the edges agree, the less of each one's phase error the PLL corrects
+		pllGain = 32768 + (periodEstimator.confidence() >> 1);
+
 	}
 
 	void doPLL(void);
@@ -468,10 +545,7 @@ public:
 		}
 	}
 
-	// average tap tempo
 	int32_t lastTap = 0;
-	buffer tapStore;
-	int32_t tapSum = 0;
 
 	int32_t simultaneousTrigFlag = 0;
 
@@ -483,9 +557,6 @@ public:
 
 	ViaSync() : syncUI(*this) {
 		init();
-		for (int32_t i = 0; i < 32; i++) {
-			writeBuffer(&tapStore, 0);
-		}
 	}
 
 	void readCalibrationPacket(void) {
@@ -11,6 +11,7 @@
 #include "user_interface.hpp"
 #include <via_platform_binding.hpp>
 #include "dsp.hpp"
+#include "pll_bench.hpp"
 
 /// Macro used to specify the number of samples to per DAC transfer.
 #define VIA_SYNC3_BUFFER_SIZE 24
@@ -279,16 +280,39 @@ public:
 
 	int32_t ratioRoundRobin = 0;
 
+	/// Divisors for the 64 bit divides in updateFrequencies, the reciprocals are only recomputed when the period or a ratio changes.
+	InvariantDivisor periodDivisor;
+	InvariantDivisor denominator1Divisor;
+	InvariantDivisor denominator2Divisor;
+	InvariantDivisor denominator3Divisor;
+
+#ifdef BUILD_VIRTUAL
+	/// Phase error each output last corrected for, 2^32 per output cycle.
+	int32_t pllError[3] = {0, 0, 0};
+	/// Drive the main logic input with clock for edges rising edges and measure the frequency correction,
+	/// with scales[scale], all three ratio knobs at ratio and the output 2 and 3 ratio CVs adding cvRow (0 to 15) to
+	/// their knob index, 8 at rest. Errors are the worst of the three outputs.
+	PllBenchResult benchPLL(int32_t scale, int32_t ratio, int32_t cvRow, SyntheticClock clock, int32_t edges);
+	/// Print benchPLL figures for every scale and CV row, at ratios knob positions across each, each on a fresh module.
+	static void reportPLLBench(FILE * report, const SyntheticClock & clock, int32_t edges, int32_t ratios);
+#endif
+
 	inline void updateFrequencies(void) {
 
+		periodDivisor.set(periodCount);
+
 		if (freqCorrect == 0) {
 			divCount2 += measurementDivider;
 			divCount2 %= denominator1Select;
 			int32_t error = (divCount2 * sync1Div * numerator1Alt) - error1;
 			int64_t phaseSpan = (uint64_t) (measurementDivider) * (uint64_t) numerator1Alt;
 			phaseSpan <<= 32;
-			phaseSpan /= denominator1Select;
-			increment2 = (60 * (phaseSpan + error))/(periodCount);
+			denominator1Divisor.set(denominator1Select);
+			phaseSpan = denominator1Divisor.divide(phaseSpan);
+			increment2 = periodDivisor.divideSigned(60 * (phaseSpan + error));
+#ifdef BUILD_VIRTUAL
+			pllError[0] = error;
+#endif
 			freqCorrect = 1;
 		} else if (freqCorrect == 1) {
 			divCount3 += measurementDivider;
@@ -296,8 +320,12 @@ public:
 			int32_t error = (divCount3 * sync2Div * numerator2Alt) - error2 + (1 << 30) + phaseModTracker;
 			int64_t phaseSpan = (uint64_t) (measurementDivider) * (uint64_t) numerator2Alt;
 			phaseSpan <<= 32;
-			phaseSpan /= denominator2Select;
-			increment3 = (60 * (phaseSpan + (int64_t)error))/(periodCount);
+			denominator2Divisor.set(denominator2Select);
+			phaseSpan = denominator2Divisor.divide(phaseSpan);
+			increment3 = periodDivisor.divideSigned(60 * (phaseSpan + (int64_t)error));
+#ifdef BUILD_VIRTUAL
+			pllError[1] = error;
+#endif
 			freqCorrect = 2;
 		} else if (freqCorrect == 2) {
 			divCount4 += measurementDivider;
@@ -305,8 +333,12 @@ public:
 			int32_t error = (divCount4 * sync3Div * numerator3Alt) - error3 + (1 << 31) + phaseModTracker;
 			int64_t phaseSpan = (uint64_t) (measurementDivider) * (uint64_t) numerator3Alt;
 			phaseSpan <<= 32;
-			phaseSpan /= denominator3Select;
-			increment4 = (60 * (phaseSpan + (int64_t)error))/(periodCount);
+			denominator3Divisor.set(denominator3Select);
+			phaseSpan = denominator3Divisor.divide(phaseSpan);
+			increment4 = periodDivisor.divideSigned(60 * (phaseSpan + (int64_t)error));
+#ifdef BUILD_VIRTUAL
+			pllError[2] = error;
+#endif
 			freqCorrect = 3;
 		}
 
@@ -11,2253 +11,2177 @@
 #include "scales.hpp"
 
 
+/// Every note the scales use, as X(name, integerPart, fractionalPart, fundamentalDivision).
+#define SYNC_SCALE_NOTES(X) \
+	X(ratio144_5, 1887436, 3435973837, 5) \
+	X(ratio13_8, 106496, 0, 8) \
+	X(ratio21_1, 1376256, 0, 1) \
+	X(ratio27_64, 27648, 0, 64) \
+	X(ratio9_28, 21065, 613566756, 28) \
+	X(ratio27_128, 13824, 0, 128) \
+	X(ratio8_3_16, 174762, 2863311530, 16) \
+	X(ratio7_2, 229376, 0, 2) \
+	X(ratio32_9, 233016, 3817748707, 9) \
+	X(ratio20_1, 1310720, 0, 1) \
+	X(ratio4_1_4, 262144, 0, 4) \
+	X(ratio25_243, 6742, 1661427678, 243) \
+	X(ratio7_13, 35288, 2643056797, 13) \
+	X(ratio17_16, 69632, 0, 16) \
+	X(ratio13_9, 94663, 477218588, 9) \
+	X(ratio13_256, 3328, 0, 256) \
+	X(ratio5_64, 5120, 0, 64) \
+	X(ratio9_2, 294912, 0, 2) \
+	X(ratio1_36, 1820, 1908874353, 36) \
+	X(ratio2_1_8, 131072, 0, 8) \
+	X(ratio4_1_16, 262144, 0, 16) \
+	X(ratio19_512, 2432, 0, 512) \
+	X(ratio18_7, 168521, 613566756, 7) \
+	X(ratio1_1_32, 65536, 0, 32) \
+	X(ratio1_2, 32768, 0, 2) \
+	X(ratio5_81, 4045, 1855850066, 81) \
+	X(ratio2_3_8, 43690, 2863311530, 8) \
+	X(ratio1_2_4, 32768, 0, 4) \
+	X(ratio5_7, 46811, 1840700269, 7) \
+	X(ratio1_7_32, 9362, 1227133513, 32) \
+	X(ratio5_63, 5201, 1158959429, 63) \
+	X(ratio75_49, 100310, 876523937, 49) \
+	X(ratio6_5_16, 78643, 858993459, 16) \
+	X(ratio3_4_32, 49152, 0, 32) \
+	X(ratio15_16, 61440, 0, 16) \
+	X(ratio9_1, 589824, 0, 1) \
+	X(ratio5_144, 2275, 2386092942, 144) \
+	X(ratio5_14, 23405, 3067833782, 14) \
+	X(ratio10_9, 72817, 3340530119, 9) \
+	X(ratio1_1_4, 65536, 0, 4) \
+	X(ratio8_5_16, 104857, 2576980377, 16) \
+	X(ratio17_9, 123790, 954437176, 9) \
+	X(ratio11_28, 25746, 1227133513, 28) \
+	X(ratio9_17, 34695, 2273806215, 17) \
+	X(ratio6_7_32, 56173, 3067833782, 32) \
+	X(ratio3_4, 49152, 0, 4) \
+	X(ratio25_21, 78019, 204522252, 21) \
+	X(ratio9_80, 7372, 3435973836, 80) \
+	X(ratio56_5, 734003, 858993459, 5) \
+	X(ratio96_5, 1258291, 858993459, 5) \
+	X(ratio9_224, 2633, 613566756, 224) \
+	X(ratio3_1_4, 196608, 0, 4) \
+	X(ratio13_3, 283989, 1431655765, 3) \
+	X(ratio28_5, 367001, 2576980377, 5) \
+	X(ratio27_5, 353894, 1717986918, 5) \
+	X(ratio7_256, 1792, 0, 256) \
+	X(ratio3_5_16, 39321, 2576980377, 16) \
+	X(ratio9_16, 36864, 0, 16) \
+	X(ratio13_2, 425984, 0, 2) \
+	X(ratio5_189, 1733, 3249631340, 189) \
+	X(ratio25_729, 2247, 1985464991, 729) \
+	X(ratio5_192, 1706, 2863311530, 192) \
+	X(ratio49_75, 42816, 3665038759, 75) \
+	X(ratio88_7, 823881, 613566756, 7) \
+	X(ratio1_8, 8192, 0, 8) \
+	X(ratio1_16, 4096, 0, 16) \
+	X(ratio2_5_16, 26214, 1717986918, 16) \
+	X(ratio4_5, 52428, 3435973836, 5) \
+	X(ratio1_15, 4369, 286331153, 15) \
+	X(ratio5_128, 2560, 0, 128) \
+	X(ratio17_2, 557056, 0, 2) \
+	X(ratio3_2_4, 98304, 0, 4) \
+	X(ratio3_80, 2457, 2576980377, 80) \
+	X(ratio2_1_32, 131072, 0, 32) \
+	X(ratio7_8, 57344, 0, 8) \
+	X(ratio4_7_32, 37449, 613566756, 32) \
+	X(ratio25_1, 1638400, 0, 1) \
+	X(ratio14_1, 917504, 0, 1) \
+	X(ratio135_7, 1263908, 2454267026, 7) \
+	X(ratio75_7, 702171, 1840700269, 7) \
+	X(ratio30_1, 1966080, 0, 1) \
+	X(ratio7_27, 16990, 3499602981, 27) \
+	X(ratio11_16, 45056, 0, 16) \
+	X(ratio27_7, 252781, 3067833782, 7) \
+	X(ratio25_189, 8668, 3363254813, 189) \
+	X(ratio10_7, 93622, 3681400539, 7) \
+	X(ratio13_17, 50115, 3284386755, 17) \
+	X(ratio81_7, 758345, 613566756, 7) \
+	X(ratio7_20, 22937, 2576980377, 20) \
+	X(ratio3_40, 4915, 858993459, 40) \
+	X(ratio8_7_32, 74898, 1227133513, 32) \
+	X(ratio18_1, 1179648, 0, 1) \
+	X(ratio135_4, 2211840, 0, 4) \
+	X(ratio11_17, 42405, 2779096485, 17) \
+	X(ratio3_8, 24576, 0, 8) \
+	X(ratio81_5, 1061683, 858993459, 5) \
+	X(ratio4_3, 87381, 1431655765, 3) \
+	X(ratio4_3_16, 87381, 1431655765, 16) \
+	X(ratio7_9, 50972, 1908874353, 9) \
+	X(ratio3_56, 3510, 3681400539, 56) \
+	X(ratio5_108, 3034, 318145725, 108) \
+	X(ratio1_1, 65536, 0, 1) \
+	X(ratio9_4, 147456, 0, 4) \
+	X(ratio15_4, 245760, 0, 4) \
+	X(ratio27_256, 6912, 0, 256) \
+	X(ratio1_3_8, 21845, 1431655765, 8) \
+	X(ratio7_45, 10194, 2099761789, 45) \
+	X(ratio19_128, 9728, 0, 128) \
+	X(ratio80_3, 1747626, 2863311531, 3) \
+	X(ratio81_25, 212336, 2748779069, 25) \
+	X(ratio19_1, 1245184, 0, 1) \
+	X(ratio11_1, 720896, 0, 1) \
+	X(ratio9_64, 9216, 0, 64) \
+	X(ratio128_5, 1677721, 2576980378, 5) \
+	X(ratio72_25, 188743, 2920577761, 25) \
+	X(ratio7_15, 30583, 2004318071, 15) \
+	X(ratio27_1024, 1728, 0, 1024) \
+	X(ratio25_3, 546133, 1431655765, 3) \
+	X(ratio16_1, 1048576, 0, 1) \
+	X(ratio27_32, 55296, 0, 32) \
+	X(ratio8_1_8, 524288, 0, 8) \
+	X(ratio3_2_8, 98304, 0, 8) \
+	X(ratio16_7_32, 149796, 2454267026, 32) \
+	X(ratio1_24, 2730, 2863311530, 24) \
+	X(ratio6_5, 78643, 858993459, 5) \
+	X(ratio3_64, 3072, 0, 64) \
+	X(ratio27_512, 3456, 0, 512) \
+	X(ratio3_14, 14043, 1840700269, 14) \
+	X(ratio7_10, 45875, 858993459, 10) \
+	X(ratio8_5, 104857, 2576980377, 5) \
+	X(ratio7_75, 6116, 2977843991, 75) \
+	X(ratio63_25, 165150, 3092376453, 25) \
+	X(ratio16_5_16, 209715, 858993459, 16) \
+	X(ratio11_32, 22528, 0, 32) \
+	X(ratio7_1, 458752, 0, 1) \
+	X(ratio45_7, 421302, 3681400539, 7) \
+	X(ratio3_1_32, 196608, 0, 32) \
+	X(ratio1_4_8, 16384, 0, 8) \
+	X(ratio63_5, 825753, 2576980377, 5) \
+	X(ratio5_4, 81920, 0, 4) \
+	X(ratio80_9, 582542, 954437177, 9) \
+	X(ratio22_1, 1441792, 0, 1) \
+	X(ratio11_56, 12873, 613566756, 56) \
+	X(ratio13_1, 851968, 0, 1) \
+	X(ratio1_4, 16384, 0, 4) \
+	X(ratio112_5, 1468006, 1717986918, 5) \
+	X(ratio5_72, 4551, 477218588, 72) \
+	X(ratio5_32, 10240, 0, 32) \
+	X(ratio19_2, 622592, 0, 2) \
+	X(ratio5_12, 27306, 2863311530, 12) \
+	X(ratio9_160, 3686, 1717986918, 160) \
+	X(ratio13_16, 53248, 0, 16) \
+	X(ratio12_7, 112347, 1840700269, 7) \
+	X(ratio11_8, 90112, 0, 8) \
+	X(ratio6_1, 393216, 0, 1) \
+	X(ratio3_4_8, 49152, 0, 8) \
+	X(ratio3_28, 7021, 3067833782, 28) \
+	X(ratio5_36, 9102, 954437176, 36) \
+	X(ratio5_112, 2925, 3067833782, 112) \
+	X(ratio3_16, 12288, 0, 16) \
+	X(ratio7_80, 5734, 1717986918, 80) \
+	X(ratio25_567, 2889, 2552740703, 567) \
+	X(ratio45_1, 2949120, 0, 1) \
+	X(ratio15_512, 1920, 0, 512) \
+	X(ratio20_7, 187245, 3067833782, 7) \
+	X(ratio27_16, 110592, 0, 16) \
+	X(ratio3_7, 28086, 3681400539, 7) \
+	X(ratio3_2, 98304, 0, 2) \
+	X(ratio7_128, 3584, 0, 128) \
+	X(ratio12_5, 157286, 1717986918, 5) \
+	X(ratio3_8_32, 24576, 0, 32) \
+	X(ratio5_96, 3413, 1431655765, 96) \
+	X(ratio49_25, 128450, 2405181685, 25) \
+	X(ratio24_5_16, 314572, 3435973836, 16) \
+	X(ratio25_63, 26006, 1499829849, 63) \
+	X(ratio5_56, 5851, 1840700269, 56) \
+	X(ratio2_3, 43690, 2863311530, 3) \
+	X(ratio5_18, 18204, 1908874353, 18) \
+	X(ratio9_5, 117964, 3435973836, 5) \
+	X(ratio1_1_16, 65536, 0, 16) \
+	X(ratio1_9, 7281, 3340530119, 9) \
+	X(ratio2_5, 26214, 1717986918, 5) \
+	X(ratio2_1, 131072, 0, 1) \
+	X(ratio25_9, 182044, 1908874353, 9) \
+	X(ratio48_5, 629145, 2576980377, 5) \
+	X(ratio1_6, 10922, 2863311530, 6) \
+	X(ratio9_14, 42130, 1227133513, 14) \
+	X(ratio15_128, 7680, 0, 128) \
+	X(ratio9_112, 5266, 1227133513, 112) \
+	X(ratio7_160, 2867, 858993459, 160) \
+	X(ratio5_16, 20480, 0, 16) \
+	X(ratio7_243, 1887, 3729374894, 243) \
+	X(ratio3_11, 17873, 1952257861, 11) \
+	X(ratio5_11, 29789, 390451572, 11) \
+	X(ratio225_49, 300930, 2629571814, 49) \
+	X(ratio4_3_8, 87381, 1431655765, 8) \
+	X(ratio8_7, 74898, 1227133513, 7) \
+	X(ratio1_2_32, 32768, 0, 32) \
+	X(ratio7_25, 18350, 343597383, 25) \
+	X(ratio192_5, 2516582, 1717986918, 5) \
+	X(ratio11_14, 51492, 2454267026, 14) \
+	X(ratio40_7, 374491, 1840700269, 7) \
+	X(ratio25_49, 33436, 3155486176, 49) \
+	X(ratio9_10, 58982, 1717986918, 10) \
+	X(ratio27_25, 70778, 3779571220, 25) \
+	X(ratio320_9, 2330168, 3817748708, 9) \
+	X(ratio25_7, 234057, 613566756, 7) \
+	X(ratio11_112, 6436, 2454267026, 112) \
+	X(ratio8_3, 174762, 2863311530, 3) \
+	X(ratio20_3, 436906, 2863311530, 3) \
+	X(ratio17_7, 159158, 3681400539, 7) \
+	X(ratio15_11, 89367, 1171354717, 11) \
+	X(ratio17_128, 8704, 0, 128) \
+	X(ratio13_15, 56797, 3722304989, 15) \
+	X(ratio160_9, 1165084, 1908874354, 9) \
+	X(ratio24_1_4, 1572864, 0, 4) \
+	X(ratio24_7, 224694, 3681400539, 7) \
+	X(ratio44_7, 411940, 2454267026, 7) \
+	X(ratio25_81, 20227, 689315738, 81) \
+	X(ratio1_5, 13107, 858993459, 5) \
+	X(ratio1_8_32, 8192, 0, 32) \
+	X(ratio18_5, 235929, 2576980377, 5) \
+	X(ratio9_20, 29491, 858993459, 20) \
+	X(ratio22_7, 205970, 1227133513, 7) \
+	X(ratio9_128, 4608, 0, 128) \
+	X(ratio13_7, 121709, 3067833782, 7) \
+	X(ratio15_13, 75618, 1982292598, 13) \
+	X(ratio16_3_8, 349525, 1431655765, 8) \
+	X(ratio32_1, 2097152, 0, 1) \
+	X(ratio9_320, 1843, 858993459, 320) \
+	X(ratio11_224, 3218, 1227133513, 224) \
+	X(ratio3_112, 1755, 1840700269, 112) \
+	X(ratio6_1_4, 393216, 0, 4) \
+	X(ratio5_17, 19275, 1263225675, 17) \
+	X(ratio24_1, 1572864, 0, 1) \
+	X(ratio15_2, 491520, 0, 2) \
+	X(ratio2_9, 14563, 2386092942, 9) \
+	X(ratio11_9, 80099, 2386092942, 9) \
+	X(ratio15_1, 983040, 0, 1) \
+	X(ratio2_7, 18724, 2454267026, 7) \
+	X(ratio5_48, 6826, 2863311530, 48) \
+	X(ratio3_5, 39321, 2576980377, 5) \
+	X(ratio17_8, 139264, 0, 8) \
+	X(ratio2025_49, 2708375, 2191309844, 49) \
+	X(ratio1_12, 5461, 1431655765, 12) \
+	X(ratio5_9, 36408, 3817748707, 9) \
+	X(ratio34_1, 2228224, 0, 1) \
+	X(ratio1_3_16, 21845, 1431655765, 16) \
+	X(ratio21_5, 275251, 858993459, 5) \
+	X(ratio49_675, 4757, 1838882294, 675) \
+	X(ratio25_18, 91022, 954437176, 18) \
+	X(ratio1_5_16, 13107, 858993459, 16) \
+	X(ratio4_7, 37449, 613566756, 7) \
+	X(ratio8_9, 58254, 954437176, 9) \
+	X(ratio11_4, 180224, 0, 4) \
+	X(ratio9_11, 53620, 1561806289, 11) \
+	X(ratio1_48, 1365, 1431655765, 48) \
+	X(ratio1_21, 3120, 3272356035, 21) \
+	X(ratio1_3, 21845, 1431655765, 3) \
+	X(ratio19_64, 19456, 0, 64) \
+	X(ratio5_1, 327680, 0, 1) \
+	X(ratio13_128, 6656, 0, 128) \
+	X(ratio5_13, 25206, 660764199, 13) \
+	X(ratio1_32, 2048, 0, 32) \
+	X(ratio3_128, 1536, 0, 128) \
+	X(ratio25_441, 3715, 827828163, 441) \
+	X(ratio6_1_8, 393216, 0, 8) \
+	X(ratio21_25, 55050, 1030792151, 25) \
+	X(ratio11_13, 55453, 2312674697, 13) \
+	X(ratio11_64, 11264, 0, 64) \
+	X(ratio24_5, 314572, 3435973836, 5) \
+	X(ratio8_3_8, 174762, 2863311530, 8) \
+	X(ratio16_1_4, 1048576, 0, 4) \
+	X(ratio4_9, 29127, 477218588, 9) \
+	X(ratio1_18, 3640, 3817748707, 18) \
+	X(ratio8_1_4, 524288, 0, 4) \
+	X(ratio128_9, 932067, 2386092942, 9) \
+	X(ratio36_1, 2359296, 0, 1) \
+	X(ratio28_1, 1835008, 0, 1) \
+	X(ratio7_135, 3398, 699920596, 135) \
+	X(ratio147_25, 385351, 2920577761, 25) \
+	X(ratio567_25, 1486356, 2061584302, 25) \
+	X(ratio7_11, 41704, 3123612578, 11) \
+	X(ratio72_7, 674084, 2454267026, 7) \
+	X(ratio27_1, 1769472, 0, 1) \
+	X(ratio5_8, 40960, 0, 8) \
+	X(ratio1_20, 3276, 3435973836, 20) \
+	X(ratio225_7, 2106514, 1227133514, 7) \
+	X(ratio441_25, 1156055, 171798692, 25) \
+	X(ratio17_64, 17408, 0, 64) \
+	X(ratio192_7, 1797558, 3681400539, 7) \
+	X(ratio7_16, 28672, 0, 16) \
+	X(ratio189_25, 495452, 687194767, 25) \
+	X(ratio16_3, 349525, 1431655765, 3) \
+	X(ratio36_5, 471859, 858993459, 5) \
+	X(ratio14_5, 183500, 3435973836, 5) \
+	X(ratio3_20, 9830, 1717986918, 20) \
+	X(ratio96_7, 898779, 1840700269, 7) \
+	X(ratio26_1, 1703936, 0, 1) \
+	X(ratio7_5, 91750, 1717986918, 5) \
+	X(ratio15_7, 140434, 1227133513, 7) \
+	X(ratio3_32, 6144, 0, 32) \
+	X(ratio36_7, 337042, 1227133513, 7) \
+	X(ratio5_6, 54613, 1431655765, 6) \
+	X(ratio27_8, 221184, 0, 8) \
+	X(ratio20_9, 145635, 2386092942, 9) \
+	X(ratio15_17, 57825, 3789677025, 17) \
+	X(ratio1_25, 2621, 1889785610, 25) \
+	X(ratio13_32, 26624, 0, 32) \
+	X(ratio9_40, 14745, 2576980377, 40) \
+	X(ratio32_5, 419430, 1717986918, 5) \
+	X(ratio12_1, 786432, 0, 1) \
+	X(ratio13_512, 1664, 0, 512) \
+	X(ratio9_56, 10532, 2454267026, 56) \
+	X(ratio80_7, 748982, 3681400539, 7) \
+	X(ratio15_64, 15360, 0, 64) \
+	X(ratio24_7_32, 224694, 3681400539, 32) \
+	X(ratio17_5, 222822, 1717986918, 5) \
+	X(ratio27_2, 884736, 0, 2) \
+	X(ratio9_8, 73728, 0, 8) \
+	X(ratio1_2_16, 32768, 0, 16) \
+	X(ratio3_7_32, 28086, 3681400539, 32) \
+	X(ratio7_3, 152917, 1431655765, 3) \
+	X(ratio9_25, 23592, 4123168604, 25) \
+	X(ratio40_3, 873813, 1431655765, 3) \
+	X(ratio9_7, 84260, 2454267026, 7) \
+	X(ratio1_6_16, 10922, 2863311530, 16) \
+	X(ratio5_24, 13653, 1431655765, 24) \
+	X(ratio4_1, 262144, 0, 1) \
+	X(ratio17_1, 1114112, 0, 1) \
+	X(ratio38_1, 2490368, 0, 1) \
+	X(ratio1_17, 3855, 252645135, 17) \
+	X(ratio16_9, 116508, 1908874353, 9) \
+	X(ratio19_4, 311296, 0, 4) \
+	X(ratio10_1, 655360, 0, 1) \
+	X(ratio8_1, 524288, 0, 1) \
+	X(ratio7_17, 26985, 1768515945, 17) \
+	X(ratio17_11, 101282, 3904515723, 11) \
+	X(ratio7_4, 114688, 0, 4) \
+	X(ratio25_27, 60681, 2067947216, 27) \
+	X(ratio4_5_16, 52428, 3435973836, 16) \
+	X(ratio17_3, 371370, 2863311530, 3) \
+	X(ratio189_5, 2477260, 3435973836, 5) \
+	X(ratio2_7_32, 18724, 2454267026, 32) \
+	X(ratio15_8, 122880, 0, 8) \
+	X(ratio256_9, 1864135, 477218588, 9) \
+	X(ratio5_3, 109226, 2863311530, 3) \
+	X(ratio7_64, 7168, 0, 64) \
+	X(ratio49_2025, 1585, 3476272295, 2025) \
+	X(ratio11_256, 2816, 0, 256) \
+	X(ratio45_4, 737280, 0, 4) \
+	X(ratio7_81, 5663, 2598190092, 81) \
+	X(ratio36_25, 94371, 3607772528, 25) \
+	X(ratio2_1_4, 131072, 0, 4) \
+	X(ratio7_225, 2038, 3855926194, 225) \
+	X(ratio3_1, 196608, 0, 1) \
+	X(ratio11_5, 144179, 858993459, 5) \
+	X(ratio17_4, 278528, 0, 4) \
+	X(ratio9_256, 2304, 0, 256) \
+	X(ratio17_32, 34816, 0, 32) \
+	X(ratio144_7, 1348169, 613566757, 7) \
+	X(ratio6_7, 56173, 3067833782, 7) \
+	X(ratio19_32, 38912, 0, 32) \
+	X(ratio40_9, 291271, 477218588, 9) \
+	X(ratio49_225, 14272, 1221679586, 225) \
+	X(ratio1_14, 4681, 613566756, 14) \
+	X(ratio27_4, 442368, 0, 4) \
+	X(ratio11_3, 240298, 2863311530, 3) \
+	X(ratio10_3, 218453, 1431655765, 3) \
+	X(ratio7_40, 11468, 3435973836, 40) \
+	X(ratio16_5, 209715, 858993459, 5) \
+	X(ratio7_6, 76458, 2863311530, 6) \
+	X(ratio3_25, 7864, 1374389534, 25) \
+	X(ratio243_25, 637009, 3951369912, 25) \
+	X(ratio25_147, 11145, 2483484490, 147) \
+	X(ratio11_15, 48059, 3149642683, 15) \
+	X(ratio19_8, 155648, 0, 8) \
+	X(ratio72_5, 943718, 1717986918, 5) \
+	X(ratio17_15, 74274, 572662306, 15) \
+	X(ratio176_7, 1647762, 1227133513, 7) \
+	X(ratio64_3, 1398101, 1431655765, 3) \
+	X(ratio40_1, 2621440, 0, 1) \
+	X(ratio5_2, 163840, 0, 2) \
+	X(ratio13_11, 77451, 2733161006, 11) \
+	X(ratio13_5, 170393, 2576980377, 5) \
+	X(ratio1_40, 1638, 1717986918, 40) \
+	X(ratio160_7, 1497965, 3067833783, 7) \
+	X(ratio19_256, 4864, 0, 256) \
+	X(ratio11_7, 102985, 613566756, 7) \
+	X(ratio3_13, 15123, 2973438897, 13) \
+	X(ratio1_4_32, 16384, 0, 32) \
+	X(ratio48_7, 449389, 3067833782, 7) \
+	X(ratio9_13, 45371, 330382099, 13) \
+	X(ratio15_32, 30720, 0, 32) \
+	X(ratio19_16, 77824, 0, 16) \
+	X(ratio5_21, 15603, 3476878287, 21) \
+	X(ratio5_28, 11702, 3681400539, 28) \
+	X(ratio243_7, 2275035, 1840700270, 7) \
+	X(ratio11_128, 5632, 0, 128) \
+	X(ratio12_1_4, 786432, 0, 4) \
+	X(ratio13_64, 13312, 0, 64) \
+	X(ratio1_10, 6553, 2576980377, 10) \
+	X(ratio9_32, 18432, 0, 32) \
+	X(ratio1_13, 5041, 991146299, 13) \
+	X(ratio1_2_8, 32768, 0, 8) \
+	X(ratio675_49, 902791, 3593748145, 49) \
+	X(ratio3_17, 11565, 757935405, 17) \
+	X(ratio64_9, 466033, 3340530119, 9) \
+	X(ratio1_11, 5957, 3514064151, 11) \
+	X(ratio1_7, 9362, 1227133513, 7) \
+	X(ratio7_32, 14336, 0, 32) \
+	X(ratio3_10, 19660, 3435973836, 10) \
+	X(ratio128_3, 2796202, 2863311530, 3) \
+	X(ratio1_1_8, 65536, 0, 8) \
+	X(ratio64_5, 838860, 3435973837, 5) \
+	X(ratio5_27, 12136, 1272582902, 27) \
+	X(ratio11_2, 360448, 0, 2) \
+	X(ratio2_3_16, 43690, 2863311530, 16) \
+	X(ratio15_256, 3840, 0, 256) \
+	X(ratio17_13, 85700, 3964585196, 13) \
+	X(ratio17_256, 4352, 0, 256) \
+	X(ratio13_4, 212992, 0, 4) \
+	X(ratio32_3, 699050, 2863311530, 3) \
+	X(ratio17_512, 2176, 0, 512) \
+	X(ratio1_27, 2427, 1113510039, 27) \
+	X(ratio729_25, 1911029, 3264175145, 25) \
+	X(ratio4_1_8, 262144, 0, 8)
+
+/// Index of each note in scaleNotes.
+enum scaleNoteIndices {
+	SYNC_SCALE_NOTES(SCALE_NOTE_INDEX)
+	numScaleNotes
+};
+
+static constexpr ScaleNote scaleNotes[numScaleNotes] = {
+	SYNC_SCALE_NOTES(SCALE_NOTE_ENTRY)
+};
+
+/// Ratio and gcd of each note, looked up from the flattened scale cells.
+static constexpr LookupTable<uint64_t, numScaleNotes> scaleRatios =
+		generateTable<uint64_t, numScaleNotes, ScaleRatioGenerator<scaleNotes>>();
+static constexpr LookupTable<uint32_t, numScaleNotes> scaleGCDs =
+		generateTable<uint32_t, numScaleNotes, ScaleGCDGenerator<scaleNotes>>();
+
+
+
+static constexpr uint16_t integerRatios1[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, 
+ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio7_1, 
+ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, 
+ratio7_1, ratio7_1, ratio7_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, 
+ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1}; 
+
+static constexpr uint16_t integerRatios2[128] = {ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, 
+ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio7_2, 
+ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, 
+ratio7_2, ratio7_2, ratio7_2, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1}; 
+
+static constexpr uint16_t integerRatios3[128] = {ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio7_3, 
+ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, 
+ratio7_3, ratio7_3, ratio7_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3}; 
+
+static constexpr uint16_t integerRatios4[128] = {ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, 
+ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio7_4, 
+ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, 
+ratio7_4, ratio7_4, ratio7_4, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1}; 
+
+static constexpr uint16_t integerRatios5[128] = {ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, 
+ratio1_5, ratio1_5, ratio1_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, 
+ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, 
+ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio4_5, 
+ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, 
+ratio4_5, ratio4_5, ratio4_5, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, 
+ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio7_5, 
+ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, 
+ratio7_5, ratio7_5, ratio7_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5}; 
+
+static constexpr uint16_t integerRatios6[128] = {ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, 
+ratio1_6, ratio1_6, ratio1_6, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, 
+ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio7_6, 
+ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, 
+ratio7_6, ratio7_6, ratio7_6, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3}; 
+
+static constexpr uint16_t integerRatios7[128] = {ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, 
+ratio1_7, ratio1_7, ratio1_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, 
+ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, 
+ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio4_7, 
+ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, 
+ratio4_7, ratio4_7, ratio4_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, 
+ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, 
+ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, 
+ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7}; 
+
+static constexpr uint16_t integerRatios8[128] = {ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, 
+ratio1_8, ratio1_8, ratio1_8, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, 
+ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio7_8, 
+ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, 
+ratio7_8, ratio7_8, ratio7_8, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t even_integers0[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, 
+ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio10_1, 
+ratio10_1, ratio10_1, ratio10_1, ratio10_1, ratio10_1, ratio10_1, ratio10_1, ratio10_1, ratio10_1, ratio10_1, ratio10_1, ratio10_1, 
+ratio10_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, 
+ratio12_1, ratio12_1, ratio12_1, ratio14_1, ratio14_1, ratio14_1, ratio14_1, ratio14_1, ratio14_1, ratio14_1, ratio14_1, ratio14_1, 
+ratio14_1, ratio14_1, ratio14_1, ratio14_1, ratio14_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, 
+ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1}; 
+
+static constexpr uint16_t even_integers1[128] = {ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio5_1, 
+ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, 
+ratio5_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, 
+ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, 
+ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1}; 
+
+static constexpr uint16_t even_integers2[128] = {ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio5_2, 
+ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, 
+ratio5_2, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, 
+ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1}; 
+
+static constexpr uint16_t even_integers3[128] = {ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, 
+ratio1_6, ratio1_6, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, 
+ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3}; 
+
+static constexpr uint16_t even_integers4[128] = {ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, 
+ratio1_8, ratio1_8, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio5_4, 
+ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, 
+ratio5_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, 
+ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1}; 
+
+static constexpr uint16_t even_integers5[128] = {ratio1_10, ratio1_10, ratio1_10, ratio1_10, ratio1_10, ratio1_10, ratio1_10, ratio1_10, ratio1_10, ratio1_10, ratio1_10, ratio1_10, ratio1_10, 
+ratio1_10, ratio1_10, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, 
+ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, 
+ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, 
+ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, 
+ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, 
+ratio6_5, ratio6_5, ratio6_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, 
+ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5}; 
+
+static constexpr uint16_t even_integers6[128] = {ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, 
+ratio1_12, ratio1_12, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, 
+ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio5_6, 
+ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, 
+ratio5_6, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, 
+ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3}; 
+
+static constexpr uint16_t even_integers7[128] = {ratio1_14, ratio1_14, ratio1_14, ratio1_14, ratio1_14, ratio1_14, ratio1_14, ratio1_14, ratio1_14, ratio1_14, ratio1_14, ratio1_14, ratio1_14, 
+ratio1_14, ratio1_14, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, 
+ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, 
+ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, 
+ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, 
+ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio5_7, 
+ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, 
+ratio5_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, 
+ratio6_7, ratio6_7, ratio6_7, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, 
+ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7}; 
+
+static constexpr uint16_t even_integers8[128] = {ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, 
+ratio1_16, ratio1_16, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, 
+ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio5_8, 
+ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, 
+ratio5_8, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, 
+ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t mult_three_integers0[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, 
+ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio7_1, 
+ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, 
+ratio7_1, ratio7_1, ratio7_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, 
+ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1}; 
+
+static constexpr uint16_t mult_three_integers1[128] = {ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, 
+ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio7_2, 
+ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, ratio7_2, 
+ratio7_2, ratio7_2, ratio7_2, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1}; 
+
+static constexpr uint16_t mult_three_integers2[128] = {ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio7_3, 
+ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, 
+ratio7_3, ratio7_3, ratio7_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3}; 
+
+static constexpr uint16_t mult_three_integers3[128] = {ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, 
+ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio7_4, 
+ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, ratio7_4, 
+ratio7_4, ratio7_4, ratio7_4, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1}; 
+
+static constexpr uint16_t mult_three_integers4[128] = {ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, 
+ratio1_5, ratio1_5, ratio1_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, 
+ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio2_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, 
+ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio4_5, 
+ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, ratio4_5, 
+ratio4_5, ratio4_5, ratio4_5, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, 
+ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio7_5, 
+ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, 
+ratio7_5, ratio7_5, ratio7_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5}; 
+
+static constexpr uint16_t mult_three_integers5[128] = {ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, 
+ratio1_6, ratio1_6, ratio1_6, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, 
+ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio5_6, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio7_6, 
+ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, ratio7_6, 
+ratio7_6, ratio7_6, ratio7_6, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3}; 
+
+static constexpr uint16_t mult_three_integers6[128] = {ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, 
+ratio1_7, ratio1_7, ratio1_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, 
+ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio2_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, 
+ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio4_7, 
+ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, ratio4_7, 
+ratio4_7, ratio4_7, ratio4_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, 
+ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, 
+ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio6_7, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, 
+ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7, ratio8_7}; 
+
+static constexpr uint16_t mult_three_integers7[128] = {ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, 
+ratio1_8, ratio1_8, ratio1_8, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, 
+ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio7_8, 
+ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, ratio7_8, 
+ratio7_8, ratio7_8, ratio7_8, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t odd_integers0[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, 
+ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, 
+ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio7_1, ratio9_1, ratio9_1, ratio9_1, ratio9_1, 
+ratio9_1, ratio9_1, ratio9_1, ratio9_1, ratio9_1, ratio9_1, ratio9_1, ratio9_1, ratio9_1, ratio9_1, ratio9_1, ratio11_1, 
+ratio11_1, ratio11_1, ratio11_1, ratio11_1, ratio11_1, ratio11_1, ratio11_1, ratio11_1, ratio11_1, ratio11_1, ratio11_1, ratio11_1, 
+ratio11_1, ratio13_1, ratio13_1, ratio13_1, ratio13_1, ratio13_1, ratio13_1, ratio13_1, ratio13_1, ratio13_1, ratio13_1, ratio13_1, 
+ratio13_1, ratio13_1, ratio13_1, ratio15_1, ratio15_1, ratio15_1, ratio15_1, ratio15_1, ratio15_1, ratio15_1, ratio15_1, ratio15_1, 
+ratio15_1, ratio15_1, ratio15_1, ratio15_1, ratio15_1, ratio17_1, ratio17_1, ratio17_1, ratio17_1, ratio17_1, ratio17_1, ratio17_1, 
+ratio17_1, ratio17_1, ratio17_1, ratio17_1, ratio17_1, ratio17_1, ratio17_1}; 
+
+static constexpr uint16_t odd_integers1[128] = {ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, 
+ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio11_3, 
+ratio11_3, ratio11_3, ratio11_3, ratio11_3, ratio11_3, ratio11_3, ratio11_3, ratio11_3, ratio11_3, ratio11_3, ratio11_3, ratio11_3, 
+ratio11_3, ratio13_3, ratio13_3, ratio13_3, ratio13_3, ratio13_3, ratio13_3, ratio13_3, ratio13_3, ratio13_3, ratio13_3, ratio13_3, 
+ratio13_3, ratio13_3, ratio13_3, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, 
+ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio17_3, ratio17_3, ratio17_3, ratio17_3, ratio17_3, ratio17_3, ratio17_3, 
+ratio17_3, ratio17_3, ratio17_3, ratio17_3, ratio17_3, ratio17_3, ratio17_3}; 
+
+static constexpr uint16_t odd_integers2[128] = {ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, 
+ratio1_5, ratio1_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, 
+ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, 
+ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio11_5, 
+ratio11_5, ratio11_5, ratio11_5, ratio11_5, ratio11_5, ratio11_5, ratio11_5, ratio11_5, ratio11_5, ratio11_5, ratio11_5, ratio11_5, 
+ratio11_5, ratio13_5, ratio13_5, ratio13_5, ratio13_5, ratio13_5, ratio13_5, ratio13_5, ratio13_5, ratio13_5, ratio13_5, ratio13_5, 
+ratio13_5, ratio13_5, ratio13_5, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio17_5, ratio17_5, ratio17_5, ratio17_5, ratio17_5, ratio17_5, ratio17_5, 
+ratio17_5, ratio17_5, ratio17_5, ratio17_5, ratio17_5, ratio17_5, ratio17_5}; 
+
+static constexpr uint16_t odd_integers3[128] = {ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio1_7, 
+ratio1_7, ratio1_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio3_7, 
+ratio3_7, ratio3_7, ratio3_7, ratio3_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, 
+ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio9_7, ratio9_7, ratio9_7, ratio9_7, 
+ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio11_7, 
+ratio11_7, ratio11_7, ratio11_7, ratio11_7, ratio11_7, ratio11_7, ratio11_7, ratio11_7, ratio11_7, ratio11_7, ratio11_7, ratio11_7, 
+ratio11_7, ratio13_7, ratio13_7, ratio13_7, ratio13_7, ratio13_7, ratio13_7, ratio13_7, ratio13_7, ratio13_7, ratio13_7, ratio13_7, 
+ratio13_7, ratio13_7, ratio13_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, 
+ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio17_7, ratio17_7, ratio17_7, ratio17_7, ratio17_7, ratio17_7, ratio17_7, 
+ratio17_7, ratio17_7, ratio17_7, ratio17_7, ratio17_7, ratio17_7, ratio17_7}; 
+
+static constexpr uint16_t odd_integers4[128] = {ratio1_9, ratio1_9, ratio1_9, ratio1_9, ratio1_9, ratio1_9, ratio1_9, ratio1_9, ratio1_9, ratio1_9, ratio1_9, ratio1_9, ratio1_9, 
+ratio1_9, ratio1_9, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio5_9, ratio5_9, ratio5_9, ratio5_9, ratio5_9, ratio5_9, ratio5_9, ratio5_9, 
+ratio5_9, ratio5_9, ratio5_9, ratio5_9, ratio5_9, ratio5_9, ratio7_9, ratio7_9, ratio7_9, ratio7_9, ratio7_9, ratio7_9, 
+ratio7_9, ratio7_9, ratio7_9, ratio7_9, ratio7_9, ratio7_9, ratio7_9, ratio7_9, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio11_9, 
+ratio11_9, ratio11_9, ratio11_9, ratio11_9, ratio11_9, ratio11_9, ratio11_9, ratio11_9, ratio11_9, ratio11_9, ratio11_9, ratio11_9, 
+ratio11_9, ratio13_9, ratio13_9, ratio13_9, ratio13_9, ratio13_9, ratio13_9, ratio13_9, ratio13_9, ratio13_9, ratio13_9, ratio13_9, 
+ratio13_9, ratio13_9, ratio13_9, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio17_9, ratio17_9, ratio17_9, ratio17_9, ratio17_9, ratio17_9, ratio17_9, 
+ratio17_9, ratio17_9, ratio17_9, ratio17_9, ratio17_9, ratio17_9, ratio17_9}; 
+
+static constexpr uint16_t odd_integers5[128] = {ratio1_11, ratio1_11, ratio1_11, ratio1_11, ratio1_11, ratio1_11, ratio1_11, ratio1_11, ratio1_11, ratio1_11, ratio1_11, ratio1_11, ratio1_11, 
+ratio1_11, ratio1_11, ratio3_11, ratio3_11, ratio3_11, ratio3_11, ratio3_11, ratio3_11, ratio3_11, ratio3_11, ratio3_11, ratio3_11, 
+ratio3_11, ratio3_11, ratio3_11, ratio3_11, ratio5_11, ratio5_11, ratio5_11, ratio5_11, ratio5_11, ratio5_11, ratio5_11, ratio5_11, 
+ratio5_11, ratio5_11, ratio5_11, ratio5_11, ratio5_11, ratio5_11, ratio7_11, ratio7_11, ratio7_11, ratio7_11, ratio7_11, ratio7_11, 
+ratio7_11, ratio7_11, ratio7_11, ratio7_11, ratio7_11, ratio7_11, ratio7_11, ratio7_11, ratio9_11, ratio9_11, ratio9_11, ratio9_11, 
+ratio9_11, ratio9_11, ratio9_11, ratio9_11, ratio9_11, ratio9_11, ratio9_11, ratio9_11, ratio9_11, ratio9_11, ratio9_11, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio13_11, ratio13_11, ratio13_11, ratio13_11, ratio13_11, ratio13_11, ratio13_11, ratio13_11, ratio13_11, ratio13_11, ratio13_11, 
+ratio13_11, ratio13_11, ratio13_11, ratio15_11, ratio15_11, ratio15_11, ratio15_11, ratio15_11, ratio15_11, ratio15_11, ratio15_11, ratio15_11, 
+ratio15_11, ratio15_11, ratio15_11, ratio15_11, ratio15_11, ratio17_11, ratio17_11, ratio17_11, ratio17_11, ratio17_11, ratio17_11, ratio17_11, 
+ratio17_11, ratio17_11, ratio17_11, ratio17_11, ratio17_11, ratio17_11, ratio17_11}; 
+
+static constexpr uint16_t odd_integers6[128] = {ratio1_13, ratio1_13, ratio1_13, ratio1_13, ratio1_13, ratio1_13, ratio1_13, ratio1_13, ratio1_13, ratio1_13, ratio1_13, ratio1_13, ratio1_13, 
+ratio1_13, ratio1_13, ratio3_13, ratio3_13, ratio3_13, ratio3_13, ratio3_13, ratio3_13, ratio3_13, ratio3_13, ratio3_13, ratio3_13, 
+ratio3_13, ratio3_13, ratio3_13, ratio3_13, ratio5_13, ratio5_13, ratio5_13, ratio5_13, ratio5_13, ratio5_13, ratio5_13, ratio5_13, 
+ratio5_13, ratio5_13, ratio5_13, ratio5_13, ratio5_13, ratio5_13, ratio7_13, ratio7_13, ratio7_13, ratio7_13, ratio7_13, ratio7_13, 
+ratio7_13, ratio7_13, ratio7_13, ratio7_13, ratio7_13, ratio7_13, ratio7_13, ratio7_13, ratio9_13, ratio9_13, ratio9_13, ratio9_13, 
+ratio9_13, ratio9_13, ratio9_13, ratio9_13, ratio9_13, ratio9_13, ratio9_13, ratio9_13, ratio9_13, ratio9_13, ratio9_13, ratio11_13, 
+ratio11_13, ratio11_13, ratio11_13, ratio11_13, ratio11_13, ratio11_13, ratio11_13, ratio11_13, ratio11_13, ratio11_13, ratio11_13, ratio11_13, 
+ratio11_13, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio15_13, ratio15_13, ratio15_13, ratio15_13, ratio15_13, ratio15_13, ratio15_13, ratio15_13, ratio15_13, 
+ratio15_13, ratio15_13, ratio15_13, ratio15_13, ratio15_13, ratio17_13, ratio17_13, ratio17_13, ratio17_13, ratio17_13, ratio17_13, ratio17_13, 
+ratio17_13, ratio17_13, ratio17_13, ratio17_13, ratio17_13, ratio17_13, ratio17_13}; 
+
+static constexpr uint16_t odd_integers7[128] = {ratio1_15, ratio1_15, ratio1_15, ratio1_15, ratio1_15, ratio1_15, ratio1_15, ratio1_15, ratio1_15, ratio1_15, ratio1_15, ratio1_15, ratio1_15, 
+ratio1_15, ratio1_15, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_5, 
+ratio1_5, ratio1_5, ratio1_5, ratio1_5, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio7_15, ratio7_15, ratio7_15, ratio7_15, ratio7_15, ratio7_15, 
+ratio7_15, ratio7_15, ratio7_15, ratio7_15, ratio7_15, ratio7_15, ratio7_15, ratio7_15, ratio3_5, ratio3_5, ratio3_5, ratio3_5, 
+ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio11_15, 
+ratio11_15, ratio11_15, ratio11_15, ratio11_15, ratio11_15, ratio11_15, ratio11_15, ratio11_15, ratio11_15, ratio11_15, ratio11_15, ratio11_15, 
+ratio11_15, ratio13_15, ratio13_15, ratio13_15, ratio13_15, ratio13_15, ratio13_15, ratio13_15, ratio13_15, ratio13_15, ratio13_15, ratio13_15, 
+ratio13_15, ratio13_15, ratio13_15, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio17_15, ratio17_15, ratio17_15, ratio17_15, ratio17_15, ratio17_15, ratio17_15, 
+ratio17_15, ratio17_15, ratio17_15, ratio17_15, ratio17_15, ratio17_15, ratio17_15}; 
+
+static constexpr uint16_t odd_integers8[128] = {ratio1_17, ratio1_17, ratio1_17, ratio1_17, ratio1_17, ratio1_17, ratio1_17, ratio1_17, ratio1_17, ratio1_17, ratio1_17, ratio1_17, ratio1_17, 
+ratio1_17, ratio1_17, ratio3_17, ratio3_17, ratio3_17, ratio3_17, ratio3_17, ratio3_17, ratio3_17, ratio3_17, ratio3_17, ratio3_17, 
+ratio3_17, ratio3_17, ratio3_17, ratio3_17, ratio5_17, ratio5_17, ratio5_17, ratio5_17, ratio5_17, ratio5_17, ratio5_17, ratio5_17, 
+ratio5_17, ratio5_17, ratio5_17, ratio5_17, ratio5_17, ratio5_17, ratio7_17, ratio7_17, ratio7_17, ratio7_17, ratio7_17, ratio7_17, 
+ratio7_17, ratio7_17, ratio7_17, ratio7_17, ratio7_17, ratio7_17, ratio7_17, ratio7_17, ratio9_17, ratio9_17, ratio9_17, ratio9_17, 
+ratio9_17, ratio9_17, ratio9_17, ratio9_17, ratio9_17, ratio9_17, ratio9_17, ratio9_17, ratio9_17, ratio9_17, ratio9_17, ratio11_17, 
+ratio11_17, ratio11_17, ratio11_17, ratio11_17, ratio11_17, ratio11_17, ratio11_17, ratio11_17, ratio11_17, ratio11_17, ratio11_17, ratio11_17, 
+ratio11_17, ratio13_17, ratio13_17, ratio13_17, ratio13_17, ratio13_17, ratio13_17, ratio13_17, ratio13_17, ratio13_17, ratio13_17, ratio13_17, 
+ratio13_17, ratio13_17, ratio13_17, ratio15_17, ratio15_17, ratio15_17, ratio15_17, ratio15_17, ratio15_17, ratio15_17, ratio15_17, ratio15_17, 
+ratio15_17, ratio15_17, ratio15_17, ratio15_17, ratio15_17, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t modal_tetradsainversion_walk[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, 
+ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, 
+ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1}; 
+
+static constexpr uint16_t modal_tetradsbinversion_walk[128] = {ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, 
+ratio9_4, ratio9_4, ratio9_4, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, 
+ratio9_4, ratio9_4, ratio9_4, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, 
+ratio9_4, ratio9_4, ratio9_4, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio27_8, 
+ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8}; 
+
+static constexpr uint16_t modal_tetradinversion_walk[128] = {ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio9_4, 
+ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio9_4, 
+ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, 
+ratio5_2, ratio5_2, ratio5_2, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio9_4, 
+ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, 
+ratio5_2, ratio5_2, ratio5_2, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio9_4, 
+ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, 
+ratio5_2, ratio5_2, ratio5_2, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio15_4, 
+ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4}; 
+
+static constexpr uint16_t modal_tetradsdinversion_walk[128] = {ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, 
+ratio27_16, ratio27_16, ratio27_16, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio5_2, 
+ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, 
+ratio27_16, ratio27_16, ratio27_16, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio5_2, 
+ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio5_2, 
+ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio5_2, 
+ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1}; 
+
+static constexpr uint16_t modal_tetradseinversion_walk[128] = {ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio9_2, 
+ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2}; 
+
+static constexpr uint16_t modal_tetradsfinversion_walk[128] = {ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio27_16, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, 
+ratio27_8, ratio27_8, ratio27_8, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, 
+ratio27_8, ratio27_8, ratio27_8, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, 
+ratio27_8, ratio27_8, ratio27_8, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio5_1, 
+ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1}; 
+
+static constexpr uint16_t modal_tetradsginversion_walk[128] = {ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, 
+ratio9_4, ratio9_4, ratio9_4, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio27_8, 
+ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, 
+ratio9_4, ratio9_4, ratio9_4, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio27_8, 
+ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, 
+ratio15_4, ratio15_4, ratio15_4, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio27_8, 
+ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, 
+ratio15_4, ratio15_4, ratio15_4, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio27_8, 
+ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio27_8, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, 
+ratio15_4, ratio15_4, ratio15_4, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio16_3, 
+ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3}; 
+
+static constexpr uint16_t modal_tetradshinversion_walk[128] = {ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, 
+ratio5_2, ratio5_2, ratio5_2, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio18_5, 
+ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, 
+ratio5_2, ratio5_2, ratio5_2, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio18_5, 
+ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio18_5, 
+ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio18_5, 
+ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1}; 
+
+static constexpr uint16_t a_maj7thinversion_walk[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, 
+ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, 
+ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1}; 
+
+static constexpr uint16_t a_maj7th2ndIninversion_walk[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, 
+ratio5_4, ratio5_4, ratio5_4, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, 
+ratio5_4, ratio5_4, ratio5_4, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3}; 
+
+static constexpr uint16_t b_dom7thinversion_walk[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, 
+ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, 
+ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1}; 
+
+static constexpr uint16_t b_dom7thRotateinversion_walk[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, 
+ratio6_5, ratio6_5, ratio6_5, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, 
+ratio6_5, ratio6_5, ratio6_5, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1}; 
+
+static constexpr uint16_t c_subDom7thinversion_walk[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, 
+ratio6_5, ratio6_5, ratio6_5, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, 
+ratio6_5, ratio6_5, ratio6_5, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio36_25, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio72_25, 
+ratio72_25, ratio72_25, ratio72_25, ratio72_25, ratio72_25, ratio72_25, ratio72_25}; 
+
+static constexpr uint16_t c_subDom7thRotateinversion_walk[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, 
+ratio9_8, ratio9_8, ratio9_8, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, 
+ratio9_8, ratio9_8, ratio9_8, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio25_18, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio25_9, 
+ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9}; 
+
+static constexpr uint16_t min7thinversion_walk[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, 
+ratio9_8, ratio9_8, ratio9_8, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, 
+ratio9_8, ratio9_8, ratio9_8, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio12_5, 
+ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5}; 
+
+static constexpr uint16_t min7th2ndIninversion_walk[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, 
+ratio6_5, ratio6_5, ratio6_5, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, 
+ratio6_5, ratio6_5, ratio6_5, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1}; 
+
+static constexpr uint16_t impressionista_vs_impressionistb[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, 
+ratio6_5, ratio6_5, ratio6_5, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, 
+ratio15_4, ratio15_4, ratio15_4, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio18_5, 
+ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, 
+ratio12_5, ratio12_5, ratio12_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t impressionist_vs_impressionistd[128] = {ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio16_5, 
+ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio16_5, 
+ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, 
+ratio9_4, ratio9_4, ratio9_4, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio9_8, 
+ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8}; 
+
+static constexpr uint16_t impressioniste_vs_impressionistf[128] = {ratio17_16, ratio17_16, ratio17_16, ratio17_16, ratio17_16, ratio17_16, ratio17_16, ratio17_16, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, 
+ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio17_8, ratio17_8, ratio17_8, ratio17_8, ratio17_8, 
+ratio17_8, ratio17_8, ratio17_8, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, 
+ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio5_2, 
+ratio5_2, ratio5_2, ratio5_2, ratio17_8, ratio17_8, ratio17_8, ratio17_8, ratio17_8, ratio17_8, ratio17_8, ratio17_8, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio17_16, 
+ratio17_16, ratio17_16, ratio17_16, ratio17_16, ratio17_16, ratio17_16, ratio17_16}; 
+
+static constexpr uint16_t impressionistg_vs_impressionisth[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, 
+ratio9_8, ratio9_8, ratio9_8, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, 
+ratio9_4, ratio9_4, ratio9_4, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio18_5, 
+ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, 
+ratio9_2, ratio9_2, ratio9_2, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio18_5, 
+ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio18_5, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t impressionisti_vs_impressionistj[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio17_16, ratio17_16, ratio17_16, ratio17_16, ratio17_16, 
+ratio17_16, ratio17_16, ratio17_16, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio17_8, ratio17_8, ratio17_8, ratio17_8, ratio17_8, 
+ratio17_8, ratio17_8, ratio17_8, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio16_5, 
+ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio16_5, 
+ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio17_8, ratio17_8, ratio17_8, ratio17_8, ratio17_8, ratio17_8, ratio17_8, ratio17_8, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio17_16, 
+ratio17_16, ratio17_16, ratio17_16, ratio17_16, ratio17_16, ratio17_16, ratio17_16}; 
+
+static constexpr uint16_t impressionistk_vs_impressionistl[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio16_5, 
+ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, 
+ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio9_2, ratio16_5, 
+ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t impressionistm_vs_impressionistn[128] = {ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, 
+ratio9_4, ratio9_4, ratio9_4, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio16_5, 
+ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, 
+ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio16_5, 
+ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio16_5, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio9_4, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio8_5, ratio8_5, ratio8_5, ratio8_5, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio9_8, 
+ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8}; 
+
+static constexpr uint16_t impressionisto_vs_impressionistp[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, 
+ratio6_5, ratio6_5, ratio6_5, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio12_5, 
+ratio12_5, ratio12_5, ratio12_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio15_8, 
+ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio15_8, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t bohlenPeirceAScale_vs_bohlenPeirceBlueLambda[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio25_21, 
+ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio9_7, 
+ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio75_49, ratio75_49, 
+ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio49_25, ratio49_25, 
+ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio7_3, ratio7_3, 
+ratio7_3, ratio7_3, ratio7_3, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio25_9, ratio25_9, ratio25_9, 
+ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio7_3, ratio7_3, ratio7_3, 
+ratio7_3, ratio7_3, ratio7_3, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio9_5, ratio9_5, ratio9_5, 
+ratio9_5, ratio9_5, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio7_5, ratio7_5, ratio7_5, ratio7_5, 
+ratio7_5, ratio7_5, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio25_21, ratio25_21, ratio25_21, ratio25_21, 
+ratio25_21, ratio25_21, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t bohlenPeirceBlueLambda2_vs_bohlenPeirceDurI[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, 
+ratio25_21, ratio25_21, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio7_5, ratio7_5, ratio7_5, 
+ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, 
+ratio49_25, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio25_9, ratio25_9, ratio25_9, ratio25_9, 
+ratio25_9, ratio25_9, ratio25_9, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio7_3, 
+ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, 
+ratio49_25, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio5_3, ratio5_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio9_7, ratio9_7, 
+ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t bohlenPeirceDurII_vs_bohlenPeirceGLambda[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, 
+ratio25_21, ratio25_21, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio7_5, ratio7_5, ratio7_5, 
+ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, 
+ratio15_7, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio63_25, ratio63_25, ratio63_25, ratio63_25, 
+ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio7_3, 
+ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, 
+ratio15_7, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio5_3, ratio5_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio9_7, ratio9_7, 
+ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t bohlenPeirceGamma_vs_bohlenPeirceHPentatoni[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio27_25, ratio27_25, ratio27_25, 
+ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, 
+ratio9_7, ratio9_7, ratio9_7, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio9_5, ratio9_5, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, 
+ratio49_25, ratio49_25, ratio49_25, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, 
+ratio7_3, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, 
+ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, 
+ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t bohlenPeirceHarmoni_vs_bohlenPeirceMollI[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, 
+ratio27_25, ratio27_25, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio7_5, ratio7_5, ratio7_5, 
+ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, 
+ratio15_7, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio63_25, ratio63_25, ratio63_25, ratio63_25, 
+ratio63_25, ratio63_25, ratio63_25, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio7_3, 
+ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, 
+ratio15_7, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio5_3, ratio5_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio9_7, ratio9_7, 
+ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t bohlenPeirceMollII_vs_bohlenPeirceProoijenMaj[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, 
+ratio27_25, ratio27_25, ratio27_25, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio7_5, 
+ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio15_7, 
+ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, 
+ratio7_3, ratio7_3, ratio7_3, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, 
+ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, 
+ratio7_3, ratio7_3, ratio7_3, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, 
+ratio7_5, ratio7_5, ratio7_5, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t bohlenPeirceProoijenMin_vs_bohlenPeirceWalkerA[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, 
+ratio25_21, ratio25_21, ratio25_21, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio5_3, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio25_9, 
+ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, 
+ratio63_25, ratio63_25, ratio63_25, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio49_25, 
+ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio7_5, 
+ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, 
+ratio25_21, ratio25_21, ratio25_21, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t bohlenPeirceWalkerB_vs_bohlenPeirceWalkerI[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio27_25, ratio27_25, ratio27_25, ratio27_25, ratio27_25, 
+ratio27_25, ratio27_25, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio7_5, ratio7_5, ratio7_5, 
+ratio7_5, ratio7_5, ratio7_5, ratio7_5, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio9_5, 
+ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio9_5, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, 
+ratio49_25, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio63_25, ratio63_25, ratio63_25, ratio63_25, 
+ratio63_25, ratio63_25, ratio63_25, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio25_9, ratio63_25, 
+ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, 
+ratio15_7, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio49_25, ratio5_3, ratio5_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio75_49, ratio9_7, ratio9_7, 
+ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, ratio25_21, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t modesofroota[128] = {ratio3_128, ratio27_1024, ratio15_512, ratio15_512, ratio1_32, ratio1_32, ratio9_256, ratio5_128, ratio1_24, ratio1_24, ratio3_64, ratio3_64, ratio3_64, 
+ratio27_512, ratio15_256, ratio15_256, ratio1_16, ratio1_16, ratio9_128, ratio5_64, ratio1_12, ratio1_12, ratio3_32, ratio3_32, ratio3_32, 
+ratio27_256, ratio15_128, ratio15_128, ratio1_8, ratio1_8, ratio9_64, ratio5_32, ratio1_6, ratio1_6, ratio3_16, ratio3_16, ratio3_16, 
+ratio27_128, ratio15_64, ratio15_64, ratio1_4, ratio1_4, ratio9_32, ratio5_16, ratio1_3, ratio1_3, ratio3_8, ratio3_8, ratio3_8, 
+ratio27_64, ratio15_32, ratio15_32, ratio1_2, ratio1_2, ratio9_16, ratio5_8, ratio2_3, ratio2_3, ratio3_4, ratio3_4, ratio3_4, 
+ratio27_32, ratio15_16, ratio15_16, ratio1_1, ratio1_1, ratio9_8, ratio5_4, ratio4_3, ratio4_3, ratio3_2, ratio3_2, ratio3_2, 
+ratio27_16, ratio15_8, ratio15_8, ratio2_1, ratio2_1, ratio9_4, ratio5_2, ratio8_3, ratio8_3, ratio3_1, ratio3_1, ratio3_1, 
+ratio27_8, ratio15_4, ratio15_4, ratio4_1, ratio4_1, ratio9_2, ratio5_1, ratio16_3, ratio16_3, ratio6_1, ratio6_1, ratio6_1, 
+ratio27_4, ratio15_2, ratio15_2, ratio8_1, ratio8_1, ratio9_1, ratio10_1, ratio32_3, ratio32_3, ratio12_1, ratio12_1, ratio12_1, 
+ratio27_2, ratio15_1, ratio15_1, ratio16_1, ratio16_1, ratio18_1, ratio20_1, ratio64_3, ratio64_3, ratio24_1, ratio24_1, ratio24_1, 
+ratio27_1, ratio30_1, ratio30_1, ratio32_1, ratio32_1, ratio36_1, ratio40_1}; 
+
+static constexpr uint16_t modesofrootb[128] = {ratio3_128, ratio27_1024, ratio9_320, ratio9_320, ratio1_32, ratio1_32, ratio9_256, ratio19_512, ratio1_24, ratio1_24, ratio3_64, ratio3_64, ratio3_64, 
+ratio27_512, ratio9_160, ratio9_160, ratio1_16, ratio1_16, ratio9_128, ratio19_256, ratio1_12, ratio1_12, ratio3_32, ratio3_32, ratio3_32, 
+ratio27_256, ratio9_80, ratio9_80, ratio1_8, ratio1_8, ratio9_64, ratio19_128, ratio1_6, ratio1_6, ratio3_16, ratio3_16, ratio3_16, 
+ratio27_128, ratio9_40, ratio9_40, ratio1_4, ratio1_4, ratio9_32, ratio19_64, ratio1_3, ratio1_3, ratio3_8, ratio3_8, ratio3_8, 
+ratio27_64, ratio9_20, ratio9_20, ratio1_2, ratio1_2, ratio9_16, ratio19_32, ratio2_3, ratio2_3, ratio3_4, ratio3_4, ratio3_4, 
+ratio27_32, ratio9_10, ratio9_10, ratio1_1, ratio1_1, ratio9_8, ratio19_16, ratio4_3, ratio4_3, ratio3_2, ratio3_2, ratio3_2, 
+ratio27_16, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio9_4, ratio19_8, ratio8_3, ratio8_3, ratio3_1, ratio3_1, ratio3_1, 
+ratio27_8, ratio18_5, ratio18_5, ratio4_1, ratio4_1, ratio9_2, ratio19_4, ratio16_3, ratio16_3, ratio6_1, ratio6_1, ratio6_1, 
+ratio27_4, ratio36_5, ratio36_5, ratio8_1, ratio8_1, ratio9_1, ratio19_2, ratio32_3, ratio32_3, ratio12_1, ratio12_1, ratio12_1, 
+ratio27_2, ratio72_5, ratio72_5, ratio16_1, ratio16_1, ratio18_1, ratio19_1, ratio64_3, ratio64_3, ratio24_1, ratio24_1, ratio24_1, 
+ratio27_1, ratio144_5, ratio144_5, ratio32_1, ratio32_1, ratio36_1, ratio38_1}; 
+
+static constexpr uint16_t modesofrootc[128] = {ratio1_40, ratio1_40, ratio9_320, ratio9_320, ratio1_32, ratio17_512, ratio19_512, ratio19_512, ratio1_24, ratio1_24, ratio3_64, ratio3_64, ratio1_20, 
+ratio1_20, ratio9_160, ratio9_160, ratio1_16, ratio17_256, ratio19_256, ratio19_256, ratio1_12, ratio1_12, ratio3_32, ratio3_32, ratio1_10, 
+ratio1_10, ratio9_80, ratio9_80, ratio1_8, ratio17_128, ratio19_128, ratio19_128, ratio1_6, ratio1_6, ratio3_16, ratio3_16, ratio1_5, 
+ratio1_5, ratio9_40, ratio9_40, ratio1_4, ratio17_64, ratio19_64, ratio19_64, ratio1_3, ratio1_3, ratio3_8, ratio3_8, ratio2_5, 
+ratio2_5, ratio9_20, ratio9_20, ratio1_2, ratio17_32, ratio19_32, ratio19_32, ratio2_3, ratio2_3, ratio3_4, ratio3_4, ratio4_5, 
+ratio4_5, ratio9_10, ratio9_10, ratio1_1, ratio17_16, ratio19_16, ratio19_16, ratio4_3, ratio4_3, ratio3_2, ratio3_2, ratio8_5, 
+ratio8_5, ratio9_5, ratio9_5, ratio2_1, ratio17_8, ratio19_8, ratio19_8, ratio8_3, ratio8_3, ratio3_1, ratio3_1, ratio16_5, 
+ratio16_5, ratio18_5, ratio18_5, ratio4_1, ratio17_4, ratio19_4, ratio19_4, ratio16_3, ratio16_3, ratio6_1, ratio6_1, ratio32_5, 
+ratio32_5, ratio36_5, ratio36_5, ratio8_1, ratio17_2, ratio19_2, ratio19_2, ratio32_3, ratio32_3, ratio12_1, ratio12_1, ratio64_5, 
+ratio64_5, ratio72_5, ratio72_5, ratio16_1, ratio17_1, ratio19_1, ratio19_1, ratio64_3, ratio64_3, ratio24_1, ratio24_1, ratio128_5, 
+ratio128_5, ratio144_5, ratio144_5, ratio32_1, ratio34_1, ratio38_1, ratio38_1}; 
+
+static constexpr uint16_t modesofrootd[128] = {ratio3_128, ratio27_1024, ratio15_512, ratio15_512, ratio1_32, ratio1_32, ratio9_256, ratio5_128, ratio5_128, ratio7_160, ratio7_160, ratio3_64, ratio3_64, 
+ratio27_512, ratio15_256, ratio15_256, ratio1_16, ratio1_16, ratio9_128, ratio5_64, ratio5_64, ratio7_80, ratio7_80, ratio3_32, ratio3_32, 
+ratio27_256, ratio15_128, ratio15_128, ratio1_8, ratio1_8, ratio9_64, ratio5_32, ratio5_32, ratio7_40, ratio7_40, ratio3_16, ratio3_16, 
+ratio27_128, ratio15_64, ratio15_64, ratio1_4, ratio1_4, ratio9_32, ratio5_16, ratio5_16, ratio7_20, ratio7_20, ratio3_8, ratio3_8, 
+ratio27_64, ratio15_32, ratio15_32, ratio1_2, ratio1_2, ratio9_16, ratio5_8, ratio5_8, ratio7_10, ratio7_10, ratio3_4, ratio3_4, 
+ratio27_32, ratio15_16, ratio15_16, ratio1_1, ratio1_1, ratio9_8, ratio5_4, ratio5_4, ratio7_5, ratio7_5, ratio3_2, ratio3_2, 
+ratio27_16, ratio15_8, ratio15_8, ratio2_1, ratio2_1, ratio9_4, ratio5_2, ratio5_2, ratio14_5, ratio14_5, ratio3_1, ratio3_1, 
+ratio27_8, ratio15_4, ratio15_4, ratio4_1, ratio4_1, ratio9_2, ratio5_1, ratio5_1, ratio28_5, ratio28_5, ratio6_1, ratio6_1, 
+ratio27_4, ratio15_2, ratio15_2, ratio8_1, ratio8_1, ratio9_1, ratio10_1, ratio10_1, ratio56_5, ratio56_5, ratio12_1, ratio12_1, 
+ratio27_2, ratio15_1, ratio15_1, ratio16_1, ratio16_1, ratio18_1, ratio20_1, ratio20_1, ratio112_5, ratio112_5, ratio24_1, ratio24_1, 
+ratio27_1, ratio30_1, ratio30_1, ratio32_1, ratio32_1, ratio36_1, ratio40_1}; 
+
+static constexpr uint16_t modesofroote[128] = {ratio3_128, ratio27_1024, ratio9_320, ratio9_320, ratio1_32, ratio1_32, ratio9_256, ratio5_128, ratio1_24, ratio1_24, ratio3_64, ratio3_64, ratio3_64, 
+ratio27_512, ratio9_160, ratio9_160, ratio1_16, ratio1_16, ratio9_128, ratio5_64, ratio1_12, ratio1_12, ratio3_32, ratio3_32, ratio3_32, 
+ratio27_256, ratio9_80, ratio9_80, ratio1_8, ratio1_8, ratio9_64, ratio5_32, ratio1_6, ratio1_6, ratio3_16, ratio3_16, ratio3_16, 
+ratio27_128, ratio9_40, ratio9_40, ratio1_4, ratio1_4, ratio9_32, ratio5_16, ratio1_3, ratio1_3, ratio3_8, ratio3_8, ratio3_8, 
+ratio27_64, ratio9_20, ratio9_20, ratio1_2, ratio1_2, ratio9_16, ratio5_8, ratio2_3, ratio2_3, ratio3_4, ratio3_4, ratio3_4, 
+ratio27_32, ratio9_10, ratio9_10, ratio1_1, ratio1_1, ratio9_8, ratio5_4, ratio4_3, ratio4_3, ratio3_2, ratio3_2, ratio3_2, 
+ratio27_16, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio9_4, ratio5_2, ratio8_3, ratio8_3, ratio3_1, ratio3_1, ratio3_1, 
+ratio27_8, ratio18_5, ratio18_5, ratio4_1, ratio4_1, ratio9_2, ratio5_1, ratio16_3, ratio16_3, ratio6_1, ratio6_1, ratio6_1, 
+ratio27_4, ratio36_5, ratio36_5, ratio8_1, ratio8_1, ratio9_1, ratio10_1, ratio32_3, ratio32_3, ratio12_1, ratio12_1, ratio12_1, 
+ratio27_2, ratio72_5, ratio72_5, ratio16_1, ratio16_1, ratio18_1, ratio20_1, ratio64_3, ratio64_3, ratio24_1, ratio24_1, ratio24_1, 
+ratio27_1, ratio144_5, ratio144_5, ratio32_1, ratio32_1, ratio36_1, ratio40_1}; 
+
+static constexpr uint16_t modesofrootf[128] = {ratio1_40, ratio1_40, ratio9_320, ratio9_320, ratio1_32, ratio1_32, ratio9_256, ratio19_512, ratio1_24, ratio1_24, ratio3_64, ratio3_64, ratio1_20, 
+ratio1_20, ratio9_160, ratio9_160, ratio1_16, ratio1_16, ratio9_128, ratio19_256, ratio1_12, ratio1_12, ratio3_32, ratio3_32, ratio1_10, 
+ratio1_10, ratio9_80, ratio9_80, ratio1_8, ratio1_8, ratio9_64, ratio19_128, ratio1_6, ratio1_6, ratio3_16, ratio3_16, ratio1_5, 
+ratio1_5, ratio9_40, ratio9_40, ratio1_4, ratio1_4, ratio9_32, ratio19_64, ratio1_3, ratio1_3, ratio3_8, ratio3_8, ratio2_5, 
+ratio2_5, ratio9_20, ratio9_20, ratio1_2, ratio1_2, ratio9_16, ratio19_32, ratio2_3, ratio2_3, ratio3_4, ratio3_4, ratio4_5, 
+ratio4_5, ratio9_10, ratio9_10, ratio1_1, ratio1_1, ratio9_8, ratio19_16, ratio4_3, ratio4_3, ratio3_2, ratio3_2, ratio8_5, 
+ratio8_5, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio9_4, ratio19_8, ratio8_3, ratio8_3, ratio3_1, ratio3_1, ratio16_5, 
+ratio16_5, ratio18_5, ratio18_5, ratio4_1, ratio4_1, ratio9_2, ratio19_4, ratio16_3, ratio16_3, ratio6_1, ratio6_1, ratio32_5, 
+ratio32_5, ratio36_5, ratio36_5, ratio8_1, ratio8_1, ratio9_1, ratio19_2, ratio32_3, ratio32_3, ratio12_1, ratio12_1, ratio64_5, 
+ratio64_5, ratio72_5, ratio72_5, ratio16_1, ratio16_1, ratio18_1, ratio19_1, ratio64_3, ratio64_3, ratio24_1, ratio24_1, ratio128_5, 
+ratio128_5, ratio144_5, ratio144_5, ratio32_1, ratio32_1, ratio36_1, ratio38_1}; 
+
+static constexpr uint16_t modesofrootg[128] = {ratio1_40, ratio1_40, ratio9_320, ratio9_320, ratio1_32, ratio17_512, ratio19_512, ratio19_512, ratio1_24, ratio7_160, ratio7_160, ratio1_20, ratio1_20, 
+ratio1_20, ratio9_160, ratio9_160, ratio1_16, ratio17_256, ratio19_256, ratio19_256, ratio1_12, ratio7_80, ratio7_80, ratio1_10, ratio1_10, 
+ratio1_10, ratio9_80, ratio9_80, ratio1_8, ratio17_128, ratio19_128, ratio19_128, ratio1_6, ratio7_40, ratio7_40, ratio1_5, ratio1_5, 
+ratio1_5, ratio9_40, ratio9_40, ratio1_4, ratio17_64, ratio19_64, ratio19_64, ratio1_3, ratio7_20, ratio7_20, ratio2_5, ratio2_5, 
+ratio2_5, ratio9_20, ratio9_20, ratio1_2, ratio17_32, ratio19_32, ratio19_32, ratio2_3, ratio7_10, ratio7_10, ratio4_5, ratio4_5, 
+ratio4_5, ratio9_10, ratio9_10, ratio1_1, ratio17_16, ratio19_16, ratio19_16, ratio4_3, ratio7_5, ratio7_5, ratio8_5, ratio8_5, 
+ratio8_5, ratio9_5, ratio9_5, ratio2_1, ratio17_8, ratio19_8, ratio19_8, ratio8_3, ratio14_5, ratio14_5, ratio16_5, ratio16_5, 
+ratio16_5, ratio18_5, ratio18_5, ratio4_1, ratio17_4, ratio19_4, ratio19_4, ratio16_3, ratio28_5, ratio28_5, ratio32_5, ratio32_5, 
+ratio32_5, ratio36_5, ratio36_5, ratio8_1, ratio17_2, ratio19_2, ratio19_2, ratio32_3, ratio56_5, ratio56_5, ratio64_5, ratio64_5, 
+ratio64_5, ratio72_5, ratio72_5, ratio16_1, ratio17_1, ratio19_1, ratio19_1, ratio64_3, ratio112_5, ratio112_5, ratio128_5, ratio128_5, 
+ratio128_5, ratio144_5, ratio144_5, ratio32_1, ratio34_1, ratio38_1, ratio38_1}; 
+
+static constexpr uint16_t modesofrooth[128] = {ratio1_40, ratio1_40, ratio9_320, ratio9_320, ratio1_32, ratio1_32, ratio9_256, ratio5_128, ratio5_128, ratio7_160, ratio7_160, ratio1_20, ratio1_20, 
+ratio1_20, ratio9_160, ratio9_160, ratio1_16, ratio1_16, ratio9_128, ratio5_64, ratio5_64, ratio7_80, ratio7_80, ratio1_10, ratio1_10, 
+ratio1_10, ratio9_80, ratio9_80, ratio1_8, ratio1_8, ratio9_64, ratio5_32, ratio5_32, ratio7_40, ratio7_40, ratio1_5, ratio1_5, 
+ratio1_5, ratio9_40, ratio9_40, ratio1_4, ratio1_4, ratio9_32, ratio5_16, ratio5_16, ratio7_20, ratio7_20, ratio2_5, ratio2_5, 
+ratio2_5, ratio9_20, ratio9_20, ratio1_2, ratio1_2, ratio9_16, ratio5_8, ratio5_8, ratio7_10, ratio7_10, ratio4_5, ratio4_5, 
+ratio4_5, ratio9_10, ratio9_10, ratio1_1, ratio1_1, ratio9_8, ratio5_4, ratio5_4, ratio7_5, ratio7_5, ratio8_5, ratio8_5, 
+ratio8_5, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio9_4, ratio5_2, ratio5_2, ratio14_5, ratio14_5, ratio16_5, ratio16_5, 
+ratio16_5, ratio18_5, ratio18_5, ratio4_1, ratio4_1, ratio9_2, ratio5_1, ratio5_1, ratio28_5, ratio28_5, ratio32_5, ratio32_5, 
+ratio32_5, ratio36_5, ratio36_5, ratio8_1, ratio8_1, ratio9_1, ratio10_1, ratio10_1, ratio56_5, ratio56_5, ratio64_5, ratio64_5, 
+ratio64_5, ratio72_5, ratio72_5, ratio16_1, ratio16_1, ratio18_1, ratio20_1, ratio20_1, ratio112_5, ratio112_5, ratio128_5, ratio128_5, 
+ratio128_5, ratio144_5, ratio144_5, ratio32_1, ratio32_1, ratio36_1, ratio40_1}; 
+
+static constexpr uint16_t tetrad_inversionsa[128] = {ratio3_128, ratio15_512, ratio15_512, ratio15_512, ratio1_32, ratio1_32, ratio5_128, ratio5_128, ratio5_128, ratio5_128, ratio3_64, ratio3_64, ratio3_64, 
+ratio15_256, ratio15_256, ratio15_256, ratio1_16, ratio1_16, ratio5_64, ratio5_64, ratio5_64, ratio5_64, ratio3_32, ratio3_32, ratio3_32, 
+ratio15_128, ratio15_128, ratio15_128, ratio1_8, ratio1_8, ratio5_32, ratio5_32, ratio5_32, ratio5_32, ratio3_16, ratio3_16, ratio3_16, 
+ratio15_64, ratio15_64, ratio15_64, ratio1_4, ratio1_4, ratio5_16, ratio5_16, ratio5_16, ratio5_16, ratio3_8, ratio3_8, ratio3_8, 
+ratio15_32, ratio15_32, ratio15_32, ratio1_2, ratio1_2, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio3_4, ratio3_4, ratio3_4, 
+ratio15_16, ratio15_16, ratio15_16, ratio1_1, ratio1_1, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio3_2, 
+ratio15_8, ratio15_8, ratio15_8, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio3_1, ratio3_1, ratio3_1, 
+ratio15_4, ratio15_4, ratio15_4, ratio4_1, ratio4_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio15_2, ratio15_2, ratio15_2, ratio8_1, ratio8_1, ratio10_1, ratio10_1, ratio10_1, ratio10_1, ratio12_1, ratio12_1, ratio12_1, 
+ratio15_1, ratio15_1, ratio15_1, ratio16_1, ratio16_1, ratio20_1, ratio20_1, ratio20_1, ratio20_1, ratio24_1, ratio24_1, ratio24_1, 
+ratio30_1, ratio30_1, ratio30_1, ratio32_1, ratio32_1, ratio40_1, ratio40_1}; 
+
+static constexpr uint16_t tetrad_inversionsb[128] = {ratio5_192, ratio5_192, ratio5_192, ratio5_192, ratio1_32, ratio1_32, ratio5_128, ratio5_128, ratio1_24, ratio1_24, ratio1_24, ratio5_96, ratio5_96, 
+ratio5_96, ratio5_96, ratio5_96, ratio1_16, ratio1_16, ratio5_64, ratio5_64, ratio1_12, ratio1_12, ratio1_12, ratio5_48, ratio5_48, 
+ratio5_48, ratio5_48, ratio5_48, ratio1_8, ratio1_8, ratio5_32, ratio5_32, ratio1_6, ratio1_6, ratio1_6, ratio5_24, ratio5_24, 
+ratio5_24, ratio5_24, ratio5_24, ratio1_4, ratio1_4, ratio5_16, ratio5_16, ratio1_3, ratio1_3, ratio1_3, ratio5_12, ratio5_12, 
+ratio5_12, ratio5_12, ratio5_12, ratio1_2, ratio1_2, ratio5_8, ratio5_8, ratio2_3, ratio2_3, ratio2_3, ratio5_6, ratio5_6, 
+ratio5_6, ratio5_6, ratio5_6, ratio1_1, ratio1_1, ratio5_4, ratio5_4, ratio4_3, ratio4_3, ratio4_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio8_3, ratio8_3, ratio8_3, ratio10_3, ratio10_3, 
+ratio10_3, ratio10_3, ratio10_3, ratio4_1, ratio4_1, ratio5_1, ratio5_1, ratio16_3, ratio16_3, ratio16_3, ratio20_3, ratio20_3, 
+ratio20_3, ratio20_3, ratio20_3, ratio8_1, ratio8_1, ratio10_1, ratio10_1, ratio32_3, ratio32_3, ratio32_3, ratio40_3, ratio40_3, 
+ratio40_3, ratio40_3, ratio40_3, ratio16_1, ratio16_1, ratio20_1, ratio20_1, ratio64_3, ratio64_3, ratio64_3, ratio80_3, ratio80_3, 
+ratio80_3, ratio80_3, ratio80_3, ratio32_1, ratio32_1, ratio40_1, ratio40_1}; 
+
+static constexpr uint16_t tetrad_inversionsc[128] = {ratio1_40, ratio1_40, ratio1_40, ratio1_40, ratio1_32, ratio1_32, ratio3_80, ratio3_80, ratio3_80, ratio3_80, ratio3_64, ratio3_64, ratio1_20, 
+ratio1_20, ratio1_20, ratio1_20, ratio1_16, ratio1_16, ratio3_40, ratio3_40, ratio3_40, ratio3_40, ratio3_32, ratio3_32, ratio1_10, 
+ratio1_10, ratio1_10, ratio1_10, ratio1_8, ratio1_8, ratio3_20, ratio3_20, ratio3_20, ratio3_20, ratio3_16, ratio3_16, ratio1_5, 
+ratio1_5, ratio1_5, ratio1_5, ratio1_4, ratio1_4, ratio3_10, ratio3_10, ratio3_10, ratio3_10, ratio3_8, ratio3_8, ratio2_5, 
+ratio2_5, ratio2_5, ratio2_5, ratio1_2, ratio1_2, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_4, ratio3_4, ratio4_5, 
+ratio4_5, ratio4_5, ratio4_5, ratio1_1, ratio1_1, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio3_2, ratio3_2, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio3_1, ratio3_1, ratio16_5, 
+ratio16_5, ratio16_5, ratio16_5, ratio4_1, ratio4_1, ratio24_5, ratio24_5, ratio24_5, ratio24_5, ratio6_1, ratio6_1, ratio32_5, 
+ratio32_5, ratio32_5, ratio32_5, ratio8_1, ratio8_1, ratio48_5, ratio48_5, ratio48_5, ratio48_5, ratio12_1, ratio12_1, ratio64_5, 
+ratio64_5, ratio64_5, ratio64_5, ratio16_1, ratio16_1, ratio96_5, ratio96_5, ratio96_5, ratio96_5, ratio24_1, ratio24_1, ratio128_5, 
+ratio128_5, ratio128_5, ratio128_5, ratio32_1, ratio32_1, ratio192_5, ratio192_5}; 
+
+static constexpr uint16_t tetrad_inversionsd[128] = {ratio1_40, ratio1_40, ratio1_40, ratio1_32, ratio1_32, ratio1_32, ratio1_32, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio1_20, ratio1_20, 
+ratio1_20, ratio1_20, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_10, ratio1_10, 
+ratio1_10, ratio1_10, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_5, ratio1_5, 
+ratio1_5, ratio1_5, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio2_5, ratio2_5, 
+ratio2_5, ratio2_5, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio4_5, ratio4_5, 
+ratio4_5, ratio4_5, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio8_5, ratio8_5, 
+ratio8_5, ratio8_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio16_5, ratio16_5, 
+ratio16_5, ratio16_5, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio32_5, ratio32_5, 
+ratio32_5, ratio32_5, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio32_3, ratio32_3, ratio32_3, ratio32_3, ratio64_5, ratio64_5, 
+ratio64_5, ratio64_5, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio64_3, ratio64_3, ratio64_3, ratio64_3, ratio128_5, ratio128_5, 
+ratio128_5, ratio128_5, ratio32_1, ratio32_1, ratio32_1, ratio32_1, ratio128_3}; 
+
+static constexpr uint16_t tetrad_inversionse[128] = {ratio3_128, ratio9_320, ratio9_320, ratio9_320, ratio1_32, ratio1_32, ratio3_80, ratio3_80, ratio3_80, ratio3_80, ratio3_64, ratio3_64, ratio3_64, 
+ratio9_160, ratio9_160, ratio9_160, ratio1_16, ratio1_16, ratio3_40, ratio3_40, ratio3_40, ratio3_40, ratio3_32, ratio3_32, ratio3_32, 
+ratio9_80, ratio9_80, ratio9_80, ratio1_8, ratio1_8, ratio3_20, ratio3_20, ratio3_20, ratio3_20, ratio3_16, ratio3_16, ratio3_16, 
+ratio9_40, ratio9_40, ratio9_40, ratio1_4, ratio1_4, ratio3_10, ratio3_10, ratio3_10, ratio3_10, ratio3_8, ratio3_8, ratio3_8, 
+ratio9_20, ratio9_20, ratio9_20, ratio1_2, ratio1_2, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio3_4, ratio3_4, ratio3_4, 
+ratio9_10, ratio9_10, ratio9_10, ratio1_1, ratio1_1, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio3_2, ratio3_2, ratio3_2, 
+ratio9_5, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio3_1, ratio3_1, ratio3_1, 
+ratio18_5, ratio18_5, ratio18_5, ratio4_1, ratio4_1, ratio24_5, ratio24_5, ratio24_5, ratio24_5, ratio6_1, ratio6_1, ratio6_1, 
+ratio36_5, ratio36_5, ratio36_5, ratio8_1, ratio8_1, ratio48_5, ratio48_5, ratio48_5, ratio48_5, ratio12_1, ratio12_1, ratio12_1, 
+ratio72_5, ratio72_5, ratio72_5, ratio16_1, ratio16_1, ratio96_5, ratio96_5, ratio96_5, ratio96_5, ratio24_1, ratio24_1, ratio24_1, 
+ratio144_5, ratio144_5, ratio144_5, ratio32_1, ratio32_1, ratio192_5, ratio192_5}; 
+
+static constexpr uint16_t tetrad_inversionsf[128] = {ratio1_40, ratio1_40, ratio1_40, ratio1_40, ratio1_32, ratio1_32, ratio3_80, ratio3_80, ratio1_24, ratio1_24, ratio1_24, ratio1_20, ratio1_20, 
+ratio1_20, ratio1_20, ratio1_20, ratio1_16, ratio1_16, ratio3_40, ratio3_40, ratio1_12, ratio1_12, ratio1_12, ratio1_10, ratio1_10, 
+ratio1_10, ratio1_10, ratio1_10, ratio1_8, ratio1_8, ratio3_20, ratio3_20, ratio1_6, ratio1_6, ratio1_6, ratio1_5, ratio1_5, 
+ratio1_5, ratio1_5, ratio1_5, ratio1_4, ratio1_4, ratio3_10, ratio3_10, ratio1_3, ratio1_3, ratio1_3, ratio2_5, ratio2_5, 
+ratio2_5, ratio2_5, ratio2_5, ratio1_2, ratio1_2, ratio3_5, ratio3_5, ratio2_3, ratio2_3, ratio2_3, ratio4_5, ratio4_5, 
+ratio4_5, ratio4_5, ratio4_5, ratio1_1, ratio1_1, ratio6_5, ratio6_5, ratio4_3, ratio4_3, ratio4_3, ratio8_5, ratio8_5, 
+ratio8_5, ratio8_5, ratio8_5, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio8_3, ratio8_3, ratio8_3, ratio16_5, ratio16_5, 
+ratio16_5, ratio16_5, ratio16_5, ratio4_1, ratio4_1, ratio24_5, ratio24_5, ratio16_3, ratio16_3, ratio16_3, ratio32_5, ratio32_5, 
+ratio32_5, ratio32_5, ratio32_5, ratio8_1, ratio8_1, ratio48_5, ratio48_5, ratio32_3, ratio32_3, ratio32_3, ratio64_5, ratio64_5, 
+ratio64_5, ratio64_5, ratio64_5, ratio16_1, ratio16_1, ratio96_5, ratio96_5, ratio64_3, ratio64_3, ratio64_3, ratio128_5, ratio128_5, 
+ratio128_5, ratio128_5, ratio128_5, ratio32_1, ratio32_1, ratio192_5, ratio192_5}; 
+
+static constexpr uint16_t tetrad_inversionsg[128] = {ratio5_192, ratio5_192, ratio5_192, ratio5_192, ratio1_32, ratio1_32, ratio5_128, ratio5_128, ratio5_128, ratio5_128, ratio3_64, ratio3_64, ratio5_96, 
+ratio5_96, ratio5_96, ratio5_96, ratio1_16, ratio1_16, ratio5_64, ratio5_64, ratio5_64, ratio5_64, ratio3_32, ratio3_32, ratio5_48, 
+ratio5_48, ratio5_48, ratio5_48, ratio1_8, ratio1_8, ratio5_32, ratio5_32, ratio5_32, ratio5_32, ratio3_16, ratio3_16, ratio5_24, 
+ratio5_24, ratio5_24, ratio5_24, ratio1_4, ratio1_4, ratio5_16, ratio5_16, ratio5_16, ratio5_16, ratio3_8, ratio3_8, ratio5_12, 
+ratio5_12, ratio5_12, ratio5_12, ratio1_2, ratio1_2, ratio5_8, ratio5_8, ratio5_8, ratio5_8, ratio3_4, ratio3_4, ratio5_6, 
+ratio5_6, ratio5_6, ratio5_6, ratio1_1, ratio1_1, ratio5_4, ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio5_2, ratio3_1, ratio3_1, ratio10_3, 
+ratio10_3, ratio10_3, ratio10_3, ratio4_1, ratio4_1, ratio5_1, ratio5_1, ratio5_1, ratio5_1, ratio6_1, ratio6_1, ratio20_3, 
+ratio20_3, ratio20_3, ratio20_3, ratio8_1, ratio8_1, ratio10_1, ratio10_1, ratio10_1, ratio10_1, ratio12_1, ratio12_1, ratio40_3, 
+ratio40_3, ratio40_3, ratio40_3, ratio16_1, ratio16_1, ratio20_1, ratio20_1, ratio20_1, ratio20_1, ratio24_1, ratio24_1, ratio80_3, 
+ratio80_3, ratio80_3, ratio80_3, ratio32_1, ratio32_1, ratio40_1, ratio40_1}; 
+
+static constexpr uint16_t tetrad_inversionsh[128] = {ratio5_192, ratio5_192, ratio5_192, ratio1_32, ratio1_32, ratio1_32, ratio1_32, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio5_96, ratio5_96, 
+ratio5_96, ratio5_96, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio5_48, ratio5_48, 
+ratio5_48, ratio5_48, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio5_24, ratio5_24, 
+ratio5_24, ratio5_24, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio5_12, ratio5_12, 
+ratio5_12, ratio5_12, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio5_6, ratio5_6, 
+ratio5_6, ratio5_6, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio10_3, ratio10_3, 
+ratio10_3, ratio10_3, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio20_3, ratio20_3, 
+ratio20_3, ratio20_3, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio32_3, ratio32_3, ratio32_3, ratio32_3, ratio40_3, ratio40_3, 
+ratio40_3, ratio40_3, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio64_3, ratio64_3, ratio64_3, ratio64_3, ratio80_3, ratio80_3, 
+ratio80_3, ratio80_3, ratio32_1, ratio32_1, ratio32_1, ratio32_1, ratio128_3}; 
+
+static constexpr uint16_t tetrad_inversionsi[128] = {ratio5_192, ratio5_192, ratio5_192, ratio5_192, ratio1_32, ratio1_32, ratio1_32, ratio1_24, ratio1_24, ratio1_24, ratio3_64, ratio3_64, ratio5_96, 
+ratio5_96, ratio5_96, ratio5_96, ratio1_16, ratio1_16, ratio1_16, ratio1_12, ratio1_12, ratio1_12, ratio3_32, ratio3_32, ratio5_48, 
+ratio5_48, ratio5_48, ratio5_48, ratio1_8, ratio1_8, ratio1_8, ratio1_6, ratio1_6, ratio1_6, ratio3_16, ratio3_16, ratio5_24, 
+ratio5_24, ratio5_24, ratio5_24, ratio1_4, ratio1_4, ratio1_4, ratio1_3, ratio1_3, ratio1_3, ratio3_8, ratio3_8, ratio5_12, 
+ratio5_12, ratio5_12, ratio5_12, ratio1_2, ratio1_2, ratio1_2, ratio2_3, ratio2_3, ratio2_3, ratio3_4, ratio3_4, ratio5_6, 
+ratio5_6, ratio5_6, ratio5_6, ratio1_1, ratio1_1, ratio1_1, ratio4_3, ratio4_3, ratio4_3, ratio3_2, ratio3_2, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio8_3, ratio8_3, ratio8_3, ratio3_1, ratio3_1, ratio10_3, 
+ratio10_3, ratio10_3, ratio10_3, ratio4_1, ratio4_1, ratio4_1, ratio16_3, ratio16_3, ratio16_3, ratio6_1, ratio6_1, ratio20_3, 
+ratio20_3, ratio20_3, ratio20_3, ratio8_1, ratio8_1, ratio8_1, ratio32_3, ratio32_3, ratio32_3, ratio12_1, ratio12_1, ratio40_3, 
+ratio40_3, ratio40_3, ratio40_3, ratio16_1, ratio16_1, ratio16_1, ratio64_3, ratio64_3, ratio64_3, ratio24_1, ratio24_1, ratio80_3, 
+ratio80_3, ratio80_3, ratio80_3, ratio32_1, ratio32_1, ratio32_1, ratio128_3}; 
+
+static constexpr uint16_t tetrad_inversionsj[128] = {ratio1_36, ratio1_36, ratio1_36, ratio1_36, ratio1_32, ratio5_144, ratio5_144, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio1_18, ratio1_18, 
+ratio1_18, ratio1_18, ratio1_18, ratio1_16, ratio5_72, ratio5_72, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_9, ratio1_9, 
+ratio1_9, ratio1_9, ratio1_9, ratio1_8, ratio5_36, ratio5_36, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio2_9, ratio2_9, 
+ratio2_9, ratio2_9, ratio2_9, ratio1_4, ratio5_18, ratio5_18, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio4_9, ratio4_9, 
+ratio4_9, ratio4_9, ratio4_9, ratio1_2, ratio5_9, ratio5_9, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio8_9, ratio8_9, 
+ratio8_9, ratio8_9, ratio8_9, ratio1_1, ratio10_9, ratio10_9, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio16_9, ratio16_9, 
+ratio16_9, ratio16_9, ratio16_9, ratio2_1, ratio20_9, ratio20_9, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio32_9, ratio32_9, 
+ratio32_9, ratio32_9, ratio32_9, ratio4_1, ratio40_9, ratio40_9, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio64_9, ratio64_9, 
+ratio64_9, ratio64_9, ratio64_9, ratio8_1, ratio80_9, ratio80_9, ratio32_3, ratio32_3, ratio32_3, ratio32_3, ratio128_9, ratio128_9, 
+ratio128_9, ratio128_9, ratio128_9, ratio16_1, ratio160_9, ratio160_9, ratio64_3, ratio64_3, ratio64_3, ratio64_3, ratio256_9, ratio256_9, 
+ratio256_9, ratio256_9, ratio256_9, ratio32_1, ratio320_9, ratio320_9, ratio128_3}; 
+
+static constexpr uint16_t tetrad_inversionsk[128] = {ratio3_128, ratio3_128, ratio3_128, ratio3_128, ratio1_32, ratio1_32, ratio9_256, ratio5_128, ratio5_128, ratio5_128, ratio3_64, ratio3_64, ratio3_64, 
+ratio3_64, ratio3_64, ratio3_64, ratio1_16, ratio1_16, ratio9_128, ratio5_64, ratio5_64, ratio5_64, ratio3_32, ratio3_32, ratio3_32, 
+ratio3_32, ratio3_32, ratio3_32, ratio1_8, ratio1_8, ratio9_64, ratio5_32, ratio5_32, ratio5_32, ratio3_16, ratio3_16, ratio3_16, 
+ratio3_16, ratio3_16, ratio3_16, ratio1_4, ratio1_4, ratio9_32, ratio5_16, ratio5_16, ratio5_16, ratio3_8, ratio3_8, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio1_2, ratio1_2, ratio9_16, ratio5_8, ratio5_8, ratio5_8, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio1_1, ratio1_1, ratio9_8, ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio2_1, ratio2_1, ratio9_4, ratio5_2, ratio5_2, ratio5_2, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio4_1, ratio4_1, ratio9_2, ratio5_1, ratio5_1, ratio5_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio8_1, ratio8_1, ratio9_1, ratio10_1, ratio10_1, ratio10_1, ratio12_1, ratio12_1, ratio12_1, 
+ratio12_1, ratio12_1, ratio12_1, ratio16_1, ratio16_1, ratio18_1, ratio20_1, ratio20_1, ratio20_1, ratio24_1, ratio24_1, ratio24_1, 
+ratio24_1, ratio24_1, ratio24_1, ratio32_1, ratio32_1, ratio36_1, ratio40_1}; 
+
+static constexpr uint16_t tetrad_inversionsl[128] = {ratio1_40, ratio1_40, ratio9_320, ratio9_320, ratio1_32, ratio1_32, ratio1_32, ratio1_32, ratio1_32, ratio1_20, ratio1_20, ratio1_20, ratio1_20, 
+ratio1_20, ratio9_160, ratio9_160, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_10, ratio1_10, ratio1_10, ratio1_10, 
+ratio1_10, ratio9_80, ratio9_80, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_5, ratio1_5, ratio1_5, ratio1_5, 
+ratio1_5, ratio9_40, ratio9_40, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio2_5, ratio2_5, ratio2_5, ratio2_5, 
+ratio2_5, ratio9_20, ratio9_20, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio4_5, ratio4_5, ratio4_5, ratio4_5, 
+ratio4_5, ratio9_10, ratio9_10, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio8_5, ratio8_5, ratio8_5, ratio8_5, 
+ratio8_5, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio16_5, ratio16_5, ratio16_5, ratio16_5, 
+ratio16_5, ratio18_5, ratio18_5, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio32_5, ratio32_5, ratio32_5, ratio32_5, 
+ratio32_5, ratio36_5, ratio36_5, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio64_5, ratio64_5, ratio64_5, ratio64_5, 
+ratio64_5, ratio72_5, ratio72_5, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio128_5, ratio128_5, ratio128_5, ratio128_5, 
+ratio128_5, ratio144_5, ratio144_5, ratio32_1, ratio32_1, ratio32_1, ratio32_1}; 
+
+static constexpr uint16_t tetrad_inversionsm[128] = {ratio3_128, ratio3_128, ratio3_128, ratio3_128, ratio1_32, ratio1_32, ratio9_256, ratio5_128, ratio5_128, ratio5_128, ratio3_64, ratio3_64, ratio3_64, 
+ratio3_64, ratio3_64, ratio3_64, ratio1_16, ratio1_16, ratio9_128, ratio5_64, ratio5_64, ratio5_64, ratio3_32, ratio3_32, ratio3_32, 
+ratio3_32, ratio3_32, ratio3_32, ratio1_8, ratio1_8, ratio9_64, ratio5_32, ratio5_32, ratio5_32, ratio3_16, ratio3_16, ratio3_16, 
+ratio3_16, ratio3_16, ratio3_16, ratio1_4, ratio1_4, ratio9_32, ratio5_16, ratio5_16, ratio5_16, ratio3_8, ratio3_8, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio1_2, ratio1_2, ratio9_16, ratio5_8, ratio5_8, ratio5_8, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio1_1, ratio1_1, ratio9_8, ratio5_4, ratio5_4, ratio5_4, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio2_1, ratio2_1, ratio9_4, ratio5_2, ratio5_2, ratio5_2, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio4_1, ratio4_1, ratio9_2, ratio5_1, ratio5_1, ratio5_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio8_1, ratio8_1, ratio9_1, ratio10_1, ratio10_1, ratio10_1, ratio12_1, ratio12_1, ratio12_1, 
+ratio12_1, ratio12_1, ratio12_1, ratio16_1, ratio16_1, ratio18_1, ratio20_1, ratio20_1, ratio20_1, ratio24_1, ratio24_1, ratio24_1, 
+ratio24_1, ratio24_1, ratio24_1, ratio32_1, ratio32_1, ratio36_1, ratio40_1}; 
+
+static constexpr uint16_t tetrad_inversionsn[128] = {ratio5_192, ratio5_192, ratio5_192, ratio5_192, ratio1_32, ratio1_32, ratio1_32, ratio1_24, ratio1_24, ratio1_24, ratio3_64, ratio3_64, ratio5_96, 
+ratio5_96, ratio5_96, ratio5_96, ratio1_16, ratio1_16, ratio1_16, ratio1_12, ratio1_12, ratio1_12, ratio3_32, ratio3_32, ratio5_48, 
+ratio5_48, ratio5_48, ratio5_48, ratio1_8, ratio1_8, ratio1_8, ratio1_6, ratio1_6, ratio1_6, ratio3_16, ratio3_16, ratio5_24, 
+ratio5_24, ratio5_24, ratio5_24, ratio1_4, ratio1_4, ratio1_4, ratio1_3, ratio1_3, ratio1_3, ratio3_8, ratio3_8, ratio5_12, 
+ratio5_12, ratio5_12, ratio5_12, ratio1_2, ratio1_2, ratio1_2, ratio2_3, ratio2_3, ratio2_3, ratio3_4, ratio3_4, ratio5_6, 
+ratio5_6, ratio5_6, ratio5_6, ratio1_1, ratio1_1, ratio1_1, ratio4_3, ratio4_3, ratio4_3, ratio3_2, ratio3_2, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio8_3, ratio8_3, ratio8_3, ratio3_1, ratio3_1, ratio10_3, 
+ratio10_3, ratio10_3, ratio10_3, ratio4_1, ratio4_1, ratio4_1, ratio16_3, ratio16_3, ratio16_3, ratio6_1, ratio6_1, ratio20_3, 
+ratio20_3, ratio20_3, ratio20_3, ratio8_1, ratio8_1, ratio8_1, ratio32_3, ratio32_3, ratio32_3, ratio12_1, ratio12_1, ratio40_3, 
+ratio40_3, ratio40_3, ratio40_3, ratio16_1, ratio16_1, ratio16_1, ratio64_3, ratio64_3, ratio64_3, ratio24_1, ratio24_1, ratio80_3, 
+ratio80_3, ratio80_3, ratio80_3, ratio32_1, ratio32_1, ratio32_1, ratio128_3}; 
+
+static constexpr uint16_t tetrad_inversionso[128] = {ratio1_40, ratio1_40, ratio9_320, ratio9_320, ratio1_32, ratio1_32, ratio3_80, ratio3_80, ratio3_80, ratio3_80, ratio1_20, ratio1_20, ratio1_20, 
+ratio1_20, ratio9_160, ratio9_160, ratio1_16, ratio1_16, ratio3_40, ratio3_40, ratio3_40, ratio3_40, ratio1_10, ratio1_10, ratio1_10, 
+ratio1_10, ratio9_80, ratio9_80, ratio1_8, ratio1_8, ratio3_20, ratio3_20, ratio3_20, ratio3_20, ratio1_5, ratio1_5, ratio1_5, 
+ratio1_5, ratio9_40, ratio9_40, ratio1_4, ratio1_4, ratio3_10, ratio3_10, ratio3_10, ratio3_10, ratio2_5, ratio2_5, ratio2_5, 
+ratio2_5, ratio9_20, ratio9_20, ratio1_2, ratio1_2, ratio3_5, ratio3_5, ratio3_5, ratio3_5, ratio4_5, ratio4_5, ratio4_5, 
+ratio4_5, ratio9_10, ratio9_10, ratio1_1, ratio1_1, ratio6_5, ratio6_5, ratio6_5, ratio6_5, ratio8_5, ratio8_5, ratio8_5, 
+ratio8_5, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio12_5, ratio12_5, ratio16_5, ratio16_5, ratio16_5, 
+ratio16_5, ratio18_5, ratio18_5, ratio4_1, ratio4_1, ratio24_5, ratio24_5, ratio24_5, ratio24_5, ratio32_5, ratio32_5, ratio32_5, 
+ratio32_5, ratio36_5, ratio36_5, ratio8_1, ratio8_1, ratio48_5, ratio48_5, ratio48_5, ratio48_5, ratio64_5, ratio64_5, ratio64_5, 
+ratio64_5, ratio72_5, ratio72_5, ratio16_1, ratio16_1, ratio96_5, ratio96_5, ratio96_5, ratio96_5, ratio128_5, ratio128_5, ratio128_5, 
+ratio128_5, ratio144_5, ratio144_5, ratio32_1, ratio32_1, ratio192_5, ratio192_5}; 
+
+static constexpr uint16_t tetrad_inversionsp[128] = {ratio1_48, ratio1_32, ratio1_32, ratio1_32, ratio1_32, ratio5_144, ratio5_144, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio1_24, 
+ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio5_72, ratio5_72, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, 
+ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio5_36, ratio5_36, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio5_18, ratio5_18, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio5_9, ratio5_9, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio10_9, ratio10_9, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio20_9, ratio20_9, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio40_9, ratio40_9, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, 
+ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio80_9, ratio80_9, ratio32_3, ratio32_3, ratio32_3, ratio32_3, ratio32_3, ratio32_3, 
+ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio160_9, ratio160_9, ratio64_3, ratio64_3, ratio64_3, ratio64_3, ratio64_3, ratio64_3, 
+ratio32_1, ratio32_1, ratio32_1, ratio32_1, ratio320_9, ratio320_9, ratio128_3}; 
+
+static constexpr uint16_t harmonic_entropyA[128] = {ratio3_128, ratio3_128, ratio3_128, ratio3_128, ratio1_32, ratio1_32, ratio1_32, ratio1_32, ratio3_64, ratio3_64, ratio3_64, ratio3_64, ratio3_64, 
+ratio3_64, ratio3_64, ratio3_64, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio3_32, ratio3_32, ratio3_32, ratio3_32, ratio3_32, 
+ratio3_32, ratio3_32, ratio3_32, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, 
+ratio3_16, ratio3_16, ratio3_16, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, 
+ratio12_1, ratio12_1, ratio12_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, 
+ratio24_1, ratio24_1, ratio24_1, ratio32_1, ratio32_1, ratio32_1, ratio32_1}; 
+
+static constexpr uint16_t harmonic_entropyB[128] = {ratio5_192, ratio5_192, ratio5_192, ratio5_192, ratio1_32, ratio1_32, ratio1_32, ratio1_24, ratio1_24, ratio1_24, ratio3_64, ratio3_64, ratio5_96, 
+ratio5_96, ratio5_96, ratio5_96, ratio1_16, ratio1_16, ratio1_16, ratio1_12, ratio1_12, ratio1_12, ratio3_32, ratio3_32, ratio5_48, 
+ratio5_48, ratio5_48, ratio5_48, ratio1_8, ratio1_8, ratio1_8, ratio1_6, ratio1_6, ratio1_6, ratio3_16, ratio3_16, ratio5_24, 
+ratio5_24, ratio5_24, ratio5_24, ratio1_4, ratio1_4, ratio1_4, ratio1_3, ratio1_3, ratio1_3, ratio3_8, ratio3_8, ratio5_12, 
+ratio5_12, ratio5_12, ratio5_12, ratio1_2, ratio1_2, ratio1_2, ratio2_3, ratio2_3, ratio2_3, ratio3_4, ratio3_4, ratio5_6, 
+ratio5_6, ratio5_6, ratio5_6, ratio1_1, ratio1_1, ratio1_1, ratio4_3, ratio4_3, ratio4_3, ratio3_2, ratio3_2, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio8_3, ratio8_3, ratio8_3, ratio3_1, ratio3_1, ratio10_3, 
+ratio10_3, ratio10_3, ratio10_3, ratio4_1, ratio4_1, ratio4_1, ratio16_3, ratio16_3, ratio16_3, ratio6_1, ratio6_1, ratio20_3, 
+ratio20_3, ratio20_3, ratio20_3, ratio8_1, ratio8_1, ratio8_1, ratio32_3, ratio32_3, ratio32_3, ratio12_1, ratio12_1, ratio40_3, 
+ratio40_3, ratio40_3, ratio40_3, ratio16_1, ratio16_1, ratio16_1, ratio64_3, ratio64_3, ratio64_3, ratio24_1, ratio24_1, ratio80_3, 
+ratio80_3, ratio80_3, ratio80_3, ratio32_1, ratio32_1, ratio32_1, ratio128_3}; 
+
+static constexpr uint16_t harmonic_entropyC[128] = {ratio5_192, ratio7_256, ratio7_256, ratio7_256, ratio1_32, ratio1_32, ratio5_128, ratio5_128, ratio1_24, ratio1_24, ratio3_64, ratio3_64, ratio5_96, 
+ratio7_128, ratio7_128, ratio7_128, ratio1_16, ratio1_16, ratio5_64, ratio5_64, ratio1_12, ratio1_12, ratio3_32, ratio3_32, ratio5_48, 
+ratio7_64, ratio7_64, ratio7_64, ratio1_8, ratio1_8, ratio5_32, ratio5_32, ratio1_6, ratio1_6, ratio3_16, ratio3_16, ratio5_24, 
+ratio7_32, ratio7_32, ratio7_32, ratio1_4, ratio1_4, ratio5_16, ratio5_16, ratio1_3, ratio1_3, ratio3_8, ratio3_8, ratio5_12, 
+ratio7_16, ratio7_16, ratio7_16, ratio1_2, ratio1_2, ratio5_8, ratio5_8, ratio2_3, ratio2_3, ratio3_4, ratio3_4, ratio5_6, 
+ratio7_8, ratio7_8, ratio7_8, ratio1_1, ratio1_1, ratio5_4, ratio5_4, ratio4_3, ratio4_3, ratio3_2, ratio3_2, ratio5_3, 
+ratio7_4, ratio7_4, ratio7_4, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio8_3, ratio8_3, ratio3_1, ratio3_1, ratio10_3, 
+ratio7_2, ratio7_2, ratio7_2, ratio4_1, ratio4_1, ratio5_1, ratio5_1, ratio16_3, ratio16_3, ratio6_1, ratio6_1, ratio20_3, 
+ratio7_1, ratio7_1, ratio7_1, ratio8_1, ratio8_1, ratio10_1, ratio10_1, ratio32_3, ratio32_3, ratio12_1, ratio12_1, ratio40_3, 
+ratio14_1, ratio14_1, ratio14_1, ratio16_1, ratio16_1, ratio20_1, ratio20_1, ratio64_3, ratio64_3, ratio24_1, ratio24_1, ratio80_3, 
+ratio28_1, ratio28_1, ratio28_1, ratio32_1, ratio32_1, ratio40_1, ratio40_1}; 
+
+static constexpr uint16_t harmonic_entropyD[128] = {ratio1_40, ratio7_256, ratio9_320, ratio9_320, ratio1_32, ratio1_32, ratio3_80, ratio3_80, ratio1_24, ratio7_160, ratio7_160, ratio3_64, ratio1_20, 
+ratio7_128, ratio9_160, ratio9_160, ratio1_16, ratio1_16, ratio3_40, ratio3_40, ratio1_12, ratio7_80, ratio7_80, ratio3_32, ratio1_10, 
+ratio7_64, ratio9_80, ratio9_80, ratio1_8, ratio1_8, ratio3_20, ratio3_20, ratio1_6, ratio7_40, ratio7_40, ratio3_16, ratio1_5, 
+ratio7_32, ratio9_40, ratio9_40, ratio1_4, ratio1_4, ratio3_10, ratio3_10, ratio1_3, ratio7_20, ratio7_20, ratio3_8, ratio2_5, 
+ratio7_16, ratio9_20, ratio9_20, ratio1_2, ratio1_2, ratio3_5, ratio3_5, ratio2_3, ratio7_10, ratio7_10, ratio3_4, ratio4_5, 
+ratio7_8, ratio9_10, ratio9_10, ratio1_1, ratio1_1, ratio6_5, ratio6_5, ratio4_3, ratio7_5, ratio7_5, ratio3_2, ratio8_5, 
+ratio7_4, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio8_3, ratio14_5, ratio14_5, ratio3_1, ratio16_5, 
+ratio7_2, ratio18_5, ratio18_5, ratio4_1, ratio4_1, ratio24_5, ratio24_5, ratio16_3, ratio28_5, ratio28_5, ratio6_1, ratio32_5, 
+ratio7_1, ratio36_5, ratio36_5, ratio8_1, ratio8_1, ratio48_5, ratio48_5, ratio32_3, ratio56_5, ratio56_5, ratio12_1, ratio64_5, 
+ratio14_1, ratio72_5, ratio72_5, ratio16_1, ratio16_1, ratio96_5, ratio96_5, ratio64_3, ratio112_5, ratio112_5, ratio24_1, ratio128_5, 
+ratio28_1, ratio144_5, ratio144_5, ratio32_1, ratio32_1, ratio192_5, ratio192_5}; 
+
+static constexpr uint16_t harmonic_entropyE[128] = {ratio13_512, ratio3_112, ratio9_320, ratio9_320, ratio1_32, ratio1_32, ratio3_80, ratio3_80, ratio9_224, ratio11_256, ratio5_112, ratio11_224, ratio13_256, 
+ratio3_56, ratio9_160, ratio9_160, ratio1_16, ratio1_16, ratio3_40, ratio3_40, ratio9_112, ratio11_128, ratio5_56, ratio11_112, ratio13_128, 
+ratio3_28, ratio9_80, ratio9_80, ratio1_8, ratio1_8, ratio3_20, ratio3_20, ratio9_56, ratio11_64, ratio5_28, ratio11_56, ratio13_64, 
+ratio3_14, ratio9_40, ratio9_40, ratio1_4, ratio1_4, ratio3_10, ratio3_10, ratio9_28, ratio11_32, ratio5_14, ratio11_28, ratio13_32, 
+ratio3_7, ratio9_20, ratio9_20, ratio1_2, ratio1_2, ratio3_5, ratio3_5, ratio9_14, ratio11_16, ratio5_7, ratio11_14, ratio13_16, 
+ratio6_7, ratio9_10, ratio9_10, ratio1_1, ratio1_1, ratio6_5, ratio6_5, ratio9_7, ratio11_8, ratio10_7, ratio11_7, ratio13_8, 
+ratio12_7, ratio9_5, ratio9_5, ratio2_1, ratio2_1, ratio12_5, ratio12_5, ratio18_7, ratio11_4, ratio20_7, ratio22_7, ratio13_4, 
+ratio24_7, ratio18_5, ratio18_5, ratio4_1, ratio4_1, ratio24_5, ratio24_5, ratio36_7, ratio11_2, ratio40_7, ratio44_7, ratio13_2, 
+ratio48_7, ratio36_5, ratio36_5, ratio8_1, ratio8_1, ratio48_5, ratio48_5, ratio72_7, ratio11_1, ratio80_7, ratio88_7, ratio13_1, 
+ratio96_7, ratio72_5, ratio72_5, ratio16_1, ratio16_1, ratio96_5, ratio96_5, ratio144_7, ratio22_1, ratio160_7, ratio176_7, ratio26_1, 
+ratio192_7, ratio144_5, ratio144_5, ratio32_1, ratio32_1, ratio192_5, ratio192_5}; 
+
+static constexpr uint16_t harmonic_entropyF[128] = {ratio1_40, ratio7_256, ratio7_256, ratio7_256, ratio1_32, ratio1_32, ratio5_128, ratio5_128, ratio5_128, ratio7_160, ratio7_160, ratio1_20, ratio1_20, 
+ratio7_128, ratio7_128, ratio7_128, ratio1_16, ratio1_16, ratio5_64, ratio5_64, ratio5_64, ratio7_80, ratio7_80, ratio1_10, ratio1_10, 
+ratio7_64, ratio7_64, ratio7_64, ratio1_8, ratio1_8, ratio5_32, ratio5_32, ratio5_32, ratio7_40, ratio7_40, ratio1_5, ratio1_5, 
+ratio7_32, ratio7_32, ratio7_32, ratio1_4, ratio1_4, ratio5_16, ratio5_16, ratio5_16, ratio7_20, ratio7_20, ratio2_5, ratio2_5, 
+ratio7_16, ratio7_16, ratio7_16, ratio1_2, ratio1_2, ratio5_8, ratio5_8, ratio5_8, ratio7_10, ratio7_10, ratio4_5, ratio4_5, 
+ratio7_8, ratio7_8, ratio7_8, ratio1_1, ratio1_1, ratio5_4, ratio5_4, ratio5_4, ratio7_5, ratio7_5, ratio8_5, ratio8_5, 
+ratio7_4, ratio7_4, ratio7_4, ratio2_1, ratio2_1, ratio5_2, ratio5_2, ratio5_2, ratio14_5, ratio14_5, ratio16_5, ratio16_5, 
+ratio7_2, ratio7_2, ratio7_2, ratio4_1, ratio4_1, ratio5_1, ratio5_1, ratio5_1, ratio28_5, ratio28_5, ratio32_5, ratio32_5, 
+ratio7_1, ratio7_1, ratio7_1, ratio8_1, ratio8_1, ratio10_1, ratio10_1, ratio10_1, ratio56_5, ratio56_5, ratio64_5, ratio64_5, 
+ratio14_1, ratio14_1, ratio14_1, ratio16_1, ratio16_1, ratio20_1, ratio20_1, ratio20_1, ratio112_5, ratio112_5, ratio128_5, ratio128_5, 
+ratio28_1, ratio28_1, ratio28_1, ratio32_1, ratio32_1, ratio40_1, ratio40_1}; 
+
+static constexpr uint16_t harmonic_entropyG[128] = {ratio5_192, ratio5_192, ratio5_192, ratio5_192, ratio1_32, ratio1_32, ratio1_32, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio5_96, ratio5_96, 
+ratio5_96, ratio5_96, ratio5_96, ratio1_16, ratio1_16, ratio1_16, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio5_48, ratio5_48, 
+ratio5_48, ratio5_48, ratio5_48, ratio1_8, ratio1_8, ratio1_8, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio5_24, ratio5_24, 
+ratio5_24, ratio5_24, ratio5_24, ratio1_4, ratio1_4, ratio1_4, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio5_12, ratio5_12, 
+ratio5_12, ratio5_12, ratio5_12, ratio1_2, ratio1_2, ratio1_2, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio5_6, ratio5_6, 
+ratio5_6, ratio5_6, ratio5_6, ratio1_1, ratio1_1, ratio1_1, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio5_3, ratio5_3, 
+ratio5_3, ratio5_3, ratio5_3, ratio2_1, ratio2_1, ratio2_1, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio10_3, ratio10_3, 
+ratio10_3, ratio10_3, ratio10_3, ratio4_1, ratio4_1, ratio4_1, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio20_3, ratio20_3, 
+ratio20_3, ratio20_3, ratio20_3, ratio8_1, ratio8_1, ratio8_1, ratio32_3, ratio32_3, ratio32_3, ratio32_3, ratio40_3, ratio40_3, 
+ratio40_3, ratio40_3, ratio40_3, ratio16_1, ratio16_1, ratio16_1, ratio64_3, ratio64_3, ratio64_3, ratio64_3, ratio80_3, ratio80_3, 
+ratio80_3, ratio80_3, ratio80_3, ratio32_1, ratio32_1, ratio32_1, ratio128_3}; 
+
+static constexpr uint16_t harmonic_entropyH[128] = {ratio3_128, ratio3_128, ratio3_128, ratio3_128, ratio1_32, ratio1_32, ratio1_32, ratio1_24, ratio1_24, ratio1_24, ratio3_64, ratio3_64, ratio3_64, 
+ratio3_64, ratio3_64, ratio3_64, ratio1_16, ratio1_16, ratio1_16, ratio1_12, ratio1_12, ratio1_12, ratio3_32, ratio3_32, ratio3_32, 
+ratio3_32, ratio3_32, ratio3_32, ratio1_8, ratio1_8, ratio1_8, ratio1_6, ratio1_6, ratio1_6, ratio3_16, ratio3_16, ratio3_16, 
+ratio3_16, ratio3_16, ratio3_16, ratio1_4, ratio1_4, ratio1_4, ratio1_3, ratio1_3, ratio1_3, ratio3_8, ratio3_8, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio1_2, ratio1_2, ratio1_2, ratio2_3, ratio2_3, ratio2_3, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio1_1, ratio1_1, ratio1_1, ratio4_3, ratio4_3, ratio4_3, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio2_1, ratio2_1, ratio2_1, ratio8_3, ratio8_3, ratio8_3, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio4_1, ratio4_1, ratio4_1, ratio16_3, ratio16_3, ratio16_3, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio8_1, ratio8_1, ratio8_1, ratio32_3, ratio32_3, ratio32_3, ratio12_1, ratio12_1, ratio12_1, 
+ratio12_1, ratio12_1, ratio12_1, ratio16_1, ratio16_1, ratio16_1, ratio64_3, ratio64_3, ratio64_3, ratio24_1, ratio24_1, ratio24_1, 
+ratio24_1, ratio24_1, ratio24_1, ratio32_1, ratio32_1, ratio32_1, ratio128_3}; 
+
+static constexpr uint16_t bohlenPeirceAScalevoct[128] = {ratio49_2025, ratio5_189, ratio5_189, ratio7_243, ratio7_243, ratio7_225, ratio7_225, ratio1_27, ratio1_25, ratio1_21, ratio7_135, ratio7_135, ratio5_108, 
+ratio5_108, ratio5_108, ratio5_108, ratio5_108, ratio1_15, ratio1_15, ratio49_675, ratio5_63, ratio5_63, ratio7_81, ratio7_81, ratio7_75, 
+ratio7_75, ratio1_9, ratio3_25, ratio1_7, ratio7_45, ratio7_45, ratio5_36, ratio5_36, ratio5_36, ratio5_36, ratio5_36, ratio1_5, 
+ratio1_5, ratio49_225, ratio5_21, ratio5_21, ratio7_27, ratio7_27, ratio7_25, ratio7_25, ratio1_3, ratio9_25, ratio3_7, ratio7_15, 
+ratio7_15, ratio5_12, ratio5_12, ratio5_12, ratio5_12, ratio5_12, ratio3_5, ratio3_5, ratio49_75, ratio5_7, ratio5_7, ratio7_9, 
+ratio7_9, ratio21_25, ratio21_25, ratio1_1, ratio27_25, ratio9_7, ratio7_5, ratio7_5, ratio5_4, ratio5_4, ratio5_4, ratio5_4, 
+ratio5_4, ratio9_5, ratio9_5, ratio49_25, ratio15_7, ratio15_7, ratio7_3, ratio7_3, ratio63_25, ratio63_25, ratio3_1, ratio81_25, 
+ratio27_7, ratio21_5, ratio21_5, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio15_4, ratio27_5, ratio27_5, ratio147_25, ratio45_7, 
+ratio45_7, ratio7_1, ratio7_1, ratio189_25, ratio189_25, ratio9_1, ratio243_25, ratio81_7, ratio63_5, ratio63_5, ratio45_4, ratio45_4, 
+ratio45_4, ratio45_4, ratio45_4, ratio81_5, ratio81_5, ratio441_25, ratio135_7, ratio135_7, ratio21_1, ratio21_1, ratio567_25, ratio567_25, 
+ratio27_1, ratio729_25, ratio243_7, ratio189_5, ratio189_5, ratio135_4, ratio135_4}; 
+
+static constexpr uint16_t bohlenPeirceBlueLambdavoct[128] = {ratio7_243, ratio7_243, ratio7_243, ratio7_243, ratio25_729, ratio25_729, ratio25_729, ratio1_27, ratio25_567, ratio1_21, ratio7_135, ratio7_135, ratio7_135, 
+ratio5_81, ratio1_15, ratio1_15, ratio49_675, ratio49_675, ratio49_675, ratio7_81, ratio7_81, ratio7_81, ratio7_81, ratio25_243, ratio25_243, 
+ratio25_243, ratio1_9, ratio25_189, ratio1_7, ratio7_45, ratio7_45, ratio7_45, ratio5_27, ratio1_5, ratio1_5, ratio49_225, ratio49_225, 
+ratio49_225, ratio7_27, ratio7_27, ratio7_27, ratio7_27, ratio25_81, ratio25_81, ratio25_81, ratio1_3, ratio25_63, ratio3_7, ratio7_15, 
+ratio7_15, ratio7_15, ratio5_9, ratio3_5, ratio3_5, ratio49_75, ratio49_75, ratio49_75, ratio7_9, ratio7_9, ratio7_9, ratio7_9, 
+ratio25_27, ratio25_27, ratio25_27, ratio1_1, ratio25_21, ratio9_7, ratio7_5, ratio7_5, ratio7_5, ratio5_3, ratio9_5, ratio9_5, 
+ratio49_25, ratio49_25, ratio49_25, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio25_9, ratio25_9, ratio25_9, ratio3_1, ratio25_7, 
+ratio27_7, ratio21_5, ratio21_5, ratio21_5, ratio5_1, ratio27_5, ratio27_5, ratio147_25, ratio147_25, ratio147_25, ratio7_1, ratio7_1, 
+ratio7_1, ratio7_1, ratio25_3, ratio25_3, ratio25_3, ratio9_1, ratio75_7, ratio81_7, ratio63_5, ratio63_5, ratio63_5, ratio15_1, 
+ratio81_5, ratio81_5, ratio441_25, ratio441_25, ratio441_25, ratio21_1, ratio21_1, ratio21_1, ratio21_1, ratio25_1, ratio25_1, ratio25_1, 
+ratio27_1, ratio225_7, ratio243_7, ratio189_5, ratio189_5, ratio189_5, ratio45_1}; 
+
+static constexpr uint16_t bohlenPeirceDurIvoct[128] = {ratio7_243, ratio7_243, ratio7_225, ratio7_225, ratio7_225, ratio7_225, ratio7_225, ratio1_27, ratio1_25, ratio1_21, ratio7_135, ratio7_135, ratio7_135, 
+ratio5_81, ratio1_15, ratio1_15, ratio49_675, ratio49_675, ratio49_675, ratio7_81, ratio7_81, ratio7_75, ratio7_75, ratio7_75, ratio7_75, 
+ratio7_75, ratio1_9, ratio3_25, ratio1_7, ratio7_45, ratio7_45, ratio7_45, ratio5_27, ratio1_5, ratio1_5, ratio49_225, ratio49_225, 
+ratio49_225, ratio7_27, ratio7_27, ratio7_25, ratio7_25, ratio7_25, ratio7_25, ratio7_25, ratio1_3, ratio9_25, ratio3_7, ratio7_15, 
+ratio7_15, ratio7_15, ratio5_9, ratio3_5, ratio3_5, ratio49_75, ratio49_75, ratio49_75, ratio7_9, ratio7_9, ratio21_25, ratio21_25, 
+ratio21_25, ratio21_25, ratio21_25, ratio1_1, ratio27_25, ratio9_7, ratio7_5, ratio7_5, ratio7_5, ratio5_3, ratio9_5, ratio9_5, 
+ratio49_25, ratio49_25, ratio49_25, ratio7_3, ratio7_3, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio3_1, ratio81_25, 
+ratio27_7, ratio21_5, ratio21_5, ratio21_5, ratio5_1, ratio27_5, ratio27_5, ratio147_25, ratio147_25, ratio147_25, ratio7_1, ratio7_1, 
+ratio189_25, ratio189_25, ratio189_25, ratio189_25, ratio189_25, ratio9_1, ratio243_25, ratio81_7, ratio63_5, ratio63_5, ratio63_5, ratio15_1, 
+ratio81_5, ratio81_5, ratio441_25, ratio441_25, ratio441_25, ratio21_1, ratio21_1, ratio567_25, ratio567_25, ratio567_25, ratio567_25, ratio567_25, 
+ratio27_1, ratio729_25, ratio243_7, ratio189_5, ratio189_5, ratio189_5, ratio45_1}; 
+
+static constexpr uint16_t bohlenPeirceGammavoct[128] = {ratio7_243, ratio7_243, ratio7_243, ratio7_243, ratio25_729, ratio25_729, ratio25_729, ratio1_27, ratio1_25, ratio1_21, ratio7_135, ratio7_135, ratio7_135, 
+ratio5_81, ratio1_15, ratio1_15, ratio49_675, ratio49_675, ratio49_675, ratio7_81, ratio7_81, ratio7_81, ratio7_81, ratio25_243, ratio25_243, 
+ratio25_243, ratio1_9, ratio3_25, ratio1_7, ratio7_45, ratio7_45, ratio7_45, ratio5_27, ratio1_5, ratio1_5, ratio49_225, ratio49_225, 
+ratio49_225, ratio7_27, ratio7_27, ratio7_27, ratio7_27, ratio25_81, ratio25_81, ratio25_81, ratio1_3, ratio9_25, ratio3_7, ratio7_15, 
+ratio7_15, ratio7_15, ratio5_9, ratio3_5, ratio3_5, ratio49_75, ratio49_75, ratio49_75, ratio7_9, ratio7_9, ratio7_9, ratio7_9, 
+ratio25_27, ratio25_27, ratio25_27, ratio1_1, ratio27_25, ratio9_7, ratio7_5, ratio7_5, ratio7_5, ratio5_3, ratio9_5, ratio9_5, 
+ratio49_25, ratio49_25, ratio49_25, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio25_9, ratio25_9, ratio25_9, ratio3_1, ratio81_25, 
+ratio27_7, ratio21_5, ratio21_5, ratio21_5, ratio5_1, ratio27_5, ratio27_5, ratio147_25, ratio147_25, ratio147_25, ratio7_1, ratio7_1, 
+ratio7_1, ratio7_1, ratio25_3, ratio25_3, ratio25_3, ratio9_1, ratio243_25, ratio81_7, ratio63_5, ratio63_5, ratio63_5, ratio15_1, 
+ratio81_5, ratio81_5, ratio441_25, ratio441_25, ratio441_25, ratio21_1, ratio21_1, ratio21_1, ratio21_1, ratio25_1, ratio25_1, ratio25_1, 
+ratio27_1, ratio729_25, ratio243_7, ratio189_5, ratio189_5, ratio189_5, ratio45_1}; 
+
+static constexpr uint16_t bohlenPeirceHarmonicvoct[128] = {ratio7_243, ratio7_243, ratio7_225, ratio7_225, ratio7_225, ratio7_225, ratio7_225, ratio1_27, ratio1_25, ratio1_21, ratio7_135, ratio7_135, ratio7_135, 
+ratio5_81, ratio1_15, ratio1_15, ratio1_15, ratio5_63, ratio5_63, ratio7_81, ratio7_81, ratio7_75, ratio7_75, ratio7_75, ratio7_75, 
+ratio7_75, ratio1_9, ratio3_25, ratio1_7, ratio7_45, ratio7_45, ratio7_45, ratio5_27, ratio1_5, ratio1_5, ratio1_5, ratio5_21, 
+ratio5_21, ratio7_27, ratio7_27, ratio7_25, ratio7_25, ratio7_25, ratio7_25, ratio7_25, ratio1_3, ratio9_25, ratio3_7, ratio7_15, 
+ratio7_15, ratio7_15, ratio5_9, ratio3_5, ratio3_5, ratio3_5, ratio5_7, ratio5_7, ratio7_9, ratio7_9, ratio21_25, ratio21_25, 
+ratio21_25, ratio21_25, ratio21_25, ratio1_1, ratio27_25, ratio9_7, ratio7_5, ratio7_5, ratio7_5, ratio5_3, ratio9_5, ratio9_5, 
+ratio9_5, ratio15_7, ratio15_7, ratio7_3, ratio7_3, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio3_1, ratio81_25, 
+ratio27_7, ratio21_5, ratio21_5, ratio21_5, ratio5_1, ratio27_5, ratio27_5, ratio27_5, ratio45_7, ratio45_7, ratio7_1, ratio7_1, 
+ratio189_25, ratio189_25, ratio189_25, ratio189_25, ratio189_25, ratio9_1, ratio243_25, ratio81_7, ratio63_5, ratio63_5, ratio63_5, ratio15_1, 
+ratio81_5, ratio81_5, ratio81_5, ratio135_7, ratio135_7, ratio21_1, ratio21_1, ratio567_25, ratio567_25, ratio567_25, ratio567_25, ratio567_25, 
+ratio27_1, ratio729_25, ratio243_7, ratio189_5, ratio189_5, ratio189_5, ratio45_1}; 
+
+static constexpr uint16_t bohlenPeirceMollIvoct[128] = {ratio7_243, ratio7_243, ratio7_243, ratio7_243, ratio25_729, ratio25_729, ratio25_729, ratio1_27, ratio25_567, ratio1_21, ratio1_21, ratio1_21, ratio25_441, 
+ratio5_81, ratio1_15, ratio1_15, ratio1_15, ratio5_63, ratio5_63, ratio7_81, ratio7_81, ratio7_81, ratio7_81, ratio25_243, ratio25_243, 
+ratio25_243, ratio1_9, ratio25_189, ratio1_7, ratio1_7, ratio1_7, ratio25_147, ratio5_27, ratio1_5, ratio1_5, ratio1_5, ratio5_21, 
+ratio5_21, ratio7_27, ratio7_27, ratio7_27, ratio7_27, ratio25_81, ratio25_81, ratio25_81, ratio1_3, ratio25_63, ratio3_7, ratio3_7, 
+ratio3_7, ratio25_49, ratio5_9, ratio3_5, ratio3_5, ratio3_5, ratio5_7, ratio5_7, ratio7_9, ratio7_9, ratio7_9, ratio7_9, 
+ratio25_27, ratio25_27, ratio25_27, ratio1_1, ratio25_21, ratio9_7, ratio9_7, ratio9_7, ratio75_49, ratio5_3, ratio9_5, ratio9_5, 
+ratio9_5, ratio15_7, ratio15_7, ratio7_3, ratio7_3, ratio7_3, ratio7_3, ratio25_9, ratio25_9, ratio25_9, ratio3_1, ratio25_7, 
+ratio27_7, ratio27_7, ratio27_7, ratio225_49, ratio5_1, ratio27_5, ratio27_5, ratio27_5, ratio45_7, ratio45_7, ratio7_1, ratio7_1, 
+ratio7_1, ratio7_1, ratio25_3, ratio25_3, ratio25_3, ratio9_1, ratio75_7, ratio81_7, ratio81_7, ratio81_7, ratio675_49, ratio15_1, 
+ratio81_5, ratio81_5, ratio81_5, ratio135_7, ratio135_7, ratio21_1, ratio21_1, ratio21_1, ratio21_1, ratio25_1, ratio25_1, ratio25_1, 
+ratio27_1, ratio225_7, ratio243_7, ratio243_7, ratio243_7, ratio2025_49, ratio45_1}; 
+
+static constexpr uint16_t bohlenPeirceProoijenMinvoct[128] = {ratio5_189, ratio5_189, ratio5_189, ratio5_189, ratio25_729, ratio25_729, ratio25_729, ratio1_27, ratio25_567, ratio1_21, ratio1_21, ratio1_21, ratio1_21, 
+ratio5_81, ratio1_15, ratio1_15, ratio1_15, ratio5_63, ratio5_63, ratio5_63, ratio5_63, ratio5_63, ratio5_63, ratio25_243, ratio25_243, 
+ratio25_243, ratio1_9, ratio25_189, ratio1_7, ratio1_7, ratio1_7, ratio1_7, ratio5_27, ratio1_5, ratio1_5, ratio1_5, ratio5_21, 
+ratio5_21, ratio5_21, ratio5_21, ratio5_21, ratio5_21, ratio25_81, ratio25_81, ratio25_81, ratio1_3, ratio25_63, ratio3_7, ratio3_7, 
+ratio3_7, ratio3_7, ratio5_9, ratio3_5, ratio3_5, ratio3_5, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, ratio5_7, 
+ratio25_27, ratio25_27, ratio25_27, ratio1_1, ratio25_21, ratio9_7, ratio9_7, ratio9_7, ratio9_7, ratio5_3, ratio9_5, ratio9_5, 
+ratio9_5, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio15_7, ratio25_9, ratio25_9, ratio25_9, ratio3_1, ratio25_7, 
+ratio27_7, ratio27_7, ratio27_7, ratio27_7, ratio5_1, ratio27_5, ratio27_5, ratio27_5, ratio45_7, ratio45_7, ratio45_7, ratio45_7, 
+ratio45_7, ratio45_7, ratio25_3, ratio25_3, ratio25_3, ratio9_1, ratio75_7, ratio81_7, ratio81_7, ratio81_7, ratio81_7, ratio15_1, 
+ratio81_5, ratio81_5, ratio81_5, ratio135_7, ratio135_7, ratio135_7, ratio135_7, ratio135_7, ratio135_7, ratio25_1, ratio25_1, ratio25_1, 
+ratio27_1, ratio225_7, ratio243_7, ratio243_7, ratio243_7, ratio243_7, ratio45_1}; 
+
+static constexpr uint16_t bohlenPeirceWalkerBvoct[128] = {ratio7_243, ratio7_243, ratio7_225, ratio7_225, ratio7_225, ratio7_225, ratio7_225, ratio1_27, ratio1_25, ratio1_21, ratio7_135, ratio7_135, ratio25_441, 
+ratio25_441, ratio1_15, ratio1_15, ratio49_675, ratio49_675, ratio49_675, ratio7_81, ratio7_81, ratio7_75, ratio7_75, ratio7_75, ratio7_75, 
+ratio7_75, ratio1_9, ratio3_25, ratio1_7, ratio7_45, ratio7_45, ratio25_147, ratio25_147, ratio1_5, ratio1_5, ratio49_225, ratio49_225, 
+ratio49_225, ratio7_27, ratio7_27, ratio7_25, ratio7_25, ratio7_25, ratio7_25, ratio7_25, ratio1_3, ratio9_25, ratio3_7, ratio7_15, 
+ratio7_15, ratio25_49, ratio25_49, ratio3_5, ratio3_5, ratio49_75, ratio49_75, ratio49_75, ratio7_9, ratio7_9, ratio21_25, ratio21_25, 
+ratio21_25, ratio21_25, ratio21_25, ratio1_1, ratio27_25, ratio9_7, ratio7_5, ratio7_5, ratio75_49, ratio75_49, ratio9_5, ratio9_5, 
+ratio49_25, ratio49_25, ratio49_25, ratio7_3, ratio7_3, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio63_25, ratio3_1, ratio81_25, 
+ratio27_7, ratio21_5, ratio21_5, ratio225_49, ratio225_49, ratio27_5, ratio27_5, ratio147_25, ratio147_25, ratio147_25, ratio7_1, ratio7_1, 
+ratio189_25, ratio189_25, ratio189_25, ratio189_25, ratio189_25, ratio9_1, ratio243_25, ratio81_7, ratio63_5, ratio63_5, ratio675_49, ratio675_49, 
+ratio81_5, ratio81_5, ratio441_25, ratio441_25, ratio441_25, ratio21_1, ratio21_1, ratio567_25, ratio567_25, ratio567_25, ratio567_25, ratio567_25, 
+ratio27_1, ratio729_25, ratio243_7, ratio189_5, ratio189_5, ratio2025_49, ratio2025_49}; 
+
+static constexpr uint16_t rhythm_integers0[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio8_1, 
+ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, 
+ratio8_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, 
+ratio12_1, ratio12_1, ratio12_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, 
+ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, 
+ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1}; 
+
+static constexpr uint16_t rhythm_integers1[128] = {ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, 
+ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, 
+ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1}; 
+
+static constexpr uint16_t rhythm_integers2[128] = {ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, 
+ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, 
+ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1}; 
+
+static constexpr uint16_t rhythm_integers3[128] = {ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1}; 
+
+static constexpr uint16_t rhythm_integers4[128] = {ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, 
+ratio1_6, ratio1_6, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1}; 
+
+static constexpr uint16_t rhythm_integers5[128] = {ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, 
+ratio1_8, ratio1_8, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio9_8, 
+ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, ratio9_8, 
+ratio9_8, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1}; 
+
+static constexpr uint16_t rhythm_integers6[128] = {ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, 
+ratio1_12, ratio1_12, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, 
+ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1}; 
+
+static constexpr uint16_t rhythm_integers7[128] = {ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, 
+ratio1_16, ratio1_16, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, 
+ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, 
+ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio3_8, ratio3_8, ratio3_8, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2}; 
+
+static constexpr uint16_t rhythm_integers8[128] = {ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio1_24, ratio1_24, 
+ratio1_24, ratio1_24, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, 
+ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, 
+ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, 
+ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t no_triplets0[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, 
+ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, 
+ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, 
+ratio8_1, ratio8_1, ratio8_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, 
+ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1, ratio16_1}; 
+
+static constexpr uint16_t no_triplets1[128] = {ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, 
+ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1}; 
+
+static constexpr uint16_t no_triplets2[128] = {ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, 
+ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3, ratio16_3}; 
+
+static constexpr uint16_t no_triplets3[128] = {ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1}; 
+
+static constexpr uint16_t no_triplets4[128] = {ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, 
+ratio1_6, ratio1_6, ratio1_6, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, 
+ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3, ratio8_3}; 
+
+static constexpr uint16_t no_triplets5[128] = {ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, 
+ratio1_8, ratio1_8, ratio1_8, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1}; 
+
+static constexpr uint16_t no_triplets6[128] = {ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, 
+ratio1_12, ratio1_12, ratio1_12, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, 
+ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, 
+ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, ratio2_3, 
+ratio2_3, ratio2_3, ratio2_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, 
+ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3, ratio4_3}; 
+
+static constexpr uint16_t no_triplets7[128] = {ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, 
+ratio1_16, ratio1_16, ratio1_16, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, 
+ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, 
+ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1}; 
+
+static constexpr uint16_t triplets0[128] = {ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, 
+ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, 
+ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, 
+ratio12_1, ratio12_1, ratio12_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, 
+ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1, ratio24_1}; 
+
+static constexpr uint16_t triplets1[128] = {ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, 
+ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1, ratio12_1}; 
+
+static constexpr uint16_t triplets2[128] = {ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, ratio1_3, 
+ratio1_3, ratio1_3, ratio1_3, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, 
+ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1, ratio8_1}; 
+
+static constexpr uint16_t triplets3[128] = {ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, 
+ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1, ratio6_1}; 
+
+static constexpr uint16_t triplets4[128] = {ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, ratio1_6, 
+ratio1_6, ratio1_6, ratio1_6, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, 
+ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1, ratio4_1}; 
+
+static constexpr uint16_t triplets5[128] = {ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, ratio1_8, 
+ratio1_8, ratio1_8, ratio1_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, 
+ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1, ratio3_1}; 
+
+static constexpr uint16_t triplets6[128] = {ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, ratio1_12, 
+ratio1_12, ratio1_12, ratio1_12, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, 
+ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_4, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, 
+ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_2, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, ratio1_1, 
+ratio1_1, ratio1_1, ratio1_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, 
+ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1, ratio2_1}; 
+
+static constexpr uint16_t triplets7[128] = {ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, ratio1_16, 
+ratio1_16, ratio1_16, ratio1_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, 
+ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, 
+ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_16, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, 
+ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_8, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, ratio3_4, 
+ratio3_4, ratio3_4, ratio3_4, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, 
+ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2, ratio3_2}; 
+
+static constexpr uint16_t poly_div_resets0[128] = {ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, 
+ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, 
+ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, 
+ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio4_1_4, 
+ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, 
+ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio6_1_4, ratio6_1_4, ratio6_1_4, ratio6_1_4, ratio6_1_4, ratio6_1_4, ratio6_1_4, ratio6_1_4, ratio6_1_4, 
+ratio6_1_4, ratio6_1_4, ratio6_1_4, ratio6_1_4, ratio6_1_4, ratio6_1_4, ratio6_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, 
+ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio16_1_4, 
+ratio16_1_4, ratio16_1_4, ratio16_1_4, ratio16_1_4, ratio16_1_4, ratio16_1_4, ratio16_1_4, ratio16_1_4, ratio16_1_4, ratio16_1_4, ratio16_1_4, ratio16_1_4, 
+ratio16_1_4, ratio16_1_4, ratio16_1_4, ratio24_1_4, ratio24_1_4, ratio24_1_4, ratio24_1_4, ratio24_1_4, ratio24_1_4, ratio24_1_4, ratio24_1_4, ratio24_1_4, 
+ratio24_1_4, ratio24_1_4, ratio24_1_4, ratio24_1_4, ratio24_1_4, ratio24_1_4, ratio24_1_4}; 
+
+static constexpr uint16_t poly_div_resets1[128] = {ratio1_2_4, ratio1_2_4, ratio1_2_4, ratio1_2_4, ratio1_2_4, ratio1_2_4, ratio1_2_4, ratio1_2_4, ratio1_2_4, ratio1_2_4, ratio1_2_4, ratio1_2_4, ratio1_2_4, 
+ratio1_2_4, ratio1_2_4, ratio1_2_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, 
+ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio1_1_4, ratio3_2_4, ratio3_2_4, ratio3_2_4, ratio3_2_4, ratio3_2_4, 
+ratio3_2_4, ratio3_2_4, ratio3_2_4, ratio3_2_4, ratio3_2_4, ratio3_2_4, ratio3_2_4, ratio3_2_4, ratio3_2_4, ratio3_2_4, ratio3_2_4, ratio2_1_4, 
+ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio2_1_4, 
+ratio2_1_4, ratio2_1_4, ratio2_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, 
+ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio3_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, 
+ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio4_1_4, ratio8_1_4, 
+ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio8_1_4, 
+ratio8_1_4, ratio8_1_4, ratio8_1_4, ratio12_1_4, ratio12_1_4, ratio12_1_4, ratio12_1_4, ratio12_1_4, ratio12_1_4, ratio12_1_4, ratio12_1_4, ratio12_1_4, 
+ratio12_1_4, ratio12_1_4, ratio12_1_4, ratio12_1_4, ratio12_1_4, ratio12_1_4, ratio12_1_4}; 
+
+static constexpr uint16_t poly_div_resets2[128] = {ratio1_3_8, ratio1_3_8, ratio1_3_8, ratio1_3_8, ratio1_3_8, ratio1_3_8, ratio1_3_8, ratio1_3_8, ratio1_3_8, ratio1_3_8, ratio1_3_8, ratio1_3_8, ratio1_3_8, 
+ratio1_3_8, ratio1_3_8, ratio1_3_8, ratio2_3_8, ratio2_3_8, ratio2_3_8, ratio2_3_8, ratio2_3_8, ratio2_3_8, ratio2_3_8, ratio2_3_8, ratio2_3_8, 
+ratio2_3_8, ratio2_3_8, ratio2_3_8, ratio2_3_8, ratio2_3_8, ratio2_3_8, ratio2_3_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, 
+ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio4_3_8, 
+ratio4_3_8, ratio4_3_8, ratio4_3_8, ratio4_3_8, ratio4_3_8, ratio4_3_8, ratio4_3_8, ratio4_3_8, ratio4_3_8, ratio4_3_8, ratio4_3_8, ratio4_3_8, 
+ratio4_3_8, ratio4_3_8, ratio4_3_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, 
+ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio8_3_8, ratio8_3_8, ratio8_3_8, ratio8_3_8, ratio8_3_8, 
+ratio8_3_8, ratio8_3_8, ratio8_3_8, ratio8_3_8, ratio8_3_8, ratio8_3_8, ratio8_3_8, ratio8_3_8, ratio8_3_8, ratio8_3_8, ratio8_3_8, ratio16_3_8, 
+ratio16_3_8, ratio16_3_8, ratio16_3_8, ratio16_3_8, ratio16_3_8, ratio16_3_8, ratio16_3_8, ratio16_3_8, ratio16_3_8, ratio16_3_8, ratio16_3_8, ratio16_3_8, 
+ratio16_3_8, ratio16_3_8, ratio16_3_8, ratio8_1_8, ratio8_1_8, ratio8_1_8, ratio8_1_8, ratio8_1_8, ratio8_1_8, ratio8_1_8, ratio8_1_8, ratio8_1_8, 
+ratio8_1_8, ratio8_1_8, ratio8_1_8, ratio8_1_8, ratio8_1_8, ratio8_1_8, ratio8_1_8}; 
+
+static constexpr uint16_t poly_div_resets3[128] = {ratio1_4_8, ratio1_4_8, ratio1_4_8, ratio1_4_8, ratio1_4_8, ratio1_4_8, ratio1_4_8, ratio1_4_8, ratio1_4_8, ratio1_4_8, ratio1_4_8, ratio1_4_8, ratio1_4_8, 
+ratio1_4_8, ratio1_4_8, ratio1_4_8, ratio1_2_8, ratio1_2_8, ratio1_2_8, ratio1_2_8, ratio1_2_8, ratio1_2_8, ratio1_2_8, ratio1_2_8, ratio1_2_8, 
+ratio1_2_8, ratio1_2_8, ratio1_2_8, ratio1_2_8, ratio1_2_8, ratio1_2_8, ratio1_2_8, ratio3_4_8, ratio3_4_8, ratio3_4_8, ratio3_4_8, ratio3_4_8, 
+ratio3_4_8, ratio3_4_8, ratio3_4_8, ratio3_4_8, ratio3_4_8, ratio3_4_8, ratio3_4_8, ratio3_4_8, ratio3_4_8, ratio3_4_8, ratio3_4_8, ratio1_1_8, 
+ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio1_1_8, 
+ratio1_1_8, ratio1_1_8, ratio1_1_8, ratio3_2_8, ratio3_2_8, ratio3_2_8, ratio3_2_8, ratio3_2_8, ratio3_2_8, ratio3_2_8, ratio3_2_8, ratio3_2_8, 
+ratio3_2_8, ratio3_2_8, ratio3_2_8, ratio3_2_8, ratio3_2_8, ratio3_2_8, ratio3_2_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, 
+ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio2_1_8, ratio4_1_8, 
+ratio4_1_8, ratio4_1_8, ratio4_1_8, ratio4_1_8, ratio4_1_8, ratio4_1_8, ratio4_1_8, ratio4_1_8, ratio4_1_8, ratio4_1_8, ratio4_1_8, ratio4_1_8, 
+ratio4_1_8, ratio4_1_8, ratio4_1_8, ratio6_1_8, ratio6_1_8, ratio6_1_8, ratio6_1_8, ratio6_1_8, ratio6_1_8, ratio6_1_8, ratio6_1_8, ratio6_1_8, 
+ratio6_1_8, ratio6_1_8, ratio6_1_8, ratio6_1_8, ratio6_1_8, ratio6_1_8, ratio6_1_8}; 
+
+static constexpr uint16_t poly_div_resets4[128] = {ratio1_5_16, ratio1_5_16, ratio1_5_16, ratio1_5_16, ratio1_5_16, ratio1_5_16, ratio1_5_16, ratio1_5_16, ratio1_5_16, ratio1_5_16, ratio1_5_16, ratio1_5_16, ratio1_5_16, 
+ratio1_5_16, ratio1_5_16, ratio1_5_16, ratio2_5_16, ratio2_5_16, ratio2_5_16, ratio2_5_16, ratio2_5_16, ratio2_5_16, ratio2_5_16, ratio2_5_16, ratio2_5_16, 
+ratio2_5_16, ratio2_5_16, ratio2_5_16, ratio2_5_16, ratio2_5_16, ratio2_5_16, ratio2_5_16, ratio3_5_16, ratio3_5_16, ratio3_5_16, ratio3_5_16, ratio3_5_16, 
+ratio3_5_16, ratio3_5_16, ratio3_5_16, ratio3_5_16, ratio3_5_16, ratio3_5_16, ratio3_5_16, ratio3_5_16, ratio3_5_16, ratio3_5_16, ratio3_5_16, ratio4_5_16, 
+ratio4_5_16, ratio4_5_16, ratio4_5_16, ratio4_5_16, ratio4_5_16, ratio4_5_16, ratio4_5_16, ratio4_5_16, ratio4_5_16, ratio4_5_16, ratio4_5_16, ratio4_5_16, 
+ratio4_5_16, ratio4_5_16, ratio4_5_16, ratio6_5_16, ratio6_5_16, ratio6_5_16, ratio6_5_16, ratio6_5_16, ratio6_5_16, ratio6_5_16, ratio6_5_16, ratio6_5_16, 
+ratio6_5_16, ratio6_5_16, ratio6_5_16, ratio6_5_16, ratio6_5_16, ratio6_5_16, ratio6_5_16, ratio8_5_16, ratio8_5_16, ratio8_5_16, ratio8_5_16, ratio8_5_16, 
+ratio8_5_16, ratio8_5_16, ratio8_5_16, ratio8_5_16, ratio8_5_16, ratio8_5_16, ratio8_5_16, ratio8_5_16, ratio8_5_16, ratio8_5_16, ratio8_5_16, ratio16_5_16, 
+ratio16_5_16, ratio16_5_16, ratio16_5_16, ratio16_5_16, ratio16_5_16, ratio16_5_16, ratio16_5_16, ratio16_5_16, ratio16_5_16, ratio16_5_16, ratio16_5_16, ratio16_5_16, 
+ratio16_5_16, ratio16_5_16, ratio16_5_16, ratio24_5_16, ratio24_5_16, ratio24_5_16, ratio24_5_16, ratio24_5_16, ratio24_5_16, ratio24_5_16, ratio24_5_16, ratio24_5_16, 
+ratio24_5_16, ratio24_5_16, ratio24_5_16, ratio24_5_16, ratio24_5_16, ratio24_5_16, ratio24_5_16}; 
+
+static constexpr uint16_t poly_div_resets5[128] = {ratio1_6_16, ratio1_6_16, ratio1_6_16, ratio1_6_16, ratio1_6_16, ratio1_6_16, ratio1_6_16, ratio1_6_16, ratio1_6_16, ratio1_6_16, ratio1_6_16, ratio1_6_16, ratio1_6_16, 
+ratio1_6_16, ratio1_6_16, ratio1_6_16, ratio1_3_16, ratio1_3_16, ratio1_3_16, ratio1_3_16, ratio1_3_16, ratio1_3_16, ratio1_3_16, ratio1_3_16, ratio1_3_16, 
+ratio1_3_16, ratio1_3_16, ratio1_3_16, ratio1_3_16, ratio1_3_16, ratio1_3_16, ratio1_3_16, ratio1_2_16, ratio1_2_16, ratio1_2_16, ratio1_2_16, ratio1_2_16, 
+ratio1_2_16, ratio1_2_16, ratio1_2_16, ratio1_2_16, ratio1_2_16, ratio1_2_16, ratio1_2_16, ratio1_2_16, ratio1_2_16, ratio1_2_16, ratio1_2_16, ratio2_3_16, 
+ratio2_3_16, ratio2_3_16, ratio2_3_16, ratio2_3_16, ratio2_3_16, ratio2_3_16, ratio2_3_16, ratio2_3_16, ratio2_3_16, ratio2_3_16, ratio2_3_16, ratio2_3_16, 
+ratio2_3_16, ratio2_3_16, ratio2_3_16, ratio1_1_16, ratio1_1_16, ratio1_1_16, ratio1_1_16, ratio1_1_16, ratio1_1_16, ratio1_1_16, ratio1_1_16, ratio1_1_16, 
+ratio1_1_16, ratio1_1_16, ratio1_1_16, ratio1_1_16, ratio1_1_16, ratio1_1_16, ratio1_1_16, ratio4_3_16, ratio4_3_16, ratio4_3_16, ratio4_3_16, ratio4_3_16, 
+ratio4_3_16, ratio4_3_16, ratio4_3_16, ratio4_3_16, ratio4_3_16, ratio4_3_16, ratio4_3_16, ratio4_3_16, ratio4_3_16, ratio4_3_16, ratio4_3_16, ratio8_3_16, 
+ratio8_3_16, ratio8_3_16, ratio8_3_16, ratio8_3_16, ratio8_3_16, ratio8_3_16, ratio8_3_16, ratio8_3_16, ratio8_3_16, ratio8_3_16, ratio8_3_16, ratio8_3_16, 
+ratio8_3_16, ratio8_3_16, ratio8_3_16, ratio4_1_16, ratio4_1_16, ratio4_1_16, ratio4_1_16, ratio4_1_16, ratio4_1_16, ratio4_1_16, ratio4_1_16, ratio4_1_16, 
+ratio4_1_16, ratio4_1_16, ratio4_1_16, ratio4_1_16, ratio4_1_16, ratio4_1_16, ratio4_1_16}; 
+
+static constexpr uint16_t poly_div_resets6[128] = {ratio1_7_32, ratio1_7_32, ratio1_7_32, ratio1_7_32, ratio1_7_32, ratio1_7_32, ratio1_7_32, ratio1_7_32, ratio1_7_32, ratio1_7_32, ratio1_7_32, ratio1_7_32, ratio1_7_32, 
+ratio1_7_32, ratio1_7_32, ratio1_7_32, ratio2_7_32, ratio2_7_32, ratio2_7_32, ratio2_7_32, ratio2_7_32, ratio2_7_32, ratio2_7_32, ratio2_7_32, ratio2_7_32, 
+ratio2_7_32, ratio2_7_32, ratio2_7_32, ratio2_7_32, ratio2_7_32, ratio2_7_32, ratio2_7_32, ratio3_7_32, ratio3_7_32, ratio3_7_32, ratio3_7_32, ratio3_7_32, 
+ratio3_7_32, ratio3_7_32, ratio3_7_32, ratio3_7_32, ratio3_7_32, ratio3_7_32, ratio3_7_32, ratio3_7_32, ratio3_7_32, ratio3_7_32, ratio3_7_32, ratio4_7_32, 
+ratio4_7_32, ratio4_7_32, ratio4_7_32, ratio4_7_32, ratio4_7_32, ratio4_7_32, ratio4_7_32, ratio4_7_32, ratio4_7_32, ratio4_7_32, ratio4_7_32, ratio4_7_32, 
+ratio4_7_32, ratio4_7_32, ratio4_7_32, ratio6_7_32, ratio6_7_32, ratio6_7_32, ratio6_7_32, ratio6_7_32, ratio6_7_32, ratio6_7_32, ratio6_7_32, ratio6_7_32, 
+ratio6_7_32, ratio6_7_32, ratio6_7_32, ratio6_7_32, ratio6_7_32, ratio6_7_32, ratio6_7_32, ratio8_7_32, ratio8_7_32, ratio8_7_32, ratio8_7_32, ratio8_7_32, 
+ratio8_7_32, ratio8_7_32, ratio8_7_32, ratio8_7_32, ratio8_7_32, ratio8_7_32, ratio8_7_32, ratio8_7_32, ratio8_7_32, ratio8_7_32, ratio8_7_32, ratio16_7_32, 
+ratio16_7_32, ratio16_7_32, ratio16_7_32, ratio16_7_32, ratio16_7_32, ratio16_7_32, ratio16_7_32, ratio16_7_32, ratio16_7_32, ratio16_7_32, ratio16_7_32, ratio16_7_32, 
+ratio16_7_32, ratio16_7_32, ratio16_7_32, ratio24_7_32, ratio24_7_32, ratio24_7_32, ratio24_7_32, ratio24_7_32, ratio24_7_32, ratio24_7_32, ratio24_7_32, ratio24_7_32, 
+ratio24_7_32, ratio24_7_32, ratio24_7_32, ratio24_7_32, ratio24_7_32, ratio24_7_32, ratio24_7_32}; 
+
+static constexpr uint16_t poly_div_resets7[128] = {ratio1_8_32, ratio1_8_32, ratio1_8_32, ratio1_8_32, ratio1_8_32, ratio1_8_32, ratio1_8_32, ratio1_8_32, ratio1_8_32, ratio1_8_32, ratio1_8_32, ratio1_8_32, ratio1_8_32, 
+ratio1_8_32, ratio1_8_32, ratio1_8_32, ratio1_4_32, ratio1_4_32, ratio1_4_32, ratio1_4_32, ratio1_4_32, ratio1_4_32, ratio1_4_32, ratio1_4_32, ratio1_4_32, 
+ratio1_4_32, ratio1_4_32, ratio1_4_32, ratio1_4_32, ratio1_4_32, ratio1_4_32, ratio1_4_32, ratio3_8_32, ratio3_8_32, ratio3_8_32, ratio3_8_32, ratio3_8_32, 
+ratio3_8_32, ratio3_8_32, ratio3_8_32, ratio3_8_32, ratio3_8_32, ratio3_8_32, ratio3_8_32, ratio3_8_32, ratio3_8_32, ratio3_8_32, ratio3_8_32, ratio1_2_32, 
+ratio1_2_32, ratio1_2_32, ratio1_2_32, ratio1_2_32, ratio1_2_32, ratio1_2_32, ratio1_2_32, ratio1_2_32, ratio1_2_32, ratio1_2_32, ratio1_2_32, ratio1_2_32, 
+ratio1_2_32, ratio1_2_32, ratio1_2_32, ratio3_4_32, ratio3_4_32, ratio3_4_32, ratio3_4_32, ratio3_4_32, ratio3_4_32, ratio3_4_32, ratio3_4_32, ratio3_4_32, 
+ratio3_4_32, ratio3_4_32, ratio3_4_32, ratio3_4_32, ratio3_4_32, ratio3_4_32, ratio3_4_32, ratio1_1_32, ratio1_1_32, ratio1_1_32, ratio1_1_32, ratio1_1_32, 
+ratio1_1_32, ratio1_1_32, ratio1_1_32, ratio1_1_32, ratio1_1_32, ratio1_1_32, ratio1_1_32, ratio1_1_32, ratio1_1_32, ratio1_1_32, ratio1_1_32, ratio2_1_32, 
+ratio2_1_32, ratio2_1_32, ratio2_1_32, ratio2_1_32, ratio2_1_32, ratio2_1_32, ratio2_1_32, ratio2_1_32, ratio2_1_32, ratio2_1_32, ratio2_1_32, ratio2_1_32, 
+ratio2_1_32, ratio2_1_32, ratio2_1_32, ratio3_1_32, ratio3_1_32, ratio3_1_32, ratio3_1_32, ratio3_1_32, ratio3_1_32, ratio3_1_32, ratio3_1_32, ratio3_1_32, 
+ratio3_1_32, ratio3_1_32, ratio3_1_32, ratio3_1_32, ratio3_1_32, ratio3_1_32, ratio3_1_32}; 
+
+
+
+static constexpr const uint16_t * integerRatiosGrid[8] = {integerRatios1, integerRatios2, integerRatios3, integerRatios4, integerRatios5, integerRatios6, integerRatios7, integerRatios8}; 
+
+static constexpr const uint16_t * even_integersGrid[9] = {even_integers0, even_integers1, even_integers2, even_integers3, even_integers4, even_integers5, even_integers6, even_integers7, even_integers8}; 
+
+static constexpr const uint16_t * mult_three_integersGrid[8] = {mult_three_integers0, mult_three_integers1, mult_three_integers2, mult_three_integers3, mult_three_integers4, mult_three_integers5, mult_three_integers6, mult_three_integers7}; 
+
+static constexpr const uint16_t * odd_integersGrid[9] = {odd_integers0, odd_integers1, odd_integers2, odd_integers3, odd_integers4, odd_integers5, odd_integers6, odd_integers7, odd_integers8}; 
+
+static constexpr const uint16_t * modal_tetradsGrid[8] = {modal_tetradsainversion_walk, modal_tetradsbinversion_walk, modal_tetradinversion_walk, modal_tetradsdinversion_walk, modal_tetradseinversion_walk, modal_tetradsfinversion_walk, modal_tetradsginversion_walk, modal_tetradshinversion_walk}; 
+
+static constexpr const uint16_t * seventhTetradsMinimalProgressionGrid[8] = {a_maj7thinversion_walk, a_maj7th2ndIninversion_walk, b_dom7thinversion_walk, b_dom7thRotateinversion_walk, c_subDom7thinversion_walk, c_subDom7thRotateinversion_walk, min7thinversion_walk, min7th2ndIninversion_walk}; 
+
+static constexpr const uint16_t * impressionistGrid[8] = {impressionista_vs_impressionistb, impressionist_vs_impressionistd, impressioniste_vs_impressionistf, impressionistg_vs_impressionisth, impressionisti_vs_impressionistj, impressionistk_vs_impressionistl, impressionistm_vs_impressionistn, impressionisto_vs_impressionistp}; 
+
+static constexpr const uint16_t * bohlenPeirceGrid[8] = {bohlenPeirceAScale_vs_bohlenPeirceBlueLambda, bohlenPeirceBlueLambda2_vs_bohlenPeirceDurI, bohlenPeirceDurII_vs_bohlenPeirceGLambda, bohlenPeirceGamma_vs_bohlenPeirceHPentatoni, bohlenPeirceHarmoni_vs_bohlenPeirceMollI, bohlenPeirceMollII_vs_bohlenPeirceProoijenMaj, bohlenPeirceProoijenMin_vs_bohlenPeirceWalkerA, bohlenPeirceWalkerB_vs_bohlenPeirceWalkerI}; 
+
+static constexpr const uint16_t * modesofrootGrid[8] = {modesofroota, modesofrootb, modesofrootc, modesofrootd, modesofroote, modesofrootf, modesofrootg, modesofrooth}; 
+
+static constexpr const uint16_t * tetrad_inversionsGrid[16] = {tetrad_inversionsa, tetrad_inversionsb, tetrad_inversionsc, tetrad_inversionsd, tetrad_inversionse, tetrad_inversionsf, tetrad_inversionsg, tetrad_inversionsh, tetrad_inversionsi, tetrad_inversionsj, tetrad_inversionsk, tetrad_inversionsl, tetrad_inversionsm, tetrad_inversionsn, tetrad_inversionso, tetrad_inversionsp}; 
+
+static constexpr const uint16_t * harmonic_entropyGrid[8] = {harmonic_entropyA, harmonic_entropyB, harmonic_entropyC, harmonic_entropyD, harmonic_entropyE, harmonic_entropyF, harmonic_entropyG, harmonic_entropyH}; 
+
+static constexpr const uint16_t * bohlenPeircevoctGrid[8] = {bohlenPeirceAScalevoct, bohlenPeirceBlueLambdavoct, bohlenPeirceDurIvoct, bohlenPeirceGammavoct, bohlenPeirceHarmonicvoct, bohlenPeirceMollIvoct, bohlenPeirceProoijenMinvoct, bohlenPeirceWalkerBvoct}; 
+
+static constexpr const uint16_t * rhythm_integersGrid[9] = {rhythm_integers0, rhythm_integers1, rhythm_integers2, rhythm_integers3, rhythm_integers4, rhythm_integers5, rhythm_integers6, rhythm_integers7, rhythm_integers8}; 
+
+static constexpr const uint16_t * no_tripletsGrid[8] = {no_triplets0, no_triplets1, no_triplets2, no_triplets3, no_triplets4, no_triplets5, no_triplets6, no_triplets7}; 
+
+static constexpr const uint16_t * tripletsGrid[8] = {triplets0, triplets1, triplets2, triplets3, triplets4, triplets5, triplets6, triplets7}; 
+
+static constexpr const uint16_t * poly_div_resetsGrid[8] = {poly_div_resets0, poly_div_resets1, poly_div_resets2, poly_div_resets3, poly_div_resets4, poly_div_resets5, poly_div_resets6, poly_div_resets7}; 
+
+
+
+/// Every built in scale, as X(name, t2Bitshift, oneVoltOct), defined from its nameGrid rows.
+#define SYNC_SCALES(X) \
+	X(integerRatios, 9, 0) \
+	X(even_integers, 9, 0) \
+	X(mult_three_integers, 9, 0) \
+	X(odd_integers, 9, 0) \
+	X(modal_tetrads, 9, 0) \
+	X(seventhTetradsMinimalProgression, 9, 0) \
+	X(impressionist, 9, 0) \
+	X(bohlenPeirce, 9, 0) \
+	X(modesofroot, 9, 1) \
+	X(tetrad_inversions, 8, 1) \
+	X(harmonic_entropy, 9, 1) \
+	X(bohlenPeircevoct, 9, 0) \
+	X(rhythm_integers, 9, 0) \
+	X(no_triplets, 9, 0) \
+	X(triplets, 9, 0) \
+	X(poly_div_resets, 9, 0)
 
-static const ScaleNote ratio144_5 = {1887436, 3435973837, 5};
-static const ScaleNote ratio13_8 = {106496, 0, 8};
-static const ScaleNote ratio21_1 = {1376256, 0, 1};
-static const ScaleNote ratio27_64 = {27648, 0, 64};
-static const ScaleNote ratio9_28 = {21065, 613566756, 28};
-static const ScaleNote ratio27_128 = {13824, 0, 128};
-static const ScaleNote ratio8_3_16 = {174762, 2863311530, 16};
-static const ScaleNote ratio7_2 = {229376, 0, 2};
-static const ScaleNote ratio32_9 = {233016, 3817748707, 9};
-static const ScaleNote ratio20_1 = {1310720, 0, 1};
-static const ScaleNote ratio4_1_4 = {262144, 0, 4};
-static const ScaleNote ratio25_243 = {6742, 1661427678, 243};
-static const ScaleNote ratio7_13 = {35288, 2643056797, 13};
-static const ScaleNote ratio17_16 = {69632, 0, 16};
-static const ScaleNote ratio13_9 = {94663, 477218588, 9};
-static const ScaleNote ratio13_256 = {3328, 0, 256};
-static const ScaleNote ratio5_64 = {5120, 0, 64};
-static const ScaleNote ratio9_2 = {294912, 0, 2};
-static const ScaleNote ratio1_36 = {1820, 1908874353, 36};
-static const ScaleNote ratio2_1_8 = {131072, 0, 8};
-static const ScaleNote ratio4_1_16 = {262144, 0, 16};
-static const ScaleNote ratio19_512 = {2432, 0, 512};
-static const ScaleNote ratio18_7 = {168521, 613566756, 7};
-static const ScaleNote ratio1_1_32 = {65536, 0, 32};
-static const ScaleNote ratio1_2 = {32768, 0, 2};
-static const ScaleNote ratio5_81 = {4045, 1855850066, 81};
-static const ScaleNote ratio2_3_8 = {43690, 2863311530, 8};
-static const ScaleNote ratio1_2_4 = {32768, 0, 4};
-static const ScaleNote ratio5_7 = {46811, 1840700269, 7};
-static const ScaleNote ratio1_7_32 = {9362, 1227133513, 32};
-static const ScaleNote ratio5_63 = {5201, 1158959429, 63};
-static const ScaleNote ratio75_49 = {100310, 876523937, 49};
-static const ScaleNote ratio6_5_16 = {78643, 858993459, 16};
-static const ScaleNote ratio3_4_32 = {49152, 0, 32};
-static const ScaleNote ratio15_16 = {61440, 0, 16};
-static const ScaleNote ratio9_1 = {589824, 0, 1};
-static const ScaleNote ratio5_144 = {2275, 2386092942, 144};
-static const ScaleNote ratio5_14 = {23405, 3067833782, 14};
-static const ScaleNote ratio10_9 = {72817, 3340530119, 9};
-static const ScaleNote ratio1_1_4 = {65536, 0, 4};
-static const ScaleNote ratio8_5_16 = {104857, 2576980377, 16};
-static const ScaleNote ratio17_9 = {123790, 954437176, 9};
-static const ScaleNote ratio11_28 = {25746, 1227133513, 28};
-static const ScaleNote ratio9_17 = {34695, 2273806215, 17};
-static const ScaleNote ratio6_7_32 = {56173, 3067833782, 32};
-static const ScaleNote ratio3_4 = {49152, 0, 4};
-static const ScaleNote ratio25_21 = {78019, 204522252, 21};
-static const ScaleNote ratio9_80 = {7372, 3435973836, 80};
-static const ScaleNote ratio56_5 = {734003, 858993459, 5};
-static const ScaleNote ratio96_5 = {1258291, 858993459, 5};
-static const ScaleNote ratio9_224 = {2633, 613566756, 224};
-static const ScaleNote ratio3_1_4 = {196608, 0, 4};
-static const ScaleNote ratio13_3 = {283989, 1431655765, 3};
-static const ScaleNote ratio28_5 = {367001, 2576980377, 5};
-static const ScaleNote ratio27_5 = {353894, 1717986918, 5};
-static const ScaleNote ratio7_256 = {1792, 0, 256};
-static const ScaleNote ratio3_5_16 = {39321, 2576980377, 16};
-static const ScaleNote ratio9_16 = {36864, 0, 16};
-static const ScaleNote ratio13_2 = {425984, 0, 2};
-static const ScaleNote ratio5_189 = {1733, 3249631340, 189};
-static const ScaleNote ratio25_729 = {2247, 1985464991, 729};
-static const ScaleNote ratio5_192 = {1706, 2863311530, 192};
-static const ScaleNote ratio49_75 = {42816, 3665038759, 75};
-static const ScaleNote ratio88_7 = {823881, 613566756, 7};
-static const ScaleNote ratio1_8 = {8192, 0, 8};
-static const ScaleNote ratio1_16 = {4096, 0, 16};
-static const ScaleNote ratio2_5_16 = {26214, 1717986918, 16};
-static const ScaleNote ratio4_5 = {52428, 3435973836, 5};
-static const ScaleNote ratio1_15 = {4369, 286331153, 15};
-static const ScaleNote ratio5_128 = {2560, 0, 128};
-static const ScaleNote ratio17_2 = {557056, 0, 2};
-static const ScaleNote ratio3_2_4 = {98304, 0, 4};
-static const ScaleNote ratio3_80 = {2457, 2576980377, 80};
-static const ScaleNote ratio2_1_32 = {131072, 0, 32};
-static const ScaleNote ratio7_8 = {57344, 0, 8};
-static const ScaleNote ratio4_7_32 = {37449, 613566756, 32};
-static const ScaleNote ratio25_1 = {1638400, 0, 1};
-static const ScaleNote ratio14_1 = {917504, 0, 1};
-static const ScaleNote ratio135_7 = {1263908, 2454267026, 7};
-static const ScaleNote ratio75_7 = {702171, 1840700269, 7};
-static const ScaleNote ratio30_1 = {1966080, 0, 1};
-static const ScaleNote ratio7_27 = {16990, 3499602981, 27};
-static const ScaleNote ratio11_16 = {45056, 0, 16};
-static const ScaleNote ratio27_7 = {252781, 3067833782, 7};
-static const ScaleNote ratio25_189 = {8668, 3363254813, 189};
-static const ScaleNote ratio10_7 = {93622, 3681400539, 7};
-static const ScaleNote ratio13_17 = {50115, 3284386755, 17};
-static const ScaleNote ratio81_7 = {758345, 613566756, 7};
-static const ScaleNote ratio7_20 = {22937, 2576980377, 20};
-static const ScaleNote ratio3_40 = {4915, 858993459, 40};
-static const ScaleNote ratio8_7_32 = {74898, 1227133513, 32};
-static const ScaleNote ratio18_1 = {1179648, 0, 1};
-static const ScaleNote ratio135_4 = {2211840, 0, 4};
-static const ScaleNote ratio11_17 = {42405, 2779096485, 17};
-static const ScaleNote ratio3_8 = {24576, 0, 8};
-static const ScaleNote ratio81_5 = {1061683, 858993459, 5};
-static const ScaleNote ratio4_3 = {87381, 1431655765, 3};
-static const ScaleNote ratio4_3_16 = {87381, 1431655765, 16};
-static const ScaleNote ratio7_9 = {50972, 1908874353, 9};
-static const ScaleNote ratio3_56 = {3510, 3681400539, 56};
-static const ScaleNote ratio5_108 = {3034, 318145725, 108};
-static const ScaleNote ratio1_1 = {65536, 0, 1};
-static const ScaleNote ratio9_4 = {147456, 0, 4};
-static const ScaleNote ratio15_4 = {245760, 0, 4};
-static const ScaleNote ratio27_256 = {6912, 0, 256};
-static const ScaleNote ratio1_3_8 = {21845, 1431655765, 8};
-static const ScaleNote ratio7_45 = {10194, 2099761789, 45};
-static const ScaleNote ratio19_128 = {9728, 0, 128};
-static const ScaleNote ratio80_3 = {1747626, 2863311531, 3};
-static const ScaleNote ratio81_25 = {212336, 2748779069, 25};
-static const ScaleNote ratio19_1 = {1245184, 0, 1};
-static const ScaleNote ratio11_1 = {720896, 0, 1};
-static const ScaleNote ratio9_64 = {9216, 0, 64};
-static const ScaleNote ratio128_5 = {1677721, 2576980378, 5};
-static const ScaleNote ratio72_25 = {188743, 2920577761, 25};
-static const ScaleNote ratio7_15 = {30583, 2004318071, 15};
-static const ScaleNote ratio27_1024 = {1728, 0, 1024};
-static const ScaleNote ratio25_3 = {546133, 1431655765, 3};
-static const ScaleNote ratio16_1 = {1048576, 0, 1};
-static const ScaleNote ratio27_32 = {55296, 0, 32};
-static const ScaleNote ratio8_1_8 = {524288, 0, 8};
-static const ScaleNote ratio3_2_8 = {98304, 0, 8};
-static const ScaleNote ratio16_7_32 = {149796, 2454267026, 32};
-static const ScaleNote ratio1_24 = {2730, 2863311530, 24};
-static const ScaleNote ratio6_5 = {78643, 858993459, 5};
-static const ScaleNote ratio3_64 = {3072, 0, 64};
-static const ScaleNote ratio27_512 = {3456, 0, 512};
-static const ScaleNote ratio3_14 = {14043, 1840700269, 14};
-static const ScaleNote ratio7_10 = {45875, 858993459, 10};
-static const ScaleNote ratio8_5 = {104857, 2576980377, 5};
-static const ScaleNote ratio7_75 = {6116, 2977843991, 75};
-static const ScaleNote ratio63_25 = {165150, 3092376453, 25};
-static const ScaleNote ratio16_5_16 = {209715, 858993459, 16};
-static const ScaleNote ratio11_32 = {22528, 0, 32};
-static const ScaleNote ratio7_1 = {458752, 0, 1};
-static const ScaleNote ratio45_7 = {421302, 3681400539, 7};
-static const ScaleNote ratio3_1_32 = {196608, 0, 32};
-static const ScaleNote ratio1_4_8 = {16384, 0, 8};
-static const ScaleNote ratio63_5 = {825753, 2576980377, 5};
-static const ScaleNote ratio5_4 = {81920, 0, 4};
-static const ScaleNote ratio80_9 = {582542, 954437177, 9};
-static const ScaleNote ratio22_1 = {1441792, 0, 1};
-static const ScaleNote ratio11_56 = {12873, 613566756, 56};
-static const ScaleNote ratio13_1 = {851968, 0, 1};
-static const ScaleNote ratio1_4 = {16384, 0, 4};
-static const ScaleNote ratio112_5 = {1468006, 1717986918, 5};
-static const ScaleNote ratio5_72 = {4551, 477218588, 72};
-static const ScaleNote ratio5_32 = {10240, 0, 32};
-static const ScaleNote ratio19_2 = {622592, 0, 2};
-static const ScaleNote ratio5_12 = {27306, 2863311530, 12};
-static const ScaleNote ratio9_160 = {3686, 1717986918, 160};
-static const ScaleNote ratio13_16 = {53248, 0, 16};
-static const ScaleNote ratio12_7 = {112347, 1840700269, 7};
-static const ScaleNote ratio11_8 = {90112, 0, 8};
-static const ScaleNote ratio6_1 = {393216, 0, 1};
-static const ScaleNote ratio3_4_8 = {49152, 0, 8};
-static const ScaleNote ratio3_28 = {7021, 3067833782, 28};
-static const ScaleNote ratio5_36 = {9102, 954437176, 36};
-static const ScaleNote ratio5_112 = {2925, 3067833782, 112};
-static const ScaleNote ratio3_16 = {12288, 0, 16};
-static const ScaleNote ratio7_80 = {5734, 1717986918, 80};
-static const ScaleNote ratio25_567 = {2889, 2552740703, 567};
-static const ScaleNote ratio45_1 = {2949120, 0, 1};
-static const ScaleNote ratio15_512 = {1920, 0, 512};
-static const ScaleNote ratio20_7 = {187245, 3067833782, 7};
-static const ScaleNote ratio27_16 = {110592, 0, 16};
-static const ScaleNote ratio3_7 = {28086, 3681400539, 7};
-static const ScaleNote ratio3_2 = {98304, 0, 2};
-static const ScaleNote ratio7_128 = {3584, 0, 128};
-static const ScaleNote ratio12_5 = {157286, 1717986918, 5};
-static const ScaleNote ratio3_8_32 = {24576, 0, 32};
-static const ScaleNote ratio5_96 = {3413, 1431655765, 96};
-static const ScaleNote ratio49_25 = {128450, 2405181685, 25};
-static const ScaleNote ratio24_5_16 = {314572, 3435973836, 16};
-static const ScaleNote ratio25_63 = {26006, 1499829849, 63};
-static const ScaleNote ratio5_56 = {5851, 1840700269, 56};
-static const ScaleNote ratio2_3 = {43690, 2863311530, 3};
-static const ScaleNote ratio5_18 = {18204, 1908874353, 18};
-static const ScaleNote ratio9_5 = {117964, 3435973836, 5};
-static const ScaleNote ratio1_1_16 = {65536, 0, 16};
-static const ScaleNote ratio1_9 = {7281, 3340530119, 9};
-static const ScaleNote ratio2_5 = {26214, 1717986918, 5};
-static const ScaleNote ratio2_1 = {131072, 0, 1};
-static const ScaleNote ratio25_9 = {182044, 1908874353, 9};
-static const ScaleNote ratio48_5 = {629145, 2576980377, 5};
-static const ScaleNote ratio1_6 = {10922, 2863311530, 6};
-static const ScaleNote ratio9_14 = {42130, 1227133513, 14};
-static const ScaleNote ratio15_128 = {7680, 0, 128};
-static const ScaleNote ratio9_112 = {5266, 1227133513, 112};
-static const ScaleNote ratio7_160 = {2867, 858993459, 160};
-static const ScaleNote ratio5_16 = {20480, 0, 16};
-static const ScaleNote ratio7_243 = {1887, 3729374894, 243};
-static const ScaleNote ratio3_11 = {17873, 1952257861, 11};
-static const ScaleNote ratio5_11 = {29789, 390451572, 11};
-static const ScaleNote ratio225_49 = {300930, 2629571814, 49};
-static const ScaleNote ratio4_3_8 = {87381, 1431655765, 8};
-static const ScaleNote ratio8_7 = {74898, 1227133513, 7};
-static const ScaleNote ratio1_2_32 = {32768, 0, 32};
-static const ScaleNote ratio7_25 = {18350, 343597383, 25};
-static const ScaleNote ratio192_5 = {2516582, 1717986918, 5};
-static const ScaleNote ratio11_14 = {51492, 2454267026, 14};
-static const ScaleNote ratio40_7 = {374491, 1840700269, 7};
-static const ScaleNote ratio25_49 = {33436, 3155486176, 49};
-static const ScaleNote ratio9_10 = {58982, 1717986918, 10};
-static const ScaleNote ratio27_25 = {70778, 3779571220, 25};
-static const ScaleNote ratio320_9 = {2330168, 3817748708, 9};
-static const ScaleNote ratio25_7 = {234057, 613566756, 7};
-static const ScaleNote ratio11_112 = {6436, 2454267026, 112};
-static const ScaleNote ratio8_3 = {174762, 2863311530, 3};
-static const ScaleNote ratio20_3 = {436906, 2863311530, 3};
-static const ScaleNote ratio17_7 = {159158, 3681400539, 7};
-static const ScaleNote ratio15_11 = {89367, 1171354717, 11};
-static const ScaleNote ratio17_128 = {8704, 0, 128};
-static const ScaleNote ratio13_15 = {56797, 3722304989, 15};
-static const ScaleNote ratio160_9 = {1165084, 1908874354, 9};
-static const ScaleNote ratio24_1_4 = {1572864, 0, 4};
-static const ScaleNote ratio24_7 = {224694, 3681400539, 7};
-static const ScaleNote ratio44_7 = {411940, 2454267026, 7};
-static const ScaleNote ratio25_81 = {20227, 689315738, 81};
-static const ScaleNote ratio1_5 = {13107, 858993459, 5};
-static const ScaleNote ratio1_8_32 = {8192, 0, 32};
-static const ScaleNote ratio18_5 = {235929, 2576980377, 5};
-static const ScaleNote ratio9_20 = {29491, 858993459, 20};
-static const ScaleNote ratio22_7 = {205970, 1227133513, 7};
-static const ScaleNote ratio9_128 = {4608, 0, 128};
-static const ScaleNote ratio13_7 = {121709, 3067833782, 7};
-static const ScaleNote ratio15_13 = {75618, 1982292598, 13};
-static const ScaleNote ratio16_3_8 = {349525, 1431655765, 8};
-static const ScaleNote ratio32_1 = {2097152, 0, 1};
-static const ScaleNote ratio9_320 = {1843, 858993459, 320};
-static const ScaleNote ratio11_224 = {3218, 1227133513, 224};
-static const ScaleNote ratio3_112 = {1755, 1840700269, 112};
-static const ScaleNote ratio6_1_4 = {393216, 0, 4};
-static const ScaleNote ratio5_17 = {19275, 1263225675, 17};
-static const ScaleNote ratio24_1 = {1572864, 0, 1};
-static const ScaleNote ratio15_2 = {491520, 0, 2};
-static const ScaleNote ratio2_9 = {14563, 2386092942, 9};
-static const ScaleNote ratio11_9 = {80099, 2386092942, 9};
-static const ScaleNote ratio15_1 = {983040, 0, 1};
-static const ScaleNote ratio2_7 = {18724, 2454267026, 7};
-static const ScaleNote ratio5_48 = {6826, 2863311530, 48};
-static const ScaleNote ratio3_5 = {39321, 2576980377, 5};
-static const ScaleNote ratio17_8 = {139264, 0, 8};
-static const ScaleNote ratio2025_49 = {2708375, 2191309844, 49};
-static const ScaleNote ratio1_12 = {5461, 1431655765, 12};
-static const ScaleNote ratio5_9 = {36408, 3817748707, 9};
-static const ScaleNote ratio34_1 = {2228224, 0, 1};
-static const ScaleNote ratio1_3_16 = {21845, 1431655765, 16};
-static const ScaleNote ratio21_5 = {275251, 858993459, 5};
-static const ScaleNote ratio49_675 = {4757, 1838882294, 675};
-static const ScaleNote ratio25_18 = {91022, 954437176, 18};
-static const ScaleNote ratio1_5_16 = {13107, 858993459, 16};
-static const ScaleNote ratio4_7 = {37449, 613566756, 7};
-static const ScaleNote ratio8_9 = {58254, 954437176, 9};
-static const ScaleNote ratio11_4 = {180224, 0, 4};
-static const ScaleNote ratio9_11 = {53620, 1561806289, 11};
-static const ScaleNote ratio1_48 = {1365, 1431655765, 48};
-static const ScaleNote ratio1_21 = {3120, 3272356035, 21};
-static const ScaleNote ratio1_3 = {21845, 1431655765, 3};
-static const ScaleNote ratio19_64 = {19456, 0, 64};
-static const ScaleNote ratio5_1 = {327680, 0, 1};
-static const ScaleNote ratio13_128 = {6656, 0, 128};
-static const ScaleNote ratio5_13 = {25206, 660764199, 13};
-static const ScaleNote ratio1_32 = {2048, 0, 32};
-static const ScaleNote ratio3_128 = {1536, 0, 128};
-static const ScaleNote ratio25_441 = {3715, 827828163, 441};
-static const ScaleNote ratio6_1_8 = {393216, 0, 8};
-static const ScaleNote ratio21_25 = {55050, 1030792151, 25};
-static const ScaleNote ratio11_13 = {55453, 2312674697, 13};
-static const ScaleNote ratio11_64 = {11264, 0, 64};
-static const ScaleNote ratio24_5 = {314572, 3435973836, 5};
-static const ScaleNote ratio8_3_8 = {174762, 2863311530, 8};
-static const ScaleNote ratio16_1_4 = {1048576, 0, 4};
-static const ScaleNote ratio4_9 = {29127, 477218588, 9};
-static const ScaleNote ratio1_18 = {3640, 3817748707, 18};
-static const ScaleNote ratio8_1_4 = {524288, 0, 4};
-static const ScaleNote ratio128_9 = {932067, 2386092942, 9};
-static const ScaleNote ratio36_1 = {2359296, 0, 1};
-static const ScaleNote ratio28_1 = {1835008, 0, 1};
-static const ScaleNote ratio7_135 = {3398, 699920596, 135};
-static const ScaleNote ratio147_25 = {385351, 2920577761, 25};
-static const ScaleNote ratio567_25 = {1486356, 2061584302, 25};
-static const ScaleNote ratio7_11 = {41704, 3123612578, 11};
-static const ScaleNote ratio72_7 = {674084, 2454267026, 7};
-static const ScaleNote ratio27_1 = {1769472, 0, 1};
-static const ScaleNote ratio5_8 = {40960, 0, 8};
-static const ScaleNote ratio1_20 = {3276, 3435973836, 20};
-static const ScaleNote ratio225_7 = {2106514, 1227133514, 7};
-static const ScaleNote ratio441_25 = {1156055, 171798692, 25};
-static const ScaleNote ratio17_64 = {17408, 0, 64};
-static const ScaleNote ratio192_7 = {1797558, 3681400539, 7};
-static const ScaleNote ratio7_16 = {28672, 0, 16};
-static const ScaleNote ratio189_25 = {495452, 687194767, 25};
-static const ScaleNote ratio16_3 = {349525, 1431655765, 3};
-static const ScaleNote ratio36_5 = {471859, 858993459, 5};
-static const ScaleNote ratio14_5 = {183500, 3435973836, 5};
-static const ScaleNote ratio3_20 = {9830, 1717986918, 20};
-static const ScaleNote ratio96_7 = {898779, 1840700269, 7};
-static const ScaleNote ratio26_1 = {1703936, 0, 1};
-static const ScaleNote ratio7_5 = {91750, 1717986918, 5};
-static const ScaleNote ratio15_7 = {140434, 1227133513, 7};
-static const ScaleNote ratio3_32 = {6144, 0, 32};
-static const ScaleNote ratio36_7 = {337042, 1227133513, 7};
-static const ScaleNote ratio5_6 = {54613, 1431655765, 6};
-static const ScaleNote ratio27_8 = {221184, 0, 8};
-static const ScaleNote ratio20_9 = {145635, 2386092942, 9};
-static const ScaleNote ratio15_17 = {57825, 3789677025, 17};
-static const ScaleNote ratio1_25 = {2621, 1889785610, 25};
-static const ScaleNote ratio13_32 = {26624, 0, 32};
-static const ScaleNote ratio9_40 = {14745, 2576980377, 40};
-static const ScaleNote ratio32_5 = {419430, 1717986918, 5};
-static const ScaleNote ratio12_1 = {786432, 0, 1};
-static const ScaleNote ratio13_512 = {1664, 0, 512};
-static const ScaleNote ratio9_56 = {10532, 2454267026, 56};
-static const ScaleNote ratio80_7 = {748982, 3681400539, 7};
-static const ScaleNote ratio15_64 = {15360, 0, 64};
-static const ScaleNote ratio24_7_32 = {224694, 3681400539, 32};
-static const ScaleNote ratio17_5 = {222822, 1717986918, 5};
-static const ScaleNote ratio27_2 = {884736, 0, 2};
-static const ScaleNote ratio9_8 = {73728, 0, 8};
-static const ScaleNote ratio1_2_16 = {32768, 0, 16};
-static const ScaleNote ratio3_7_32 = {28086, 3681400539, 32};
-static const ScaleNote ratio7_3 = {152917, 1431655765, 3};
-static const ScaleNote ratio9_25 = {23592, 4123168604, 25};
-static const ScaleNote ratio40_3 = {873813, 1431655765, 3};
-static const ScaleNote ratio9_7 = {84260, 2454267026, 7};
-static const ScaleNote ratio1_6_16 = {10922, 2863311530, 16};
-static const ScaleNote ratio5_24 = {13653, 1431655765, 24};
-static const ScaleNote ratio4_1 = {262144, 0, 1};
-static const ScaleNote ratio17_1 = {1114112, 0, 1};
-static const ScaleNote ratio38_1 = {2490368, 0, 1};
-static const ScaleNote ratio1_17 = {3855, 252645135, 17};
-static const ScaleNote ratio16_9 = {116508, 1908874353, 9};
-static const ScaleNote ratio19_4 = {311296, 0, 4};
-static const ScaleNote ratio10_1 = {655360, 0, 1};
-static const ScaleNote ratio8_1 = {524288, 0, 1};
-static const ScaleNote ratio7_17 = {26985, 1768515945, 17};
-static const ScaleNote ratio17_11 = {101282, 3904515723, 11};
-static const ScaleNote ratio7_4 = {114688, 0, 4};
-static const ScaleNote ratio25_27 = {60681, 2067947216, 27};
-static const ScaleNote ratio4_5_16 = {52428, 3435973836, 16};
-static const ScaleNote ratio17_3 = {371370, 2863311530, 3};
-static const ScaleNote ratio189_5 = {2477260, 3435973836, 5};
-static const ScaleNote ratio2_7_32 = {18724, 2454267026, 32};
-static const ScaleNote ratio15_8 = {122880, 0, 8};
-static const ScaleNote ratio256_9 = {1864135, 477218588, 9};
-static const ScaleNote ratio5_3 = {109226, 2863311530, 3};
-static const ScaleNote ratio7_64 = {7168, 0, 64};
-static const ScaleNote ratio49_2025 = {1585, 3476272295, 2025};
-static const ScaleNote ratio11_256 = {2816, 0, 256};
-static const ScaleNote ratio45_4 = {737280, 0, 4};
-static const ScaleNote ratio7_81 = {5663, 2598190092, 81};
-static const ScaleNote ratio36_25 = {94371, 3607772528, 25};
-static const ScaleNote ratio2_1_4 = {131072, 0, 4};
-static const ScaleNote ratio7_225 = {2038, 3855926194, 225};
-static const ScaleNote ratio3_1 = {196608, 0, 1};
-static const ScaleNote ratio11_5 = {144179, 858993459, 5};
-static const ScaleNote ratio17_4 = {278528, 0, 4};
-static const ScaleNote ratio9_256 = {2304, 0, 256};
-static const ScaleNote ratio17_32 = {34816, 0, 32};
-static const ScaleNote ratio144_7 = {1348169, 613566757, 7};
-static const ScaleNote ratio6_7 = {56173, 3067833782, 7};
-static const ScaleNote ratio19_32 = {38912, 0, 32};
-static const ScaleNote ratio40_9 = {291271, 477218588, 9};
-static const ScaleNote ratio49_225 = {14272, 1221679586, 225};
-static const ScaleNote ratio1_14 = {4681, 613566756, 14};
-static const ScaleNote ratio27_4 = {442368, 0, 4};
-static const ScaleNote ratio11_3 = {240298, 2863311530, 3};
-static const ScaleNote ratio10_3 = {218453, 1431655765, 3};
-static const ScaleNote ratio7_40 = {11468, 3435973836, 40};
-static const ScaleNote ratio16_5 = {209715, 858993459, 5};
-static const ScaleNote ratio7_6 = {76458, 2863311530, 6};
-static const ScaleNote ratio3_25 = {7864, 1374389534, 25};
-static const ScaleNote ratio243_25 = {637009, 3951369912, 25};
-static const ScaleNote ratio25_147 = {11145, 2483484490, 147};
-static const ScaleNote ratio11_15 = {48059, 3149642683, 15};
-static const ScaleNote ratio19_8 = {155648, 0, 8};
-static const ScaleNote ratio72_5 = {943718, 1717986918, 5};
-static const ScaleNote ratio17_15 = {74274, 572662306, 15};
-static const ScaleNote ratio176_7 = {1647762, 1227133513, 7};
-static const ScaleNote ratio64_3 = {1398101, 1431655765, 3};
-static const ScaleNote ratio40_1 = {2621440, 0, 1};
-static const ScaleNote ratio5_2 = {163840, 0, 2};
-static const ScaleNote ratio13_11 = {77451, 2733161006, 11};
-static const ScaleNote ratio13_5 = {170393, 2576980377, 5};
-static const ScaleNote ratio1_40 = {1638, 1717986918, 40};
-static const ScaleNote ratio160_7 = {1497965, 3067833783, 7};
-static const ScaleNote ratio19_256 = {4864, 0, 256};
-static const ScaleNote ratio11_7 = {102985, 613566756, 7};
-static const ScaleNote ratio3_13 = {15123, 2973438897, 13};
-static const ScaleNote ratio1_4_32 = {16384, 0, 32};
-static const ScaleNote ratio48_7 = {449389, 3067833782, 7};
-static const ScaleNote ratio9_13 = {45371, 330382099, 13};
-static const ScaleNote ratio15_32 = {30720, 0, 32};
-static const ScaleNote ratio19_16 = {77824, 0, 16};
-static const ScaleNote ratio5_21 = {15603, 3476878287, 21};
-static const ScaleNote ratio5_28 = {11702, 3681400539, 28};
-static const ScaleNote ratio243_7 = {2275035, 1840700270, 7};
-static const ScaleNote ratio11_128 = {5632, 0, 128};
-static const ScaleNote ratio12_1_4 = {786432, 0, 4};
-static const ScaleNote ratio13_64 = {13312, 0, 64};
-static const ScaleNote ratio1_10 = {6553, 2576980377, 10};
-static const ScaleNote ratio9_32 = {18432, 0, 32};
-static const ScaleNote ratio1_13 = {5041, 991146299, 13};
-static const ScaleNote ratio1_2_8 = {32768, 0, 8};
-static const ScaleNote ratio675_49 = {902791, 3593748145, 49};
-static const ScaleNote ratio3_17 = {11565, 757935405, 17};
-static const ScaleNote ratio64_9 = {466033, 3340530119, 9};
-static const ScaleNote ratio1_11 = {5957, 3514064151, 11};
-static const ScaleNote ratio1_7 = {9362, 1227133513, 7};
-static const ScaleNote ratio7_32 = {14336, 0, 32};
-static const ScaleNote ratio3_10 = {19660, 3435973836, 10};
-static const ScaleNote ratio128_3 = {2796202, 2863311530, 3};
-static const ScaleNote ratio1_1_8 = {65536, 0, 8};
-static const ScaleNote ratio64_5 = {838860, 3435973837, 5};
-static const ScaleNote ratio5_27 = {12136, 1272582902, 27};
-static const ScaleNote ratio11_2 = {360448, 0, 2};
-static const ScaleNote ratio2_3_16 = {43690, 2863311530, 16};
-static const ScaleNote ratio15_256 = {3840, 0, 256};
-static const ScaleNote ratio17_13 = {85700, 3964585196, 13};
-static const ScaleNote ratio17_256 = {4352, 0, 256};
-static const ScaleNote ratio13_4 = {212992, 0, 4};
-static const ScaleNote ratio32_3 = {699050, 2863311530, 3};
-static const ScaleNote ratio17_512 = {2176, 0, 512};
-static const ScaleNote ratio1_27 = {2427, 1113510039, 27};
-static const ScaleNote ratio729_25 = {1911029, 3264175145, 25};
-static const ScaleNote ratio4_1_8 = {262144, 0, 8};
-
-
-
-static const ScaleNote * const integerRatios1[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, 
-&ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio7_1, 
-&ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, 
-&ratio7_1, &ratio7_1, &ratio7_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, 
-&ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1}; 
-
-static const ScaleNote * const integerRatios2[128] = {&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, 
-&ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio7_2, 
-&ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, 
-&ratio7_2, &ratio7_2, &ratio7_2, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1}; 
-
-static const ScaleNote * const integerRatios3[128] = {&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio7_3, 
-&ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, 
-&ratio7_3, &ratio7_3, &ratio7_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3}; 
-
-static const ScaleNote * const integerRatios4[128] = {&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, 
-&ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio7_4, 
-&ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, 
-&ratio7_4, &ratio7_4, &ratio7_4, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1}; 
-
-static const ScaleNote * const integerRatios5[128] = {&ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, 
-&ratio1_5, &ratio1_5, &ratio1_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, 
-&ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, 
-&ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio4_5, 
-&ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, 
-&ratio4_5, &ratio4_5, &ratio4_5, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, 
-&ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio7_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5}; 
-
-static const ScaleNote * const integerRatios6[128] = {&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, 
-&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, 
-&ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio7_6, 
-&ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, 
-&ratio7_6, &ratio7_6, &ratio7_6, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3}; 
-
-static const ScaleNote * const integerRatios7[128] = {&ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, 
-&ratio1_7, &ratio1_7, &ratio1_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, 
-&ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, 
-&ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio4_7, 
-&ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, 
-&ratio4_7, &ratio4_7, &ratio4_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, 
-&ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, 
-&ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, 
-&ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7}; 
-
-static const ScaleNote * const integerRatios8[128] = {&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, 
-&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, 
-&ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio7_8, 
-&ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, 
-&ratio7_8, &ratio7_8, &ratio7_8, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-
-
-static const ScaleNote * const even_integers0[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, 
-&ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio10_1, 
-&ratio10_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio10_1, 
-&ratio10_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio12_1, &ratio12_1, &ratio12_1, &ratio14_1, &ratio14_1, &ratio14_1, &ratio14_1, &ratio14_1, &ratio14_1, &ratio14_1, &ratio14_1, &ratio14_1, 
-&ratio14_1, &ratio14_1, &ratio14_1, &ratio14_1, &ratio14_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, 
-&ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1}; 
-
-static const ScaleNote * const even_integers1[128] = {&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio5_1, 
-&ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, 
-&ratio5_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, 
-&ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, 
-&ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1}; 
-
-static const ScaleNote * const even_integers2[128] = {&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, 
-&ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, 
-&ratio5_2, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, 
-&ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1}; 
-
-static const ScaleNote * const even_integers3[128] = {&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, 
-&ratio1_6, &ratio1_6, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, 
-&ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3}; 
-
-static const ScaleNote * const even_integers4[128] = {&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, 
-&ratio1_8, &ratio1_8, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio5_4, 
-&ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, 
-&ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, 
-&ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1}; 
-
-static const ScaleNote * const even_integers5[128] = {&ratio1_10, &ratio1_10, &ratio1_10, &ratio1_10, &ratio1_10, &ratio1_10, &ratio1_10, &ratio1_10, &ratio1_10, &ratio1_10, &ratio1_10, &ratio1_10, &ratio1_10, 
-&ratio1_10, &ratio1_10, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, 
-&ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, 
-&ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, 
-&ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, 
-&ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, 
-&ratio6_5, &ratio6_5, &ratio6_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5}; 
-
-static const ScaleNote * const even_integers6[128] = {&ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, 
-&ratio1_12, &ratio1_12, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, 
-&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio5_6, 
-&ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, 
-&ratio5_6, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, 
-&ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3}; 
-
-static const ScaleNote * const even_integers7[128] = {&ratio1_14, &ratio1_14, &ratio1_14, &ratio1_14, &ratio1_14, &ratio1_14, &ratio1_14, &ratio1_14, &ratio1_14, &ratio1_14, &ratio1_14, &ratio1_14, &ratio1_14, 
-&ratio1_14, &ratio1_14, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, 
-&ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, 
-&ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, 
-&ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, 
-&ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio5_7, 
-&ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, 
-&ratio5_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, 
-&ratio6_7, &ratio6_7, &ratio6_7, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, 
-&ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7}; 
-
-static const ScaleNote * const even_integers8[128] = {&ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, 
-&ratio1_16, &ratio1_16, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, 
-&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio5_8, 
-&ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, 
-&ratio5_8, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, 
-&ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-
-
-static const ScaleNote * const mult_three_integers0[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, 
-&ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio7_1, 
-&ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, 
-&ratio7_1, &ratio7_1, &ratio7_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, 
-&ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1}; 
-
-static const ScaleNote * const mult_three_integers1[128] = {&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, 
-&ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio7_2, 
-&ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, &ratio7_2, 
-&ratio7_2, &ratio7_2, &ratio7_2, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1}; 
-
-static const ScaleNote * const mult_three_integers2[128] = {&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio7_3, 
-&ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, 
-&ratio7_3, &ratio7_3, &ratio7_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3}; 
-
-static const ScaleNote * const mult_three_integers3[128] = {&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, 
-&ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio7_4, 
-&ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, &ratio7_4, 
-&ratio7_4, &ratio7_4, &ratio7_4, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1}; 
-
-static const ScaleNote * const mult_three_integers4[128] = {&ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, 
-&ratio1_5, &ratio1_5, &ratio1_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, 
-&ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, 
-&ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio4_5, 
-&ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, 
-&ratio4_5, &ratio4_5, &ratio4_5, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, 
-&ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio7_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5}; 
-
-static const ScaleNote * const mult_three_integers5[128] = {&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, 
-&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, 
-&ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio5_6, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio7_6, 
-&ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, &ratio7_6, 
-&ratio7_6, &ratio7_6, &ratio7_6, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3}; 
-
-static const ScaleNote * const mult_three_integers6[128] = {&ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, 
-&ratio1_7, &ratio1_7, &ratio1_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, 
-&ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio2_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, 
-&ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio4_7, 
-&ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, &ratio4_7, 
-&ratio4_7, &ratio4_7, &ratio4_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, 
-&ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, 
-&ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio6_7, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, 
-&ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7, &ratio8_7}; 
-
-static const ScaleNote * const mult_three_integers7[128] = {&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, 
-&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, 
-&ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio7_8, 
-&ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, &ratio7_8, 
-&ratio7_8, &ratio7_8, &ratio7_8, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-
-
-static const ScaleNote * const odd_integers0[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, 
-&ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, 
-&ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio7_1, &ratio9_1, &ratio9_1, &ratio9_1, &ratio9_1, 
-&ratio9_1, &ratio9_1, &ratio9_1, &ratio9_1, &ratio9_1, &ratio9_1, &ratio9_1, &ratio9_1, &ratio9_1, &ratio9_1, &ratio9_1, &ratio11_1, 
-&ratio11_1, &ratio11_1, &ratio11_1, &ratio11_1, &ratio11_1, &ratio11_1, &ratio11_1, &ratio11_1, &ratio11_1, &ratio11_1, &ratio11_1, &ratio11_1, 
-&ratio11_1, &ratio13_1, &ratio13_1, &ratio13_1, &ratio13_1, &ratio13_1, &ratio13_1, &ratio13_1, &ratio13_1, &ratio13_1, &ratio13_1, &ratio13_1, 
-&ratio13_1, &ratio13_1, &ratio13_1, &ratio15_1, &ratio15_1, &ratio15_1, &ratio15_1, &ratio15_1, &ratio15_1, &ratio15_1, &ratio15_1, &ratio15_1, 
-&ratio15_1, &ratio15_1, &ratio15_1, &ratio15_1, &ratio15_1, &ratio17_1, &ratio17_1, &ratio17_1, &ratio17_1, &ratio17_1, &ratio17_1, &ratio17_1, 
-&ratio17_1, &ratio17_1, &ratio17_1, &ratio17_1, &ratio17_1, &ratio17_1, &ratio17_1}; 
-
-static const ScaleNote * const odd_integers1[128] = {&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, 
-&ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio11_3, 
-&ratio11_3, &ratio11_3, &ratio11_3, &ratio11_3, &ratio11_3, &ratio11_3, &ratio11_3, &ratio11_3, &ratio11_3, &ratio11_3, &ratio11_3, &ratio11_3, 
-&ratio11_3, &ratio13_3, &ratio13_3, &ratio13_3, &ratio13_3, &ratio13_3, &ratio13_3, &ratio13_3, &ratio13_3, &ratio13_3, &ratio13_3, &ratio13_3, 
-&ratio13_3, &ratio13_3, &ratio13_3, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, 
-&ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio17_3, &ratio17_3, &ratio17_3, &ratio17_3, &ratio17_3, &ratio17_3, &ratio17_3, 
-&ratio17_3, &ratio17_3, &ratio17_3, &ratio17_3, &ratio17_3, &ratio17_3, &ratio17_3}; 
-
-static const ScaleNote * const odd_integers2[128] = {&ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, 
-&ratio1_5, &ratio1_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, 
-&ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio11_5, 
-&ratio11_5, &ratio11_5, &ratio11_5, &ratio11_5, &ratio11_5, &ratio11_5, &ratio11_5, &ratio11_5, &ratio11_5, &ratio11_5, &ratio11_5, &ratio11_5, 
-&ratio11_5, &ratio13_5, &ratio13_5, &ratio13_5, &ratio13_5, &ratio13_5, &ratio13_5, &ratio13_5, &ratio13_5, &ratio13_5, &ratio13_5, &ratio13_5, 
-&ratio13_5, &ratio13_5, &ratio13_5, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio17_5, &ratio17_5, &ratio17_5, &ratio17_5, &ratio17_5, &ratio17_5, &ratio17_5, 
-&ratio17_5, &ratio17_5, &ratio17_5, &ratio17_5, &ratio17_5, &ratio17_5, &ratio17_5}; 
-
-static const ScaleNote * const odd_integers3[128] = {&ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, 
-&ratio1_7, &ratio1_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, 
-&ratio3_7, &ratio3_7, &ratio3_7, &ratio3_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, 
-&ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, 
-&ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio11_7, 
-&ratio11_7, &ratio11_7, &ratio11_7, &ratio11_7, &ratio11_7, &ratio11_7, &ratio11_7, &ratio11_7, &ratio11_7, &ratio11_7, &ratio11_7, &ratio11_7, 
-&ratio11_7, &ratio13_7, &ratio13_7, &ratio13_7, &ratio13_7, &ratio13_7, &ratio13_7, &ratio13_7, &ratio13_7, &ratio13_7, &ratio13_7, &ratio13_7, 
-&ratio13_7, &ratio13_7, &ratio13_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, 
-&ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio17_7, &ratio17_7, &ratio17_7, &ratio17_7, &ratio17_7, &ratio17_7, &ratio17_7, 
-&ratio17_7, &ratio17_7, &ratio17_7, &ratio17_7, &ratio17_7, &ratio17_7, &ratio17_7}; 
-
-static const ScaleNote * const odd_integers4[128] = {&ratio1_9, &ratio1_9, &ratio1_9, &ratio1_9, &ratio1_9, &ratio1_9, &ratio1_9, &ratio1_9, &ratio1_9, &ratio1_9, &ratio1_9, &ratio1_9, &ratio1_9, 
-&ratio1_9, &ratio1_9, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio5_9, &ratio5_9, &ratio5_9, &ratio5_9, &ratio5_9, &ratio5_9, &ratio5_9, &ratio5_9, 
-&ratio5_9, &ratio5_9, &ratio5_9, &ratio5_9, &ratio5_9, &ratio5_9, &ratio7_9, &ratio7_9, &ratio7_9, &ratio7_9, &ratio7_9, &ratio7_9, 
-&ratio7_9, &ratio7_9, &ratio7_9, &ratio7_9, &ratio7_9, &ratio7_9, &ratio7_9, &ratio7_9, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio11_9, 
-&ratio11_9, &ratio11_9, &ratio11_9, &ratio11_9, &ratio11_9, &ratio11_9, &ratio11_9, &ratio11_9, &ratio11_9, &ratio11_9, &ratio11_9, &ratio11_9, 
-&ratio11_9, &ratio13_9, &ratio13_9, &ratio13_9, &ratio13_9, &ratio13_9, &ratio13_9, &ratio13_9, &ratio13_9, &ratio13_9, &ratio13_9, &ratio13_9, 
-&ratio13_9, &ratio13_9, &ratio13_9, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio17_9, &ratio17_9, &ratio17_9, &ratio17_9, &ratio17_9, &ratio17_9, &ratio17_9, 
-&ratio17_9, &ratio17_9, &ratio17_9, &ratio17_9, &ratio17_9, &ratio17_9, &ratio17_9}; 
-
-static const ScaleNote * const odd_integers5[128] = {&ratio1_11, &ratio1_11, &ratio1_11, &ratio1_11, &ratio1_11, &ratio1_11, &ratio1_11, &ratio1_11, &ratio1_11, &ratio1_11, &ratio1_11, &ratio1_11, &ratio1_11, 
-&ratio1_11, &ratio1_11, &ratio3_11, &ratio3_11, &ratio3_11, &ratio3_11, &ratio3_11, &ratio3_11, &ratio3_11, &ratio3_11, &ratio3_11, &ratio3_11, 
-&ratio3_11, &ratio3_11, &ratio3_11, &ratio3_11, &ratio5_11, &ratio5_11, &ratio5_11, &ratio5_11, &ratio5_11, &ratio5_11, &ratio5_11, &ratio5_11, 
-&ratio5_11, &ratio5_11, &ratio5_11, &ratio5_11, &ratio5_11, &ratio5_11, &ratio7_11, &ratio7_11, &ratio7_11, &ratio7_11, &ratio7_11, &ratio7_11, 
-&ratio7_11, &ratio7_11, &ratio7_11, &ratio7_11, &ratio7_11, &ratio7_11, &ratio7_11, &ratio7_11, &ratio9_11, &ratio9_11, &ratio9_11, &ratio9_11, 
-&ratio9_11, &ratio9_11, &ratio9_11, &ratio9_11, &ratio9_11, &ratio9_11, &ratio9_11, &ratio9_11, &ratio9_11, &ratio9_11, &ratio9_11, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio13_11, &ratio13_11, &ratio13_11, &ratio13_11, &ratio13_11, &ratio13_11, &ratio13_11, &ratio13_11, &ratio13_11, &ratio13_11, &ratio13_11, 
-&ratio13_11, &ratio13_11, &ratio13_11, &ratio15_11, &ratio15_11, &ratio15_11, &ratio15_11, &ratio15_11, &ratio15_11, &ratio15_11, &ratio15_11, &ratio15_11, 
-&ratio15_11, &ratio15_11, &ratio15_11, &ratio15_11, &ratio15_11, &ratio17_11, &ratio17_11, &ratio17_11, &ratio17_11, &ratio17_11, &ratio17_11, &ratio17_11, 
-&ratio17_11, &ratio17_11, &ratio17_11, &ratio17_11, &ratio17_11, &ratio17_11, &ratio17_11}; 
-
-static const ScaleNote * const odd_integers6[128] = {&ratio1_13, &ratio1_13, &ratio1_13, &ratio1_13, &ratio1_13, &ratio1_13, &ratio1_13, &ratio1_13, &ratio1_13, &ratio1_13, &ratio1_13, &ratio1_13, &ratio1_13, 
-&ratio1_13, &ratio1_13, &ratio3_13, &ratio3_13, &ratio3_13, &ratio3_13, &ratio3_13, &ratio3_13, &ratio3_13, &ratio3_13, &ratio3_13, &ratio3_13, 
-&ratio3_13, &ratio3_13, &ratio3_13, &ratio3_13, &ratio5_13, &ratio5_13, &ratio5_13, &ratio5_13, &ratio5_13, &ratio5_13, &ratio5_13, &ratio5_13, 
-&ratio5_13, &ratio5_13, &ratio5_13, &ratio5_13, &ratio5_13, &ratio5_13, &ratio7_13, &ratio7_13, &ratio7_13, &ratio7_13, &ratio7_13, &ratio7_13, 
-&ratio7_13, &ratio7_13, &ratio7_13, &ratio7_13, &ratio7_13, &ratio7_13, &ratio7_13, &ratio7_13, &ratio9_13, &ratio9_13, &ratio9_13, &ratio9_13, 
-&ratio9_13, &ratio9_13, &ratio9_13, &ratio9_13, &ratio9_13, &ratio9_13, &ratio9_13, &ratio9_13, &ratio9_13, &ratio9_13, &ratio9_13, &ratio11_13, 
-&ratio11_13, &ratio11_13, &ratio11_13, &ratio11_13, &ratio11_13, &ratio11_13, &ratio11_13, &ratio11_13, &ratio11_13, &ratio11_13, &ratio11_13, &ratio11_13, 
-&ratio11_13, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio15_13, &ratio15_13, &ratio15_13, &ratio15_13, &ratio15_13, &ratio15_13, &ratio15_13, &ratio15_13, &ratio15_13, 
-&ratio15_13, &ratio15_13, &ratio15_13, &ratio15_13, &ratio15_13, &ratio17_13, &ratio17_13, &ratio17_13, &ratio17_13, &ratio17_13, &ratio17_13, &ratio17_13, 
-&ratio17_13, &ratio17_13, &ratio17_13, &ratio17_13, &ratio17_13, &ratio17_13, &ratio17_13}; 
-
-static const ScaleNote * const odd_integers7[128] = {&ratio1_15, &ratio1_15, &ratio1_15, &ratio1_15, &ratio1_15, &ratio1_15, &ratio1_15, &ratio1_15, &ratio1_15, &ratio1_15, &ratio1_15, &ratio1_15, &ratio1_15, 
-&ratio1_15, &ratio1_15, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, 
-&ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio7_15, &ratio7_15, &ratio7_15, &ratio7_15, &ratio7_15, &ratio7_15, 
-&ratio7_15, &ratio7_15, &ratio7_15, &ratio7_15, &ratio7_15, &ratio7_15, &ratio7_15, &ratio7_15, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, 
-&ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio11_15, 
-&ratio11_15, &ratio11_15, &ratio11_15, &ratio11_15, &ratio11_15, &ratio11_15, &ratio11_15, &ratio11_15, &ratio11_15, &ratio11_15, &ratio11_15, &ratio11_15, 
-&ratio11_15, &ratio13_15, &ratio13_15, &ratio13_15, &ratio13_15, &ratio13_15, &ratio13_15, &ratio13_15, &ratio13_15, &ratio13_15, &ratio13_15, &ratio13_15, 
-&ratio13_15, &ratio13_15, &ratio13_15, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio17_15, &ratio17_15, &ratio17_15, &ratio17_15, &ratio17_15, &ratio17_15, &ratio17_15, 
-&ratio17_15, &ratio17_15, &ratio17_15, &ratio17_15, &ratio17_15, &ratio17_15, &ratio17_15}; 
-
-static const ScaleNote * const odd_integers8[128] = {&ratio1_17, &ratio1_17, &ratio1_17, &ratio1_17, &ratio1_17, &ratio1_17, &ratio1_17, &ratio1_17, &ratio1_17, &ratio1_17, &ratio1_17, &ratio1_17, &ratio1_17, 
-&ratio1_17, &ratio1_17, &ratio3_17, &ratio3_17, &ratio3_17, &ratio3_17, &ratio3_17, &ratio3_17, &ratio3_17, &ratio3_17, &ratio3_17, &ratio3_17, 
-&ratio3_17, &ratio3_17, &ratio3_17, &ratio3_17, &ratio5_17, &ratio5_17, &ratio5_17, &ratio5_17, &ratio5_17, &ratio5_17, &ratio5_17, &ratio5_17, 
-&ratio5_17, &ratio5_17, &ratio5_17, &ratio5_17, &ratio5_17, &ratio5_17, &ratio7_17, &ratio7_17, &ratio7_17, &ratio7_17, &ratio7_17, &ratio7_17, 
-&ratio7_17, &ratio7_17, &ratio7_17, &ratio7_17, &ratio7_17, &ratio7_17, &ratio7_17, &ratio7_17, &ratio9_17, &ratio9_17, &ratio9_17, &ratio9_17, 
-&ratio9_17, &ratio9_17, &ratio9_17, &ratio9_17, &ratio9_17, &ratio9_17, &ratio9_17, &ratio9_17, &ratio9_17, &ratio9_17, &ratio9_17, &ratio11_17, 
-&ratio11_17, &ratio11_17, &ratio11_17, &ratio11_17, &ratio11_17, &ratio11_17, &ratio11_17, &ratio11_17, &ratio11_17, &ratio11_17, &ratio11_17, &ratio11_17, 
-&ratio11_17, &ratio13_17, &ratio13_17, &ratio13_17, &ratio13_17, &ratio13_17, &ratio13_17, &ratio13_17, &ratio13_17, &ratio13_17, &ratio13_17, &ratio13_17, 
-&ratio13_17, &ratio13_17, &ratio13_17, &ratio15_17, &ratio15_17, &ratio15_17, &ratio15_17, &ratio15_17, &ratio15_17, &ratio15_17, &ratio15_17, &ratio15_17, 
-&ratio15_17, &ratio15_17, &ratio15_17, &ratio15_17, &ratio15_17, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-
-
-static const ScaleNote * const modal_tetradsainversion_walk[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, 
-&ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, 
-&ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1}; 
-
-static const ScaleNote * const modal_tetradsbinversion_walk[128] = {&ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, 
-&ratio9_4, &ratio9_4, &ratio9_4, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, 
-&ratio9_4, &ratio9_4, &ratio9_4, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, 
-&ratio9_4, &ratio9_4, &ratio9_4, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio27_8, 
-&ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8}; 
-
-static const ScaleNote * const modal_tetradinversion_walk[128] = {&ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio9_4, 
-&ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio9_4, 
-&ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, 
-&ratio5_2, &ratio5_2, &ratio5_2, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio9_4, 
-&ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, 
-&ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio9_4, 
-&ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, 
-&ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio15_4, 
-&ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4}; 
-
-static const ScaleNote * const modal_tetradsdinversion_walk[128] = {&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, 
-&ratio27_16, &ratio27_16, &ratio27_16, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, 
-&ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, 
-&ratio27_16, &ratio27_16, &ratio27_16, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, 
-&ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, 
-&ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio5_2, 
-&ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1}; 
-
-static const ScaleNote * const modal_tetradseinversion_walk[128] = {&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio9_2, 
-&ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2}; 
-
-static const ScaleNote * const modal_tetradsfinversion_walk[128] = {&ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio27_16, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, 
-&ratio27_8, &ratio27_8, &ratio27_8, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, 
-&ratio27_8, &ratio27_8, &ratio27_8, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, 
-&ratio27_8, &ratio27_8, &ratio27_8, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio5_1, 
-&ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1}; 
-
-static const ScaleNote * const modal_tetradsginversion_walk[128] = {&ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, 
-&ratio9_4, &ratio9_4, &ratio9_4, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio27_8, 
-&ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, 
-&ratio9_4, &ratio9_4, &ratio9_4, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio27_8, 
-&ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, 
-&ratio15_4, &ratio15_4, &ratio15_4, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio27_8, 
-&ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, 
-&ratio15_4, &ratio15_4, &ratio15_4, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio27_8, 
-&ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio27_8, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, 
-&ratio15_4, &ratio15_4, &ratio15_4, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio16_3, 
-&ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3}; 
-
-static const ScaleNote * const modal_tetradshinversion_walk[128] = {&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, 
-&ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio18_5, 
-&ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, 
-&ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio18_5, 
-&ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio18_5, 
-&ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio18_5, 
-&ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1}; 
-
-
-
-static const ScaleNote * const a_maj7thinversion_walk[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, 
-&ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, 
-&ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1}; 
-
-static const ScaleNote * const a_maj7th2ndIninversion_walk[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, 
-&ratio5_4, &ratio5_4, &ratio5_4, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, 
-&ratio5_4, &ratio5_4, &ratio5_4, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3}; 
-
-static const ScaleNote * const b_dom7thinversion_walk[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, 
-&ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, 
-&ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1}; 
-
-static const ScaleNote * const b_dom7thRotateinversion_walk[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, 
-&ratio6_5, &ratio6_5, &ratio6_5, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, 
-&ratio6_5, &ratio6_5, &ratio6_5, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1}; 
-
-static const ScaleNote * const c_subDom7thinversion_walk[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, 
-&ratio6_5, &ratio6_5, &ratio6_5, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, 
-&ratio6_5, &ratio6_5, &ratio6_5, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio36_25, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio72_25, 
-&ratio72_25, &ratio72_25, &ratio72_25, &ratio72_25, &ratio72_25, &ratio72_25, &ratio72_25}; 
-
-static const ScaleNote * const c_subDom7thRotateinversion_walk[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, 
-&ratio9_8, &ratio9_8, &ratio9_8, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, 
-&ratio9_8, &ratio9_8, &ratio9_8, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio25_18, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio25_9, 
-&ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9}; 
-
-static const ScaleNote * const min7thinversion_walk[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, 
-&ratio9_8, &ratio9_8, &ratio9_8, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, 
-&ratio9_8, &ratio9_8, &ratio9_8, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio12_5, 
-&ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5}; 
-
-static const ScaleNote * const min7th2ndIninversion_walk[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, 
-&ratio6_5, &ratio6_5, &ratio6_5, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, 
-&ratio6_5, &ratio6_5, &ratio6_5, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1}; 
-
-
-
-static const ScaleNote * const impressionista_vs_impressionistb[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, 
-&ratio6_5, &ratio6_5, &ratio6_5, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, 
-&ratio15_4, &ratio15_4, &ratio15_4, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio18_5, 
-&ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, 
-&ratio12_5, &ratio12_5, &ratio12_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-static const ScaleNote * const impressionist_vs_impressionistd[128] = {&ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio16_5, 
-&ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio16_5, 
-&ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, 
-&ratio9_4, &ratio9_4, &ratio9_4, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio9_8, 
-&ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8}; 
-
-static const ScaleNote * const impressioniste_vs_impressionistf[128] = {&ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, 
-&ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, 
-&ratio17_8, &ratio17_8, &ratio17_8, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, 
-&ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, 
-&ratio5_2, &ratio5_2, &ratio5_2, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio17_16, 
-&ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16}; 
-
-static const ScaleNote * const impressionistg_vs_impressionisth[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, 
-&ratio9_8, &ratio9_8, &ratio9_8, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, 
-&ratio9_4, &ratio9_4, &ratio9_4, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio18_5, 
-&ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, 
-&ratio9_2, &ratio9_2, &ratio9_2, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio18_5, 
-&ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio18_5, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-static const ScaleNote * const impressionisti_vs_impressionistj[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16, 
-&ratio17_16, &ratio17_16, &ratio17_16, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, 
-&ratio17_8, &ratio17_8, &ratio17_8, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio16_5, 
-&ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio16_5, 
-&ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, &ratio17_8, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio17_16, 
-&ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16, &ratio17_16}; 
-
-static const ScaleNote * const impressionistk_vs_impressionistl[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio16_5, 
-&ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, 
-&ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio9_2, &ratio16_5, 
-&ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-static const ScaleNote * const impressionistm_vs_impressionistn[128] = {&ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, 
-&ratio9_4, &ratio9_4, &ratio9_4, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio16_5, 
-&ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, 
-&ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio16_5, 
-&ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio9_4, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio9_8, 
-&ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8}; 
-
-static const ScaleNote * const impressionisto_vs_impressionistp[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, 
-&ratio6_5, &ratio6_5, &ratio6_5, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, 
-&ratio12_5, &ratio12_5, &ratio12_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio15_8, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio15_8, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-
-
-static const ScaleNote * const bohlenPeirceAScale_vs_bohlenPeirceBlueLambda[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio25_21, 
-&ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio9_7, 
-&ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio75_49, &ratio75_49, 
-&ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio49_25, &ratio49_25, 
-&ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio7_3, &ratio7_3, 
-&ratio7_3, &ratio7_3, &ratio7_3, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio25_9, &ratio25_9, &ratio25_9, 
-&ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio7_3, &ratio7_3, &ratio7_3, 
-&ratio7_3, &ratio7_3, &ratio7_3, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio9_5, &ratio9_5, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, 
-&ratio25_21, &ratio25_21, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-static const ScaleNote * const bohlenPeirceBlueLambda2_vs_bohlenPeirceDurI[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, 
-&ratio25_21, &ratio25_21, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio7_5, &ratio7_5, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, 
-&ratio49_25, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, 
-&ratio25_9, &ratio25_9, &ratio25_9, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio7_3, 
-&ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, 
-&ratio49_25, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio9_7, &ratio9_7, 
-&ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-static const ScaleNote * const bohlenPeirceDurII_vs_bohlenPeirceGLambda[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, 
-&ratio25_21, &ratio25_21, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio7_5, &ratio7_5, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, 
-&ratio15_7, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, 
-&ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio7_3, 
-&ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, 
-&ratio15_7, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio9_7, &ratio9_7, 
-&ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-static const ScaleNote * const bohlenPeirceGamma_vs_bohlenPeirceHPentatoni[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio27_25, &ratio27_25, &ratio27_25, 
-&ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, 
-&ratio9_7, &ratio9_7, &ratio9_7, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio9_5, &ratio9_5, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, 
-&ratio49_25, &ratio49_25, &ratio49_25, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, 
-&ratio7_3, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, 
-&ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, 
-&ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-static const ScaleNote * const bohlenPeirceHarmoni_vs_bohlenPeirceMollI[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, 
-&ratio27_25, &ratio27_25, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio7_5, &ratio7_5, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, 
-&ratio15_7, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, 
-&ratio63_25, &ratio63_25, &ratio63_25, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio7_3, 
-&ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, 
-&ratio15_7, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio9_7, &ratio9_7, 
-&ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-static const ScaleNote * const bohlenPeirceMollII_vs_bohlenPeirceProoijenMaj[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, 
-&ratio27_25, &ratio27_25, &ratio27_25, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio15_7, 
-&ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, 
-&ratio7_3, &ratio7_3, &ratio7_3, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, 
-&ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, 
-&ratio7_3, &ratio7_3, &ratio7_3, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio7_5, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-static const ScaleNote * const bohlenPeirceProoijenMin_vs_bohlenPeirceWalkerA[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, 
-&ratio25_21, &ratio25_21, &ratio25_21, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio25_9, 
-&ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, 
-&ratio63_25, &ratio63_25, &ratio63_25, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio49_25, 
-&ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, 
-&ratio25_21, &ratio25_21, &ratio25_21, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-static const ScaleNote * const bohlenPeirceWalkerB_vs_bohlenPeirceWalkerI[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, &ratio27_25, 
-&ratio27_25, &ratio27_25, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio7_5, &ratio7_5, &ratio7_5, 
-&ratio7_5, &ratio7_5, &ratio7_5, &ratio7_5, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio9_5, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio9_5, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, 
-&ratio49_25, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, 
-&ratio63_25, &ratio63_25, &ratio63_25, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio25_9, &ratio63_25, 
-&ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, 
-&ratio15_7, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio49_25, &ratio5_3, &ratio5_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio75_49, &ratio9_7, &ratio9_7, 
-&ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, &ratio25_21, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-
-
-static const ScaleNote * const modesofroota[128] = {&ratio3_128, &ratio27_1024, &ratio15_512, &ratio15_512, &ratio1_32, &ratio1_32, &ratio9_256, &ratio5_128, &ratio1_24, &ratio1_24, &ratio3_64, &ratio3_64, &ratio3_64, 
-&ratio27_512, &ratio15_256, &ratio15_256, &ratio1_16, &ratio1_16, &ratio9_128, &ratio5_64, &ratio1_12, &ratio1_12, &ratio3_32, &ratio3_32, &ratio3_32, 
-&ratio27_256, &ratio15_128, &ratio15_128, &ratio1_8, &ratio1_8, &ratio9_64, &ratio5_32, &ratio1_6, &ratio1_6, &ratio3_16, &ratio3_16, &ratio3_16, 
-&ratio27_128, &ratio15_64, &ratio15_64, &ratio1_4, &ratio1_4, &ratio9_32, &ratio5_16, &ratio1_3, &ratio1_3, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio27_64, &ratio15_32, &ratio15_32, &ratio1_2, &ratio1_2, &ratio9_16, &ratio5_8, &ratio2_3, &ratio2_3, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio27_32, &ratio15_16, &ratio15_16, &ratio1_1, &ratio1_1, &ratio9_8, &ratio5_4, &ratio4_3, &ratio4_3, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio27_16, &ratio15_8, &ratio15_8, &ratio2_1, &ratio2_1, &ratio9_4, &ratio5_2, &ratio8_3, &ratio8_3, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio27_8, &ratio15_4, &ratio15_4, &ratio4_1, &ratio4_1, &ratio9_2, &ratio5_1, &ratio16_3, &ratio16_3, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio27_4, &ratio15_2, &ratio15_2, &ratio8_1, &ratio8_1, &ratio9_1, &ratio10_1, &ratio32_3, &ratio32_3, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio27_2, &ratio15_1, &ratio15_1, &ratio16_1, &ratio16_1, &ratio18_1, &ratio20_1, &ratio64_3, &ratio64_3, &ratio24_1, &ratio24_1, &ratio24_1, 
-&ratio27_1, &ratio30_1, &ratio30_1, &ratio32_1, &ratio32_1, &ratio36_1, &ratio40_1}; 
-
-static const ScaleNote * const modesofrootb[128] = {&ratio3_128, &ratio27_1024, &ratio9_320, &ratio9_320, &ratio1_32, &ratio1_32, &ratio9_256, &ratio19_512, &ratio1_24, &ratio1_24, &ratio3_64, &ratio3_64, &ratio3_64, 
-&ratio27_512, &ratio9_160, &ratio9_160, &ratio1_16, &ratio1_16, &ratio9_128, &ratio19_256, &ratio1_12, &ratio1_12, &ratio3_32, &ratio3_32, &ratio3_32, 
-&ratio27_256, &ratio9_80, &ratio9_80, &ratio1_8, &ratio1_8, &ratio9_64, &ratio19_128, &ratio1_6, &ratio1_6, &ratio3_16, &ratio3_16, &ratio3_16, 
-&ratio27_128, &ratio9_40, &ratio9_40, &ratio1_4, &ratio1_4, &ratio9_32, &ratio19_64, &ratio1_3, &ratio1_3, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio27_64, &ratio9_20, &ratio9_20, &ratio1_2, &ratio1_2, &ratio9_16, &ratio19_32, &ratio2_3, &ratio2_3, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio27_32, &ratio9_10, &ratio9_10, &ratio1_1, &ratio1_1, &ratio9_8, &ratio19_16, &ratio4_3, &ratio4_3, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio27_16, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio9_4, &ratio19_8, &ratio8_3, &ratio8_3, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio27_8, &ratio18_5, &ratio18_5, &ratio4_1, &ratio4_1, &ratio9_2, &ratio19_4, &ratio16_3, &ratio16_3, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio27_4, &ratio36_5, &ratio36_5, &ratio8_1, &ratio8_1, &ratio9_1, &ratio19_2, &ratio32_3, &ratio32_3, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio27_2, &ratio72_5, &ratio72_5, &ratio16_1, &ratio16_1, &ratio18_1, &ratio19_1, &ratio64_3, &ratio64_3, &ratio24_1, &ratio24_1, &ratio24_1, 
-&ratio27_1, &ratio144_5, &ratio144_5, &ratio32_1, &ratio32_1, &ratio36_1, &ratio38_1}; 
-
-static const ScaleNote * const modesofrootc[128] = {&ratio1_40, &ratio1_40, &ratio9_320, &ratio9_320, &ratio1_32, &ratio17_512, &ratio19_512, &ratio19_512, &ratio1_24, &ratio1_24, &ratio3_64, &ratio3_64, &ratio1_20, 
-&ratio1_20, &ratio9_160, &ratio9_160, &ratio1_16, &ratio17_256, &ratio19_256, &ratio19_256, &ratio1_12, &ratio1_12, &ratio3_32, &ratio3_32, &ratio1_10, 
-&ratio1_10, &ratio9_80, &ratio9_80, &ratio1_8, &ratio17_128, &ratio19_128, &ratio19_128, &ratio1_6, &ratio1_6, &ratio3_16, &ratio3_16, &ratio1_5, 
-&ratio1_5, &ratio9_40, &ratio9_40, &ratio1_4, &ratio17_64, &ratio19_64, &ratio19_64, &ratio1_3, &ratio1_3, &ratio3_8, &ratio3_8, &ratio2_5, 
-&ratio2_5, &ratio9_20, &ratio9_20, &ratio1_2, &ratio17_32, &ratio19_32, &ratio19_32, &ratio2_3, &ratio2_3, &ratio3_4, &ratio3_4, &ratio4_5, 
-&ratio4_5, &ratio9_10, &ratio9_10, &ratio1_1, &ratio17_16, &ratio19_16, &ratio19_16, &ratio4_3, &ratio4_3, &ratio3_2, &ratio3_2, &ratio8_5, 
-&ratio8_5, &ratio9_5, &ratio9_5, &ratio2_1, &ratio17_8, &ratio19_8, &ratio19_8, &ratio8_3, &ratio8_3, &ratio3_1, &ratio3_1, &ratio16_5, 
-&ratio16_5, &ratio18_5, &ratio18_5, &ratio4_1, &ratio17_4, &ratio19_4, &ratio19_4, &ratio16_3, &ratio16_3, &ratio6_1, &ratio6_1, &ratio32_5, 
-&ratio32_5, &ratio36_5, &ratio36_5, &ratio8_1, &ratio17_2, &ratio19_2, &ratio19_2, &ratio32_3, &ratio32_3, &ratio12_1, &ratio12_1, &ratio64_5, 
-&ratio64_5, &ratio72_5, &ratio72_5, &ratio16_1, &ratio17_1, &ratio19_1, &ratio19_1, &ratio64_3, &ratio64_3, &ratio24_1, &ratio24_1, &ratio128_5, 
-&ratio128_5, &ratio144_5, &ratio144_5, &ratio32_1, &ratio34_1, &ratio38_1, &ratio38_1}; 
-
-static const ScaleNote * const modesofrootd[128] = {&ratio3_128, &ratio27_1024, &ratio15_512, &ratio15_512, &ratio1_32, &ratio1_32, &ratio9_256, &ratio5_128, &ratio5_128, &ratio7_160, &ratio7_160, &ratio3_64, &ratio3_64, 
-&ratio27_512, &ratio15_256, &ratio15_256, &ratio1_16, &ratio1_16, &ratio9_128, &ratio5_64, &ratio5_64, &ratio7_80, &ratio7_80, &ratio3_32, &ratio3_32, 
-&ratio27_256, &ratio15_128, &ratio15_128, &ratio1_8, &ratio1_8, &ratio9_64, &ratio5_32, &ratio5_32, &ratio7_40, &ratio7_40, &ratio3_16, &ratio3_16, 
-&ratio27_128, &ratio15_64, &ratio15_64, &ratio1_4, &ratio1_4, &ratio9_32, &ratio5_16, &ratio5_16, &ratio7_20, &ratio7_20, &ratio3_8, &ratio3_8, 
-&ratio27_64, &ratio15_32, &ratio15_32, &ratio1_2, &ratio1_2, &ratio9_16, &ratio5_8, &ratio5_8, &ratio7_10, &ratio7_10, &ratio3_4, &ratio3_4, 
-&ratio27_32, &ratio15_16, &ratio15_16, &ratio1_1, &ratio1_1, &ratio9_8, &ratio5_4, &ratio5_4, &ratio7_5, &ratio7_5, &ratio3_2, &ratio3_2, 
-&ratio27_16, &ratio15_8, &ratio15_8, &ratio2_1, &ratio2_1, &ratio9_4, &ratio5_2, &ratio5_2, &ratio14_5, &ratio14_5, &ratio3_1, &ratio3_1, 
-&ratio27_8, &ratio15_4, &ratio15_4, &ratio4_1, &ratio4_1, &ratio9_2, &ratio5_1, &ratio5_1, &ratio28_5, &ratio28_5, &ratio6_1, &ratio6_1, 
-&ratio27_4, &ratio15_2, &ratio15_2, &ratio8_1, &ratio8_1, &ratio9_1, &ratio10_1, &ratio10_1, &ratio56_5, &ratio56_5, &ratio12_1, &ratio12_1, 
-&ratio27_2, &ratio15_1, &ratio15_1, &ratio16_1, &ratio16_1, &ratio18_1, &ratio20_1, &ratio20_1, &ratio112_5, &ratio112_5, &ratio24_1, &ratio24_1, 
-&ratio27_1, &ratio30_1, &ratio30_1, &ratio32_1, &ratio32_1, &ratio36_1, &ratio40_1}; 
-
-static const ScaleNote * const modesofroote[128] = {&ratio3_128, &ratio27_1024, &ratio9_320, &ratio9_320, &ratio1_32, &ratio1_32, &ratio9_256, &ratio5_128, &ratio1_24, &ratio1_24, &ratio3_64, &ratio3_64, &ratio3_64, 
-&ratio27_512, &ratio9_160, &ratio9_160, &ratio1_16, &ratio1_16, &ratio9_128, &ratio5_64, &ratio1_12, &ratio1_12, &ratio3_32, &ratio3_32, &ratio3_32, 
-&ratio27_256, &ratio9_80, &ratio9_80, &ratio1_8, &ratio1_8, &ratio9_64, &ratio5_32, &ratio1_6, &ratio1_6, &ratio3_16, &ratio3_16, &ratio3_16, 
-&ratio27_128, &ratio9_40, &ratio9_40, &ratio1_4, &ratio1_4, &ratio9_32, &ratio5_16, &ratio1_3, &ratio1_3, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio27_64, &ratio9_20, &ratio9_20, &ratio1_2, &ratio1_2, &ratio9_16, &ratio5_8, &ratio2_3, &ratio2_3, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio27_32, &ratio9_10, &ratio9_10, &ratio1_1, &ratio1_1, &ratio9_8, &ratio5_4, &ratio4_3, &ratio4_3, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio27_16, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio9_4, &ratio5_2, &ratio8_3, &ratio8_3, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio27_8, &ratio18_5, &ratio18_5, &ratio4_1, &ratio4_1, &ratio9_2, &ratio5_1, &ratio16_3, &ratio16_3, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio27_4, &ratio36_5, &ratio36_5, &ratio8_1, &ratio8_1, &ratio9_1, &ratio10_1, &ratio32_3, &ratio32_3, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio27_2, &ratio72_5, &ratio72_5, &ratio16_1, &ratio16_1, &ratio18_1, &ratio20_1, &ratio64_3, &ratio64_3, &ratio24_1, &ratio24_1, &ratio24_1, 
-&ratio27_1, &ratio144_5, &ratio144_5, &ratio32_1, &ratio32_1, &ratio36_1, &ratio40_1}; 
-
-static const ScaleNote * const modesofrootf[128] = {&ratio1_40, &ratio1_40, &ratio9_320, &ratio9_320, &ratio1_32, &ratio1_32, &ratio9_256, &ratio19_512, &ratio1_24, &ratio1_24, &ratio3_64, &ratio3_64, &ratio1_20, 
-&ratio1_20, &ratio9_160, &ratio9_160, &ratio1_16, &ratio1_16, &ratio9_128, &ratio19_256, &ratio1_12, &ratio1_12, &ratio3_32, &ratio3_32, &ratio1_10, 
-&ratio1_10, &ratio9_80, &ratio9_80, &ratio1_8, &ratio1_8, &ratio9_64, &ratio19_128, &ratio1_6, &ratio1_6, &ratio3_16, &ratio3_16, &ratio1_5, 
-&ratio1_5, &ratio9_40, &ratio9_40, &ratio1_4, &ratio1_4, &ratio9_32, &ratio19_64, &ratio1_3, &ratio1_3, &ratio3_8, &ratio3_8, &ratio2_5, 
-&ratio2_5, &ratio9_20, &ratio9_20, &ratio1_2, &ratio1_2, &ratio9_16, &ratio19_32, &ratio2_3, &ratio2_3, &ratio3_4, &ratio3_4, &ratio4_5, 
-&ratio4_5, &ratio9_10, &ratio9_10, &ratio1_1, &ratio1_1, &ratio9_8, &ratio19_16, &ratio4_3, &ratio4_3, &ratio3_2, &ratio3_2, &ratio8_5, 
-&ratio8_5, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio9_4, &ratio19_8, &ratio8_3, &ratio8_3, &ratio3_1, &ratio3_1, &ratio16_5, 
-&ratio16_5, &ratio18_5, &ratio18_5, &ratio4_1, &ratio4_1, &ratio9_2, &ratio19_4, &ratio16_3, &ratio16_3, &ratio6_1, &ratio6_1, &ratio32_5, 
-&ratio32_5, &ratio36_5, &ratio36_5, &ratio8_1, &ratio8_1, &ratio9_1, &ratio19_2, &ratio32_3, &ratio32_3, &ratio12_1, &ratio12_1, &ratio64_5, 
-&ratio64_5, &ratio72_5, &ratio72_5, &ratio16_1, &ratio16_1, &ratio18_1, &ratio19_1, &ratio64_3, &ratio64_3, &ratio24_1, &ratio24_1, &ratio128_5, 
-&ratio128_5, &ratio144_5, &ratio144_5, &ratio32_1, &ratio32_1, &ratio36_1, &ratio38_1}; 
-
-static const ScaleNote * const modesofrootg[128] = {&ratio1_40, &ratio1_40, &ratio9_320, &ratio9_320, &ratio1_32, &ratio17_512, &ratio19_512, &ratio19_512, &ratio1_24, &ratio7_160, &ratio7_160, &ratio1_20, &ratio1_20, 
-&ratio1_20, &ratio9_160, &ratio9_160, &ratio1_16, &ratio17_256, &ratio19_256, &ratio19_256, &ratio1_12, &ratio7_80, &ratio7_80, &ratio1_10, &ratio1_10, 
-&ratio1_10, &ratio9_80, &ratio9_80, &ratio1_8, &ratio17_128, &ratio19_128, &ratio19_128, &ratio1_6, &ratio7_40, &ratio7_40, &ratio1_5, &ratio1_5, 
-&ratio1_5, &ratio9_40, &ratio9_40, &ratio1_4, &ratio17_64, &ratio19_64, &ratio19_64, &ratio1_3, &ratio7_20, &ratio7_20, &ratio2_5, &ratio2_5, 
-&ratio2_5, &ratio9_20, &ratio9_20, &ratio1_2, &ratio17_32, &ratio19_32, &ratio19_32, &ratio2_3, &ratio7_10, &ratio7_10, &ratio4_5, &ratio4_5, 
-&ratio4_5, &ratio9_10, &ratio9_10, &ratio1_1, &ratio17_16, &ratio19_16, &ratio19_16, &ratio4_3, &ratio7_5, &ratio7_5, &ratio8_5, &ratio8_5, 
-&ratio8_5, &ratio9_5, &ratio9_5, &ratio2_1, &ratio17_8, &ratio19_8, &ratio19_8, &ratio8_3, &ratio14_5, &ratio14_5, &ratio16_5, &ratio16_5, 
-&ratio16_5, &ratio18_5, &ratio18_5, &ratio4_1, &ratio17_4, &ratio19_4, &ratio19_4, &ratio16_3, &ratio28_5, &ratio28_5, &ratio32_5, &ratio32_5, 
-&ratio32_5, &ratio36_5, &ratio36_5, &ratio8_1, &ratio17_2, &ratio19_2, &ratio19_2, &ratio32_3, &ratio56_5, &ratio56_5, &ratio64_5, &ratio64_5, 
-&ratio64_5, &ratio72_5, &ratio72_5, &ratio16_1, &ratio17_1, &ratio19_1, &ratio19_1, &ratio64_3, &ratio112_5, &ratio112_5, &ratio128_5, &ratio128_5, 
-&ratio128_5, &ratio144_5, &ratio144_5, &ratio32_1, &ratio34_1, &ratio38_1, &ratio38_1}; 
-
-static const ScaleNote * const modesofrooth[128] = {&ratio1_40, &ratio1_40, &ratio9_320, &ratio9_320, &ratio1_32, &ratio1_32, &ratio9_256, &ratio5_128, &ratio5_128, &ratio7_160, &ratio7_160, &ratio1_20, &ratio1_20, 
-&ratio1_20, &ratio9_160, &ratio9_160, &ratio1_16, &ratio1_16, &ratio9_128, &ratio5_64, &ratio5_64, &ratio7_80, &ratio7_80, &ratio1_10, &ratio1_10, 
-&ratio1_10, &ratio9_80, &ratio9_80, &ratio1_8, &ratio1_8, &ratio9_64, &ratio5_32, &ratio5_32, &ratio7_40, &ratio7_40, &ratio1_5, &ratio1_5, 
-&ratio1_5, &ratio9_40, &ratio9_40, &ratio1_4, &ratio1_4, &ratio9_32, &ratio5_16, &ratio5_16, &ratio7_20, &ratio7_20, &ratio2_5, &ratio2_5, 
-&ratio2_5, &ratio9_20, &ratio9_20, &ratio1_2, &ratio1_2, &ratio9_16, &ratio5_8, &ratio5_8, &ratio7_10, &ratio7_10, &ratio4_5, &ratio4_5, 
-&ratio4_5, &ratio9_10, &ratio9_10, &ratio1_1, &ratio1_1, &ratio9_8, &ratio5_4, &ratio5_4, &ratio7_5, &ratio7_5, &ratio8_5, &ratio8_5, 
-&ratio8_5, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio9_4, &ratio5_2, &ratio5_2, &ratio14_5, &ratio14_5, &ratio16_5, &ratio16_5, 
-&ratio16_5, &ratio18_5, &ratio18_5, &ratio4_1, &ratio4_1, &ratio9_2, &ratio5_1, &ratio5_1, &ratio28_5, &ratio28_5, &ratio32_5, &ratio32_5, 
-&ratio32_5, &ratio36_5, &ratio36_5, &ratio8_1, &ratio8_1, &ratio9_1, &ratio10_1, &ratio10_1, &ratio56_5, &ratio56_5, &ratio64_5, &ratio64_5, 
-&ratio64_5, &ratio72_5, &ratio72_5, &ratio16_1, &ratio16_1, &ratio18_1, &ratio20_1, &ratio20_1, &ratio112_5, &ratio112_5, &ratio128_5, &ratio128_5, 
-&ratio128_5, &ratio144_5, &ratio144_5, &ratio32_1, &ratio32_1, &ratio36_1, &ratio40_1}; 
-
-
-
-static const ScaleNote * const tetrad_inversionsa[128] = {&ratio3_128, &ratio15_512, &ratio15_512, &ratio15_512, &ratio1_32, &ratio1_32, &ratio5_128, &ratio5_128, &ratio5_128, &ratio5_128, &ratio3_64, &ratio3_64, &ratio3_64, 
-&ratio15_256, &ratio15_256, &ratio15_256, &ratio1_16, &ratio1_16, &ratio5_64, &ratio5_64, &ratio5_64, &ratio5_64, &ratio3_32, &ratio3_32, &ratio3_32, 
-&ratio15_128, &ratio15_128, &ratio15_128, &ratio1_8, &ratio1_8, &ratio5_32, &ratio5_32, &ratio5_32, &ratio5_32, &ratio3_16, &ratio3_16, &ratio3_16, 
-&ratio15_64, &ratio15_64, &ratio15_64, &ratio1_4, &ratio1_4, &ratio5_16, &ratio5_16, &ratio5_16, &ratio5_16, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio15_32, &ratio15_32, &ratio15_32, &ratio1_2, &ratio1_2, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio15_16, &ratio15_16, &ratio15_16, &ratio1_1, &ratio1_1, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio15_8, &ratio15_8, &ratio15_8, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio15_4, &ratio15_4, &ratio15_4, &ratio4_1, &ratio4_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio15_2, &ratio15_2, &ratio15_2, &ratio8_1, &ratio8_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio15_1, &ratio15_1, &ratio15_1, &ratio16_1, &ratio16_1, &ratio20_1, &ratio20_1, &ratio20_1, &ratio20_1, &ratio24_1, &ratio24_1, &ratio24_1, 
-&ratio30_1, &ratio30_1, &ratio30_1, &ratio32_1, &ratio32_1, &ratio40_1, &ratio40_1}; 
-
-static const ScaleNote * const tetrad_inversionsb[128] = {&ratio5_192, &ratio5_192, &ratio5_192, &ratio5_192, &ratio1_32, &ratio1_32, &ratio5_128, &ratio5_128, &ratio1_24, &ratio1_24, &ratio1_24, &ratio5_96, &ratio5_96, 
-&ratio5_96, &ratio5_96, &ratio5_96, &ratio1_16, &ratio1_16, &ratio5_64, &ratio5_64, &ratio1_12, &ratio1_12, &ratio1_12, &ratio5_48, &ratio5_48, 
-&ratio5_48, &ratio5_48, &ratio5_48, &ratio1_8, &ratio1_8, &ratio5_32, &ratio5_32, &ratio1_6, &ratio1_6, &ratio1_6, &ratio5_24, &ratio5_24, 
-&ratio5_24, &ratio5_24, &ratio5_24, &ratio1_4, &ratio1_4, &ratio5_16, &ratio5_16, &ratio1_3, &ratio1_3, &ratio1_3, &ratio5_12, &ratio5_12, 
-&ratio5_12, &ratio5_12, &ratio5_12, &ratio1_2, &ratio1_2, &ratio5_8, &ratio5_8, &ratio2_3, &ratio2_3, &ratio2_3, &ratio5_6, &ratio5_6, 
-&ratio5_6, &ratio5_6, &ratio5_6, &ratio1_1, &ratio1_1, &ratio5_4, &ratio5_4, &ratio4_3, &ratio4_3, &ratio4_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio8_3, &ratio8_3, &ratio8_3, &ratio10_3, &ratio10_3, 
-&ratio10_3, &ratio10_3, &ratio10_3, &ratio4_1, &ratio4_1, &ratio5_1, &ratio5_1, &ratio16_3, &ratio16_3, &ratio16_3, &ratio20_3, &ratio20_3, 
-&ratio20_3, &ratio20_3, &ratio20_3, &ratio8_1, &ratio8_1, &ratio10_1, &ratio10_1, &ratio32_3, &ratio32_3, &ratio32_3, &ratio40_3, &ratio40_3, 
-&ratio40_3, &ratio40_3, &ratio40_3, &ratio16_1, &ratio16_1, &ratio20_1, &ratio20_1, &ratio64_3, &ratio64_3, &ratio64_3, &ratio80_3, &ratio80_3, 
-&ratio80_3, &ratio80_3, &ratio80_3, &ratio32_1, &ratio32_1, &ratio40_1, &ratio40_1}; 
-
-static const ScaleNote * const tetrad_inversionsc[128] = {&ratio1_40, &ratio1_40, &ratio1_40, &ratio1_40, &ratio1_32, &ratio1_32, &ratio3_80, &ratio3_80, &ratio3_80, &ratio3_80, &ratio3_64, &ratio3_64, &ratio1_20, 
-&ratio1_20, &ratio1_20, &ratio1_20, &ratio1_16, &ratio1_16, &ratio3_40, &ratio3_40, &ratio3_40, &ratio3_40, &ratio3_32, &ratio3_32, &ratio1_10, 
-&ratio1_10, &ratio1_10, &ratio1_10, &ratio1_8, &ratio1_8, &ratio3_20, &ratio3_20, &ratio3_20, &ratio3_20, &ratio3_16, &ratio3_16, &ratio1_5, 
-&ratio1_5, &ratio1_5, &ratio1_5, &ratio1_4, &ratio1_4, &ratio3_10, &ratio3_10, &ratio3_10, &ratio3_10, &ratio3_8, &ratio3_8, &ratio2_5, 
-&ratio2_5, &ratio2_5, &ratio2_5, &ratio1_2, &ratio1_2, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_4, &ratio3_4, &ratio4_5, 
-&ratio4_5, &ratio4_5, &ratio4_5, &ratio1_1, &ratio1_1, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio3_2, &ratio3_2, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio3_1, &ratio3_1, &ratio16_5, 
-&ratio16_5, &ratio16_5, &ratio16_5, &ratio4_1, &ratio4_1, &ratio24_5, &ratio24_5, &ratio24_5, &ratio24_5, &ratio6_1, &ratio6_1, &ratio32_5, 
-&ratio32_5, &ratio32_5, &ratio32_5, &ratio8_1, &ratio8_1, &ratio48_5, &ratio48_5, &ratio48_5, &ratio48_5, &ratio12_1, &ratio12_1, &ratio64_5, 
-&ratio64_5, &ratio64_5, &ratio64_5, &ratio16_1, &ratio16_1, &ratio96_5, &ratio96_5, &ratio96_5, &ratio96_5, &ratio24_1, &ratio24_1, &ratio128_5, 
-&ratio128_5, &ratio128_5, &ratio128_5, &ratio32_1, &ratio32_1, &ratio192_5, &ratio192_5}; 
-
-static const ScaleNote * const tetrad_inversionsd[128] = {&ratio1_40, &ratio1_40, &ratio1_40, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_20, &ratio1_20, 
-&ratio1_20, &ratio1_20, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_10, &ratio1_10, 
-&ratio1_10, &ratio1_10, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_5, &ratio1_5, 
-&ratio1_5, &ratio1_5, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio2_5, &ratio2_5, 
-&ratio2_5, &ratio2_5, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio4_5, &ratio4_5, 
-&ratio4_5, &ratio4_5, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio8_5, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio16_5, &ratio16_5, 
-&ratio16_5, &ratio16_5, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio32_5, &ratio32_5, 
-&ratio32_5, &ratio32_5, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio32_3, &ratio32_3, &ratio32_3, &ratio32_3, &ratio64_5, &ratio64_5, 
-&ratio64_5, &ratio64_5, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio64_3, &ratio64_3, &ratio64_3, &ratio64_3, &ratio128_5, &ratio128_5, 
-&ratio128_5, &ratio128_5, &ratio32_1, &ratio32_1, &ratio32_1, &ratio32_1, &ratio128_3}; 
-
-static const ScaleNote * const tetrad_inversionse[128] = {&ratio3_128, &ratio9_320, &ratio9_320, &ratio9_320, &ratio1_32, &ratio1_32, &ratio3_80, &ratio3_80, &ratio3_80, &ratio3_80, &ratio3_64, &ratio3_64, &ratio3_64, 
-&ratio9_160, &ratio9_160, &ratio9_160, &ratio1_16, &ratio1_16, &ratio3_40, &ratio3_40, &ratio3_40, &ratio3_40, &ratio3_32, &ratio3_32, &ratio3_32, 
-&ratio9_80, &ratio9_80, &ratio9_80, &ratio1_8, &ratio1_8, &ratio3_20, &ratio3_20, &ratio3_20, &ratio3_20, &ratio3_16, &ratio3_16, &ratio3_16, 
-&ratio9_40, &ratio9_40, &ratio9_40, &ratio1_4, &ratio1_4, &ratio3_10, &ratio3_10, &ratio3_10, &ratio3_10, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio9_20, &ratio9_20, &ratio9_20, &ratio1_2, &ratio1_2, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio9_10, &ratio9_10, &ratio9_10, &ratio1_1, &ratio1_1, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio9_5, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio18_5, &ratio18_5, &ratio18_5, &ratio4_1, &ratio4_1, &ratio24_5, &ratio24_5, &ratio24_5, &ratio24_5, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio36_5, &ratio36_5, &ratio36_5, &ratio8_1, &ratio8_1, &ratio48_5, &ratio48_5, &ratio48_5, &ratio48_5, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio72_5, &ratio72_5, &ratio72_5, &ratio16_1, &ratio16_1, &ratio96_5, &ratio96_5, &ratio96_5, &ratio96_5, &ratio24_1, &ratio24_1, &ratio24_1, 
-&ratio144_5, &ratio144_5, &ratio144_5, &ratio32_1, &ratio32_1, &ratio192_5, &ratio192_5}; 
-
-static const ScaleNote * const tetrad_inversionsf[128] = {&ratio1_40, &ratio1_40, &ratio1_40, &ratio1_40, &ratio1_32, &ratio1_32, &ratio3_80, &ratio3_80, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_20, &ratio1_20, 
-&ratio1_20, &ratio1_20, &ratio1_20, &ratio1_16, &ratio1_16, &ratio3_40, &ratio3_40, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_10, &ratio1_10, 
-&ratio1_10, &ratio1_10, &ratio1_10, &ratio1_8, &ratio1_8, &ratio3_20, &ratio3_20, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_5, &ratio1_5, 
-&ratio1_5, &ratio1_5, &ratio1_5, &ratio1_4, &ratio1_4, &ratio3_10, &ratio3_10, &ratio1_3, &ratio1_3, &ratio1_3, &ratio2_5, &ratio2_5, 
-&ratio2_5, &ratio2_5, &ratio2_5, &ratio1_2, &ratio1_2, &ratio3_5, &ratio3_5, &ratio2_3, &ratio2_3, &ratio2_3, &ratio4_5, &ratio4_5, 
-&ratio4_5, &ratio4_5, &ratio4_5, &ratio1_1, &ratio1_1, &ratio6_5, &ratio6_5, &ratio4_3, &ratio4_3, &ratio4_3, &ratio8_5, &ratio8_5, 
-&ratio8_5, &ratio8_5, &ratio8_5, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio8_3, &ratio8_3, &ratio8_3, &ratio16_5, &ratio16_5, 
-&ratio16_5, &ratio16_5, &ratio16_5, &ratio4_1, &ratio4_1, &ratio24_5, &ratio24_5, &ratio16_3, &ratio16_3, &ratio16_3, &ratio32_5, &ratio32_5, 
-&ratio32_5, &ratio32_5, &ratio32_5, &ratio8_1, &ratio8_1, &ratio48_5, &ratio48_5, &ratio32_3, &ratio32_3, &ratio32_3, &ratio64_5, &ratio64_5, 
-&ratio64_5, &ratio64_5, &ratio64_5, &ratio16_1, &ratio16_1, &ratio96_5, &ratio96_5, &ratio64_3, &ratio64_3, &ratio64_3, &ratio128_5, &ratio128_5, 
-&ratio128_5, &ratio128_5, &ratio128_5, &ratio32_1, &ratio32_1, &ratio192_5, &ratio192_5}; 
-
-static const ScaleNote * const tetrad_inversionsg[128] = {&ratio5_192, &ratio5_192, &ratio5_192, &ratio5_192, &ratio1_32, &ratio1_32, &ratio5_128, &ratio5_128, &ratio5_128, &ratio5_128, &ratio3_64, &ratio3_64, &ratio5_96, 
-&ratio5_96, &ratio5_96, &ratio5_96, &ratio1_16, &ratio1_16, &ratio5_64, &ratio5_64, &ratio5_64, &ratio5_64, &ratio3_32, &ratio3_32, &ratio5_48, 
-&ratio5_48, &ratio5_48, &ratio5_48, &ratio1_8, &ratio1_8, &ratio5_32, &ratio5_32, &ratio5_32, &ratio5_32, &ratio3_16, &ratio3_16, &ratio5_24, 
-&ratio5_24, &ratio5_24, &ratio5_24, &ratio1_4, &ratio1_4, &ratio5_16, &ratio5_16, &ratio5_16, &ratio5_16, &ratio3_8, &ratio3_8, &ratio5_12, 
-&ratio5_12, &ratio5_12, &ratio5_12, &ratio1_2, &ratio1_2, &ratio5_8, &ratio5_8, &ratio5_8, &ratio5_8, &ratio3_4, &ratio3_4, &ratio5_6, 
-&ratio5_6, &ratio5_6, &ratio5_6, &ratio1_1, &ratio1_1, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, &ratio3_1, &ratio10_3, 
-&ratio10_3, &ratio10_3, &ratio10_3, &ratio4_1, &ratio4_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio6_1, &ratio6_1, &ratio20_3, 
-&ratio20_3, &ratio20_3, &ratio20_3, &ratio8_1, &ratio8_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio12_1, &ratio12_1, &ratio40_3, 
-&ratio40_3, &ratio40_3, &ratio40_3, &ratio16_1, &ratio16_1, &ratio20_1, &ratio20_1, &ratio20_1, &ratio20_1, &ratio24_1, &ratio24_1, &ratio80_3, 
-&ratio80_3, &ratio80_3, &ratio80_3, &ratio32_1, &ratio32_1, &ratio40_1, &ratio40_1}; 
-
-static const ScaleNote * const tetrad_inversionsh[128] = {&ratio5_192, &ratio5_192, &ratio5_192, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio5_96, &ratio5_96, 
-&ratio5_96, &ratio5_96, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio5_48, &ratio5_48, 
-&ratio5_48, &ratio5_48, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio5_24, &ratio5_24, 
-&ratio5_24, &ratio5_24, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio5_12, &ratio5_12, 
-&ratio5_12, &ratio5_12, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio5_6, &ratio5_6, 
-&ratio5_6, &ratio5_6, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio10_3, &ratio10_3, 
-&ratio10_3, &ratio10_3, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio20_3, &ratio20_3, 
-&ratio20_3, &ratio20_3, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio32_3, &ratio32_3, &ratio32_3, &ratio32_3, &ratio40_3, &ratio40_3, 
-&ratio40_3, &ratio40_3, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio64_3, &ratio64_3, &ratio64_3, &ratio64_3, &ratio80_3, &ratio80_3, 
-&ratio80_3, &ratio80_3, &ratio32_1, &ratio32_1, &ratio32_1, &ratio32_1, &ratio128_3}; 
-
-static const ScaleNote * const tetrad_inversionsi[128] = {&ratio5_192, &ratio5_192, &ratio5_192, &ratio5_192, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_24, &ratio1_24, &ratio1_24, &ratio3_64, &ratio3_64, &ratio5_96, 
-&ratio5_96, &ratio5_96, &ratio5_96, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_12, &ratio1_12, &ratio1_12, &ratio3_32, &ratio3_32, &ratio5_48, 
-&ratio5_48, &ratio5_48, &ratio5_48, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_6, &ratio1_6, &ratio1_6, &ratio3_16, &ratio3_16, &ratio5_24, 
-&ratio5_24, &ratio5_24, &ratio5_24, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_3, &ratio1_3, &ratio1_3, &ratio3_8, &ratio3_8, &ratio5_12, 
-&ratio5_12, &ratio5_12, &ratio5_12, &ratio1_2, &ratio1_2, &ratio1_2, &ratio2_3, &ratio2_3, &ratio2_3, &ratio3_4, &ratio3_4, &ratio5_6, 
-&ratio5_6, &ratio5_6, &ratio5_6, &ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, &ratio4_3, &ratio4_3, &ratio3_2, &ratio3_2, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio8_3, &ratio8_3, &ratio8_3, &ratio3_1, &ratio3_1, &ratio10_3, 
-&ratio10_3, &ratio10_3, &ratio10_3, &ratio4_1, &ratio4_1, &ratio4_1, &ratio16_3, &ratio16_3, &ratio16_3, &ratio6_1, &ratio6_1, &ratio20_3, 
-&ratio20_3, &ratio20_3, &ratio20_3, &ratio8_1, &ratio8_1, &ratio8_1, &ratio32_3, &ratio32_3, &ratio32_3, &ratio12_1, &ratio12_1, &ratio40_3, 
-&ratio40_3, &ratio40_3, &ratio40_3, &ratio16_1, &ratio16_1, &ratio16_1, &ratio64_3, &ratio64_3, &ratio64_3, &ratio24_1, &ratio24_1, &ratio80_3, 
-&ratio80_3, &ratio80_3, &ratio80_3, &ratio32_1, &ratio32_1, &ratio32_1, &ratio128_3}; 
-
-static const ScaleNote * const tetrad_inversionsj[128] = {&ratio1_36, &ratio1_36, &ratio1_36, &ratio1_36, &ratio1_32, &ratio5_144, &ratio5_144, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_18, &ratio1_18, 
-&ratio1_18, &ratio1_18, &ratio1_18, &ratio1_16, &ratio5_72, &ratio5_72, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_9, &ratio1_9, 
-&ratio1_9, &ratio1_9, &ratio1_9, &ratio1_8, &ratio5_36, &ratio5_36, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio2_9, &ratio2_9, 
-&ratio2_9, &ratio2_9, &ratio2_9, &ratio1_4, &ratio5_18, &ratio5_18, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio4_9, &ratio4_9, 
-&ratio4_9, &ratio4_9, &ratio4_9, &ratio1_2, &ratio5_9, &ratio5_9, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio8_9, &ratio8_9, 
-&ratio8_9, &ratio8_9, &ratio8_9, &ratio1_1, &ratio10_9, &ratio10_9, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio16_9, &ratio16_9, 
-&ratio16_9, &ratio16_9, &ratio16_9, &ratio2_1, &ratio20_9, &ratio20_9, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio32_9, &ratio32_9, 
-&ratio32_9, &ratio32_9, &ratio32_9, &ratio4_1, &ratio40_9, &ratio40_9, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio64_9, &ratio64_9, 
-&ratio64_9, &ratio64_9, &ratio64_9, &ratio8_1, &ratio80_9, &ratio80_9, &ratio32_3, &ratio32_3, &ratio32_3, &ratio32_3, &ratio128_9, &ratio128_9, 
-&ratio128_9, &ratio128_9, &ratio128_9, &ratio16_1, &ratio160_9, &ratio160_9, &ratio64_3, &ratio64_3, &ratio64_3, &ratio64_3, &ratio256_9, &ratio256_9, 
-&ratio256_9, &ratio256_9, &ratio256_9, &ratio32_1, &ratio320_9, &ratio320_9, &ratio128_3}; 
-
-static const ScaleNote * const tetrad_inversionsk[128] = {&ratio3_128, &ratio3_128, &ratio3_128, &ratio3_128, &ratio1_32, &ratio1_32, &ratio9_256, &ratio5_128, &ratio5_128, &ratio5_128, &ratio3_64, &ratio3_64, &ratio3_64, 
-&ratio3_64, &ratio3_64, &ratio3_64, &ratio1_16, &ratio1_16, &ratio9_128, &ratio5_64, &ratio5_64, &ratio5_64, &ratio3_32, &ratio3_32, &ratio3_32, 
-&ratio3_32, &ratio3_32, &ratio3_32, &ratio1_8, &ratio1_8, &ratio9_64, &ratio5_32, &ratio5_32, &ratio5_32, &ratio3_16, &ratio3_16, &ratio3_16, 
-&ratio3_16, &ratio3_16, &ratio3_16, &ratio1_4, &ratio1_4, &ratio9_32, &ratio5_16, &ratio5_16, &ratio5_16, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio1_2, &ratio1_2, &ratio9_16, &ratio5_8, &ratio5_8, &ratio5_8, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio1_1, &ratio1_1, &ratio9_8, &ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio2_1, &ratio2_1, &ratio9_4, &ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio4_1, &ratio4_1, &ratio9_2, &ratio5_1, &ratio5_1, &ratio5_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio8_1, &ratio8_1, &ratio9_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio12_1, &ratio12_1, &ratio12_1, &ratio16_1, &ratio16_1, &ratio18_1, &ratio20_1, &ratio20_1, &ratio20_1, &ratio24_1, &ratio24_1, &ratio24_1, 
-&ratio24_1, &ratio24_1, &ratio24_1, &ratio32_1, &ratio32_1, &ratio36_1, &ratio40_1}; 
-
-static const ScaleNote * const tetrad_inversionsl[128] = {&ratio1_40, &ratio1_40, &ratio9_320, &ratio9_320, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_20, &ratio1_20, &ratio1_20, &ratio1_20, 
-&ratio1_20, &ratio9_160, &ratio9_160, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_10, &ratio1_10, &ratio1_10, &ratio1_10, 
-&ratio1_10, &ratio9_80, &ratio9_80, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_5, &ratio1_5, &ratio1_5, &ratio1_5, 
-&ratio1_5, &ratio9_40, &ratio9_40, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio2_5, &ratio2_5, &ratio2_5, &ratio2_5, 
-&ratio2_5, &ratio9_20, &ratio9_20, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio4_5, &ratio4_5, &ratio4_5, &ratio4_5, 
-&ratio4_5, &ratio9_10, &ratio9_10, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio8_5, &ratio8_5, &ratio8_5, &ratio8_5, 
-&ratio8_5, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio16_5, &ratio16_5, &ratio16_5, &ratio16_5, 
-&ratio16_5, &ratio18_5, &ratio18_5, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio32_5, &ratio32_5, &ratio32_5, &ratio32_5, 
-&ratio32_5, &ratio36_5, &ratio36_5, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio64_5, &ratio64_5, &ratio64_5, &ratio64_5, 
-&ratio64_5, &ratio72_5, &ratio72_5, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio128_5, &ratio128_5, &ratio128_5, &ratio128_5, 
-&ratio128_5, &ratio144_5, &ratio144_5, &ratio32_1, &ratio32_1, &ratio32_1, &ratio32_1}; 
-
-static const ScaleNote * const tetrad_inversionsm[128] = {&ratio3_128, &ratio3_128, &ratio3_128, &ratio3_128, &ratio1_32, &ratio1_32, &ratio9_256, &ratio5_128, &ratio5_128, &ratio5_128, &ratio3_64, &ratio3_64, &ratio3_64, 
-&ratio3_64, &ratio3_64, &ratio3_64, &ratio1_16, &ratio1_16, &ratio9_128, &ratio5_64, &ratio5_64, &ratio5_64, &ratio3_32, &ratio3_32, &ratio3_32, 
-&ratio3_32, &ratio3_32, &ratio3_32, &ratio1_8, &ratio1_8, &ratio9_64, &ratio5_32, &ratio5_32, &ratio5_32, &ratio3_16, &ratio3_16, &ratio3_16, 
-&ratio3_16, &ratio3_16, &ratio3_16, &ratio1_4, &ratio1_4, &ratio9_32, &ratio5_16, &ratio5_16, &ratio5_16, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio1_2, &ratio1_2, &ratio9_16, &ratio5_8, &ratio5_8, &ratio5_8, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio1_1, &ratio1_1, &ratio9_8, &ratio5_4, &ratio5_4, &ratio5_4, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio2_1, &ratio2_1, &ratio9_4, &ratio5_2, &ratio5_2, &ratio5_2, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio4_1, &ratio4_1, &ratio9_2, &ratio5_1, &ratio5_1, &ratio5_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio8_1, &ratio8_1, &ratio9_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio12_1, &ratio12_1, &ratio12_1, &ratio16_1, &ratio16_1, &ratio18_1, &ratio20_1, &ratio20_1, &ratio20_1, &ratio24_1, &ratio24_1, &ratio24_1, 
-&ratio24_1, &ratio24_1, &ratio24_1, &ratio32_1, &ratio32_1, &ratio36_1, &ratio40_1}; 
-
-static const ScaleNote * const tetrad_inversionsn[128] = {&ratio5_192, &ratio5_192, &ratio5_192, &ratio5_192, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_24, &ratio1_24, &ratio1_24, &ratio3_64, &ratio3_64, &ratio5_96, 
-&ratio5_96, &ratio5_96, &ratio5_96, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_12, &ratio1_12, &ratio1_12, &ratio3_32, &ratio3_32, &ratio5_48, 
-&ratio5_48, &ratio5_48, &ratio5_48, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_6, &ratio1_6, &ratio1_6, &ratio3_16, &ratio3_16, &ratio5_24, 
-&ratio5_24, &ratio5_24, &ratio5_24, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_3, &ratio1_3, &ratio1_3, &ratio3_8, &ratio3_8, &ratio5_12, 
-&ratio5_12, &ratio5_12, &ratio5_12, &ratio1_2, &ratio1_2, &ratio1_2, &ratio2_3, &ratio2_3, &ratio2_3, &ratio3_4, &ratio3_4, &ratio5_6, 
-&ratio5_6, &ratio5_6, &ratio5_6, &ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, &ratio4_3, &ratio4_3, &ratio3_2, &ratio3_2, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio8_3, &ratio8_3, &ratio8_3, &ratio3_1, &ratio3_1, &ratio10_3, 
-&ratio10_3, &ratio10_3, &ratio10_3, &ratio4_1, &ratio4_1, &ratio4_1, &ratio16_3, &ratio16_3, &ratio16_3, &ratio6_1, &ratio6_1, &ratio20_3, 
-&ratio20_3, &ratio20_3, &ratio20_3, &ratio8_1, &ratio8_1, &ratio8_1, &ratio32_3, &ratio32_3, &ratio32_3, &ratio12_1, &ratio12_1, &ratio40_3, 
-&ratio40_3, &ratio40_3, &ratio40_3, &ratio16_1, &ratio16_1, &ratio16_1, &ratio64_3, &ratio64_3, &ratio64_3, &ratio24_1, &ratio24_1, &ratio80_3, 
-&ratio80_3, &ratio80_3, &ratio80_3, &ratio32_1, &ratio32_1, &ratio32_1, &ratio128_3}; 
-
-static const ScaleNote * const tetrad_inversionso[128] = {&ratio1_40, &ratio1_40, &ratio9_320, &ratio9_320, &ratio1_32, &ratio1_32, &ratio3_80, &ratio3_80, &ratio3_80, &ratio3_80, &ratio1_20, &ratio1_20, &ratio1_20, 
-&ratio1_20, &ratio9_160, &ratio9_160, &ratio1_16, &ratio1_16, &ratio3_40, &ratio3_40, &ratio3_40, &ratio3_40, &ratio1_10, &ratio1_10, &ratio1_10, 
-&ratio1_10, &ratio9_80, &ratio9_80, &ratio1_8, &ratio1_8, &ratio3_20, &ratio3_20, &ratio3_20, &ratio3_20, &ratio1_5, &ratio1_5, &ratio1_5, 
-&ratio1_5, &ratio9_40, &ratio9_40, &ratio1_4, &ratio1_4, &ratio3_10, &ratio3_10, &ratio3_10, &ratio3_10, &ratio2_5, &ratio2_5, &ratio2_5, 
-&ratio2_5, &ratio9_20, &ratio9_20, &ratio1_2, &ratio1_2, &ratio3_5, &ratio3_5, &ratio3_5, &ratio3_5, &ratio4_5, &ratio4_5, &ratio4_5, 
-&ratio4_5, &ratio9_10, &ratio9_10, &ratio1_1, &ratio1_1, &ratio6_5, &ratio6_5, &ratio6_5, &ratio6_5, &ratio8_5, &ratio8_5, &ratio8_5, 
-&ratio8_5, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio12_5, &ratio12_5, &ratio16_5, &ratio16_5, &ratio16_5, 
-&ratio16_5, &ratio18_5, &ratio18_5, &ratio4_1, &ratio4_1, &ratio24_5, &ratio24_5, &ratio24_5, &ratio24_5, &ratio32_5, &ratio32_5, &ratio32_5, 
-&ratio32_5, &ratio36_5, &ratio36_5, &ratio8_1, &ratio8_1, &ratio48_5, &ratio48_5, &ratio48_5, &ratio48_5, &ratio64_5, &ratio64_5, &ratio64_5, 
-&ratio64_5, &ratio72_5, &ratio72_5, &ratio16_1, &ratio16_1, &ratio96_5, &ratio96_5, &ratio96_5, &ratio96_5, &ratio128_5, &ratio128_5, &ratio128_5, 
-&ratio128_5, &ratio144_5, &ratio144_5, &ratio32_1, &ratio32_1, &ratio192_5, &ratio192_5}; 
-
-static const ScaleNote * const tetrad_inversionsp[128] = {&ratio1_48, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_32, &ratio5_144, &ratio5_144, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, 
-&ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio5_72, &ratio5_72, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, 
-&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio5_36, &ratio5_36, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio5_18, &ratio5_18, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio5_9, &ratio5_9, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio10_9, &ratio10_9, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio20_9, &ratio20_9, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio40_9, &ratio40_9, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, 
-&ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio80_9, &ratio80_9, &ratio32_3, &ratio32_3, &ratio32_3, &ratio32_3, &ratio32_3, &ratio32_3, 
-&ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio160_9, &ratio160_9, &ratio64_3, &ratio64_3, &ratio64_3, &ratio64_3, &ratio64_3, &ratio64_3, 
-&ratio32_1, &ratio32_1, &ratio32_1, &ratio32_1, &ratio320_9, &ratio320_9, &ratio128_3}; 
-
-
-
-static const ScaleNote * const harmonic_entropyA[128] = {&ratio3_128, &ratio3_128, &ratio3_128, &ratio3_128, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_32, &ratio3_64, &ratio3_64, &ratio3_64, &ratio3_64, &ratio3_64, 
-&ratio3_64, &ratio3_64, &ratio3_64, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio3_32, &ratio3_32, &ratio3_32, &ratio3_32, &ratio3_32, 
-&ratio3_32, &ratio3_32, &ratio3_32, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, 
-&ratio3_16, &ratio3_16, &ratio3_16, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio12_1, &ratio12_1, &ratio12_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, 
-&ratio24_1, &ratio24_1, &ratio24_1, &ratio32_1, &ratio32_1, &ratio32_1, &ratio32_1}; 
-
-static const ScaleNote * const harmonic_entropyB[128] = {&ratio5_192, &ratio5_192, &ratio5_192, &ratio5_192, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_24, &ratio1_24, &ratio1_24, &ratio3_64, &ratio3_64, &ratio5_96, 
-&ratio5_96, &ratio5_96, &ratio5_96, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_12, &ratio1_12, &ratio1_12, &ratio3_32, &ratio3_32, &ratio5_48, 
-&ratio5_48, &ratio5_48, &ratio5_48, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_6, &ratio1_6, &ratio1_6, &ratio3_16, &ratio3_16, &ratio5_24, 
-&ratio5_24, &ratio5_24, &ratio5_24, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_3, &ratio1_3, &ratio1_3, &ratio3_8, &ratio3_8, &ratio5_12, 
-&ratio5_12, &ratio5_12, &ratio5_12, &ratio1_2, &ratio1_2, &ratio1_2, &ratio2_3, &ratio2_3, &ratio2_3, &ratio3_4, &ratio3_4, &ratio5_6, 
-&ratio5_6, &ratio5_6, &ratio5_6, &ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, &ratio4_3, &ratio4_3, &ratio3_2, &ratio3_2, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio8_3, &ratio8_3, &ratio8_3, &ratio3_1, &ratio3_1, &ratio10_3, 
-&ratio10_3, &ratio10_3, &ratio10_3, &ratio4_1, &ratio4_1, &ratio4_1, &ratio16_3, &ratio16_3, &ratio16_3, &ratio6_1, &ratio6_1, &ratio20_3, 
-&ratio20_3, &ratio20_3, &ratio20_3, &ratio8_1, &ratio8_1, &ratio8_1, &ratio32_3, &ratio32_3, &ratio32_3, &ratio12_1, &ratio12_1, &ratio40_3, 
-&ratio40_3, &ratio40_3, &ratio40_3, &ratio16_1, &ratio16_1, &ratio16_1, &ratio64_3, &ratio64_3, &ratio64_3, &ratio24_1, &ratio24_1, &ratio80_3, 
-&ratio80_3, &ratio80_3, &ratio80_3, &ratio32_1, &ratio32_1, &ratio32_1, &ratio128_3}; 
-
-static const ScaleNote * const harmonic_entropyC[128] = {&ratio5_192, &ratio7_256, &ratio7_256, &ratio7_256, &ratio1_32, &ratio1_32, &ratio5_128, &ratio5_128, &ratio1_24, &ratio1_24, &ratio3_64, &ratio3_64, &ratio5_96, 
-&ratio7_128, &ratio7_128, &ratio7_128, &ratio1_16, &ratio1_16, &ratio5_64, &ratio5_64, &ratio1_12, &ratio1_12, &ratio3_32, &ratio3_32, &ratio5_48, 
-&ratio7_64, &ratio7_64, &ratio7_64, &ratio1_8, &ratio1_8, &ratio5_32, &ratio5_32, &ratio1_6, &ratio1_6, &ratio3_16, &ratio3_16, &ratio5_24, 
-&ratio7_32, &ratio7_32, &ratio7_32, &ratio1_4, &ratio1_4, &ratio5_16, &ratio5_16, &ratio1_3, &ratio1_3, &ratio3_8, &ratio3_8, &ratio5_12, 
-&ratio7_16, &ratio7_16, &ratio7_16, &ratio1_2, &ratio1_2, &ratio5_8, &ratio5_8, &ratio2_3, &ratio2_3, &ratio3_4, &ratio3_4, &ratio5_6, 
-&ratio7_8, &ratio7_8, &ratio7_8, &ratio1_1, &ratio1_1, &ratio5_4, &ratio5_4, &ratio4_3, &ratio4_3, &ratio3_2, &ratio3_2, &ratio5_3, 
-&ratio7_4, &ratio7_4, &ratio7_4, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio8_3, &ratio8_3, &ratio3_1, &ratio3_1, &ratio10_3, 
-&ratio7_2, &ratio7_2, &ratio7_2, &ratio4_1, &ratio4_1, &ratio5_1, &ratio5_1, &ratio16_3, &ratio16_3, &ratio6_1, &ratio6_1, &ratio20_3, 
-&ratio7_1, &ratio7_1, &ratio7_1, &ratio8_1, &ratio8_1, &ratio10_1, &ratio10_1, &ratio32_3, &ratio32_3, &ratio12_1, &ratio12_1, &ratio40_3, 
-&ratio14_1, &ratio14_1, &ratio14_1, &ratio16_1, &ratio16_1, &ratio20_1, &ratio20_1, &ratio64_3, &ratio64_3, &ratio24_1, &ratio24_1, &ratio80_3, 
-&ratio28_1, &ratio28_1, &ratio28_1, &ratio32_1, &ratio32_1, &ratio40_1, &ratio40_1}; 
-
-static const ScaleNote * const harmonic_entropyD[128] = {&ratio1_40, &ratio7_256, &ratio9_320, &ratio9_320, &ratio1_32, &ratio1_32, &ratio3_80, &ratio3_80, &ratio1_24, &ratio7_160, &ratio7_160, &ratio3_64, &ratio1_20, 
-&ratio7_128, &ratio9_160, &ratio9_160, &ratio1_16, &ratio1_16, &ratio3_40, &ratio3_40, &ratio1_12, &ratio7_80, &ratio7_80, &ratio3_32, &ratio1_10, 
-&ratio7_64, &ratio9_80, &ratio9_80, &ratio1_8, &ratio1_8, &ratio3_20, &ratio3_20, &ratio1_6, &ratio7_40, &ratio7_40, &ratio3_16, &ratio1_5, 
-&ratio7_32, &ratio9_40, &ratio9_40, &ratio1_4, &ratio1_4, &ratio3_10, &ratio3_10, &ratio1_3, &ratio7_20, &ratio7_20, &ratio3_8, &ratio2_5, 
-&ratio7_16, &ratio9_20, &ratio9_20, &ratio1_2, &ratio1_2, &ratio3_5, &ratio3_5, &ratio2_3, &ratio7_10, &ratio7_10, &ratio3_4, &ratio4_5, 
-&ratio7_8, &ratio9_10, &ratio9_10, &ratio1_1, &ratio1_1, &ratio6_5, &ratio6_5, &ratio4_3, &ratio7_5, &ratio7_5, &ratio3_2, &ratio8_5, 
-&ratio7_4, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio8_3, &ratio14_5, &ratio14_5, &ratio3_1, &ratio16_5, 
-&ratio7_2, &ratio18_5, &ratio18_5, &ratio4_1, &ratio4_1, &ratio24_5, &ratio24_5, &ratio16_3, &ratio28_5, &ratio28_5, &ratio6_1, &ratio32_5, 
-&ratio7_1, &ratio36_5, &ratio36_5, &ratio8_1, &ratio8_1, &ratio48_5, &ratio48_5, &ratio32_3, &ratio56_5, &ratio56_5, &ratio12_1, &ratio64_5, 
-&ratio14_1, &ratio72_5, &ratio72_5, &ratio16_1, &ratio16_1, &ratio96_5, &ratio96_5, &ratio64_3, &ratio112_5, &ratio112_5, &ratio24_1, &ratio128_5, 
-&ratio28_1, &ratio144_5, &ratio144_5, &ratio32_1, &ratio32_1, &ratio192_5, &ratio192_5}; 
-
-static const ScaleNote * const harmonic_entropyE[128] = {&ratio13_512, &ratio3_112, &ratio9_320, &ratio9_320, &ratio1_32, &ratio1_32, &ratio3_80, &ratio3_80, &ratio9_224, &ratio11_256, &ratio5_112, &ratio11_224, &ratio13_256, 
-&ratio3_56, &ratio9_160, &ratio9_160, &ratio1_16, &ratio1_16, &ratio3_40, &ratio3_40, &ratio9_112, &ratio11_128, &ratio5_56, &ratio11_112, &ratio13_128, 
-&ratio3_28, &ratio9_80, &ratio9_80, &ratio1_8, &ratio1_8, &ratio3_20, &ratio3_20, &ratio9_56, &ratio11_64, &ratio5_28, &ratio11_56, &ratio13_64, 
-&ratio3_14, &ratio9_40, &ratio9_40, &ratio1_4, &ratio1_4, &ratio3_10, &ratio3_10, &ratio9_28, &ratio11_32, &ratio5_14, &ratio11_28, &ratio13_32, 
-&ratio3_7, &ratio9_20, &ratio9_20, &ratio1_2, &ratio1_2, &ratio3_5, &ratio3_5, &ratio9_14, &ratio11_16, &ratio5_7, &ratio11_14, &ratio13_16, 
-&ratio6_7, &ratio9_10, &ratio9_10, &ratio1_1, &ratio1_1, &ratio6_5, &ratio6_5, &ratio9_7, &ratio11_8, &ratio10_7, &ratio11_7, &ratio13_8, 
-&ratio12_7, &ratio9_5, &ratio9_5, &ratio2_1, &ratio2_1, &ratio12_5, &ratio12_5, &ratio18_7, &ratio11_4, &ratio20_7, &ratio22_7, &ratio13_4, 
-&ratio24_7, &ratio18_5, &ratio18_5, &ratio4_1, &ratio4_1, &ratio24_5, &ratio24_5, &ratio36_7, &ratio11_2, &ratio40_7, &ratio44_7, &ratio13_2, 
-&ratio48_7, &ratio36_5, &ratio36_5, &ratio8_1, &ratio8_1, &ratio48_5, &ratio48_5, &ratio72_7, &ratio11_1, &ratio80_7, &ratio88_7, &ratio13_1, 
-&ratio96_7, &ratio72_5, &ratio72_5, &ratio16_1, &ratio16_1, &ratio96_5, &ratio96_5, &ratio144_7, &ratio22_1, &ratio160_7, &ratio176_7, &ratio26_1, 
-&ratio192_7, &ratio144_5, &ratio144_5, &ratio32_1, &ratio32_1, &ratio192_5, &ratio192_5}; 
-
-static const ScaleNote * const harmonic_entropyF[128] = {&ratio1_40, &ratio7_256, &ratio7_256, &ratio7_256, &ratio1_32, &ratio1_32, &ratio5_128, &ratio5_128, &ratio5_128, &ratio7_160, &ratio7_160, &ratio1_20, &ratio1_20, 
-&ratio7_128, &ratio7_128, &ratio7_128, &ratio1_16, &ratio1_16, &ratio5_64, &ratio5_64, &ratio5_64, &ratio7_80, &ratio7_80, &ratio1_10, &ratio1_10, 
-&ratio7_64, &ratio7_64, &ratio7_64, &ratio1_8, &ratio1_8, &ratio5_32, &ratio5_32, &ratio5_32, &ratio7_40, &ratio7_40, &ratio1_5, &ratio1_5, 
-&ratio7_32, &ratio7_32, &ratio7_32, &ratio1_4, &ratio1_4, &ratio5_16, &ratio5_16, &ratio5_16, &ratio7_20, &ratio7_20, &ratio2_5, &ratio2_5, 
-&ratio7_16, &ratio7_16, &ratio7_16, &ratio1_2, &ratio1_2, &ratio5_8, &ratio5_8, &ratio5_8, &ratio7_10, &ratio7_10, &ratio4_5, &ratio4_5, 
-&ratio7_8, &ratio7_8, &ratio7_8, &ratio1_1, &ratio1_1, &ratio5_4, &ratio5_4, &ratio5_4, &ratio7_5, &ratio7_5, &ratio8_5, &ratio8_5, 
-&ratio7_4, &ratio7_4, &ratio7_4, &ratio2_1, &ratio2_1, &ratio5_2, &ratio5_2, &ratio5_2, &ratio14_5, &ratio14_5, &ratio16_5, &ratio16_5, 
-&ratio7_2, &ratio7_2, &ratio7_2, &ratio4_1, &ratio4_1, &ratio5_1, &ratio5_1, &ratio5_1, &ratio28_5, &ratio28_5, &ratio32_5, &ratio32_5, 
-&ratio7_1, &ratio7_1, &ratio7_1, &ratio8_1, &ratio8_1, &ratio10_1, &ratio10_1, &ratio10_1, &ratio56_5, &ratio56_5, &ratio64_5, &ratio64_5, 
-&ratio14_1, &ratio14_1, &ratio14_1, &ratio16_1, &ratio16_1, &ratio20_1, &ratio20_1, &ratio20_1, &ratio112_5, &ratio112_5, &ratio128_5, &ratio128_5, 
-&ratio28_1, &ratio28_1, &ratio28_1, &ratio32_1, &ratio32_1, &ratio40_1, &ratio40_1}; 
-
-static const ScaleNote * const harmonic_entropyG[128] = {&ratio5_192, &ratio5_192, &ratio5_192, &ratio5_192, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio5_96, &ratio5_96, 
-&ratio5_96, &ratio5_96, &ratio5_96, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio5_48, &ratio5_48, 
-&ratio5_48, &ratio5_48, &ratio5_48, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio5_24, &ratio5_24, 
-&ratio5_24, &ratio5_24, &ratio5_24, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio5_12, &ratio5_12, 
-&ratio5_12, &ratio5_12, &ratio5_12, &ratio1_2, &ratio1_2, &ratio1_2, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio5_6, &ratio5_6, 
-&ratio5_6, &ratio5_6, &ratio5_6, &ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio5_3, &ratio5_3, 
-&ratio5_3, &ratio5_3, &ratio5_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio10_3, &ratio10_3, 
-&ratio10_3, &ratio10_3, &ratio10_3, &ratio4_1, &ratio4_1, &ratio4_1, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio20_3, &ratio20_3, 
-&ratio20_3, &ratio20_3, &ratio20_3, &ratio8_1, &ratio8_1, &ratio8_1, &ratio32_3, &ratio32_3, &ratio32_3, &ratio32_3, &ratio40_3, &ratio40_3, 
-&ratio40_3, &ratio40_3, &ratio40_3, &ratio16_1, &ratio16_1, &ratio16_1, &ratio64_3, &ratio64_3, &ratio64_3, &ratio64_3, &ratio80_3, &ratio80_3, 
-&ratio80_3, &ratio80_3, &ratio80_3, &ratio32_1, &ratio32_1, &ratio32_1, &ratio128_3}; 
-
-static const ScaleNote * const harmonic_entropyH[128] = {&ratio3_128, &ratio3_128, &ratio3_128, &ratio3_128, &ratio1_32, &ratio1_32, &ratio1_32, &ratio1_24, &ratio1_24, &ratio1_24, &ratio3_64, &ratio3_64, &ratio3_64, 
-&ratio3_64, &ratio3_64, &ratio3_64, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_12, &ratio1_12, &ratio1_12, &ratio3_32, &ratio3_32, &ratio3_32, 
-&ratio3_32, &ratio3_32, &ratio3_32, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_6, &ratio1_6, &ratio1_6, &ratio3_16, &ratio3_16, &ratio3_16, 
-&ratio3_16, &ratio3_16, &ratio3_16, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_3, &ratio1_3, &ratio1_3, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio1_2, &ratio1_2, &ratio1_2, &ratio2_3, &ratio2_3, &ratio2_3, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, &ratio4_3, &ratio4_3, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio2_1, &ratio2_1, &ratio2_1, &ratio8_3, &ratio8_3, &ratio8_3, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio16_3, &ratio16_3, &ratio16_3, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio32_3, &ratio32_3, &ratio32_3, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio12_1, &ratio12_1, &ratio12_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio64_3, &ratio64_3, &ratio64_3, &ratio24_1, &ratio24_1, &ratio24_1, 
-&ratio24_1, &ratio24_1, &ratio24_1, &ratio32_1, &ratio32_1, &ratio32_1, &ratio128_3}; 
-
-
-
-static const ScaleNote * const bohlenPeirceAScalevoct[128] = {&ratio49_2025, &ratio5_189, &ratio5_189, &ratio7_243, &ratio7_243, &ratio7_225, &ratio7_225, &ratio1_27, &ratio1_25, &ratio1_21, &ratio7_135, &ratio7_135, &ratio5_108, 
-&ratio5_108, &ratio5_108, &ratio5_108, &ratio5_108, &ratio1_15, &ratio1_15, &ratio49_675, &ratio5_63, &ratio5_63, &ratio7_81, &ratio7_81, &ratio7_75, 
-&ratio7_75, &ratio1_9, &ratio3_25, &ratio1_7, &ratio7_45, &ratio7_45, &ratio5_36, &ratio5_36, &ratio5_36, &ratio5_36, &ratio5_36, &ratio1_5, 
-&ratio1_5, &ratio49_225, &ratio5_21, &ratio5_21, &ratio7_27, &ratio7_27, &ratio7_25, &ratio7_25, &ratio1_3, &ratio9_25, &ratio3_7, &ratio7_15, 
-&ratio7_15, &ratio5_12, &ratio5_12, &ratio5_12, &ratio5_12, &ratio5_12, &ratio3_5, &ratio3_5, &ratio49_75, &ratio5_7, &ratio5_7, &ratio7_9, 
-&ratio7_9, &ratio21_25, &ratio21_25, &ratio1_1, &ratio27_25, &ratio9_7, &ratio7_5, &ratio7_5, &ratio5_4, &ratio5_4, &ratio5_4, &ratio5_4, 
-&ratio5_4, &ratio9_5, &ratio9_5, &ratio49_25, &ratio15_7, &ratio15_7, &ratio7_3, &ratio7_3, &ratio63_25, &ratio63_25, &ratio3_1, &ratio81_25, 
-&ratio27_7, &ratio21_5, &ratio21_5, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio15_4, &ratio27_5, &ratio27_5, &ratio147_25, &ratio45_7, 
-&ratio45_7, &ratio7_1, &ratio7_1, &ratio189_25, &ratio189_25, &ratio9_1, &ratio243_25, &ratio81_7, &ratio63_5, &ratio63_5, &ratio45_4, &ratio45_4, 
-&ratio45_4, &ratio45_4, &ratio45_4, &ratio81_5, &ratio81_5, &ratio441_25, &ratio135_7, &ratio135_7, &ratio21_1, &ratio21_1, &ratio567_25, &ratio567_25, 
-&ratio27_1, &ratio729_25, &ratio243_7, &ratio189_5, &ratio189_5, &ratio135_4, &ratio135_4}; 
-
-static const ScaleNote * const bohlenPeirceBlueLambdavoct[128] = {&ratio7_243, &ratio7_243, &ratio7_243, &ratio7_243, &ratio25_729, &ratio25_729, &ratio25_729, &ratio1_27, &ratio25_567, &ratio1_21, &ratio7_135, &ratio7_135, &ratio7_135, 
-&ratio5_81, &ratio1_15, &ratio1_15, &ratio49_675, &ratio49_675, &ratio49_675, &ratio7_81, &ratio7_81, &ratio7_81, &ratio7_81, &ratio25_243, &ratio25_243, 
-&ratio25_243, &ratio1_9, &ratio25_189, &ratio1_7, &ratio7_45, &ratio7_45, &ratio7_45, &ratio5_27, &ratio1_5, &ratio1_5, &ratio49_225, &ratio49_225, 
-&ratio49_225, &ratio7_27, &ratio7_27, &ratio7_27, &ratio7_27, &ratio25_81, &ratio25_81, &ratio25_81, &ratio1_3, &ratio25_63, &ratio3_7, &ratio7_15, 
-&ratio7_15, &ratio7_15, &ratio5_9, &ratio3_5, &ratio3_5, &ratio49_75, &ratio49_75, &ratio49_75, &ratio7_9, &ratio7_9, &ratio7_9, &ratio7_9, 
-&ratio25_27, &ratio25_27, &ratio25_27, &ratio1_1, &ratio25_21, &ratio9_7, &ratio7_5, &ratio7_5, &ratio7_5, &ratio5_3, &ratio9_5, &ratio9_5, 
-&ratio49_25, &ratio49_25, &ratio49_25, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio25_9, &ratio25_9, &ratio25_9, &ratio3_1, &ratio25_7, 
-&ratio27_7, &ratio21_5, &ratio21_5, &ratio21_5, &ratio5_1, &ratio27_5, &ratio27_5, &ratio147_25, &ratio147_25, &ratio147_25, &ratio7_1, &ratio7_1, 
-&ratio7_1, &ratio7_1, &ratio25_3, &ratio25_3, &ratio25_3, &ratio9_1, &ratio75_7, &ratio81_7, &ratio63_5, &ratio63_5, &ratio63_5, &ratio15_1, 
-&ratio81_5, &ratio81_5, &ratio441_25, &ratio441_25, &ratio441_25, &ratio21_1, &ratio21_1, &ratio21_1, &ratio21_1, &ratio25_1, &ratio25_1, &ratio25_1, 
-&ratio27_1, &ratio225_7, &ratio243_7, &ratio189_5, &ratio189_5, &ratio189_5, &ratio45_1}; 
-
-static const ScaleNote * const bohlenPeirceDurIvoct[128] = {&ratio7_243, &ratio7_243, &ratio7_225, &ratio7_225, &ratio7_225, &ratio7_225, &ratio7_225, &ratio1_27, &ratio1_25, &ratio1_21, &ratio7_135, &ratio7_135, &ratio7_135, 
-&ratio5_81, &ratio1_15, &ratio1_15, &ratio49_675, &ratio49_675, &ratio49_675, &ratio7_81, &ratio7_81, &ratio7_75, &ratio7_75, &ratio7_75, &ratio7_75, 
-&ratio7_75, &ratio1_9, &ratio3_25, &ratio1_7, &ratio7_45, &ratio7_45, &ratio7_45, &ratio5_27, &ratio1_5, &ratio1_5, &ratio49_225, &ratio49_225, 
-&ratio49_225, &ratio7_27, &ratio7_27, &ratio7_25, &ratio7_25, &ratio7_25, &ratio7_25, &ratio7_25, &ratio1_3, &ratio9_25, &ratio3_7, &ratio7_15, 
-&ratio7_15, &ratio7_15, &ratio5_9, &ratio3_5, &ratio3_5, &ratio49_75, &ratio49_75, &ratio49_75, &ratio7_9, &ratio7_9, &ratio21_25, &ratio21_25, 
-&ratio21_25, &ratio21_25, &ratio21_25, &ratio1_1, &ratio27_25, &ratio9_7, &ratio7_5, &ratio7_5, &ratio7_5, &ratio5_3, &ratio9_5, &ratio9_5, 
-&ratio49_25, &ratio49_25, &ratio49_25, &ratio7_3, &ratio7_3, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio3_1, &ratio81_25, 
-&ratio27_7, &ratio21_5, &ratio21_5, &ratio21_5, &ratio5_1, &ratio27_5, &ratio27_5, &ratio147_25, &ratio147_25, &ratio147_25, &ratio7_1, &ratio7_1, 
-&ratio189_25, &ratio189_25, &ratio189_25, &ratio189_25, &ratio189_25, &ratio9_1, &ratio243_25, &ratio81_7, &ratio63_5, &ratio63_5, &ratio63_5, &ratio15_1, 
-&ratio81_5, &ratio81_5, &ratio441_25, &ratio441_25, &ratio441_25, &ratio21_1, &ratio21_1, &ratio567_25, &ratio567_25, &ratio567_25, &ratio567_25, &ratio567_25, 
-&ratio27_1, &ratio729_25, &ratio243_7, &ratio189_5, &ratio189_5, &ratio189_5, &ratio45_1}; 
-
-static const ScaleNote * const bohlenPeirceGammavoct[128] = {&ratio7_243, &ratio7_243, &ratio7_243, &ratio7_243, &ratio25_729, &ratio25_729, &ratio25_729, &ratio1_27, &ratio1_25, &ratio1_21, &ratio7_135, &ratio7_135, &ratio7_135, 
-&ratio5_81, &ratio1_15, &ratio1_15, &ratio49_675, &ratio49_675, &ratio49_675, &ratio7_81, &ratio7_81, &ratio7_81, &ratio7_81, &ratio25_243, &ratio25_243, 
-&ratio25_243, &ratio1_9, &ratio3_25, &ratio1_7, &ratio7_45, &ratio7_45, &ratio7_45, &ratio5_27, &ratio1_5, &ratio1_5, &ratio49_225, &ratio49_225, 
-&ratio49_225, &ratio7_27, &ratio7_27, &ratio7_27, &ratio7_27, &ratio25_81, &ratio25_81, &ratio25_81, &ratio1_3, &ratio9_25, &ratio3_7, &ratio7_15, 
-&ratio7_15, &ratio7_15, &ratio5_9, &ratio3_5, &ratio3_5, &ratio49_75, &ratio49_75, &ratio49_75, &ratio7_9, &ratio7_9, &ratio7_9, &ratio7_9, 
-&ratio25_27, &ratio25_27, &ratio25_27, &ratio1_1, &ratio27_25, &ratio9_7, &ratio7_5, &ratio7_5, &ratio7_5, &ratio5_3, &ratio9_5, &ratio9_5, 
-&ratio49_25, &ratio49_25, &ratio49_25, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio25_9, &ratio25_9, &ratio25_9, &ratio3_1, &ratio81_25, 
-&ratio27_7, &ratio21_5, &ratio21_5, &ratio21_5, &ratio5_1, &ratio27_5, &ratio27_5, &ratio147_25, &ratio147_25, &ratio147_25, &ratio7_1, &ratio7_1, 
-&ratio7_1, &ratio7_1, &ratio25_3, &ratio25_3, &ratio25_3, &ratio9_1, &ratio243_25, &ratio81_7, &ratio63_5, &ratio63_5, &ratio63_5, &ratio15_1, 
-&ratio81_5, &ratio81_5, &ratio441_25, &ratio441_25, &ratio441_25, &ratio21_1, &ratio21_1, &ratio21_1, &ratio21_1, &ratio25_1, &ratio25_1, &ratio25_1, 
-&ratio27_1, &ratio729_25, &ratio243_7, &ratio189_5, &ratio189_5, &ratio189_5, &ratio45_1}; 
-
-static const ScaleNote * const bohlenPeirceHarmonicvoct[128] = {&ratio7_243, &ratio7_243, &ratio7_225, &ratio7_225, &ratio7_225, &ratio7_225, &ratio7_225, &ratio1_27, &ratio1_25, &ratio1_21, &ratio7_135, &ratio7_135, &ratio7_135, 
-&ratio5_81, &ratio1_15, &ratio1_15, &ratio1_15, &ratio5_63, &ratio5_63, &ratio7_81, &ratio7_81, &ratio7_75, &ratio7_75, &ratio7_75, &ratio7_75, 
-&ratio7_75, &ratio1_9, &ratio3_25, &ratio1_7, &ratio7_45, &ratio7_45, &ratio7_45, &ratio5_27, &ratio1_5, &ratio1_5, &ratio1_5, &ratio5_21, 
-&ratio5_21, &ratio7_27, &ratio7_27, &ratio7_25, &ratio7_25, &ratio7_25, &ratio7_25, &ratio7_25, &ratio1_3, &ratio9_25, &ratio3_7, &ratio7_15, 
-&ratio7_15, &ratio7_15, &ratio5_9, &ratio3_5, &ratio3_5, &ratio3_5, &ratio5_7, &ratio5_7, &ratio7_9, &ratio7_9, &ratio21_25, &ratio21_25, 
-&ratio21_25, &ratio21_25, &ratio21_25, &ratio1_1, &ratio27_25, &ratio9_7, &ratio7_5, &ratio7_5, &ratio7_5, &ratio5_3, &ratio9_5, &ratio9_5, 
-&ratio9_5, &ratio15_7, &ratio15_7, &ratio7_3, &ratio7_3, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio3_1, &ratio81_25, 
-&ratio27_7, &ratio21_5, &ratio21_5, &ratio21_5, &ratio5_1, &ratio27_5, &ratio27_5, &ratio27_5, &ratio45_7, &ratio45_7, &ratio7_1, &ratio7_1, 
-&ratio189_25, &ratio189_25, &ratio189_25, &ratio189_25, &ratio189_25, &ratio9_1, &ratio243_25, &ratio81_7, &ratio63_5, &ratio63_5, &ratio63_5, &ratio15_1, 
-&ratio81_5, &ratio81_5, &ratio81_5, &ratio135_7, &ratio135_7, &ratio21_1, &ratio21_1, &ratio567_25, &ratio567_25, &ratio567_25, &ratio567_25, &ratio567_25, 
-&ratio27_1, &ratio729_25, &ratio243_7, &ratio189_5, &ratio189_5, &ratio189_5, &ratio45_1}; 
-
-static const ScaleNote * const bohlenPeirceMollIvoct[128] = {&ratio7_243, &ratio7_243, &ratio7_243, &ratio7_243, &ratio25_729, &ratio25_729, &ratio25_729, &ratio1_27, &ratio25_567, &ratio1_21, &ratio1_21, &ratio1_21, &ratio25_441, 
-&ratio5_81, &ratio1_15, &ratio1_15, &ratio1_15, &ratio5_63, &ratio5_63, &ratio7_81, &ratio7_81, &ratio7_81, &ratio7_81, &ratio25_243, &ratio25_243, 
-&ratio25_243, &ratio1_9, &ratio25_189, &ratio1_7, &ratio1_7, &ratio1_7, &ratio25_147, &ratio5_27, &ratio1_5, &ratio1_5, &ratio1_5, &ratio5_21, 
-&ratio5_21, &ratio7_27, &ratio7_27, &ratio7_27, &ratio7_27, &ratio25_81, &ratio25_81, &ratio25_81, &ratio1_3, &ratio25_63, &ratio3_7, &ratio3_7, 
-&ratio3_7, &ratio25_49, &ratio5_9, &ratio3_5, &ratio3_5, &ratio3_5, &ratio5_7, &ratio5_7, &ratio7_9, &ratio7_9, &ratio7_9, &ratio7_9, 
-&ratio25_27, &ratio25_27, &ratio25_27, &ratio1_1, &ratio25_21, &ratio9_7, &ratio9_7, &ratio9_7, &ratio75_49, &ratio5_3, &ratio9_5, &ratio9_5, 
-&ratio9_5, &ratio15_7, &ratio15_7, &ratio7_3, &ratio7_3, &ratio7_3, &ratio7_3, &ratio25_9, &ratio25_9, &ratio25_9, &ratio3_1, &ratio25_7, 
-&ratio27_7, &ratio27_7, &ratio27_7, &ratio225_49, &ratio5_1, &ratio27_5, &ratio27_5, &ratio27_5, &ratio45_7, &ratio45_7, &ratio7_1, &ratio7_1, 
-&ratio7_1, &ratio7_1, &ratio25_3, &ratio25_3, &ratio25_3, &ratio9_1, &ratio75_7, &ratio81_7, &ratio81_7, &ratio81_7, &ratio675_49, &ratio15_1, 
-&ratio81_5, &ratio81_5, &ratio81_5, &ratio135_7, &ratio135_7, &ratio21_1, &ratio21_1, &ratio21_1, &ratio21_1, &ratio25_1, &ratio25_1, &ratio25_1, 
-&ratio27_1, &ratio225_7, &ratio243_7, &ratio243_7, &ratio243_7, &ratio2025_49, &ratio45_1}; 
-
-static const ScaleNote * const bohlenPeirceProoijenMinvoct[128] = {&ratio5_189, &ratio5_189, &ratio5_189, &ratio5_189, &ratio25_729, &ratio25_729, &ratio25_729, &ratio1_27, &ratio25_567, &ratio1_21, &ratio1_21, &ratio1_21, &ratio1_21, 
-&ratio5_81, &ratio1_15, &ratio1_15, &ratio1_15, &ratio5_63, &ratio5_63, &ratio5_63, &ratio5_63, &ratio5_63, &ratio5_63, &ratio25_243, &ratio25_243, 
-&ratio25_243, &ratio1_9, &ratio25_189, &ratio1_7, &ratio1_7, &ratio1_7, &ratio1_7, &ratio5_27, &ratio1_5, &ratio1_5, &ratio1_5, &ratio5_21, 
-&ratio5_21, &ratio5_21, &ratio5_21, &ratio5_21, &ratio5_21, &ratio25_81, &ratio25_81, &ratio25_81, &ratio1_3, &ratio25_63, &ratio3_7, &ratio3_7, 
-&ratio3_7, &ratio3_7, &ratio5_9, &ratio3_5, &ratio3_5, &ratio3_5, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, &ratio5_7, 
-&ratio25_27, &ratio25_27, &ratio25_27, &ratio1_1, &ratio25_21, &ratio9_7, &ratio9_7, &ratio9_7, &ratio9_7, &ratio5_3, &ratio9_5, &ratio9_5, 
-&ratio9_5, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio15_7, &ratio25_9, &ratio25_9, &ratio25_9, &ratio3_1, &ratio25_7, 
-&ratio27_7, &ratio27_7, &ratio27_7, &ratio27_7, &ratio5_1, &ratio27_5, &ratio27_5, &ratio27_5, &ratio45_7, &ratio45_7, &ratio45_7, &ratio45_7, 
-&ratio45_7, &ratio45_7, &ratio25_3, &ratio25_3, &ratio25_3, &ratio9_1, &ratio75_7, &ratio81_7, &ratio81_7, &ratio81_7, &ratio81_7, &ratio15_1, 
-&ratio81_5, &ratio81_5, &ratio81_5, &ratio135_7, &ratio135_7, &ratio135_7, &ratio135_7, &ratio135_7, &ratio135_7, &ratio25_1, &ratio25_1, &ratio25_1, 
-&ratio27_1, &ratio225_7, &ratio243_7, &ratio243_7, &ratio243_7, &ratio243_7, &ratio45_1}; 
-
-static const ScaleNote * const bohlenPeirceWalkerBvoct[128] = {&ratio7_243, &ratio7_243, &ratio7_225, &ratio7_225, &ratio7_225, &ratio7_225, &ratio7_225, &ratio1_27, &ratio1_25, &ratio1_21, &ratio7_135, &ratio7_135, &ratio25_441, 
-&ratio25_441, &ratio1_15, &ratio1_15, &ratio49_675, &ratio49_675, &ratio49_675, &ratio7_81, &ratio7_81, &ratio7_75, &ratio7_75, &ratio7_75, &ratio7_75, 
-&ratio7_75, &ratio1_9, &ratio3_25, &ratio1_7, &ratio7_45, &ratio7_45, &ratio25_147, &ratio25_147, &ratio1_5, &ratio1_5, &ratio49_225, &ratio49_225, 
-&ratio49_225, &ratio7_27, &ratio7_27, &ratio7_25, &ratio7_25, &ratio7_25, &ratio7_25, &ratio7_25, &ratio1_3, &ratio9_25, &ratio3_7, &ratio7_15, 
-&ratio7_15, &ratio25_49, &ratio25_49, &ratio3_5, &ratio3_5, &ratio49_75, &ratio49_75, &ratio49_75, &ratio7_9, &ratio7_9, &ratio21_25, &ratio21_25, 
-&ratio21_25, &ratio21_25, &ratio21_25, &ratio1_1, &ratio27_25, &ratio9_7, &ratio7_5, &ratio7_5, &ratio75_49, &ratio75_49, &ratio9_5, &ratio9_5, 
-&ratio49_25, &ratio49_25, &ratio49_25, &ratio7_3, &ratio7_3, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio63_25, &ratio3_1, &ratio81_25, 
-&ratio27_7, &ratio21_5, &ratio21_5, &ratio225_49, &ratio225_49, &ratio27_5, &ratio27_5, &ratio147_25, &ratio147_25, &ratio147_25, &ratio7_1, &ratio7_1, 
-&ratio189_25, &ratio189_25, &ratio189_25, &ratio189_25, &ratio189_25, &ratio9_1, &ratio243_25, &ratio81_7, &ratio63_5, &ratio63_5, &ratio675_49, &ratio675_49, 
-&ratio81_5, &ratio81_5, &ratio441_25, &ratio441_25, &ratio441_25, &ratio21_1, &ratio21_1, &ratio567_25, &ratio567_25, &ratio567_25, &ratio567_25, &ratio567_25, 
-&ratio27_1, &ratio729_25, &ratio243_7, &ratio189_5, &ratio189_5, &ratio2025_49, &ratio2025_49}; 
-
-
-
-static const ScaleNote * const rhythm_integers0[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio8_1, 
-&ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, 
-&ratio8_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio12_1, &ratio12_1, &ratio12_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, 
-&ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, 
-&ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1}; 
-
-static const ScaleNote * const rhythm_integers1[128] = {&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, 
-&ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1}; 
-
-static const ScaleNote * const rhythm_integers2[128] = {&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, 
-&ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, 
-&ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1}; 
-
-static const ScaleNote * const rhythm_integers3[128] = {&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1}; 
-
-static const ScaleNote * const rhythm_integers4[128] = {&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, 
-&ratio1_6, &ratio1_6, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1}; 
-
-static const ScaleNote * const rhythm_integers5[128] = {&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, 
-&ratio1_8, &ratio1_8, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio9_8, 
-&ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, &ratio9_8, 
-&ratio9_8, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1}; 
-
-static const ScaleNote * const rhythm_integers6[128] = {&ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, 
-&ratio1_12, &ratio1_12, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, 
-&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1}; 
-
-static const ScaleNote * const rhythm_integers7[128] = {&ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, 
-&ratio1_16, &ratio1_16, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, 
-&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, 
-&ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2}; 
-
-static const ScaleNote * const rhythm_integers8[128] = {&ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, &ratio1_24, 
-&ratio1_24, &ratio1_24, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, 
-&ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, 
-&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, 
-&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-
-
-static const ScaleNote * const no_triplets0[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, 
-&ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, 
-&ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, 
-&ratio8_1, &ratio8_1, &ratio8_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, 
-&ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1, &ratio16_1}; 
-
-static const ScaleNote * const no_triplets1[128] = {&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, 
-&ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1}; 
-
-static const ScaleNote * const no_triplets2[128] = {&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, 
-&ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3, &ratio16_3}; 
-
-static const ScaleNote * const no_triplets3[128] = {&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1}; 
-
-static const ScaleNote * const no_triplets4[128] = {&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, 
-&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, 
-&ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3, &ratio8_3}; 
-
-static const ScaleNote * const no_triplets5[128] = {&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, 
-&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1}; 
-
-static const ScaleNote * const no_triplets6[128] = {&ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, 
-&ratio1_12, &ratio1_12, &ratio1_12, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, 
-&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, 
-&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, &ratio2_3, 
-&ratio2_3, &ratio2_3, &ratio2_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, 
-&ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3, &ratio4_3}; 
-
-static const ScaleNote * const no_triplets7[128] = {&ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, 
-&ratio1_16, &ratio1_16, &ratio1_16, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, 
-&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, 
-&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1}; 
-
-
-
-static const ScaleNote * const triplets0[128] = {&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio12_1, &ratio12_1, &ratio12_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, 
-&ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1, &ratio24_1}; 
-
-static const ScaleNote * const triplets1[128] = {&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, 
-&ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1, &ratio12_1}; 
-
-static const ScaleNote * const triplets2[128] = {&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, &ratio1_3, 
-&ratio1_3, &ratio1_3, &ratio1_3, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, 
-&ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1, &ratio8_1}; 
-
-static const ScaleNote * const triplets3[128] = {&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, 
-&ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1, &ratio6_1}; 
-
-static const ScaleNote * const triplets4[128] = {&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, &ratio1_6, 
-&ratio1_6, &ratio1_6, &ratio1_6, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, 
-&ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1, &ratio4_1}; 
-
-static const ScaleNote * const triplets5[128] = {&ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, &ratio1_8, 
-&ratio1_8, &ratio1_8, &ratio1_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, 
-&ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1, &ratio3_1}; 
-
-static const ScaleNote * const triplets6[128] = {&ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, &ratio1_12, 
-&ratio1_12, &ratio1_12, &ratio1_12, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, 
-&ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_4, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, 
-&ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_2, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, &ratio1_1, 
-&ratio1_1, &ratio1_1, &ratio1_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, 
-&ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1, &ratio2_1}; 
-
-static const ScaleNote * const triplets7[128] = {&ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, &ratio1_16, 
-&ratio1_16, &ratio1_16, &ratio1_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, 
-&ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, 
-&ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_16, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, 
-&ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_8, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, &ratio3_4, 
-&ratio3_4, &ratio3_4, &ratio3_4, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, 
-&ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2, &ratio3_2}; 
-
-
-
-static const ScaleNote * const poly_div_resets0[128] = {&ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, 
-&ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, 
-&ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, 
-&ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio4_1_4, 
-&ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, 
-&ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio6_1_4, &ratio6_1_4, &ratio6_1_4, &ratio6_1_4, &ratio6_1_4, &ratio6_1_4, &ratio6_1_4, &ratio6_1_4, &ratio6_1_4, 
-&ratio6_1_4, &ratio6_1_4, &ratio6_1_4, &ratio6_1_4, &ratio6_1_4, &ratio6_1_4, &ratio6_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, 
-&ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio16_1_4, 
-&ratio16_1_4, &ratio16_1_4, &ratio16_1_4, &ratio16_1_4, &ratio16_1_4, &ratio16_1_4, &ratio16_1_4, &ratio16_1_4, &ratio16_1_4, &ratio16_1_4, &ratio16_1_4, &ratio16_1_4, 
-&ratio16_1_4, &ratio16_1_4, &ratio16_1_4, &ratio24_1_4, &ratio24_1_4, &ratio24_1_4, &ratio24_1_4, &ratio24_1_4, &ratio24_1_4, &ratio24_1_4, &ratio24_1_4, &ratio24_1_4, 
-&ratio24_1_4, &ratio24_1_4, &ratio24_1_4, &ratio24_1_4, &ratio24_1_4, &ratio24_1_4, &ratio24_1_4}; 
-
-static const ScaleNote * const poly_div_resets1[128] = {&ratio1_2_4, &ratio1_2_4, &ratio1_2_4, &ratio1_2_4, &ratio1_2_4, &ratio1_2_4, &ratio1_2_4, &ratio1_2_4, &ratio1_2_4, &ratio1_2_4, &ratio1_2_4, &ratio1_2_4, &ratio1_2_4, 
-&ratio1_2_4, &ratio1_2_4, &ratio1_2_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, 
-&ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio1_1_4, &ratio3_2_4, &ratio3_2_4, &ratio3_2_4, &ratio3_2_4, &ratio3_2_4, 
-&ratio3_2_4, &ratio3_2_4, &ratio3_2_4, &ratio3_2_4, &ratio3_2_4, &ratio3_2_4, &ratio3_2_4, &ratio3_2_4, &ratio3_2_4, &ratio3_2_4, &ratio3_2_4, &ratio2_1_4, 
-&ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio2_1_4, 
-&ratio2_1_4, &ratio2_1_4, &ratio2_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, 
-&ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio3_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, 
-&ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio4_1_4, &ratio8_1_4, 
-&ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio8_1_4, 
-&ratio8_1_4, &ratio8_1_4, &ratio8_1_4, &ratio12_1_4, &ratio12_1_4, &ratio12_1_4, &ratio12_1_4, &ratio12_1_4, &ratio12_1_4, &ratio12_1_4, &ratio12_1_4, &ratio12_1_4, 
-&ratio12_1_4, &ratio12_1_4, &ratio12_1_4, &ratio12_1_4, &ratio12_1_4, &ratio12_1_4, &ratio12_1_4}; 
-
-static const ScaleNote * const poly_div_resets2[128] = {&ratio1_3_8, &ratio1_3_8, &ratio1_3_8, &ratio1_3_8, &ratio1_3_8, &ratio1_3_8, &ratio1_3_8, &ratio1_3_8, &ratio1_3_8, &ratio1_3_8, &ratio1_3_8, &ratio1_3_8, &ratio1_3_8, 
-&ratio1_3_8, &ratio1_3_8, &ratio1_3_8, &ratio2_3_8, &ratio2_3_8, &ratio2_3_8, &ratio2_3_8, &ratio2_3_8, &ratio2_3_8, &ratio2_3_8, &ratio2_3_8, &ratio2_3_8, 
-&ratio2_3_8, &ratio2_3_8, &ratio2_3_8, &ratio2_3_8, &ratio2_3_8, &ratio2_3_8, &ratio2_3_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, 
-&ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio4_3_8, 
-&ratio4_3_8, &ratio4_3_8, &ratio4_3_8, &ratio4_3_8, &ratio4_3_8, &ratio4_3_8, &ratio4_3_8, &ratio4_3_8, &ratio4_3_8, &ratio4_3_8, &ratio4_3_8, &ratio4_3_8, 
-&ratio4_3_8, &ratio4_3_8, &ratio4_3_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, 
-&ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio8_3_8, &ratio8_3_8, &ratio8_3_8, &ratio8_3_8, &ratio8_3_8, 
-&ratio8_3_8, &ratio8_3_8, &ratio8_3_8, &ratio8_3_8, &ratio8_3_8, &ratio8_3_8, &ratio8_3_8, &ratio8_3_8, &ratio8_3_8, &ratio8_3_8, &ratio8_3_8, &ratio16_3_8, 
-&ratio16_3_8, &ratio16_3_8, &ratio16_3_8, &ratio16_3_8, &ratio16_3_8, &ratio16_3_8, &ratio16_3_8, &ratio16_3_8, &ratio16_3_8, &ratio16_3_8, &ratio16_3_8, &ratio16_3_8, 
-&ratio16_3_8, &ratio16_3_8, &ratio16_3_8, &ratio8_1_8, &ratio8_1_8, &ratio8_1_8, &ratio8_1_8, &ratio8_1_8, &ratio8_1_8, &ratio8_1_8, &ratio8_1_8, &ratio8_1_8, 
-&ratio8_1_8, &ratio8_1_8, &ratio8_1_8, &ratio8_1_8, &ratio8_1_8, &ratio8_1_8, &ratio8_1_8}; 
-
-static const ScaleNote * const poly_div_resets3[128] = {&ratio1_4_8, &ratio1_4_8, &ratio1_4_8, &ratio1_4_8, &ratio1_4_8, &ratio1_4_8, &ratio1_4_8, &ratio1_4_8, &ratio1_4_8, &ratio1_4_8, &ratio1_4_8, &ratio1_4_8, &ratio1_4_8, 
-&ratio1_4_8, &ratio1_4_8, &ratio1_4_8, &ratio1_2_8, &ratio1_2_8, &ratio1_2_8, &ratio1_2_8, &ratio1_2_8, &ratio1_2_8, &ratio1_2_8, &ratio1_2_8, &ratio1_2_8, 
-&ratio1_2_8, &ratio1_2_8, &ratio1_2_8, &ratio1_2_8, &ratio1_2_8, &ratio1_2_8, &ratio1_2_8, &ratio3_4_8, &ratio3_4_8, &ratio3_4_8, &ratio3_4_8, &ratio3_4_8, 
-&ratio3_4_8, &ratio3_4_8, &ratio3_4_8, &ratio3_4_8, &ratio3_4_8, &ratio3_4_8, &ratio3_4_8, &ratio3_4_8, &ratio3_4_8, &ratio3_4_8, &ratio3_4_8, &ratio1_1_8, 
-&ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio1_1_8, 
-&ratio1_1_8, &ratio1_1_8, &ratio1_1_8, &ratio3_2_8, &ratio3_2_8, &ratio3_2_8, &ratio3_2_8, &ratio3_2_8, &ratio3_2_8, &ratio3_2_8, &ratio3_2_8, &ratio3_2_8, 
-&ratio3_2_8, &ratio3_2_8, &ratio3_2_8, &ratio3_2_8, &ratio3_2_8, &ratio3_2_8, &ratio3_2_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, 
-&ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio2_1_8, &ratio4_1_8, 
-&ratio4_1_8, &ratio4_1_8, &ratio4_1_8, &ratio4_1_8, &ratio4_1_8, &ratio4_1_8, &ratio4_1_8, &ratio4_1_8, &ratio4_1_8, &ratio4_1_8, &ratio4_1_8, &ratio4_1_8, 
-&ratio4_1_8, &ratio4_1_8, &ratio4_1_8, &ratio6_1_8, &ratio6_1_8, &ratio6_1_8, &ratio6_1_8, &ratio6_1_8, &ratio6_1_8, &ratio6_1_8, &ratio6_1_8, &ratio6_1_8, 
-&ratio6_1_8, &ratio6_1_8, &ratio6_1_8, &ratio6_1_8, &ratio6_1_8, &ratio6_1_8, &ratio6_1_8}; 
-
-static const ScaleNote * const poly_div_resets4[128] = {&ratio1_5_16, &ratio1_5_16, &ratio1_5_16, &ratio1_5_16, &ratio1_5_16, &ratio1_5_16, &ratio1_5_16, &ratio1_5_16, &ratio1_5_16, &ratio1_5_16, &ratio1_5_16, &ratio1_5_16, &ratio1_5_16, 
-&ratio1_5_16, &ratio1_5_16, &ratio1_5_16, &ratio2_5_16, &ratio2_5_16, &ratio2_5_16, &ratio2_5_16, &ratio2_5_16, &ratio2_5_16, &ratio2_5_16, &ratio2_5_16, &ratio2_5_16, 
-&ratio2_5_16, &ratio2_5_16, &ratio2_5_16, &ratio2_5_16, &ratio2_5_16, &ratio2_5_16, &ratio2_5_16, &ratio3_5_16, &ratio3_5_16, &ratio3_5_16, &ratio3_5_16, &ratio3_5_16, 
-&ratio3_5_16, &ratio3_5_16, &ratio3_5_16, &ratio3_5_16, &ratio3_5_16, &ratio3_5_16, &ratio3_5_16, &ratio3_5_16, &ratio3_5_16, &ratio3_5_16, &ratio3_5_16, &ratio4_5_16, 
-&ratio4_5_16, &ratio4_5_16, &ratio4_5_16, &ratio4_5_16, &ratio4_5_16, &ratio4_5_16, &ratio4_5_16, &ratio4_5_16, &ratio4_5_16, &ratio4_5_16, &ratio4_5_16, &ratio4_5_16, 
-&ratio4_5_16, &ratio4_5_16, &ratio4_5_16, &ratio6_5_16, &ratio6_5_16, &ratio6_5_16, &ratio6_5_16, &ratio6_5_16, &ratio6_5_16, &ratio6_5_16, &ratio6_5_16, &ratio6_5_16, 
-&ratio6_5_16, &ratio6_5_16, &ratio6_5_16, &ratio6_5_16, &ratio6_5_16, &ratio6_5_16, &ratio6_5_16, &ratio8_5_16, &ratio8_5_16, &ratio8_5_16, &ratio8_5_16, &ratio8_5_16, 
-&ratio8_5_16, &ratio8_5_16, &ratio8_5_16, &ratio8_5_16, &ratio8_5_16, &ratio8_5_16, &ratio8_5_16, &ratio8_5_16, &ratio8_5_16, &ratio8_5_16, &ratio8_5_16, &ratio16_5_16, 
-&ratio16_5_16, &ratio16_5_16, &ratio16_5_16, &ratio16_5_16, &ratio16_5_16, &ratio16_5_16, &ratio16_5_16, &ratio16_5_16, &ratio16_5_16, &ratio16_5_16, &ratio16_5_16, &ratio16_5_16, 
-&ratio16_5_16, &ratio16_5_16, &ratio16_5_16, &ratio24_5_16, &ratio24_5_16, &ratio24_5_16, &ratio24_5_16, &ratio24_5_16, &ratio24_5_16, &ratio24_5_16, &ratio24_5_16, &ratio24_5_16, 
-&ratio24_5_16, &ratio24_5_16, &ratio24_5_16, &ratio24_5_16, &ratio24_5_16, &ratio24_5_16, &ratio24_5_16}; 
-
-static const ScaleNote * const poly_div_resets5[128] = {&ratio1_6_16, &ratio1_6_16, &ratio1_6_16, &ratio1_6_16, &ratio1_6_16, &ratio1_6_16, &ratio1_6_16, &ratio1_6_16, &ratio1_6_16, &ratio1_6_16, &ratio1_6_16, &ratio1_6_16, &ratio1_6_16, 
-&ratio1_6_16, &ratio1_6_16, &ratio1_6_16, &ratio1_3_16, &ratio1_3_16, &ratio1_3_16, &ratio1_3_16, &ratio1_3_16, &ratio1_3_16, &ratio1_3_16, &ratio1_3_16, &ratio1_3_16, 
-&ratio1_3_16, &ratio1_3_16, &ratio1_3_16, &ratio1_3_16, &ratio1_3_16, &ratio1_3_16, &ratio1_3_16, &ratio1_2_16, &ratio1_2_16, &ratio1_2_16, &ratio1_2_16, &ratio1_2_16, 
-&ratio1_2_16, &ratio1_2_16, &ratio1_2_16, &ratio1_2_16, &ratio1_2_16, &ratio1_2_16, &ratio1_2_16, &ratio1_2_16, &ratio1_2_16, &ratio1_2_16, &ratio1_2_16, &ratio2_3_16, 
-&ratio2_3_16, &ratio2_3_16, &ratio2_3_16, &ratio2_3_16, &ratio2_3_16, &ratio2_3_16, &ratio2_3_16, &ratio2_3_16, &ratio2_3_16, &ratio2_3_16, &ratio2_3_16, &ratio2_3_16, 
-&ratio2_3_16, &ratio2_3_16, &ratio2_3_16, &ratio1_1_16, &ratio1_1_16, &ratio1_1_16, &ratio1_1_16, &ratio1_1_16, &ratio1_1_16, &ratio1_1_16, &ratio1_1_16, &ratio1_1_16, 
-&ratio1_1_16, &ratio1_1_16, &ratio1_1_16, &ratio1_1_16, &ratio1_1_16, &ratio1_1_16, &ratio1_1_16, &ratio4_3_16, &ratio4_3_16, &ratio4_3_16, &ratio4_3_16, &ratio4_3_16, 
-&ratio4_3_16, &ratio4_3_16, &ratio4_3_16, &ratio4_3_16, &ratio4_3_16, &ratio4_3_16, &ratio4_3_16, &ratio4_3_16, &ratio4_3_16, &ratio4_3_16, &ratio4_3_16, &ratio8_3_16, 
-&ratio8_3_16, &ratio8_3_16, &ratio8_3_16, &ratio8_3_16, &ratio8_3_16, &ratio8_3_16, &ratio8_3_16, &ratio8_3_16, &ratio8_3_16, &ratio8_3_16, &ratio8_3_16, &ratio8_3_16, 
-&ratio8_3_16, &ratio8_3_16, &ratio8_3_16, &ratio4_1_16, &ratio4_1_16, &ratio4_1_16, &ratio4_1_16, &ratio4_1_16, &ratio4_1_16, &ratio4_1_16, &ratio4_1_16, &ratio4_1_16, 
-&ratio4_1_16, &ratio4_1_16, &ratio4_1_16, &ratio4_1_16, &ratio4_1_16, &ratio4_1_16, &ratio4_1_16}; 
-
-static const ScaleNote * const poly_div_resets6[128] = {&ratio1_7_32, &ratio1_7_32, &ratio1_7_32, &ratio1_7_32, &ratio1_7_32, &ratio1_7_32, &ratio1_7_32, &ratio1_7_32, &ratio1_7_32, &ratio1_7_32, &ratio1_7_32, &ratio1_7_32, &ratio1_7_32, 
-&ratio1_7_32, &ratio1_7_32, &ratio1_7_32, &ratio2_7_32, &ratio2_7_32, &ratio2_7_32, &ratio2_7_32, &ratio2_7_32, &ratio2_7_32, &ratio2_7_32, &ratio2_7_32, &ratio2_7_32, 
-&ratio2_7_32, &ratio2_7_32, &ratio2_7_32, &ratio2_7_32, &ratio2_7_32, &ratio2_7_32, &ratio2_7_32, &ratio3_7_32, &ratio3_7_32, &ratio3_7_32, &ratio3_7_32, &ratio3_7_32, 
-&ratio3_7_32, &ratio3_7_32, &ratio3_7_32, &ratio3_7_32, &ratio3_7_32, &ratio3_7_32, &ratio3_7_32, &ratio3_7_32, &ratio3_7_32, &ratio3_7_32, &ratio3_7_32, &ratio4_7_32, 
-&ratio4_7_32, &ratio4_7_32, &ratio4_7_32, &ratio4_7_32, &ratio4_7_32, &ratio4_7_32, &ratio4_7_32, &ratio4_7_32, &ratio4_7_32, &ratio4_7_32, &ratio4_7_32, &ratio4_7_32, 
-&ratio4_7_32, &ratio4_7_32, &ratio4_7_32, &ratio6_7_32, &ratio6_7_32, &ratio6_7_32, &ratio6_7_32, &ratio6_7_32, &ratio6_7_32, &ratio6_7_32, &ratio6_7_32, &ratio6_7_32, 
-&ratio6_7_32, &ratio6_7_32, &ratio6_7_32, &ratio6_7_32, &ratio6_7_32, &ratio6_7_32, &ratio6_7_32, &ratio8_7_32, &ratio8_7_32, &ratio8_7_32, &ratio8_7_32, &ratio8_7_32, 
-&ratio8_7_32, &ratio8_7_32, &ratio8_7_32, &ratio8_7_32, &ratio8_7_32, &ratio8_7_32, &ratio8_7_32, &ratio8_7_32, &ratio8_7_32, &ratio8_7_32, &ratio8_7_32, &ratio16_7_32, 
-&ratio16_7_32, &ratio16_7_32, &ratio16_7_32, &ratio16_7_32, &ratio16_7_32, &ratio16_7_32, &ratio16_7_32, &ratio16_7_32, &ratio16_7_32, &ratio16_7_32, &ratio16_7_32, &ratio16_7_32, 
-&ratio16_7_32, &ratio16_7_32, &ratio16_7_32, &ratio24_7_32, &ratio24_7_32, &ratio24_7_32, &ratio24_7_32, &ratio24_7_32, &ratio24_7_32, &ratio24_7_32, &ratio24_7_32, &ratio24_7_32, 
-&ratio24_7_32, &ratio24_7_32, &ratio24_7_32, &ratio24_7_32, &ratio24_7_32, &ratio24_7_32, &ratio24_7_32}; 
-
-static const ScaleNote * const poly_div_resets7[128] = {&ratio1_8_32, &ratio1_8_32, &ratio1_8_32, &ratio1_8_32, &ratio1_8_32, &ratio1_8_32, &ratio1_8_32, &ratio1_8_32, &ratio1_8_32, &ratio1_8_32, &ratio1_8_32, &ratio1_8_32, &ratio1_8_32, 
-&ratio1_8_32, &ratio1_8_32, &ratio1_8_32, &ratio1_4_32, &ratio1_4_32, &ratio1_4_32, &ratio1_4_32, &ratio1_4_32, &ratio1_4_32, &ratio1_4_32, &ratio1_4_32, &ratio1_4_32, 
-&ratio1_4_32, &ratio1_4_32, &ratio1_4_32, &ratio1_4_32, &ratio1_4_32, &ratio1_4_32, &ratio1_4_32, &ratio3_8_32, &ratio3_8_32, &ratio3_8_32, &ratio3_8_32, &ratio3_8_32, 
-&ratio3_8_32, &ratio3_8_32, &ratio3_8_32, &ratio3_8_32, &ratio3_8_32, &ratio3_8_32, &ratio3_8_32, &ratio3_8_32, &ratio3_8_32, &ratio3_8_32, &ratio3_8_32, &ratio1_2_32, 
-&ratio1_2_32, &ratio1_2_32, &ratio1_2_32, &ratio1_2_32, &ratio1_2_32, &ratio1_2_32, &ratio1_2_32, &ratio1_2_32, &ratio1_2_32, &ratio1_2_32, &ratio1_2_32, &ratio1_2_32, 
-&ratio1_2_32, &ratio1_2_32, &ratio1_2_32, &ratio3_4_32, &ratio3_4_32, &ratio3_4_32, &ratio3_4_32, &ratio3_4_32, &ratio3_4_32, &ratio3_4_32, &ratio3_4_32, &ratio3_4_32, 
-&ratio3_4_32, &ratio3_4_32, &ratio3_4_32, &ratio3_4_32, &ratio3_4_32, &ratio3_4_32, &ratio3_4_32, &ratio1_1_32, &ratio1_1_32, &ratio1_1_32, &ratio1_1_32, &ratio1_1_32, 
-&ratio1_1_32, &ratio1_1_32, &ratio1_1_32, &ratio1_1_32, &ratio1_1_32, &ratio1_1_32, &ratio1_1_32, &ratio1_1_32, &ratio1_1_32, &ratio1_1_32, &ratio1_1_32, &ratio2_1_32, 
-&ratio2_1_32, &ratio2_1_32, &ratio2_1_32, &ratio2_1_32, &ratio2_1_32, &ratio2_1_32, &ratio2_1_32, &ratio2_1_32, &ratio2_1_32, &ratio2_1_32, &ratio2_1_32, &ratio2_1_32, 
-&ratio2_1_32, &ratio2_1_32, &ratio2_1_32, &ratio3_1_32, &ratio3_1_32, &ratio3_1_32, &ratio3_1_32, &ratio3_1_32, &ratio3_1_32, &ratio3_1_32, &ratio3_1_32, &ratio3_1_32, 
-&ratio3_1_32, &ratio3_1_32, &ratio3_1_32, &ratio3_1_32, &ratio3_1_32, &ratio3_1_32, &ratio3_1_32}; 
-
-
-
-
-
-
-static const ScaleNote* const*integerRatiosGrid[8] = {integerRatios1, integerRatios2, integerRatios3, integerRatios4, integerRatios5, integerRatios6, integerRatios7, integerRatios8}; 
-
-static const ScaleNote* const*even_integersGrid[9] = {even_integers0, even_integers1, even_integers2, even_integers3, even_integers4, even_integers5, even_integers6, even_integers7, even_integers8}; 
-
-static const ScaleNote* const*mult_three_integersGrid[8] = {mult_three_integers0, mult_three_integers1, mult_three_integers2, mult_three_integers3, mult_three_integers4, mult_three_integers5, mult_three_integers6, mult_three_integers7}; 
-
-static const ScaleNote* const*odd_integersGrid[9] = {odd_integers0, odd_integers1, odd_integers2, odd_integers3, odd_integers4, odd_integers5, odd_integers6, odd_integers7, odd_integers8}; 
-
-static const ScaleNote* const*modal_tetradsGrid[8] = {modal_tetradsainversion_walk, modal_tetradsbinversion_walk, modal_tetradinversion_walk, modal_tetradsdinversion_walk, modal_tetradseinversion_walk, modal_tetradsfinversion_walk, modal_tetradsginversion_walk, modal_tetradshinversion_walk}; 
-
-static const ScaleNote* const*seventhTetradsMinimalProgressionGrid[8] = {a_maj7thinversion_walk, a_maj7th2ndIninversion_walk, b_dom7thinversion_walk, b_dom7thRotateinversion_walk, c_subDom7thinversion_walk, c_subDom7thRotateinversion_walk, min7thinversion_walk, min7th2ndIninversion_walk}; 
-
-static const ScaleNote* const*impressionistGrid[8] = {impressionista_vs_impressionistb, impressionist_vs_impressionistd, impressioniste_vs_impressionistf, impressionistg_vs_impressionisth, impressionisti_vs_impressionistj, impressionistk_vs_impressionistl, impressionistm_vs_impressionistn, impressionisto_vs_impressionistp}; 
-
-static const ScaleNote* const*bohlenPeirceGrid[8] = {bohlenPeirceAScale_vs_bohlenPeirceBlueLambda, bohlenPeirceBlueLambda2_vs_bohlenPeirceDurI, bohlenPeirceDurII_vs_bohlenPeirceGLambda, bohlenPeirceGamma_vs_bohlenPeirceHPentatoni, bohlenPeirceHarmoni_vs_bohlenPeirceMollI, bohlenPeirceMollII_vs_bohlenPeirceProoijenMaj, bohlenPeirceProoijenMin_vs_bohlenPeirceWalkerA, bohlenPeirceWalkerB_vs_bohlenPeirceWalkerI}; 
-
-static const ScaleNote* const*modesofrootGrid[8] = {modesofroota, modesofrootb, modesofrootc, modesofrootd, modesofroote, modesofrootf, modesofrootg, modesofrooth}; 
-
-static const ScaleNote* const*tetrad_inversionsGrid[16] = {tetrad_inversionsa, tetrad_inversionsb, tetrad_inversionsc, tetrad_inversionsd, tetrad_inversionse, tetrad_inversionsf, tetrad_inversionsg, tetrad_inversionsh, tetrad_inversionsi, tetrad_inversionsj, tetrad_inversionsk, tetrad_inversionsl, tetrad_inversionsm, tetrad_inversionsn, tetrad_inversionso, tetrad_inversionsp}; 
-
-static const ScaleNote* const*harmonic_entropyGrid[8] = {harmonic_entropyA, harmonic_entropyB, harmonic_entropyC, harmonic_entropyD, harmonic_entropyE, harmonic_entropyF, harmonic_entropyG, harmonic_entropyH}; 
-
-static const ScaleNote* const*bohlenPeircevoctGrid[8] = {bohlenPeirceAScalevoct, bohlenPeirceBlueLambdavoct, bohlenPeirceDurIvoct, bohlenPeirceGammavoct, bohlenPeirceHarmonicvoct, bohlenPeirceMollIvoct, bohlenPeirceProoijenMinvoct, bohlenPeirceWalkerBvoct}; 
-
-static const ScaleNote* const*rhythm_integersGrid[9] = {rhythm_integers0, rhythm_integers1, rhythm_integers2, rhythm_integers3, rhythm_integers4, rhythm_integers5, rhythm_integers6, rhythm_integers7, rhythm_integers8}; 
-
-static const ScaleNote* const*no_tripletsGrid[8] = {no_triplets0, no_triplets1, no_triplets2, no_triplets3, no_triplets4, no_triplets5, no_triplets6, no_triplets7}; 
-
-static const ScaleNote* const*tripletsGrid[8] = {triplets0, triplets1, triplets2, triplets3, triplets4, triplets5, triplets6, triplets7}; 
+SYNC_SCALES(SCALE_DEF)
 
-static const ScaleNote* const*poly_div_resetsGrid[8] = {poly_div_resets0, poly_div_resets1, poly_div_resets2, poly_div_resets3, poly_div_resets4, poly_div_resets5, poly_div_resets6, poly_div_resets7}; 
-
-
-
-
-static const Scale integerRatios = {
-   .grid = integerRatiosGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 0};
-
-static const Scale even_integers = {
-   .grid = even_integersGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 0};
-
-static const Scale mult_three_integers = {
-   .grid = mult_three_integersGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 0};
-
-static const Scale odd_integers = {
-   .grid = odd_integersGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 0};
-
-static const Scale modal_tetrads = {
-   .grid = modal_tetradsGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 0};
-
-static const Scale seventhTetradsMinimalProgression = {
-   .grid = seventhTetradsMinimalProgressionGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 0};
-
-static const Scale impressionist = {
-   .grid = impressionistGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 0};
-
-static const Scale bohlenPeirce = {
-   .grid = bohlenPeirceGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 0};
-
-static const Scale modesofroot = {
-   .grid = modesofrootGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 1};
-
-static const Scale tetrad_inversions = {
-   .grid = tetrad_inversionsGrid,
-   .t2Bitshift = 8,
-   .oneVoltOct = 1};
-
-static const Scale harmonic_entropy = {
-   .grid = harmonic_entropyGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 1};
-
-static const Scale bohlenPeircevoct = {
-   .grid = bohlenPeircevoctGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 0};
-
-static const Scale rhythm_integers = {
-   .grid = rhythm_integersGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 0};
-
-static const Scale no_triplets = {
-   .grid = no_tripletsGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 0};
-
-static const Scale triplets = {
-   .grid = tripletsGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 0};
-
-static const Scale poly_div_resets = {
-   .grid = poly_div_resetsGrid,
-   .t2Bitshift = 9,
-   .oneVoltOct = 0};
-
-#endif /* INC_SCALES_HPP_ */
\ No newline at end of file
+#endif /* INC_SCALES_HPP_ */
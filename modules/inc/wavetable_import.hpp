@@ -0,0 +1,81 @@
+/*
+ * wavetable_import.hpp
+ *
+ *  Virtual build only: converts user supplied wavetable files into the
+ *  attack/release slope format of the built in tables.
+ */
+
+#ifndef INC_WAVETABLE_IMPORT_HPP_
+#define INC_WAVETABLE_IMPORT_HPP_
+
+#include "tables.hpp"
+
+#ifdef BUILD_VIRTUAL
+
+/// Most slopes an imported table can hold, the size of the meta and sync table buffers.
+#define WAVETABLE_IMPORT_MAX_WAVEFORMS 9
+/// Number of imported tables each module can hold at once.
+#define WAVETABLE_USER_TABLES 4
+/// Single cycle length assumed for wav files without a frame length ('clm ') chunk.
+#define WAVETABLE_IMPORT_FRAME_LENGTH 2048
+/// Samples per cycle after resampling, the attack slope is the first half and the release slope the second.
+#define WAVETABLE_IMPORT_CYCLE_LENGTH 512
+
+/**
+ *
+ * Wavetable imported from a file
+ *
+ * Accepts either a wav file of single cycle frames (8/16/24/32 bit PCM or 32 bit float, first channel)
+ * or a raw family file: N attack slopes then N release slopes, 257 little endian uint16 samples each.
+ * Wav frames are resampled to 512 samples and split into a 257 sample attack slope and a reversed release slope,
+ * with frames interpolated down to at most maxWaveforms slopes.
+ * The converted slopes are cached on disk keyed on a hash of the source file,
+ * so reloading a patch skips the conversion.
+ *
+ * Each import is converted into a scratch copy that then replaces the current one, so the audio path never
+ * reads a table that is being written. The copy it replaces becomes the next scratch, so the module must stop
+ * reading a replaced table (switch away from it and let any fade or load finish) before the next import.
+ *
+ */
+
+class WavetableImport {
+
+	/// One converted table and the Wavetable the modules point at.
+	struct Slopes {
+		uint16_t attack[WAVETABLE_IMPORT_MAX_WAVEFORMS][257];
+		uint16_t release[WAVETABLE_IMPORT_MAX_WAVEFORMS][257];
+		/// Padded, prediff packed image in the format passed to import, the counterpart of the generated table images.
+		uint32_t image[WAVETABLE_IMPORT_MAX_WAVEFORMS][517];
+		uint32_t numWaveforms;
+		Wavetable table;
+	};
+
+	/// Allocated on the first import, so modules that never import don't carry the buffers.
+	Slopes * current = 0;
+	Slopes * scratch = 0;
+
+	int32_t convertWav(Slopes * out, const uint8_t * data, uint32_t size, uint32_t maxWaveforms);
+	int32_t convertRaw(Slopes * out, const uint8_t * data, uint32_t size, uint32_t maxWaveforms);
+	int32_t readCache(Slopes * out, const char * cachePath, uint32_t sourceSize, uint32_t sourceHash, uint32_t maxWaveforms);
+	void writeCache(const Slopes * in, const char * cachePath, uint32_t sourceSize, uint32_t sourceHash, uint32_t maxWaveforms);
+	void buildImage(Slopes * out, int32_t format);
+
+public:
+
+	~WavetableImport();
+
+	/// Table to slot into a module's wavetableArray, null until an import has succeeded.
+	const Wavetable * table(void) {
+		return current ? &current->table : 0;
+	}
+
+	/// Convert the file at path (or read its conversion from cachePath, which may be null) into slopes for the given image format.
+	/// Returns 0 and leaves table() untouched if the file can't be read or parsed.
+	/// On success table() returns the new table, the one it returned before is overwritten by the next import.
+	int32_t import(const char * path, const char * cachePath, uint32_t maxWaveforms, int32_t format);
+
+};
+
+#endif
+
+#endif /* INC_WAVETABLE_IMPORT_HPP_ */
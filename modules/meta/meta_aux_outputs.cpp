@@ -8,76 +8,150 @@
 
 #include "meta.hpp"
 
-void ViaMeta::oversample(int32_t writeIndex) {
+template<int32_t OUTPUT_STAGE, int32_t DAC3_MODE>
+void ViaMeta::renderOutputsKernel(int32_t half) {
 
-	int32_t samplesRemaining = outputBufferSize;
+	int32_t writeIndex = half * META_BUFFER_SIZE;
 
-	int32_t readIndex = 0;
+	uint32_t * dac1 = outputs.dac1Samples + writeIndex;
+	uint32_t * dac2 = outputs.dac2Samples + writeIndex;
+	uint32_t * dac3 = outputs.dac3Samples + writeIndex;
+	int32_t * signal = metaWavetable.signalOut;
 
-	while (samplesRemaining) {
+	// block rate work for the output stage
 
-		outputs.dac1Samples[writeIndex] = (32767 - metaWavetable.signalOut[readIndex]) >> 3;
-		outputs.dac2Samples[writeIndex] = metaWavetable.signalOut[readIndex] >> 3;
+	int32_t dac1Sample = 0;
+	int32_t dac2Sample = 0;
+	int32_t lsb = 0;
+	int32_t drumSample = 0;
+	uint32_t firstDac2Sample;
 
-		readIndex ++;
-		writeIndex ++;
-		samplesRemaining --;
+	if (OUTPUT_STAGE == drumStage) {
+
+		advanceDrumEnvelopes();
+
+		// the oscillator holds one sample a block, the amp envelope moves every sample
+		drumSample = signal[0];
+		firstDac2Sample = fix16_mul(drumSample, ampEnvelope.output[0] << 1) >> 3;
+
+	} else if (OUTPUT_STAGE == addThreeBitsStage) {
+
+		// dither the three bits the dac can't resolve over the block
+		int32_t sample = signal[0];
+		dac2Sample = sample >> 3;
+		dac1Sample = (32767 - sample) >> 3;
+		lsb = -(sample & 0b111);
+		firstDac2Sample = __USAT(dac2Sample, 12);
+
+	} else {
+
+		firstDac2Sample = signal[0] >> 3;
 
 	}
-}
 
-void ViaMeta::addThreeBits(int32_t writeIndex) {
+	// block rate work for dac 3
+
+	int32_t dac3Sample = 0;
+
+	if (DAC3_MODE == dac3Noise) {
+
+		int32_t thisSample = metaController.ghostPhase >> 20;
 
-	int32_t dac2Sample = metaWavetable.signalOut[0];
-	int32_t dac2Base = dac2Sample >> 3;
-	int32_t dac1Sample = (32767 - dac2Sample);
-	int32_t dac1Base = dac1Sample >> 3;
+		if (thisSample != lastSample) {
+			lfsrState = signal[0];
+			advanceLFSR();
+		}
 
-	int32_t dac1LSB = -(dac2Sample & 0b111);
-	int32_t dac2LSB = -(dac2Sample & 0b111);
+		lastSample = thisSample;
+		dac3Sample = lfsrState;
 
-	int32_t samplesRemaining = outputBufferSize;
+	} else if (DAC3_MODE == dac3PhasorEnv) {
 
-	while (samplesRemaining) {
+		int32_t phasor = metaController.ghostPhase;
 
-		outputs.dac1Samples[writeIndex] = __USAT(dac1Base + (dac1LSB > 0), 12);
-		outputs.dac2Samples[writeIndex] = __USAT(dac2Base + (dac2LSB > 0), 12);
+		if (phasor >> 24) {
+			phasor = 8191 - (phasor >> 12);
+		} else {
+			phasor = phasor >> 12;
+		}
 
-//		outputs.dac1Samples[writeIndex] = dac1Base;
-//		outputs.dac2Samples[writeIndex] = dac2Base;
+		phasor = fix16_mul((phasor >> 1), dac3OffsetCompensation);
+		dac3Sample = __USAT(2048 - phasor - dac3Calibration, 12);
 
-		dac1LSB++;
-		dac2LSB++;
-		writeIndex ++;
-		samplesRemaining --;
+	} else if (DAC3_MODE == dac3ContourEnv) {
+
+		int32_t contour = fix16_mul(firstDac2Sample >> 1, dac3OffsetCompensation);
+		dac3Sample = 2048 - contour - dac3Calibration;
 
 	}
-}
 
-void ViaMeta::drumMode(int32_t writeIndex) {
+	for (int32_t i = 0; i < META_BUFFER_SIZE; i++) {
+
+		if (OUTPUT_STAGE == oversampleStage) {
+			dac1[i] = (32767 - signal[i]) >> 3;
+			dac2[i] = signal[i] >> 3;
+		} else if (OUTPUT_STAGE == addThreeBitsStage) {
+			dac1[i] = __USAT(dac1Sample + (lsb + i > 0), 12);
+			dac2[i] = __USAT(dac2Sample + (lsb + i > 0), 12);
+		} else {
+			uint32_t ampScale = ampEnvelope.output[i] << 1;
+			dac1[i] = fix16_mul(32767 - drumSample, ampScale) >> 3;
+			dac2[i] = fix16_mul(drumSample, ampScale) >> 3;
+		}
+
+		if (DAC3_MODE == dac3Phasor) {
+			dac3[i] = abs((int32_t) metaWavetable.phaseOut[i]) >> 19;
+		} else if (DAC3_MODE == dac3Contour) {
+			dac3[i] = 4095 - (signal[i] >> 3);
+		} else if (DAC3_MODE == dac3DrumEnv) {
+			dac3[i] = 2048 - (fix16_mul(ampEnvelope.output[i], dac3OffsetCompensation) >> 4) - dac3Calibration;
+		} else {
+			dac3[i] = dac3Sample;
+		}
 
-	ampEnvelope.advance(&inputs, wavetableReadDrum);
-	freqTransient.advance(&inputs, wavetableReadDrum);
-	morphEnvelope.advance(&inputs, wavetableReadDrum);
+	}
 
-	freqTransient.output[0] *= transientScale;
+	calculateDelta(half);
+	calculateLogicA(half);
+	calculateSH(half);
 
-	uint32_t ampScale = ampEnvelope.output[0] << 1;
-	int32_t sample = metaWavetable.signalOut[0];
+}
 
-	int32_t dac1Sample = fix16_mul(32767 - sample, ampScale) >> 3;
-	int32_t dac2Sample = fix16_mul(sample, ampScale) >> 3;
+void ViaMeta::advanceDrumEnvelopes(void) {
 
-	int32_t samplesRemaining = outputBufferSize;
+	for (int32_t i = 0; i < META_BUFFER_SIZE; i++) {
+		ampEnvelope.step(i);
+		freqTransient.step(i);
+		morphEnvelope.step(i);
+		ampEnvelope.output[i] = ampEnvelope.read(wavetableReadDrum);
+	}
 
-	while (samplesRemaining) {
+	// the pitch and morph envelopes are read once a block
+	freqTransient.output[0] = freqTransient.read(wavetableReadDrum) * transientScale;
+	morphEnvelope.output[0] = morphEnvelope.read(wavetableReadDrum);
 
-		outputs.dac1Samples[writeIndex] = dac1Sample;
-		outputs.dac2Samples[writeIndex] = dac2Sample;
+}
 
-		samplesRemaining --;
-		writeIndex ++;
+#define META_OUTPUT_KERNELS(STAGE) \
+	{&ViaMeta::renderOutputsKernel<STAGE, dac3Phasor>, \
+	&ViaMeta::renderOutputsKernel<STAGE, dac3Contour>, \
+	&ViaMeta::renderOutputsKernel<STAGE, dac3DrumEnv>, \
+	&ViaMeta::renderOutputsKernel<STAGE, dac3Noise>, \
+	&ViaMeta::renderOutputsKernel<STAGE, dac3PhasorEnv>, \
+	&ViaMeta::renderOutputsKernel<STAGE, dac3ContourEnv>}
 
+void (ViaMeta::* const ViaMeta::outputKernels[numOutputStages][numDac3Modes])(int32_t half) = {
+	META_OUTPUT_KERNELS(oversampleStage),
+	META_OUTPUT_KERNELS(addThreeBitsStage),
+	META_OUTPUT_KERNELS(drumStage),
+};
+
+void ViaMeta::calculateLogicA(int32_t writeIndex) {
+
+	if (logicAMode == attackGate) {
+		calculateLogicAAttackGate(writeIndex);
+	} else {
+		calculateLogicAReleaseGate(writeIndex);
 	}
 
 }
@@ -128,129 +202,27 @@ void ViaMeta::calculateDelta(int32_t writeIndex) {
 
 }
 
-void ViaMeta::calculateDac3Phasor(int32_t writeIndex) {
-
-	int32_t samplesRemaining = outputBufferSize;
-	int32_t readIndex = 0;
-
-	while (samplesRemaining) {
-
-		outputs.dac3Samples[writeIndex] = abs((int32_t)metaWavetable.phaseOut[readIndex]) >> 19;
-
-		samplesRemaining --;
-		readIndex ++;
-		writeIndex ++;
-
-	}
-}
-
-void ViaMeta::calculateDac3Contour(int32_t writeIndex) {
-
-	int32_t samplesRemaining = outputBufferSize;
-	int32_t readIndex = 0;
-
-	while (samplesRemaining) {
-
-		outputs.dac3Samples[writeIndex] = 4095 - (metaWavetable.signalOut[readIndex] >> 3);
-
-		samplesRemaining --;
-		readIndex ++;
-		writeIndex ++;
-
-	}
-
-}
-
-void ViaMeta::calculateDac3DrumEnv(int32_t writeIndex) {
-
-	int32_t samplesRemaining = outputBufferSize;
-	int32_t dac3Offset = dac3Calibration;
-
-	int32_t drumEnvSample = fix16_mul(drumWrite[writeIndex], dac3OffsetCompensation) >> 4;
-
-	drumEnvSample = 2048 - drumEnvSample - dac3Offset;
-
-	while (samplesRemaining) {
-
-		outputs.dac3Samples[writeIndex] = drumEnvSample;
-
-		samplesRemaining --;
-		writeIndex ++;
-
-	}
-
-}
-
-void ViaMeta::calculateDac3Noise(int32_t writeIndex) {
-
-	int32_t samplesRemaining = outputBufferSize;
-
-	int32_t thisSample = metaController.ghostPhase >> 20;
-
-	if (thisSample != lastSample) {
-		lfsrState = metaWavetable.signalOut[0];
-		advanceLFSR();
-	}
-
-	lastSample = thisSample;
-
-	while (samplesRemaining) {
-
-		outputs.dac3Samples[writeIndex] = lfsrState;
-
-		samplesRemaining --;
-		writeIndex ++;
-
-	}
-
-}
-
-void ViaMeta::calculateDac3PhasorEnv(int32_t writeIndex) {
-
-	int32_t phasor = metaController.ghostPhase;
-
-	if (phasor >> 24) {
-		phasor = 8191 - (phasor >> 12);
-	} else {
-		phasor = phasor >> 12;
-	}
-
-	int32_t dac3Offset = dac3Calibration;
-
-	phasor = fix16_mul((phasor >> 1), dac3OffsetCompensation);
-
-	phasor = __USAT(2048 - phasor - dac3Offset, 12) ;
-
-	int32_t samplesRemaining = outputBufferSize;
-
-	while (samplesRemaining) {
-
-		outputs.dac3Samples[writeIndex] = phasor;
-
-		samplesRemaining --;
-		writeIndex ++;
-
-	}
-
-}
-
-void ViaMeta::calculateDac3ContourEnv(int32_t writeIndex) {
-
-	int32_t dac3Offset = dac3Calibration;
-
-	int32_t contour = fix16_mul(outputs.dac2Samples[writeIndex] >> 1, dac3OffsetCompensation);
-
-	contour = 2048 - contour - dac3Offset;
-
-	int32_t samplesRemaining = outputBufferSize;
-
-	while (samplesRemaining) {
-
-		outputs.dac3Samples[writeIndex] = contour;
-
-		samplesRemaining --;
-		writeIndex ++;
-
+void ViaMeta::calculateSH(int32_t writeIndex) {
+
+	switch (shMode) {
+	case nosampleandhold:
+		calculateSHMode1(writeIndex);
+		break;
+	case a:
+		calculateSHMode2(writeIndex);
+		break;
+	case b:
+		calculateSHMode3(writeIndex);
+		break;
+	case ab:
+		calculateSHMode4(writeIndex);
+		break;
+	case halfdecimate:
+		calculateSHMode5(writeIndex);
+		break;
+	case meta_decimate:
+		calculateSHMode6(writeIndex);
+		break;
 	}
 
 }
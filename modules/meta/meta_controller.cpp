@@ -8,7 +8,7 @@
 #include "meta.hpp"
 
 /// defined for linkage
-constexpr uint32_t ExpoConverter::expoTable[];
+constexpr ExpoTable ExpoConverter::expoTable;
 
 /*
  *
@@ -23,11 +23,12 @@ void MetaController::parseControlsExternal(ViaControls * controls, ViaInputStrea
 
 void MetaController::parseControlsAudio(ViaControls * controls, ViaInputStreams * inputs) {
 	// time1 is coarse, time2 is fine, release time = attack time
+	// coarse knob and 1v/oct cv are summed in the exponent, cv at 16 bit resolution
 
-	timeBase1 = fix16_mul(fix16_mul(fix16_mul(expo.convert((controls->knob1Value >> 2)*3) >> 5, // 2 << 11
-			65535 + (controls->knob2Value << 4)), // 2 << 16
-			expo.convert(__USAT((int32_t)controls->cv1Value - cv1Offset, 12))), // expoTable[2048]
-			audioBaseIncrement);
+	timeBase1 = expo.multiply(fix16_mul(65535 + (controls->knob2Value << 4), // 2 << 16
+			audioBaseIncrement),
+			(((controls->knob1Value >> 2)*3) << 4) +
+			__USAT((int32_t)controls->cv1ValueHiRes - (cv1Offset << 4), 16), 5);
 	timeBase2 = timeBase1;
 
 	dutyCycleBase = 32767;
@@ -37,9 +38,9 @@ void MetaController::parseControlsAudio(ViaControls * controls, ViaInputStreams
 void MetaController::parseControlsDrum(ViaControls * controls, ViaInputStreams * inputs) {
 	// time1 is coarse, time2 is not used, release time = attack time
 
-	timeBase1 = fix16_mul(fix16_mul(expo.convert(((controls->knob1Value >> 3)*3) + 1024) >> 5,
-			expo.convert(__USAT((int32_t)controls->cv1Value - cv1Offset, 12))) >> 4,
-			drumBaseIncrement);
+	timeBase1 = expo.multiply(drumBaseIncrement,
+			((((controls->knob1Value >> 3)*3) + 1024) << 4) +
+			__USAT((int32_t)controls->cv1ValueHiRes - (cv1Offset << 4), 16), 9);
 
 	timeBase2 = timeBase1;
 
@@ -55,10 +56,9 @@ void MetaController::parseControlsEnv(ViaControls * controls, ViaInputStreams *
 
 	releaseMod = __USAT(releaseMod >> 4, 12);
 
-	timeBase1 = fix16_mul(expo.convert(4095 - controls->knob1Value) >> 8,
-			expo.convert((4095 - __USAT((int32_t)controls->cv1Value - cv1Offset, 12))) >> 7);
-	timeBase2 = fix16_mul(expo.convert(4095 - controls->knob2Value) >> 9,
-			expo.convert(releaseMod) >> 8);
+	timeBase1 = expo.multiply(1 << 16, ((4095 - controls->knob1Value) +
+			(4095 - __USAT((int32_t)controls->cv1Value - cv1Offset, 12))) << 4, 15);
+	timeBase2 = expo.multiply(1 << 16, ((4095 - controls->knob2Value) + releaseMod) << 4, 17);
 
 	dutyCycleBase = 32767;
 
@@ -67,8 +67,8 @@ void MetaController::parseControlsEnv(ViaControls * controls, ViaInputStreams *
 void MetaController::parseControlsSeq(ViaControls * controls, ViaInputStreams * inputs) {
 	// t1 is cycle time, t2 is used to feed the duty cycle input for getSamples
 
-	timeBase1 = fix16_mul(expo.convert(4095 - controls->knob1Value) >> 9,
-			expo.convert((4095 - __USAT(controls->cv1Value - cv1Offset, 12)) >> 1) >> 9);
+	timeBase1 = expo.multiply(1 << 16, ((4095 - controls->knob1Value) +
+			((4095 - __USAT(controls->cv1Value - cv1Offset, 12)) >> 1)) << 4, 18);
 	timeBase2 = timeBase1;
 
 	dutyCycleBase = controls->knob2Value << 4;
@@ -85,7 +85,19 @@ void MetaController::generateIncrementsAudio(ViaInputStreams * inputs) {
 
 	int32_t localFm = (int32_t) -fm[0];
 	localFm += 16384 + cv2Offset;
-	increment1 = fix16_mul(timeBase1, localFm);
+	int32_t targetIncrement = fix16_mul(timeBase1, localFm);
+
+	// ramp from the last block's increment to this one a sample at a time rather than stepping once per block
+	// increment1 is the mean of the ramp, so the controller phase moves by the same amount over the block,
+	// and incrementMod holds each sample's offset from it, built up by adding rather than multiplying
+	int32_t halfStep = (targetIncrement - lastIncrement) / (2 * META_BUFFER_SIZE);
+	increment1 = lastIncrement + (META_BUFFER_SIZE + 1) * halfStep;
+	int32_t mod = (1 - META_BUFFER_SIZE) * halfStep;
+	for (int32_t i = 0; i < META_BUFFER_SIZE; i++) {
+		incrementMod[i] = mod;
+		mod += 2 * halfStep;
+	}
+	lastIncrement = targetIncrement;
 	increment2 = increment1;
 
 	dutyCycle = dutyCycleBase;
@@ -126,11 +138,11 @@ void MetaController::generateIncrementsSeq(ViaInputStreams * inputs) {
 
 }
 
-void MetaController::advancePhaseExternal(uint32_t * phaseDistTable) {
-	(this->*advancePhase)(phaseDistTable);
+void MetaController::advancePhaseExternal(void) {
+	(this->*advancePhase)();
 }
 
-int32_t MetaController::advancePhasePWM(uint32_t * phaseDistTable) {
+int32_t MetaController::advancePhasePWM(void) {
 
 	int32_t phaseWrapper;
 
@@ -159,20 +171,9 @@ int32_t MetaController::advancePhasePWM(uint32_t * phaseDistTable) {
 
 	phase = localPhase;
 
-	uint32_t pwm = dutyCycle;
-	uint32_t pwmIndex = (pwm >> 11);
-	uint32_t pwmFrac = (pwm & 0x7FF) << 4;
-	// assuming that each phase distortion lookup table is 65 samples long stored as int32_t
-	uint32_t * pwmTable1 = phaseDistTable + pwmIndex * 65;
-	uint32_t * pwmTable2 = pwmTable1 + 65;
-	uint32_t leftSample = localPhase >> 19;
-
-#define pwmPhaseFrac (localPhase & 0x7FFFF) >> 4
-		// use this with the precalculated pwm to perform bilinear interpolation
-		// this accomplishes the
-	localPhase = fix15_bilerp(pwmTable1[leftSample], pwmTable2[leftSample],
-				pwmTable1[leftSample + 1], pwmTable2[leftSample + 1], pwmFrac,
-				pwmPhaseFrac);
+	// the breakpoint sweeps from 0.2 to 0.8 of the cycle, the phase is scaled up to 32 bits for the warp
+	pwmWarp.set(13107 + (((uint32_t) dutyCycle * 39322) >> 16));
+	localPhase = pwmWarp.warp(__USAT(localPhase, 25) << 7) >> 7;
 
 	// log a -1 if the max value index of the wavetable is traversed from the left
 	// log a 1 if traversed from the right
@@ -196,7 +197,7 @@ int32_t MetaController::advancePhasePWM(uint32_t * phaseDistTable) {
 
 }
 
-int32_t MetaController::advancePhaseOversampled(uint32_t * phaseDistTable) {
+int32_t MetaController::advancePhaseOversampled(void) {
 
 	int32_t phaseWrapper;
 
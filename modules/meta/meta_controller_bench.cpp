@@ -0,0 +1,83 @@
+/*
+ * meta_controller_bench.cpp
+ *
+ *  Virtual build only: measure the per block cost of the Meta controller
+ *  state machine in each frequency, loop and trigger mode.
+ */
+
+#include "meta.hpp"
+
+#ifdef BUILD_VIRTUAL
+
+#include <chrono>
+#include <new>
+
+/// Runs of benchController per mode in reportControllerBench, the fastest is reported.
+#define META_CONTROLLER_BENCH_RUNS 5
+
+double ViaMeta::benchController(int32_t freq, int32_t loop, int32_t trig, int32_t blocks, int32_t gatePeriod) {
+
+	metaUI.FREQ_MODE = freq;
+	metaUI.LOOP_MODE = loop;
+	metaUI.TRIG_MODE = trig;
+	metaUI.recallModuleState();
+
+	// settle the averaged controls in the middle of their range
+	for (int32_t i = 0; i < 16; i++) {
+		controls.controlRateInputs[i] = 2048;
+	}
+	for (int32_t i = 0; i < 64; i++) {
+		slowConversionCallback();
+	}
+	(metaController.*metaController.parseControls)(&controls, &inputs);
+
+	// the part of halfTransferCallback and transferCompleteCallback that runs the state machine
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int32_t block = 0; block < blocks; block++) {
+		if (block % gatePeriod == 0) {
+			mainRisingEdgeCallback();
+		} else if (block % gatePeriod == gatePeriod / 2) {
+			mainFallingEdgeCallback();
+		}
+		metaController.generateIncrementsExternal(&inputs);
+		metaController.advancePhaseExternal();
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+	return elapsed.count() / blocks;
+
+}
+
+void ViaMeta::reportControllerBench(FILE * report, int32_t blocks, int32_t gatePeriod) {
+
+	fprintf(report, "%d blocks, gate every %d blocks, best of %d runs\n", blocks, gatePeriod, META_CONTROLLER_BENCH_RUNS);
+	fprintf(report, "freq loop trig  ns/block\n");
+
+	// one block on the heap for the whole sweep, a module is constructed afresh in it for each run
+	ViaMeta * module = (ViaMeta *) operator new(sizeof(ViaMeta));
+
+	double total = 0;
+	int32_t modes = 0;
+	for (int32_t freq = 0; freq < numButton3Modes; freq++) {
+		for (int32_t loop = 0; loop < numButton6Modes; loop++) {
+			for (int32_t trig = 0; trig < numButton4Modes; trig++) {
+				double best = 0;
+				for (int32_t run = 0; run < META_CONTROLLER_BENCH_RUNS; run++) {
+					new (module) ViaMeta;
+					double time = module->benchController(freq, loop, trig, blocks, gatePeriod);
+					module->~ViaMeta();
+					best = (run == 0 || time < best) ? time : best;
+				}
+				fprintf(report, "%4d %4d %4d %9.2f\n", freq, loop, trig, best);
+				total += best;
+				modes++;
+			}
+		}
+	}
+	fprintf(report, "mean %19.2f\n", total / modes);
+
+	operator delete(module);
+
+}
+
+#endif
@@ -0,0 +1,29 @@
+/*
+ * meta_controller_bench_main.cpp
+ *
+ *  Virtual build only: command line driver for ViaMeta::reportControllerBench.
+ *  Built with META_CONTROLLER_BENCH_MAIN defined, for example from the repo root:
+ *  g++ -std=c++11 -O2 -DBUILD_VIRTUAL -DMETA_CONTROLLER_BENCH_MAIN -Imodules/inc -Iui/inc -Iio/inc
+ *      modules/meta/[a-z]*.cpp modules/shared/[a-z]*.cpp ui/src/[a-z]*.cpp io/src/[a-z]*.cpp -o meta_controller_bench
+ */
+
+#include "meta.hpp"
+
+#if defined(BUILD_VIRTUAL) && defined(META_CONTROLLER_BENCH_MAIN)
+
+#include <stdlib.h>
+
+int main(int argc, char ** argv) {
+
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s blocks gatePeriod\n", argv[0]);
+		return 1;
+	}
+
+	ViaMeta::reportControllerBench(stdout, atoi(argv[1]), atoi(argv[2]));
+
+	return 0;
+
+}
+
+#endif
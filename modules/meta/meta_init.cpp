@@ -15,11 +15,8 @@ void ViaMeta::init() {
 
 	initializeAuxOutputs();
 
-	outputStage = &ViaMeta::oversample;
+	setOutputStage(oversampleStage);
 	updateRGB = &ViaMeta::updateRGBSubaudio;
-	calculateDac3 = &ViaMeta::calculateDac3Phasor;
-	calculateLogicA = &ViaMeta::calculateLogicAReleaseGate;
-	calculateSH = &ViaMeta::calculateSHMode1;
 
 	metaController.parseControls = &MetaController::parseControlsDrum;
 	metaController.generateIncrements = &MetaController::generateIncrementsDrum;
@@ -28,19 +25,26 @@ void ViaMeta::init() {
 
 	metaController.loopHandler = &MetaController::handleLoopOn;
 
-	ampEnvelope.incrementArbiter = &SimpleEnvelope::restingState;
-	freqTransient.incrementArbiter = &SimpleEnvelope::restingState;
-	morphEnvelope.incrementArbiter = &SimpleEnvelope::restingState;
+	ampEnvelope.state = SimpleEnvelope::resting;
+	freqTransient.state = SimpleEnvelope::resting;
+	morphEnvelope.state = SimpleEnvelope::resting;
 
 
 
 	// initialize our touch sensors
 
 	fillWavetableArray();
+#ifdef WAVETABLE_INCREMENTAL_LOAD
+	wavetableLoader.init((uint32_t *) wavetableBuffers[0], (uint32_t *) wavetableBuffers[1], WAVETABLE_15_BIT);
+#endif
+#ifdef WAVETABLE_MIPMAP
+	metaWavetable.mipmap = &wavetableMipmap;
+#endif
 	initDrum();
-	ampEnvelope.output = (int32_t*) drumWrite;
+	ampEnvelope.output = drumWrite;
 	freqTransient.output = (int32_t*) drum2Write;
 	morphEnvelope.output = (int32_t*) drum3Write;
+	metaWavetable.incrementMod = incrementOff;
 
 
 
@@ -18,8 +18,6 @@
 #define EXPAND_LOGIC_HIGH GPIOA->BRR = (uint32_t)GPIO_PIN_12;
 #define EXPAND_LOGIC_LOW GPIOA->BSRR = (uint32_t)GPIO_PIN_12;
 
-const uint32_t phaseModPWMTables[33][65] = {phaseModPWM_0, phaseModPWM_1, phaseModPWM_2, phaseModPWM_3, phaseModPWM_4, phaseModPWM_5, phaseModPWM_6, phaseModPWM_7, phaseModPWM_8, phaseModPWM_9, phaseModPWM_10, phaseModPWM_11, phaseModPWM_12, phaseModPWM_13, phaseModPWM_14, phaseModPWM_15, phaseModPWM_16, phaseModPWM_17, phaseModPWM_18, phaseModPWM_19, phaseModPWM_20, phaseModPWM_21, phaseModPWM_22, phaseModPWM_23, phaseModPWM_24, phaseModPWM_25, phaseModPWM_26, phaseModPWM_27, phaseModPWM_28, phaseModPWM_29, phaseModPWM_30, phaseModPWM_31, phaseModPWM_32};
-
 void ViaMeta::mainRisingEdgeCallback(void) {
 
 	metaController.triggerSignal = 0;
@@ -32,14 +30,13 @@ void ViaMeta::mainRisingEdgeCallback(void) {
 
 	if (presetSequenceMode) {
 		int32_t preset = (presetOverride > 0) ? presetOverride : presetSequence[presetSequenceIndex];
-		metaUI.loadFromEEPROM(preset);
 		if (!presetSequenceEdit) {
 			metaUI.presetNumber = preset;
 			setLEDs(presetSequenceIndex);
 		}
 		presetSequenceIndex ++;
 		presetSequenceIndex &= 7;
-		metaUI.recallModuleState();
+		recallPreset(preset);
 	} else if (runtimeDisplay) {
 		updateRGB = &ViaMeta::updateRGBBlink;
 
@@ -132,15 +129,11 @@ void ViaMeta::halfTransferCallback(void) {
 	setLogicOut(0, runtimeDisplay && !presetSequenceMode);
 
 	metaController.generateIncrementsExternal(&inputs);
-	metaController.advancePhaseExternal((uint32_t *) phaseModPWMTables);
+	metaController.advancePhaseExternal();
 	metaWavetable.phase = metaController.phaseBeforeIncrement;
 	metaWavetable.increment = metaController.incrementUsed;
-	metaWavetable.advance((uint32_t *) wavetableRead);
-	(this->*outputStage)(0);
-	calculateDelta(0);
-	(this->*calculateDac3)(0);
-	(this->*calculateLogicA)(0);
-	(this->*calculateSH)(0);
+	advanceWavetable();
+	(this->*renderOutputs)(0);
 	metaController.triggerSignal = 1;
 
 
@@ -151,15 +144,11 @@ void ViaMeta::transferCompleteCallback(void) {
 	setLogicOut(1, runtimeDisplay && !presetSequenceMode);
 
 	metaController.generateIncrementsExternal(&inputs);
-	metaController.advancePhaseExternal((uint32_t *) phaseModPWMTables);
+	metaController.advancePhaseExternal();
 	metaWavetable.phase = metaController.phaseBeforeIncrement;
 	metaWavetable.increment = metaController.incrementUsed;
-	metaWavetable.advance((uint32_t *) wavetableRead);
-	(this->*outputStage)(META_BUFFER_SIZE);
-	calculateDelta(1);
-	(this->*calculateDac3)(META_BUFFER_SIZE);
-	(this->*calculateLogicA)(1);
-	(this->*calculateSH)(1);
+	advanceWavetable();
+	(this->*renderOutputs)(1);
 	metaController.triggerSignal = 1;
 }
 
@@ -167,6 +156,15 @@ void ViaMeta::slowConversionCallback(void) {
 
 
 	controls.updateExtra();
+#ifdef WAVETABLE_INCREMENTAL_LOAD
+	// the outgoing table has to stay intact until its crossfade is done
+	if (!tableCrossfade && wavetableLoader.step()) {
+		flipWavetable(wavetableLoader.front, wavetableLoader.active->numWaveforms - 1);
+	}
+#endif
+#ifdef WAVETABLE_MIPMAP
+	wavetableMipmap.step();
+#endif
 	if (!presetSequenceEdit) {
 		metaWavetable.parseControls(&controls);
 		metaController.parseControlsExternal(&controls, &inputs);
@@ -9,26 +9,7 @@
 
 void ViaMeta::handleButton1ModeChange(int32_t mode) {
 
-	switch (mode) {
-	case nosampleandhold:
-		calculateSH = &ViaMeta::calculateSHMode1;
-		break;
-	case a:
-		calculateSH = &ViaMeta::calculateSHMode2;
-		break;
-	case b:
-		calculateSH = &ViaMeta::calculateSHMode3;
-		break;
-	case ab:
-		calculateSH = &ViaMeta::calculateSHMode4;
-		break;
-	case halfdecimate:
-		calculateSH = &ViaMeta::calculateSHMode5;
-		break;
-	case meta_decimate:
-		calculateSH = &ViaMeta::calculateSHMode6;
-		break;
-	}
+	shMode = mode;
 
 	setSH(0, 0);
 }
@@ -83,35 +64,52 @@ void ViaMeta::handleButton3ModeChange(int32_t mode) {
 
 void ViaMeta::handleButton4ModeChange(int32_t mode) {
 
-	metaController.atB = 0;
+	MetaPreset settings;
+	capturePreset(&settings);
+	triggerModeSettings(mode, metaUI.LOOP_MODE, &settings);
+	applySettings(&settings);
+	restartTrigger();
+
+}
+
+void ViaMeta::triggerModeSettings(int32_t mode, int32_t loop, MetaPreset * preset) {
 
 	switch (mode) {
 	case noretrigger:
-		metaController.incrementArbiter = &MetaController::noRetrigAttackState;
+		preset->incrementArbiter = &MetaController::noRetrigAttackState;
 		break;
 	case meta_hardsync:
-		metaController.incrementArbiter = &MetaController::hardSyncAttackState;
+		preset->incrementArbiter = &MetaController::hardSyncAttackState;
 		break;
 	case nongatedretrigger:
-		metaController.incrementArbiter = &MetaController::envAttackState;
+		preset->incrementArbiter = &MetaController::envAttackState;
 		break;
 	case gated:
-		metaController.incrementArbiter = &MetaController::gateAttackState;
-		metaController.phase = 0;
-		metaController.gateOn = 1;
+		preset->incrementArbiter = &MetaController::gateAttackState;
+		preset->gateOn = 1;
 		break;
 	case meta_pendulum:
-		if (metaUI.LOOP_MODE == 1) {
-			metaController.incrementArbiter = &MetaController::pendulumForwardAttackState;
+		if (loop == looping) {
+			preset->incrementArbiter = &MetaController::pendulumForwardAttackState;
 		} else {
-			metaController.incrementArbiter = &MetaController::stickyPendulumRestingState;
+			preset->incrementArbiter = &MetaController::stickyPendulumRestingState;
 		}
-		metaController.gateOn = 0;
+		preset->gateOn = 0;
 		break;
 	}
 
 }
 
+// what a trigger mode change does beyond the preset fields, also run by recallPreset
+void ViaMeta::restartTrigger(void) {
+
+	metaController.atB = 0;
+	if (metaController.incrementArbiter == &MetaController::gateAttackState) {
+		metaController.phase = 0;
+	}
+
+}
+
 void ViaMeta::handleButton5ModeChange(int32_t mode) {
 
 	switchWavetable(wavetableArray[metaUI.FREQ_MODE][mode]);
@@ -154,31 +152,39 @@ void ViaMeta::handleButton6ModeChange(int32_t mode) {
 
 void ViaMeta::handleAux1ModeChange(int32_t mode) {
 
+	MetaPreset settings;
+	capturePreset(&settings);
+	drumAuxModeSettings(mode, &settings);
+	applySettings(&settings);
+
+}
+
+void ViaMeta::drumAuxModeSettings(int32_t mode, MetaPreset * preset) {
+
 	switch (mode) {
 	case drumPhasor:
-		calculateDac3 = &ViaMeta::calculateDac3Phasor;
+		preset->dac3Mode = dac3Phasor;
 		break;
 	case drumContour:
-		calculateDac3 = &ViaMeta::calculateDac3Contour;
+		preset->dac3Mode = dac3Contour;
 		break;
 	case drumEnv:
-		calculateDac3 = &ViaMeta::calculateDac3DrumEnv;
+		preset->dac3Mode = dac3DrumEnv;
 		break;
 	case noise:
-		calculateDac3 = &ViaMeta::calculateDac3Noise;
+		preset->dac3Mode = dac3Noise;
 	}
 
-
 }
 
 void ViaMeta::handleAux2ModeChange(int32_t mode) {
 
 	switch (mode) {
 	case releaseGate:
-		calculateLogicA = &ViaMeta::calculateLogicAReleaseGate;
+		logicAMode = releaseGate;
 		break;
 	case attackGate:
-		calculateLogicA = &ViaMeta::calculateLogicAAttackGate;
+		logicAMode = attackGate;
 		break;
 	}
 
@@ -186,62 +192,73 @@ void ViaMeta::handleAux2ModeChange(int32_t mode) {
 
 void ViaMeta::handleAux3ModeChange(int32_t mode) {
 
+	// an unknown mode leaves the settings as they are
+	MetaPreset settings;
+	capturePreset(&settings);
+	drumModeSettings(mode, &settings);
+	applySettings(&settings);
+
+}
+
+void ViaMeta::drumModeSettings(int32_t mode, MetaPreset * preset) {
+
 	switch (mode) {
 	case pitchMorphAmp:
-		metaController.fm = (int16_t*) morphEnvelope.output;
-		metaWavetable.morphScale = (int16_t*) ampEnvelope.output;
-
-		ampEnvelope.attack = 2 << 16;
-		morphAttackMultiplier = 1 << 8;
-		morphReleaseMultiplier = 1 << 3;
-		freqAttackMultiplier = 1 << 13;
-		freqReleaseMultiplier = 1<< 12;
-		transientScale = 1 << 3;
-		minTransientLength = 10000;
-		morphReleaseClamp = 1000;
+		preset->fm = (int16_t*) morphEnvelope.output;
+		// the amp envelope is a sample per dac sample, morph reads it once a block at the end
+		preset->morphScale = (int16_t*) (ampEnvelope.output + META_BUFFER_SIZE - 1);
+
+		preset->ampAttack = 2 << 16;
+		preset->morphAttackMultiplier = 1 << 8;
+		preset->morphReleaseMultiplier = 1 << 3;
+		preset->freqAttackMultiplier = 1 << 13;
+		preset->freqReleaseMultiplier = 1<< 12;
+		preset->transientScale = 1 << 3;
+		preset->minTransientLength = 10000;
+		preset->morphReleaseClamp = 1000;
 
 		break;
 	case pitchAmp:
-		metaController.fm = (int16_t*) morphEnvelope.output;
-		metaWavetable.morphScale = drumFullScale;
-
-		ampEnvelope.attack = 1 << 16;
-		morphAttackMultiplier = 1 << 8;
-		morphReleaseMultiplier = 1 << 1;
-		freqAttackMultiplier = 1 << 11;
-		freqReleaseMultiplier = 1<< 7;
-		transientScale = 1 << 1;
-		minTransientLength = 10000;
-		morphReleaseClamp = 0;
+		preset->fm = (int16_t*) morphEnvelope.output;
+		preset->morphScale = drumFullScale;
+
+		preset->ampAttack = 1 << 16;
+		preset->morphAttackMultiplier = 1 << 8;
+		preset->morphReleaseMultiplier = 1 << 1;
+		preset->freqAttackMultiplier = 1 << 11;
+		preset->freqReleaseMultiplier = 1<< 7;
+		preset->transientScale = 1 << 1;
+		preset->minTransientLength = 10000;
+		preset->morphReleaseClamp = 0;
 
 		break;
 	case morphAmp:
-		metaController.fm = drumFullScale;
-		metaWavetable.morphScale = (int16_t*) morphEnvelope.output;
+		preset->fm = drumFullScale;
+		preset->morphScale = (int16_t*) morphEnvelope.output;
 
-		ampEnvelope.attack = 2 << 16;
-		morphAttackMultiplier = 1 << 6;
-		morphReleaseMultiplier = 1;
-		freqAttackMultiplier = 1 << 13;
-		freqReleaseMultiplier = 1<< 12;
-		transientScale = 1 << 2;
-		minTransientLength = 0;
-		morphReleaseClamp = 0;
+		preset->ampAttack = 2 << 16;
+		preset->morphAttackMultiplier = 1 << 6;
+		preset->morphReleaseMultiplier = 1;
+		preset->freqAttackMultiplier = 1 << 13;
+		preset->freqReleaseMultiplier = 1<< 12;
+		preset->transientScale = 1 << 2;
+		preset->minTransientLength = 0;
+		preset->morphReleaseClamp = 0;
 
 
 		break;
 	case amp:
-		metaController.fm = drumFullScale;
-		metaWavetable.morphScale = drumFullScale;
-
-		ampEnvelope.attack = 2 << 16;
-		morphAttackMultiplier = 1 << 8;
-		morphReleaseMultiplier = 1 << 2;
-		freqAttackMultiplier = 1 << 13;
-		freqReleaseMultiplier = 1<< 12;
-		transientScale = 1;
-		minTransientLength = 20;
-		morphReleaseClamp = 0;
+		preset->fm = drumFullScale;
+		preset->morphScale = drumFullScale;
+
+		preset->ampAttack = 2 << 16;
+		preset->morphAttackMultiplier = 1 << 8;
+		preset->morphReleaseMultiplier = 1 << 2;
+		preset->freqAttackMultiplier = 1 << 13;
+		preset->freqReleaseMultiplier = 1<< 12;
+		preset->transientScale = 1;
+		preset->minTransientLength = 20;
+		preset->morphReleaseClamp = 0;
 
 		break;
 	}
@@ -250,19 +267,28 @@ void ViaMeta::handleAux3ModeChange(int32_t mode) {
 
 void ViaMeta::handleAux4ModeChange(int32_t mode) {
 
+	MetaPreset settings;
+	capturePreset(&settings);
+	dac3ModeSettings(mode, metaUI.FREQ_MODE, &settings);
+	applySettings(&settings);
+
+}
+
+void ViaMeta::dac3ModeSettings(int32_t mode, int32_t freq, MetaPreset * preset) {
+
 	switch (mode) {
 	case phasor:
-		if (metaUI.FREQ_MODE == env) {
-			calculateDac3 = &ViaMeta::calculateDac3PhasorEnv;
+		if (freq == env) {
+			preset->dac3Mode = dac3PhasorEnv;
 		} else {
-			calculateDac3 = &ViaMeta::calculateDac3Phasor;
+			preset->dac3Mode = dac3Phasor;
 		}
 		break;
 	case contour:
-		if (metaUI.FREQ_MODE == env) {
-			calculateDac3 = &ViaMeta::calculateDac3ContourEnv;
+		if (freq == env) {
+			preset->dac3Mode = dac3ContourEnv;
 		} else {
-			calculateDac3 = &ViaMeta::calculateDac3Contour;
+			preset->dac3Mode = dac3Contour;
 		}
 
 		break;
@@ -276,52 +302,79 @@ void ViaMeta::initializeDrum(void) {
 		updateRGB = &ViaMeta::updateRGBDrum;
 		currentRGBBehavior = &ViaMeta::updateRGBDrum;
 	}
-	metaController.drumBaseIncrement = metaController.drumBaseIncrementStore;
 
-	metaController.generateIncrements = &MetaController::generateIncrementsDrum;
-	metaController.parseControls = &MetaController::parseControlsDrum;
-	// metaController.fm = drumFullScale; // set in the drum mode handler
-	metaController.expoFM = freqTransient.output;
-	metaController.advancePhase = &MetaController::advancePhaseOversampled;
-	metaController.loopHandler = &MetaController::handleLoopOn;
-	metaController.loopMode = 1;
+	MetaPreset settings;
+	capturePreset(&settings);
+	drumSettings(metaUI.DRUM_AUX_MODE, metaUI.DRUM_MODE, &settings);
+	applySettings(&settings);
+	restartTrigger();
+
+}
+
+void ViaMeta::drumSettings(int32_t drumAux, int32_t drumMode, MetaPreset * preset) {
+
+	preset->drumBaseIncrement = metaController.drumBaseIncrementStore;
 
-	// metaWavetable.morphScale = drumFullScale; // set in the drum mode handler
-	metaWavetable.oversamplingFactor = 0;
+	preset->generateIncrements = &MetaController::generateIncrementsDrum;
+	preset->parseControls = &MetaController::parseControlsDrum;
+	// fm and morphScale are set by the drum mode
+	preset->expoFM = freqTransient.output;
+	preset->advancePhase = &MetaController::advancePhaseOversampled;
+	preset->loopHandler = &MetaController::handleLoopOn;
+	preset->loopMode = 1;
 
-	outputStage = &ViaMeta::drumMode;
+	preset->oversamplingFactor = 0;
+	preset->incrementMod = incrementOff;
+
+	preset->outputStage = drumStage;
+
+	triggerModeSettings(noretrigger, looping, preset);
+	drumAuxModeSettings(drumAux, preset);
+	drumModeSettings(drumMode, preset);
 
-	handleButton4ModeChange(0);
-	handleAux1ModeChange(metaUI.DRUM_AUX_MODE);
-	handleAux3ModeChange(metaUI.DRUM_MODE);
 }
-void ViaMeta::initializeOscillator(void) {
 
+void ViaMeta::initializeOscillator(void) {
 
-	if (presetSequenceMode) {
-		metaController.parseControls = &MetaController::parseControlsDrum;
-		metaController.drumBaseIncrement = (metaController.drumBaseIncrementStore)*3;
-	} else {
-		metaController.parseControls = &MetaController::parseControlsAudio;
+	if (!presetSequenceMode) {
 		updateRGB = &ViaMeta::updateRGBOsc;
 		currentRGBBehavior = &ViaMeta::updateRGBOsc;
 	}
-	metaController.generateIncrements = &MetaController::generateIncrementsAudio;
-	metaController.advancePhase = &MetaController::advancePhaseOversampled;
-	metaController.fm = inputs.cv2Samples;
-	metaController.expoFM = drumOff;
-	metaController.loopHandler = &MetaController::handleLoopOn;
-	metaController.loopMode = 1;
 
-	metaWavetable.morphScale = drumFullScale;
-	metaWavetable.oversamplingFactor = 3;
+	MetaPreset settings;
+	capturePreset(&settings);
+	oscillatorSettings(metaUI.TRIG_MODE, metaUI.DAC_3_MODE, presetSequenceMode, &settings);
+	applySettings(&settings);
+	restartTrigger();
 
-	outputStage = &ViaMeta::oversample;
+}
 
-	handleButton4ModeChange(metaUI.TRIG_MODE);
-	handleAux4ModeChange(metaUI.DAC_3_MODE);
+void ViaMeta::oscillatorSettings(int32_t trig, int32_t dac3, int32_t sequenced, MetaPreset * preset) {
+
+	if (sequenced) {
+		preset->parseControls = &MetaController::parseControlsDrum;
+		preset->drumBaseIncrement = (metaController.drumBaseIncrementStore)*3;
+	} else {
+		preset->parseControls = &MetaController::parseControlsAudio;
+	}
+	preset->generateIncrements = &MetaController::generateIncrementsAudio;
+	preset->advancePhase = &MetaController::advancePhaseOversampled;
+	preset->fm = inputs.cv2Samples;
+	preset->expoFM = drumOff;
+	preset->loopHandler = &MetaController::handleLoopOn;
+	preset->loopMode = 1;
+
+	preset->morphScale = drumFullScale;
+	preset->incrementMod = metaController.incrementMod;
+	preset->oversamplingFactor = 3;
+
+	preset->outputStage = oversampleStage;
+
+	triggerModeSettings(trig, looping, preset);
+	dac3ModeSettings(dac3, audio, preset);
 
 }
+
 void ViaMeta::initializeEnvelope(void) {
 
 	if (!presetSequenceMode) {
@@ -329,69 +382,107 @@ void ViaMeta::initializeEnvelope(void) {
 		currentRGBBehavior = &ViaMeta::updateRGBSubaudio;
 	}
 
-	metaController.parseControls = &MetaController::parseControlsEnv;
-	metaController.generateIncrements = &MetaController::generateIncrementsEnv;
-	metaController.advancePhase = &MetaController::advancePhasePWM;
-	metaController.fm = inputs.cv2Samples;
-	metaController.expoFM = drumOff;
-	metaController.loopHandler = &MetaController::handleLoopOff;
-	metaController.loopMode = 0;
+	MetaPreset settings;
+	capturePreset(&settings);
+	envelopeSettings(metaUI.TRIG_MODE, metaUI.DAC_3_MODE, &settings);
+	applySettings(&settings);
+	restartTrigger();
 
-	metaWavetable.oversamplingFactor = 0;
-	metaWavetable.morphScale = drumFullScale;
+}
+
+void ViaMeta::envelopeSettings(int32_t trig, int32_t dac3, MetaPreset * preset) {
+
+	preset->parseControls = &MetaController::parseControlsEnv;
+	preset->generateIncrements = &MetaController::generateIncrementsEnv;
+	preset->advancePhase = &MetaController::advancePhasePWM;
+	preset->fm = inputs.cv2Samples;
+	preset->expoFM = drumOff;
+	preset->loopHandler = &MetaController::handleLoopOff;
+	preset->loopMode = 0;
+
+	preset->oversamplingFactor = 0;
+	preset->incrementMod = incrementOff;
+	preset->morphScale = drumFullScale;
 
-	outputStage = &ViaMeta::addThreeBits;
+	preset->outputStage = addThreeBitsStage;
 
-	handleButton4ModeChange(metaUI.TRIG_MODE);
-	handleAux4ModeChange(metaUI.DAC_3_MODE);
+	triggerModeSettings(trig, noloop, preset);
+	dac3ModeSettings(dac3, env, preset);
 
 }
+
 void ViaMeta::initializeSimpleLFO(void) {
+
 	if (!presetSequenceMode) {
 		updateRGB = &ViaMeta::updateRGBSubaudio;
 		currentRGBBehavior = &ViaMeta::updateRGBSubaudio;
 	}
 
-	metaController.parseControls = &MetaController::parseControlsEnv;
-	metaController.generateIncrements = &MetaController::generateIncrementsEnv;
-	metaController.advancePhase = &MetaController::advancePhasePWM;
-	metaController.fm = inputs.cv2Samples;
-	metaController.expoFM = drumOff;
-	metaController.loopHandler = &MetaController::handleLoopOn;
-	metaController.loopMode = 1;
+	MetaPreset settings;
+	capturePreset(&settings);
+	simpleLFOSettings(metaUI.TRIG_MODE, metaUI.DAC_3_MODE, &settings);
+	applySettings(&settings);
+	restartTrigger();
 
-	metaWavetable.oversamplingFactor = 0;
-	metaWavetable.morphScale = drumFullScale;
+}
 
-	outputStage = &ViaMeta::addThreeBits;
+void ViaMeta::simpleLFOSettings(int32_t trig, int32_t dac3, MetaPreset * preset) {
 
-	handleButton4ModeChange(metaUI.TRIG_MODE);
-	handleAux4ModeChange(metaUI.DAC_3_MODE);
+	preset->parseControls = &MetaController::parseControlsEnv;
+	preset->generateIncrements = &MetaController::generateIncrementsEnv;
+	preset->advancePhase = &MetaController::advancePhasePWM;
+	preset->fm = inputs.cv2Samples;
+	preset->expoFM = drumOff;
+	preset->loopHandler = &MetaController::handleLoopOn;
+	preset->loopMode = 1;
+
+	preset->oversamplingFactor = 0;
+	preset->incrementMod = incrementOff;
+	preset->morphScale = drumFullScale;
+
+	preset->outputStage = addThreeBitsStage;
+
+	triggerModeSettings(trig, looping, preset);
+	dac3ModeSettings(dac3, env, preset);
 
 }
+
 void ViaMeta::initializeSequence(void) {
+
 	if (!presetSequenceMode) {
 		updateRGB = &ViaMeta::updateRGBSubaudio;
 		currentRGBBehavior = &ViaMeta::updateRGBSubaudio;
 	}
 
-	metaController.parseControls = &MetaController::parseControlsSeq;
-	metaController.generateIncrements = &MetaController::generateIncrementsSeq;
-	metaController.advancePhase = &MetaController::advancePhasePWM;
-	metaController.fm = drumFullScale;
-	metaController.expoFM = drumOff;
-	metaController.loopHandler = &MetaController::handleLoopOff;
-	metaController.loopMode = 0;
+	MetaPreset settings;
+	capturePreset(&settings);
+	sequenceSettings(metaUI.TRIG_MODE, metaUI.DAC_3_MODE, &settings);
+	applySettings(&settings);
+	restartTrigger();
+
+}
+
+void ViaMeta::sequenceSettings(int32_t trig, int32_t dac3, MetaPreset * preset) {
 
-	metaWavetable.oversamplingFactor = 0;
-	metaWavetable.morphScale = drumFullScale;
+	preset->parseControls = &MetaController::parseControlsSeq;
+	preset->generateIncrements = &MetaController::generateIncrementsSeq;
+	preset->advancePhase = &MetaController::advancePhasePWM;
+	preset->fm = drumFullScale;
+	preset->expoFM = drumOff;
+	preset->loopHandler = &MetaController::handleLoopOff;
+	preset->loopMode = 0;
 
-	outputStage = &ViaMeta::addThreeBits;
+	preset->oversamplingFactor = 0;
+	preset->incrementMod = incrementOff;
+	preset->morphScale = drumFullScale;
 
-	handleButton4ModeChange(metaUI.TRIG_MODE);
-	handleAux4ModeChange(metaUI.DAC_3_MODE);
+	preset->outputStage = addThreeBitsStage;
+
+	triggerModeSettings(trig, noloop, preset);
+	dac3ModeSettings(dac3, seq, preset);
 
 }
+
 void ViaMeta::initializeComplexLFO(void) {
 
 	if (!presetSequenceMode) {
@@ -399,23 +490,202 @@ void ViaMeta::initializeComplexLFO(void) {
 		currentRGBBehavior = &ViaMeta::updateRGBSubaudio;
 	}
 
-	metaController.parseControls = &MetaController::parseControlsSeq;
-	metaController.generateIncrements = &MetaController::generateIncrementsSeq;
-	metaController.advancePhase = &MetaController::advancePhasePWM;
-	metaController.fm = drumFullScale;
-	metaController.expoFM = drumOff;
-	metaController.loopHandler = &MetaController::handleLoopOn;
-	metaController.loopMode = 1;
+	MetaPreset settings;
+	capturePreset(&settings);
+	complexLFOSettings(metaUI.TRIG_MODE, metaUI.DAC_3_MODE, &settings);
+	applySettings(&settings);
+	restartTrigger();
+
+}
+
+void ViaMeta::complexLFOSettings(int32_t trig, int32_t dac3, MetaPreset * preset) {
+
+	preset->parseControls = &MetaController::parseControlsSeq;
+	preset->generateIncrements = &MetaController::generateIncrementsSeq;
+	preset->advancePhase = &MetaController::advancePhasePWM;
+	preset->fm = drumFullScale;
+	preset->expoFM = drumOff;
+	preset->loopHandler = &MetaController::handleLoopOn;
+	preset->loopMode = 1;
+
+	preset->oversamplingFactor = 0;
+	preset->incrementMod = incrementOff;
+	preset->morphScale = drumFullScale;
+
+	preset->outputStage = addThreeBitsStage;
+
+	triggerModeSettings(trig, looping, preset);
+	dac3ModeSettings(dac3, seq, preset);
+
+}
+
+void ViaMeta::capturePreset(MetaPreset * preset) {
+
+	preset->modes = ENCODE_PRESET(metaUI.button1Mode, metaUI.button2Mode, metaUI.button3Mode,
+			metaUI.button4Mode, metaUI.button5Mode, metaUI.button6Mode,
+			metaUI.aux1Mode, metaUI.aux2Mode, metaUI.aux3Mode, metaUI.aux4Mode);
+	preset->table = wavetableArray[metaUI.FREQ_MODE][metaUI.TABLE];
+
+	preset->outputStage = outputStage;
+	preset->dac3Mode = dac3Mode;
+	preset->logicAMode = logicAMode;
+	preset->shMode = shMode;
+
+	preset->parseControls = metaController.parseControls;
+	preset->generateIncrements = metaController.generateIncrements;
+	preset->advancePhase = metaController.advancePhase;
+	preset->fm = metaController.fm;
+	preset->expoFM = metaController.expoFM;
+	preset->loopMode = metaController.loopMode;
+	preset->loopHandler = metaController.loopHandler;
+	preset->incrementArbiter = metaController.incrementArbiter;
+	preset->gateOn = metaController.gateOn;
+	preset->drumBaseIncrement = metaController.drumBaseIncrement;
+
+	preset->morphScale = metaWavetable.morphScale;
+	preset->incrementMod = metaWavetable.incrementMod;
+	preset->oversamplingFactor = metaWavetable.oversamplingFactor;
+
+	preset->ampAttack = ampEnvelope.attack;
+	preset->morphAttackMultiplier = morphAttackMultiplier;
+	preset->morphReleaseMultiplier = morphReleaseMultiplier;
+	preset->morphReleaseClamp = morphReleaseClamp;
+	preset->freqAttackMultiplier = freqAttackMultiplier;
+	preset->freqReleaseMultiplier = freqReleaseMultiplier;
+	preset->transientScale = transientScale;
+	preset->minTransientLength = minTransientLength;
+
+}
+
+void ViaMeta::applyPreset(const MetaPreset * preset) {
+
+	metaUI.modeStateBuffer = preset->modes;
+	metaUI.decodeModeState();
+
+	applySettings(preset);
+
+}
+
+void ViaMeta::applySettings(const MetaPreset * preset) {
+
+	dac3Mode = preset->dac3Mode;
+	setOutputStage(preset->outputStage);
+	logicAMode = preset->logicAMode;
+	shMode = preset->shMode;
+
+	metaController.parseControls = preset->parseControls;
+	metaController.generateIncrements = preset->generateIncrements;
+	metaController.advancePhase = preset->advancePhase;
+	metaController.fm = preset->fm;
+	metaController.expoFM = preset->expoFM;
+	metaController.loopMode = preset->loopMode;
+	metaController.loopHandler = preset->loopHandler;
+	metaController.incrementArbiter = preset->incrementArbiter;
+	metaController.gateOn = preset->gateOn;
+	metaController.drumBaseIncrement = preset->drumBaseIncrement;
+
+	metaWavetable.morphScale = preset->morphScale;
+	metaWavetable.incrementMod = preset->incrementMod;
+	metaWavetable.oversamplingFactor = preset->oversamplingFactor;
+
+	ampEnvelope.attack = preset->ampAttack;
+	morphAttackMultiplier = preset->morphAttackMultiplier;
+	morphReleaseMultiplier = preset->morphReleaseMultiplier;
+	morphReleaseClamp = preset->morphReleaseClamp;
+	freqAttackMultiplier = preset->freqAttackMultiplier;
+	freqReleaseMultiplier = preset->freqReleaseMultiplier;
+	transientScale = preset->transientScale;
+	minTransientLength = preset->minTransientLength;
+
+}
+
+// what recallModuleState would leave behind for modes in preset sequence mode, from the settings the handlers apply
+// fields the handlers don't set for those modes carry over from previous, as they would stepping through the presets
+void ViaMeta::decodePreset(uint32_t modes, const MetaPreset * previous, MetaPreset * preset) {
+
+	*preset = *previous;
+
+	int32_t sh = ((modes & BUTTON1_MASK) >> BUTTON1_SHIFT) % numButton1Modes;
+	int32_t table = ((modes & BUTTON2_MASK) >> BUTTON2_SHIFT) % numButton2Modes;
+	int32_t freq = ((modes & BUTTON3_MASK) >> BUTTON3_SHIFT) % numButton3Modes;
+	int32_t trig = ((modes & BUTTON4_MASK) >> BUTTON4_SHIFT) % numButton4Modes;
+	int32_t button5 = ((modes & BUTTON5_MASK) >> BUTTON5_SHIFT) % numButton5Modes;
+	int32_t loop = ((modes & BUTTON6_MASK) >> BUTTON6_SHIFT) % numButton6Modes;
+	int32_t drumAux = ((modes & AUX_MODE1_MASK) >> AUX_MODE1_SHIFT) % numAux1Modes;
+	int32_t logicA = ((modes & AUX_MODE2_MASK) >> AUX_MODE2_SHIFT) % numAux2Modes;
+	int32_t drumMode = ((modes & AUX_MODE3_MASK) >> AUX_MODE3_SHIFT) % numAux3Modes;
+	int32_t dac3 = ((modes & AUX_MODE4_MASK) >> AUX_MODE4_SHIFT) % numAux4Modes;
+
+	preset->modes = ENCODE_PRESET(sh, table, freq, trig, button5, loop, drumAux, logicA, drumMode, dac3);
+	preset->table = wavetableArray[freq][table];
+	preset->shMode = sh;
+	preset->logicAMode = logicA;
+
+	// recallModuleState runs the button 3, 4 and 6 handlers. The first and last both initialize the engine for the
+	// frequency and loop modes, so all that is left of the trigger mode in between is the gate it sets
+	triggerModeSettings(trig, loop, preset);
+
+	switch (freq) {
+	case audio:
+		if (loop == noloop) {
+			drumSettings(drumAux, drumMode, preset);
+		} else {
+			oscillatorSettings(trig, dac3, 1, preset);
+		}
+		break;
+	case env:
+		if (loop == noloop) {
+			envelopeSettings(trig, dac3, preset);
+		} else {
+			simpleLFOSettings(trig, dac3, preset);
+		}
+		break;
+	case seq:
+		if (loop == noloop) {
+			sequenceSettings(trig, dac3, preset);
+		} else {
+			complexLFOSettings(trig, dac3, preset);
+		}
+		break;
+	}
+
+}
+
+void ViaMeta::fillPresetCache(void) {
+
+	capturePreset(&presetCache[0]);
+
+	// read the stored mode words through the ui buffer, which is all the handlers would have touched
+	int32_t modeStateBuffer = metaUI.modeStateBuffer;
+	for (int32_t i = 1; i < 7; i++) {
+		metaUI.loadStateFromMemory(i);
+		decodePreset(metaUI.modeStateBuffer, &presetCache[i - 1], &presetCache[i]);
+	}
+	metaUI.modeStateBuffer = modeStateBuffer;
+
+}
+
+void ViaMeta::recallPreset(int32_t position) {
 
-	metaWavetable.oversamplingFactor = 0;
-	metaWavetable.morphScale = drumFullScale;
+	const MetaPreset * preset = &presetCache[position];
 
-	outputStage = &ViaMeta::addThreeBits;
+	applyPreset(preset);
 
-	handleButton4ModeChange(metaUI.TRIG_MODE);
-	handleAux4ModeChange(metaUI.DAC_3_MODE);
+	restartTrigger();
+	setSH(0, 0);
+
+	if (preset->table != currentWavetable) {
+		switchWavetable(preset->table);
+	}
 
 }
 
+void ViaMeta::refreshPresetCacheTables(void) {
 
+	for (int32_t i = 0; i < 7; i++) {
+		uint32_t modes = presetCache[i].modes;
+		presetCache[i].table = wavetableArray[(modes & BUTTON3_MASK) >> BUTTON3_SHIFT]
+			[(modes & BUTTON2_MASK) >> BUTTON2_SHIFT];
+	}
 
+}
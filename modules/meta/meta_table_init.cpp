@@ -30,128 +30,245 @@ void ViaMeta::fillWavetableArray(void) {
 }
 
 constexpr Wavetable MetaWavetableSet::vox;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, vox, vox_attack, vox_release, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::rubberband;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, rubberband, rubberband_attacks, rubberband_attacks, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::skipSaw;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, skipSaw, skipsaw, skipsaw, 5, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::new_perlin;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, new_perlin, new_perlin_slope, new_perlin_slope_2, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::impevens;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, impevens, impshort, impshort, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::quintic_outinAsym;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, quintic_outinAsym, quintic_outin2quintic_inout257_slopes, quintic_inout2quintic_outin257_slopes, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::drum;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, drum, allLinear, allExpo, 1, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::sharpLinSym;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, sharpLinSym, sharpLinSymAttackFamily, sharpLinSymAttackFamily, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::fake_adsr;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, fake_adsr, allLinear129_9, fake_adsr_slopes, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::new_waves;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, new_waves, new_waves_attack, new_waves_release, 5, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::newest_bounce;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, newest_bounce, newest_bounce_attack, newest_bounce_release, 5, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::gammaAsym;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, gammaAsym, gammaAsymAttackFamily, gammaAsymReleaseFamily, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::compressor;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, compressor, compressor_attack, compressor_release, 5, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::moving_lump;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, moving_lump, allLinear129_5, moving_lump_slopes, 5, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::newest_steps;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, newest_steps, newest_steps_attack, newest_steps_release, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::mountains;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, mountains, mountains_attack, mountains_release, 4, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::block_test;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, block_test, block_test_attack, block_test_release, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::half_sines;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, half_sines, half_sines_attack, half_sines_release, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::circular_257;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, circular_257, circular_257_slopes, circular_257_slopes, 4, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::csound_formants;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, csound_formants, csound_formants_attack, csound_formants_release, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::linwavefold_257;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, linwavefold_257, linwavefold_257_Family, linwavefold_257_Family, 5, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::additive_pairs;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, additive_pairs, additive_pairs_slopes, additive_pairs_slopes, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::trains;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, trains, trains_attack, trains_release, 9, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::fixed_lump;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, fixed_lump, allLinear129_5, fixed_lump_slopes, 5, WAVETABLE_15_BIT)
 constexpr Wavetable MetaWavetableSet::euc_odd_sharp;
+WAVETABLE_IMAGE_DEF(MetaWavetableSet, euc_odd_sharp, euc_odd_sharp_attacks, euc_odd_sharp_releases, 5, WAVETABLE_15_BIT)
 
-constexpr uint16_t MetaWavetableSet::gammaAsymAttackFamily[9][257];
+META_WAVETABLE_FAMILIES(WAVETABLE_FAMILY_DEF)
 
-constexpr uint16_t MetaWavetableSet::gammaAsymReleaseFamily[9][257];
 
-constexpr uint16_t MetaWavetableSet::sharpLinSymAttackFamily[9][257];
-
-constexpr uint16_t MetaWavetableSet::sharpLinSymReleaseFamily[9][257];
-
-constexpr uint16_t MetaWavetableSet::impshort[9][257];
-
-constexpr uint16_t MetaWavetableSet::skipsaw[5][257];
-
-constexpr uint16_t MetaWavetableSet::linwavefold_257_Family[5][257];
-
-constexpr uint16_t MetaWavetableSet::circular_257_slopes[4][257];
-
-constexpr uint16_t MetaWavetableSet::quintic_outin2quintic_inout257_slopes[9][257];
-
-constexpr uint16_t MetaWavetableSet::quintic_inout2quintic_outin257_slopes[9][257];
-
-constexpr uint16_t MetaWavetableSet::trains_attack[9][257];
-
-constexpr uint16_t MetaWavetableSet::trains_release[9][257];
-
-constexpr uint16_t MetaWavetableSet::vox_attack[9][257];
-
-constexpr uint16_t MetaWavetableSet::vox_release[9][257];
-
-constexpr uint16_t MetaWavetableSet::csound_formants_attack[9][257];
-
-constexpr uint16_t MetaWavetableSet::csound_formants_release[9][257];
-
-constexpr uint16_t MetaWavetableSet::new_perlin_slope[9][257];
-
-constexpr uint16_t MetaWavetableSet::new_perlin_slope_2[9][257];
-
-constexpr uint16_t MetaWavetableSet::additive_pairs_slopes[9][257];
-
-constexpr uint16_t MetaWavetableSet::block_test_attack[9][257];
-
-constexpr uint16_t MetaWavetableSet::block_test_release[9][257];
-
-constexpr uint16_t MetaWavetableSet::newest_steps_attack[9][257];
-
-constexpr uint16_t MetaWavetableSet::newest_steps_release[9][257];
-
-constexpr uint16_t MetaWavetableSet::allLinear[1][257];
-
-constexpr uint16_t MetaWavetableSet::allExpo[1][257];
-
-constexpr uint16_t MetaWavetableSet::compressor_attack[5][257];
-
-constexpr uint16_t MetaWavetableSet::compressor_release[5][257];
-
-constexpr uint16_t MetaWavetableSet::allLinear129_5[5][257];
-
-constexpr uint16_t MetaWavetableSet::fixed_lump_slopes[5][257];
-
-constexpr uint16_t MetaWavetableSet::moving_lump_slopes[5][257];
-
-constexpr uint16_t MetaWavetableSet::allLinear129_9[9][257];
-
-constexpr uint16_t MetaWavetableSet::fake_adsr_slopes[9][257];
-
-constexpr uint16_t MetaWavetableSet::half_sines_attack[9][257];
-
-constexpr uint16_t MetaWavetableSet::half_sines_release[9][257];
-
-constexpr uint16_t MetaWavetableSet::mountains_attack[4][257];
+// declare functions to set the currently active tables
+void ViaMeta::switchWavetable(const Wavetable * table) {
+	currentWavetable = table;
+#if defined(WAVETABLE_PREDECODED)
+	flipWavetable(table->image, table->numWaveforms - 1);
+#elif defined(WAVETABLE_INCREMENTAL_LOAD)
+	// decoded a slope at a time in slowConversionCallback, which flips to it when complete
+	if (wavetableLoader.load(table)) {
+		wavetableRead = wavetableLoader.front;
+		metaWavetable.tableSize = table->numWaveforms - 1;
+#ifdef WAVETABLE_MIPMAP
+		wavetableMipmap.load(wavetableRead, table->numWaveforms, WAVETABLE_15_BIT);
+#endif
+	}
+#else
+	wavetableSet.loadWavetableWithDiff15Bit(table, wavetableBuffer[0]);
+	metaWavetable.tableSize = table->numWaveforms - 1;
+#ifdef WAVETABLE_MIPMAP
+	wavetableMipmap.load(wavetableRead, table->numWaveforms, WAVETABLE_15_BIT);
+#endif
+#endif
+}
 
-constexpr uint16_t MetaWavetableSet::mountains_release[4][257];
+#ifdef BUILD_VIRTUAL
 
-constexpr uint16_t MetaWavetableSet::rubberband_attacks[9][257];
+// slot a user table in with the built in ones
+int32_t ViaMeta::importWavetable(const char * path, const char * cachePath, int32_t index, int32_t bank, int32_t slot) {
+	if (index < 0 || index >= WAVETABLE_USER_TABLES || bank < 0 || bank >= 3 || slot < 0 || slot >= 8) {
+		return 0;
+	}
+	// the import overwrites the table this index held before its last import, which a fade or load could still be reading
+#if META_TABLE_CROSSFADE_BLOCKS
+	if (tableCrossfade) {
+		return 0;
+	}
+#endif
+#ifdef WAVETABLE_INCREMENTAL_LOAD
+	if (wavetableLoader.loading()) {
+		return 0;
+	}
+#endif
+	const Wavetable * replaced = userWavetables[index].table();
+	if (!userWavetables[index].import(path, cachePath, 9, WAVETABLE_15_BIT)) {
+		return 0;
+	}
+	// move every slot off the replaced table so nothing points at it when it is reused
+	for (int32_t i = 0; i < 3; i++) {
+		for (int32_t j = 0; j < 8; j++) {
+			wavetableArray[i][j] = (replaced && wavetableArray[i][j] == replaced) ?
+					userWavetables[index].table() : wavetableArray[i][j];
+		}
+	}
+	wavetableArray[bank][slot] = userWavetables[index].table();
+	if ((replaced && currentWavetable == replaced) ||
+			(bank == (int32_t) metaUI.FREQ_MODE && slot == (int32_t) metaUI.TABLE)) {
+		switchWavetable(userWavetables[index].table());
+	}
+	if (presetSequenceMode) {
+		refreshPresetCacheTables();
+	}
+	return 1;
+}
 
-constexpr uint16_t MetaWavetableSet::newest_bounce_attack[5][257];
+#endif
+
+#if defined(WAVETABLE_PREDECODED) || defined(WAVETABLE_INCREMENTAL_LOAD)
+
+// point the audio path at a complete table, keeping the outgoing one to crossfade from
+void ViaMeta::flipWavetable(const uint32_t * table, uint32_t tableSize) {
+#if META_TABLE_CROSSFADE_BLOCKS
+	if (!tableCrossfade) {
+		lastWavetableRead[0] = wavetableRead;
+		lastTableSize[0] = metaWavetable.tableSize;
+		lastTableGain = 0;
+#ifdef BUILD_VIRTUAL
+		metaWavetable.forkDecimators(1);
+#endif
+	} else if (!lastTableGain) {
+		// keep fading out what is playing now, the incoming table held at the gain it had reached
+		lastWavetableRead[1] = wavetableRead;
+		lastTableSize[1] = metaWavetable.tableSize;
+		lastTableGain = tableGain;
+#ifdef BUILD_VIRTUAL
+		metaWavetable.forkDecimators(2);
+#endif
+	} else {
+		// that blend would need a fourth table, so start from this one once the fade is done
+		pendingWavetableRead = table;
+		pendingTableSize = tableSize;
+		return;
+	}
+	tableCrossfade = META_TABLE_CROSSFADE_BLOCKS;
+	tableGain = 0;
+#endif
+	wavetableRead = table;
+	metaWavetable.tableSize = tableSize;
+#ifdef WAVETABLE_MIPMAP
+	wavetableMipmap.load(table, tableSize + 1, WAVETABLE_15_BIT);
+#endif
+}
 
-constexpr uint16_t MetaWavetableSet::newest_bounce_release[5][257];
+#if META_TABLE_CROSSFADE_BLOCKS
+
+// render an outgoing table into out, leaving the morph ramp where it was
+void ViaMeta::advanceLastWavetable(int32_t index, int32_t * out) {
+	uint32_t tableSize = metaWavetable.tableSize;
+	int32_t lastMorph = metaWavetable.lastMorph;
+	metaWavetable.tableSize = lastTableSize[index];
+#ifdef BUILD_VIRTUAL
+	metaWavetable.decimatorBank = index + 1;
+	metaWavetable.advance(lastWavetableRead[index]);
+	metaWavetable.decimatorBank = 0;
+#else
+	metaWavetable.advance(lastWavetableRead[index]);
+#endif
+	for (int32_t i = 0; i < metaWavetable.bufferSize; i++) {
+		out[i] = metaWavetable.signalOut[i];
+	}
+	metaWavetable.tableSize = tableSize;
+	metaWavetable.lastMorph = lastMorph;
+}
 
-constexpr uint16_t MetaWavetableSet::euc_odd_sharp_attacks[5][257];
+#endif
+
+void ViaMeta::advanceWavetable(void) {
+
+#if META_TABLE_CROSSFADE_BLOCKS
+	if (tableCrossfade) {
+
+		// render the outgoing tables first so delta follows the incoming one
+		// all ramp the morph from the same place
+		int32_t lastSignal[32];
+		advanceLastWavetable(0, lastSignal);
+		if (lastTableGain) {
+			int32_t blendSignal[32];
+			advanceLastWavetable(1, blendSignal);
+			for (int32_t i = 0; i < metaWavetable.bufferSize; i++) {
+				lastSignal[i] += fix16_mul(blendSignal[i] - lastSignal[i], lastTableGain);
+			}
+		}
+		metaWavetable.advance(wavetableRead);
+
+		// linear ramp to the incoming table in 16 bit fixed point across the whole crossfade
+		int32_t gainStep = (65536 / META_TABLE_CROSSFADE_BLOCKS) / metaWavetable.bufferSize;
+		int32_t gain = (META_TABLE_CROSSFADE_BLOCKS - tableCrossfade) * (65536 / META_TABLE_CROSSFADE_BLOCKS);
+		for (int32_t i = 0; i < metaWavetable.bufferSize; i++) {
+			gain += gainStep;
+			metaWavetable.signalOut[i] = lastSignal[i] + fix16_mul(metaWavetable.signalOut[i] - lastSignal[i], gain);
+		}
+		tableGain = gain;
+		tableCrossfade--;
+
+		if (!tableCrossfade && pendingWavetableRead) {
+			const uint32_t * table = pendingWavetableRead;
+			pendingWavetableRead = 0;
+			flipWavetable(table, pendingTableSize);
+		}
+		return;
 
-constexpr uint16_t MetaWavetableSet::euc_odd_sharp_releases[5][257];
+	}
+#endif
 
-constexpr uint16_t MetaWavetableSet::new_waves_attack[5][257];
+	metaWavetable.advance(wavetableRead);
 
-constexpr uint16_t MetaWavetableSet::new_waves_release[5][257];
+}
 
+#else
 
-// declare functions to set the currently active tables
-void ViaMeta::switchWavetable(const Wavetable * table) {
-	wavetableSet.loadWavetableWithDiff15Bit(table, (uint32_t *) wavetableRead);
-	metaWavetable.tableSize = table->numWaveforms - 1;
+// the outgoing table is overwritten by the decode, so there is nothing to crossfade from
+void ViaMeta::advanceWavetable(void) {
+	metaWavetable.advance(wavetableRead);
 }
 
+#endif
+
 // declare functions to set the currently active tables
 void ViaMeta::initDrum(void) {
+#ifdef WAVETABLE_PREDECODED
+	wavetableReadDrum = wavetableSet.drum.image;
+#else
 	wavetableSet.loadSingleTable15Bit(&wavetableSet.drum, (uint32_t *) wavetableReadDrum);
+#endif
 	for (int32_t i = 0; i < 4; i++) {
 		drumFullScale[i] = 32767;
 	}
+	for (int32_t i = 0; i < META_BUFFER_SIZE; i++) {
+		incrementOff[i] = 0;
+	}
 }
\ No newline at end of file
@@ -408,19 +408,34 @@ void ViaMeta::ViaMetaUI::writeStockPresets(void) {
 	storeToEEPROM(5, stockPreset5);
 	storeToEEPROM(6, stockPreset6);
 
+	if (this_module.presetSequenceMode) {
+		this_module.fillPresetCache();
+	}
+
 	transition(&ViaMeta::ViaMetaUI::overwritePresets);
 
 }
 
+void ViaMeta::ViaMetaUI::presetStoredCallback(int32_t position) {
+
+	if (this_module.presetSequenceMode) {
+		this_module.fillPresetCache();
+	}
+
+}
+
 void ViaMeta::ViaMetaUI::specialMenuCallback(void) {
 
 	if (this_module.presetSequenceMode) {
 		this_module.presetSequenceMode = 0;
 		recallModuleState();
+		// sequencing doesn't write the runtime state on each step, save where it stopped
+		storeStateToEEPROM(0);
 		this_module.clearRGB();
 		this_module.clearLEDs();
 		this_module.presetOverride = 0;
 	} else {
+		this_module.fillPresetCache();
 		this_module.presetSequenceMode = 1;
 		this_module.clearRGB();
 		this_module.clearLEDs();
@@ -13,12 +13,14 @@ void MetaWavetable::parseControls(ViaControls * controls) {
 
 };
 
-void MetaWavetable::advanceSingleSample(uint32_t * wavetable) {
+void MetaWavetable::advanceSingleSample(const uint32_t * wavetable) {
 
 	int32_t morphScaleLocal = (int32_t) morphScale[0];
 	morphScaleLocal = fix16_mul(morphBase, morphScaleLocal << 1);
 	int32_t morphModLocal = (int32_t) -morphMod[0];
-	morphModLocal = __USAT(morphScaleLocal + morphModLocal + morphModOffset, 16) * tableSize;
+	morphModLocal = __USAT(morphScaleLocal + morphModLocal + morphModOffset, 16);
+	lastMorph = morphModLocal;
+	morphModLocal *= tableSize;
 
 	uint32_t ghostPhase = phase << 7;
 	// scale increment to size of new phase space (<< 7) and down by oversampling factor
@@ -48,19 +50,20 @@ void MetaWavetable::advanceSingleSample(uint32_t * wavetable) {
 
 
 
-void MetaWavetable::advanceOversampled(uint32_t * wavetable) {
+void MetaWavetable::advanceOversampled(const uint32_t * wavetable) {
 
-	// combine knob and CV then to table size in 16.16 fixed point
+	// combine knob and CV then ramp to it across the block in 16.16 fixed point table coordinates
 	int32_t morphModLocal = -morphMod[0];
-	uint32_t scaledMorph = __USAT((morphBase + morphModLocal + morphModOffset), 16) * tableSize;
-	uint32_t morphIndex = scaledMorph >> 16;
-	uint32_t morphFrac = scaledMorph & 0xFFFF;
-	// assuming that each phase distortion lookup table is 517 samples long stored as int
-	uint32_t * wavetable1 = wavetable + (morphIndex * 517) + 2;
+	int32_t morph = __USAT((morphBase + morphModLocal + morphModOffset), 16);
+	MorphRamp ramp;
+	ramp.start(wavetable, tableSize, lastMorph, morph, bufferSize);
+	lastMorph = morph;
 
 	uint32_t ghostPhase = phase << 7;
 	// scale increment to size of new phase space (<< 7) and down by oversampling factor
 	int32_t localIncrement = increment << (7 - oversamplingFactor);
+	// per sample fm follows the direction the controller is running in, and stops with it
+	int32_t fmDirection = (increment > 0) - (increment < 0);
 	uint32_t leftSample;
 
 	uint32_t writeIndex = 0;
@@ -69,30 +72,99 @@ void MetaWavetable::advanceOversampled(uint32_t * wavetable) {
 
 	while (samplesRemaining) {
 		// phase pointer wraps at 32 bits
-		ghostPhase = (ghostPhase + localIncrement);
+		ghostPhase = (ghostPhase + localIncrement +
+				((fmDirection * incrementMod[writeIndex]) << (7 - oversamplingFactor)));
 		// write phase out
 		phaseOut[writeIndex] = ghostPhase;
 		// get the actual wavetable output sample as above
 		// but with the appropriate scaling as phase is now 25 bits and table length is 9 bits
 		leftSample = ghostPhase >> 23;
 #define phaseFrac ((ghostPhase >> 7) & 0xFFFF)
+		ramp.advance();
 		signalOut[writeIndex] = fast_15_16_bilerp_prediff(
-				wavetable1[leftSample], wavetable1[leftSample + 1], morphFrac,
+				ramp.slope[leftSample], ramp.slope[leftSample + 1], ramp.frac,
 				phaseFrac);
 		writeIndex++;
 		samplesRemaining--;
 	}
 
-	ghostPhase = (ghostPhase + localIncrement);
+	ghostPhase = (ghostPhase + localIncrement +
+			((fmDirection * incrementMod[writeIndex]) << (7 - oversamplingFactor)));
 	// write phase out
 	phaseOut[writeIndex] = ghostPhase;
 	// get the actual wavetable output sample as above
 	// but with the appropriate scaling as phase is now 25 bits and table length is 9 bits
 	leftSample = ghostPhase >> 23;
+	ramp.advance();
 	signalOut[writeIndex] = fast_15_16_bilerp_prediff_deltaValue(
-			wavetable1[leftSample], wavetable1[leftSample + 1], morphFrac,
+			ramp.slope[leftSample], ramp.slope[leftSample + 1], ramp.frac,
 			phaseFrac, &delta);
 
 }
 
 
+#ifdef BUILD_VIRTUAL
+
+void MetaWavetable::advanceDecimated(const uint32_t * wavetable) {
+
+	// as advanceOversampled with 1 << decimationStages sub-samples per dac sample
+	int32_t stages = decimationStages;
+	int32_t subSamples = bufferSize << stages;
+
+	int32_t morphModLocal = -morphMod[0];
+	int32_t morph = __USAT((morphBase + morphModLocal + morphModOffset), 16);
+	MorphRamp ramp;
+	ramp.start(wavetable, tableSize, lastMorph, morph, subSamples);
+	lastMorph = morph;
+
+	int32_t incrementShift = 7 - oversamplingFactor - stages;
+	uint32_t ghostPhase = phase << 7;
+	int32_t localIncrement = increment << incrementShift;
+	int32_t fmDirection = (increment > 0) - (increment < 0);
+	uint32_t leftSample;
+	// read ahead by the filter delay, 9 input samples a stage, so the output lines up with phaseOut
+	// and doesn't jump when the plain path takes over from this one or hands back to it
+	uint32_t lead = (uint32_t) localIncrement * (9 * ((1 << stages) - 1));
+	uint32_t readPhase;
+
+	int32_t i = 0;
+
+	while (i < subSamples - 1) {
+		ghostPhase = (ghostPhase + localIncrement +
+				((fmDirection * incrementMod[i >> stages]) << incrementShift));
+		// the last sub-sample of each dac sample leaves its phase
+		phaseOut[i >> stages] = ghostPhase;
+		readPhase = ghostPhase + lead;
+		leftSample = readPhase >> 23;
+		ramp.advance();
+		oversampledOut[i] = fast_15_16_bilerp_prediff(
+				ramp.slope[leftSample], ramp.slope[leftSample + 1], ramp.frac,
+				(readPhase >> 7) & 0xFFFF);
+		i++;
+	}
+
+	ghostPhase = (ghostPhase + localIncrement +
+			((fmDirection * incrementMod[i >> stages]) << incrementShift));
+	phaseOut[i >> stages] = ghostPhase;
+	readPhase = ghostPhase + lead;
+	leftSample = readPhase >> 23;
+	ramp.advance();
+	oversampledOut[i] = fast_15_16_bilerp_prediff_deltaValue(
+			ramp.slope[leftSample], ramp.slope[leftSample + 1], ramp.frac,
+			(readPhase >> 7) & 0xFFFF, &delta);
+
+	HalfBandDecimator<META_BUFFER_SIZE << META_MAX_DECIMATION_STAGES> * decimator = decimators[decimatorBank];
+	int32_t length = subSamples;
+	for (int32_t stage = 0; stage < stages; stage++) {
+		decimator[stage].process(oversampledOut, oversampledOut, length);
+		length >>= 1;
+	}
+
+	// the filter overshoots on steep edges
+	for (int32_t i = 0; i < bufferSize; i++) {
+		signalOut[i] = __USAT(oversampledOut[i], 15);
+	}
+
+}
+
+#endif
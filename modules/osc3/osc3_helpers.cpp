@@ -7,6 +7,10 @@
 
 #include <osc3.hpp>
 
+constexpr LookupTable<int8_t, 128> ViaOsc3::chromatic;
+constexpr LookupTable<int8_t, 128> ViaOsc3::major;
+constexpr LookupTable<int8_t, 128> ViaOsc3::minor;
+
 void ViaOsc3::renderSaw(int32_t writePosition) {
 
 	updateFrequencies();
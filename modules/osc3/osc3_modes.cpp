@@ -45,19 +45,19 @@ void ViaOsc3::handleButton5ModeChange(int32_t mode) {
 	scaleMode = mode;
 
 	if (mode == 0) {
-		scale = chromatic;
+		scale = chromatic.data;
 		intervals = minorIntervals;
 		updateBaseFreqs = &ViaOsc3::updateBaseFreqsSmooth;
 	} else if (mode == 1) {
-		scale = chromatic;
+		scale = chromatic.data;
 		intervals = majorIntervals;
 		updateBaseFreqs = &ViaOsc3::updateBaseFreqsSemi;
 	} else if (mode == 2) {
-		scale = major;
+		scale = major.data;
 		intervals = majorIntervals;
 		updateBaseFreqs = &ViaOsc3::updateBaseFreqsScale;
 	} else if (mode == 3) {
-		scale = minor;
+		scale = minor.data;
 		intervals = minorIntervals;
 		updateBaseFreqs = &ViaOsc3::updateBaseFreqsScale;
 	}
@@ -5,8 +5,18 @@ void ViaScanner::init(void) {
 
 	fillWavetableArray();
 
-	scanner.xTable = (uint32_t *) &wavetableXRead[0][0];
-	scanner.yTable = (uint32_t *) &wavetableYRead[0][0];
+#if defined(WAVETABLE_PREDECODED)
+	scanner.xTable = wavetableArray[0][0]->image;
+	scanner.yTable = wavetableArray[1][0]->image;
+#elif defined(WAVETABLE_INCREMENTAL_LOAD)
+	wavetableXLoader.init((uint32_t *) wavetableXBuffers[0], (uint32_t *) wavetableXBuffers[1], WAVETABLE_15_BIT_SLOPE);
+	wavetableYLoader.init((uint32_t *) wavetableYBuffers[0], (uint32_t *) wavetableYBuffers[1], WAVETABLE_15_BIT_SLOPE);
+	scanner.xTable = wavetableXLoader.front;
+	scanner.yTable = wavetableYLoader.front;
+#else
+	scanner.xTable = &wavetableXRead[0][0];
+	scanner.yTable = &wavetableYRead[0][0];
+#endif
 
 	initializeAuxOutputs();
 
@@ -145,6 +145,16 @@ void ViaScanner::transferCompleteCallback(void) {
 void ViaScanner::slowConversionCallback(void) {
 
 	controls.updateSlowExtra();
+#ifdef WAVETABLE_INCREMENTAL_LOAD
+	if (wavetableXLoader.step()) {
+		scanner.xTable = wavetableXLoader.front;
+		scanner.xTableSize = wavetableXLoader.active->numWaveforms - 1;
+	}
+	if (wavetableYLoader.step()) {
+		scanner.yTable = wavetableYLoader.front;
+		scanner.yTableSize = wavetableYLoader.active->numWaveforms - 1;
+	}
+#endif
 	scanner.parseControls(&controls);
 
 	uint32_t redLevel = abs(scanner.xInput) >> 4;
@@ -16,6 +16,7 @@ void ViaScanner::handleButton4ModeChange(int32_t mode) {
 	} else {
 		scanner.xInterpolateOff = 0;
 	}
+	scanner.selectKernels();
 
 }
 
@@ -28,6 +29,7 @@ void ViaScanner::handleButton2ModeChange(int32_t mode) {
 	} else {
 		scanner.yInterpolateOff = 0;
 	}
+	scanner.selectKernels();
 
 }
 
@@ -40,6 +42,7 @@ void ViaScanner::handleButton6ModeChange(int32_t mode) {
 	} else {
 		scanner.xInterpolateOff = 0;
 	}
+	scanner.selectKernels();
 }
 
 void ViaScanner::handleButton1ModeChange(int32_t mode) {
@@ -57,26 +60,14 @@ void ViaScanner::handleButton5ModeChange(int32_t mode) {
 	} else {
 		scanner.yInterpolateOff = 0;
 	}
+	scanner.selectKernels();
 
 }
 
 void ViaScanner::handleButton3ModeChange(int32_t mode) {
 
-	switch (mode) {
-	case sum:
-		scanner.fillBuffer = &ThreeAxisScanner::fillBufferSum;
-		break;
-	case multiply:
-		scanner.fillBuffer = &ThreeAxisScanner::fillBufferMultiply;
-		break;
-	case difference:
-		scanner.fillBuffer = &ThreeAxisScanner::fillBufferDifference;
-		break;
-	case lighten:
-		scanner.fillBuffer = &ThreeAxisScanner::fillBufferLighten;
-		break;
-
-	}
+	scanner.terrainType = mode;
+	scanner.selectKernels();
 
 }
 
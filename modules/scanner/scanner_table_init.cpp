@@ -22,89 +22,105 @@ void ViaScanner::fillWavetableArray(void) {
 }
 
 constexpr Wavetable ScannerWavetableSet::skipSaw;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, skipSaw, skipsaw, skipsaw, 5, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::moog5Square;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, moog5Square, moog5SquareShiftAttackFamily, moog5SquareShiftReleaseFamily, 5, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::hyperbolic_shapers;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, hyperbolic_shapers, hyperbolic_shapers_attack, hyperbolic_shapers_release, 5, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::newest_bounce;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, newest_bounce, newest_bounce_attack, newest_bounce_release, 5, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::test_fm;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, test_fm, test_fm_attack, test_fm_release, 5, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::staircase;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, staircase, staircase_attack, staircase_release, 5, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::mountains;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, mountains, mountains_attack, mountains_release, 4, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::block_slope;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, block_slope, block_slope_attack, block_slope_release, 5, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::block_test;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, block_test, block_test_attack, block_test_release, 5, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::bessel;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, bessel, bessel_attack, bessel_release, 5, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::rubberband;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, rubberband, rubberband_attacks, rubberband_attacks, 5, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::bitcrush;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, bitcrush, bitcrush_attack, bitcrush_release, 5, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::circular_257;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, circular_257, circular_257_slopes, circular_257_slopes, 4, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::exciteBike;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, exciteBike, exciteBikeAttackFamily, exciteBikeAttackFamily, 5, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::new_waves;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, new_waves, new_waves_attack, new_waves_release, 5, WAVETABLE_15_BIT_SLOPE)
 constexpr Wavetable ScannerWavetableSet::half_sines;
+WAVETABLE_IMAGE_DEF(ScannerWavetableSet, half_sines, half_sines_attack, half_sines_release, 5, WAVETABLE_15_BIT_SLOPE)
 
-constexpr uint16_t ScannerWavetableSet::moog5SquareShiftAttackFamily[5][257];
-
-constexpr uint16_t ScannerWavetableSet::moog5SquareShiftReleaseFamily[5][257];
-
-constexpr uint16_t ScannerWavetableSet::exciteBikeAttackFamily[5][257];
-
-constexpr uint16_t ScannerWavetableSet::exciteBikeReleaseFamily[5][257];
-
-constexpr uint16_t ScannerWavetableSet::skipsaw[5][257];
-
-constexpr uint16_t ScannerWavetableSet::circular_257_slopes[4][257];
-
-constexpr uint16_t ScannerWavetableSet::test_fm_attack[5][257];
-
-constexpr uint16_t ScannerWavetableSet::test_fm_release[5][257];
-
-constexpr uint16_t ScannerWavetableSet::hyperbolic_shapers_attack[5][257];
-
-constexpr uint16_t ScannerWavetableSet::hyperbolic_shapers_release[5][257];
-
-constexpr uint16_t ScannerWavetableSet::bitcrush_attack[5][257];
-
-constexpr uint16_t ScannerWavetableSet::bitcrush_release[5][257];
-
-constexpr uint16_t ScannerWavetableSet::bessel_attack[5][257];
-
-constexpr uint16_t ScannerWavetableSet::bessel_release[5][257];
-
-constexpr uint16_t ScannerWavetableSet::block_test_attack[5][257];
-
-constexpr uint16_t ScannerWavetableSet::block_test_release[5][257];
-
-constexpr uint16_t ScannerWavetableSet::half_sines_attack[5][257];
-
-constexpr uint16_t ScannerWavetableSet::half_sines_release[5][257];
-
-constexpr uint16_t ScannerWavetableSet::mountains_attack[4][257];
-
-constexpr uint16_t ScannerWavetableSet::mountains_release[4][257];
-
-constexpr uint16_t ScannerWavetableSet::rubberband_attacks[5][257];
-
-constexpr uint16_t ScannerWavetableSet::newest_bounce_attack[5][257];
-
-constexpr uint16_t ScannerWavetableSet::newest_bounce_release[5][257];
-
-constexpr uint16_t ScannerWavetableSet::new_waves_attack[5][257];
-
-constexpr uint16_t ScannerWavetableSet::new_waves_release[5][257];
-
-constexpr uint16_t ScannerWavetableSet::block_slope_attack[5][257];
-
-constexpr uint16_t ScannerWavetableSet::block_slope_release[5][257];
-
-constexpr uint16_t ScannerWavetableSet::staircase_attack[5][257];
-
-constexpr uint16_t ScannerWavetableSet::staircase_release[5][257];
+SCANNER_WAVETABLE_FAMILIES(WAVETABLE_FAMILY_DEF)
 
 
 // declare functions to set the currently active tables
 void ViaScanner::switchWavetableX(const Wavetable * table) {
+#if defined(WAVETABLE_PREDECODED)
+	scanner.xTable = table->image;
+#elif defined(WAVETABLE_INCREMENTAL_LOAD)
+	// decoded a slope at a time in slowConversionCallback, which flips to it when complete
+	if (!wavetableXLoader.load(table)) {
+		return;
+	}
+	scanner.xTable = wavetableXLoader.front;
+#else
 	wavetableSet.loadWavetableWithDiff15BitSlope(table, (uint32_t *) wavetableXRead);
+#endif
 	scanner.xTableSize = table->numWaveforms - 1;
 }
 
 // declare functions to set the currently active tables
 void ViaScanner::switchWavetableY(const Wavetable * table) {
+#if defined(WAVETABLE_PREDECODED)
+	scanner.yTable = table->image;
+#elif defined(WAVETABLE_INCREMENTAL_LOAD)
+	// decoded a slope at a time in slowConversionCallback, which flips to it when complete
+	if (!wavetableYLoader.load(table)) {
+		return;
+	}
+	scanner.yTable = wavetableYLoader.front;
+#else
 	wavetableSet.loadWavetableWithDiff15BitSlope(table, (uint32_t *) wavetableYRead);
+#endif
 	scanner.yTableSize = table->numWaveforms - 1;
-}
\ No newline at end of file
+}
+
+#ifdef BUILD_VIRTUAL
+
+// slot a user table in with the built in ones, bank 0 holds the x tables and bank 1 the y tables
+int32_t ViaScanner::importWavetable(const char * path, const char * cachePath, int32_t index, int32_t bank, int32_t slot) {
+	if (index < 0 || index >= WAVETABLE_USER_TABLES || bank < 0 || bank >= 2 || slot < 0 || slot >= 8) {
+		return 0;
+	}
+	// the import overwrites the table this index held before its last import, which a load could still be reading
+#ifdef WAVETABLE_INCREMENTAL_LOAD
+	if (wavetableXLoader.loading() || wavetableYLoader.loading()) {
+		return 0;
+	}
+#endif
+	const Wavetable * replaced = userWavetables[index].table();
+	if (!userWavetables[index].import(path, cachePath, 5, WAVETABLE_15_BIT_SLOPE)) {
+		return 0;
+	}
+	// move every slot off the replaced table so nothing points at it when it is reused
+	for (int32_t i = 0; i < 2; i++) {
+		for (int32_t j = 0; j < 8; j++) {
+			wavetableArray[i][j] = (replaced && wavetableArray[i][j] == replaced) ?
+					userWavetables[index].table() : wavetableArray[i][j];
+		}
+	}
+	wavetableArray[bank][slot] = userWavetables[index].table();
+	if (wavetableArray[0][scannerUI.X_TABLE] == userWavetables[index].table()) {
+		switchWavetableX(userWavetables[index].table());
+	}
+	if (wavetableArray[1][scannerUI.Y_TABLE] == userWavetables[index].table()) {
+		switchWavetableY(userWavetables[index].table());
+	}
+	return 1;
+}
+
+#endif
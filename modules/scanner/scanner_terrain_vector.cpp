@@ -0,0 +1,141 @@
+/*
+ * scanner_terrain_vector.cpp
+ *
+ *  Virtual build only: vector kernels for the ThreeAxisScanner index fold and oversampled terrain scan.
+ */
+
+#include "scanner.hpp"
+
+#ifdef SCANNER_TERRAIN_VECTOR
+
+#include <immintrin.h>
+
+#define SCANNER_AVX2 __attribute__((target("avx2")))
+
+/// Terrain combines as in three_axis_scanner.cpp, eight samples at a time.
+
+struct TerrainSumAVX2 {
+	static inline SCANNER_AVX2 __m256i altitude(__m256i x, __m256i y) {
+		return _mm256_srai_epi32(_mm256_add_epi32(x, y), 4);
+	}
+	static inline SCANNER_AVX2 __m256i location(__m256i x, __m256i y) {
+		return _mm256_srai_epi32(_mm256_add_epi32(x, y), 14);
+	}
+};
+
+struct TerrainMultiplyAVX2 {
+	static inline SCANNER_AVX2 __m256i altitude(__m256i x, __m256i y) {
+		const __m256i center = _mm256_set1_epi32(16383);
+		__m256i product = _mm256_mullo_epi32(_mm256_sub_epi32(x, center), _mm256_sub_epi32(y, center));
+		return _mm256_add_epi32(_mm256_srai_epi32(product, 17), _mm256_set1_epi32(2048));
+	}
+	static inline SCANNER_AVX2 __m256i location(__m256i x, __m256i y) {
+		const __m256i center = _mm256_set1_epi32(2048);
+		__m256i product = _mm256_mullo_epi32(_mm256_sub_epi32(_mm256_srai_epi32(x, 13), center),
+				_mm256_sub_epi32(_mm256_srai_epi32(y, 13), center));
+		return _mm256_add_epi32(_mm256_srai_epi32(product, 12), center);
+	}
+};
+
+struct TerrainDifferenceAVX2 {
+	static inline SCANNER_AVX2 __m256i altitude(__m256i x, __m256i y) {
+		return _mm256_srai_epi32(_mm256_abs_epi32(_mm256_sub_epi32(x, y)), 3);
+	}
+	static inline SCANNER_AVX2 __m256i location(__m256i x, __m256i y) {
+		return _mm256_abs_epi32(_mm256_srai_epi32(_mm256_sub_epi32(x, y), 13));
+	}
+};
+
+struct TerrainLightenAVX2 {
+	static inline SCANNER_AVX2 __m256i altitude(__m256i x, __m256i y) {
+		return _mm256_srai_epi32(_mm256_max_epi32(x, y), 3);
+	}
+	static inline SCANNER_AVX2 __m256i location(__m256i x, __m256i y) {
+		return _mm256_srai_epi32(_mm256_max_epi32(x, y), 13);
+	}
+};
+
+/// foldSignal25Bit on each lane: reflect the low 25 bits when bit 25 is set.
+SCANNER_AVX2
+static void foldAVX2(uint32_t index, int32_t increment, int32_t offset, int32_t length, int32_t * out) {
+
+	const __m256i lanes = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8);
+	const __m256i low25 = _mm256_set1_epi32(0x1FFFFFF);
+	const __m256i offsetLanes = _mm256_set1_epi32(offset);
+	const __m256i indexStep = _mm256_set1_epi32((uint32_t) increment << 3);
+
+	__m256i localIndex = _mm256_add_epi32(_mm256_set1_epi32(index),
+			_mm256_mullo_epi32(_mm256_set1_epi32(increment), lanes));
+
+	for (int32_t i = 0; i < length; i += 8) {
+
+		__m256i position = _mm256_add_epi32(_mm256_slli_epi32(localIndex, 5), offsetLanes);
+		__m256i reflect = _mm256_srai_epi32(_mm256_slli_epi32(position, 6), 31);
+		_mm256_storeu_si256((__m256i *) (out + i), _mm256_and_si256(_mm256_xor_si256(position, reflect), low25));
+
+		localIndex = _mm256_add_epi32(localIndex, indexStep);
+
+	}
+
+}
+
+/// fast_15_16_bilerp_prediff at each lane's index, the morph fraction is shared by the block.
+SCANNER_AVX2
+static inline __m256i bilerpAVX2(const int32_t * table, __m256i index, __m256i morphFrac) {
+
+	const __m256i low16 = _mm256_set1_epi32(0xFFFF);
+
+	__m256i leftSample = _mm256_srai_epi32(index, 16);
+	__m256i in0 = _mm256_i32gather_epi32(table, leftSample, 4);
+	__m256i in1 = _mm256_i32gather_epi32(table + 1, leftSample, 4);
+
+	in0 = _mm256_add_epi32(_mm256_and_si256(in0, low16),
+			_mm256_srai_epi32(_mm256_mullo_epi32(_mm256_srai_epi32(in0, 16), morphFrac), 16));
+	in1 = _mm256_add_epi32(_mm256_and_si256(in1, low16),
+			_mm256_srai_epi32(_mm256_mullo_epi32(_mm256_srai_epi32(in1, 16), morphFrac), 16));
+
+	__m256i phaseFrac = _mm256_and_si256(index, low16);
+	return _mm256_add_epi32(in0, _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(in1, in0), phaseFrac), 16));
+
+}
+
+template<class Terrain>
+SCANNER_AVX2
+static void scanTerrainAVX2(const int32_t * xIndex, const int32_t * yIndex, const int32_t * xTableRead,
+		const int32_t * yTableRead, int32_t morphFrac, int32_t length, int32_t * altitude, int32_t * locationBlend) {
+
+	const __m256i morph = _mm256_set1_epi32(morphFrac);
+
+	for (int32_t i = 0; i < length; i += 8) {
+
+		__m256i x = _mm256_loadu_si256((const __m256i *) (xIndex + i));
+		__m256i y = _mm256_loadu_si256((const __m256i *) (yIndex + i));
+
+		__m256i xSample = bilerpAVX2(xTableRead, x, morph);
+		__m256i ySample = bilerpAVX2(yTableRead, y, morph);
+
+		_mm256_storeu_si256((__m256i *) (altitude + i), Terrain::altitude(xSample, ySample));
+		_mm256_storeu_si256((__m256i *) (locationBlend + i), Terrain::location(x, y));
+
+	}
+
+}
+
+static const ThreeAxisScanner::TerrainVectorKernel terrainKernelsAVX2[4] = {scanTerrainAVX2<TerrainSumAVX2>,
+		scanTerrainAVX2<TerrainMultiplyAVX2>, scanTerrainAVX2<TerrainDifferenceAVX2>, scanTerrainAVX2<TerrainLightenAVX2>};
+
+static int32_t hostHasAVX2(void) {
+
+	// may run before main, so initialize the feature flags explicitly
+	__builtin_cpu_init();
+
+	return __builtin_cpu_supports("avx2");
+
+}
+
+static const int32_t useAVX2 = hostHasAVX2();
+
+ThreeAxisScanner::FoldKernel ThreeAxisScanner::foldKernel = useAVX2 ? foldAVX2 : 0;
+const ThreeAxisScanner::TerrainVectorKernel * ThreeAxisScanner::terrainVectorKernels = useAVX2 ? terrainKernelsAVX2 : 0;
+
+#endif
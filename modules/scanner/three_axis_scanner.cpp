@@ -46,6 +46,16 @@ void ThreeAxisScanner::scanSetup() {
 	uint32_t samplesRemaining = bufferSize;
 	uint32_t writeIndex = 0;
 
+#ifdef SCANNER_TERRAIN_VECTOR
+	if (foldKernel && !(bufferSize & 7)) {
+		foldKernel(xIndex, xIncrement, thisXOffset, bufferSize, xIndexBuffer);
+		foldKernel(yIndex, yIncrement, thisYOffset, bufferSize, yIndexBuffer);
+		xIndex += (uint32_t) xIncrement * bufferSize;
+		yIndex += (uint32_t) yIncrement * bufferSize;
+		samplesRemaining = 0;
+	}
+#endif
+
 	while (samplesRemaining) {
 
 		xIndex += xIncrement;
@@ -72,41 +82,92 @@ void ThreeAxisScanner::scanSetup() {
 
 }
 
-void ThreeAxisScanner::fillBufferSum() {
+/// Terrains combine the two axes: altitude from the samples, location from the indices
+/// and the logic outputs from the hemisphere and delta states.
 
-	scanSetup();
+struct TerrainSum {
+	static inline int32_t altitude(int32_t x, int32_t y) {
+		return (x + y) >> 4;
+	}
+	static inline int32_t location(int32_t x, int32_t y) {
+		return (x + y) >> 14;
+	}
+	static inline int32_t logic(int32_t x, int32_t y) {
+		return x | y;
+	}
+};
 
-	scanTerrainSum();
+struct TerrainMultiply {
+	//15 bit fixed point multiply and right shift by 3
+	static inline int32_t altitude(int32_t x, int32_t y) {
+		return (((x - (16383)) * (y - (16383))) >> 17) + 2048;
+	}
+	static inline int32_t location(int32_t x, int32_t y) {
+		return ((((x >> 13) - 2048) * ((y >> 13) - 2048)) >> 12) + 2048;
+	}
+	static inline int32_t logic(int32_t x, int32_t y) {
+		return x & y;
+	}
+};
 
-}
+struct TerrainDifference {
+	static inline int32_t altitude(int32_t x, int32_t y) {
+		return int32_abs(x - y) >> 3;
+	}
+	static inline int32_t location(int32_t x, int32_t y) {
+		return int32_abs((x - y) >> 13);
+	}
+	static inline int32_t logic(int32_t x, int32_t y) {
+		return x ^ y;
+	}
+};
 
-void ThreeAxisScanner::fillBufferMultiply() {
+struct TerrainLighten {
+	static inline int32_t altitude(int32_t x, int32_t y) {
+		return (y > x) ? y >> 3 : x >> 3;
+	}
+	static inline int32_t location(int32_t x, int32_t y) {
+		return ((y > x) ? y : x) >> 13;
+	}
+	static inline int32_t logic(int32_t x, int32_t y) {
+		return (y > x);
+	}
+};
 
-	scanSetup();
+void ThreeAxisScanner::selectKernels(void) {
 
-	scanTerrainMultiply();
+	// indexed by terrain (button3Modes order) then x and y interpolation off
+#define BLOCK_KERNELS(terrain) \
+	{{&ThreeAxisScanner::scanTerrain<terrain, 0, 0, 0>, &ThreeAxisScanner::scanTerrain<terrain, 0, 1, 0>}, \
+	{&ThreeAxisScanner::scanTerrain<terrain, 1, 0, 0>, &ThreeAxisScanner::scanTerrain<terrain, 1, 1, 0>}}
 
-}
+	static const TerrainKernel blockKernels[4][2][2] = {BLOCK_KERNELS(TerrainSum), BLOCK_KERNELS(TerrainMultiply),
+			BLOCK_KERNELS(TerrainDifference), BLOCK_KERNELS(TerrainLighten)};
 
-void ThreeAxisScanner::fillBufferDifference() {
+	// oversampled reads always interpolate
+	static const TerrainKernel oversampledKernels[4] = {&ThreeAxisScanner::scanTerrain<TerrainSum, 0, 0, 1>,
+			&ThreeAxisScanner::scanTerrain<TerrainMultiply, 0, 0, 1>, &ThreeAxisScanner::scanTerrain<TerrainDifference, 0, 0, 1>,
+			&ThreeAxisScanner::scanTerrain<TerrainLighten, 0, 0, 1>};
 
-	scanSetup();
+	terrainKernels[0] = blockKernels[terrainType & 3][xInterpolateOff != 0][yInterpolateOff != 0];
+	terrainKernels[1] = oversampledKernels[terrainType & 3];
 
-	scanTerrainDifference();
+#ifdef SCANNER_TERRAIN_VECTOR
+	terrainVectorKernel = terrainVectorKernels ? terrainVectorKernels[terrainType & 3] : 0;
+#endif
 
 }
 
-void ThreeAxisScanner::fillBufferLighten() {
+void ThreeAxisScanner::fillBuffer(void) {
 
 	scanSetup();
 
-	scanTerrainLighten();
+	(this->*terrainKernels[oversample])();
 
 }
 
-inline void ThreeAxisScanner::scanTerrainSum(void) {
-
-	uint32_t writeIndex = 0;
+template<class Terrain, int32_t xInterpolateOff, int32_t yInterpolateOff, int32_t oversampled>
+void ThreeAxisScanner::scanTerrain(void) {
 
 	int32_t xDelta = 0;
 	int32_t yDelta = 0;
@@ -114,441 +175,88 @@ inline void ThreeAxisScanner::scanTerrainSum(void) {
 	int32_t xSample;
 	int32_t ySample;
 
-	int32_t * xTableRead = (int32_t *) xTable + (517 * (zIndex >> 16)) + 2;
-	int32_t * yTableRead = (int32_t *) yTable + (517 * (zIndex >> 16)) + 2;
-
-	int32_t leftSample;
-	int32_t morphFrac =  zIndex & 0xFFFF;
-
-	int32_t phaseFrac;
-
-	int32_t samplesRemaining = bufferSize - 1;
-
-	int32_t xIndexAtLogic;
-	int32_t yIndexAtLogic;
-
-	if (oversample == 0) {
-		if (!xInterpolateOff) {
-			xSample = getSampleQuinticSplineDeltaValue(xIndexBuffer[writeIndex], zIndex,
-				(uint32_t *) xTable, &xDelta, xInterpolateOff);
-		} else {
-			phaseFrac = xIndexBuffer[writeIndex] >> 16;
-			morphFrac = zIndex & 0xFFFF;
-			leftSample = fast_15_16_lerp_prediff(xTableRead[phaseFrac], morphFrac);
-			xSample = xValueHysterisis(leftSample, phaseFrac);
-			xDelta = fast_15_16_lerp_prediff(xTableRead[phaseFrac + 1], morphFrac) - leftSample;
-		}
-		if (!yInterpolateOff) {
-			ySample = getSampleQuinticSplineDeltaValue(yIndexBuffer[writeIndex], zIndex,
-				(uint32_t *) yTable, &yDelta, yInterpolateOff);
-		} else {
-			phaseFrac = yIndexBuffer[writeIndex] >> 16;
-			morphFrac = zIndex & 0xFFFF;
-			leftSample = fast_15_16_lerp_prediff(yTableRead[phaseFrac], morphFrac);
-			ySample = yValueHysterisis(leftSample, phaseFrac);
-			yDelta = fast_15_16_lerp_prediff(yTableRead[phaseFrac + 1], morphFrac) - leftSample;
-		}
-
-		xIndexAtLogic = xIndexBuffer[writeIndex] >> 16;
-		yIndexAtLogic = yIndexBuffer[writeIndex] >> 16;
-
-		int32_t mainScan = (xSample + ySample) >> 4;
-
-		int32_t samplesRemaining = bufferSize;
-
-		while (samplesRemaining) {
-			altitude[writeIndex] = mainScan;
-			locationBlend[writeIndex] = (xIndexBuffer[writeIndex] + yIndexBuffer[writeIndex]) >> 14;
-
-			writeIndex ++;
-			samplesRemaining --;
-
-		}
-
-	} else {
-
-		while (samplesRemaining) {
-
-			leftSample = xIndexBuffer[writeIndex] >> 16;
-			phaseFrac = (xIndexBuffer[writeIndex]) & 0xFFFF;
-
-			xSample = fast_15_16_bilerp_prediff(xTableRead[leftSample], xTableRead[leftSample + 1], morphFrac, phaseFrac);
-
-			leftSample = yIndexBuffer[writeIndex] >> 16;
-			phaseFrac = (yIndexBuffer[writeIndex]) & 0xFFFF;
-
-			ySample = fast_15_16_bilerp_prediff(yTableRead[leftSample], yTableRead[leftSample + 1], morphFrac, phaseFrac);
-
-			altitude[writeIndex] = (xSample + ySample) >> 4;
-			locationBlend[writeIndex] = (xIndexBuffer[writeIndex] + yIndexBuffer[writeIndex]) >> 14;
-			writeIndex ++;
-			samplesRemaining --;
-
-		}
-
-		leftSample = xIndexBuffer[writeIndex] >> 16;
-		xIndexAtLogic = leftSample;
-		phaseFrac = (xIndexBuffer[writeIndex]) & 0xFFFF;
-		morphFrac =  zIndex & 0xFFFF;
-
-		xSample = fast_15_16_bilerp_prediff_deltaValue(xTableRead[leftSample], xTableRead[leftSample + 1], morphFrac, phaseFrac, &xDelta);
-
-		leftSample = yIndexBuffer[writeIndex]>> 16;
-		yIndexAtLogic = leftSample;
-		phaseFrac = (yIndexBuffer[writeIndex]) & 0xFFFF;
-
-		ySample = fast_15_16_bilerp_prediff_deltaValue(yTableRead[leftSample], yTableRead[leftSample + 1], morphFrac, phaseFrac, &yDelta);
-
-		altitude[writeIndex] = (xSample + ySample) >> 4;
-		locationBlend[writeIndex] = (xIndexBuffer[writeIndex] + yIndexBuffer[writeIndex]) >> 14;
-	}
-
-	hemisphereXHysterisis(xSample);
-	hemisphereYHysterisis(ySample);
-
-	xDelta = (xDelta == 0) ? lastDeltaXState : ((uint32_t) xDelta >> 31);
-	yDelta = (yDelta == 0) ? lastDeltaYState : ((uint32_t) yDelta >> 31);
-
-	xDelta = deltaXHysterisis(xDelta, xIndexAtLogic);
-	yDelta = deltaYHysterisis(yDelta, yIndexAtLogic);
-
-	hemisphereBlend = xHemisphere | yHemisphere;
-	deltaBlend = xDelta | yDelta;
-
-
-}
-
-inline void ThreeAxisScanner::scanTerrainMultiply(void) {
-
-	uint32_t writeIndex = 0;
-
-	int32_t xDelta;
-	int32_t yDelta;
-
-	int32_t xSample;
-	int32_t ySample;
-
-	int32_t samplesRemaining = bufferSize - 1;
-
-	int32_t * xTableRead = (int32_t *) xTable + (517 * (zIndex >> 16)) + 2;
-	int32_t * yTableRead = (int32_t *) yTable + (517 * (zIndex >> 16)) + 2;
+	const int32_t * xTableRead = (const int32_t *) xTable + (517 * (zIndex >> 16)) + 2;
+	const int32_t * yTableRead = (const int32_t *) yTable + (517 * (zIndex >> 16)) + 2;
 
 	int32_t leftSample;
 	int32_t morphFrac =  zIndex & 0xFFFF;
 
 	int32_t phaseFrac;
 
-	int32_t xIndexAtLogic;
-	int32_t yIndexAtLogic;
+	// the logic outputs follow the last sample when oversampled, otherwise the one held for the block
+	int32_t logicIndex = oversampled ? bufferSize - 1 : 0;
 
-	if (oversample == 0) {
+	if (!oversampled) {
 
 		if (!xInterpolateOff) {
-			xSample = getSampleQuinticSplineDeltaValue(xIndexBuffer[writeIndex], zIndex,
-				(uint32_t *) xTable, &xDelta, xInterpolateOff);
+			xSample = getSampleQuinticSplineDeltaValue(xIndexBuffer[0], zIndex,
+				xTable, &xDelta, 0);
 		} else {
-			phaseFrac = xIndexBuffer[writeIndex] >> 16;
-			morphFrac = zIndex & 0xFFFF;
+			phaseFrac = xIndexBuffer[0] >> 16;
 			leftSample = fast_15_16_lerp_prediff(xTableRead[phaseFrac], morphFrac);
 			xSample = xValueHysterisis(leftSample, phaseFrac);
 			xDelta = fast_15_16_lerp_prediff(xTableRead[phaseFrac + 1], morphFrac) - leftSample;
 		}
 		if (!yInterpolateOff) {
-			ySample = getSampleQuinticSplineDeltaValue(yIndexBuffer[writeIndex], zIndex,
-				(uint32_t *) yTable, &yDelta, yInterpolateOff);
+			ySample = getSampleQuinticSplineDeltaValue(yIndexBuffer[0], zIndex,
+				yTable, &yDelta, 0);
 		} else {
-			phaseFrac = yIndexBuffer[writeIndex] >> 16;
-			morphFrac = zIndex & 0xFFFF;
+			phaseFrac = yIndexBuffer[0] >> 16;
 			leftSample = fast_15_16_lerp_prediff(yTableRead[phaseFrac], morphFrac);
 			ySample = yValueHysterisis(leftSample, phaseFrac);
 			yDelta = fast_15_16_lerp_prediff(yTableRead[phaseFrac + 1], morphFrac) - leftSample;
 		}
 
-		xIndexAtLogic = xIndexBuffer[writeIndex] >> 16;
-		yIndexAtLogic = yIndexBuffer[writeIndex] >> 16;
-
-		int32_t mainScan = (((xSample - (16383)) * (ySample - (16383))) >> 17) + 2048; //15 bit fixed point multiply and right shift by 3
+		int32_t mainScan = Terrain::altitude(xSample, ySample);
 
-		int32_t samplesRemaining = bufferSize;
-
-		while (samplesRemaining) {
+		for (int32_t writeIndex = 0; writeIndex < bufferSize; writeIndex++) {
 			altitude[writeIndex] = mainScan;
-			locationBlend[writeIndex] = ((((xIndexBuffer[writeIndex] >> 13) - 2048) * ((yIndexBuffer[writeIndex] >> 13) - 2048)) >> 12) + 2048;
-
-			writeIndex ++;
-			samplesRemaining --;
+			locationBlend[writeIndex] = Terrain::location(xIndexBuffer[writeIndex], yIndexBuffer[writeIndex]);
 		}
 
 	} else {
 
-		while (samplesRemaining) {
-
-			leftSample = xIndexBuffer[writeIndex]>> 16;
-			phaseFrac = (xIndexBuffer[writeIndex]) & 0xFFFF;
-
-			xSample = fast_15_16_bilerp_prediff(xTableRead[leftSample], xTableRead[leftSample + 1], morphFrac, phaseFrac);
-
-			leftSample = yIndexBuffer[writeIndex]>> 16;
-			phaseFrac = (yIndexBuffer[writeIndex]) & 0xFFFF;
-
-			ySample = fast_15_16_bilerp_prediff(yTableRead[leftSample], yTableRead[leftSample + 1], morphFrac, phaseFrac);
-
-			altitude[writeIndex] = (((xSample - (16383)) * (ySample - (16383))) >> 17) + 2048;
-			locationBlend[writeIndex] = ((((xIndexBuffer[writeIndex] >> 13) - 2048) * ((yIndexBuffer[writeIndex] >> 13) - 2048)) >> 12) + 2048;
-
-			writeIndex ++;
-			samplesRemaining --;
+		int32_t writeIndex = 0;
 
+#ifdef SCANNER_TERRAIN_VECTOR
+		// the vector kernel fills the whole block, the last sample is read again below for the deltas
+		if (terrainVectorKernel && !(bufferSize & 7)) {
+			terrainVectorKernel(xIndexBuffer, yIndexBuffer, xTableRead, yTableRead, morphFrac, bufferSize,
+					altitude, locationBlend);
+			writeIndex = logicIndex;
 		}
+#endif
 
-		leftSample = xIndexBuffer[writeIndex]>> 16;
-		xIndexAtLogic = leftSample;
-		phaseFrac = (xIndexBuffer[writeIndex]) & 0xFFFF;
-		morphFrac =  zIndex & 0xFFFF;
-
-		xSample = fast_15_16_bilerp_prediff_deltaValue(xTableRead[leftSample], xTableRead[leftSample + 1], morphFrac, phaseFrac, &xDelta);
-
-		leftSample = yIndexBuffer[writeIndex]>> 16;
-		yIndexAtLogic = leftSample;
-		phaseFrac = (yIndexBuffer[writeIndex]) & 0xFFFF;
-
-		ySample = fast_15_16_bilerp_prediff_deltaValue(yTableRead[leftSample], yTableRead[leftSample + 1], morphFrac, phaseFrac, &yDelta);
-
-		altitude[writeIndex] = (((xSample - (16383)) * (ySample - (16383))) >> 17) + 2048;
-		locationBlend[writeIndex] = ((((xIndexBuffer[writeIndex] >> 13) - 2048) * ((yIndexBuffer[writeIndex] >> 13) - 2048)) >> 12) + 2048;
-
-	}
-
-	hemisphereXHysterisis(xSample);
-	hemisphereYHysterisis(ySample);
-
-	xDelta = (xDelta == 0) ? lastDeltaXState : ((uint32_t) xDelta >> 31);
-	yDelta = (yDelta == 0) ? lastDeltaYState : ((uint32_t) yDelta >> 31);
+		for (; writeIndex < logicIndex; writeIndex++) {
 
-	xDelta = deltaXHysterisis(xDelta, xIndexAtLogic);
-	yDelta = deltaYHysterisis(yDelta, yIndexAtLogic);
-
-	hemisphereBlend = xHemisphere & yHemisphere;
-	deltaBlend = xDelta & yDelta;
-
-
-}
-
-inline void ThreeAxisScanner::scanTerrainDifference(void) {
-
-	uint32_t writeIndex = 0;
-
-	int32_t xDelta;
-	int32_t yDelta;
-
-	int32_t xSample;
-	int32_t ySample;
-
-	int32_t samplesRemaining = bufferSize - 1;
-
-	int32_t * xTableRead = (int32_t *) xTable + (517 * (zIndex >> 16)) + 2;
-	int32_t * yTableRead = (int32_t *) yTable + (517 * (zIndex >> 16)) + 2;
-
-	int32_t leftSample;
-	int32_t morphFrac =  zIndex & 0xFFFF;
-
-	int32_t phaseFrac;
-
-	int32_t xIndexAtLogic;
-	int32_t yIndexAtLogic;
-
-	if (oversample == 0) {
-
-		if (!xInterpolateOff) {
-			xSample = getSampleQuinticSplineDeltaValue(xIndexBuffer[writeIndex], zIndex,
-				(uint32_t *) xTable, &xDelta, xInterpolateOff);
-		} else {
-			phaseFrac = xIndexBuffer[writeIndex] >> 16;
-			morphFrac = zIndex & 0xFFFF;
-			leftSample = fast_15_16_lerp_prediff(xTableRead[phaseFrac], morphFrac);
-			xSample = xValueHysterisis(leftSample, phaseFrac);
-			xDelta = fast_15_16_lerp_prediff(xTableRead[phaseFrac + 1], morphFrac) - leftSample;
-		}
-		if (!yInterpolateOff) {
-			ySample = getSampleQuinticSplineDeltaValue(yIndexBuffer[writeIndex], zIndex,
-				(uint32_t *) yTable, &yDelta, yInterpolateOff);
-		} else {
-			phaseFrac = yIndexBuffer[writeIndex] >> 16;
-			morphFrac = zIndex & 0xFFFF;
-			leftSample = fast_15_16_lerp_prediff(yTableRead[phaseFrac], morphFrac);
-			ySample = yValueHysterisis(leftSample, phaseFrac);
-			yDelta = fast_15_16_lerp_prediff(yTableRead[phaseFrac + 1], morphFrac) - leftSample;
-		}
-
-		xIndexAtLogic = xIndexBuffer[writeIndex] >> 16;
-		yIndexAtLogic = yIndexBuffer[writeIndex] >> 16;
-
-		int32_t mainScan = int32_abs(xSample - ySample) >> 3; //15 bit fixed point multiply and right shift by 3
-
-		int32_t samplesRemaining = bufferSize;
-
-		while (samplesRemaining) {
-			altitude[writeIndex] = mainScan;
-			locationBlend[writeIndex] = int32_abs((xIndexBuffer[writeIndex] - yIndexBuffer[writeIndex]) >> 13);
-
-			writeIndex ++;
-			samplesRemaining --;
-
-		}
-
-	} else {
-
-		while (samplesRemaining) {
-
-			leftSample = xIndexBuffer[writeIndex]>> 16;
-			phaseFrac = (xIndexBuffer[writeIndex]) & 0xFFFF;
-
-			xSample = fast_15_16_bilerp_prediff(xTableRead[leftSample], xTableRead[leftSample + 1], morphFrac, phaseFrac);
-
-			leftSample = yIndexBuffer[writeIndex]>> 16;
-			phaseFrac = (yIndexBuffer[writeIndex]) & 0xFFFF;
-
-			ySample = fast_15_16_bilerp_prediff(yTableRead[leftSample], yTableRead[leftSample + 1], morphFrac, phaseFrac);
-
-			altitude[writeIndex] = int32_abs(xSample - ySample) >> 3;
-			locationBlend[writeIndex] = int32_abs((xIndexBuffer[writeIndex] - yIndexBuffer[writeIndex]) >> 13);
-
-			writeIndex ++;
-			samplesRemaining --;
-
-		}
-
-		leftSample = xIndexBuffer[writeIndex]>> 16;
-		xIndexAtLogic = leftSample;
-		phaseFrac = (xIndexBuffer[writeIndex]) & 0xFFFF;
-		morphFrac =  zIndex & 0xFFFF;
-
-		xSample = fast_15_16_bilerp_prediff_deltaValue(xTableRead[leftSample], xTableRead[leftSample + 1], morphFrac, phaseFrac, &xDelta);
-
-		leftSample = yIndexBuffer[writeIndex]>> 16;
-		yIndexAtLogic = leftSample;
-		phaseFrac = (yIndexBuffer[writeIndex]) & 0xFFFF;
-
-		ySample = fast_15_16_bilerp_prediff_deltaValue(yTableRead[leftSample], yTableRead[leftSample + 1], morphFrac, phaseFrac, &yDelta);
-
-		altitude[writeIndex] = int32_abs(xSample - ySample) >> 3;
-		locationBlend[writeIndex] = int32_abs((xIndexBuffer[writeIndex] - yIndexBuffer[writeIndex]) >> 13);
-
-	}
-
-	hemisphereXHysterisis(xSample);
-	hemisphereYHysterisis(ySample);
-
-	xDelta = (xDelta == 0) ? lastDeltaXState : ((uint32_t) xDelta >> 31);
-	yDelta = (yDelta == 0) ? lastDeltaYState : ((uint32_t) yDelta >> 31);
-
-	xDelta = deltaXHysterisis(xDelta, xIndexAtLogic);
-	yDelta = deltaYHysterisis(yDelta, yIndexAtLogic);
-
-	hemisphereBlend = xHemisphere ^ yHemisphere;
-	deltaBlend = xDelta ^ yDelta;
-
-}
-
-inline void ThreeAxisScanner::scanTerrainLighten(void) {
-
-	uint32_t writeIndex = 0;
-
-	int32_t xDelta;
-	int32_t yDelta;
-
-	int32_t xSample;
-	int32_t ySample;
-
-	int32_t samplesRemaining = bufferSize - 1;
-
-	int32_t * xTableRead = (int32_t *) xTable + (517 * (zIndex >> 16)) + 2;
-	int32_t * yTableRead = (int32_t *) yTable + (517 * (zIndex >> 16)) + 2;
-
-	int32_t leftSample;
-	int32_t morphFrac =  zIndex & 0xFFFF;
-
-	int32_t phaseFrac;
-
-	int32_t xIndexAtLogic;
-	int32_t yIndexAtLogic;
-
-	if (oversample == 0) {
-
-		if (!xInterpolateOff) {
-			xSample = getSampleQuinticSplineDeltaValue(xIndexBuffer[writeIndex], zIndex,
-				(uint32_t *) xTable, &xDelta, xInterpolateOff);
-		} else {
-			phaseFrac = xIndexBuffer[writeIndex] >> 16;
-			morphFrac = zIndex & 0xFFFF;
-			leftSample = fast_15_16_lerp_prediff(xTableRead[phaseFrac], morphFrac);
-			xSample = xValueHysterisis(leftSample, phaseFrac);
-			xDelta = fast_15_16_lerp_prediff(xTableRead[phaseFrac + 1], morphFrac) - leftSample;
-		}
-		if (!yInterpolateOff) {
-			ySample = getSampleQuinticSplineDeltaValue(yIndexBuffer[writeIndex], zIndex,
-				(uint32_t *) yTable, &yDelta, yInterpolateOff);
-		} else {
-			phaseFrac = yIndexBuffer[writeIndex] >> 16;
-			morphFrac = zIndex & 0xFFFF;
-			leftSample = fast_15_16_lerp_prediff(yTableRead[phaseFrac], morphFrac);
-			ySample = yValueHysterisis(leftSample, phaseFrac);
-			yDelta = fast_15_16_lerp_prediff(yTableRead[phaseFrac + 1], morphFrac) - leftSample;
-		}
-
-		xIndexAtLogic = xIndexBuffer[writeIndex] >> 16;
-		yIndexAtLogic = yIndexBuffer[writeIndex] >> 16;
-
-		int32_t mainScan = (ySample > xSample) ? ySample >> 3 : xSample >> 3; //15 bit fixed point multiply and right shift by 3
-
-		int32_t samplesRemaining = bufferSize;
-
-		while (samplesRemaining) {
-			altitude[writeIndex] = mainScan;
-			locationBlend[writeIndex] = ((yIndexBuffer[writeIndex] > xIndexBuffer[writeIndex]) ? yIndexBuffer[writeIndex] : xIndexBuffer[writeIndex]) >> 13;
-
-			writeIndex ++;
-			samplesRemaining --;
-
-		}
-
-	} else {
-
-		while (samplesRemaining) {
-
-			leftSample = xIndexBuffer[writeIndex]>> 16;
+			leftSample = xIndexBuffer[writeIndex] >> 16;
 			phaseFrac = (xIndexBuffer[writeIndex]) & 0xFFFF;
 
 			xSample = fast_15_16_bilerp_prediff(xTableRead[leftSample], xTableRead[leftSample + 1], morphFrac, phaseFrac);
 
-			leftSample = yIndexBuffer[writeIndex]>> 16;
+			leftSample = yIndexBuffer[writeIndex] >> 16;
 			phaseFrac = (yIndexBuffer[writeIndex]) & 0xFFFF;
 
 			ySample = fast_15_16_bilerp_prediff(yTableRead[leftSample], yTableRead[leftSample + 1], morphFrac, phaseFrac);
 
-			altitude[writeIndex] = (ySample > xSample) ? ySample >> 3 : xSample >> 3;
-			locationBlend[writeIndex] = ((yIndexBuffer[writeIndex] > xIndexBuffer[writeIndex]) ? yIndexBuffer[writeIndex] : xIndexBuffer[writeIndex]) >> 13;
-
-			writeIndex ++;
-			samplesRemaining --;
+			altitude[writeIndex] = Terrain::altitude(xSample, ySample);
+			locationBlend[writeIndex] = Terrain::location(xIndexBuffer[writeIndex], yIndexBuffer[writeIndex]);
 
 		}
 
-		leftSample = xIndexBuffer[writeIndex] >> 16;
-		xIndexAtLogic = leftSample;
-		phaseFrac = (xIndexBuffer[writeIndex]) & 0xFFFF;
-		morphFrac =  zIndex & 0xFFFF;
+		// last sample also gets the slope for the logic outputs
+		leftSample = xIndexBuffer[logicIndex] >> 16;
+		phaseFrac = (xIndexBuffer[logicIndex]) & 0xFFFF;
 
 		xSample = fast_15_16_bilerp_prediff_deltaValue(xTableRead[leftSample], xTableRead[leftSample + 1], morphFrac, phaseFrac, &xDelta);
 
-		leftSample = yIndexBuffer[writeIndex] >> 16;
-		yIndexAtLogic = leftSample;
-		phaseFrac = (yIndexBuffer[writeIndex]) & 0xFFFF;
+		leftSample = yIndexBuffer[logicIndex] >> 16;
+		phaseFrac = (yIndexBuffer[logicIndex]) & 0xFFFF;
 
 		ySample = fast_15_16_bilerp_prediff_deltaValue(yTableRead[leftSample], yTableRead[leftSample + 1], morphFrac, phaseFrac, &yDelta);
 
-		altitude[writeIndex] = (ySample > xSample) ? ySample >> 3 : xSample >> 3;
-		locationBlend[writeIndex] = ((yIndexBuffer[writeIndex] > xIndexBuffer[writeIndex]) ? yIndexBuffer[writeIndex] : xIndexBuffer[writeIndex]) >> 13;
+		altitude[logicIndex] = Terrain::altitude(xSample, ySample);
+		locationBlend[logicIndex] = Terrain::location(xIndexBuffer[logicIndex], yIndexBuffer[logicIndex]);
 
 	}
 
@@ -558,10 +266,10 @@ inline void ThreeAxisScanner::scanTerrainLighten(void) {
 	xDelta = (xDelta == 0) ? lastDeltaXState : ((uint32_t) xDelta >> 31);
 	yDelta = (yDelta == 0) ? lastDeltaYState : ((uint32_t) yDelta >> 31);
 
-	xDelta = deltaXHysterisis(xDelta, xIndexAtLogic);
-	yDelta = deltaYHysterisis(yDelta, yIndexAtLogic);
+	xDelta = deltaXHysterisis(xDelta, xIndexBuffer[logicIndex] >> 16);
+	yDelta = deltaYHysterisis(yDelta, yIndexBuffer[logicIndex] >> 16);
 
-	hemisphereBlend = (yHemisphere > xHemisphere);
-	deltaBlend = (yDelta > xDelta);
+	hemisphereBlend = Terrain::logic(xHemisphere, yHemisphere);
+	deltaBlend = Terrain::logic(xDelta, yDelta);
 
 }
@@ -0,0 +1,144 @@
+/*
+ * pll_bench.cpp
+ *
+ *  Virtual build only: synthetic clock and PLL measurements shared by
+ *  the Sync and Sync3 benchmarks.
+ */
+
+#include "pll_bench.hpp"
+
+#ifdef BUILD_VIRTUAL
+
+#include <math.h>
+#include <stdlib.h>
+
+double SyntheticClock::nextPeriod(void) {
+
+	if (changeTo == 0 || edges < changeEdge) {
+		return period;
+	}
+	if (edges >= changeEdge + rampEdges) {
+		return changeTo;
+	}
+	double position = (double) (edges - changeEdge) / rampEdges;
+	return period + (changeTo - period) * position;
+
+}
+
+void SyntheticClock::start(void) {
+
+	noise = seed;
+	time = 0;
+	edges = 0;
+	high = 0;
+	dropped = 0;
+	currentPeriod = period;
+	gridTime = period;
+	edgeTime = period;
+
+}
+
+int32_t SyntheticClock::advance(void) {
+
+	time += 1;
+
+	if (high && time >= edgeTime - currentPeriod / 2) {
+		high = 0;
+		return dropped ? 0 : -1;
+	}
+
+	if (time < edgeTime) {
+		return 0;
+	}
+
+	edges++;
+	dropped = dropEvery && (edges % dropEvery == 0);
+	high = 1;
+
+	currentPeriod = nextPeriod();
+	gridTime += currentPeriod;
+	// uniform in +/- jitter periods, from a linear congruential generator so runs repeat
+	noise = noise * 1664525 + 1013904223;
+	double offset = ((double) (noise >> 8) / (1 << 23) - 1) * jitter * currentPeriod;
+	edgeTime = gridTime + offset;
+
+	return dropped ? 0 : 1;
+
+}
+
+PllMeter::PllMeter(int32_t clockEdges) {
+
+	maxCorrections = clockEdges;
+	errors = new int32_t[clockEdges];
+	edges = new int32_t[clockEdges];
+
+}
+
+PllMeter::~PllMeter() {
+
+	delete[] errors;
+	delete[] edges;
+
+}
+
+void PllMeter::addCorrection(int32_t error, int32_t edge) {
+
+	if (corrections < maxCorrections) {
+		errors[corrections] = error;
+		edges[corrections] = edge;
+		corrections++;
+	}
+
+}
+
+void PllMeter::addBlock(double nanoseconds) {
+
+	blockTime += nanoseconds;
+	blocks++;
+
+}
+
+PllBenchResult PllMeter::result(float ratio) {
+
+	PllBenchResult result;
+
+	// the lock is the run within tolerance that the loop stays in until the end, a later slip starts it again
+	int32_t run = 0;
+	int32_t runStart = -1;
+	for (int32_t i = 0; i < corrections; i++) {
+		if (edges[i] < 0) {
+			continue;
+		}
+		if (abs(errors[i]) >= PLL_BENCH_LOCK_TOLERANCE) {
+			run = 0;
+		} else if (run++ == 0) {
+			runStart = edges[i];
+		}
+	}
+	result.lockEdges = (run >= PLL_BENCH_LOCK_RUN) ? runStart : -1;
+
+	double sum = 0;
+	double jitterSum = 0;
+	double peak = 0;
+	int32_t first = corrections - corrections / 4;
+	for (int32_t i = first; i < corrections; i++) {
+		double error = errors[i] / 4294967296.0;
+		sum += error * error;
+		peak = fmax(peak, fabs(error));
+		if (i > first) {
+			double change = (errors[i] - (double) errors[i - 1]) / 4294967296.0;
+			jitterSum += change * change;
+		}
+	}
+	int32_t count = corrections - first;
+	result.phaseError = (count > 0) ? sqrt(sum / count) : 0;
+	result.phaseJitter = (count > 1) ? sqrt(jitterSum / (count - 1)) : 0;
+	result.peakError = peak;
+	result.blockTime = blocks ? blockTime / blocks : 0;
+	result.ratio = ratio;
+
+	return result;
+
+}
+
+#endif
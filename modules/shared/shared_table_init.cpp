@@ -0,0 +1,21 @@
+#include "meta_tables.hpp"
+#include "sync_tables.hpp"
+#include "scanner_tables.hpp"
+
+
+SHARED_WAVETABLE_FAMILIES(WAVETABLE_FAMILY_DEF)
+
+/// Every slope family stored in flash across the module table sets, expanded from the sets' own lists.
+/// A family with the same samples as another should be moved into SharedWavetableSet or reused instead.
+static constexpr WavetableFamily wavetableFamilies[] = {
+	SHARED_WAVETABLE_FAMILIES(WAVETABLE_FAMILY_ENTRY)
+	META_WAVETABLE_FAMILIES(WAVETABLE_FAMILY_ENTRY)
+	SYNC_WAVETABLE_FAMILIES(WAVETABLE_FAMILY_ENTRY)
+	SCANNER_WAVETABLE_FAMILIES(WAVETABLE_FAMILY_ENTRY)};
+
+static_assert(wavetableFamiliesDistinct(wavetableFamilies,
+		sizeof(wavetableFamilies) / sizeof(WavetableFamily), 0), "duplicate wavetable slope family");
+
+#ifdef WAVETABLE_MIPMAP
+const LookupTable<int32_t, 512> WavetableMipmap::sine = generateTable<int32_t, 512, MipmapSineGenerator>();
+#endif
@@ -0,0 +1,373 @@
+/*
+ * wavetable_import.cpp
+ *
+ *  Virtual build only: reads user wavetable files and converts them
+ *  into attack/release slopes.
+ */
+
+#include "wavetable_import.hpp"
+
+#ifdef BUILD_VIRTUAL
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WAVETABLE_CACHE_VERSION 1
+
+// header of the converted slopes cache, followed by the attack then release slopes
+struct WavetableCacheHeader {
+	char magic[4];
+	uint32_t version;
+	uint32_t sourceSize;
+	uint32_t sourceHash;
+	uint32_t maxWaveforms;
+	uint32_t numWaveforms;
+};
+
+static uint8_t * readFile(const char * path, uint32_t * size) {
+	FILE * file = fopen(path, "rb");
+	if (!file) {
+		return 0;
+	}
+	fseek(file, 0, SEEK_END);
+	long length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	uint8_t * data = (length > 0) ? (uint8_t *) malloc(length) : 0;
+	if (data && fread(data, 1, length, file) != (size_t) length) {
+		free(data);
+		data = 0;
+	}
+	fclose(file);
+	*size = (uint32_t) length;
+	return data;
+}
+
+// FNV-1a
+static uint32_t hashData(const uint8_t * data, uint32_t size) {
+	uint32_t hash = 2166136261u;
+	for (uint32_t i = 0; i < size; i++) {
+		hash = (hash ^ data[i]) * 16777619u;
+	}
+	return hash;
+}
+
+static inline uint32_t read16(const uint8_t * data) {
+	return data[0] | (data[1] << 8);
+}
+
+static inline uint32_t read32(const uint8_t * data) {
+	return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+// wav sample as signed 16 bit
+static int32_t readWavSample(const uint8_t * data, uint32_t bits, int32_t isFloat) {
+	if (isFloat) {
+		float value;
+		uint32_t word = read32(data);
+		memcpy(&value, &word, 4);
+		// a NaN fails every comparison and would convert to an arbitrary integer, so read it as silence
+		if (value != value) {
+			return 0;
+		}
+		value = (value > 1.0f) ? 1.0f : (value < -1.0f) ? -1.0f : value;
+		return (int32_t) (value * 32767.0f);
+	}
+	switch (bits) {
+	case 8:
+		return ((int32_t) data[0] - 128) << 8;
+	case 16:
+		return (int16_t) read16(data);
+	case 24:
+		return (int32_t) ((data[0] << 8) | (data[1] << 16) | ((uint32_t) data[2] << 24)) >> 16;
+	default:
+		return (int32_t) read32(data) >> 16;
+	}
+}
+
+// signed 16 bit to the 15 bit unsigned range of the built in tables
+static inline uint16_t toSlopeSample(int32_t value) {
+	value = (value + 32768) >> 1;
+	return (uint16_t) ((value < 0) ? 0 : (value > 32767) ? 32767 : value);
+}
+
+// raw files are meant to hold 15 bit samples already, anything above would wrap the prediff packing
+static inline uint16_t toRawSample(uint32_t value) {
+	return (uint16_t) ((value > 32767) ? 32767 : value);
+}
+
+// sample n of a frame resampled to WAVETABLE_IMPORT_CYCLE_LENGTH, averaging when shrinking, interpolating when stretching
+static int32_t cycleSample(const int32_t * frame, uint32_t frameLength, uint32_t n) {
+	if (frameLength >= WAVETABLE_IMPORT_CYCLE_LENGTH) {
+		uint32_t start = n * frameLength / WAVETABLE_IMPORT_CYCLE_LENGTH;
+		uint32_t end = (n + 1) * frameLength / WAVETABLE_IMPORT_CYCLE_LENGTH;
+		int64_t sum = 0;
+		for (uint32_t i = start; i < end; i++) {
+			sum += frame[i];
+		}
+		return (int32_t) (sum / (int64_t) (end - start));
+	} else {
+		uint32_t position = (uint32_t) (((uint64_t) n * frameLength << 16) / WAVETABLE_IMPORT_CYCLE_LENGTH);
+		uint32_t index = position >> 16;
+		int32_t fractional = position & 0xFFFF;
+		int32_t a = frame[index];
+		int32_t b = frame[(index + 1) % frameLength];
+		return a + (int32_t) (((int64_t) (b - a) * fractional) >> 16);
+	}
+}
+
+int32_t WavetableImport::convertWav(Slopes * out, const uint8_t * data, uint32_t size, uint32_t maxWaveforms) {
+
+	if (size < 12 || memcmp(data, "RIFF", 4) || memcmp(data + 8, "WAVE", 4)) {
+		return 0;
+	}
+
+	uint32_t channels = 0;
+	uint32_t bits = 0;
+	int32_t isFloat = 0;
+	uint32_t frameLength = WAVETABLE_IMPORT_FRAME_LENGTH;
+	const uint8_t * sampleData = 0;
+	uint32_t sampleDataSize = 0;
+
+	// walk the chunks, each padded to an even length
+	uint32_t position = 12;
+	while (position + 8 <= size) {
+		const uint8_t * chunk = data + position + 8;
+		uint32_t chunkSize = read32(data + position + 4);
+		if (chunkSize > size - position - 8) {
+			chunkSize = size - position - 8;
+		}
+		if (!memcmp(data + position, "fmt ", 4) && chunkSize >= 16) {
+			uint32_t format = read16(chunk);
+			// WAVE_FORMAT_EXTENSIBLE carries the real format at the start of the subformat GUID
+			if (format == 0xFFFE && chunkSize >= 26) {
+				format = read16(chunk + 24);
+			}
+			channels = read16(chunk + 2);
+			bits = read16(chunk + 14);
+			isFloat = (format == 3);
+			if ((format != 1 && format != 3) || (isFloat && bits != 32)) {
+				return 0;
+			}
+		} else if (!memcmp(data + position, "clm ", 4)) {
+			// Serum frame length, "<!>2048 ..."
+			char text[16] = {0};
+			memcpy(text, chunk, (chunkSize < 15) ? chunkSize : 15);
+			uint32_t length = (text[0] == '<' && text[1] == '!' && text[2] == '>') ? strtoul(text + 3, 0, 10) : 0;
+			if (length) {
+				frameLength = length;
+			}
+		} else if (!memcmp(data + position, "data", 4)) {
+			sampleData = chunk;
+			sampleDataSize = chunkSize;
+		}
+		position += 8 + chunkSize + (chunkSize & 1);
+	}
+
+	if (!sampleData || !channels || (bits != 8 && bits != 16 && bits != 24 && bits != 32)) {
+		return 0;
+	}
+
+	uint32_t stride = channels * (bits >> 3);
+	uint32_t numSamples = sampleDataSize / stride;
+	if (!numSamples) {
+		return 0;
+	}
+
+	int32_t * samples = (int32_t *) malloc(numSamples * sizeof(int32_t));
+	if (!samples) {
+		return 0;
+	}
+	for (uint32_t i = 0; i < numSamples; i++) {
+		samples[i] = readWavSample(sampleData + i * stride, bits, isFloat);
+	}
+
+	// a file shorter than one frame is taken as a single cycle
+	if (numSamples < frameLength) {
+		frameLength = numSamples;
+	}
+	uint32_t frames = numSamples / frameLength;
+
+	uint32_t numWaveforms = (frames < maxWaveforms) ? frames : maxWaveforms;
+
+	int32_t cycle[WAVETABLE_IMPORT_CYCLE_LENGTH];
+
+	for (uint32_t slope = 0; slope < numWaveforms; slope++) {
+
+		// spread the slopes evenly over the frames, crossfading between neighbours
+		uint32_t framePosition = (numWaveforms > 1) ?
+				(uint32_t) (((uint64_t) (frames - 1) << 16) * slope / (numWaveforms - 1)) : 0;
+		uint32_t frame = framePosition >> 16;
+		int32_t fractional = framePosition & 0xFFFF;
+
+		for (uint32_t n = 0; n < WAVETABLE_IMPORT_CYCLE_LENGTH; n++) {
+			int32_t a = cycleSample(samples + frame * frameLength, frameLength, n);
+			if (fractional) {
+				int32_t b = cycleSample(samples + (frame + 1) * frameLength, frameLength, n);
+				a += (int32_t) (((int64_t) (b - a) * fractional) >> 16);
+			}
+			cycle[n] = a;
+		}
+
+		// first half rises through the attack, the release is stored back to front from the end of the cycle
+		for (uint32_t n = 0; n < 257; n++) {
+			out->attack[slope][n] = toSlopeSample(cycle[n]);
+			out->release[slope][n] = toSlopeSample(cycle[(WAVETABLE_IMPORT_CYCLE_LENGTH - n) % WAVETABLE_IMPORT_CYCLE_LENGTH]);
+		}
+	}
+
+	free(samples);
+
+	out->numWaveforms = numWaveforms;
+
+	return 1;
+}
+
+int32_t WavetableImport::convertRaw(Slopes * out, const uint8_t * data, uint32_t size, uint32_t maxWaveforms) {
+
+	uint32_t slopeBytes = 257 * 2;
+	uint32_t fileWaveforms = size / (2 * slopeBytes);
+
+	if (!fileWaveforms || size != fileWaveforms * 2 * slopeBytes) {
+		return 0;
+	}
+
+	uint32_t numWaveforms = (fileWaveforms < maxWaveforms) ? fileWaveforms : maxWaveforms;
+
+	for (uint32_t slope = 0; slope < numWaveforms; slope++) {
+		// keep the first and last slopes and spread the rest evenly if there are too many
+		uint32_t source = (numWaveforms > 1) ?
+				(slope * (fileWaveforms - 1) + (numWaveforms - 1) / 2) / (numWaveforms - 1) : 0;
+		const uint8_t * attackData = data + source * slopeBytes;
+		const uint8_t * releaseData = data + (fileWaveforms + source) * slopeBytes;
+		for (uint32_t n = 0; n < 257; n++) {
+			out->attack[slope][n] = toRawSample(read16(attackData + 2 * n));
+			out->release[slope][n] = toRawSample(read16(releaseData + 2 * n));
+		}
+	}
+
+	out->numWaveforms = numWaveforms;
+
+	return 1;
+}
+
+int32_t WavetableImport::readCache(Slopes * out, const char * cachePath, uint32_t sourceSize, uint32_t sourceHash,
+		uint32_t maxWaveforms) {
+
+	FILE * file = fopen(cachePath, "rb");
+	if (!file) {
+		return 0;
+	}
+
+	WavetableCacheHeader header;
+	int32_t valid = (fread(&header, sizeof(header), 1, file) == 1) &&
+			!memcmp(header.magic, "VIAW", 4) &&
+			header.version == WAVETABLE_CACHE_VERSION &&
+			header.sourceSize == sourceSize &&
+			header.sourceHash == sourceHash &&
+			header.maxWaveforms == maxWaveforms &&
+			header.numWaveforms && header.numWaveforms <= maxWaveforms;
+
+	valid = valid &&
+			fread(out->attack, sizeof(out->attack[0]), header.numWaveforms, file) == header.numWaveforms &&
+			fread(out->release, sizeof(out->release[0]), header.numWaveforms, file) == header.numWaveforms;
+
+	fclose(file);
+
+	if (valid) {
+		out->numWaveforms = header.numWaveforms;
+	}
+
+	return valid;
+}
+
+void WavetableImport::writeCache(const Slopes * in, const char * cachePath, uint32_t sourceSize, uint32_t sourceHash,
+		uint32_t maxWaveforms) {
+
+	FILE * file = fopen(cachePath, "wb");
+	if (!file) {
+		return;
+	}
+
+	WavetableCacheHeader header;
+	memcpy(header.magic, "VIAW", 4);
+	header.version = WAVETABLE_CACHE_VERSION;
+	header.sourceSize = sourceSize;
+	header.sourceHash = sourceHash;
+	header.maxWaveforms = maxWaveforms;
+	header.numWaveforms = in->numWaveforms;
+
+	fwrite(&header, sizeof(header), 1, file);
+	fwrite(in->attack, sizeof(in->attack[0]), in->numWaveforms, file);
+	fwrite(in->release, sizeof(in->release[0]), in->numWaveforms, file);
+
+	fclose(file);
+}
+
+void WavetableImport::buildImage(Slopes * out, int32_t format) {
+	for (uint32_t i = 0; i < out->numWaveforms * 517; i++) {
+		out->image[0][i] = wavetableImageEntry(out->attack, out->release, out->numWaveforms, i, format);
+	}
+}
+
+WavetableImport::~WavetableImport() {
+	free(current);
+	free(scratch);
+}
+
+int32_t WavetableImport::import(const char * path, const char * cachePath, uint32_t maxWaveforms, int32_t format) {
+
+	if (maxWaveforms > WAVETABLE_IMPORT_MAX_WAVEFORMS) {
+		maxWaveforms = WAVETABLE_IMPORT_MAX_WAVEFORMS;
+	}
+
+	uint32_t size = 0;
+	uint8_t * data = readFile(path, &size);
+	if (!data) {
+		return 0;
+	}
+
+	uint32_t hash = hashData(data, size);
+
+	if (!scratch) {
+		scratch = (Slopes *) malloc(sizeof(Slopes));
+		if (!scratch) {
+			free(data);
+			return 0;
+		}
+	}
+
+	int32_t converted = cachePath && readCache(scratch, cachePath, size, hash, maxWaveforms);
+	if (!converted) {
+		// only files without a RIFF header are taken as raw, a wav that fails to parse is rejected
+		int32_t isWav = (size >= 4) && !memcmp(data, "RIFF", 4);
+		converted = isWav ? convertWav(scratch, data, size, maxWaveforms) : convertRaw(scratch, data, size, maxWaveforms);
+		if (converted && cachePath) {
+			writeCache(scratch, cachePath, size, hash, maxWaveforms);
+		}
+	}
+
+	free(data);
+
+	if (!converted) {
+		return 0;
+	}
+
+	buildImage(scratch, format);
+
+	scratch->table.attackSlope = scratch->attack;
+	scratch->table.releaseSlope = scratch->release;
+	scratch->table.slopeLength = 256;
+	scratch->table.numWaveforms = scratch->numWaveforms;
+	scratch->table.image = scratch->image[0];
+	scratch->table.compressedAttack = 0;
+	scratch->table.compressedRelease = 0;
+
+	Slopes * replaced = current;
+	current = scratch;
+	scratch = replaced;
+
+	return 1;
+}
+
+#endif
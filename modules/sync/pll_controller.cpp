@@ -36,9 +36,11 @@ void ViaSync::parseControls(ViaControls * controls, ViaInputStreams * input) {
 
 	lastYIndex = ratioY;
 
-	fracMultiplier = selectedScale->grid[ratioY][ratioX]->fractionalPart;
-	intMultiplier = selectedScale->grid[ratioY][ratioX]->integerPart;
-	gcd = selectedScale->grid[ratioY][ratioX]->fundamentalDivision;
+	uint32_t note = selectedScale->cells[ratioY * SCALE_GRID_COLUMNS + ratioX];
+	uint64_t ratio = selectedScale->ratios[note];
+	fracMultiplier = (uint32_t) ratio;
+	intMultiplier = ratio >> 32;
+	gcd = selectedScale->gcds[note];
 
 }
 void ViaSync::doPLL(void) {
@@ -63,6 +65,11 @@ void ViaSync::doPLL(void) {
 
 	error *= -1;
 
+#ifdef BUILD_VIRTUAL
+	// hard sync resets to target without the phase modulation offset the loop modes lock around
+	pllError = (syncMode == 3) ? error - syncWavetable.phaseMod : error;
+#endif
+
 //	errorSig = __USAT((error >> 20) + 2048, 12);
 //	errorSig = __USAT(((periodCount - lastIncrement) >> 8) + 2048, 12);
 //	lastIncrement = periodCount;
@@ -112,6 +119,8 @@ void ViaSync::doPLL(void) {
 
 	}
 
+	pllNudge = ((int64_t) pllNudge * pllGain) >> 16;
+
 }
 
 void ViaSync::generateFrequency(void) {
@@ -125,8 +134,10 @@ void ViaSync::generateFrequency(void) {
 #endif
 
 
+	periodDivisor.set(periodCount * 8);
+
 	int64_t incrementCalc = ((int64_t)intMultiplier << 16) | (fracMultiplier >> 16);
-	incrementCalc = ((int64_t) (incrementCalc * (int64_t)clockDiv + (int64_t)pllNudge) * 1440) / (periodCount * 8);
+	incrementCalc = periodDivisor.divideSigned((int64_t) (incrementCalc * (int64_t)clockDiv + (int64_t)pllNudge) * 1440);
 	increment = __USAT(incrementCalc, 30);
 
 }
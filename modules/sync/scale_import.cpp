@@ -0,0 +1,431 @@
+/*
+ * scale_import.cpp
+ *
+ *  Virtual build only: reads Scala tunings and compiles them into
+ *  Sync ratio grids.
+ */
+
+#include "scale_import.hpp"
+
+#ifdef BUILD_VIRTUAL
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SCALE_CACHE_VERSION 1
+/// Most pitches read from a .scl file and most entries read from a .kbm mapping.
+#define SCALE_IMPORT_MAX_PITCHES 512
+
+// header of the compiled grid cache, followed by the cells, ratios and gcds
+struct ScaleCacheHeader {
+	char magic[4];
+	uint32_t version;
+	uint32_t sourceSize;
+	uint32_t sourceHash;
+	uint32_t numNotes;
+};
+
+// pitches of a .scl file, pitches[0] is the implied 1/1 and pitches[size] the period
+struct ScalaTuning {
+	double pitches[SCALE_IMPORT_MAX_PITCHES + 1];
+	int32_t size;
+};
+
+// the parts of a .kbm file that matter without a reference frequency, keys relative to the middle note
+struct ScalaMapping {
+	int32_t degrees[SCALE_IMPORT_MAX_PITCHES];
+	int32_t size;
+	int32_t firstKey;
+	int32_t lastKey;
+	int32_t octaveDegree;
+};
+
+// null terminated so the parsers can run off the end
+static char * readText(const char * path, uint32_t * size) {
+	FILE * file = fopen(path, "rb");
+	if (!file) {
+		return 0;
+	}
+	fseek(file, 0, SEEK_END);
+	long length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	char * text = (length >= 0) ? (char *) malloc(length + 1) : 0;
+	if (text && fread(text, 1, length, file) != (size_t) length) {
+		free(text);
+		text = 0;
+	}
+	fclose(file);
+	if (text) {
+		text[length] = 0;
+		*size = (uint32_t) length;
+	}
+	return text;
+}
+
+// FNV-1a, continuing from hash
+static uint32_t hashText(uint32_t hash, const char * text, uint32_t size) {
+	for (uint32_t i = 0; i < size; i++) {
+		hash = (hash ^ (uint8_t) text[i]) * 16777619u;
+	}
+	return hash;
+}
+
+// start of the next line that isn't a '!' comment, advancing text past it, null at the end
+static const char * nextLine(const char ** text) {
+	while (**text) {
+		const char * line = *text;
+		const char * end = strchr(line, '\n');
+		*text = end ? end + 1 : line + strlen(line);
+		while (*line == ' ' || *line == '\t') {
+			line++;
+		}
+		if (*line != '!') {
+			return line;
+		}
+	}
+	return 0;
+}
+
+static inline int32_t floorDivide(int32_t a, int32_t b) {
+	return (a >= 0) ? a / b : -((b - 1 - a) / b);
+}
+
+static inline int32_t wrap(int32_t a, int32_t b) {
+	return a - floorDivide(a, b) * b;
+}
+
+// a cents value if there is a '.', otherwise a ratio or a whole number
+static int32_t parsePitch(const char * line, double * pitch) {
+	const char * end = line;
+	while (*end && *end != ' ' && *end != '\t' && *end != '\r' && *end != '\n') {
+		end++;
+	}
+	if (memchr(line, '.', end - line)) {
+		*pitch = pow(2.0, strtod(line, 0) / 1200.0);
+		return 1;
+	}
+	char * after;
+	unsigned long numerator = strtoul(line, &after, 10);
+	unsigned long denominator = 1;
+	if (after == line) {
+		return 0;
+	}
+	if (*after == '/') {
+		denominator = strtoul(after + 1, 0, 10);
+	}
+	if (!numerator || !denominator) {
+		return 0;
+	}
+	*pitch = (double) numerator / denominator;
+	return 1;
+}
+
+static int32_t parseScl(const char * text, ScalaTuning * tuning) {
+	// description line, then the count
+	if (!nextLine(&text)) {
+		return 0;
+	}
+	const char * line = nextLine(&text);
+	if (!line) {
+		return 0;
+	}
+	int32_t size = strtol(line, 0, 10);
+	if (size < 1 || size > SCALE_IMPORT_MAX_PITCHES) {
+		return 0;
+	}
+	tuning->pitches[0] = 1.0;
+	for (int32_t i = 1; i <= size; i++) {
+		line = nextLine(&text);
+		if (!line || !parsePitch(line, &tuning->pitches[i])) {
+			return 0;
+		}
+	}
+	if (tuning->pitches[size] <= 1.0) {
+		return 0;
+	}
+	tuning->size = size;
+	return 1;
+}
+
+static int32_t parseKbm(const char * text, ScalaMapping * mapping) {
+	int32_t values[7];
+	for (int32_t i = 0; i < 7; i++) {
+		const char * line = nextLine(&text);
+		if (!line) {
+			return 0;
+		}
+		// the reference frequency (values[5]) isn't used, reading it as an integer just skips it
+		values[i] = strtol(line, 0, 10);
+	}
+	int32_t size = values[0];
+	if (size < 0 || size > SCALE_IMPORT_MAX_PITCHES) {
+		return 0;
+	}
+	int32_t middle = values[3];
+	mapping->size = size;
+	mapping->firstKey = values[1] - middle;
+	mapping->lastKey = values[2] - middle;
+	mapping->octaveDegree = values[6];
+	// missing entries are unmapped, as are 'x's
+	for (int32_t i = 0; i < size; i++) {
+		const char * line = nextLine(&text);
+		mapping->degrees[i] = (line && *line >= '0' && *line <= '9') ? strtol(line, 0, 10) : -1;
+	}
+	return mapping->firstKey <= 0 && mapping->lastKey >= 0;
+}
+
+// ratio of key (relative to the middle note) to 1/1, 0 if the key is unmapped
+static double keyRatio(const ScalaTuning * tuning, const ScalaMapping * mapping, int32_t key) {
+	int32_t degree = key;
+	if (mapping) {
+		if (key < mapping->firstKey || key > mapping->lastKey) {
+			return 0;
+		}
+		if (mapping->size) {
+			degree = mapping->degrees[wrap(key, mapping->size)];
+			if (degree < 0) {
+				return 0;
+			}
+			degree += floorDivide(key, mapping->size) * mapping->octaveDegree;
+		}
+	}
+	int32_t size = tuning->size;
+	return tuning->pitches[wrap(degree, size)] * pow(tuning->pitches[size], floorDivide(degree, size));
+}
+
+// nearest fraction with a denominator up to maxDenominator, from the continued fraction of value
+static void approximate(double value, uint64_t maxDenominator, uint64_t * numerator, uint64_t * denominator) {
+	uint64_t p0 = 0, q0 = 1;
+	uint64_t p1 = 1, q1 = 0;
+	double x = value;
+	for (int32_t i = 0; i < 64; i++) {
+		double whole = floor(x);
+		uint64_t term = (uint64_t) whole;
+		uint64_t q2 = q0 + term * q1;
+		if (q2 > maxDenominator) {
+			// the largest semiconvergent that fits can still beat the last convergent
+			uint64_t k = (maxDenominator - q0) / q1;
+			uint64_t p = p0 + k * p1;
+			uint64_t q = q0 + k * q1;
+			if (fabs((double) p / q - value) < fabs((double) p1 / q1 - value)) {
+				p1 = p;
+				q1 = q;
+			}
+			break;
+		}
+		uint64_t p2 = p0 + term * p1;
+		p0 = p1;
+		q0 = q1;
+		p1 = p2;
+		q1 = q2;
+		if (x - whole < 1e-9) {
+			break;
+		}
+		x = 1.0 / (x - whole);
+	}
+	*numerator = p1;
+	*denominator = q1;
+}
+
+int32_t ScaleImport::compile(const char * scl, const char * kbm, Grid * out) {
+
+	ScalaTuning * tuning = (ScalaTuning *) malloc(sizeof(ScalaTuning));
+	ScalaMapping * mapping = kbm ? (ScalaMapping *) malloc(sizeof(ScalaMapping)) : 0;
+	int32_t keysPerPeriod = 0;
+	double * keyRatios = 0;
+
+	int32_t valid = tuning && parseScl(scl, tuning) && (!kbm || (mapping && parseKbm(kbm, mapping)));
+
+	if (valid) {
+		keysPerPeriod = tuning->size;
+		if (mapping && mapping->size) {
+			keysPerPeriod = 0;
+			for (int32_t i = 0; i < mapping->size; i++) {
+				keysPerPeriod += (mapping->degrees[i] >= 0);
+			}
+		}
+		valid = keysPerPeriod > 0;
+	}
+
+	// ratios of the mapped keys in order, enough either side of the middle for the highest mode's range
+	int32_t keySpan = (mapping && mapping->size) ? mapping->size : tuning ? tuning->size : 0;
+	int32_t reach = keySpan * (SCALE_IMPORT_OCTAVE_RANGE + 1) * 2 + SCALE_GRID_COLUMNS;
+	int32_t numKeys = 0;
+	int32_t root = 0;
+	if (valid) {
+		keyRatios = (double *) malloc(sizeof(double) * (2 * reach + 1));
+		valid = keyRatios != 0;
+	}
+	if (valid) {
+		for (int32_t key = -reach; key <= reach; key++) {
+			double ratio = keyRatio(tuning, mapping, key);
+			if (ratio > 0) {
+				root = (key <= 0) ? numKeys : root;
+				keyRatios[numKeys++] = ratio;
+			}
+		}
+		valid = numKeys > 0;
+	}
+
+	if (valid) {
+
+		double range = pow(2.0, SCALE_IMPORT_OCTAVE_RANGE);
+		int32_t width = (SCALE_GRID_COLUMNS / 2) / (keysPerPeriod * SCALE_IMPORT_OCTAVE_RANGE);
+		width = (width < 1) ? 1 : width;
+
+		out->numNotes = 0;
+
+		for (int32_t row = 0; row < SCALE_IMPORT_ROWS; row++) {
+
+			int32_t rowRoot = root + (row * keysPerPeriod) / SCALE_IMPORT_ROWS;
+			rowRoot = (rowRoot >= numKeys) ? numKeys - 1 : rowRoot;
+
+			for (int32_t column = 0; column < SCALE_GRID_COLUMNS; column++) {
+
+				// step back toward the root until the note is in range
+				int32_t step = floorDivide(column - SCALE_GRID_COLUMNS / 2, width);
+				double ratio = 1.0;
+				while (1) {
+					int32_t index = rowRoot + step;
+					index = (index < 0) ? 0 : (index >= numKeys) ? numKeys - 1 : index;
+					ratio = keyRatios[index] / keyRatios[rowRoot];
+					if ((ratio <= range && ratio >= 1.0 / range) || step == 0) {
+						break;
+					}
+					step += (step > 0) ? -1 : 1;
+				}
+
+				uint64_t numerator;
+				uint64_t denominator;
+				approximate(ratio, SCALE_IMPORT_MAX_DENOMINATOR, &numerator, &denominator);
+				if (!numerator) {
+					numerator = 1;
+					denominator = SCALE_IMPORT_MAX_DENOMINATOR;
+				}
+
+				// integerPart:fractionalPart is the ratio in 16.48 fixed point, gcd the edges between realignments
+				uint64_t fixed = ((numerator / denominator) << 48) + (((numerator % denominator) << 48) / denominator);
+
+				uint32_t note = 0;
+				while (note < out->numNotes && (out->ratios[note] != fixed || out->gcds[note] != denominator)) {
+					note++;
+				}
+				if (note == out->numNotes) {
+					out->ratios[note] = fixed;
+					out->gcds[note] = (uint32_t) denominator;
+					out->numNotes++;
+				}
+				out->cells[row * SCALE_GRID_COLUMNS + column] = note;
+
+			}
+		}
+	}
+
+	free(keyRatios);
+	free(mapping);
+	free(tuning);
+
+	return valid;
+}
+
+int32_t ScaleImport::readCache(const char * cachePath, uint32_t sourceSize, uint32_t sourceHash, Grid * out) {
+
+	FILE * file = fopen(cachePath, "rb");
+	if (!file) {
+		return 0;
+	}
+
+	ScaleCacheHeader header;
+	int32_t valid = (fread(&header, sizeof(header), 1, file) == 1) &&
+			!memcmp(header.magic, "VIAS", 4) &&
+			header.version == SCALE_CACHE_VERSION &&
+			header.sourceSize == sourceSize &&
+			header.sourceHash == sourceHash &&
+			header.numNotes && header.numNotes <= SCALE_IMPORT_ROWS * SCALE_GRID_COLUMNS;
+
+	valid = valid &&
+			fread(out->cells, sizeof(out->cells), 1, file) == 1 &&
+			fread(out->ratios, sizeof(out->ratios[0]), header.numNotes, file) == header.numNotes &&
+			fread(out->gcds, sizeof(out->gcds[0]), header.numNotes, file) == header.numNotes;
+
+	fclose(file);
+
+	// a cell past the notes would read off the end of the ratios
+	for (int32_t i = 0; valid && i < SCALE_IMPORT_ROWS * SCALE_GRID_COLUMNS; i++) {
+		valid = out->cells[i] < header.numNotes;
+	}
+
+	if (valid) {
+		out->numNotes = header.numNotes;
+	}
+
+	return valid;
+}
+
+void ScaleImport::writeCache(const Grid * in, const char * cachePath, uint32_t sourceSize, uint32_t sourceHash) {
+
+	FILE * file = fopen(cachePath, "wb");
+	if (!file) {
+		return;
+	}
+
+	ScaleCacheHeader header;
+	memcpy(header.magic, "VIAS", 4);
+	header.version = SCALE_CACHE_VERSION;
+	header.sourceSize = sourceSize;
+	header.sourceHash = sourceHash;
+	header.numNotes = in->numNotes;
+
+	fwrite(&header, sizeof(header), 1, file);
+	fwrite(in->cells, sizeof(in->cells), 1, file);
+	fwrite(in->ratios, sizeof(in->ratios[0]), in->numNotes, file);
+	fwrite(in->gcds, sizeof(in->gcds[0]), in->numNotes, file);
+
+	fclose(file);
+}
+
+ScaleImport::~ScaleImport() {
+	delete current;
+	delete scratch;
+}
+
+int32_t ScaleImport::import(const char * sclPath, const char * kbmPath, const char * cachePath) {
+
+	uint32_t sclSize = 0;
+	uint32_t kbmSize = 0;
+	char * scl = readText(sclPath, &sclSize);
+	char * kbm = kbmPath ? readText(kbmPath, &kbmSize) : 0;
+
+	int32_t compiled = 0;
+
+	if (scl && (kbm || !kbmPath)) {
+		// compile into the spare grid, the PLL keeps reading the current one until the swap
+		if (!scratch) {
+			scratch = new Grid;
+		}
+		uint32_t hash = hashText(hashText(2166136261u, scl, sclSize), kbm, kbmSize);
+		uint32_t size = sclSize + kbmSize;
+		compiled = cachePath && readCache(cachePath, size, hash, scratch);
+		if (!compiled) {
+			compiled = compile(scl, kbm, scratch);
+			if (compiled && cachePath) {
+				writeCache(scratch, cachePath, size, hash);
+			}
+		}
+	}
+
+	if (compiled) {
+		Grid * replaced = current;
+		current = scratch;
+		scratch = replaced;
+	}
+
+	free(kbm);
+	free(scl);
+
+	return compiled;
+}
+
+#endif
@@ -6,12 +6,18 @@ void ViaSync::init(void) {
 	initializeAuxOutputs();
 
 	fillWavetableArray();
+#ifdef WAVETABLE_INCREMENTAL_LOAD
+	wavetableLoader.init((uint32_t *) wavetableBuffers[0], (uint32_t *) wavetableBuffers[1], WAVETABLE_12_BIT);
+#endif
+#ifdef WAVETABLE_MIPMAP
+	syncWavetable.mipmap = &wavetableMipmap;
+#endif
 
 	// switchWavetable(wavetableArray[0][0]);
 
 	initializeScales();
 
-	scale = (Scale *) scaleArray[0][0];
+	scale = scaleArray[0][0];
 
 	calculateDac3 = &ViaSync::calculateDac3Phasor;
 	calculateLogicA = &ViaSync::calculateLogicAGate;
@@ -16,6 +16,9 @@ void ViaSync::mainRisingEdgeCallback(void) {
 
 	} else {
 
+		// the reading spans the edges that piled up as well as this one
+		clockDiv = pileUp + 1;
+		pileUp = 0;
 		measureFrequency(reading);
 #ifdef BUILD_VIRTUAL
 		uint32_t playbackPosition = (reading % 1440)/180;
@@ -26,8 +29,6 @@ void ViaSync::mainRisingEdgeCallback(void) {
 
 		phaseSignal = syncWavetable.purePhaseOut[playbackPosition];
 		doCorrection = 0;
-		clockDiv = pileUp + 1;
-		pileUp = 0;
 
 		int32_t multKey = fracMultiplier + intMultiplier;
 		ratioChange = (lastMultiplier != multKey);
@@ -92,7 +93,7 @@ void ViaSync::buttonPressedCallback(void) {
 
 	if (tapTempo != 0) {
 		// store the length of the last period
-		// average against the current length
+		// the estimator averages it with the taps before
 
 #ifdef BUILD_F373
 
@@ -108,10 +109,7 @@ void ViaSync::buttonPressedCallback(void) {
 		resetMeasurementTimer();
 #endif
 
-		tapSum += tap - readBuffer(&tapStore, 1);
-		writeBuffer(&tapStore, tap);
-
-		periodCount = tapSum >> 1;
+		periodCount = periodEstimator.update(tap);
 
 		lastTap = tap;
 
@@ -169,7 +167,7 @@ void ViaSync::halfTransferCallback(void) {
 
 	updateFrequency();
 
-	syncWavetable.advance((uint32_t *)wavetableRead, 0);
+	syncWavetable.advance(wavetableRead, 0);
 
 	int32_t thisSample = syncWavetable.ghostPhase >> 16;
 	int32_t thisState = !(thisSample >> 8);
@@ -189,7 +187,7 @@ void ViaSync::transferCompleteCallback(void) {
 
 	updateFrequency();
 
-	syncWavetable.advance((uint32_t *)wavetableRead, SYNC_BUFFER_SIZE);
+	syncWavetable.advance(wavetableRead, SYNC_BUFFER_SIZE);
 
 	int32_t thisSample = syncWavetable.ghostPhase >> 16;
 	int32_t thisState = !(thisSample >> 8);
@@ -206,6 +204,18 @@ void ViaSync::transferCompleteCallback(void) {
 void ViaSync::slowConversionCallback(void) {
 
 	controls.update();
+#ifdef WAVETABLE_INCREMENTAL_LOAD
+	if (wavetableLoader.step()) {
+		wavetableRead = wavetableLoader.front;
+		syncWavetable.tableSize = wavetableLoader.active->numWaveforms - 1;
+#ifdef WAVETABLE_MIPMAP
+		wavetableMipmap.load(wavetableRead, wavetableLoader.active->numWaveforms, WAVETABLE_12_BIT);
+#endif
+	}
+#endif
+#ifdef WAVETABLE_MIPMAP
+	wavetableMipmap.step();
+#endif
 	syncWavetable.parseControls(&controls);
 	parseControls(&controls, &inputs);
 
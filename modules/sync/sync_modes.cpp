@@ -27,7 +27,7 @@ void ViaSync::handleButton1ModeChange(int32_t mode) {
 
 void ViaSync::handleButton2ModeChange(int32_t mode) {
 
-	selectedScale = (Scale *) scaleArray[syncUI.GROUP_MODE][mode];
+	selectedScale = scaleArray[syncUI.GROUP_MODE][mode];
 	scaleHue =  mode + syncUI.GROUP_MODE * 4;
 	scaleColor.r = hueSpace[scaleHue].r;
 	scaleColor.g = hueSpace[scaleHue].g;
@@ -86,7 +86,7 @@ void ViaSync::handleButton4ModeChange(int32_t mode) {
 void ViaSync::handleButton5ModeChange(int32_t mode) {
 
 	syncUI.SCALE_MODE = 0;
-	selectedScale = (Scale *) scaleArray[mode][syncUI.SCALE_MODE];
+	selectedScale = scaleArray[mode][syncUI.SCALE_MODE];
 	scaleHue = mode * 4 + syncUI.SCALE_MODE;
 	scaleColor.r = hueSpace[scaleHue].r;
 	scaleColor.g = hueSpace[scaleHue].g;
@@ -103,7 +103,7 @@ void ViaSync::handleButton5ModeChange(int32_t mode) {
 
 void ViaSync::handleButton5ModeInit(int32_t mode) {
 
-	selectedScale = (Scale *) scaleArray[mode][syncUI.SCALE_MODE];
+	selectedScale = scaleArray[mode][syncUI.SCALE_MODE];
 	scaleHue = mode * 4 + syncUI.SCALE_MODE;
 	scaleColor.r = hueSpace[scaleHue].r;
 	scaleColor.g = hueSpace[scaleHue].g;
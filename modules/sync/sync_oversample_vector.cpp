@@ -0,0 +1,93 @@
+/*
+ * sync_oversample_vector.cpp
+ *
+ *  Virtual build only: vector kernel for the SyncWavetable oversample loop.
+ */
+
+#include "sync.hpp"
+
+#ifdef SYNC_OVERSAMPLE_VECTOR
+
+#include <immintrin.h>
+
+/// Eight samples a pass, each lane doing what one trip through the scalar loop does:
+/// phase ramp, pwm warp, morph ramp and the two prediffed table reads.
+/// Wrapping integer arithmetic throughout, as on the scalar path.
+__attribute__((target("avx2")))
+static void oversampleAVX2(uint32_t phase, int32_t increment, const PhaseWarp & warp, const MorphRamp & ramp,
+		int32_t length, uint32_t * purePhaseOut, uint32_t * phaseOut, uint32_t * signalOut) {
+
+	const __m256i lanes = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8);
+	const __m256i low16 = _mm256_set1_epi32(0xFFFF);
+	const __m256i rowLength = _mm256_set1_epi32(517);
+	const __m256i halfCycle = _mm256_set1_epi32(0x80000000);
+	const __m256i breakpoint = _mm256_set1_epi32(warp.breakpoint);
+	const __m256i slopeUp = _mm256_set1_epi32(warp.slopeUp);
+	const __m256i slopeDown = _mm256_set1_epi32(warp.slopeDown);
+	const int * table = (const int *) ramp.slope;
+
+	__m256i localPhase = _mm256_add_epi32(_mm256_set1_epi32(phase),
+			_mm256_mullo_epi32(_mm256_set1_epi32(increment), lanes));
+	const __m256i phaseStep = _mm256_set1_epi32((uint32_t) increment << 3);
+
+	// morph position relative to the ramp's current row, the row is the integer part
+	__m256i position = _mm256_add_epi32(_mm256_set1_epi32(ramp.frac),
+			_mm256_mullo_epi32(_mm256_set1_epi32(ramp.step), lanes));
+	const __m256i positionStep = _mm256_set1_epi32((uint32_t) ramp.step << 3);
+
+	for (int32_t i = 0; i < length; i += 8) {
+
+		_mm256_storeu_si256((__m256i *) (purePhaseOut + i), localPhase);
+
+		// pick the segment then do the 32 x 32 -> 64 bit multiply in the even and odd lanes separately
+		__m256i above = _mm256_cmpeq_epi32(_mm256_max_epu32(localPhase, breakpoint), localPhase);
+		__m256i offset = _mm256_sub_epi32(localPhase, _mm256_and_si256(above, breakpoint));
+		__m256i slope = _mm256_blendv_epi8(slopeUp, slopeDown, above);
+		__m256i even = _mm256_srli_epi64(_mm256_mul_epu32(offset, slope), 16);
+		__m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(offset, 32), _mm256_srli_epi64(slope, 32));
+		odd = _mm256_slli_epi64(_mm256_srli_epi64(odd, 16), 32);
+		__m256i ghostPhase = _mm256_add_epi32(_mm256_blend_epi32(even, odd, 0xAA),
+				_mm256_and_si256(above, halfCycle));
+		ghostPhase = _mm256_srli_epi32(ghostPhase, 7);
+
+		_mm256_storeu_si256((__m256i *) (phaseOut + i), ghostPhase);
+
+		__m256i index = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_srai_epi32(position, 16), rowLength),
+				_mm256_srli_epi32(ghostPhase, 16));
+		__m256i in0 = _mm256_i32gather_epi32(table, index, 4);
+		__m256i in1 = _mm256_i32gather_epi32(table + 1, index, 4);
+
+		// sample plus the prediffed slope scaled by the morph fraction, then across the phase fraction
+		__m256i morphFrac = _mm256_and_si256(position, low16);
+		in0 = _mm256_add_epi32(_mm256_and_si256(in0, low16),
+				_mm256_srai_epi32(_mm256_mullo_epi32(_mm256_srai_epi32(in0, 16), morphFrac), 16));
+		in1 = _mm256_add_epi32(_mm256_and_si256(in1, low16),
+				_mm256_srai_epi32(_mm256_mullo_epi32(_mm256_srai_epi32(in1, 16), morphFrac), 16));
+		__m256i phaseFrac = _mm256_and_si256(ghostPhase, low16);
+		__m256i sample = _mm256_add_epi32(in0,
+				_mm256_srai_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(in1, in0), phaseFrac), 16));
+
+		_mm256_storeu_si256((__m256i *) (signalOut + i), sample);
+
+		localPhase = _mm256_add_epi32(localPhase, phaseStep);
+		position = _mm256_add_epi32(position, positionStep);
+
+	}
+
+}
+
+static SyncWavetable::OversampleKernel selectOversampleKernel(void) {
+
+	// may run before main, so initialize the feature flags explicitly
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx2")) {
+		return oversampleAVX2;
+	}
+	return 0;
+
+}
+
+SyncWavetable::OversampleKernel SyncWavetable::oversampleKernel = selectOversampleKernel();
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * sync_pll_bench.cpp
+ *
+ *  Virtual build only: measure how the PLL locks to synthetic clocks.
+ */
+
+#include "sync.hpp"
+
+#ifdef BUILD_VIRTUAL
+
+#include <chrono>
+#include <new>
+
+PllBenchResult ViaSync::benchPLL(int32_t mode, int32_t group, int32_t scale, int32_t ratioX, int32_t ratioY, SyntheticClock clock, int32_t edges) {
+
+	syncUI.SYNC_MODE = mode;
+	handleButton4ModeChange(mode);
+	syncUI.GROUP_MODE = group;
+	syncUI.SCALE_MODE = scale;
+	handleButton2ModeChange(scale);
+
+	// settle the averaged controls on the ratio before the first edge
+	controls.controlRateInputs[2] = ratioX;
+	controls.controlRateInputs[3] = ratioY;
+	controls.controlRateInputs[0] = 2048;
+	for (int32_t i = 0; i < 64; i++) {
+		slowConversionCallback();
+	}
+
+	PllMeter * meter = new PllMeter(edges);
+	int32_t lockFrom = clock.changeTo ? clock.changeEdge : 0;
+	int32_t sample = 0;
+	int32_t block = 0;
+
+	clock.start();
+
+	while (clock.edges < edges) {
+
+		// the measurement timer counts 1440 a block, the position in the block comes in as the fraction
+		measurementTimerFractional = (sample % SYNC_BUFFER_SIZE) * (1440 / SYNC_BUFFER_SIZE);
+		int32_t edge = clock.advance();
+		if (edge > 0) {
+			mainRisingEdgeCallback();
+		} else if (edge < 0) {
+			mainFallingEdgeCallback();
+		}
+
+		sample++;
+		if (sample % PLL_BENCH_SLOW_CONVERSION_SAMPLES == 0) {
+			slowConversionCallback();
+		}
+		if (sample % SYNC_BUFFER_SIZE) {
+			continue;
+		}
+
+		advanceMeasurementTimer();
+
+		// doPLL runs in the first block after each edge
+		int32_t correcting = !doCorrection;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		if (block & 1) {
+			transferCompleteCallback();
+		} else {
+			halfTransferCallback();
+		}
+		std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+		meter->addBlock(elapsed.count());
+		block++;
+
+		if (correcting) {
+			meter->addCorrection(pllError, clock.edges - lockFrom);
+		}
+
+	}
+
+	// intMultiplier is the ratio in 16.16, fracMultiplier extends it by 32 bits
+	float ratio = ((double) intMultiplier * 4294967296.0 + fracMultiplier) / 281474976710656.0;
+	PllBenchResult result = meter->result(ratio);
+	delete meter;
+
+	return result;
+
+}
+
+void ViaSync::reportPLLBench(FILE * report, const SyntheticClock & clock, int32_t edges, int32_t ratios) {
+
+	fprintf(report, "period %g -> %g from edge %d over %d edges, jitter %g, drop every %d, %d edges\n",
+			clock.period, clock.changeTo, clock.changeEdge, clock.rampEdges, clock.jitter, clock.dropEvery, edges);
+	fprintf(report, "mode group scale  row    ratio  lock  phase error  jitter     peak       ns/block\n");
+
+	// one block on the heap for the whole sweep, a module is constructed afresh in it for each run
+	ViaSync * module = (ViaSync *) operator new(sizeof(ViaSync));
+
+	for (int32_t mode = 0; mode < 4; mode++) {
+		for (int32_t group = 0; group < 4; group++) {
+			for (int32_t scale = 0; scale < 4; scale++) {
+				// rows the scale reaches, from a module as the runs will see it
+				new (module) ViaSync;
+				int32_t t2Bitshift = module->scaleArray[group][scale]->t2Bitshift;
+				module->~ViaSync();
+				for (int32_t row = 0; row < SCALE_GRID_ROWS(t2Bitshift); row++) {
+					// the middle of the row on the ratio Y knob
+					int32_t ratioY = (row << t2Bitshift) + (1 << (t2Bitshift - 1));
+					for (int32_t i = 0; i < ratios; i++) {
+						int32_t ratioX = (4096 * (2 * i + 1)) / (2 * ratios);
+						new (module) ViaSync;
+						PllBenchResult result = module->benchPLL(mode, group, scale, ratioX, ratioY, clock, edges);
+						module->~ViaSync();
+						fprintf(report, "%4d %5d %5d %4d %8.4f %5d  %10.6f  %10.6f %10.6f %10.1f\n",
+								mode, group, scale, row, result.ratio, result.lockEdges,
+								result.phaseError, result.phaseJitter, result.peakError, result.blockTime);
+					}
+				}
+			}
+		}
+	}
+
+	operator delete(module);
+
+}
+
+#endif
@@ -19,3 +19,29 @@ void ViaSync::initializeScales() {
    scaleArray[3][2] = &triplets;
    scaleArray[3][3] = &poly_div_resets;
 }
+
+#ifdef BUILD_VIRTUAL
+
+// slot a user scale in with the built in ones
+int32_t ViaSync::importScale(const char * sclPath, const char * kbmPath, const char * cachePath, int32_t index, int32_t group, int32_t slot) {
+	if (index < 0 || index >= SCALE_USER_SCALES || group < 0 || group >= 4 || slot < 0 || slot >= 4) {
+		return 0;
+	}
+	const Scale * replaced = userScales[index].scale();
+	if (!userScales[index].import(sclPath, kbmPath, cachePath)) {
+		return 0;
+	}
+	// the replaced grid is the next import's scratch, so nothing can be left pointing at it
+	for (int32_t i = 0; i < 4; i++) {
+		for (int32_t j = 0; j < 4; j++) {
+			if (replaced && scaleArray[i][j] == replaced) {
+				scaleArray[i][j] = userScales[index].scale();
+			}
+		}
+	}
+	scaleArray[group][slot] = userScales[index].scale();
+	selectedScale = scaleArray[syncUI.GROUP_MODE][syncUI.SCALE_MODE];
+	return 1;
+}
+
+#endif
@@ -26,98 +26,107 @@ void ViaSync::fillWavetableArray(void) {
 }
 
 constexpr Wavetable SyncWavetableSet::csound_formants;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, csound_formants, csound_formants_attack, csound_formants_release, 9, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::moogSquare;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, moogSquare, moogSquareShiftAttackFamily, moogSquareShiftReleaseFamily, 9, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::impevens;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, impevens, impshort, impshort, 9, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::circular_257;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, circular_257, circular_257_slopes, circular_257_slopes, 4, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::new_perlin;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, new_perlin, new_perlin_slope, new_perlin_slope_2, 9, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::additive_evens;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, additive_evens, additive_evens_attack, additive_evens_attack, 9, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::trains_slim;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, trains_slim, trains_slim_attack, trains_slim_release, 8, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::sharpExpoSymSlim;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, sharpExpoSymSlim, sharpExpoSymSlimAttackFamily, sharpExpoSymSlimAttackFamily, 8, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::rhythm_steps;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, rhythm_steps, rhythm_steps_attack, rhythm_steps_release, 6, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::euc_odd_sharp;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, euc_odd_sharp, euc_odd_sharp_attacks, euc_odd_sharp_releases, 5, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::gammaAsymSlim;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, gammaAsymSlim, gammaAsymSlimAttackFamily, gammaAsymSlimReleaseFamily, 8, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::skipSaw;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, skipSaw, skipsaw, skipsaw, 5, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::triOdd;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, triOdd, trioddAttackFamily, trioddAttackFamily, 9, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::newest_bounce;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, newest_bounce, newest_bounce_attack, newest_bounce_release, 5, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::block_test;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, block_test, block_test_attack, block_test_release, 9, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::additive_pairs;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, additive_pairs, additive_pairs_slopes, additive_pairs_slopes, 9, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::new_waves;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, new_waves, new_waves_attack, new_waves_release, 5, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::test_fm;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, test_fm, test_fm_attack, test_fm_release, 5, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::sinwavefold_257;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, sinwavefold_257, sinwavefold_257_Family, sinwavefold_257_Family, 9, WAVETABLE_12_BIT)
 constexpr Wavetable SyncWavetableSet::additive_tri_to_pulse;
+WAVETABLE_IMAGE_DEF(SyncWavetableSet, additive_tri_to_pulse, additive_tri_to_pulseFamily, additive_tri_to_pulseFamily, 5, WAVETABLE_12_BIT)
 
-constexpr uint16_t SyncWavetableSet::moogSquareShiftAttackFamily[9][257];
-
-constexpr uint16_t SyncWavetableSet::moogSquareShiftReleaseFamily[9][257];
-
-constexpr uint16_t SyncWavetableSet::trioddAttackFamily[9][257];
-
-constexpr uint16_t SyncWavetableSet::impshort[9][257];
-
-constexpr uint16_t SyncWavetableSet::skipsaw[5][257];
-
-constexpr uint16_t SyncWavetableSet::sinwavefold_257_Family[9][257];
-
-constexpr uint16_t SyncWavetableSet::additive_tri_to_pulseFamily[5][257];
-
-constexpr uint16_t SyncWavetableSet::circular_257_slopes[4][257];
-
-constexpr uint16_t SyncWavetableSet::test_fm_attack[5][257];
-
-constexpr uint16_t SyncWavetableSet::test_fm_release[5][257];
-
-constexpr uint16_t SyncWavetableSet::csound_formants_attack[9][257];
-
-constexpr uint16_t SyncWavetableSet::csound_formants_release[9][257];
-
-constexpr uint16_t SyncWavetableSet::new_perlin_slope[9][257];
-
-constexpr uint16_t SyncWavetableSet::new_perlin_slope_2[9][257];
-
-constexpr uint16_t SyncWavetableSet::additive_pairs_slopes[9][257];
-
-constexpr uint16_t SyncWavetableSet::block_test_attack[9][257];
-
-constexpr uint16_t SyncWavetableSet::block_test_release[9][257];
-
-constexpr uint16_t SyncWavetableSet::additive_evens_attack[9][257];
-
-constexpr uint16_t SyncWavetableSet::newest_bounce_attack[5][257];
-
-constexpr uint16_t SyncWavetableSet::newest_bounce_release[5][257];
-
-constexpr uint16_t SyncWavetableSet::euc_odd_sharp_attacks[5][257];
-
-constexpr uint16_t SyncWavetableSet::euc_odd_sharp_releases[5][257];
-
-constexpr uint16_t SyncWavetableSet::new_waves_attack[5][257];
-
-constexpr uint16_t SyncWavetableSet::new_waves_release[5][257];
-
-constexpr uint16_t SyncWavetableSet::rhythm_steps_attack[6][257];
-
-constexpr uint16_t SyncWavetableSet::rhythm_steps_release[6][257];
-
-constexpr uint16_t SyncWavetableSet::gammaAsymSlimAttackFamily[8][257];
-
-constexpr uint16_t SyncWavetableSet::gammaAsymSlimReleaseFamily[8][257];
-
-constexpr uint16_t SyncWavetableSet::sharpExpoSymSlimAttackFamily[8][257];
-
-constexpr uint16_t SyncWavetableSet::trains_slim_attack[8][257];
-
-constexpr uint16_t SyncWavetableSet::trains_slim_release[8][257];
+SYNC_WAVETABLE_FAMILIES(WAVETABLE_FAMILY_DEF)
 
 
 // declare functions to set the currently active tables
 void ViaSync::switchWavetable(const Wavetable * table) {
-	wavetableSet.loadWavetableWithDiff(table, (uint32_t *) wavetableRead);
+#if defined(WAVETABLE_PREDECODED)
+	wavetableRead = table->image;
 	syncWavetable.tableSize = table->numWaveforms - 1;
+#elif defined(WAVETABLE_INCREMENTAL_LOAD)
+	// decoded a slope at a time in slowConversionCallback, which flips to it when complete
+	if (wavetableLoader.load(table)) {
+		wavetableRead = wavetableLoader.front;
+		syncWavetable.tableSize = table->numWaveforms - 1;
+#ifdef WAVETABLE_MIPMAP
+		wavetableMipmap.load(wavetableRead, table->numWaveforms, WAVETABLE_12_BIT);
+#endif
+	}
+#else
+	wavetableSet.loadWavetableWithDiff(table, wavetableBuffer[0]);
+	syncWavetable.tableSize = table->numWaveforms - 1;
+#endif
+#if defined(WAVETABLE_MIPMAP) && !defined(WAVETABLE_INCREMENTAL_LOAD)
+	wavetableMipmap.load(wavetableRead, table->numWaveforms, WAVETABLE_12_BIT);
+#endif
 }
 
 // declare functions to set the currently active tables
 void ViaSync::switchWavetableGlobal(const Wavetable * table) {
-	wavetableSet.loadWavetableWithDiff(table, (uint32_t *) wavetableRead);
-	syncWavetable.tableSize = table->numWaveforms - 1;
+	switchWavetable(table);
+}
+
+#ifdef BUILD_VIRTUAL
+
+// slot a user table in with the built in ones, the global tables are left alone
+int32_t ViaSync::importWavetable(const char * path, const char * cachePath, int32_t index, int32_t bank, int32_t slot) {
+	if (index < 0 || index >= WAVETABLE_USER_TABLES || bank < 0 || bank >= 4 || slot < 0 || slot >= 4) {
+		return 0;
+	}
+	// the import overwrites the table this index held before its last import, which a load could still be reading
+#ifdef WAVETABLE_INCREMENTAL_LOAD
+	if (wavetableLoader.loading()) {
+		return 0;
+	}
+#endif
+	const Wavetable * replaced = userWavetables[index].table();
+	if (!userWavetables[index].import(path, cachePath, 9, WAVETABLE_12_BIT)) {
+		return 0;
+	}
+	// move every slot off the replaced table so nothing points at it when it is reused
+	for (int32_t i = 0; i < 4; i++) {
+		for (int32_t j = 0; j < 4; j++) {
+			wavetableArray[i][j] = (replaced && wavetableArray[i][j] == replaced) ?
+					userWavetables[index].table() : wavetableArray[i][j];
+		}
+	}
+	wavetableArray[bank][slot] = userWavetables[index].table();
+	if (!syncUI.TABLE_GROUP_MODE &&
+			wavetableArray[syncUI.GROUP_MODE][syncUI.TABLE_MODE] == userWavetables[index].table()) {
+		switchWavetable(userWavetables[index].table());
+	}
+	return 1;
 }
 
+#endif
@@ -15,7 +15,7 @@ void SyncWavetable::parseControls(ViaControls * controls) {
 
 
 
-void SyncWavetable::spline(uint32_t * wavetable, uint32_t writePosition) {
+void SyncWavetable::spline(const uint32_t * wavetable, uint32_t writePosition) {
 
 	uint32_t localPhase = phase;
 
@@ -44,25 +44,15 @@ void SyncWavetable::spline(uint32_t * wavetable, uint32_t writePosition) {
 
 	int32_t localPWM = (int32_t) pwm[0];
 	localPWM <<= 1;
-	localPWM = localPWM + cv2Offset + 32768;
-	if (localPWM >= 0xFFFF) {localPWM = 0xFFFF - 1;}
-	else if (localPWM <= 0) {localPWM = 1;}
-	int32_t bendUp = 0xFFFFFFFF / localPWM;
-	int32_t bendDown = 0xFFFFFFFF / (0xFFFF - localPWM);
+	pwmWarp.set(__USAT(localPWM + cv2Offset + 32768, 16));
 
-#define SPLINE_PWM_PHASE_FRAC (localPhase & 0x3FFFFFF) >> 11
-		// use this with the precalculated pwm to perform bilinear interpolation
-		// this accomplishes the
-	// int32_t	localGhostPhase = fix15_bilerp(pwmTable1[leftSample], pwmTable2[leftSample],
-	// 			pwmTable1[leftSample + 1], pwmTable2[leftSample + 1], pwmFrac,
-	// 			SPLINE_PWM_PHASE_FRAC);
-
-	int32_t localGhostPhase = phaseDist(localPhase, localPWM, bendUp, bendDown) >> 7;
+	int32_t localGhostPhase = pwmWarp.warp(localPhase) >> 7;
 
 
 	int32_t morph = (int32_t) -morphMod[0];
 	morph += cv3Offset;
 	morph = __USAT(morph + morphBase, 16);
+	lastMorph = morph;
 
 	morph *= tableSize;
 
@@ -87,7 +77,7 @@ void SyncWavetable::spline(uint32_t * wavetable, uint32_t writePosition) {
 
 }
 
-void SyncWavetable::oversample(uint32_t * wavetable, uint32_t writePosition) {
+void SyncWavetable::oversample(const uint32_t * wavetable, uint32_t writePosition) {
 
 	int32_t pmAmount = (int32_t) -pm[0];
 	pmAmount += 32767 + cv2Offset;
@@ -99,22 +89,15 @@ void SyncWavetable::oversample(uint32_t * wavetable, uint32_t writePosition) {
 
 	int32_t localPWM = (int32_t) pwm[0];
 	localPWM <<= 1;
-	localPWM = __USAT(localPWM + cv2Offset + 32768, 16);
-#ifdef BUILD_VIRTUAL
-	if (localPWM >= 0xFFFF) {localPWM = 0xFFFF - 1;}
-	else if (localPWM <= 0) {localPWM = 1;}
-#endif
-	int32_t bendUp = 0xFFFFFFFF / localPWM;
-	int32_t bendDown = 0xFFFFFFFF / (0xFFFF - localPWM);
+	pwmWarp.set(__USAT(localPWM + cv2Offset + 32768, 16));
 
-	// combine knob and CV then to table size in 16.16 fixed point
+	// combine knob and CV then ramp to it across the block in 16.16 fixed point table coordinates
 	int32_t morphModLocal = -morphMod[0];
 	morphModLocal += cv3Offset;
-	uint32_t scaledMorph = __USAT((morphBase + morphModLocal), 16) * tableSize;
-	uint32_t morphIndex = scaledMorph >> 16;
-	uint32_t morphFrac = scaledMorph & 0xFFFF;
-	// assuming that each phase distortion lookup table is 517 samples long stored as int
-	wavetable += (morphIndex * 517) + 2;
+	int32_t morph = __USAT((morphBase + morphModLocal), 16);
+	MorphRamp ramp;
+	ramp.start(wavetable, tableSize, lastMorph, morph, bufferSize);
+	lastMorph = morph;
 
 	// scale increment to size of new phase space (<< 7) and down by oversampling factor
 	int32_t localIncrement = increment + phaseModulationValue;
@@ -127,6 +110,18 @@ void SyncWavetable::oversample(uint32_t * wavetable, uint32_t writePosition) {
 
 	int32_t localGhostPhase = 0;
 
+#ifdef SYNC_OVERSAMPLE_VECTOR
+	if (oversampleKernel && !(bufferSize & 7)) {
+		oversampleKernel(localPhase, localIncrement, pwmWarp, ramp, bufferSize,
+				purePhaseOut + writePosition, phaseOut + writePosition, signalOut + writePosition);
+		// pick up at the last sample to get its delta
+		localPhase += (uint32_t) localIncrement * samplesRemaining;
+		ramp.advanceBy(samplesRemaining);
+		writeIndex += samplesRemaining;
+		samplesRemaining = 0;
+	}
+#endif
+
 	while (samplesRemaining) {
 
 		// phase pointer wraps at 32 bits
@@ -134,7 +129,7 @@ void SyncWavetable::oversample(uint32_t * wavetable, uint32_t writePosition) {
 
 		purePhaseOut[writeIndex] = localPhase;
 
-		localGhostPhase = phaseDist(localPhase, localPWM, bendUp, bendDown) >> 7;
+		localGhostPhase = pwmWarp.warp(localPhase) >> 7;
 
 		// write phase out
 		phaseOut[writeIndex] = localGhostPhase;
@@ -142,8 +137,9 @@ void SyncWavetable::oversample(uint32_t * wavetable, uint32_t writePosition) {
 		// but with the appropriate scaling as phase is now 25 bits and table length is 9 bits
 		leftSample = localGhostPhase >> 16;
 #define OS_PHASE_FRAC (localGhostPhase & 0xFFFF)
+		ramp.advance();
 		signalOut[writeIndex] = fast_15_16_bilerp_prediff(
-				wavetable[leftSample], wavetable[leftSample + 1], morphFrac,
+				ramp.slope[leftSample], ramp.slope[leftSample + 1], ramp.frac,
 				OS_PHASE_FRAC);
 		writeIndex++;
 		samplesRemaining--;
@@ -153,7 +149,7 @@ void SyncWavetable::oversample(uint32_t * wavetable, uint32_t writePosition) {
 
 	purePhaseOut[writeIndex] = localPhase;
 
-	localGhostPhase = phaseDist(localPhase, localPWM, bendUp, bendDown) >> 7;
+	localGhostPhase = pwmWarp.warp(localPhase) >> 7;
 
 	phaseOut[writeIndex] = localGhostPhase;
 
@@ -161,8 +157,9 @@ void SyncWavetable::oversample(uint32_t * wavetable, uint32_t writePosition) {
 
 	// get the delta
 
+	ramp.advance();
 	signalOut[writeIndex] = fast_15_16_bilerp_prediff_deltaValue(
-			wavetable[leftSample], wavetable[leftSample + 1], morphFrac,
+			ramp.slope[leftSample], ramp.slope[leftSample + 1], ramp.frac,
 			OS_PHASE_FRAC, &delta);
 
 	// this should give a sample at 0 phase for hard sync
@@ -0,0 +1,119 @@
+/*
+ * sync3_pll_bench.cpp
+ *
+ *  Virtual build only: measure how the frequency correction locks to synthetic clocks.
+ */
+
+#include "sync3.hpp"
+
+#ifdef BUILD_VIRTUAL
+
+#include <chrono>
+#include <new>
+#include <stdlib.h>
+
+PllBenchResult ViaSync3::benchPLL(int32_t scale, int32_t ratio, int32_t cvRow, SyntheticClock clock, int32_t edges) {
+
+	sync3UI.button2Mode = scale;
+	handleButton2ModeChange(scale);
+
+	// settle the averaged controls on the ratios before the first edge
+	controls.controlRateInputs[2] = ratio;
+	controls.controlRateInputs[3] = ratio;
+	controls.controlRateInputs[1] = ratio;
+	controls.controlRateInputs[0] = 2048;
+	// hold the ratio CVs of outputs 2 and 3 in the middle of the step cvRow adds to the knob index
+	int32_t cvOffset = ((cvRow << 8) + 128 - 2048) << 4;
+	inputs.cv2Samples[0] = __SSAT(cv2Calibration - cvOffset, 16);
+	inputs.cv3Samples[0] = __SSAT(cv3Calibration - cvOffset, 16);
+	for (int32_t i = 0; i < 64 * 3; i++) {
+		slowConversionCallback();
+	}
+
+	PllMeter * meter = new PllMeter(edges);
+	int32_t lockFrom = clock.changeTo ? clock.changeEdge : 0;
+	int32_t sample = 0;
+	int32_t block = 0;
+
+	clock.start();
+
+	while (clock.edges < edges) {
+
+		// the measurement timer counts 1440 a block, the position in the block comes in as the fraction
+		measurementTimerFractional = (sample % VIA_SYNC3_BUFFER_SIZE) * (1440 / VIA_SYNC3_BUFFER_SIZE);
+		int32_t edge = clock.advance();
+		if (edge > 0) {
+			mainRisingEdgeCallback();
+		} else if (edge < 0) {
+			mainFallingEdgeCallback();
+		}
+
+		advanceTimer1();
+		advanceTimer2();
+
+		sample++;
+		if (sample % PLL_BENCH_SLOW_CONVERSION_SAMPLES == 0) {
+			slowConversionCallback();
+		}
+		if (sample % VIA_SYNC3_BUFFER_SIZE) {
+			continue;
+		}
+
+		advanceMeasurementTimer();
+
+		// updateFrequencies corrects one output a block after each edge
+		int32_t correcting = (freqCorrect == 2);
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		if (block & 1) {
+			transferCompleteCallback();
+		} else {
+			halfTransferCallback();
+		}
+		std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+		meter->addBlock(elapsed.count());
+		block++;
+
+		if (correcting && freqCorrect == 3) {
+			int32_t worst = pllError[0];
+			worst = (abs(pllError[1]) > abs(worst)) ? pllError[1] : worst;
+			worst = (abs(pllError[2]) > abs(worst)) ? pllError[2] : worst;
+			meter->addCorrection(worst, clock.edges - lockFrom);
+		}
+
+	}
+
+	PllBenchResult result = meter->result((float) numerator1Alt / denominator1Select);
+	delete meter;
+
+	return result;
+
+}
+
+void ViaSync3::reportPLLBench(FILE * report, const SyntheticClock & clock, int32_t edges, int32_t ratios) {
+
+	fprintf(report, "period %g -> %g from edge %d over %d edges, jitter %g, drop every %d, %d edges\n",
+			clock.period, clock.changeTo, clock.changeEdge, clock.rampEdges, clock.jitter, clock.dropEvery, edges);
+	fprintf(report, "scale  cv    ratio  lock  phase error  jitter     peak       ns/block\n");
+
+	// one block on the heap for the whole sweep, a module is constructed afresh in it for each run
+	ViaSync3 * module = (ViaSync3 *) operator new(sizeof(ViaSync3));
+
+	for (int32_t scale = 0; scale < 8; scale++) {
+		for (int32_t cvRow = 0; cvRow < 16; cvRow++) {
+			for (int32_t i = 0; i < ratios; i++) {
+				int32_t ratio = (4096 * (2 * i + 1)) / (2 * ratios);
+				new (module) ViaSync3;
+				PllBenchResult result = module->benchPLL(scale, ratio, cvRow, clock, edges);
+				module->~ViaSync3();
+				fprintf(report, "%5d %3d %8.4f %5d  %10.6f  %10.6f %10.6f %10.1f\n",
+						scale, cvRow, result.ratio, result.lockEdges,
+						result.phaseError, result.phaseJitter, result.peakError, result.blockTime);
+			}
+		}
+	}
+
+	operator delete(module);
+
+}
+
+#endif
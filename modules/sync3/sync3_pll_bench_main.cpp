@@ -0,0 +1,37 @@
+/*
+ * sync3_pll_bench_main.cpp
+ *
+ *  Virtual build only: command line driver for ViaSync3::reportPLLBench.
+ *  Built with SYNC3_PLL_BENCH_MAIN defined, for example from the repo root:
+ *  g++ -std=c++11 -O2 -DBUILD_VIRTUAL -DSYNC3_PLL_BENCH_MAIN -Imodules/inc -Iui/inc -Iio/inc
+ *      modules/sync3/[a-z]*.cpp modules/shared/[a-z]*.cpp ui/src/[a-z]*.cpp io/src/[a-z]*.cpp -o sync3_pll_bench
+ */
+
+#include "sync3.hpp"
+
+#if defined(BUILD_VIRTUAL) && defined(SYNC3_PLL_BENCH_MAIN)
+
+#include <stdlib.h>
+
+int main(int argc, char ** argv) {
+
+	if (argc < 9) {
+		fprintf(stderr, "usage: %s period changeTo changeEdge rampEdges jitter dropEvery edges ratios\n", argv[0]);
+		return 1;
+	}
+
+	SyntheticClock clock;
+	clock.period = atof(argv[1]);
+	clock.changeTo = atof(argv[2]);
+	clock.changeEdge = atoi(argv[3]);
+	clock.rampEdges = atoi(argv[4]);
+	clock.jitter = atof(argv[5]);
+	clock.dropEvery = atoi(argv[6]);
+
+	ViaSync3::reportPLLBench(stdout, clock, atoi(argv[7]), atoi(argv[8]));
+
+	return 0;
+
+}
+
+#endif
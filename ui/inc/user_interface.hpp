@@ -260,6 +260,9 @@ public:
 	/// Virtual method used to represent writing the factory presets, implemented in subclasses.
 	virtual void writeStockPresets(void) {};
 
+	/// Virtual method called after a preset has been written from the preset menu, implemented in subclasses.
+	virtual void presetStoredCallback(int32_t position) {};
+
 	/// Initial setup of UI
 	virtual void initialize(void);
 
@@ -325,6 +328,8 @@ public:
 
 	/// Load a state page from the eeprom storage and set the mode variables accordingly. Position 0 is last state, positions 1-6 are presets.
 	void loadFromEEPROM(int32_t position);
+	/// Set the mode variables from modeStateBuffer without touching the EEPROM.
+	void decodeModeState(void);
 	/// Store the current modeStateBuffer to an EEPROM page, use position 0 for current state storage, positions 1-6 for presets 1-6.
 	void storeStateToEEPROM(int32_t position);
 	/// Store an arbitrary word to an EEPROM page, used to write calibration packet to position 7.
@@ -98,6 +98,7 @@ void ViaUI::presetPressedMenu(int32_t sig) {
 
 		case TIMEOUT_SIG:
 			storeStateToEEPROM(presetNumber);
+			presetStoredCallback(presetNumber);
 			presetNumber = 0;
 			transition(&ViaUI::newPreset);
 		break;
@@ -38,6 +38,12 @@ void ViaUI::initialize(void) {
 void ViaUI::loadFromEEPROM(int32_t position) {
 
 	loadStateFromMemory(position);
+	decodeModeState();
+	storeStateToEEPROM(0);
+
+}
+
+void ViaUI::decodeModeState(void) {
 
 	button1Mode = modeStateBuffer & BUTTON1_MASK;
 	button2Mode = (modeStateBuffer & BUTTON2_MASK) >> BUTTON2_SHIFT;
@@ -50,8 +56,6 @@ void ViaUI::loadFromEEPROM(int32_t position) {
 	aux3Mode = (modeStateBuffer & AUX_MODE3_MASK) >> AUX_MODE3_SHIFT;
 	aux4Mode = (modeStateBuffer & AUX_MODE4_MASK) >> AUX_MODE4_SHIFT;
 
-	storeStateToEEPROM(0);
-
 }
 
 // writes 2 16-bit values representing the modeStateBuffer word to EEPROM at the specified position,  1 runtime + 6 presets + calibration word